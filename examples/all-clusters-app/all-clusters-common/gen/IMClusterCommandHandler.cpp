@@ -22,10 +22,12 @@
 
 #include "app/common/gen/af-structs.h"
 #include "app/common/gen/callback.h"
+#include "app/common/gen/cluster-codecs.h"
 #include "app/common/gen/ids/Clusters.h"
 #include "app/common/gen/ids/Commands.h"
 #include "app/util/util.h"
 
+#include <app/CommandDispatchTable.h>
 #include <app/InteractionModelEngine.h>
 
 // Currently we need some work to keep compatible with ember lib.
@@ -38,355 +40,155 @@ namespace app {
 
 namespace clusters {
 
+namespace {
+
+void ReportInvalidCommand(app::Command * apCommandObj, ClusterId aClusterId, CommandId aCommandId, EndpointId aEndpointId,
+                          uint32_t validArgumentCount, uint32_t expectArgumentCount, CHIP_ERROR TLVError, CHIP_ERROR TLVUnpackError,
+                          uint32_t currentDecodeTagId)
+{
+    chip::app::CommandPathParams returnStatusParam = { aEndpointId,
+                                                       0, // GroupId
+                                                       aClusterId, aCommandId,
+                                                       (chip::app::CommandPathFlags::kEndpointIdValid) };
+    apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
+                                Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
+    ChipLogProgress(Zcl,
+                    "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
+                    ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
+                    validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+}
+
+} // namespace
+
 namespace BarrierControl {
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchBarrierControlGoToPercentCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::BarrierControl::Commands::Ids::BarrierControlGoToPercent: {
-            expectArgumentCount = 1;
-            uint8_t percentOpen;
-            bool argExists[1];
-
-            memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(percentOpen);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfBarrierControlClusterBarrierControlGoToPercentCallback(apCommandObj, percentOpen);
-            }
-            break;
-        }
-        case Clusters::BarrierControl::Commands::Ids::BarrierControlStop: {
+    expectArgumentCount = 1;
+    Clusters::BarrierControl::Commands::BarrierControlGoToPercent arguments;
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfBarrierControlClusterBarrierControlStopCallback(apCommandObj);
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::BarrierControl::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::BarrierControl::Id);
-            return;
-        }
-        }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfBarrierControlClusterBarrierControlGoToPercentCallback(apCommandObj, arguments.percentOpen);
     }
 
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::BarrierControl::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::BarrierControl::Id,
+                             Clusters::BarrierControl::Commands::Ids::BarrierControlGoToPercent, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
-} // namespace BarrierControl
-
-namespace Basic {
-
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchBarrierControlStopCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::Basic::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::Basic::Id);
-            return;
-        }
-        }
-    }
+
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfBarrierControlClusterBarrierControlStopCallback(apCommandObj);
 
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::Basic::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::BarrierControl::Id,
+                             Clusters::BarrierControl::Commands::Ids::BarrierControlStop, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
+} // namespace BarrierControl
+
+namespace Basic {
+
 } // namespace Basic
 
 namespace Binding {
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchBindCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::Binding::Commands::Ids::Bind: {
-            expectArgumentCount = 4;
-            chip::NodeId nodeId;
-            chip::GroupId groupId;
-            chip::EndpointId endpointId;
-            chip::ClusterId clusterId;
-            bool argExists[4];
-
-            memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(nodeId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(endpointId);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(clusterId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 4;
+    Clusters::Binding::Commands::Bind arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfBindingClusterBindCallback(apCommandObj, nodeId, groupId, endpointId, clusterId);
-            }
-            break;
-        }
-        case Clusters::Binding::Commands::Ids::Unbind: {
-            expectArgumentCount = 4;
-            chip::NodeId nodeId;
-            chip::GroupId groupId;
-            chip::EndpointId endpointId;
-            chip::ClusterId clusterId;
-            bool argExists[4];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfBindingClusterBindCallback(apCommandObj, arguments.nodeId, arguments.groupId, arguments.endpointId,
+                                                       arguments.clusterId);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Binding::Id, Clusters::Binding::Commands::Ids::Bind, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(nodeId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(endpointId);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(clusterId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchUnbindCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 4;
+    Clusters::Binding::Commands::Unbind arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfBindingClusterUnbindCallback(apCommandObj, nodeId, groupId, endpointId, clusterId);
-            }
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::Binding::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::Binding::Id);
-            return;
-        }
-        }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfBindingClusterUnbindCallback(apCommandObj, arguments.nodeId, arguments.groupId, arguments.endpointId,
+                                                         arguments.clusterId);
     }
 
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::Binding::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::Binding::Id, Clusters::Binding::Commands::Ids::Unbind, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
@@ -394,5919 +196,4211 @@ void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, En
 
 namespace ColorControl {
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchColorLoopSetCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::ColorControl::Commands::Ids::ColorLoopSet: {
-            expectArgumentCount = 7;
-            uint8_t updateFlags;
-            uint8_t action;
-            uint8_t direction;
-            uint16_t time;
-            uint16_t startHue;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[7];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 7)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(updateFlags);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(action);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(direction);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(time);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(startHue);
-                    break;
-                case 5:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 6:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 7;
+    Clusters::ColorControl::Commands::ColorLoopSet arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 7 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterColorLoopSetCallback(apCommandObj, updateFlags, action, direction, time,
-                                                                            startHue, optionsMask, optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::EnhancedMoveHue: {
-            expectArgumentCount = 4;
-            uint8_t moveMode;
-            uint16_t rate;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[4];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterColorLoopSetCallback(apCommandObj, arguments.updateFlags, arguments.action,
+                                                                    arguments.direction, arguments.time, arguments.startHue,
+                                                                    arguments.optionsMask, arguments.optionsOverride);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::ColorLoopSet,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(moveMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(rate);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchEnhancedMoveHueCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 4;
+    Clusters::ColorControl::Commands::EnhancedMoveHue arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfColorControlClusterEnhancedMoveHueCallback(apCommandObj, moveMode, rate, optionsMask, optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::EnhancedMoveToHue: {
-            expectArgumentCount = 5;
-            uint16_t enhancedHue;
-            uint8_t direction;
-            uint16_t transitionTime;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[5];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterEnhancedMoveHueCallback(apCommandObj, arguments.moveMode, arguments.rate,
+                                                                       arguments.optionsMask, arguments.optionsOverride);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::EnhancedMoveHue,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(enhancedHue);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(direction);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchEnhancedMoveToHueCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 5;
+    Clusters::ColorControl::Commands::EnhancedMoveToHue arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterEnhancedMoveToHueCallback(apCommandObj, enhancedHue, direction,
-                                                                                 transitionTime, optionsMask, optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::EnhancedMoveToHueAndSaturation: {
-            expectArgumentCount = 5;
-            uint16_t enhancedHue;
-            uint8_t saturation;
-            uint16_t transitionTime;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[5];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterEnhancedMoveToHueCallback(apCommandObj, arguments.enhancedHue, arguments.direction,
+                                                                         arguments.transitionTime, arguments.optionsMask,
+                                                                         arguments.optionsOverride);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::EnhancedMoveToHue,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(enhancedHue);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(saturation);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchEnhancedMoveToHueAndSaturationCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 5;
+    Clusters::ColorControl::Commands::EnhancedMoveToHueAndSaturation arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterEnhancedMoveToHueAndSaturationCallback(
-                    apCommandObj, enhancedHue, saturation, transitionTime, optionsMask, optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::EnhancedStepHue: {
-            expectArgumentCount = 5;
-            uint8_t stepMode;
-            uint16_t stepSize;
-            uint16_t transitionTime;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[5];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterEnhancedMoveToHueAndSaturationCallback(apCommandObj, arguments.enhancedHue,
+                                                                                      arguments.saturation,
+                                                                                      arguments.transitionTime,
+                                                                                      arguments.optionsMask,
+                                                                                      arguments.optionsOverride);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id,
+                             Clusters::ColorControl::Commands::Ids::EnhancedMoveToHueAndSaturation, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(stepMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(stepSize);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchEnhancedStepHueCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 5;
+    Clusters::ColorControl::Commands::EnhancedStepHue arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterEnhancedStepHueCallback(apCommandObj, stepMode, stepSize, transitionTime,
-                                                                               optionsMask, optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::MoveColor: {
-            expectArgumentCount = 4;
-            int16_t rateX;
-            int16_t rateY;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[4];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterEnhancedStepHueCallback(apCommandObj, arguments.stepMode, arguments.stepSize,
+                                                                       arguments.transitionTime, arguments.optionsMask,
+                                                                       arguments.optionsOverride);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::EnhancedStepHue,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(rateX);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(rateY);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchMoveColorCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 4;
+    Clusters::ColorControl::Commands::MoveColor arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterMoveColorCallback(apCommandObj, rateX, rateY, optionsMask, optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::MoveColorTemperature: {
-            expectArgumentCount = 6;
-            uint8_t moveMode;
-            uint16_t rate;
-            uint16_t colorTemperatureMinimum;
-            uint16_t colorTemperatureMaximum;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[6];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterMoveColorCallback(apCommandObj, arguments.rateX, arguments.rateY,
+                                                                 arguments.optionsMask, arguments.optionsOverride);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveColor,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 6)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(moveMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(rate);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(colorTemperatureMinimum);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(colorTemperatureMaximum);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 5:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchMoveColorTemperatureCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 6;
+    Clusters::ColorControl::Commands::MoveColorTemperature arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 6 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterMoveColorTemperatureCallback(
-                    apCommandObj, moveMode, rate, colorTemperatureMinimum, colorTemperatureMaximum, optionsMask, optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::MoveHue: {
-            expectArgumentCount = 4;
-            uint8_t moveMode;
-            uint8_t rate;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[4];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterMoveColorTemperatureCallback(apCommandObj, arguments.moveMode, arguments.rate,
+                                                                            arguments.colorTemperatureMinimum,
+                                                                            arguments.colorTemperatureMaximum,
+                                                                            arguments.optionsMask, arguments.optionsOverride);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveColorTemperature,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(moveMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(rate);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchMoveHueCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 4;
+    Clusters::ColorControl::Commands::MoveHue arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterMoveHueCallback(apCommandObj, arguments.moveMode, arguments.rate,
+                                                               arguments.optionsMask, arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveHue, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchMoveSaturationCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 4;
+    Clusters::ColorControl::Commands::MoveSaturation arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterMoveSaturationCallback(apCommandObj, arguments.moveMode, arguments.rate,
+                                                                      arguments.optionsMask, arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveSaturation,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchMoveToColorCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 5;
+    Clusters::ColorControl::Commands::MoveToColor arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterMoveToColorCallback(apCommandObj, arguments.colorX, arguments.colorY,
+                                                                   arguments.transitionTime, arguments.optionsMask,
+                                                                   arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveToColor,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchMoveToColorTemperatureCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 4;
+    Clusters::ColorControl::Commands::MoveToColorTemperature arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterMoveToColorTemperatureCallback(apCommandObj, arguments.colorTemperature,
+                                                                              arguments.transitionTime, arguments.optionsMask,
+                                                                              arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id,
+                             Clusters::ColorControl::Commands::Ids::MoveToColorTemperature, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchMoveToHueCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 5;
+    Clusters::ColorControl::Commands::MoveToHue arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterMoveToHueCallback(apCommandObj, arguments.hue, arguments.direction,
+                                                                 arguments.transitionTime, arguments.optionsMask,
+                                                                 arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveToHue,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchMoveToHueAndSaturationCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 5;
+    Clusters::ColorControl::Commands::MoveToHueAndSaturation arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterMoveToHueAndSaturationCallback(apCommandObj, arguments.hue, arguments.saturation,
+                                                                              arguments.transitionTime, arguments.optionsMask,
+                                                                              arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id,
+                             Clusters::ColorControl::Commands::Ids::MoveToHueAndSaturation, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchMoveToSaturationCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 4;
+    Clusters::ColorControl::Commands::MoveToSaturation arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterMoveToSaturationCallback(apCommandObj, arguments.saturation,
+                                                                        arguments.transitionTime, arguments.optionsMask,
+                                                                        arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveToSaturation,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchStepColorCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 5;
+    Clusters::ColorControl::Commands::StepColor arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterStepColorCallback(apCommandObj, arguments.stepX, arguments.stepY,
+                                                                 arguments.transitionTime, arguments.optionsMask,
+                                                                 arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::StepColor,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchStepColorTemperatureCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 7;
+    Clusters::ColorControl::Commands::StepColorTemperature arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterStepColorTemperatureCallback(apCommandObj, arguments.stepMode, arguments.stepSize,
+                                                                            arguments.transitionTime,
+                                                                            arguments.colorTemperatureMinimum,
+                                                                            arguments.colorTemperatureMaximum,
+                                                                            arguments.optionsMask, arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::StepColorTemperature,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchStepHueCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 5;
+    Clusters::ColorControl::Commands::StepHue arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterStepHueCallback(apCommandObj, arguments.stepMode, arguments.stepSize,
+                                                               arguments.transitionTime, arguments.optionsMask,
+                                                               arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::StepHue, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchStepSaturationCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 5;
+    Clusters::ColorControl::Commands::StepSaturation arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterStepSaturationCallback(apCommandObj, arguments.stepMode, arguments.stepSize,
+                                                                      arguments.transitionTime, arguments.optionsMask,
+                                                                      arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::StepSaturation,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchStopMoveStepCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 2;
+    Clusters::ColorControl::Commands::StopMoveStep arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfColorControlClusterStopMoveStepCallback(apCommandObj, arguments.optionsMask, arguments.optionsOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::StopMoveStep,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+} // namespace ColorControl
+
+namespace DiagnosticLogs {
+
+void DispatchRetrieveLogsRequestCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 3;
+    uint8_t intent;
+    uint8_t requestedProtocol;
+    chip::ByteSpan transferFileDesignator;
+    bool argExists[3];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
+            {
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
+            }
+            else
+            {
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
+            }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(intent);
+            break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(requestedProtocol);
+            break;
+        case 2: {
+            const uint8_t * data   = nullptr;
+            TLVUnpackError         = aDataTlv.GetDataPtr(data);
+            transferFileDesignator = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
+
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDiagnosticLogsClusterRetrieveLogsRequestCallback(apCommandObj, intent, requestedProtocol,
+                                                                             transferFileDesignator);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DiagnosticLogs::Id,
+                             Clusters::DiagnosticLogs::Commands::Ids::RetrieveLogsRequest, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+} // namespace DiagnosticLogs
+
+namespace DoorLock {
+
+void DispatchClearAllPinsCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfDoorLockClusterClearAllPinsCallback(apCommandObj);
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearAllPins, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchClearAllRfidsCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfDoorLockClusterClearAllRfidsCallback(apCommandObj);
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearAllRfids, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchClearHolidayScheduleCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 1;
+    Clusters::DoorLock::Commands::ClearHolidaySchedule arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterClearHolidayScheduleCallback(apCommandObj, arguments.scheduleId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearHolidaySchedule,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchClearPinCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 1;
+    Clusters::DoorLock::Commands::ClearPin arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterClearPinCallback(apCommandObj, arguments.userId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearPin, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchClearRfidCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 1;
+    Clusters::DoorLock::Commands::ClearRfid arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterClearRfidCallback(apCommandObj, arguments.userId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearRfid, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchClearWeekdayScheduleCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 2;
+    Clusters::DoorLock::Commands::ClearWeekdaySchedule arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterClearWeekdayScheduleCallback(apCommandObj, arguments.scheduleId, arguments.userId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearWeekdaySchedule,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchClearYeardayScheduleCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 2;
+    Clusters::DoorLock::Commands::ClearYeardaySchedule arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterClearYeardayScheduleCallback(apCommandObj, arguments.scheduleId, arguments.userId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearYeardaySchedule,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchGetHolidayScheduleCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 1;
+    Clusters::DoorLock::Commands::GetHolidaySchedule arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterGetHolidayScheduleCallback(apCommandObj, arguments.scheduleId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetHolidaySchedule,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchGetLogRecordCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 1;
+    Clusters::DoorLock::Commands::GetLogRecord arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterGetLogRecordCallback(apCommandObj, arguments.logIndex);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetLogRecord, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchGetPinCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 1;
+    Clusters::DoorLock::Commands::GetPin arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterGetPinCallback(apCommandObj, arguments.userId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetPin, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchGetRfidCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 1;
+    Clusters::DoorLock::Commands::GetRfid arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterGetRfidCallback(apCommandObj, arguments.userId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetRfid, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchGetUserTypeCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 1;
+    Clusters::DoorLock::Commands::GetUserType arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterGetUserTypeCallback(apCommandObj, arguments.userId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetUserType, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchGetWeekdayScheduleCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 2;
+    Clusters::DoorLock::Commands::GetWeekdaySchedule arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterGetWeekdayScheduleCallback(apCommandObj, arguments.scheduleId, arguments.userId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetWeekdaySchedule,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchGetYeardayScheduleCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 2;
+    Clusters::DoorLock::Commands::GetYeardaySchedule arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterGetYeardayScheduleCallback(apCommandObj, arguments.scheduleId, arguments.userId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetYeardaySchedule,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchLockDoorCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 1;
+    const uint8_t * PIN;
+    bool argExists[1];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 1)
+        {
+            if (argExists[currentDecodeTagId])
+            {
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
+            }
+            else
+            {
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
+            }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(PIN);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
+
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterLockDoorCallback(apCommandObj, const_cast<uint8_t *>(PIN));
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::LockDoor, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchSetHolidayScheduleCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 4;
+    Clusters::DoorLock::Commands::SetHolidaySchedule arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterSetHolidayScheduleCallback(apCommandObj, arguments.scheduleId, arguments.localStartTime,
+                                                                      arguments.localEndTime, arguments.operatingModeDuringHoliday);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetHolidaySchedule,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchSetPinCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 4;
+    uint16_t userId;
+    uint8_t userStatus;
+    uint8_t userType;
+    const uint8_t * pin;
+    bool argExists[4];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 4)
+        {
+            if (argExists[currentDecodeTagId])
+            {
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
+            }
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterMoveHueCallback(apCommandObj, moveMode, rate, optionsMask, optionsOverride);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(userId);
+            break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(userStatus);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(userType);
+            break;
+        case 3:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(pin);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
+
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterSetPinCallback(apCommandObj, userId, userStatus, userType, const_cast<uint8_t *>(pin));
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetPin, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchSetRfidCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 4;
+    uint16_t userId;
+    uint8_t userStatus;
+    uint8_t userType;
+    const uint8_t * id;
+    bool argExists[4];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 4)
+        {
+            if (argExists[currentDecodeTagId])
+            {
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
+            }
+            else
+            {
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
+            }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(userId);
+            break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(userStatus);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(userType);
+            break;
+        case 3:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(id);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::ColorControl::Commands::Ids::MoveSaturation: {
-            expectArgumentCount = 4;
-            uint8_t moveMode;
-            uint8_t rate;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[4];
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
+
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterSetRfidCallback(apCommandObj, userId, userStatus, userType, const_cast<uint8_t *>(id));
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetRfid, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchSetUserTypeCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 2;
+    Clusters::DoorLock::Commands::SetUserType arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterSetUserTypeCallback(apCommandObj, arguments.userId, arguments.userType);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetUserType, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchSetWeekdayScheduleCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 7;
+    Clusters::DoorLock::Commands::SetWeekdaySchedule arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterSetWeekdayScheduleCallback(apCommandObj, arguments.scheduleId, arguments.userId,
+                                                                      arguments.daysMask, arguments.startHour,
+                                                                      arguments.startMinute, arguments.endHour,
+                                                                      arguments.endMinute);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetWeekdaySchedule,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchSetYeardayScheduleCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 4;
+    Clusters::DoorLock::Commands::SetYeardaySchedule arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterSetYeardayScheduleCallback(apCommandObj, arguments.scheduleId, arguments.userId,
+                                                                      arguments.localStartTime, arguments.localEndTime);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetYeardaySchedule,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchUnlockDoorCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 1;
+    const uint8_t * PIN;
+    bool argExists[1];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(moveMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(rate);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 1)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfColorControlClusterMoveSaturationCallback(apCommandObj, moveMode, rate, optionsMask, optionsOverride);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(PIN);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::ColorControl::Commands::Ids::MoveToColor: {
-            expectArgumentCount = 5;
-            uint16_t colorX;
-            uint16_t colorY;
-            uint16_t transitionTime;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[5];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(colorX);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(colorY);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterUnlockDoorCallback(apCommandObj, const_cast<uint8_t *>(PIN));
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::UnlockDoor, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterMoveToColorCallback(apCommandObj, colorX, colorY, transitionTime,
-                                                                           optionsMask, optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::MoveToColorTemperature: {
-            expectArgumentCount = 4;
-            uint16_t colorTemperature;
-            uint16_t transitionTime;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[4];
+void DispatchUnlockWithTimeoutCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 2;
+    uint16_t timeoutInSeconds;
+    const uint8_t * pin;
+    bool argExists[2];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(colorTemperature);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 2)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterMoveToColorTemperatureCallback(apCommandObj, colorTemperature,
-                                                                                      transitionTime, optionsMask, optionsOverride);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(timeoutInSeconds);
+            break;
+        case 1:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(pin);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::ColorControl::Commands::Ids::MoveToHue: {
-            expectArgumentCount = 5;
-            uint8_t hue;
-            uint8_t direction;
-            uint16_t transitionTime;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[5];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(hue);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(direction);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDoorLockClusterUnlockWithTimeoutCallback(apCommandObj, timeoutInSeconds, const_cast<uint8_t *>(pin));
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::UnlockWithTimeout,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterMoveToHueCallback(apCommandObj, hue, direction, transitionTime, optionsMask,
-                                                                         optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::MoveToHueAndSaturation: {
-            expectArgumentCount = 5;
-            uint8_t hue;
-            uint8_t saturation;
-            uint16_t transitionTime;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[5];
+} // namespace DoorLock
 
-            memset(argExists, 0, sizeof argExists);
+namespace GeneralCommissioning {
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(hue);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(saturation);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchArmFailSafeCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 3;
+    Clusters::GeneralCommissioning::Commands::ArmFailSafe arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterMoveToHueAndSaturationCallback(apCommandObj, hue, saturation, transitionTime,
-                                                                                      optionsMask, optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::MoveToSaturation: {
-            expectArgumentCount = 4;
-            uint8_t saturation;
-            uint16_t transitionTime;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[4];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfGeneralCommissioningClusterArmFailSafeCallback(apCommandObj, arguments.expiryLengthSeconds,
+                                                                           arguments.breadcrumb, arguments.timeoutMs);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::GeneralCommissioning::Id,
+                             Clusters::GeneralCommissioning::Commands::Ids::ArmFailSafe, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(saturation);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchCommissioningCompleteCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfGeneralCommissioningClusterCommissioningCompleteCallback(apCommandObj);
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterMoveToSaturationCallback(apCommandObj, saturation, transitionTime,
-                                                                                optionsMask, optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::StepColor: {
-            expectArgumentCount = 5;
-            int16_t stepX;
-            int16_t stepY;
-            uint16_t transitionTime;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[5];
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::GeneralCommissioning::Id,
+                             Clusters::GeneralCommissioning::Commands::Ids::CommissioningComplete, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchSetRegulatoryConfigCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 4;
+    uint8_t location;
+    const uint8_t * countryCode;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[4];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(stepX);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(stepY);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 4)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterStepColorCallback(apCommandObj, stepX, stepY, transitionTime, optionsMask,
-                                                                         optionsOverride);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(location);
+            break;
+        case 1:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(countryCode);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 3:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::ColorControl::Commands::Ids::StepColorTemperature: {
-            expectArgumentCount = 7;
-            uint8_t stepMode;
-            uint16_t stepSize;
-            uint16_t transitionTime;
-            uint16_t colorTemperatureMinimum;
-            uint16_t colorTemperatureMaximum;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[7];
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 7)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(stepMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(stepSize);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(colorTemperatureMinimum);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(colorTemperatureMaximum);
-                    break;
-                case 5:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 6:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfGeneralCommissioningClusterSetRegulatoryConfigCallback(apCommandObj, location,
+                                                                                   const_cast<uint8_t *>(countryCode), breadcrumb,
+                                                                                   timeoutMs);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::GeneralCommissioning::Id,
+                             Clusters::GeneralCommissioning::Commands::Ids::SetRegulatoryConfig, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 7 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterStepColorTemperatureCallback(
-                    apCommandObj, stepMode, stepSize, transitionTime, colorTemperatureMinimum, colorTemperatureMaximum, optionsMask,
-                    optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::StepHue: {
-            expectArgumentCount = 5;
-            uint8_t stepMode;
-            uint8_t stepSize;
-            uint8_t transitionTime;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[5];
+} // namespace GeneralCommissioning
 
-            memset(argExists, 0, sizeof argExists);
+namespace Groups {
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(stepMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(stepSize);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchAddGroupCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 2;
+    uint16_t groupId;
+    const uint8_t * groupName;
+    bool argExists[2];
+
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 2)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterStepHueCallback(apCommandObj, stepMode, stepSize, transitionTime,
-                                                                       optionsMask, optionsOverride);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(groupId);
+            break;
+        case 1:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(groupName);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::ColorControl::Commands::Ids::StepSaturation: {
-            expectArgumentCount = 5;
-            uint8_t stepMode;
-            uint8_t stepSize;
-            uint8_t transitionTime;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[5];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(stepMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(stepSize);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfGroupsClusterAddGroupCallback(apCommandObj, groupId, const_cast<uint8_t *>(groupName));
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Groups::Id, Clusters::Groups::Commands::Ids::AddGroup, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterStepSaturationCallback(apCommandObj, stepMode, stepSize, transitionTime,
-                                                                              optionsMask, optionsOverride);
-            }
-            break;
-        }
-        case Clusters::ColorControl::Commands::Ids::StopMoveStep: {
-            expectArgumentCount = 2;
-            uint8_t optionsMask;
-            uint8_t optionsOverride;
-            bool argExists[2];
+void DispatchAddGroupIfIdentifyingCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 2;
+    uint16_t groupId;
+    const uint8_t * groupName;
+    bool argExists[2];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(optionsMask);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(optionsOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 2)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfColorControlClusterStopMoveStepCallback(apCommandObj, optionsMask, optionsOverride);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::ColorControl::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::ColorControl::Id);
-            return;
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(groupId);
+            break;
+        case 1:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(groupName);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
-    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    if (CHIP_END_OF_TLV == TLVError)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::ColorControl::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
     }
-}
 
-} // namespace ColorControl
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfGroupsClusterAddGroupIfIdentifyingCallback(apCommandObj, groupId, const_cast<uint8_t *>(groupName));
+    }
 
-namespace DiagnosticLogs {
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Groups::Id, Clusters::Groups::Commands::Ids::AddGroupIfIdentifying,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchGetGroupMembershipCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::DiagnosticLogs::Commands::Ids::RetrieveLogsRequest: {
-            expectArgumentCount = 3;
-            uint8_t intent;
-            uint8_t requestedProtocol;
-            chip::ByteSpan transferFileDesignator;
-            bool argExists[3];
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 2;
+    uint8_t groupCount;
+    /* TYPE WARNING: array array defaults to */ uint8_t * groupList;
+    bool argExists[2];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(intent);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(requestedProtocol);
-                    break;
-                case 2: {
-                    const uint8_t * data   = nullptr;
-                    TLVUnpackError         = aDataTlv.GetDataPtr(data);
-                    transferFileDesignator = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 2)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDiagnosticLogsClusterRetrieveLogsRequestCallback(apCommandObj, intent, requestedProtocol,
-                                                                                     transferFileDesignator);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::DiagnosticLogs::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::DiagnosticLogs::Id);
-            return;
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(groupCount);
+            break;
+        case 1:
+            // Just for compatibility, we will add array type support in IM later.
+            TLVUnpackError = aDataTlv.GetDataPtr(const_cast<const uint8_t *&>(groupList));
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
-    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    if (CHIP_END_OF_TLV == TLVError)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::DiagnosticLogs::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
     }
-}
 
-} // namespace DiagnosticLogs
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfGroupsClusterGetGroupMembershipCallback(apCommandObj, groupCount, groupList);
+    }
 
-namespace DoorLock {
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Groups::Id, Clusters::Groups::Commands::Ids::GetGroupMembership, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchRemoveAllGroupsCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::DoorLock::Commands::Ids::ClearAllPins: {
-
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfDoorLockClusterClearAllPinsCallback(apCommandObj);
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::ClearAllRfids: {
-
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfDoorLockClusterClearAllRfidsCallback(apCommandObj);
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::ClearHolidaySchedule: {
-            expectArgumentCount = 1;
-            uint8_t scheduleId;
-            bool argExists[1];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(scheduleId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterClearHolidayScheduleCallback(apCommandObj, scheduleId);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::ClearPin: {
-            expectArgumentCount = 1;
-            uint16_t userId;
-            bool argExists[1];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfGroupsClusterRemoveAllGroupsCallback(apCommandObj);
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterClearPinCallback(apCommandObj, userId);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::ClearRfid: {
-            expectArgumentCount = 1;
-            uint16_t userId;
-            bool argExists[1];
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Groups::Id, Clusters::Groups::Commands::Ids::RemoveAllGroups, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            memset(argExists, 0, sizeof argExists);
+void DispatchRemoveGroupCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    expectArgumentCount = 1;
+    Clusters::Groups::Commands::RemoveGroup arguments;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfGroupsClusterRemoveGroupCallback(apCommandObj, arguments.groupId);
+    }
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterClearRfidCallback(apCommandObj, userId);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::ClearWeekdaySchedule: {
-            expectArgumentCount = 2;
-            uint8_t scheduleId;
-            uint16_t userId;
-            bool argExists[2];
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Groups::Id, Clusters::Groups::Commands::Ids::RemoveGroup, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            memset(argExists, 0, sizeof argExists);
+void DispatchViewGroupCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(scheduleId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    expectArgumentCount = 1;
+    Clusters::Groups::Commands::ViewGroup arguments;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfGroupsClusterViewGroupCallback(apCommandObj, arguments.groupId);
+    }
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterClearWeekdayScheduleCallback(apCommandObj, scheduleId, userId);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::ClearYeardaySchedule: {
-            expectArgumentCount = 2;
-            uint8_t scheduleId;
-            uint16_t userId;
-            bool argExists[2];
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Groups::Id, Clusters::Groups::Commands::Ids::ViewGroup, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            memset(argExists, 0, sizeof argExists);
+} // namespace Groups
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(scheduleId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+namespace IasZone {
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+void DispatchZoneEnrollResponseCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterClearYeardayScheduleCallback(apCommandObj, scheduleId, userId);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::GetHolidaySchedule: {
-            expectArgumentCount = 1;
-            uint8_t scheduleId;
-            bool argExists[1];
+    expectArgumentCount = 2;
+    Clusters::IasZone::Commands::ZoneEnrollResponse arguments;
 
-            memset(argExists, 0, sizeof argExists);
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfIasZoneClusterZoneEnrollResponseCallback(apCommandObj, arguments.enrollResponseCode, arguments.zoneId);
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(scheduleId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::IasZone::Id, Clusters::IasZone::Commands::Ids::ZoneEnrollResponse, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+} // namespace IasZone
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterGetHolidayScheduleCallback(apCommandObj, scheduleId);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::GetLogRecord: {
-            expectArgumentCount = 1;
-            uint16_t logIndex;
-            bool argExists[1];
+namespace Identify {
 
-            memset(argExists, 0, sizeof argExists);
+void DispatchIdentifyCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(logIndex);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    expectArgumentCount = 1;
+    Clusters::Identify::Commands::Identify arguments;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfIdentifyClusterIdentifyCallback(apCommandObj, arguments.identifyTime);
+    }
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterGetLogRecordCallback(apCommandObj, logIndex);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::GetPin: {
-            expectArgumentCount = 1;
-            uint16_t userId;
-            bool argExists[1];
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Identify::Id, Clusters::Identify::Commands::Ids::Identify, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            memset(argExists, 0, sizeof argExists);
+void DispatchIdentifyQueryCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfIdentifyClusterIdentifyQueryCallback(apCommandObj);
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Identify::Id, Clusters::Identify::Commands::Ids::IdentifyQuery, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterGetPinCallback(apCommandObj, userId);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::GetRfid: {
-            expectArgumentCount = 1;
-            uint16_t userId;
-            bool argExists[1];
+} // namespace Identify
 
-            memset(argExists, 0, sizeof argExists);
+namespace LevelControl {
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchMoveCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 4;
+    Clusters::LevelControl::Commands::Move arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterGetRfidCallback(apCommandObj, userId);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::GetUserType: {
-            expectArgumentCount = 1;
-            uint16_t userId;
-            bool argExists[1];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterMoveCallback(apCommandObj, arguments.moveMode, arguments.rate, arguments.optionMask,
+                                                            arguments.optionOverride);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Move, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchMoveToLevelCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 4;
+    Clusters::LevelControl::Commands::MoveToLevel arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterGetUserTypeCallback(apCommandObj, userId);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::GetWeekdaySchedule: {
-            expectArgumentCount = 2;
-            uint8_t scheduleId;
-            uint16_t userId;
-            bool argExists[2];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterMoveToLevelCallback(apCommandObj, arguments.level, arguments.transitionTime,
+                                                                   arguments.optionMask, arguments.optionOverride);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveToLevel,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(scheduleId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchMoveToLevelWithOnOffCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 2;
+    Clusters::LevelControl::Commands::MoveToLevelWithOnOff arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterGetWeekdayScheduleCallback(apCommandObj, scheduleId, userId);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::GetYeardaySchedule: {
-            expectArgumentCount = 2;
-            uint8_t scheduleId;
-            uint16_t userId;
-            bool argExists[2];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterMoveToLevelWithOnOffCallback(apCommandObj, arguments.level,
+                                                                            arguments.transitionTime);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveToLevelWithOnOff,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(scheduleId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchMoveWithOnOffCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 2;
+    Clusters::LevelControl::Commands::MoveWithOnOff arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterGetYeardayScheduleCallback(apCommandObj, scheduleId, userId);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::LockDoor: {
-            expectArgumentCount = 1;
-            const uint8_t * PIN;
-            bool argExists[1];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterMoveWithOnOffCallback(apCommandObj, arguments.moveMode, arguments.rate);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveWithOnOff,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(PIN);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchStepCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 5;
+    Clusters::LevelControl::Commands::Step arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterLockDoorCallback(apCommandObj, const_cast<uint8_t *>(PIN));
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::SetHolidaySchedule: {
-            expectArgumentCount = 4;
-            uint8_t scheduleId;
-            uint32_t localStartTime;
-            uint32_t localEndTime;
-            uint8_t operatingModeDuringHoliday;
-            bool argExists[4];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterStepCallback(apCommandObj, arguments.stepMode, arguments.stepSize,
+                                                            arguments.transitionTime, arguments.optionMask,
+                                                            arguments.optionOverride);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Step, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(scheduleId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(localStartTime);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(localEndTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(operatingModeDuringHoliday);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchStepWithOnOffCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 3;
+    Clusters::LevelControl::Commands::StepWithOnOff arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterSetHolidayScheduleCallback(apCommandObj, scheduleId, localStartTime,
-                                                                              localEndTime, operatingModeDuringHoliday);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::SetPin: {
-            expectArgumentCount = 4;
-            uint16_t userId;
-            uint8_t userStatus;
-            uint8_t userType;
-            const uint8_t * pin;
-            bool argExists[4];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterStepWithOnOffCallback(apCommandObj, arguments.stepMode, arguments.stepSize,
+                                                                     arguments.transitionTime);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::StepWithOnOff,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(userStatus);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(userType);
-                    break;
-                case 3:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(pin);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchStopCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    expectArgumentCount = 2;
+    Clusters::LevelControl::Commands::Stop arguments;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfDoorLockClusterSetPinCallback(apCommandObj, userId, userStatus, userType, const_cast<uint8_t *>(pin));
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::SetRfid: {
-            expectArgumentCount = 4;
-            uint16_t userId;
-            uint8_t userStatus;
-            uint8_t userType;
-            const uint8_t * id;
-            bool argExists[4];
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterStopCallback(apCommandObj, arguments.optionMask, arguments.optionOverride);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Stop, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(userStatus);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(userType);
-                    break;
-                case 3:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(id);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchStopWithOnOffCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfLevelControlClusterStopWithOnOffCallback(apCommandObj);
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfDoorLockClusterSetRfidCallback(apCommandObj, userId, userStatus, userType, const_cast<uint8_t *>(id));
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::SetUserType: {
-            expectArgumentCount = 2;
-            uint16_t userId;
-            uint8_t userType;
-            bool argExists[2];
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::StopWithOnOff,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            memset(argExists, 0, sizeof argExists);
+} // namespace LevelControl
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(userType);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+namespace LowPower {
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+void DispatchSleepCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterSetUserTypeCallback(apCommandObj, userId, userType);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::SetWeekdaySchedule: {
-            expectArgumentCount = 7;
-            uint8_t scheduleId;
-            uint16_t userId;
-            uint8_t daysMask;
-            uint8_t startHour;
-            uint8_t startMinute;
-            uint8_t endHour;
-            uint8_t endMinute;
-            bool argExists[7];
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfLowPowerClusterSleepCallback(apCommandObj);
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LowPower::Id, Clusters::LowPower::Commands::Ids::Sleep, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 7)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(scheduleId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(daysMask);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(startHour);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(startMinute);
-                    break;
-                case 5:
-                    TLVUnpackError = aDataTlv.Get(endHour);
-                    break;
-                case 6:
-                    TLVUnpackError = aDataTlv.Get(endMinute);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+} // namespace LowPower
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+namespace NetworkCommissioning {
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 7 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterSetWeekdayScheduleCallback(apCommandObj, scheduleId, userId, daysMask, startHour,
-                                                                              startMinute, endHour, endMinute);
-            }
-            break;
-        }
-        case Clusters::DoorLock::Commands::Ids::SetYeardaySchedule: {
-            expectArgumentCount = 4;
-            uint8_t scheduleId;
-            uint16_t userId;
-            uint32_t localStartTime;
-            uint32_t localEndTime;
-            bool argExists[4];
+void DispatchAddThreadNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 3;
+    chip::ByteSpan operationalDataset;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[3];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(scheduleId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(userId);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(localStartTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(localEndTime);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterSetYeardayScheduleCallback(apCommandObj, scheduleId, userId, localStartTime,
-                                                                              localEndTime);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::DoorLock::Commands::Ids::UnlockDoor: {
-            expectArgumentCount = 1;
-            const uint8_t * PIN;
-            bool argExists[1];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(PIN);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDoorLockClusterUnlockDoorCallback(apCommandObj, const_cast<uint8_t *>(PIN));
-            }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::DoorLock::Commands::Ids::UnlockWithTimeout: {
-            expectArgumentCount = 2;
-            uint16_t timeoutInSeconds;
-            const uint8_t * pin;
-            bool argExists[2];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(timeoutInSeconds);
-                    break;
-                case 1:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(pin);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfDoorLockClusterUnlockWithTimeoutCallback(apCommandObj, timeoutInSeconds, const_cast<uint8_t *>(pin));
-            }
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::DoorLock::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::DoorLock::Id);
-            return;
-        }
-        }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterAddThreadNetworkCallback(apCommandObj, operationalDataset, breadcrumb,
+                                                                                timeoutMs);
     }
 
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::DoorLock::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::AddThreadNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
-} // namespace DoorLock
-
-namespace GeneralCommissioning {
-
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchAddWiFiNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::GeneralCommissioning::Commands::Ids::ArmFailSafe: {
-            expectArgumentCount = 3;
-            uint16_t expiryLengthSeconds;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 4;
+    chip::ByteSpan ssid;
+    chip::ByteSpan credentials;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[4];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(expiryLengthSeconds);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 4)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfGeneralCommissioningClusterArmFailSafeCallback(apCommandObj, expiryLengthSeconds, breadcrumb, timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        case Clusters::GeneralCommissioning::Commands::Ids::CommissioningComplete: {
-
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfGeneralCommissioningClusterCommissioningCompleteCallback(apCommandObj);
-            break;
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
         }
-        case Clusters::GeneralCommissioning::Commands::Ids::SetRegulatoryConfig: {
-            expectArgumentCount = 4;
-            uint8_t location;
-            const uint8_t * countryCode;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[4];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(location);
-                    break;
-                case 1:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(countryCode);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfGeneralCommissioningClusterSetRegulatoryConfigCallback(
-                    apCommandObj, location, const_cast<uint8_t *>(countryCode), breadcrumb, timeoutMs);
-            }
-            break;
+        break;
+        case 1: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::GeneralCommissioning::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::GeneralCommissioning::Id);
-            return;
+        break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 3:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
-    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    if (CHIP_END_OF_TLV == TLVError)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::GeneralCommissioning::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
     }
-}
 
-} // namespace GeneralCommissioning
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterAddWiFiNetworkCallback(apCommandObj, ssid, credentials, breadcrumb,
+                                                                              timeoutMs);
+    }
 
-namespace Groups {
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::AddWiFiNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchDisableNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::Groups::Commands::Ids::AddGroup: {
-            expectArgumentCount = 2;
-            uint16_t groupId;
-            const uint8_t * groupName;
-            bool argExists[2];
 
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                case 1:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(groupName);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    expectArgumentCount = 3;
+    chip::ByteSpan networkID;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[3];
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfGroupsClusterAddGroupCallback(apCommandObj, groupId, const_cast<uint8_t *>(groupName));
-            }
-            break;
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
         }
-        case Clusters::Groups::Commands::Ids::AddGroupIfIdentifying: {
-            expectArgumentCount = 2;
-            uint16_t groupId;
-            const uint8_t * groupName;
-            bool argExists[2];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                case 1:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(groupName);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfGroupsClusterAddGroupIfIdentifyingCallback(apCommandObj, groupId, const_cast<uint8_t *>(groupName));
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        case Clusters::Groups::Commands::Ids::GetGroupMembership: {
-            expectArgumentCount = 2;
-            uint8_t groupCount;
-            /* TYPE WARNING: array array defaults to */ uint8_t * groupList;
-            bool argExists[2];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupCount);
-                    break;
-                case 1:
-                    // Just for compatibility, we will add array type support in IM later.
-                    TLVUnpackError = aDataTlv.GetDataPtr(const_cast<const uint8_t *&>(groupList));
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfGroupsClusterGetGroupMembershipCallback(apCommandObj, groupCount, groupList);
-            }
-            break;
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
         }
-        case Clusters::Groups::Commands::Ids::RemoveAllGroups: {
-
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfGroupsClusterRemoveAllGroupsCallback(apCommandObj);
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::Groups::Commands::Ids::RemoveGroup: {
-            expectArgumentCount = 1;
-            uint16_t groupId;
-            bool argExists[1];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfGroupsClusterRemoveGroupCallback(apCommandObj, groupId);
-            }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::Groups::Commands::Ids::ViewGroup: {
-            expectArgumentCount = 1;
-            uint16_t groupId;
-            bool argExists[1];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfGroupsClusterViewGroupCallback(apCommandObj, groupId);
-            }
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::Groups::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::Groups::Id);
-            return;
-        }
-        }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterDisableNetworkCallback(apCommandObj, networkID, breadcrumb, timeoutMs);
     }
 
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::Groups::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::DisableNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
-} // namespace Groups
-
-namespace IasZone {
-
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchEnableNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::IasZone::Commands::Ids::ZoneEnrollResponse: {
-            expectArgumentCount = 2;
-            uint8_t enrollResponseCode;
-            uint8_t zoneId;
-            bool argExists[2];
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 3;
+    chip::ByteSpan networkID;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[3];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(enrollResponseCode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(zoneId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfIasZoneClusterZoneEnrollResponseCallback(apCommandObj, enrollResponseCode, zoneId);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::IasZone::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::IasZone::Id);
-            return;
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
-    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    if (CHIP_END_OF_TLV == TLVError)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::IasZone::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
     }
-}
 
-} // namespace IasZone
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterEnableNetworkCallback(apCommandObj, networkID, breadcrumb, timeoutMs);
+    }
 
-namespace Identify {
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::EnableNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchGetLastNetworkCommissioningResultCommand(app::Command * apCommandObj, EndpointId aEndpointId,
+                                                      TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::Identify::Commands::Ids::Identify: {
-            expectArgumentCount = 1;
-            uint16_t identifyTime;
-            bool argExists[1];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(identifyTime);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfIdentifyClusterIdentifyCallback(apCommandObj, identifyTime);
-            }
-            break;
-        }
-        case Clusters::Identify::Commands::Ids::IdentifyQuery: {
+    expectArgumentCount = 1;
+    Clusters::NetworkCommissioning::Commands::GetLastNetworkCommissioningResult arguments;
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfIdentifyClusterIdentifyQueryCallback(apCommandObj);
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::Identify::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::Identify::Id);
-            return;
-        }
-        }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterGetLastNetworkCommissioningResultCallback(apCommandObj, arguments.timeoutMs);
     }
 
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::Identify::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::GetLastNetworkCommissioningResult, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
-} // namespace Identify
-
-namespace LevelControl {
-
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchRemoveNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::LevelControl::Commands::Ids::Move: {
-            expectArgumentCount = 4;
-            uint8_t moveMode;
-            uint8_t rate;
-            uint8_t optionMask;
-            uint8_t optionOverride;
-            bool argExists[4];
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 3;
+    chip::ByteSpan NetworkID;
+    uint64_t Breadcrumb;
+    uint32_t TimeoutMs;
+    bool argExists[3];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(moveMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(rate);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(optionMask);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterMoveCallback(apCommandObj, moveMode, rate, optionMask, optionOverride);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            NetworkID            = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(Breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(TimeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::LevelControl::Commands::Ids::MoveToLevel: {
-            expectArgumentCount = 4;
-            uint8_t level;
-            uint16_t transitionTime;
-            uint8_t optionMask;
-            uint8_t optionOverride;
-            bool argExists[4];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(level);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(optionMask);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfLevelControlClusterMoveToLevelCallback(apCommandObj, level, transitionTime, optionMask, optionOverride);
-            }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::LevelControl::Commands::Ids::MoveToLevelWithOnOff: {
-            expectArgumentCount = 2;
-            uint8_t level;
-            uint16_t transitionTime;
-            bool argExists[2];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(level);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterRemoveNetworkCallback(apCommandObj, NetworkID, Breadcrumb, TimeoutMs);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::RemoveNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterMoveToLevelWithOnOffCallback(apCommandObj, level, transitionTime);
-            }
-            break;
-        }
-        case Clusters::LevelControl::Commands::Ids::MoveWithOnOff: {
-            expectArgumentCount = 2;
-            uint8_t moveMode;
-            uint8_t rate;
-            bool argExists[2];
+void DispatchScanNetworksCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 3;
+    chip::ByteSpan ssid;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[3];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(moveMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(rate);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterMoveWithOnOffCallback(apCommandObj, moveMode, rate);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::LevelControl::Commands::Ids::Step: {
-            expectArgumentCount = 5;
-            uint8_t stepMode;
-            uint8_t stepSize;
-            uint16_t transitionTime;
-            uint8_t optionMask;
-            uint8_t optionOverride;
-            bool argExists[5];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(stepMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(stepSize);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionMask);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterStepCallback(apCommandObj, stepMode, stepSize, transitionTime, optionMask,
-                                                                    optionOverride);
-            }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::LevelControl::Commands::Ids::StepWithOnOff: {
-            expectArgumentCount = 3;
-            uint8_t stepMode;
-            uint8_t stepSize;
-            uint16_t transitionTime;
-            bool argExists[3];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(stepMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(stepSize);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterScanNetworksCallback(apCommandObj, ssid, breadcrumb, timeoutMs);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::ScanNetworks, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterStepWithOnOffCallback(apCommandObj, stepMode, stepSize, transitionTime);
-            }
-            break;
-        }
-        case Clusters::LevelControl::Commands::Ids::Stop: {
-            expectArgumentCount = 2;
-            uint8_t optionMask;
-            uint8_t optionOverride;
-            bool argExists[2];
+void DispatchUpdateThreadNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 3;
+    chip::ByteSpan operationalDataset;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[3];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(optionMask);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(optionOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterStopCallback(apCommandObj, optionMask, optionOverride);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
             break;
-        }
-        case Clusters::LevelControl::Commands::Ids::StopWithOnOff: {
-
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfLevelControlClusterStopWithOnOffCallback(apCommandObj);
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::LevelControl::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::LevelControl::Id);
-            return;
-        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
-    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    if (CHIP_END_OF_TLV == TLVError)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::LevelControl::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
     }
-}
 
-} // namespace LevelControl
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterUpdateThreadNetworkCallback(apCommandObj, operationalDataset, breadcrumb,
+                                                                                   timeoutMs);
+    }
 
-namespace LowPower {
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::UpdateThreadNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchUpdateWiFiNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
+
+    expectArgumentCount = 4;
+    chip::ByteSpan ssid;
+    chip::ByteSpan credentials;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[4];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
     {
-        switch (aCommandId)
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
         {
-        case Clusters::LowPower::Commands::Ids::Sleep: {
-
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfLowPowerClusterSleepCallback(apCommandObj);
-            break;
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 4)
+        {
+            if (argExists[currentDecodeTagId])
+            {
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
+            }
+            else
+            {
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
+            }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::LowPower::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::LowPower::Id);
-            return;
+        break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 3:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterUpdateWiFiNetworkCallback(apCommandObj, ssid, credentials, breadcrumb,
+                                                                                 timeoutMs);
+    }
+
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::LowPower::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::UpdateWiFiNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
-} // namespace LowPower
+} // namespace NetworkCommissioning
 
-namespace NetworkCommissioning {
+namespace OtaSoftwareUpdateProvider {
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchApplyUpdateRequestCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::NetworkCommissioning::Commands::Ids::AddThreadNetwork: {
-            expectArgumentCount = 3;
-            chip::ByteSpan operationalDataset;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 2;
+    chip::ByteSpan updateToken;
+    uint32_t newVersion;
+    bool argExists[2];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 2)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterAddThreadNetworkCallback(apCommandObj, operationalDataset,
-                                                                                        breadcrumb, timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            updateToken          = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(newVersion);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::NetworkCommissioning::Commands::Ids::AddWiFiNetwork: {
-            expectArgumentCount = 4;
-            chip::ByteSpan ssid;
-            chip::ByteSpan credentials;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[4];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOtaSoftwareUpdateProviderClusterApplyUpdateRequestCallback(apCommandObj, updateToken, newVersion);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OtaSoftwareUpdateProvider::Id,
+                             Clusters::OtaSoftwareUpdateProvider::Commands::Ids::ApplyUpdateRequest, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterAddWiFiNetworkCallback(apCommandObj, ssid, credentials, breadcrumb,
-                                                                                      timeoutMs);
-            }
-            break;
-        }
-        case Clusters::NetworkCommissioning::Commands::Ids::DisableNetwork: {
-            expectArgumentCount = 3;
-            chip::ByteSpan networkID;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
+void DispatchNotifyUpdateAppliedCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 2;
+    chip::ByteSpan updateToken;
+    uint32_t currentVersion;
+    bool argExists[2];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 2)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfNetworkCommissioningClusterDisableNetworkCallback(apCommandObj, networkID, breadcrumb, timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            updateToken          = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(currentVersion);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::NetworkCommissioning::Commands::Ids::EnableNetwork: {
-            expectArgumentCount = 3;
-            chip::ByteSpan networkID;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOtaSoftwareUpdateProviderClusterNotifyUpdateAppliedCallback(apCommandObj, updateToken, currentVersion);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OtaSoftwareUpdateProvider::Id,
+                             Clusters::OtaSoftwareUpdateProvider::Commands::Ids::NotifyUpdateApplied, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchQueryImageCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
+    expectArgumentCount = 9;
+    uint16_t vendorId;
+    uint16_t productId;
+    uint16_t imageType;
+    uint16_t hardwareVersion;
+    uint32_t currentVersion;
+    /* TYPE WARNING: array array defaults to */ uint8_t * protocolsSupported;
+    const uint8_t * location;
+    uint8_t requestorCanConsent;
+    chip::ByteSpan metadataForProvider;
+    bool argExists[9];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 9)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfNetworkCommissioningClusterEnableNetworkCallback(apCommandObj, networkID, breadcrumb, timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(vendorId);
+            break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(productId);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(imageType);
+            break;
+        case 3:
+            TLVUnpackError = aDataTlv.Get(hardwareVersion);
+            break;
+        case 4:
+            TLVUnpackError = aDataTlv.Get(currentVersion);
+            break;
+        case 5:
+            // Just for compatibility, we will add array type support in IM later.
+            TLVUnpackError = aDataTlv.GetDataPtr(const_cast<const uint8_t *&>(protocolsSupported));
+            break;
+        case 6:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(location);
+            break;
+        case 7:
+            TLVUnpackError = aDataTlv.Get(requestorCanConsent);
+            break;
+        case 8: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            metadataForProvider  = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::NetworkCommissioning::Commands::Ids::GetLastNetworkCommissioningResult: {
-            expectArgumentCount = 1;
-            uint32_t timeoutMs;
-            bool argExists[1];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 9 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOtaSoftwareUpdateProviderClusterQueryImageCallback(apCommandObj, vendorId, productId, imageType,
+                                                                               hardwareVersion, currentVersion, protocolsSupported,
+                                                                               const_cast<uint8_t *>(location), requestorCanConsent,
+                                                                               metadataForProvider);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OtaSoftwareUpdateProvider::Id,
+                             Clusters::OtaSoftwareUpdateProvider::Commands::Ids::QueryImage, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterGetLastNetworkCommissioningResultCallback(apCommandObj, timeoutMs);
-            }
-            break;
-        }
-        case Clusters::NetworkCommissioning::Commands::Ids::RemoveNetwork: {
-            expectArgumentCount = 3;
-            chip::ByteSpan NetworkID;
-            uint64_t Breadcrumb;
-            uint32_t TimeoutMs;
-            bool argExists[3];
+} // namespace OtaSoftwareUpdateProvider
 
-            memset(argExists, 0, sizeof argExists);
+namespace OnOff {
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NetworkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(Breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(TimeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchOffCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfOnOffClusterOffCallback(apCommandObj);
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfNetworkCommissioningClusterRemoveNetworkCallback(apCommandObj, NetworkID, Breadcrumb, TimeoutMs);
-            }
-            break;
-        }
-        case Clusters::NetworkCommissioning::Commands::Ids::ScanNetworks: {
-            expectArgumentCount = 3;
-            chip::ByteSpan ssid;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::Off, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            memset(argExists, 0, sizeof argExists);
+void DispatchOnCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfOnOffClusterOnCallback(apCommandObj);
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::On, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterScanNetworksCallback(apCommandObj, ssid, breadcrumb, timeoutMs);
-            }
-            break;
-        }
-        case Clusters::NetworkCommissioning::Commands::Ids::UpdateThreadNetwork: {
-            expectArgumentCount = 3;
-            chip::ByteSpan operationalDataset;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
+void DispatchToggleCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfOnOffClusterToggleCallback(apCommandObj);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::Toggle, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+} // namespace OnOff
+
+namespace OperationalCredentials {
+
+void DispatchAddOpCertCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterUpdateThreadNetworkCallback(apCommandObj, operationalDataset,
-                                                                                           breadcrumb, timeoutMs);
-            }
-            break;
-        }
-        case Clusters::NetworkCommissioning::Commands::Ids::UpdateWiFiNetwork: {
-            expectArgumentCount = 4;
-            chip::ByteSpan ssid;
-            chip::ByteSpan credentials;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[4];
+    expectArgumentCount = 4;
+    chip::ByteSpan NOCArray;
+    chip::ByteSpan IPKValue;
+    chip::NodeId CaseAdminNode;
+    uint16_t AdminVendorId;
+    bool argExists[4];
 
-            memset(argExists, 0, sizeof argExists);
+    memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 4)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
                 break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
             }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterUpdateWiFiNetworkCallback(apCommandObj, ssid, credentials,
-                                                                                         breadcrumb, timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::NetworkCommissioning::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::NetworkCommissioning::Id);
-            return;
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            NOCArray             = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            IPKValue             = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(CaseAdminNode);
+            break;
+        case 3:
+            TLVUnpackError = aDataTlv.Get(AdminVendorId);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
-    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    if (CHIP_END_OF_TLV == TLVError)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::NetworkCommissioning::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
     }
-}
 
-} // namespace NetworkCommissioning
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterAddOpCertCallback(apCommandObj, NOCArray, IPKValue, CaseAdminNode,
+                                                                           AdminVendorId);
+    }
 
-namespace OtaSoftwareUpdateProvider {
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::AddOpCert, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchAddTrustedRootCertificateCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::OtaSoftwareUpdateProvider::Commands::Ids::ApplyUpdateRequest: {
-            expectArgumentCount = 2;
-            chip::ByteSpan updateToken;
-            uint32_t newVersion;
-            bool argExists[2];
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 1;
+    chip::ByteSpan RootCertificate;
+    bool argExists[1];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    updateToken          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(newVersion);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 1)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfOtaSoftwareUpdateProviderClusterApplyUpdateRequestCallback(apCommandObj, updateToken, newVersion);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            RootCertificate      = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::OtaSoftwareUpdateProvider::Commands::Ids::NotifyUpdateApplied: {
-            expectArgumentCount = 2;
-            chip::ByteSpan updateToken;
-            uint32_t currentVersion;
-            bool argExists[2];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    updateToken          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(currentVersion);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterAddTrustedRootCertificateCallback(apCommandObj, RootCertificate);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::AddTrustedRootCertificate, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfOtaSoftwareUpdateProviderClusterNotifyUpdateAppliedCallback(apCommandObj, updateToken, currentVersion);
-            }
-            break;
+void DispatchOpCSRRequestCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 1;
+    chip::ByteSpan CSRNonce;
+    bool argExists[1];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
         }
-        case Clusters::OtaSoftwareUpdateProvider::Commands::Ids::QueryImage: {
-            expectArgumentCount = 9;
-            uint16_t vendorId;
-            uint16_t productId;
-            uint16_t imageType;
-            uint16_t hardwareVersion;
-            uint32_t currentVersion;
-            /* TYPE WARNING: array array defaults to */ uint8_t * protocolsSupported;
-            const uint8_t * location;
-            uint8_t requestorCanConsent;
-            chip::ByteSpan metadataForProvider;
-            bool argExists[9];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 1)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 9)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(vendorId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(productId);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(imageType);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(hardwareVersion);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(currentVersion);
-                    break;
-                case 5:
-                    // Just for compatibility, we will add array type support in IM later.
-                    TLVUnpackError = aDataTlv.GetDataPtr(const_cast<const uint8_t *&>(protocolsSupported));
-                    break;
-                case 6:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(location);
-                    break;
-                case 7:
-                    TLVUnpackError = aDataTlv.Get(requestorCanConsent);
-                    break;
-                case 8: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    metadataForProvider  = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
                 break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 9 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfOtaSoftwareUpdateProviderClusterQueryImageCallback(
-                    apCommandObj, vendorId, productId, imageType, hardwareVersion, currentVersion, protocolsSupported,
-                    const_cast<uint8_t *>(location), requestorCanConsent, metadataForProvider);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::OtaSoftwareUpdateProvider::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId,
-                         Clusters::OtaSoftwareUpdateProvider::Id);
-            return;
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            CSRNonce             = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
-    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    if (CHIP_END_OF_TLV == TLVError)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::OtaSoftwareUpdateProvider::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
     }
-}
 
-} // namespace OtaSoftwareUpdateProvider
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterOpCSRRequestCallback(apCommandObj, CSRNonce);
+    }
 
-namespace OnOff {
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::OpCSRRequest, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchRemoveAllFabricsCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
+
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfOperationalCredentialsClusterRemoveAllFabricsCallback(apCommandObj);
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        switch (aCommandId)
-        {
-        case Clusters::OnOff::Commands::Ids::Off: {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::RemoveAllFabrics, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfOnOffClusterOffCallback(apCommandObj);
-            break;
-        }
-        case Clusters::OnOff::Commands::Ids::On: {
+void DispatchRemoveFabricCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfOnOffClusterOnCallback(apCommandObj);
-            break;
-        }
-        case Clusters::OnOff::Commands::Ids::Toggle: {
+    expectArgumentCount = 3;
+    Clusters::OperationalCredentials::Commands::RemoveFabric arguments;
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfOnOffClusterToggleCallback(apCommandObj);
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::OnOff::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::OnOff::Id);
-            return;
-        }
-        }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterRemoveFabricCallback(apCommandObj, arguments.FabricId, arguments.NodeId,
+                                                                              arguments.VendorId);
     }
 
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::OnOff::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::RemoveFabric, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
-} // namespace OnOff
-
-namespace OperationalCredentials {
-
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchRemoveTrustedRootCertificateCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::OperationalCredentials::Commands::Ids::AddOpCert: {
-            expectArgumentCount = 4;
-            chip::ByteSpan NOCArray;
-            chip::ByteSpan IPKValue;
-            chip::NodeId CaseAdminNode;
-            uint16_t AdminVendorId;
-            bool argExists[4];
 
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NOCArray             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    IPKValue             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(CaseAdminNode);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(AdminVendorId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    expectArgumentCount = 1;
+    chip::ByteSpan TrustedRootIdentifier;
+    bool argExists[1];
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfOperationalCredentialsClusterAddOpCertCallback(apCommandObj, NOCArray, IPKValue, CaseAdminNode,
-                                                                                   AdminVendorId);
-            }
-            break;
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
         }
-        case Clusters::OperationalCredentials::Commands::Ids::AddTrustedRootCertificate: {
-            expectArgumentCount = 1;
-            chip::ByteSpan RootCertificate;
-            bool argExists[1];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 1)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    RootCertificate      = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
                 break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfOperationalCredentialsClusterAddTrustedRootCertificateCallback(apCommandObj, RootCertificate);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        case Clusters::OperationalCredentials::Commands::Ids::OpCSRRequest: {
-            expectArgumentCount = 1;
-            chip::ByteSpan CSRNonce;
-            bool argExists[1];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    CSRNonce             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfOperationalCredentialsClusterOpCSRRequestCallback(apCommandObj, CSRNonce);
-            }
-            break;
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data  = nullptr;
+            TLVUnpackError        = aDataTlv.GetDataPtr(data);
+            TrustedRootIdentifier = chip::ByteSpan(data, aDataTlv.GetLength());
         }
-        case Clusters::OperationalCredentials::Commands::Ids::RemoveAllFabrics: {
-
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfOperationalCredentialsClusterRemoveAllFabricsCallback(apCommandObj);
+        break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::OperationalCredentials::Commands::Ids::RemoveFabric: {
-            expectArgumentCount = 3;
-            chip::FabricId FabricId;
-            chip::NodeId NodeId;
-            uint16_t VendorId;
-            bool argExists[3];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(FabricId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(NodeId);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(VendorId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfOperationalCredentialsClusterRemoveFabricCallback(apCommandObj, FabricId, NodeId, VendorId);
-            }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::OperationalCredentials::Commands::Ids::RemoveTrustedRootCertificate: {
-            expectArgumentCount = 1;
-            chip::ByteSpan TrustedRootIdentifier;
-            bool argExists[1];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data  = nullptr;
-                    TLVUnpackError        = aDataTlv.GetDataPtr(data);
-                    TrustedRootIdentifier = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterRemoveTrustedRootCertificateCallback(apCommandObj, TrustedRootIdentifier);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::RemoveTrustedRootCertificate, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfOperationalCredentialsClusterRemoveTrustedRootCertificateCallback(apCommandObj, TrustedRootIdentifier);
-            }
-            break;
-        }
-        case Clusters::OperationalCredentials::Commands::Ids::SetFabric: {
-            expectArgumentCount = 1;
-            uint16_t VendorId;
-            bool argExists[1];
+void DispatchSetFabricCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 1;
+    Clusters::OperationalCredentials::Commands::SetFabric arguments;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(VendorId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterSetFabricCallback(apCommandObj, arguments.VendorId);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::SetFabric, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfOperationalCredentialsClusterSetFabricCallback(apCommandObj, VendorId);
-            }
-            break;
-        }
-        case Clusters::OperationalCredentials::Commands::Ids::UpdateFabricLabel: {
-            expectArgumentCount = 1;
-            const uint8_t * Label;
-            bool argExists[1];
+void DispatchUpdateFabricLabelCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 1;
+    const uint8_t * Label;
+    bool argExists[1];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(Label);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 1)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfOperationalCredentialsClusterUpdateFabricLabelCallback(apCommandObj, const_cast<uint8_t *>(Label));
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::OperationalCredentials::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::OperationalCredentials::Id);
-            return;
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(Label);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterUpdateFabricLabelCallback(apCommandObj, const_cast<uint8_t *>(Label));
+    }
+
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::OperationalCredentials::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::UpdateFabricLabel, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
@@ -6314,500 +4408,291 @@ void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, En
 
 namespace Scenes {
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchAddSceneCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
+
+    expectArgumentCount = 5;
+    uint16_t groupId;
+    uint8_t sceneId;
+    uint16_t transitionTime;
+    const uint8_t * sceneName;
+    /* TYPE WARNING: array array defaults to */ uint8_t * extensionFieldSets;
+    bool argExists[5];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
     {
-        switch (aCommandId)
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
         {
-        case Clusters::Scenes::Commands::Ids::AddScene: {
-            expectArgumentCount = 5;
-            uint16_t groupId;
-            uint8_t sceneId;
-            uint16_t transitionTime;
-            const uint8_t * sceneName;
-            /* TYPE WARNING: array array defaults to */ uint8_t * extensionFieldSets;
-            bool argExists[5];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(sceneId);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(sceneName);
-                    break;
-                case 4:
-                    // Just for compatibility, we will add array type support in IM later.
-                    TLVUnpackError = aDataTlv.GetDataPtr(const_cast<const uint8_t *&>(extensionFieldSets));
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 5)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfScenesClusterAddSceneCallback(apCommandObj, groupId, sceneId, transitionTime,
-                                                                  const_cast<uint8_t *>(sceneName), extensionFieldSets);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(groupId);
+            break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(sceneId);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(transitionTime);
+            break;
+        case 3:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(sceneName);
+            break;
+        case 4:
+            // Just for compatibility, we will add array type support in IM later.
+            TLVUnpackError = aDataTlv.GetDataPtr(const_cast<const uint8_t *&>(extensionFieldSets));
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::Scenes::Commands::Ids::GetSceneMembership: {
-            expectArgumentCount = 1;
-            uint16_t groupId;
-            bool argExists[1];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfScenesClusterAddSceneCallback(apCommandObj, groupId, sceneId, transitionTime,
+                                                          const_cast<uint8_t *>(sceneName), extensionFieldSets);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::AddScene, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfScenesClusterGetSceneMembershipCallback(apCommandObj, groupId);
-            }
-            break;
-        }
-        case Clusters::Scenes::Commands::Ids::RecallScene: {
-            expectArgumentCount = 3;
-            uint16_t groupId;
-            uint8_t sceneId;
-            uint16_t transitionTime;
-            bool argExists[3];
+void DispatchGetSceneMembershipCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 1;
+    Clusters::Scenes::Commands::GetSceneMembership arguments;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(sceneId);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfScenesClusterGetSceneMembershipCallback(apCommandObj, arguments.groupId);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::GetSceneMembership, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfScenesClusterRecallSceneCallback(apCommandObj, groupId, sceneId, transitionTime);
-            }
-            break;
-        }
-        case Clusters::Scenes::Commands::Ids::RemoveAllScenes: {
-            expectArgumentCount = 1;
-            uint16_t groupId;
-            bool argExists[1];
+void DispatchRecallSceneCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 3;
+    Clusters::Scenes::Commands::RecallScene arguments;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfScenesClusterRecallSceneCallback(apCommandObj, arguments.groupId, arguments.sceneId,
+                                                             arguments.transitionTime);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::RecallScene, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfScenesClusterRemoveAllScenesCallback(apCommandObj, groupId);
-            }
-            break;
-        }
-        case Clusters::Scenes::Commands::Ids::RemoveScene: {
-            expectArgumentCount = 2;
-            uint16_t groupId;
-            uint8_t sceneId;
-            bool argExists[2];
+void DispatchRemoveAllScenesCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 1;
+    Clusters::Scenes::Commands::RemoveAllScenes arguments;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(sceneId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfScenesClusterRemoveAllScenesCallback(apCommandObj, arguments.groupId);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::RemoveAllScenes, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfScenesClusterRemoveSceneCallback(apCommandObj, groupId, sceneId);
-            }
-            break;
-        }
-        case Clusters::Scenes::Commands::Ids::StoreScene: {
-            expectArgumentCount = 2;
-            uint16_t groupId;
-            uint8_t sceneId;
-            bool argExists[2];
+void DispatchRemoveSceneCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 2;
+    Clusters::Scenes::Commands::RemoveScene arguments;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(sceneId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfScenesClusterRemoveSceneCallback(apCommandObj, arguments.groupId, arguments.sceneId);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::RemoveScene, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfScenesClusterStoreSceneCallback(apCommandObj, groupId, sceneId);
-            }
-            break;
-        }
-        case Clusters::Scenes::Commands::Ids::ViewScene: {
-            expectArgumentCount = 2;
-            uint16_t groupId;
-            uint8_t sceneId;
-            bool argExists[2];
+void DispatchStoreSceneCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 2;
+    Clusters::Scenes::Commands::StoreScene arguments;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(groupId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(sceneId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfScenesClusterStoreSceneCallback(apCommandObj, arguments.groupId, arguments.sceneId);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::StoreScene, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfScenesClusterViewSceneCallback(apCommandObj, groupId, sceneId);
-            }
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::Scenes::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::Scenes::Id);
-            return;
-        }
-        }
+void DispatchViewSceneCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 2;
+    Clusters::Scenes::Commands::ViewScene arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfScenesClusterViewSceneCallback(apCommandObj, arguments.groupId, arguments.sceneId);
     }
 
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::Scenes::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::ViewScene, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
@@ -6815,66 +4700,69 @@ void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, En
 
 namespace TestCluster {
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchTestCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
+
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfTestClusterClusterTestCallback(apCommandObj);
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        switch (aCommandId)
-        {
-        case Clusters::TestCluster::Commands::Ids::Test: {
+        ReportInvalidCommand(apCommandObj, Clusters::TestCluster::Id, Clusters::TestCluster::Commands::Ids::Test, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfTestClusterClusterTestCallback(apCommandObj);
-            break;
-        }
-        case Clusters::TestCluster::Commands::Ids::TestNotHandled: {
+void DispatchTestNotHandledCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfTestClusterClusterTestNotHandledCallback(apCommandObj);
-            break;
-        }
-        case Clusters::TestCluster::Commands::Ids::TestSpecific: {
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfTestClusterClusterTestNotHandledCallback(apCommandObj);
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfTestClusterClusterTestSpecificCallback(apCommandObj);
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::TestCluster::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::TestCluster::Id);
-            return;
-        }
-        }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::TestCluster::Id, Clusters::TestCluster::Commands::Ids::TestNotHandled,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
+}
+
+void DispatchTestSpecificCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfTestClusterClusterTestSpecificCallback(apCommandObj);
 
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::TestCluster::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::TestCluster::Id, Clusters::TestCluster::Commands::Ids::TestSpecific,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
@@ -6882,81 +4770,215 @@ void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, En
 
 } // namespace clusters
 
+namespace {
+
+constexpr CommandDispatchEntry kCommandDispatchEntries[] = {
+    { Clusters::BarrierControl::Id, Clusters::BarrierControl::Commands::Ids::BarrierControlGoToPercent,
+      clusters::BarrierControl::DispatchBarrierControlGoToPercentCommand },
+    { Clusters::BarrierControl::Id, Clusters::BarrierControl::Commands::Ids::BarrierControlStop,
+      clusters::BarrierControl::DispatchBarrierControlStopCommand },
+    { Clusters::Binding::Id, Clusters::Binding::Commands::Ids::Bind, clusters::Binding::DispatchBindCommand },
+    { Clusters::Binding::Id, Clusters::Binding::Commands::Ids::Unbind, clusters::Binding::DispatchUnbindCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::ColorLoopSet,
+      clusters::ColorControl::DispatchColorLoopSetCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::EnhancedMoveHue,
+      clusters::ColorControl::DispatchEnhancedMoveHueCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::EnhancedMoveToHue,
+      clusters::ColorControl::DispatchEnhancedMoveToHueCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::EnhancedMoveToHueAndSaturation,
+      clusters::ColorControl::DispatchEnhancedMoveToHueAndSaturationCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::EnhancedStepHue,
+      clusters::ColorControl::DispatchEnhancedStepHueCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveColor,
+      clusters::ColorControl::DispatchMoveColorCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveColorTemperature,
+      clusters::ColorControl::DispatchMoveColorTemperatureCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveHue, clusters::ColorControl::DispatchMoveHueCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveSaturation,
+      clusters::ColorControl::DispatchMoveSaturationCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveToColor,
+      clusters::ColorControl::DispatchMoveToColorCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveToColorTemperature,
+      clusters::ColorControl::DispatchMoveToColorTemperatureCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveToHue,
+      clusters::ColorControl::DispatchMoveToHueCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveToHueAndSaturation,
+      clusters::ColorControl::DispatchMoveToHueAndSaturationCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::MoveToSaturation,
+      clusters::ColorControl::DispatchMoveToSaturationCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::StepColor,
+      clusters::ColorControl::DispatchStepColorCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::StepColorTemperature,
+      clusters::ColorControl::DispatchStepColorTemperatureCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::StepHue, clusters::ColorControl::DispatchStepHueCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::StepSaturation,
+      clusters::ColorControl::DispatchStepSaturationCommand },
+    { Clusters::ColorControl::Id, Clusters::ColorControl::Commands::Ids::StopMoveStep,
+      clusters::ColorControl::DispatchStopMoveStepCommand },
+    { Clusters::DiagnosticLogs::Id, Clusters::DiagnosticLogs::Commands::Ids::RetrieveLogsRequest,
+      clusters::DiagnosticLogs::DispatchRetrieveLogsRequestCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearAllPins, clusters::DoorLock::DispatchClearAllPinsCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearAllRfids, clusters::DoorLock::DispatchClearAllRfidsCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearHolidaySchedule,
+      clusters::DoorLock::DispatchClearHolidayScheduleCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearPin, clusters::DoorLock::DispatchClearPinCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearRfid, clusters::DoorLock::DispatchClearRfidCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearWeekdaySchedule,
+      clusters::DoorLock::DispatchClearWeekdayScheduleCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::ClearYeardaySchedule,
+      clusters::DoorLock::DispatchClearYeardayScheduleCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetHolidaySchedule,
+      clusters::DoorLock::DispatchGetHolidayScheduleCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetLogRecord, clusters::DoorLock::DispatchGetLogRecordCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetPin, clusters::DoorLock::DispatchGetPinCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetRfid, clusters::DoorLock::DispatchGetRfidCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetUserType, clusters::DoorLock::DispatchGetUserTypeCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetWeekdaySchedule,
+      clusters::DoorLock::DispatchGetWeekdayScheduleCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::GetYeardaySchedule,
+      clusters::DoorLock::DispatchGetYeardayScheduleCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::LockDoor, clusters::DoorLock::DispatchLockDoorCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetHolidaySchedule,
+      clusters::DoorLock::DispatchSetHolidayScheduleCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetPin, clusters::DoorLock::DispatchSetPinCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetRfid, clusters::DoorLock::DispatchSetRfidCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetUserType, clusters::DoorLock::DispatchSetUserTypeCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetWeekdaySchedule,
+      clusters::DoorLock::DispatchSetWeekdayScheduleCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::SetYeardaySchedule,
+      clusters::DoorLock::DispatchSetYeardayScheduleCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::UnlockDoor, clusters::DoorLock::DispatchUnlockDoorCommand },
+    { Clusters::DoorLock::Id, Clusters::DoorLock::Commands::Ids::UnlockWithTimeout,
+      clusters::DoorLock::DispatchUnlockWithTimeoutCommand },
+    { Clusters::GeneralCommissioning::Id, Clusters::GeneralCommissioning::Commands::Ids::ArmFailSafe,
+      clusters::GeneralCommissioning::DispatchArmFailSafeCommand },
+    { Clusters::GeneralCommissioning::Id, Clusters::GeneralCommissioning::Commands::Ids::CommissioningComplete,
+      clusters::GeneralCommissioning::DispatchCommissioningCompleteCommand },
+    { Clusters::GeneralCommissioning::Id, Clusters::GeneralCommissioning::Commands::Ids::SetRegulatoryConfig,
+      clusters::GeneralCommissioning::DispatchSetRegulatoryConfigCommand },
+    { Clusters::Groups::Id, Clusters::Groups::Commands::Ids::AddGroup, clusters::Groups::DispatchAddGroupCommand },
+    { Clusters::Groups::Id, Clusters::Groups::Commands::Ids::AddGroupIfIdentifying,
+      clusters::Groups::DispatchAddGroupIfIdentifyingCommand },
+    { Clusters::Groups::Id, Clusters::Groups::Commands::Ids::GetGroupMembership,
+      clusters::Groups::DispatchGetGroupMembershipCommand },
+    { Clusters::Groups::Id, Clusters::Groups::Commands::Ids::RemoveAllGroups, clusters::Groups::DispatchRemoveAllGroupsCommand },
+    { Clusters::Groups::Id, Clusters::Groups::Commands::Ids::RemoveGroup, clusters::Groups::DispatchRemoveGroupCommand },
+    { Clusters::Groups::Id, Clusters::Groups::Commands::Ids::ViewGroup, clusters::Groups::DispatchViewGroupCommand },
+    { Clusters::IasZone::Id, Clusters::IasZone::Commands::Ids::ZoneEnrollResponse,
+      clusters::IasZone::DispatchZoneEnrollResponseCommand },
+    { Clusters::Identify::Id, Clusters::Identify::Commands::Ids::Identify, clusters::Identify::DispatchIdentifyCommand },
+    { Clusters::Identify::Id, Clusters::Identify::Commands::Ids::IdentifyQuery, clusters::Identify::DispatchIdentifyQueryCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Move, clusters::LevelControl::DispatchMoveCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveToLevel,
+      clusters::LevelControl::DispatchMoveToLevelCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveToLevelWithOnOff,
+      clusters::LevelControl::DispatchMoveToLevelWithOnOffCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveWithOnOff,
+      clusters::LevelControl::DispatchMoveWithOnOffCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Step, clusters::LevelControl::DispatchStepCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::StepWithOnOff,
+      clusters::LevelControl::DispatchStepWithOnOffCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Stop, clusters::LevelControl::DispatchStopCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::StopWithOnOff,
+      clusters::LevelControl::DispatchStopWithOnOffCommand },
+    { Clusters::LowPower::Id, Clusters::LowPower::Commands::Ids::Sleep, clusters::LowPower::DispatchSleepCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::AddThreadNetwork,
+      clusters::NetworkCommissioning::DispatchAddThreadNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::AddWiFiNetwork,
+      clusters::NetworkCommissioning::DispatchAddWiFiNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::DisableNetwork,
+      clusters::NetworkCommissioning::DispatchDisableNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::EnableNetwork,
+      clusters::NetworkCommissioning::DispatchEnableNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::GetLastNetworkCommissioningResult,
+      clusters::NetworkCommissioning::DispatchGetLastNetworkCommissioningResultCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::RemoveNetwork,
+      clusters::NetworkCommissioning::DispatchRemoveNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::ScanNetworks,
+      clusters::NetworkCommissioning::DispatchScanNetworksCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::UpdateThreadNetwork,
+      clusters::NetworkCommissioning::DispatchUpdateThreadNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::UpdateWiFiNetwork,
+      clusters::NetworkCommissioning::DispatchUpdateWiFiNetworkCommand },
+    { Clusters::OtaSoftwareUpdateProvider::Id, Clusters::OtaSoftwareUpdateProvider::Commands::Ids::ApplyUpdateRequest,
+      clusters::OtaSoftwareUpdateProvider::DispatchApplyUpdateRequestCommand },
+    { Clusters::OtaSoftwareUpdateProvider::Id, Clusters::OtaSoftwareUpdateProvider::Commands::Ids::NotifyUpdateApplied,
+      clusters::OtaSoftwareUpdateProvider::DispatchNotifyUpdateAppliedCommand },
+    { Clusters::OtaSoftwareUpdateProvider::Id, Clusters::OtaSoftwareUpdateProvider::Commands::Ids::QueryImage,
+      clusters::OtaSoftwareUpdateProvider::DispatchQueryImageCommand },
+    { Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::Off, clusters::OnOff::DispatchOffCommand },
+    { Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::On, clusters::OnOff::DispatchOnCommand },
+    { Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::Toggle, clusters::OnOff::DispatchToggleCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::AddOpCert,
+      clusters::OperationalCredentials::DispatchAddOpCertCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::AddTrustedRootCertificate,
+      clusters::OperationalCredentials::DispatchAddTrustedRootCertificateCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::OpCSRRequest,
+      clusters::OperationalCredentials::DispatchOpCSRRequestCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::RemoveAllFabrics,
+      clusters::OperationalCredentials::DispatchRemoveAllFabricsCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::RemoveFabric,
+      clusters::OperationalCredentials::DispatchRemoveFabricCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::RemoveTrustedRootCertificate,
+      clusters::OperationalCredentials::DispatchRemoveTrustedRootCertificateCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::SetFabric,
+      clusters::OperationalCredentials::DispatchSetFabricCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::UpdateFabricLabel,
+      clusters::OperationalCredentials::DispatchUpdateFabricLabelCommand },
+    { Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::AddScene, clusters::Scenes::DispatchAddSceneCommand },
+    { Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::GetSceneMembership,
+      clusters::Scenes::DispatchGetSceneMembershipCommand },
+    { Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::RecallScene, clusters::Scenes::DispatchRecallSceneCommand },
+    { Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::RemoveAllScenes, clusters::Scenes::DispatchRemoveAllScenesCommand },
+    { Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::RemoveScene, clusters::Scenes::DispatchRemoveSceneCommand },
+    { Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::StoreScene, clusters::Scenes::DispatchStoreSceneCommand },
+    { Clusters::Scenes::Id, Clusters::Scenes::Commands::Ids::ViewScene, clusters::Scenes::DispatchViewSceneCommand },
+    { Clusters::TestCluster::Id, Clusters::TestCluster::Commands::Ids::Test, clusters::TestCluster::DispatchTestCommand },
+    { Clusters::TestCluster::Id, Clusters::TestCluster::Commands::Ids::TestNotHandled,
+      clusters::TestCluster::DispatchTestNotHandledCommand },
+    { Clusters::TestCluster::Id, Clusters::TestCluster::Commands::Ids::TestSpecific,
+      clusters::TestCluster::DispatchTestSpecificCommand },
+};
+
+// Sorted by cluster and command ID at compile time, so that the handler of a command is found with a binary search.
+constexpr auto kCommandDispatchTable = MakeCommandDispatchTable(kCommandDispatchEntries);
+static_assert(kCommandDispatchTable.IsValid(), "Each command must have a single handler");
+
+} // namespace
+
 void DispatchSingleClusterCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId,
                                   chip::TLV::TLVReader & aReader, Command * apCommandObj)
 {
     ChipLogDetail(Zcl, "Received Cluster Command: Cluster=%" PRIx32 " Command=%" PRIx32 " Endpoint=%" PRIx16, aClusterId,
                   aCommandId, aEndPointId);
-    Compatibility::SetupEmberAfObjects(apCommandObj, aClusterId, aCommandId, aEndPointId);
-    TLV::TLVType dataTlvType;
-    SuccessOrExit(aReader.EnterContainer(dataTlvType));
-    switch (aClusterId)
+    CommandDispatchFunction dispatch = kCommandDispatchTable.Find(aClusterId, aCommandId);
+    if (dispatch == nullptr)
     {
-    case Clusters::BarrierControl::Id:
-        clusters::BarrierControl::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::Basic::Id:
-        clusters::Basic::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::Binding::Id:
-        clusters::Binding::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::ColorControl::Id:
-        clusters::ColorControl::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::DiagnosticLogs::Id:
-        clusters::DiagnosticLogs::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::DoorLock::Id:
-        clusters::DoorLock::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::GeneralCommissioning::Id:
-        clusters::GeneralCommissioning::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::Groups::Id:
-        clusters::Groups::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::IasZone::Id:
-        clusters::IasZone::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::Identify::Id:
-        clusters::Identify::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::LevelControl::Id:
-        clusters::LevelControl::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::LowPower::Id:
-        clusters::LowPower::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::NetworkCommissioning::Id:
-        clusters::NetworkCommissioning::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::OtaSoftwareUpdateProvider::Id:
-        clusters::OtaSoftwareUpdateProvider::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::OnOff::Id:
-        clusters::OnOff::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::OperationalCredentials::Id:
-        clusters::OperationalCredentials::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::Scenes::Id:
-        clusters::Scenes::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::TestCluster::Id:
-        clusters::TestCluster::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    default:
-        // Unrecognized cluster ID, error status will apply.
+        // Unrecognized cluster or command ID, error status will apply.
+        const bool clusterFound                        = kCommandDispatchTable.HasCluster(aClusterId);
         chip::app::CommandPathParams returnStatusParam = { aEndPointId,
                                                            0, // GroupId
                                                            aClusterId, aCommandId,
                                                            (chip::app::CommandPathFlags::kEndpointIdValid) };
         apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogError(Zcl, "Unknown cluster %" PRIx32, aClusterId);
-        break;
+                                    Protocols::SecureChannel::Id,
+                                    clusterFound ? Protocols::InteractionModel::ProtocolCode::UnsupportedCommand
+                                                 : Protocols::InteractionModel::ProtocolCode::InvalidCommand);
+        if (clusterFound)
+        {
+            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, aClusterId);
+        }
+        else
+        {
+            ChipLogError(Zcl, "Unknown cluster %" PRIx32, aClusterId);
+        }
+        return;
     }
+
+    Compatibility::SetupEmberAfObjects(apCommandObj, aClusterId, aCommandId, aEndPointId);
+    TLV::TLVType dataTlvType;
+    SuccessOrExit(aReader.EnterContainer(dataTlvType));
+    dispatch(apCommandObj, aEndPointId, aReader);
 exit:
     Compatibility::ResetEmberAfObjects();
     aReader.ExitContainer(dataTlvType);
@@ -22,10 +22,12 @@
 
 #include "app/common/gen/af-structs.h"
 #include "app/common/gen/callback.h"
+#include "app/common/gen/cluster-codecs.h"
 #include "app/common/gen/ids/Clusters.h"
 #include "app/common/gen/ids/Commands.h"
 #include "app/util/util.h"
 
+#include <app/CommandDispatchTable.h>
 #include <app/InteractionModelEngine.h>
 
 // Currently we need some work to keep compatible with ember lib.
@@ -38,121 +40,114 @@ namespace app {
 
 namespace clusters {
 
+namespace {
+
+void ReportInvalidCommand(app::Command * apCommandObj, ClusterId aClusterId, CommandId aCommandId, EndpointId aEndpointId,
+                          uint32_t validArgumentCount, uint32_t expectArgumentCount, CHIP_ERROR TLVError, CHIP_ERROR TLVUnpackError,
+                          uint32_t currentDecodeTagId)
+{
+    chip::app::CommandPathParams returnStatusParam = { aEndpointId,
+                                                       0, // GroupId
+                                                       aClusterId, aCommandId,
+                                                       (chip::app::CommandPathFlags::kEndpointIdValid) };
+    apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
+                                Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
+    ChipLogProgress(Zcl,
+                    "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
+                    ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
+                    validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+}
+
+} // namespace
+
 namespace DiagnosticLogs {
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchRetrieveLogsRequestCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::DiagnosticLogs::Commands::Ids::RetrieveLogsRequest: {
-            expectArgumentCount = 3;
-            uint8_t intent;
-            uint8_t requestedProtocol;
-            chip::ByteSpan transferFileDesignator;
-            bool argExists[3];
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 3;
+    uint8_t intent;
+    uint8_t requestedProtocol;
+    chip::ByteSpan transferFileDesignator;
+    bool argExists[3];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(intent);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(requestedProtocol);
-                    break;
-                case 2: {
-                    const uint8_t * data   = nullptr;
-                    TLVUnpackError         = aDataTlv.GetDataPtr(data);
-                    transferFileDesignator = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfDiagnosticLogsClusterRetrieveLogsRequestCallback(apCommandObj, intent, requestedProtocol,
-                                                                                     transferFileDesignator);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(intent);
             break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(requestedProtocol);
+            break;
+        case 2: {
+            const uint8_t * data   = nullptr;
+            TLVUnpackError         = aDataTlv.GetDataPtr(data);
+            transferFileDesignator = chip::ByteSpan(data, aDataTlv.GetLength());
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::DiagnosticLogs::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::DiagnosticLogs::Id);
-            return;
+        break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfDiagnosticLogsClusterRetrieveLogsRequestCallback(apCommandObj, intent, requestedProtocol,
+                                                                             transferFileDesignator);
+    }
+
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::DiagnosticLogs::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::DiagnosticLogs::Id,
+                             Clusters::DiagnosticLogs::Commands::Ids::RetrieveLogsRequest, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
@@ -160,195 +155,152 @@ void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, En
 
 namespace GeneralCommissioning {
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchArmFailSafeCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
+
+    expectArgumentCount = 3;
+    Clusters::GeneralCommissioning::Commands::ArmFailSafe arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
     {
-        switch (aCommandId)
-        {
-        case Clusters::GeneralCommissioning::Commands::Ids::ArmFailSafe: {
-            expectArgumentCount = 3;
-            uint16_t expiryLengthSeconds;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfGeneralCommissioningClusterArmFailSafeCallback(apCommandObj, arguments.expiryLengthSeconds,
+                                                                           arguments.breadcrumb, arguments.timeoutMs);
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::GeneralCommissioning::Id,
+                             Clusters::GeneralCommissioning::Commands::Ids::ArmFailSafe, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(expiryLengthSeconds);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+void DispatchCommissioningCompleteCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfGeneralCommissioningClusterCommissioningCompleteCallback(apCommandObj);
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfGeneralCommissioningClusterArmFailSafeCallback(apCommandObj, expiryLengthSeconds, breadcrumb, timeoutMs);
-            }
-            break;
-        }
-        case Clusters::GeneralCommissioning::Commands::Ids::CommissioningComplete: {
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::GeneralCommissioning::Id,
+                             Clusters::GeneralCommissioning::Commands::Ids::CommissioningComplete, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfGeneralCommissioningClusterCommissioningCompleteCallback(apCommandObj);
-            break;
-        }
-        case Clusters::GeneralCommissioning::Commands::Ids::SetRegulatoryConfig: {
-            expectArgumentCount = 4;
-            uint8_t location;
-            const uint8_t * countryCode;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[4];
+void DispatchSetRegulatoryConfigCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 4;
+    uint8_t location;
+    const uint8_t * countryCode;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[4];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(location);
-                    break;
-                case 1:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(countryCode);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 4)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfGeneralCommissioningClusterSetRegulatoryConfigCallback(
-                    apCommandObj, location, const_cast<uint8_t *>(countryCode), breadcrumb, timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::GeneralCommissioning::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::GeneralCommissioning::Id);
-            return;
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            TLVUnpackError = aDataTlv.Get(location);
+            break;
+        case 1:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(countryCode);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 3:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfGeneralCommissioningClusterSetRegulatoryConfigCallback(apCommandObj, location,
+                                                                                   const_cast<uint8_t *>(countryCode), breadcrumb,
+                                                                                   timeoutMs);
+    }
+
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::GeneralCommissioning::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::GeneralCommissioning::Id,
+                             Clusters::GeneralCommissioning::Commands::Ids::SetRegulatoryConfig, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
@@ -356,1792 +308,1593 @@ void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, En
 
 namespace LevelControl {
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchMoveCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::LevelControl::Commands::Ids::Move: {
-            expectArgumentCount = 4;
-            uint8_t moveMode;
-            uint8_t rate;
-            uint8_t optionMask;
-            uint8_t optionOverride;
-            bool argExists[4];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(moveMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(rate);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(optionMask);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterMoveCallback(apCommandObj, moveMode, rate, optionMask, optionOverride);
-            }
-            break;
-        }
-        case Clusters::LevelControl::Commands::Ids::MoveToLevel: {
-            expectArgumentCount = 4;
-            uint8_t level;
-            uint16_t transitionTime;
-            uint8_t optionMask;
-            uint8_t optionOverride;
-            bool argExists[4];
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 4;
+    Clusters::LevelControl::Commands::Move arguments;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(level);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(optionMask);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfLevelControlClusterMoveToLevelCallback(apCommandObj, level, transitionTime, optionMask, optionOverride);
-            }
-            break;
-        }
-        case Clusters::LevelControl::Commands::Ids::MoveToLevelWithOnOff: {
-            expectArgumentCount = 2;
-            uint8_t level;
-            uint16_t transitionTime;
-            bool argExists[2];
-
-            memset(argExists, 0, sizeof argExists);
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterMoveCallback(apCommandObj, arguments.moveMode, arguments.rate, arguments.optionMask,
+                                                            arguments.optionOverride);
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(level);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Move, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+void DispatchMoveToLevelCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterMoveToLevelWithOnOffCallback(apCommandObj, level, transitionTime);
-            }
-            break;
-        }
-        case Clusters::LevelControl::Commands::Ids::MoveWithOnOff: {
-            expectArgumentCount = 2;
-            uint8_t moveMode;
-            uint8_t rate;
-            bool argExists[2];
+    expectArgumentCount = 4;
+    Clusters::LevelControl::Commands::MoveToLevel arguments;
 
-            memset(argExists, 0, sizeof argExists);
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterMoveToLevelCallback(apCommandObj, arguments.level, arguments.transitionTime,
+                                                                   arguments.optionMask, arguments.optionOverride);
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(moveMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(rate);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveToLevel,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+void DispatchMoveToLevelWithOnOffCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterMoveWithOnOffCallback(apCommandObj, moveMode, rate);
-            }
-            break;
-        }
-        case Clusters::LevelControl::Commands::Ids::Step: {
-            expectArgumentCount = 5;
-            uint8_t stepMode;
-            uint8_t stepSize;
-            uint16_t transitionTime;
-            uint8_t optionMask;
-            uint8_t optionOverride;
-            bool argExists[5];
+    expectArgumentCount = 2;
+    Clusters::LevelControl::Commands::MoveToLevelWithOnOff arguments;
 
-            memset(argExists, 0, sizeof argExists);
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterMoveToLevelWithOnOffCallback(apCommandObj, arguments.level,
+                                                                            arguments.transitionTime);
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 5)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(stepMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(stepSize);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(optionMask);
-                    break;
-                case 4:
-                    TLVUnpackError = aDataTlv.Get(optionOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveToLevelWithOnOff,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+void DispatchMoveWithOnOffCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 5 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterStepCallback(apCommandObj, stepMode, stepSize, transitionTime, optionMask,
-                                                                    optionOverride);
-            }
-            break;
-        }
-        case Clusters::LevelControl::Commands::Ids::StepWithOnOff: {
-            expectArgumentCount = 3;
-            uint8_t stepMode;
-            uint8_t stepSize;
-            uint16_t transitionTime;
-            bool argExists[3];
+    expectArgumentCount = 2;
+    Clusters::LevelControl::Commands::MoveWithOnOff arguments;
 
-            memset(argExists, 0, sizeof argExists);
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterMoveWithOnOffCallback(apCommandObj, arguments.moveMode, arguments.rate);
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(stepMode);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(stepSize);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(transitionTime);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveWithOnOff,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+void DispatchStepCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterStepWithOnOffCallback(apCommandObj, stepMode, stepSize, transitionTime);
-            }
-            break;
-        }
-        case Clusters::LevelControl::Commands::Ids::Stop: {
-            expectArgumentCount = 2;
-            uint8_t optionMask;
-            uint8_t optionOverride;
-            bool argExists[2];
+    expectArgumentCount = 5;
+    Clusters::LevelControl::Commands::Step arguments;
 
-            memset(argExists, 0, sizeof argExists);
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterStepCallback(apCommandObj, arguments.stepMode, arguments.stepSize,
+                                                            arguments.transitionTime, arguments.optionMask,
+                                                            arguments.optionOverride);
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 2)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(optionMask);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(optionOverride);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Step, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+void DispatchStepWithOnOffCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 2 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfLevelControlClusterStopCallback(apCommandObj, optionMask, optionOverride);
-            }
-            break;
-        }
-        case Clusters::LevelControl::Commands::Ids::StopWithOnOff: {
+    expectArgumentCount = 3;
+    Clusters::LevelControl::Commands::StepWithOnOff arguments;
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfLevelControlClusterStopWithOnOffCallback(apCommandObj);
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::LevelControl::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::LevelControl::Id);
-            return;
-        }
-        }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterStepWithOnOffCallback(apCommandObj, arguments.stepMode, arguments.stepSize,
+                                                                     arguments.transitionTime);
     }
 
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::LevelControl::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::StepWithOnOff,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
-} // namespace LevelControl
-
-namespace NetworkCommissioning {
-
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchStopCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::NetworkCommissioning::Commands::Ids::AddThreadNetwork: {
-            expectArgumentCount = 3;
-            chip::ByteSpan operationalDataset;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 2;
+    Clusters::LevelControl::Commands::Stop arguments;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfLevelControlClusterStopCallback(apCommandObj, arguments.optionMask, arguments.optionOverride);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Stop, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchStopWithOnOffCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfLevelControlClusterStopWithOnOffCallback(apCommandObj);
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::StopWithOnOff,
+                             aEndpointId, validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+} // namespace LevelControl
+
+namespace NetworkCommissioning {
+
+void DispatchAddThreadNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 3;
+    chip::ByteSpan operationalDataset;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[3];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
                 break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
             }
-
-            if (CHIP_END_OF_TLV == TLVError)
+            else
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
+
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterAddThreadNetworkCallback(apCommandObj, operationalDataset, breadcrumb,
+                                                                                timeoutMs);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::AddThreadNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+void DispatchAddWiFiNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 4;
+    chip::ByteSpan ssid;
+    chip::ByteSpan credentials;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[4];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 4)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterAddThreadNetworkCallback(apCommandObj, operationalDataset,
-                                                                                        breadcrumb, timeoutMs);
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
+            else
+            {
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
+            }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 3:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::NetworkCommissioning::Commands::Ids::AddWiFiNetwork: {
-            expectArgumentCount = 4;
-            chip::ByteSpan ssid;
-            chip::ByteSpan credentials;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[4];
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
+
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterAddWiFiNetworkCallback(apCommandObj, ssid, credentials, breadcrumb,
+                                                                              timeoutMs);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::AddWiFiNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchDisableNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 3;
+    chip::ByteSpan networkID;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[3];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
                 break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
             }
-
-            if (CHIP_END_OF_TLV == TLVError)
+            else
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
+
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterDisableNetworkCallback(apCommandObj, networkID, breadcrumb, timeoutMs);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::DisableNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchEnableNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 3;
+    chip::ByteSpan networkID;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[3];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
+            {
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
+            }
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterAddWiFiNetworkCallback(apCommandObj, ssid, credentials, breadcrumb,
-                                                                                      timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::NetworkCommissioning::Commands::Ids::DisableNetwork: {
-            expectArgumentCount = 3;
-            chip::ByteSpan networkID;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
+    }
+
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterEnableNetworkCallback(apCommandObj, networkID, breadcrumb, timeoutMs);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::EnableNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            memset(argExists, 0, sizeof argExists);
+void DispatchGetLastNetworkCommissioningResultCommand(app::Command * apCommandObj, EndpointId aEndpointId,
+                                                      TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 1;
+    Clusters::NetworkCommissioning::Commands::GetLastNetworkCommissioningResult arguments;
+
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterGetLastNetworkCommissioningResultCallback(apCommandObj, arguments.timeoutMs);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::GetLastNetworkCommissioningResult, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+void DispatchRemoveNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 3;
+    chip::ByteSpan NetworkID;
+    uint64_t Breadcrumb;
+    uint32_t TimeoutMs;
+    bool argExists[3];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
                 break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
             }
-
-            if (CHIP_END_OF_TLV == TLVError)
+            else
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            NetworkID            = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(Breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(TimeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterRemoveNetworkCallback(apCommandObj, NetworkID, Breadcrumb, TimeoutMs);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::RemoveNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchScanNetworksCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 3;
+    chip::ByteSpan ssid;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[3];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
+            {
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
+            }
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfNetworkCommissioningClusterDisableNetworkCallback(apCommandObj, networkID, breadcrumb, timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::NetworkCommissioning::Commands::Ids::EnableNetwork: {
-            expectArgumentCount = 3;
-            chip::ByteSpan networkID;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
+
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterScanNetworksCallback(apCommandObj, ssid, breadcrumb, timeoutMs);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::ScanNetworks, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchUpdateThreadNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 3;
+    chip::ByteSpan operationalDataset;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[3];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 3)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    networkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
                 break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
             }
-
-            if (CHIP_END_OF_TLV == TLVError)
+            else
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
+        }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
+
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterUpdateThreadNetworkCallback(apCommandObj, operationalDataset, breadcrumb,
+                                                                                   timeoutMs);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::UpdateThreadNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+void DispatchUpdateWiFiNetworkCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 4;
+    chip::ByteSpan ssid;
+    chip::ByteSpan credentials;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+    bool argExists[4];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 4)
+        {
+            if (argExists[currentDecodeTagId])
+            {
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
+            }
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfNetworkCommissioningClusterEnableNetworkCallback(apCommandObj, networkID, breadcrumb, timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(breadcrumb);
+            break;
+        case 3:
+            TLVUnpackError = aDataTlv.Get(timeoutMs);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::NetworkCommissioning::Commands::Ids::GetLastNetworkCommissioningResult: {
-            expectArgumentCount = 1;
-            uint32_t timeoutMs;
-            bool argExists[1];
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfNetworkCommissioningClusterUpdateWiFiNetworkCallback(apCommandObj, ssid, credentials, breadcrumb,
+                                                                                 timeoutMs);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::NetworkCommissioning::Id,
+                             Clusters::NetworkCommissioning::Commands::Ids::UpdateWiFiNetwork, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+} // namespace NetworkCommissioning
+
+namespace OnOff {
+
+void DispatchOffCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfOnOffClusterOffCallback(apCommandObj);
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::Off, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchOnCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfOnOffClusterOnCallback(apCommandObj);
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::On, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchToggleCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfOnOffClusterToggleCallback(apCommandObj);
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::Toggle, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+} // namespace OnOff
+
+namespace OperationalCredentials {
+
+void DispatchAddOpCertCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
+
+    expectArgumentCount = 4;
+    chip::ByteSpan NOCArray;
+    chip::ByteSpan IPKValue;
+    chip::NodeId CaseAdminNode;
+    uint16_t AdminVendorId;
+    bool argExists[4];
+
+    memset(argExists, 0, sizeof argExists);
+
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 4)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterGetLastNetworkCommissioningResultCallback(apCommandObj, timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            NOCArray             = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 1: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            IPKValue             = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        case 2:
+            TLVUnpackError = aDataTlv.Get(CaseAdminNode);
+            break;
+        case 3:
+            TLVUnpackError = aDataTlv.Get(AdminVendorId);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::NetworkCommissioning::Commands::Ids::RemoveNetwork: {
-            expectArgumentCount = 3;
-            chip::ByteSpan NetworkID;
-            uint64_t Breadcrumb;
-            uint32_t TimeoutMs;
-            bool argExists[3];
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
+
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterAddOpCertCallback(apCommandObj, NOCArray, IPKValue, CaseAdminNode,
+                                                                           AdminVendorId);
+    }
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::AddOpCert, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
+
+void DispatchAddTrustedRootCertificateCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NetworkID            = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(Breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(TimeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    expectArgumentCount = 1;
+    chip::ByteSpan RootCertificate;
+    bool argExists[1];
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfNetworkCommissioningClusterRemoveNetworkCallback(apCommandObj, NetworkID, Breadcrumb, TimeoutMs);
-            }
-            break;
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
         }
-        case Clusters::NetworkCommissioning::Commands::Ids::ScanNetworks: {
-            expectArgumentCount = 3;
-            chip::ByteSpan ssid;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 1)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
                 break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
             }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterScanNetworksCallback(apCommandObj, ssid, breadcrumb, timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
+        }
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            RootCertificate      = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::NetworkCommissioning::Commands::Ids::UpdateThreadNetwork: {
-            expectArgumentCount = 3;
-            chip::ByteSpan operationalDataset;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[3];
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
+        }
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    operationalDataset   = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterAddTrustedRootCertificateCallback(apCommandObj, RootCertificate);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::AddTrustedRootCertificate, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterUpdateThreadNetworkCallback(apCommandObj, operationalDataset,
-                                                                                           breadcrumb, timeoutMs);
-            }
-            break;
-        }
-        case Clusters::NetworkCommissioning::Commands::Ids::UpdateWiFiNetwork: {
-            expectArgumentCount = 4;
-            chip::ByteSpan ssid;
-            chip::ByteSpan credentials;
-            uint64_t breadcrumb;
-            uint32_t timeoutMs;
-            bool argExists[4];
+void DispatchOpCSRRequestCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 1;
+    chip::ByteSpan CSRNonce;
+    bool argExists[1];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    ssid                 = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    credentials          = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(breadcrumb);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(timeoutMs);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 1)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfNetworkCommissioningClusterUpdateWiFiNetworkCallback(apCommandObj, ssid, credentials,
-                                                                                         breadcrumb, timeoutMs);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::NetworkCommissioning::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::NetworkCommissioning::Id);
-            return;
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data = nullptr;
+            TLVUnpackError       = aDataTlv.GetDataPtr(data);
+            CSRNonce             = chip::ByteSpan(data, aDataTlv.GetLength());
+        }
+        break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
-    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    if (CHIP_END_OF_TLV == TLVError)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::NetworkCommissioning::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
     }
-}
 
-} // namespace NetworkCommissioning
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterOpCSRRequestCallback(apCommandObj, CSRNonce);
+    }
 
-namespace OnOff {
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::OpCSRRequest, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchRemoveAllFabricsCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
+
+    // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+    wasHandled = emberAfOperationalCredentialsClusterRemoveAllFabricsCallback(apCommandObj);
+
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        switch (aCommandId)
-        {
-        case Clusters::OnOff::Commands::Ids::Off: {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::RemoveAllFabrics, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfOnOffClusterOffCallback(apCommandObj);
-            break;
-        }
-        case Clusters::OnOff::Commands::Ids::On: {
+void DispatchRemoveFabricCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfOnOffClusterOnCallback(apCommandObj);
-            break;
-        }
-        case Clusters::OnOff::Commands::Ids::Toggle: {
+    expectArgumentCount = 3;
+    Clusters::OperationalCredentials::Commands::RemoveFabric arguments;
 
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfOnOffClusterToggleCallback(apCommandObj);
-            break;
-        }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::OnOff::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::OnOff::Id);
-            return;
-        }
-        }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterRemoveFabricCallback(apCommandObj, arguments.FabricId, arguments.NodeId,
+                                                                              arguments.VendorId);
     }
 
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::OnOff::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::RemoveFabric, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
-} // namespace OnOff
-
-namespace OperationalCredentials {
-
-void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+void DispatchRemoveTrustedRootCertificateCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
 {
     // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
     // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
     // Any error value TLVUnpackError means we have received an illegal value.
-    // The following variables are used for all commands to save code size.
     CHIP_ERROR TLVError          = CHIP_NO_ERROR;
     CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
     uint32_t validArgumentCount  = 0;
     uint32_t expectArgumentCount = 0;
     uint32_t currentDecodeTagId  = 0;
     bool wasHandled              = false;
-    {
-        switch (aCommandId)
-        {
-        case Clusters::OperationalCredentials::Commands::Ids::AddOpCert: {
-            expectArgumentCount = 4;
-            chip::ByteSpan NOCArray;
-            chip::ByteSpan IPKValue;
-            chip::NodeId CaseAdminNode;
-            uint16_t AdminVendorId;
-            bool argExists[4];
-
-            memset(argExists, 0, sizeof argExists);
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 4)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    NOCArray             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 1: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    IPKValue             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(CaseAdminNode);
-                    break;
-                case 3:
-                    TLVUnpackError = aDataTlv.Get(AdminVendorId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    expectArgumentCount = 1;
+    chip::ByteSpan TrustedRootIdentifier;
+    bool argExists[1];
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 4 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfOperationalCredentialsClusterAddOpCertCallback(apCommandObj, NOCArray, IPKValue, CaseAdminNode,
-                                                                                   AdminVendorId);
-            }
-            break;
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
         }
-        case Clusters::OperationalCredentials::Commands::Ids::AddTrustedRootCertificate: {
-            expectArgumentCount = 1;
-            chip::ByteSpan RootCertificate;
-            bool argExists[1];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 1)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    RootCertificate      = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
                 break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
             }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfOperationalCredentialsClusterAddTrustedRootCertificateCallback(apCommandObj, RootCertificate);
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        case Clusters::OperationalCredentials::Commands::Ids::OpCSRRequest: {
-            expectArgumentCount = 1;
-            chip::ByteSpan CSRNonce;
-            bool argExists[1];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data = nullptr;
-                    TLVUnpackError       = aDataTlv.GetDataPtr(data);
-                    CSRNonce             = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfOperationalCredentialsClusterOpCSRRequestCallback(apCommandObj, CSRNonce);
-            }
-            break;
+        switch (currentDecodeTagId)
+        {
+        case 0: {
+            const uint8_t * data  = nullptr;
+            TLVUnpackError        = aDataTlv.GetDataPtr(data);
+            TrustedRootIdentifier = chip::ByteSpan(data, aDataTlv.GetLength());
         }
-        case Clusters::OperationalCredentials::Commands::Ids::RemoveAllFabrics: {
-
-            // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-            wasHandled = emberAfOperationalCredentialsClusterRemoveAllFabricsCallback(apCommandObj);
+        break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
             break;
         }
-        case Clusters::OperationalCredentials::Commands::Ids::RemoveFabric: {
-            expectArgumentCount = 3;
-            chip::FabricId FabricId;
-            chip::NodeId NodeId;
-            uint16_t VendorId;
-            bool argExists[3];
-
-            memset(argExists, 0, sizeof argExists);
-
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 3)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(FabricId);
-                    break;
-                case 1:
-                    TLVUnpackError = aDataTlv.Get(NodeId);
-                    break;
-                case 2:
-                    TLVUnpackError = aDataTlv.Get(VendorId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
-
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 3 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfOperationalCredentialsClusterRemoveFabricCallback(apCommandObj, FabricId, NodeId, VendorId);
-            }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
             break;
         }
-        case Clusters::OperationalCredentials::Commands::Ids::RemoveTrustedRootCertificate: {
-            expectArgumentCount = 1;
-            chip::ByteSpan TrustedRootIdentifier;
-            bool argExists[1];
+    }
 
-            memset(argExists, 0, sizeof argExists);
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0: {
-                    const uint8_t * data  = nullptr;
-                    TLVUnpackError        = aDataTlv.GetDataPtr(data);
-                    TrustedRootIdentifier = chip::ByteSpan(data, aDataTlv.GetLength());
-                }
-                break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterRemoveTrustedRootCertificateCallback(apCommandObj, TrustedRootIdentifier);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::RemoveTrustedRootCertificate, aEndpointId,
+                             validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfOperationalCredentialsClusterRemoveTrustedRootCertificateCallback(apCommandObj, TrustedRootIdentifier);
-            }
-            break;
-        }
-        case Clusters::OperationalCredentials::Commands::Ids::SetFabric: {
-            expectArgumentCount = 1;
-            uint16_t VendorId;
-            bool argExists[1];
+void DispatchSetFabricCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 1;
+    Clusters::OperationalCredentials::Commands::SetFabric arguments;
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    TLVUnpackError = aDataTlv.Get(VendorId);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    // The generated codec reads the arguments in a single pass when they are in order, and falls back to
+    // the generic decoding in any order otherwise.
+    TLVUnpackError = arguments.Decode(aDataTlv);
+    if (CHIP_NO_ERROR == TLVUnpackError)
+    {
+        validArgumentCount = expectArgumentCount;
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterSetFabricCallback(apCommandObj, arguments.VendorId);
+    }
 
-            if (CHIP_END_OF_TLV == TLVError)
-            {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
-            }
+    if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
+    {
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::SetFabric, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+    }
+}
 
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
-            {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled = emberAfOperationalCredentialsClusterSetFabricCallback(apCommandObj, VendorId);
-            }
-            break;
-        }
-        case Clusters::OperationalCredentials::Commands::Ids::UpdateFabricLabel: {
-            expectArgumentCount = 1;
-            const uint8_t * Label;
-            bool argExists[1];
+void DispatchUpdateFabricLabelCommand(app::Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    // We are using TLVUnpackError and TLVError here since both of them can be CHIP_END_OF_TLV
+    // When TLVError is CHIP_END_OF_TLV, it means we have iterated all of the items, which is not a real error.
+    // Any error value TLVUnpackError means we have received an illegal value.
+    CHIP_ERROR TLVError          = CHIP_NO_ERROR;
+    CHIP_ERROR TLVUnpackError    = CHIP_NO_ERROR;
+    uint32_t validArgumentCount  = 0;
+    uint32_t expectArgumentCount = 0;
+    uint32_t currentDecodeTagId  = 0;
+    bool wasHandled              = false;
 
-            memset(argExists, 0, sizeof argExists);
+    expectArgumentCount = 1;
+    const uint8_t * Label;
+    bool argExists[1];
 
-            while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
-            {
-                // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
-                // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
-                if (!TLV::IsContextTag(aDataTlv.GetTag()))
-                {
-                    continue;
-                }
-                currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
-                if (currentDecodeTagId < 1)
-                {
-                    if (argExists[currentDecodeTagId])
-                    {
-                        ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
-                        TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
-                        break;
-                    }
-                    else
-                    {
-                        argExists[currentDecodeTagId] = true;
-                        validArgumentCount++;
-                    }
-                }
-                switch (currentDecodeTagId)
-                {
-                case 0:
-                    // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
-                    TLVUnpackError = aDataTlv.GetDataPtr(Label);
-                    break;
-                default:
-                    // Unsupported tag, ignore it.
-                    ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
-                    break;
-                }
-                if (CHIP_NO_ERROR != TLVUnpackError)
-                {
-                    break;
-                }
-            }
+    memset(argExists, 0, sizeof argExists);
 
-            if (CHIP_END_OF_TLV == TLVError)
+    while ((TLVError = aDataTlv.Next()) == CHIP_NO_ERROR)
+    {
+        // Since call to aDataTlv.Next() is CHIP_NO_ERROR, the read head always points to an element.
+        // Skip this element if it is not a ContextTag, not consider it as an error if other values are valid.
+        if (!TLV::IsContextTag(aDataTlv.GetTag()))
+        {
+            continue;
+        }
+        currentDecodeTagId = TLV::TagNumFromTag(aDataTlv.GetTag());
+        if (currentDecodeTagId < 1)
+        {
+            if (argExists[currentDecodeTagId])
             {
-                // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
-                TLVError = CHIP_NO_ERROR;
+                ChipLogProgress(Zcl, "Duplicate TLV tag %" PRIx32, TLV::TagNumFromTag(aDataTlv.GetTag()));
+                TLVUnpackError = CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT;
+                break;
             }
-
-            if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+            else
             {
-                // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
-                wasHandled =
-                    emberAfOperationalCredentialsClusterUpdateFabricLabelCallback(apCommandObj, const_cast<uint8_t *>(Label));
+                argExists[currentDecodeTagId] = true;
+                validArgumentCount++;
             }
-            break;
         }
-        default: {
-            // Unrecognized command ID, error status will apply.
-            chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                               0, // GroupId
-                                                               Clusters::OperationalCredentials::Id, aCommandId,
-                                                               (chip::app::CommandPathFlags::kEndpointIdValid) };
-            apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                        Protocols::SecureChannel::Id,
-                                        Protocols::InteractionModel::ProtocolCode::UnsupportedCommand);
-            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, Clusters::OperationalCredentials::Id);
-            return;
+        switch (currentDecodeTagId)
+        {
+        case 0:
+            // TODO(#5542): The cluster handlers should accept a ByteSpan for all string types.
+            TLVUnpackError = aDataTlv.GetDataPtr(Label);
+            break;
+        default:
+            // Unsupported tag, ignore it.
+            ChipLogProgress(Zcl, "Unknown TLV tag during processing.");
+            break;
         }
+        if (CHIP_NO_ERROR != TLVUnpackError)
+        {
+            break;
         }
     }
 
+    if (CHIP_END_OF_TLV == TLVError)
+    {
+        // CHIP_END_OF_TLV means we have iterated all items in the structure, which is not a real error.
+        TLVError = CHIP_NO_ERROR;
+    }
+
+    if (CHIP_NO_ERROR == TLVError && CHIP_NO_ERROR == TLVUnpackError && 1 == validArgumentCount)
+    {
+        // TODO(#5098) We should pass the Command Object and EndpointId to the cluster callbacks.
+        wasHandled = emberAfOperationalCredentialsClusterUpdateFabricLabelCallback(apCommandObj, const_cast<uint8_t *>(Label));
+    }
+
     if (CHIP_NO_ERROR != TLVError || CHIP_NO_ERROR != TLVUnpackError || expectArgumentCount != validArgumentCount || !wasHandled)
     {
-        chip::app::CommandPathParams returnStatusParam = { aEndpointId,
-                                                           0, // GroupId
-                                                           Clusters::OperationalCredentials::Id, aCommandId,
-                                                           (chip::app::CommandPathFlags::kEndpointIdValid) };
-        apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kBadRequest,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogProgress(Zcl,
-                        "Failed to dispatch command, %" PRIu32 "/%" PRIu32 " arguments parsed, TLVError=%" CHIP_ERROR_FORMAT
-                        ", UnpackError=%" CHIP_ERROR_FORMAT " (last decoded tag = %" PRIu32,
-                        validArgumentCount, expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
+        ReportInvalidCommand(apCommandObj, Clusters::OperationalCredentials::Id,
+                             Clusters::OperationalCredentials::Commands::Ids::UpdateFabricLabel, aEndpointId, validArgumentCount,
+                             expectArgumentCount, TLVError, TLVUnpackError, currentDecodeTagId);
     }
 }
 
@@ -2149,45 +1902,108 @@ void DispatchServerCommand(app::Command * apCommandObj, CommandId aCommandId, En
 
 } // namespace clusters
 
+namespace {
+
+constexpr CommandDispatchEntry kCommandDispatchEntries[] = {
+    { Clusters::DiagnosticLogs::Id, Clusters::DiagnosticLogs::Commands::Ids::RetrieveLogsRequest,
+      clusters::DiagnosticLogs::DispatchRetrieveLogsRequestCommand },
+    { Clusters::GeneralCommissioning::Id, Clusters::GeneralCommissioning::Commands::Ids::ArmFailSafe,
+      clusters::GeneralCommissioning::DispatchArmFailSafeCommand },
+    { Clusters::GeneralCommissioning::Id, Clusters::GeneralCommissioning::Commands::Ids::CommissioningComplete,
+      clusters::GeneralCommissioning::DispatchCommissioningCompleteCommand },
+    { Clusters::GeneralCommissioning::Id, Clusters::GeneralCommissioning::Commands::Ids::SetRegulatoryConfig,
+      clusters::GeneralCommissioning::DispatchSetRegulatoryConfigCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Move, clusters::LevelControl::DispatchMoveCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveToLevel,
+      clusters::LevelControl::DispatchMoveToLevelCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveToLevelWithOnOff,
+      clusters::LevelControl::DispatchMoveToLevelWithOnOffCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::MoveWithOnOff,
+      clusters::LevelControl::DispatchMoveWithOnOffCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Step, clusters::LevelControl::DispatchStepCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::StepWithOnOff,
+      clusters::LevelControl::DispatchStepWithOnOffCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::Stop, clusters::LevelControl::DispatchStopCommand },
+    { Clusters::LevelControl::Id, Clusters::LevelControl::Commands::Ids::StopWithOnOff,
+      clusters::LevelControl::DispatchStopWithOnOffCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::AddThreadNetwork,
+      clusters::NetworkCommissioning::DispatchAddThreadNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::AddWiFiNetwork,
+      clusters::NetworkCommissioning::DispatchAddWiFiNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::DisableNetwork,
+      clusters::NetworkCommissioning::DispatchDisableNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::EnableNetwork,
+      clusters::NetworkCommissioning::DispatchEnableNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::GetLastNetworkCommissioningResult,
+      clusters::NetworkCommissioning::DispatchGetLastNetworkCommissioningResultCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::RemoveNetwork,
+      clusters::NetworkCommissioning::DispatchRemoveNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::ScanNetworks,
+      clusters::NetworkCommissioning::DispatchScanNetworksCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::UpdateThreadNetwork,
+      clusters::NetworkCommissioning::DispatchUpdateThreadNetworkCommand },
+    { Clusters::NetworkCommissioning::Id, Clusters::NetworkCommissioning::Commands::Ids::UpdateWiFiNetwork,
+      clusters::NetworkCommissioning::DispatchUpdateWiFiNetworkCommand },
+    { Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::Off, clusters::OnOff::DispatchOffCommand },
+    { Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::On, clusters::OnOff::DispatchOnCommand },
+    { Clusters::OnOff::Id, Clusters::OnOff::Commands::Ids::Toggle, clusters::OnOff::DispatchToggleCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::AddOpCert,
+      clusters::OperationalCredentials::DispatchAddOpCertCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::AddTrustedRootCertificate,
+      clusters::OperationalCredentials::DispatchAddTrustedRootCertificateCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::OpCSRRequest,
+      clusters::OperationalCredentials::DispatchOpCSRRequestCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::RemoveAllFabrics,
+      clusters::OperationalCredentials::DispatchRemoveAllFabricsCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::RemoveFabric,
+      clusters::OperationalCredentials::DispatchRemoveFabricCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::RemoveTrustedRootCertificate,
+      clusters::OperationalCredentials::DispatchRemoveTrustedRootCertificateCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::SetFabric,
+      clusters::OperationalCredentials::DispatchSetFabricCommand },
+    { Clusters::OperationalCredentials::Id, Clusters::OperationalCredentials::Commands::Ids::UpdateFabricLabel,
+      clusters::OperationalCredentials::DispatchUpdateFabricLabelCommand },
+};
+
+// Sorted by cluster and command ID at compile time, so that the handler of a command is found with a binary search.
+constexpr auto kCommandDispatchTable = MakeCommandDispatchTable(kCommandDispatchEntries);
+static_assert(kCommandDispatchTable.IsValid(), "Each command must have a single handler");
+
+} // namespace
+
 void DispatchSingleClusterCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId,
                                   chip::TLV::TLVReader & aReader, Command * apCommandObj)
 {
     ChipLogDetail(Zcl, "Received Cluster Command: Cluster=%" PRIx32 " Command=%" PRIx32 " Endpoint=%" PRIx16, aClusterId,
                   aCommandId, aEndPointId);
-    Compatibility::SetupEmberAfObjects(apCommandObj, aClusterId, aCommandId, aEndPointId);
-    TLV::TLVType dataTlvType;
-    SuccessOrExit(aReader.EnterContainer(dataTlvType));
-    switch (aClusterId)
+    CommandDispatchFunction dispatch = kCommandDispatchTable.Find(aClusterId, aCommandId);
+    if (dispatch == nullptr)
     {
-    case Clusters::DiagnosticLogs::Id:
-        clusters::DiagnosticLogs::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::GeneralCommissioning::Id:
-        clusters::GeneralCommissioning::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::LevelControl::Id:
-        clusters::LevelControl::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::NetworkCommissioning::Id:
-        clusters::NetworkCommissioning::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::OnOff::Id:
-        clusters::OnOff::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    case Clusters::OperationalCredentials::Id:
-        clusters::OperationalCredentials::DispatchServerCommand(apCommandObj, aCommandId, aEndPointId, aReader);
-        break;
-    default:
-        // Unrecognized cluster ID, error status will apply.
+        // Unrecognized cluster or command ID, error status will apply.
+        const bool clusterFound                        = kCommandDispatchTable.HasCluster(aClusterId);
         chip::app::CommandPathParams returnStatusParam = { aEndPointId,
                                                            0, // GroupId
                                                            aClusterId, aCommandId,
                                                            (chip::app::CommandPathFlags::kEndpointIdValid) };
         apCommandObj->AddStatusCode(returnStatusParam, Protocols::SecureChannel::GeneralStatusCode::kNotFound,
-                                    Protocols::SecureChannel::Id, Protocols::InteractionModel::ProtocolCode::InvalidCommand);
-        ChipLogError(Zcl, "Unknown cluster %" PRIx32, aClusterId);
-        break;
+                                    Protocols::SecureChannel::Id,
+                                    clusterFound ? Protocols::InteractionModel::ProtocolCode::UnsupportedCommand
+                                                 : Protocols::InteractionModel::ProtocolCode::InvalidCommand);
+        if (clusterFound)
+        {
+            ChipLogError(Zcl, "Unknown command %" PRIx32 " for cluster %" PRIx32, aCommandId, aClusterId);
+        }
+        else
+        {
+            ChipLogError(Zcl, "Unknown cluster %" PRIx32, aClusterId);
+        }
+        return;
     }
+
+    Compatibility::SetupEmberAfObjects(apCommandObj, aClusterId, aCommandId, aEndPointId);
+    TLV::TLVType dataTlvType;
+    SuccessOrExit(aReader.EnterContainer(dataTlvType));
+    dispatch(apCommandObj, aEndPointId, aReader);
 exit:
     Compatibility::ResetEmberAfObjects();
     aReader.ExitContainer(dataTlvType);
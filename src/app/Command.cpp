@@ -58,10 +58,9 @@ CHIP_ERROR Command::Reset()
 
     mCommandMessageWriter.Reset();
 
-    System::PacketBufferHandle commandPacket = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    VerifyOrExit(!commandPacket.IsNull(), err = CHIP_ERROR_NO_MEMORY);
+    err = mCommandMessageWriter.InitGrowable(chip::app::kMaxSecureSduLengthBytes, chip::app::kInitialMessageBufferSize);
+    SuccessOrExit(err);
 
-    mCommandMessageWriter.Init(std::move(commandPacket));
     err = mInvokeCommandBuilder.Init(&mCommandMessageWriter);
     SuccessOrExit(err);
 
@@ -232,7 +231,8 @@ CHIP_ERROR Command::FinalizeCommandsMessage(System::PacketBufferHandle & command
     err = mInvokeCommandBuilder.GetError();
     SuccessOrExit(err);
 
-    err = mCommandMessageWriter.Finalize(&commandPacket);
+    err = mCommandMessageWriter.FinalizeContiguous(&commandPacket, System::PacketBuffer::kDefaultHeaderReserve,
+                                                   chip::app::kMessageTailroomSize);
     SuccessOrExit(err);
 exit:
     ChipLogFunctError(err);
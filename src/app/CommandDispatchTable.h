@@ -0,0 +1,148 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the table of the cluster command handlers of the generated
+ *      IMClusterCommandHandler.cpp: an array of (cluster, command, handler) entries sorted at
+ *      compile time, in which the handler of a received command is found with a binary search.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <app/util/basic-types.h>
+#include <core/CHIPTLV.h>
+
+namespace chip {
+namespace app {
+
+class Command;
+
+/**
+ * A handler of a cluster command, which decodes the arguments of the command from the Data structure the reader
+ * is in, calls the cluster callback and adds a status to the command object when either fails.
+ */
+using CommandDispatchFunction = void (*)(Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv);
+
+struct CommandDispatchEntry
+{
+    ClusterId mClusterId;
+    CommandId mCommandId;
+    CommandDispatchFunction mDispatch;
+};
+
+template <size_t N>
+class CommandDispatchTable
+{
+public:
+    static_assert(N > 0, "The table must have at least one entry");
+
+    /**
+     * Copy the entries and sort them by cluster and command ID, with an insertion sort run by the compiler.
+     */
+    constexpr explicit CommandDispatchTable(const CommandDispatchEntry (&aEntries)[N]) : mKeys{}, mDispatch{}
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            const uint64_t key = Key(aEntries[i].mClusterId, aEntries[i].mCommandId);
+            size_t j           = i;
+            for (; j > 0 && key < mKeys[j - 1]; j--)
+            {
+                mKeys[j]     = mKeys[j - 1];
+                mDispatch[j] = mDispatch[j - 1];
+            }
+            mKeys[j]     = key;
+            mDispatch[j] = aEntries[i].mDispatch;
+        }
+    }
+
+    /**
+     * Whether each (cluster, command) pair has a single entry, with a handler.
+     */
+    constexpr bool IsValid() const
+    {
+        for (size_t i = 0; i < N; i++)
+        {
+            if (mDispatch[i] == nullptr || (i > 0 && mKeys[i - 1] == mKeys[i]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Find the handler of a command.
+     *
+     * @return The handler, or nullptr if the command has no entry.
+     */
+    CommandDispatchFunction Find(ClusterId aClusterId, CommandId aCommandId) const
+    {
+        const uint64_t key = Key(aClusterId, aCommandId);
+        const size_t index = LowerBound(key);
+        return (index < N && mKeys[index] == key) ? mDispatch[index] : nullptr;
+    }
+
+    /**
+     * Whether a cluster has at least one command with an entry.
+     */
+    bool HasCluster(ClusterId aClusterId) const
+    {
+        const size_t index = LowerBound(Key(aClusterId, 0));
+        return index < N && static_cast<ClusterId>(mKeys[index] >> 32) == aClusterId;
+    }
+
+private:
+    static constexpr uint64_t Key(ClusterId aClusterId, CommandId aCommandId)
+    {
+        return (static_cast<uint64_t>(aClusterId) << 32) | aCommandId;
+    }
+
+    // The index of the first key that is not less than aKey. The search halves the range without a branch on the
+    // comparison, which the compiler turns into a conditional move: the IDs of received commands are not predictable.
+    size_t LowerBound(uint64_t aKey) const
+    {
+        const uint64_t * base = mKeys;
+        size_t length         = N;
+
+        while (length > 1)
+        {
+            const size_t half = length / 2;
+            base              = (base[half] < aKey) ? base + half : base;
+            length -= half;
+        }
+        return static_cast<size_t>(base - mKeys) + ((*base < aKey) ? 1 : 0);
+    }
+
+    // The keys apart from the handlers, so that a search reads a contiguous array of integers.
+    uint64_t mKeys[N];
+    CommandDispatchFunction mDispatch[N];
+};
+
+template <size_t N>
+constexpr CommandDispatchTable<N> MakeCommandDispatchTable(const CommandDispatchEntry (&aEntries)[N])
+{
+    return CommandDispatchTable<N>(aEntries);
+}
+
+} // namespace app
+} // namespace chip
@@ -36,6 +36,7 @@
 #include <support/DLLUtil.h>
 #include <support/logging/CHIPLogging.h>
 #include <system/SystemPacketBuffer.h>
+#include <transport/SecureSessionMgr.h>
 
 #include <app/ClusterInfo.h>
 #include <app/Command.h>
@@ -63,6 +64,10 @@ namespace chip {
 namespace app {
 
 constexpr size_t kMaxSecureSduLengthBytes = 1024;
+// IM messages are encoded in packet buffers that grow on demand from this size, and handed to the secure session in a single
+// buffer with room after them for the message authentication tag.
+constexpr uint16_t kInitialMessageBufferSize = 128;
+constexpr uint16_t kMessageTailroomSize      = MessagePacketBuffer::kMaxFooterSize;
 /* TODO: https://github.com/project-chip/connectedhomeip/issues/7489 */
 constexpr uint32_t kImMessageTimeoutMsec = 12000;
 constexpr FieldId kRootFieldId           = 0;
@@ -41,7 +41,7 @@ CHIP_ERROR AttributeDataElement::Parser::Init(const chip::TLV::TLVReader & aRead
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     // make a copy of the reader here
-    mReader.Init(aReader);
+    InitReader(aReader);
 
     VerifyOrExit(chip::TLV::kTLVType_Structure == mReader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
 
@@ -356,7 +356,7 @@ CHIP_ERROR AttributeDataElement::Parser::GetAttributePath(AttributePath::Parser
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_AttributePath), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_AttributePath), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_List == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
@@ -379,7 +379,7 @@ CHIP_ERROR AttributeDataElement::Parser::GetData(chip::TLV::TLVReader * const ap
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_Data), *apReader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_Data), apReader);
     SuccessOrExit(err);
 
 exit:
@@ -392,7 +392,7 @@ CHIP_ERROR AttributeDataElement::Parser::GetStatus(uint16_t * const apStatus) co
 {
     chip::TLV::TLVReader reader;
     VerifyOrReturnError(apStatus != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
-    ReturnErrorOnFailure(mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_Status), reader));
+    ReturnErrorOnFailure(GetReaderOnTag(chip::TLV::ContextTag(kCsTag_Status), &reader));
     return reader.Get(*apStatus);
 }
 
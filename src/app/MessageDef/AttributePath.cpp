@@ -40,7 +40,7 @@ CHIP_ERROR AttributePath::Parser::Init(const chip::TLV::TLVReader & aReader)
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     // make a copy of the reader here
-    mReader.Init(aReader);
+    InitReader(aReader);
 
     VerifyOrExit(chip::TLV::kTLVType_List == mReader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
 
@@ -76,7 +76,7 @@ CHIP_ERROR AttributeStatusElement::Parser::Init(const chip::TLV::TLVReader & aRe
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     // make a copy of the reader here
-    mReader.Init(aReader);
+    InitReader(aReader);
     VerifyOrExit(chip::TLV::kTLVType_Structure == mReader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
 
     err = mReader.EnterContainer(mOuterContainerType);
@@ -170,7 +170,7 @@ CHIP_ERROR AttributeStatusElement::Parser::GetAttributePath(AttributePath::Parse
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_AttributePath), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_AttributePath), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_List == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
@@ -189,7 +189,7 @@ CHIP_ERROR AttributeStatusElement::Parser::GetStatusElement(StatusElement::Parse
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_StatusElement), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_StatusElement), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_Array == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
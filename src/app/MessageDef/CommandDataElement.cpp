@@ -41,7 +41,7 @@ CHIP_ERROR CommandDataElement::Parser::Init(const chip::TLV::TLVReader & aReader
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     // make a copy of the reader here
-    mReader.Init(aReader);
+    InitReader(aReader);
 
     VerifyOrExit(chip::TLV::kTLVType_Structure == mReader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
 
@@ -331,7 +331,7 @@ CHIP_ERROR CommandDataElement::Parser::GetCommandPath(CommandPath::Parser * cons
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_CommandPath), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_CommandPath), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_List == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
@@ -349,7 +349,7 @@ CHIP_ERROR CommandDataElement::Parser::GetData(chip::TLV::TLVReader * const apRe
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_Data), *apReader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_Data), apReader);
     SuccessOrExit(err);
 
 exit:
@@ -363,7 +363,7 @@ CHIP_ERROR CommandDataElement::Parser::GetStatusElement(StatusElement::Parser *
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_StatusElement), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_StatusElement), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_Array == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
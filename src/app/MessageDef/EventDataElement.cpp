@@ -41,7 +41,7 @@ CHIP_ERROR EventDataElement::Parser::Init(const chip::TLV::TLVReader & aReader)
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     // make a copy of the reader here
-    mReader.Init(aReader);
+    InitReader(aReader);
 
     VerifyOrExit(chip::TLV::kTLVType_Structure == mReader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
 
@@ -403,7 +403,7 @@ CHIP_ERROR EventDataElement::Parser::GetEventPath(EventPath::Parser * const apEv
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_EventPath), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_EventPath), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_List == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
@@ -451,7 +451,7 @@ CHIP_ERROR EventDataElement::Parser::GetData(chip::TLV::TLVReader * const apRead
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_Data), *apReader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_Data), apReader);
     ChipLogFunctError(err);
 
     return err;
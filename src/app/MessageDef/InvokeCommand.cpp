@@ -40,7 +40,7 @@ CHIP_ERROR InvokeCommand::Parser::Init(const chip::TLV::TLVReader & aReader)
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     // make a copy of the reader here
-    mReader.Init(aReader);
+    InitReader(aReader);
 
     VerifyOrExit(chip::TLV::kTLVType_Structure == mReader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
 
@@ -118,7 +118,7 @@ CHIP_ERROR InvokeCommand::Parser::GetCommandList(CommandList::Parser * const apC
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_CommandList), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_CommandList), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_Array == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
@@ -39,7 +39,7 @@ CHIP_ERROR ListParser::Init(const chip::TLV::TLVReader & aReader)
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     // make a copy of the reader here
-    mReader.Init(aReader);
+    InitReader(aReader);
 
     VerifyOrExit(chip::TLV::kTLVType_Array == mReader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
 
@@ -56,7 +56,7 @@ CHIP_ERROR ListParser::InitIfPresent(const chip::TLV::TLVReader & aReader, const
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(aContextTagToFind), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(aContextTagToFind), &reader);
     SuccessOrExit(err);
 
     err = Init(reader);
@@ -37,13 +37,91 @@ Parser::Parser() : mOuterContainerType(chip::TLV::kTLVType_NotSpecified) {}
 
 void Parser::Init(const chip::TLV::TLVReader & aReader, chip::TLV::TLVType aOuterContainerType)
 {
-    mReader.Init(aReader);
+    InitReader(aReader);
     mOuterContainerType = aOuterContainerType;
 }
 
+void Parser::InitReader(const chip::TLV::TLVReader & aReader)
+{
+    mReader.Init(aReader);
+    mTagIndexValid = false;
+}
+
 CHIP_ERROR Parser::GetReaderOnTag(const uint64_t aTagToFind, chip::TLV::TLVReader * const apReader) const
 {
-    return mReader.FindElementWithTag(aTagToFind, *apReader);
+    if (!IsContextTag(aTagToFind) || TagNumFromTag(aTagToFind) >= kMaxIndexedTags)
+    {
+        return mReader.FindElementWithTag(aTagToFind, *apReader);
+    }
+
+    if (!mTagIndexValid || mTagIndexLengthRead != mReader.GetLengthRead())
+    {
+        ResetTagIndex();
+    }
+
+    const uint32_t offset = mTagOffsets[TagNumFromTag(aTagToFind)];
+    if (offset != kNoOffset)
+    {
+        apReader->Init(mReader);
+        return apReader->SeekToElement(offset);
+    }
+
+    VerifyOrReturnError(!mScanComplete, CHIP_END_OF_TLV);
+
+    return ScanForTag(aTagToFind, *apReader);
+}
+
+void Parser::ResetTagIndex() const
+{
+    for (uint32_t & offset : mTagOffsets)
+    {
+        offset = kNoOffset;
+    }
+
+    mScanOffset         = kNoOffset;
+    mTagIndexLengthRead = mReader.GetLengthRead();
+    mTagIndexValid      = true;
+    mScanComplete       = false;
+}
+
+CHIP_ERROR Parser::ScanForTag(const uint64_t aTagToFind, chip::TLV::TLVReader & aReader) const
+{
+    aReader.Init(mReader);
+
+    if (mScanOffset != kNoOffset)
+    {
+        // Resume the scan on the last element that was indexed.
+        ReturnErrorOnFailure(aReader.SeekToElement(mScanOffset));
+    }
+
+    while (true)
+    {
+        // Skip the current element first, so that the length read is the offset of the next one.
+        ReturnErrorOnFailure(aReader.Skip());
+
+        const uint32_t offset = aReader.GetLengthRead();
+
+        CHIP_ERROR err = aReader.Next();
+        if (err == CHIP_END_OF_TLV)
+        {
+            mScanComplete = true;
+        }
+        ReturnErrorOnFailure(err);
+        VerifyOrReturnError(kTLVType_NotSpecified != aReader.GetType(), CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+        mScanOffset = offset;
+
+        // Only the first element with a given tag is indexed, as only that one is found by FindElementWithTag().
+        const uint64_t tag = aReader.GetTag();
+        if (IsContextTag(tag) && TagNumFromTag(tag) < kMaxIndexedTags && mTagOffsets[TagNumFromTag(tag)] == kNoOffset)
+        {
+            mTagOffsets[TagNumFromTag(tag)] = offset;
+            if (tag == aTagToFind)
+            {
+                return CHIP_NO_ERROR;
+            }
+        }
+    }
 }
 
 void Parser::GetReader(chip::TLV::TLVReader * const apReader)
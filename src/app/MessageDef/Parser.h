@@ -46,6 +46,9 @@ public:
     /**
      *  @brief Initialize a TLVReader to point to the beginning of any tagged element in this request
      *
+     *  The offsets of the context tagged elements are recorded as the container is scanned, so that
+     *  looking up several tags of the same container does not scan it again from its beginning.
+     *
      *  @param [in]  aTagToFind Tag to find in the request
      *  @param [out] apReader   A pointer to TLVReader, which will be initialized at the specified TLV element
      *                          on success
@@ -67,6 +70,14 @@ protected:
     chip::TLV::TLVType mOuterContainerType;
     Parser();
 
+    /**
+     *  @brief Initialize the TLVReader of the parser, and forget the tag index of the previous container
+     *
+     *  @param [in] aReader TLVReader
+     *
+     */
+    void InitReader(const chip::TLV::TLVReader & aReader);
+
     template <typename T>
     CHIP_ERROR GetUnsignedInteger(const uint8_t aContextTag, T * const apLValue) const
     {
@@ -81,7 +92,7 @@ protected:
 
         *apLValue = 0;
 
-        err = mReader.FindElementWithTag(chip::TLV::ContextTag(aContextTag), reader);
+        err = GetReaderOnTag(chip::TLV::ContextTag(aContextTag), &reader);
         SuccessOrExit(err);
 
         VerifyOrExit(aTLVType == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
@@ -94,6 +105,24 @@ protected:
 
         return err;
     };
+
+private:
+    // The context tags of all the MessageDef containers are small, so the offsets of their elements are
+    // kept in a fixed array indexed by tag number.
+    static constexpr uint8_t kMaxIndexedTags = 8;
+    static constexpr uint32_t kNoOffset      = UINT32_MAX;
+
+    void ResetTagIndex() const;
+    CHIP_ERROR ScanForTag(const uint64_t aTagToFind, chip::TLV::TLVReader & aReader) const;
+
+    // The container is scanned at most once, in order, as far as the tags looked up require. The index
+    // holds the offsets of the elements found so far, and the offset of the last one from which the scan
+    // resumes. It is only valid for the position of mReader when it was started.
+    mutable uint32_t mTagOffsets[kMaxIndexedTags];
+    mutable uint32_t mScanOffset         = kNoOffset;
+    mutable uint32_t mTagIndexLengthRead = 0;
+    mutable bool mTagIndexValid          = false;
+    mutable bool mScanComplete           = false;
 };
 }; // namespace app
 }; // namespace chip
@@ -38,7 +38,7 @@ CHIP_ERROR ReadRequest::Parser::Init(const chip::TLV::TLVReader & aReader)
     CHIP_ERROR err = CHIP_NO_ERROR;
 
     // make a copy of the reader here
-    mReader.Init(aReader);
+    InitReader(aReader);
 
     VerifyOrExit(chip::TLV::kTLVType_Structure == mReader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
 
@@ -168,7 +168,7 @@ CHIP_ERROR ReadRequest::Parser::GetAttributePathList(AttributePathList::Parser *
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_AttributePathList), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_AttributePathList), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_Array == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
@@ -187,7 +187,7 @@ CHIP_ERROR ReadRequest::Parser::GetEventPathList(EventPathList::Parser * const a
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_EventPathList), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_EventPathList), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_Array == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
@@ -207,7 +207,7 @@ ReadRequest::Parser::GetAttributeDataVersionList(AttributeDataVersionList::Parse
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_AttributeDataVersionList), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_AttributeDataVersionList), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_Array == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
@@ -37,7 +37,7 @@ CHIP_ERROR WriteRequest::Parser::Init(const chip::TLV::TLVReader & aReader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    mReader.Init(aReader);
+    InitReader(aReader);
 
     VerifyOrExit(chip::TLV::kTLVType_Structure == mReader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
 
@@ -153,7 +153,7 @@ CHIP_ERROR WriteRequest::Parser::GetAttributeDataList(AttributeDataList::Parser
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_AttributeDataList), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_AttributeDataList), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_Array == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
@@ -173,7 +173,7 @@ WriteRequest::Parser::GetAttributeDataVersionList(AttributeDataVersionList::Pars
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::TLV::TLVReader reader;
 
-    err = mReader.FindElementWithTag(chip::TLV::ContextTag(kCsTag_AttributeDataVersionList), reader);
+    err = GetReaderOnTag(chip::TLV::ContextTag(kCsTag_AttributeDataVersionList), &reader);
     SuccessOrExit(err);
 
     VerifyOrExit(chip::TLV::kTLVType_Array == reader.GetType(), err = CHIP_ERROR_WRONG_TLV_TYPE);
@@ -101,10 +101,8 @@ CHIP_ERROR ReadClient::SendReadRequest(NodeId aNodeId, Transport::AdminId aAdmin
         System::PacketBufferTLVWriter writer;
         ReadRequest::Builder request;
 
-        msgBuf = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
-        VerifyOrExit(!msgBuf.IsNull(), err = CHIP_ERROR_NO_MEMORY);
-
-        writer.Init(std::move(msgBuf));
+        err = writer.InitGrowable(kMaxSecureSduLengthBytes, kInitialMessageBufferSize);
+        SuccessOrExit(err);
 
         err = request.Init(&writer);
         SuccessOrExit(err);
@@ -124,7 +122,7 @@ CHIP_ERROR ReadClient::SendReadRequest(NodeId aNodeId, Transport::AdminId aAdmin
         request.EndOfReadRequest();
         SuccessOrExit(err = request.GetError());
 
-        err = writer.Finalize(&msgBuf);
+        err = writer.FinalizeContiguous(&msgBuf, System::PacketBuffer::kDefaultHeaderReserve, kMessageTailroomSize);
         SuccessOrExit(err);
     }
 
@@ -36,10 +36,7 @@ CHIP_ERROR WriteClient::Init(Messaging::ExchangeManager * apExchangeMgr, Interac
     VerifyOrReturnError(mpExchangeCtx == nullptr, CHIP_ERROR_INCORRECT_STATE);
 
     AttributeDataList::Builder attributeDataListBuilder;
-    System::PacketBufferHandle packet = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
-
-    mMessageWriter.Init(std::move(packet));
+    ReturnErrorOnFailure(mMessageWriter.InitGrowable(chip::app::kMaxSecureSduLengthBytes, chip::app::kInitialMessageBufferSize));
 
     ReturnErrorOnFailure(mWriteRequestBuilder.Init(&mMessageWriter));
 
@@ -200,7 +197,7 @@ CHIP_ERROR WriteClient::FinalizeMessage(System::PacketBufferHandle & aPacket)
     err = mWriteRequestBuilder.GetError();
     SuccessOrExit(err);
 
-    err = mMessageWriter.Finalize(&aPacket);
+    err = mMessageWriter.FinalizeContiguous(&aPacket, System::PacketBuffer::kDefaultHeaderReserve, kMessageTailroomSize);
     SuccessOrExit(err);
 
 exit:
@@ -31,10 +31,7 @@ CHIP_ERROR WriteHandler::Init(InteractionModelDelegate * apDelegate)
     mpExchangeCtx = nullptr;
     mpDelegate    = apDelegate;
 
-    System::PacketBufferHandle packet = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
-
-    mMessageWriter.Init(std::move(packet));
+    ReturnErrorOnFailure(mMessageWriter.InitGrowable(chip::app::kMaxSecureSduLengthBytes, chip::app::kInitialMessageBufferSize));
     ReturnErrorOnFailure(mWriteResponseBuilder.Init(&mMessageWriter));
 
     AttributeStatusList::Builder attributeStatusListBuilder = mWriteResponseBuilder.CreateAttributeStatusListBuilder();
@@ -91,7 +88,7 @@ CHIP_ERROR WriteHandler::FinalizeMessage(System::PacketBufferHandle & packet)
     err = mWriteResponseBuilder.GetError();
     SuccessOrExit(err);
 
-    err = mMessageWriter.Finalize(&packet);
+    err = mMessageWriter.FinalizeContiguous(&packet, System::PacketBuffer::kDefaultHeaderReserve, kMessageTailroomSize);
     SuccessOrExit(err);
 
 exit:
@@ -0,0 +1,3393 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+// THIS FILE IS GENERATED BY ZAP
+
+// Codecs of the arguments of the commands whose arguments are all integers, generated from their schema with
+// core/CHIPTLVSchema.h. Encode() writes the arguments in the Data structure of a command, and Decode() reads them
+// from it, in a single pass when they are in order.
+
+#pragma once
+
+#include <tuple>
+
+#include <app/common/gen/ids/Commands.h>
+#include <app/util/basic-types.h>
+#include <core/CHIPTLV.h>
+#include <core/CHIPTLVSchema.h>
+
+namespace chip {
+namespace app {
+namespace Clusters {
+
+namespace Identify {
+namespace Commands {
+
+struct Identify
+{
+    static constexpr CommandId kId = Ids::Identify;
+
+    uint16_t identifyTime;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(identifyTime)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(identifyTime)); }
+};
+
+} // namespace Commands
+} // namespace Identify
+
+namespace Identify {
+namespace Commands {
+
+struct IdentifyQueryResponse
+{
+    static constexpr CommandId kId = Ids::IdentifyQueryResponse;
+
+    uint16_t timeout;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(timeout)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(timeout)); }
+};
+
+} // namespace Commands
+} // namespace Identify
+
+namespace Identify {
+namespace Commands {
+
+struct EZModeInvoke
+{
+    static constexpr CommandId kId = Ids::EZModeInvoke;
+
+    uint8_t action;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(action)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(action)); }
+};
+
+} // namespace Commands
+} // namespace Identify
+
+namespace Identify {
+namespace Commands {
+
+struct UpdateCommissionState
+{
+    static constexpr CommandId kId = Ids::UpdateCommissionState;
+
+    uint8_t action;
+    uint8_t commissionStateMask;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(action, commissionStateMask));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(action, commissionStateMask)); }
+};
+
+} // namespace Commands
+} // namespace Identify
+
+namespace Identify {
+namespace Commands {
+
+struct TriggerEffect
+{
+    static constexpr CommandId kId = Ids::TriggerEffect;
+
+    uint8_t effectId;
+    uint8_t effectVariant;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(effectId, effectVariant));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(effectId, effectVariant)); }
+};
+
+} // namespace Commands
+} // namespace Identify
+
+namespace Groups {
+namespace Commands {
+
+struct AddGroupResponse
+{
+    static constexpr CommandId kId = Ids::AddGroupResponse;
+
+    uint8_t status;
+    uint16_t groupId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status, groupId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status, groupId)); }
+};
+
+} // namespace Commands
+} // namespace Groups
+
+namespace Groups {
+namespace Commands {
+
+struct ViewGroup
+{
+    static constexpr CommandId kId = Ids::ViewGroup;
+
+    uint16_t groupId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(groupId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(groupId)); }
+};
+
+} // namespace Commands
+} // namespace Groups
+
+namespace Groups {
+namespace Commands {
+
+struct RemoveGroup
+{
+    static constexpr CommandId kId = Ids::RemoveGroup;
+
+    uint16_t groupId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(groupId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(groupId)); }
+};
+
+} // namespace Commands
+} // namespace Groups
+
+namespace Groups {
+namespace Commands {
+
+struct RemoveGroupResponse
+{
+    static constexpr CommandId kId = Ids::RemoveGroupResponse;
+
+    uint8_t status;
+    uint16_t groupId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status, groupId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status, groupId)); }
+};
+
+} // namespace Commands
+} // namespace Groups
+
+namespace Scenes {
+namespace Commands {
+
+struct AddSceneResponse
+{
+    static constexpr CommandId kId = Ids::AddSceneResponse;
+
+    uint8_t status;
+    uint16_t groupId;
+    uint8_t sceneId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(status, groupId, sceneId));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status, groupId, sceneId)); }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct ViewScene
+{
+    static constexpr CommandId kId = Ids::ViewScene;
+
+    uint16_t groupId;
+    uint8_t sceneId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(groupId, sceneId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(groupId, sceneId)); }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct RemoveScene
+{
+    static constexpr CommandId kId = Ids::RemoveScene;
+
+    uint16_t groupId;
+    uint8_t sceneId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(groupId, sceneId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(groupId, sceneId)); }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct RemoveSceneResponse
+{
+    static constexpr CommandId kId = Ids::RemoveSceneResponse;
+
+    uint8_t status;
+    uint16_t groupId;
+    uint8_t sceneId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(status, groupId, sceneId));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status, groupId, sceneId)); }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct RemoveAllScenes
+{
+    static constexpr CommandId kId = Ids::RemoveAllScenes;
+
+    uint16_t groupId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(groupId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(groupId)); }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct RemoveAllScenesResponse
+{
+    static constexpr CommandId kId = Ids::RemoveAllScenesResponse;
+
+    uint8_t status;
+    uint16_t groupId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status, groupId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status, groupId)); }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct StoreScene
+{
+    static constexpr CommandId kId = Ids::StoreScene;
+
+    uint16_t groupId;
+    uint8_t sceneId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(groupId, sceneId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(groupId, sceneId)); }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct StoreSceneResponse
+{
+    static constexpr CommandId kId = Ids::StoreSceneResponse;
+
+    uint8_t status;
+    uint16_t groupId;
+    uint8_t sceneId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(status, groupId, sceneId));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status, groupId, sceneId)); }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct RecallScene
+{
+    static constexpr CommandId kId = Ids::RecallScene;
+
+    uint16_t groupId;
+    uint8_t sceneId;
+    uint16_t transitionTime;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(groupId, sceneId, transitionTime));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(groupId, sceneId, transitionTime));
+    }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct GetSceneMembership
+{
+    static constexpr CommandId kId = Ids::GetSceneMembership;
+
+    uint16_t groupId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(groupId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(groupId)); }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct EnhancedAddSceneResponse
+{
+    static constexpr CommandId kId = Ids::EnhancedAddSceneResponse;
+
+    uint8_t status;
+    uint16_t groupId;
+    uint8_t sceneId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(status, groupId, sceneId));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status, groupId, sceneId)); }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct EnhancedViewScene
+{
+    static constexpr CommandId kId = Ids::EnhancedViewScene;
+
+    uint16_t groupId;
+    uint8_t sceneId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(groupId, sceneId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(groupId, sceneId)); }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct CopyScene
+{
+    static constexpr CommandId kId = Ids::CopyScene;
+
+    uint8_t mode;
+    uint16_t groupIdFrom;
+    uint8_t sceneIdFrom;
+    uint16_t groupIdTo;
+    uint8_t sceneIdTo;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(mode, groupIdFrom, sceneIdFrom, groupIdTo, sceneIdTo));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(mode, groupIdFrom, sceneIdFrom, groupIdTo, sceneIdTo));
+    }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace Scenes {
+namespace Commands {
+
+struct CopySceneResponse
+{
+    static constexpr CommandId kId = Ids::CopySceneResponse;
+
+    uint8_t status;
+    uint16_t groupIdFrom;
+    uint8_t sceneIdFrom;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(status, groupIdFrom, sceneIdFrom));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(status, groupIdFrom, sceneIdFrom));
+    }
+};
+
+} // namespace Commands
+} // namespace Scenes
+
+namespace OnOff {
+namespace Commands {
+
+struct OffWithEffect
+{
+    static constexpr CommandId kId = Ids::OffWithEffect;
+
+    uint8_t effectId;
+    uint8_t effectVariant;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(effectId, effectVariant));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(effectId, effectVariant)); }
+};
+
+} // namespace Commands
+} // namespace OnOff
+
+namespace OnOff {
+namespace Commands {
+
+struct OnWithTimedOff
+{
+    static constexpr CommandId kId = Ids::OnWithTimedOff;
+
+    uint8_t onOffControl;
+    uint16_t onTime;
+    uint16_t offWaitTime;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(onOffControl, onTime, offWaitTime));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(onOffControl, onTime, offWaitTime));
+    }
+};
+
+} // namespace Commands
+} // namespace OnOff
+
+namespace LevelControl {
+namespace Commands {
+
+struct MoveToLevel
+{
+    static constexpr CommandId kId = Ids::MoveToLevel;
+
+    uint8_t level;
+    uint16_t transitionTime;
+    uint8_t optionMask;
+    uint8_t optionOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(level, transitionTime, optionMask, optionOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(level, transitionTime, optionMask, optionOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace LevelControl
+
+namespace LevelControl {
+namespace Commands {
+
+struct Move
+{
+    static constexpr CommandId kId = Ids::Move;
+
+    uint8_t moveMode;
+    uint8_t rate;
+    uint8_t optionMask;
+    uint8_t optionOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(moveMode, rate, optionMask, optionOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(moveMode, rate, optionMask, optionOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace LevelControl
+
+namespace LevelControl {
+namespace Commands {
+
+struct Step
+{
+    static constexpr CommandId kId = Ids::Step;
+
+    uint8_t stepMode;
+    uint8_t stepSize;
+    uint16_t transitionTime;
+    uint8_t optionMask;
+    uint8_t optionOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(stepMode, stepSize, transitionTime, optionMask, optionOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(stepMode, stepSize, transitionTime, optionMask, optionOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace LevelControl
+
+namespace LevelControl {
+namespace Commands {
+
+struct Stop
+{
+    static constexpr CommandId kId = Ids::Stop;
+
+    uint8_t optionMask;
+    uint8_t optionOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(optionMask, optionOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(optionMask, optionOverride)); }
+};
+
+} // namespace Commands
+} // namespace LevelControl
+
+namespace LevelControl {
+namespace Commands {
+
+struct MoveToLevelWithOnOff
+{
+    static constexpr CommandId kId = Ids::MoveToLevelWithOnOff;
+
+    uint8_t level;
+    uint16_t transitionTime;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(level, transitionTime)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(level, transitionTime)); }
+};
+
+} // namespace Commands
+} // namespace LevelControl
+
+namespace LevelControl {
+namespace Commands {
+
+struct MoveWithOnOff
+{
+    static constexpr CommandId kId = Ids::MoveWithOnOff;
+
+    uint8_t moveMode;
+    uint8_t rate;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(moveMode, rate)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(moveMode, rate)); }
+};
+
+} // namespace Commands
+} // namespace LevelControl
+
+namespace LevelControl {
+namespace Commands {
+
+struct StepWithOnOff
+{
+    static constexpr CommandId kId = Ids::StepWithOnOff;
+
+    uint8_t stepMode;
+    uint8_t stepSize;
+    uint16_t transitionTime;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(stepMode, stepSize, transitionTime));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(stepMode, stepSize, transitionTime));
+    }
+};
+
+} // namespace Commands
+} // namespace LevelControl
+
+namespace Alarms {
+namespace Commands {
+
+struct ResetAlarm
+{
+    static constexpr CommandId kId = Ids::ResetAlarm;
+
+    uint8_t alarmCode;
+    chip::ClusterId clusterId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(alarmCode, clusterId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(alarmCode, clusterId)); }
+};
+
+} // namespace Commands
+} // namespace Alarms
+
+namespace Alarms {
+namespace Commands {
+
+struct Alarm
+{
+    static constexpr CommandId kId = Ids::Alarm;
+
+    uint8_t alarmCode;
+    chip::ClusterId clusterId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(alarmCode, clusterId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(alarmCode, clusterId)); }
+};
+
+} // namespace Commands
+} // namespace Alarms
+
+namespace Alarms {
+namespace Commands {
+
+struct GetAlarmResponse
+{
+    static constexpr CommandId kId = Ids::GetAlarmResponse;
+
+    uint8_t status;
+    uint8_t alarmCode;
+    chip::ClusterId clusterId;
+    uint32_t timeStamp;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(status, alarmCode, clusterId, timeStamp));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(status, alarmCode, clusterId, timeStamp));
+    }
+};
+
+} // namespace Commands
+} // namespace Alarms
+
+namespace PowerProfile {
+namespace Commands {
+
+struct PowerProfileRequest
+{
+    static constexpr CommandId kId = Ids::PowerProfileRequest;
+
+    uint8_t powerProfileId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(powerProfileId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(powerProfileId)); }
+};
+
+} // namespace Commands
+} // namespace PowerProfile
+
+namespace PowerProfile {
+namespace Commands {
+
+struct GetPowerProfilePriceResponse
+{
+    static constexpr CommandId kId = Ids::GetPowerProfilePriceResponse;
+
+    uint8_t powerProfileId;
+    uint16_t currency;
+    uint32_t price;
+    uint8_t priceTrailingDigit;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(powerProfileId, currency, price, priceTrailingDigit));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(powerProfileId, currency, price, priceTrailingDigit));
+    }
+};
+
+} // namespace Commands
+} // namespace PowerProfile
+
+namespace PowerProfile {
+namespace Commands {
+
+struct GetOverallSchedulePriceResponse
+{
+    static constexpr CommandId kId = Ids::GetOverallSchedulePriceResponse;
+
+    uint16_t currency;
+    uint32_t price;
+    uint8_t priceTrailingDigit;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(currency, price, priceTrailingDigit));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(currency, price, priceTrailingDigit));
+    }
+};
+
+} // namespace Commands
+} // namespace PowerProfile
+
+namespace PowerProfile {
+namespace Commands {
+
+struct GetPowerProfilePrice
+{
+    static constexpr CommandId kId = Ids::GetPowerProfilePrice;
+
+    uint8_t powerProfileId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(powerProfileId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(powerProfileId)); }
+};
+
+} // namespace Commands
+} // namespace PowerProfile
+
+namespace PowerProfile {
+namespace Commands {
+
+struct PowerProfileScheduleConstraintsRequest
+{
+    static constexpr CommandId kId = Ids::PowerProfileScheduleConstraintsRequest;
+
+    uint8_t powerProfileId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(powerProfileId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(powerProfileId)); }
+};
+
+} // namespace Commands
+} // namespace PowerProfile
+
+namespace PowerProfile {
+namespace Commands {
+
+struct EnergyPhasesScheduleRequest
+{
+    static constexpr CommandId kId = Ids::EnergyPhasesScheduleRequest;
+
+    uint8_t powerProfileId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(powerProfileId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(powerProfileId)); }
+};
+
+} // namespace Commands
+} // namespace PowerProfile
+
+namespace PowerProfile {
+namespace Commands {
+
+struct EnergyPhasesScheduleStateRequest
+{
+    static constexpr CommandId kId = Ids::EnergyPhasesScheduleStateRequest;
+
+    uint8_t powerProfileId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(powerProfileId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(powerProfileId)); }
+};
+
+} // namespace Commands
+} // namespace PowerProfile
+
+namespace PowerProfile {
+namespace Commands {
+
+struct GetPowerProfilePriceExtendedResponse
+{
+    static constexpr CommandId kId = Ids::GetPowerProfilePriceExtendedResponse;
+
+    uint8_t powerProfileId;
+    uint16_t currency;
+    uint32_t price;
+    uint8_t priceTrailingDigit;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(powerProfileId, currency, price, priceTrailingDigit));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(powerProfileId, currency, price, priceTrailingDigit));
+    }
+};
+
+} // namespace Commands
+} // namespace PowerProfile
+
+namespace PowerProfile {
+namespace Commands {
+
+struct PowerProfileScheduleConstraintsNotification
+{
+    static constexpr CommandId kId = Ids::PowerProfileScheduleConstraintsNotification;
+
+    uint8_t powerProfileId;
+    uint16_t startAfter;
+    uint16_t stopBefore;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(powerProfileId, startAfter, stopBefore));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(powerProfileId, startAfter, stopBefore));
+    }
+};
+
+} // namespace Commands
+} // namespace PowerProfile
+
+namespace PowerProfile {
+namespace Commands {
+
+struct PowerProfileScheduleConstraintsResponse
+{
+    static constexpr CommandId kId = Ids::PowerProfileScheduleConstraintsResponse;
+
+    uint8_t powerProfileId;
+    uint16_t startAfter;
+    uint16_t stopBefore;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(powerProfileId, startAfter, stopBefore));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(powerProfileId, startAfter, stopBefore));
+    }
+};
+
+} // namespace Commands
+} // namespace PowerProfile
+
+namespace PowerProfile {
+namespace Commands {
+
+struct GetPowerProfilePriceExtended
+{
+    static constexpr CommandId kId = Ids::GetPowerProfilePriceExtended;
+
+    uint8_t options;
+    uint8_t powerProfileId;
+    uint16_t powerProfileStartTime;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(options, powerProfileId, powerProfileStartTime));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(options, powerProfileId, powerProfileStartTime));
+    }
+};
+
+} // namespace Commands
+} // namespace PowerProfile
+
+namespace ApplianceControl {
+namespace Commands {
+
+struct ExecutionOfACommand
+{
+    static constexpr CommandId kId = Ids::ExecutionOfACommand;
+
+    uint8_t commandId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(commandId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(commandId)); }
+};
+
+} // namespace Commands
+} // namespace ApplianceControl
+
+namespace ApplianceControl {
+namespace Commands {
+
+struct SignalStateResponse
+{
+    static constexpr CommandId kId = Ids::SignalStateResponse;
+
+    uint8_t applianceStatus;
+    uint8_t remoteEnableFlagsAndDeviceStatus2;
+    uint32_t applianceStatus2;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(applianceStatus, remoteEnableFlagsAndDeviceStatus2, applianceStatus2));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(applianceStatus, remoteEnableFlagsAndDeviceStatus2, applianceStatus2));
+    }
+};
+
+} // namespace Commands
+} // namespace ApplianceControl
+
+namespace ApplianceControl {
+namespace Commands {
+
+struct SignalStateNotification
+{
+    static constexpr CommandId kId = Ids::SignalStateNotification;
+
+    uint8_t applianceStatus;
+    uint8_t remoteEnableFlagsAndDeviceStatus2;
+    uint32_t applianceStatus2;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(applianceStatus, remoteEnableFlagsAndDeviceStatus2, applianceStatus2));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(applianceStatus, remoteEnableFlagsAndDeviceStatus2, applianceStatus2));
+    }
+};
+
+} // namespace Commands
+} // namespace ApplianceControl
+
+namespace ApplianceControl {
+namespace Commands {
+
+struct OverloadWarning
+{
+    static constexpr CommandId kId = Ids::OverloadWarning;
+
+    uint8_t warningEvent;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(warningEvent)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(warningEvent)); }
+};
+
+} // namespace Commands
+} // namespace ApplianceControl
+
+namespace PollControl {
+namespace Commands {
+
+struct CheckInResponse
+{
+    static constexpr CommandId kId = Ids::CheckInResponse;
+
+    uint8_t startFastPolling;
+    uint16_t fastPollTimeout;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(startFastPolling, fastPollTimeout));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(startFastPolling, fastPollTimeout));
+    }
+};
+
+} // namespace Commands
+} // namespace PollControl
+
+namespace PollControl {
+namespace Commands {
+
+struct SetLongPollInterval
+{
+    static constexpr CommandId kId = Ids::SetLongPollInterval;
+
+    uint32_t newLongPollInterval;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(newLongPollInterval)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(newLongPollInterval)); }
+};
+
+} // namespace Commands
+} // namespace PollControl
+
+namespace PollControl {
+namespace Commands {
+
+struct SetShortPollInterval
+{
+    static constexpr CommandId kId = Ids::SetShortPollInterval;
+
+    uint16_t newShortPollInterval;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(newShortPollInterval)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(newShortPollInterval)); }
+};
+
+} // namespace Commands
+} // namespace PollControl
+
+namespace OtaSoftwareUpdateProvider {
+namespace Commands {
+
+struct ApplyUpdateRequestResponse
+{
+    static constexpr CommandId kId = Ids::ApplyUpdateRequestResponse;
+
+    uint8_t action;
+    uint32_t delayedActionTime;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(action, delayedActionTime));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(action, delayedActionTime)); }
+};
+
+} // namespace Commands
+} // namespace OtaSoftwareUpdateProvider
+
+namespace GeneralCommissioning {
+namespace Commands {
+
+struct ArmFailSafe
+{
+    static constexpr CommandId kId = Ids::ArmFailSafe;
+
+    uint16_t expiryLengthSeconds;
+    uint64_t breadcrumb;
+    uint32_t timeoutMs;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(expiryLengthSeconds, breadcrumb, timeoutMs));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(expiryLengthSeconds, breadcrumb, timeoutMs));
+    }
+};
+
+} // namespace Commands
+} // namespace GeneralCommissioning
+
+namespace NetworkCommissioning {
+namespace Commands {
+
+struct GetLastNetworkCommissioningResult
+{
+    static constexpr CommandId kId = Ids::GetLastNetworkCommissioningResult;
+
+    uint32_t timeoutMs;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(timeoutMs)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(timeoutMs)); }
+};
+
+} // namespace Commands
+} // namespace NetworkCommissioning
+
+namespace OperationalCredentials {
+namespace Commands {
+
+struct SetFabric
+{
+    static constexpr CommandId kId = Ids::SetFabric;
+
+    uint16_t VendorId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(VendorId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(VendorId)); }
+};
+
+} // namespace Commands
+} // namespace OperationalCredentials
+
+namespace OperationalCredentials {
+namespace Commands {
+
+struct SetFabricResponse
+{
+    static constexpr CommandId kId = Ids::SetFabricResponse;
+
+    chip::FabricId FabricId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(FabricId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(FabricId)); }
+};
+
+} // namespace Commands
+} // namespace OperationalCredentials
+
+namespace OperationalCredentials {
+namespace Commands {
+
+struct RemoveFabric
+{
+    static constexpr CommandId kId = Ids::RemoveFabric;
+
+    chip::FabricId FabricId;
+    chip::NodeId NodeId;
+    uint16_t VendorId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(FabricId, NodeId, VendorId));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(FabricId, NodeId, VendorId)); }
+};
+
+} // namespace Commands
+} // namespace OperationalCredentials
+
+namespace DoorLock {
+namespace Commands {
+
+struct LockDoorResponse
+{
+    static constexpr CommandId kId = Ids::LockDoorResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct UnlockDoorResponse
+{
+    static constexpr CommandId kId = Ids::UnlockDoorResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ToggleResponse
+{
+    static constexpr CommandId kId = Ids::ToggleResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct UnlockWithTimeoutResponse
+{
+    static constexpr CommandId kId = Ids::UnlockWithTimeoutResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetLogRecord
+{
+    static constexpr CommandId kId = Ids::GetLogRecord;
+
+    uint16_t logIndex;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(logIndex)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(logIndex)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetPinResponse
+{
+    static constexpr CommandId kId = Ids::SetPinResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetPin
+{
+    static constexpr CommandId kId = Ids::GetPin;
+
+    uint16_t userId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(userId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(userId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearPin
+{
+    static constexpr CommandId kId = Ids::ClearPin;
+
+    uint16_t userId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(userId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(userId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearPinResponse
+{
+    static constexpr CommandId kId = Ids::ClearPinResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearAllPinsResponse
+{
+    static constexpr CommandId kId = Ids::ClearAllPinsResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetUserStatus
+{
+    static constexpr CommandId kId = Ids::SetUserStatus;
+
+    uint16_t userId;
+    uint8_t userStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(userId, userStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(userId, userStatus)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetUserStatusResponse
+{
+    static constexpr CommandId kId = Ids::SetUserStatusResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetUserStatus
+{
+    static constexpr CommandId kId = Ids::GetUserStatus;
+
+    uint16_t userId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(userId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(userId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetUserStatusResponse
+{
+    static constexpr CommandId kId = Ids::GetUserStatusResponse;
+
+    uint16_t userId;
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(userId, status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(userId, status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetWeekdaySchedule
+{
+    static constexpr CommandId kId = Ids::SetWeekdaySchedule;
+
+    uint8_t scheduleId;
+    uint16_t userId;
+    uint8_t daysMask;
+    uint8_t startHour;
+    uint8_t startMinute;
+    uint8_t endHour;
+    uint8_t endMinute;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer,
+                                         std::tie(scheduleId, userId, daysMask, startHour, startMinute, endHour, endMinute));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader,
+                                         std::tie(scheduleId, userId, daysMask, startHour, startMinute, endHour, endMinute));
+    }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetWeekdayScheduleResponse
+{
+    static constexpr CommandId kId = Ids::SetWeekdayScheduleResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetWeekdaySchedule
+{
+    static constexpr CommandId kId = Ids::GetWeekdaySchedule;
+
+    uint8_t scheduleId;
+    uint16_t userId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(scheduleId, userId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(scheduleId, userId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetWeekdayScheduleResponse
+{
+    static constexpr CommandId kId = Ids::GetWeekdayScheduleResponse;
+
+    uint8_t scheduleId;
+    uint16_t userId;
+    uint8_t status;
+    uint8_t daysMask;
+    uint8_t startHour;
+    uint8_t startMinute;
+    uint8_t endHour;
+    uint8_t endMinute;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer,
+                                         std::tie(scheduleId, userId, status, daysMask, startHour, startMinute, endHour,
+                                                  endMinute));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader,
+                                         std::tie(scheduleId, userId, status, daysMask, startHour, startMinute, endHour,
+                                                  endMinute));
+    }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearWeekdaySchedule
+{
+    static constexpr CommandId kId = Ids::ClearWeekdaySchedule;
+
+    uint8_t scheduleId;
+    uint16_t userId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(scheduleId, userId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(scheduleId, userId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearWeekdayScheduleResponse
+{
+    static constexpr CommandId kId = Ids::ClearWeekdayScheduleResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetYeardaySchedule
+{
+    static constexpr CommandId kId = Ids::SetYeardaySchedule;
+
+    uint8_t scheduleId;
+    uint16_t userId;
+    uint32_t localStartTime;
+    uint32_t localEndTime;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(scheduleId, userId, localStartTime, localEndTime));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(scheduleId, userId, localStartTime, localEndTime));
+    }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetYeardayScheduleResponse
+{
+    static constexpr CommandId kId = Ids::SetYeardayScheduleResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetYeardaySchedule
+{
+    static constexpr CommandId kId = Ids::GetYeardaySchedule;
+
+    uint8_t scheduleId;
+    uint16_t userId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(scheduleId, userId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(scheduleId, userId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetYeardayScheduleResponse
+{
+    static constexpr CommandId kId = Ids::GetYeardayScheduleResponse;
+
+    uint8_t scheduleId;
+    uint16_t userId;
+    uint8_t status;
+    uint32_t localStartTime;
+    uint32_t localEndTime;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(scheduleId, userId, status, localStartTime, localEndTime));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(scheduleId, userId, status, localStartTime, localEndTime));
+    }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearYeardaySchedule
+{
+    static constexpr CommandId kId = Ids::ClearYeardaySchedule;
+
+    uint8_t scheduleId;
+    uint16_t userId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(scheduleId, userId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(scheduleId, userId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearYeardayScheduleResponse
+{
+    static constexpr CommandId kId = Ids::ClearYeardayScheduleResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetHolidaySchedule
+{
+    static constexpr CommandId kId = Ids::SetHolidaySchedule;
+
+    uint8_t scheduleId;
+    uint32_t localStartTime;
+    uint32_t localEndTime;
+    uint8_t operatingModeDuringHoliday;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(scheduleId, localStartTime, localEndTime, operatingModeDuringHoliday));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(scheduleId, localStartTime, localEndTime, operatingModeDuringHoliday));
+    }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetHolidayScheduleResponse
+{
+    static constexpr CommandId kId = Ids::SetHolidayScheduleResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetHolidaySchedule
+{
+    static constexpr CommandId kId = Ids::GetHolidaySchedule;
+
+    uint8_t scheduleId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(scheduleId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(scheduleId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetHolidayScheduleResponse
+{
+    static constexpr CommandId kId = Ids::GetHolidayScheduleResponse;
+
+    uint8_t scheduleId;
+    uint8_t status;
+    uint32_t localStartTime;
+    uint32_t localEndTime;
+    uint8_t operatingModeDuringHoliday;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer,
+                                         std::tie(scheduleId, status, localStartTime, localEndTime, operatingModeDuringHoliday));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader,
+                                         std::tie(scheduleId, status, localStartTime, localEndTime, operatingModeDuringHoliday));
+    }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearHolidaySchedule
+{
+    static constexpr CommandId kId = Ids::ClearHolidaySchedule;
+
+    uint8_t scheduleId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(scheduleId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(scheduleId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearHolidayScheduleResponse
+{
+    static constexpr CommandId kId = Ids::ClearHolidayScheduleResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetUserType
+{
+    static constexpr CommandId kId = Ids::SetUserType;
+
+    uint16_t userId;
+    uint8_t userType;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(userId, userType)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(userId, userType)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetUserTypeResponse
+{
+    static constexpr CommandId kId = Ids::SetUserTypeResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetUserType
+{
+    static constexpr CommandId kId = Ids::GetUserType;
+
+    uint16_t userId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(userId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(userId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetUserTypeResponse
+{
+    static constexpr CommandId kId = Ids::GetUserTypeResponse;
+
+    uint16_t userId;
+    uint8_t userType;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(userId, userType)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(userId, userType)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct SetRfidResponse
+{
+    static constexpr CommandId kId = Ids::SetRfidResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct GetRfid
+{
+    static constexpr CommandId kId = Ids::GetRfid;
+
+    uint16_t userId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(userId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(userId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearRfid
+{
+    static constexpr CommandId kId = Ids::ClearRfid;
+
+    uint16_t userId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(userId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(userId)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearRfidResponse
+{
+    static constexpr CommandId kId = Ids::ClearRfidResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace DoorLock {
+namespace Commands {
+
+struct ClearAllRfidsResponse
+{
+    static constexpr CommandId kId = Ids::ClearAllRfidsResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace DoorLock
+
+namespace WindowCovering {
+namespace Commands {
+
+struct GoToLiftValue
+{
+    static constexpr CommandId kId = Ids::GoToLiftValue;
+
+    uint16_t liftValue;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(liftValue)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(liftValue)); }
+};
+
+} // namespace Commands
+} // namespace WindowCovering
+
+namespace WindowCovering {
+namespace Commands {
+
+struct GoToLiftPercentage
+{
+    static constexpr CommandId kId = Ids::GoToLiftPercentage;
+
+    uint8_t liftPercentageValue;
+    uint16_t liftPercent100thsValue;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(liftPercentageValue, liftPercent100thsValue));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(liftPercentageValue, liftPercent100thsValue));
+    }
+};
+
+} // namespace Commands
+} // namespace WindowCovering
+
+namespace WindowCovering {
+namespace Commands {
+
+struct GoToTiltValue
+{
+    static constexpr CommandId kId = Ids::GoToTiltValue;
+
+    uint16_t tiltValue;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(tiltValue)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(tiltValue)); }
+};
+
+} // namespace Commands
+} // namespace WindowCovering
+
+namespace WindowCovering {
+namespace Commands {
+
+struct GoToTiltPercentage
+{
+    static constexpr CommandId kId = Ids::GoToTiltPercentage;
+
+    uint8_t tiltPercentageValue;
+    uint16_t tiltPercent100thsValue;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(tiltPercentageValue, tiltPercent100thsValue));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(tiltPercentageValue, tiltPercent100thsValue));
+    }
+};
+
+} // namespace Commands
+} // namespace WindowCovering
+
+namespace BarrierControl {
+namespace Commands {
+
+struct BarrierControlGoToPercent
+{
+    static constexpr CommandId kId = Ids::BarrierControlGoToPercent;
+
+    uint8_t percentOpen;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(percentOpen)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(percentOpen)); }
+};
+
+} // namespace Commands
+} // namespace BarrierControl
+
+namespace Thermostat {
+namespace Commands {
+
+struct SetpointRaiseLower
+{
+    static constexpr CommandId kId = Ids::SetpointRaiseLower;
+
+    uint8_t mode;
+    int8_t amount;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mode, amount)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mode, amount)); }
+};
+
+} // namespace Commands
+} // namespace Thermostat
+
+namespace Thermostat {
+namespace Commands {
+
+struct RelayStatusLog
+{
+    static constexpr CommandId kId = Ids::RelayStatusLog;
+
+    uint16_t timeOfDay;
+    uint16_t relayStatus;
+    int16_t localTemperature;
+    uint8_t humidityInPercentage;
+    int16_t setpoint;
+    uint16_t unreadEntries;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer,
+                                         std::tie(timeOfDay, relayStatus, localTemperature, humidityInPercentage, setpoint,
+                                                  unreadEntries));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader,
+                                         std::tie(timeOfDay, relayStatus, localTemperature, humidityInPercentage, setpoint,
+                                                  unreadEntries));
+    }
+};
+
+} // namespace Commands
+} // namespace Thermostat
+
+namespace Thermostat {
+namespace Commands {
+
+struct GetWeeklySchedule
+{
+    static constexpr CommandId kId = Ids::GetWeeklySchedule;
+
+    uint8_t daysToReturn;
+    uint8_t modeToReturn;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(daysToReturn, modeToReturn));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(daysToReturn, modeToReturn)); }
+};
+
+} // namespace Commands
+} // namespace Thermostat
+
+namespace ColorControl {
+namespace Commands {
+
+struct MoveToHue
+{
+    static constexpr CommandId kId = Ids::MoveToHue;
+
+    uint8_t hue;
+    uint8_t direction;
+    uint16_t transitionTime;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(hue, direction, transitionTime, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(hue, direction, transitionTime, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct MoveHue
+{
+    static constexpr CommandId kId = Ids::MoveHue;
+
+    uint8_t moveMode;
+    uint8_t rate;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(moveMode, rate, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(moveMode, rate, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct StepHue
+{
+    static constexpr CommandId kId = Ids::StepHue;
+
+    uint8_t stepMode;
+    uint8_t stepSize;
+    uint8_t transitionTime;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(stepMode, stepSize, transitionTime, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(stepMode, stepSize, transitionTime, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct MoveToSaturation
+{
+    static constexpr CommandId kId = Ids::MoveToSaturation;
+
+    uint8_t saturation;
+    uint16_t transitionTime;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(saturation, transitionTime, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(saturation, transitionTime, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct MoveSaturation
+{
+    static constexpr CommandId kId = Ids::MoveSaturation;
+
+    uint8_t moveMode;
+    uint8_t rate;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(moveMode, rate, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(moveMode, rate, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct StepSaturation
+{
+    static constexpr CommandId kId = Ids::StepSaturation;
+
+    uint8_t stepMode;
+    uint8_t stepSize;
+    uint8_t transitionTime;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(stepMode, stepSize, transitionTime, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(stepMode, stepSize, transitionTime, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct MoveToHueAndSaturation
+{
+    static constexpr CommandId kId = Ids::MoveToHueAndSaturation;
+
+    uint8_t hue;
+    uint8_t saturation;
+    uint16_t transitionTime;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(hue, saturation, transitionTime, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(hue, saturation, transitionTime, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct MoveToColor
+{
+    static constexpr CommandId kId = Ids::MoveToColor;
+
+    uint16_t colorX;
+    uint16_t colorY;
+    uint16_t transitionTime;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(colorX, colorY, transitionTime, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(colorX, colorY, transitionTime, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct MoveColor
+{
+    static constexpr CommandId kId = Ids::MoveColor;
+
+    int16_t rateX;
+    int16_t rateY;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(rateX, rateY, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(rateX, rateY, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct StepColor
+{
+    static constexpr CommandId kId = Ids::StepColor;
+
+    int16_t stepX;
+    int16_t stepY;
+    uint16_t transitionTime;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(stepX, stepY, transitionTime, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(stepX, stepY, transitionTime, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct MoveToColorTemperature
+{
+    static constexpr CommandId kId = Ids::MoveToColorTemperature;
+
+    uint16_t colorTemperature;
+    uint16_t transitionTime;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(colorTemperature, transitionTime, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(colorTemperature, transitionTime, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct EnhancedMoveToHue
+{
+    static constexpr CommandId kId = Ids::EnhancedMoveToHue;
+
+    uint16_t enhancedHue;
+    uint8_t direction;
+    uint16_t transitionTime;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(enhancedHue, direction, transitionTime, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(enhancedHue, direction, transitionTime, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct EnhancedMoveHue
+{
+    static constexpr CommandId kId = Ids::EnhancedMoveHue;
+
+    uint8_t moveMode;
+    uint16_t rate;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(moveMode, rate, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(moveMode, rate, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct EnhancedStepHue
+{
+    static constexpr CommandId kId = Ids::EnhancedStepHue;
+
+    uint8_t stepMode;
+    uint16_t stepSize;
+    uint16_t transitionTime;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(stepMode, stepSize, transitionTime, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(stepMode, stepSize, transitionTime, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct EnhancedMoveToHueAndSaturation
+{
+    static constexpr CommandId kId = Ids::EnhancedMoveToHueAndSaturation;
+
+    uint16_t enhancedHue;
+    uint8_t saturation;
+    uint16_t transitionTime;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(enhancedHue, saturation, transitionTime, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(enhancedHue, saturation, transitionTime, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct ColorLoopSet
+{
+    static constexpr CommandId kId = Ids::ColorLoopSet;
+
+    uint8_t updateFlags;
+    uint8_t action;
+    uint8_t direction;
+    uint16_t time;
+    uint16_t startHue;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer,
+                                         std::tie(updateFlags, action, direction, time, startHue, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader,
+                                         std::tie(updateFlags, action, direction, time, startHue, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct StopMoveStep
+{
+    static constexpr CommandId kId = Ids::StopMoveStep;
+
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(optionsMask, optionsOverride)); }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct MoveColorTemperature
+{
+    static constexpr CommandId kId = Ids::MoveColorTemperature;
+
+    uint8_t moveMode;
+    uint16_t rate;
+    uint16_t colorTemperatureMinimum;
+    uint16_t colorTemperatureMaximum;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer,
+                                         std::tie(moveMode, rate, colorTemperatureMinimum, colorTemperatureMaximum, optionsMask,
+                                                  optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader,
+                                         std::tie(moveMode, rate, colorTemperatureMinimum, colorTemperatureMaximum, optionsMask,
+                                                  optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace ColorControl {
+namespace Commands {
+
+struct StepColorTemperature
+{
+    static constexpr CommandId kId = Ids::StepColorTemperature;
+
+    uint8_t stepMode;
+    uint16_t stepSize;
+    uint16_t transitionTime;
+    uint16_t colorTemperatureMinimum;
+    uint16_t colorTemperatureMaximum;
+    uint8_t optionsMask;
+    uint8_t optionsOverride;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer,
+                                         std::tie(stepMode, stepSize, transitionTime, colorTemperatureMinimum,
+                                                  colorTemperatureMaximum, optionsMask, optionsOverride));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader,
+                                         std::tie(stepMode, stepSize, transitionTime, colorTemperatureMinimum,
+                                                  colorTemperatureMaximum, optionsMask, optionsOverride));
+    }
+};
+
+} // namespace Commands
+} // namespace ColorControl
+
+namespace IasZone {
+namespace Commands {
+
+struct ZoneEnrollResponse
+{
+    static constexpr CommandId kId = Ids::ZoneEnrollResponse;
+
+    uint8_t enrollResponseCode;
+    uint8_t zoneId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(enrollResponseCode, zoneId));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(enrollResponseCode, zoneId)); }
+};
+
+} // namespace Commands
+} // namespace IasZone
+
+namespace IasZone {
+namespace Commands {
+
+struct ZoneStatusChangeNotification
+{
+    static constexpr CommandId kId = Ids::ZoneStatusChangeNotification;
+
+    uint16_t zoneStatus;
+    uint8_t extendedStatus;
+    uint8_t zoneId;
+    uint16_t delay;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(zoneStatus, extendedStatus, zoneId, delay));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(zoneStatus, extendedStatus, zoneId, delay));
+    }
+};
+
+} // namespace Commands
+} // namespace IasZone
+
+namespace IasZone {
+namespace Commands {
+
+struct ZoneEnrollRequest
+{
+    static constexpr CommandId kId = Ids::ZoneEnrollRequest;
+
+    uint16_t zoneType;
+    uint16_t manufacturerCode;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(zoneType, manufacturerCode));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(zoneType, manufacturerCode)); }
+};
+
+} // namespace Commands
+} // namespace IasZone
+
+namespace IasZone {
+namespace Commands {
+
+struct InitiateTestMode
+{
+    static constexpr CommandId kId = Ids::InitiateTestMode;
+
+    uint8_t testModeDuration;
+    uint8_t currentZoneSensitivityLevel;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(testModeDuration, currentZoneSensitivityLevel));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(testModeDuration, currentZoneSensitivityLevel));
+    }
+};
+
+} // namespace Commands
+} // namespace IasZone
+
+namespace IasAce {
+namespace Commands {
+
+struct ArmResponse
+{
+    static constexpr CommandId kId = Ids::ArmResponse;
+
+    uint8_t armNotification;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(armNotification)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(armNotification)); }
+};
+
+} // namespace Commands
+} // namespace IasAce
+
+namespace IasAce {
+namespace Commands {
+
+struct GetZoneIdMapResponse
+{
+    static constexpr CommandId kId = Ids::GetZoneIdMapResponse;
+
+    uint16_t section0;
+    uint16_t section1;
+    uint16_t section2;
+    uint16_t section3;
+    uint16_t section4;
+    uint16_t section5;
+    uint16_t section6;
+    uint16_t section7;
+    uint16_t section8;
+    uint16_t section9;
+    uint16_t section10;
+    uint16_t section11;
+    uint16_t section12;
+    uint16_t section13;
+    uint16_t section14;
+    uint16_t section15;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer,
+                                         std::tie(section0, section1, section2, section3, section4, section5, section6, section7,
+                                                  section8, section9, section10, section11, section12, section13, section14,
+                                                  section15));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader,
+                                         std::tie(section0, section1, section2, section3, section4, section5, section6, section7,
+                                                  section8, section9, section10, section11, section12, section13, section14,
+                                                  section15));
+    }
+};
+
+} // namespace Commands
+} // namespace IasAce
+
+namespace IasAce {
+namespace Commands {
+
+struct PanelStatusChanged
+{
+    static constexpr CommandId kId = Ids::PanelStatusChanged;
+
+    uint8_t panelStatus;
+    uint8_t secondsRemaining;
+    uint8_t audibleNotification;
+    uint8_t alarmStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(panelStatus, secondsRemaining, audibleNotification, alarmStatus));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(panelStatus, secondsRemaining, audibleNotification, alarmStatus));
+    }
+};
+
+} // namespace Commands
+} // namespace IasAce
+
+namespace IasAce {
+namespace Commands {
+
+struct GetPanelStatusResponse
+{
+    static constexpr CommandId kId = Ids::GetPanelStatusResponse;
+
+    uint8_t panelStatus;
+    uint8_t secondsRemaining;
+    uint8_t audibleNotification;
+    uint8_t alarmStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(panelStatus, secondsRemaining, audibleNotification, alarmStatus));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(panelStatus, secondsRemaining, audibleNotification, alarmStatus));
+    }
+};
+
+} // namespace Commands
+} // namespace IasAce
+
+namespace IasAce {
+namespace Commands {
+
+struct GetZoneInformation
+{
+    static constexpr CommandId kId = Ids::GetZoneInformation;
+
+    uint8_t zoneId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(zoneId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(zoneId)); }
+};
+
+} // namespace Commands
+} // namespace IasAce
+
+namespace IasAce {
+namespace Commands {
+
+struct GetZoneStatus
+{
+    static constexpr CommandId kId = Ids::GetZoneStatus;
+
+    uint8_t startingZoneId;
+    uint8_t maxNumberOfZoneIds;
+    uint8_t zoneStatusMaskFlag;
+    uint16_t zoneStatusMask;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(startingZoneId, maxNumberOfZoneIds, zoneStatusMaskFlag, zoneStatusMask));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(startingZoneId, maxNumberOfZoneIds, zoneStatusMaskFlag, zoneStatusMask));
+    }
+};
+
+} // namespace Commands
+} // namespace IasAce
+
+namespace IasWd {
+namespace Commands {
+
+struct StartWarning
+{
+    static constexpr CommandId kId = Ids::StartWarning;
+
+    uint8_t warningInfo;
+    uint16_t warningDuration;
+    uint8_t strobeDutyCycle;
+    uint8_t strobeLevel;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(warningInfo, warningDuration, strobeDutyCycle, strobeLevel));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(warningInfo, warningDuration, strobeDutyCycle, strobeLevel));
+    }
+};
+
+} // namespace Commands
+} // namespace IasWd
+
+namespace IasWd {
+namespace Commands {
+
+struct Squawk
+{
+    static constexpr CommandId kId = Ids::Squawk;
+
+    uint8_t squawkInfo;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(squawkInfo)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(squawkInfo)); }
+};
+
+} // namespace Commands
+} // namespace IasWd
+
+namespace TvChannel {
+namespace Commands {
+
+struct ChangeChannelByNumber
+{
+    static constexpr CommandId kId = Ids::ChangeChannelByNumber;
+
+    uint16_t majorNumber;
+    uint16_t minorNumber;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(majorNumber, minorNumber));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(majorNumber, minorNumber)); }
+};
+
+} // namespace Commands
+} // namespace TvChannel
+
+namespace TvChannel {
+namespace Commands {
+
+struct SkipChannel
+{
+    static constexpr CommandId kId = Ids::SkipChannel;
+
+    uint16_t Count;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(Count)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(Count)); }
+};
+
+} // namespace Commands
+} // namespace TvChannel
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaPlayResponse
+{
+    static constexpr CommandId kId = Ids::MediaPlayResponse;
+
+    uint8_t mediaPlaybackStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mediaPlaybackStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mediaPlaybackStatus)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaPauseResponse
+{
+    static constexpr CommandId kId = Ids::MediaPauseResponse;
+
+    uint8_t mediaPlaybackStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mediaPlaybackStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mediaPlaybackStatus)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaStopResponse
+{
+    static constexpr CommandId kId = Ids::MediaStopResponse;
+
+    uint8_t mediaPlaybackStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mediaPlaybackStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mediaPlaybackStatus)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaStartOverResponse
+{
+    static constexpr CommandId kId = Ids::MediaStartOverResponse;
+
+    uint8_t mediaPlaybackStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mediaPlaybackStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mediaPlaybackStatus)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaPreviousResponse
+{
+    static constexpr CommandId kId = Ids::MediaPreviousResponse;
+
+    uint8_t mediaPlaybackStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mediaPlaybackStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mediaPlaybackStatus)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaNextResponse
+{
+    static constexpr CommandId kId = Ids::MediaNextResponse;
+
+    uint8_t mediaPlaybackStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mediaPlaybackStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mediaPlaybackStatus)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaRewindResponse
+{
+    static constexpr CommandId kId = Ids::MediaRewindResponse;
+
+    uint8_t mediaPlaybackStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mediaPlaybackStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mediaPlaybackStatus)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaFastForwardResponse
+{
+    static constexpr CommandId kId = Ids::MediaFastForwardResponse;
+
+    uint8_t mediaPlaybackStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mediaPlaybackStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mediaPlaybackStatus)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaSkipForward
+{
+    static constexpr CommandId kId = Ids::MediaSkipForward;
+
+    uint64_t deltaPositionMilliseconds;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(deltaPositionMilliseconds));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(deltaPositionMilliseconds)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaSkipForwardResponse
+{
+    static constexpr CommandId kId = Ids::MediaSkipForwardResponse;
+
+    uint8_t mediaPlaybackStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mediaPlaybackStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mediaPlaybackStatus)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaSkipBackward
+{
+    static constexpr CommandId kId = Ids::MediaSkipBackward;
+
+    uint64_t deltaPositionMilliseconds;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(deltaPositionMilliseconds));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(deltaPositionMilliseconds)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaSkipBackwardResponse
+{
+    static constexpr CommandId kId = Ids::MediaSkipBackwardResponse;
+
+    uint8_t mediaPlaybackStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mediaPlaybackStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mediaPlaybackStatus)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaSeek
+{
+    static constexpr CommandId kId = Ids::MediaSeek;
+
+    uint64_t position;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(position)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(position)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaPlayback {
+namespace Commands {
+
+struct MediaSeekResponse
+{
+    static constexpr CommandId kId = Ids::MediaSeekResponse;
+
+    uint8_t mediaPlaybackStatus;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(mediaPlaybackStatus)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(mediaPlaybackStatus)); }
+};
+
+} // namespace Commands
+} // namespace MediaPlayback
+
+namespace MediaInput {
+namespace Commands {
+
+struct SelectInput
+{
+    static constexpr CommandId kId = Ids::SelectInput;
+
+    uint8_t index;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(index)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(index)); }
+};
+
+} // namespace Commands
+} // namespace MediaInput
+
+namespace KeypadInput {
+namespace Commands {
+
+struct SendKey
+{
+    static constexpr CommandId kId = Ids::SendKey;
+
+    uint8_t keyCode;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(keyCode)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(keyCode)); }
+};
+
+} // namespace Commands
+} // namespace KeypadInput
+
+namespace KeypadInput {
+namespace Commands {
+
+struct SendKeyResponse
+{
+    static constexpr CommandId kId = Ids::SendKeyResponse;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace KeypadInput
+
+namespace AudioOutput {
+namespace Commands {
+
+struct SelectOutput
+{
+    static constexpr CommandId kId = Ids::SelectOutput;
+
+    uint8_t index;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(index)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(index)); }
+};
+
+} // namespace Commands
+} // namespace AudioOutput
+
+namespace ApplicationBasic {
+namespace Commands {
+
+struct ChangeStatus
+{
+    static constexpr CommandId kId = Ids::ChangeStatus;
+
+    uint8_t status;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(status)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(status)); }
+};
+
+} // namespace Commands
+} // namespace ApplicationBasic
+
+namespace TestCluster {
+namespace Commands {
+
+struct TestSpecificResponse
+{
+    static constexpr CommandId kId = Ids::TestSpecificResponse;
+
+    uint8_t returnValue;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(returnValue)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(returnValue)); }
+};
+
+} // namespace Commands
+} // namespace TestCluster
+
+namespace Messaging {
+namespace Commands {
+
+struct CancelMessage
+{
+    static constexpr CommandId kId = Ids::CancelMessage;
+
+    uint32_t messageId;
+    uint8_t messageControl;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(messageId, messageControl));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(messageId, messageControl)); }
+};
+
+} // namespace Commands
+} // namespace Messaging
+
+namespace ApplianceEventsAndAlert {
+namespace Commands {
+
+struct EventsNotification
+{
+    static constexpr CommandId kId = Ids::EventsNotification;
+
+    uint8_t eventHeader;
+    uint8_t eventId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(eventHeader, eventId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(eventHeader, eventId)); }
+};
+
+} // namespace Commands
+} // namespace ApplianceEventsAndAlert
+
+namespace ApplianceStatistics {
+namespace Commands {
+
+struct LogRequest
+{
+    static constexpr CommandId kId = Ids::LogRequest;
+
+    uint32_t logId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(logId)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(logId)); }
+};
+
+} // namespace Commands
+} // namespace ApplianceStatistics
+
+namespace ElectricalMeasurement {
+namespace Commands {
+
+struct GetMeasurementProfileCommand
+{
+    static constexpr CommandId kId = Ids::GetMeasurementProfileCommand;
+
+    uint16_t attributeId;
+    uint32_t startTime;
+    uint8_t numberOfIntervals;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(attributeId, startTime, numberOfIntervals));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(attributeId, startTime, numberOfIntervals));
+    }
+};
+
+} // namespace Commands
+} // namespace ElectricalMeasurement
+
+namespace Binding {
+namespace Commands {
+
+struct Bind
+{
+    static constexpr CommandId kId = Ids::Bind;
+
+    chip::NodeId nodeId;
+    chip::GroupId groupId;
+    chip::EndpointId endpointId;
+    chip::ClusterId clusterId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(nodeId, groupId, endpointId, clusterId));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(nodeId, groupId, endpointId, clusterId));
+    }
+};
+
+} // namespace Commands
+} // namespace Binding
+
+namespace Binding {
+namespace Commands {
+
+struct Unbind
+{
+    static constexpr CommandId kId = Ids::Unbind;
+
+    chip::NodeId nodeId;
+    chip::GroupId groupId;
+    chip::EndpointId endpointId;
+    chip::ClusterId clusterId;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const
+    {
+        return TLV::Schema::EncodeFields(writer, std::tie(nodeId, groupId, endpointId, clusterId));
+    }
+    CHIP_ERROR Decode(TLV::TLVReader & reader)
+    {
+        return TLV::Schema::DecodeFields(reader, std::tie(nodeId, groupId, endpointId, clusterId));
+    }
+};
+
+} // namespace Commands
+} // namespace Binding
+
+namespace SampleMfgSpecificCluster {
+namespace Commands {
+
+struct CommandOne
+{
+    static constexpr CommandId kId = Ids::CommandOne;
+
+    uint8_t argOne;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(argOne)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(argOne)); }
+};
+
+} // namespace Commands
+} // namespace SampleMfgSpecificCluster
+
+namespace SampleMfgSpecificCluster2 {
+namespace Commands {
+
+struct CommandTwo
+{
+    static constexpr CommandId kId = Ids::CommandTwo;
+
+    uint8_t argOne;
+
+    CHIP_ERROR Encode(TLV::TLVWriter & writer) const { return TLV::Schema::EncodeFields(writer, std::tie(argOne)); }
+    CHIP_ERROR Decode(TLV::TLVReader & reader) { return TLV::Schema::DecodeFields(reader, std::tie(argOne)); }
+};
+
+} // namespace Commands
+} // namespace SampleMfgSpecificCluster2
+
+} // namespace Clusters
+} // namespace app
+} // namespace chip
@@ -227,11 +227,10 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::System::PacketBufferTLVWriter reportDataWriter;
     ReportData::Builder reportDataBuilder;
-    chip::System::PacketBufferHandle bufHandle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
+    chip::System::PacketBufferHandle bufHandle;
 
-    VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
-
-    reportDataWriter.Init(std::move(bufHandle));
+    err = reportDataWriter.InitGrowable(chip::app::kMaxSecureSduLengthBytes, chip::app::kInitialMessageBufferSize);
+    SuccessOrExit(err);
 
     // Create a report data.
     err = reportDataBuilder.Init(&reportDataWriter);
@@ -253,7 +252,8 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     reportDataBuilder.EndOfReportData();
     SuccessOrExit(err = reportDataBuilder.GetError());
 
-    err = reportDataWriter.Finalize(&bufHandle);
+    err = reportDataWriter.FinalizeContiguous(&bufHandle, System::PacketBuffer::kDefaultHeaderReserve,
+                                              chip::app::kMessageTailroomSize);
     SuccessOrExit(err);
 
 #if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
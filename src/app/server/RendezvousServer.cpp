@@ -182,6 +182,9 @@ void RendezvousServer::OnSessionEstablished()
 
     VerifyOrReturn(mStorage != nullptr,
                    ChipLogError(AppServer, "Storage delegate is not available. Cannot store the connection state"));
+
+    // The connection state and the next key ID are written to storage together.
+    PersistentStorageTransaction transaction(*mStorage);
     VerifyOrReturn(connection.StoreIntoKVS(*mStorage) == CHIP_NO_ERROR,
                    ChipLogError(AppServer, "Failed to store the connection state"));
 
@@ -191,6 +194,8 @@ void RendezvousServer::OnSessionEstablished()
     // We support one active PASE session at any time. So the key ID should not be updated
     // in another thread, while we retrieve it here.
     uint16_t keyID = mIDAllocator->Peek();
-    mStorage->SyncSetKeyValue(kStorablePeerConnectionCountKey, &keyID, sizeof(keyID));
+    VerifyOrReturn(mStorage->SyncSetKeyValue(kStorablePeerConnectionCountKey, &keyID, sizeof(keyID)) == CHIP_NO_ERROR,
+                   ChipLogError(AppServer, "Failed to store the next key ID"));
+    VerifyOrReturn(transaction.Commit() == CHIP_NO_ERROR, ChipLogError(AppServer, "Failed to persist the connection state"));
 }
 } // namespace chip
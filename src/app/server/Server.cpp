@@ -95,6 +95,12 @@ class ServerStorageDelegate : public PersistentStorageDelegate
         ChipLogProgress(AppServer, "Delete value in server storage");
         return PersistedStorage::KeyValueStoreMgr().Delete(key);
     }
+
+    CHIP_ERROR BeginTransaction() override { return PersistedStorage::KeyValueStoreMgr().BeginTransaction(); }
+
+    CHIP_ERROR CommitTransaction() override { return PersistedStorage::KeyValueStoreMgr().CommitTransaction(); }
+
+    void AbortTransaction() override { PersistedStorage::KeyValueStoreMgr().AbortTransaction(); }
 };
 
 ServerStorageDelegate gServerStorage;
@@ -105,8 +111,11 @@ CHIP_ERROR PersistAdminPairingToKVS(AdminPairingInfo * admin, AdminId nextAvaila
     ReturnErrorCodeIf(admin == nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     ChipLogProgress(AppServer, "Persisting admin ID %d, next available %d", admin->GetAdminId(), nextAvailableId);
 
+    // The admin and the admin count are written to storage together.
+    PersistentStorageTransaction transaction(gServerStorage);
     ReturnErrorOnFailure(GetGlobalAdminPairingTable().Store(admin->GetAdminId()));
     ReturnErrorOnFailure(PersistedStorage::KeyValueStoreMgr().Put(kAdminTableCountKey, &nextAvailableId, sizeof(nextAvailableId)));
+    ReturnErrorOnFailure(transaction.Commit());
 
     ChipLogProgress(AppServer, "Persisting admin ID successfully");
     return CHIP_NO_ERROR;
@@ -0,0 +1,234 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the encoding and decoding of the arguments of
+ *      cluster commands by the generated codecs of cluster-codecs.h, against the encoding
+ *      of the cluster clients, one Put() per argument, and the decoding of the generated
+ *      command handlers, a loop over the elements with a switch on their tags.
+ *
+ */
+
+#include <app/common/gen/cluster-codecs.h>
+#include <core/CHIPTLV.h>
+#include <support/CodeUtils.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <tuple>
+#include <utility>
+
+using namespace chip;
+using namespace chip::TLV;
+using namespace chip::app::Clusters;
+
+namespace {
+
+constexpr int kRounds = 100000;
+
+auto Tie(LevelControl::Commands::MoveToLevel & c)
+{
+    return std::tie(c.level, c.transitionTime, c.optionMask, c.optionOverride);
+}
+
+auto Tie(ColorControl::Commands::MoveToHueAndSaturation & c)
+{
+    return std::tie(c.hue, c.saturation, c.transitionTime, c.optionsMask, c.optionsOverride);
+}
+
+auto Tie(Binding::Commands::Bind & c)
+{
+    return std::tie(c.nodeId, c.groupId, c.endpointId, c.clusterId);
+}
+
+template <typename Tuple, size_t... Is>
+CHIP_ERROR PutArguments(TLVWriter & writer, const Tuple & args, std::index_sequence<Is...>)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    int unused[]   = { 0,
+                     ((err = (err == CHIP_NO_ERROR) ? writer.Put(ContextTag(static_cast<uint8_t>(Is)), std::get<Is>(args)) : err),
+                      0)... };
+    (void) unused;
+    return err;
+}
+
+/**
+ *  The encoding of the cluster clients: one Put() per argument, with the minimal width of its value.
+ */
+template <typename... Ts>
+CHIP_ERROR PutArguments(TLVWriter & writer, const std::tuple<Ts &...> & args)
+{
+    return PutArguments(writer, args, std::index_sequence_for<Ts...>());
+}
+
+template <typename Tuple, size_t... Is>
+CHIP_ERROR GetArgumentAt(TLVReader & reader, uint32_t tag, const Tuple & args, std::index_sequence<Is...>)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    int unused[]   = { 0, ((Is == tag) ? ((err = reader.Get(std::get<Is>(args))), 0) : 0)... };
+    (void) unused;
+    return err;
+}
+
+/**
+ *  The decoding of the generated command handlers without codecs: a loop over the elements of the command data,
+ *  skipping the non-context tags, rejecting duplicates and getting each argument by its tag.
+ */
+template <typename... Ts>
+CHIP_ERROR GetArguments(TLVReader & reader, const std::tuple<Ts &...> & args)
+{
+    constexpr uint32_t kArgumentCount = sizeof...(Ts);
+    bool argExists[kArgumentCount]    = {};
+    uint32_t validArgumentCount       = 0;
+    CHIP_ERROR err;
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (!IsContextTag(reader.GetTag()))
+        {
+            continue;
+        }
+
+        const uint32_t tag = TagNumFromTag(reader.GetTag());
+        if (tag < kArgumentCount)
+        {
+            VerifyOrReturnError(!argExists[tag], CHIP_ERROR_IM_MALFORMED_COMMAND_DATA_ELEMENT);
+            argExists[tag] = true;
+            validArgumentCount++;
+        }
+        ReturnErrorOnFailure(GetArgumentAt(reader, tag, args, std::index_sequence_for<Ts...>()));
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    return (validArgumentCount == kArgumentCount) ? CHIP_NO_ERROR : CHIP_ERROR_TLV_TAG_NOT_FOUND;
+}
+
+template <typename Command>
+CHIP_ERROR Encode(TLVWriter & writer, Command & command, bool generic)
+{
+    TLVType dataTlvType;
+
+    ReturnErrorOnFailure(writer.StartContainer(AnonymousTag, kTLVType_Structure, dataTlvType));
+    ReturnErrorOnFailure(generic ? PutArguments(writer, Tie(command)) : command.Encode(writer));
+    ReturnErrorOnFailure(writer.EndContainer(dataTlvType));
+    return writer.Finalize();
+}
+
+template <typename Command>
+CHIP_ERROR Decode(TLVReader & reader, Command & command, bool generic)
+{
+    TLVType dataTlvType;
+
+    ReturnErrorOnFailure(reader.Next(kTLVType_Structure, AnonymousTag));
+    ReturnErrorOnFailure(reader.EnterContainer(dataTlvType));
+    ReturnErrorOnFailure(generic ? GetArguments(reader, Tie(command)) : command.Decode(reader));
+    return reader.ExitContainer(dataTlvType);
+}
+
+/**
+ *  Encode the command kRounds times, and return the average time of an encoding in nanoseconds, or a negative value
+ *  if an encoding failed.
+ */
+template <typename Command>
+double TimeEncode(Command & command, bool generic, uint8_t * buf, uint32_t bufLen, uint32_t & len)
+{
+    TLVWriter writer;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        writer.Init(buf, bufLen);
+        VerifyOrReturnError(Encode(writer, command, generic) == CHIP_NO_ERROR, -1);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    len = writer.GetLengthWritten();
+    return std::chrono::duration<double, std::nano>(elapsed).count() / kRounds;
+}
+
+/**
+ *  Decode the encoding of a command kRounds times, and return the average time of a decoding in nanoseconds, or a
+ *  negative value if a decoding failed or did not give back the expected command.
+ */
+template <typename Command>
+double TimeDecode(Command expected, bool generic, const uint8_t * buf, uint32_t len)
+{
+    Command command;
+    TLVReader reader;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        reader.Init(buf, len);
+        VerifyOrReturnError(Decode(reader, command, generic) == CHIP_NO_ERROR, -1);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    VerifyOrReturnError(Tie(command) == Tie(expected), -1);
+    return std::chrono::duration<double, std::nano>(elapsed).count() / kRounds;
+}
+
+template <typename Command>
+bool Benchmark(const char * name, Command command)
+{
+    uint8_t genericBuf[64];
+    uint8_t codecBuf[64];
+    uint32_t genericLen = 0;
+    uint32_t codecLen   = 0;
+
+    const double genericEncode = TimeEncode(command, true, genericBuf, sizeof(genericBuf), genericLen);
+    const double codecEncode   = TimeEncode(command, false, codecBuf, sizeof(codecBuf), codecLen);
+    if (genericEncode < 0 || codecEncode < 0)
+    {
+        fprintf(stderr, "%s: failed to encode the arguments\n", name);
+        return false;
+    }
+
+    // The handlers decode the encodings of any client, so the codec is also timed on the minimal widths of Put().
+    const double genericDecode      = TimeDecode(command, true, codecBuf, codecLen);
+    const double codecDecode        = TimeDecode(command, false, codecBuf, codecLen);
+    const double codecDecodeGeneric = TimeDecode(command, false, genericBuf, genericLen);
+    if (genericDecode < 0 || codecDecode < 0 || codecDecodeGeneric < 0)
+    {
+        fprintf(stderr, "%s: failed to decode the arguments\n", name);
+        return false;
+    }
+
+    printf("%s: encode %.0f ns generic (%u bytes), %.0f ns codec (%u bytes); "
+           "decode %.0f ns generic, %.0f ns codec, %.0f ns codec of the generic encoding\n",
+           name, genericEncode, static_cast<unsigned>(genericLen), codecEncode, static_cast<unsigned>(codecLen), genericDecode,
+           codecDecode, codecDecodeGeneric);
+    return true;
+}
+
+} // namespace
+
+int main()
+{
+    bool succeeded = true;
+
+    succeeded = Benchmark("LevelControl MoveToLevel", LevelControl::Commands::MoveToLevel{ 254, 10, 0, 0 }) && succeeded;
+    succeeded =
+        Benchmark("ColorControl MoveToHueAndSaturation", ColorControl::Commands::MoveToHueAndSaturation{ 120, 200, 10, 0, 0 }) &&
+        succeeded;
+    succeeded = Benchmark("Binding Bind", Binding::Commands::Bind{ 0x0123456789ABCDEF, 0x0102, 1, 0x0006 }) && succeeded;
+
+    return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
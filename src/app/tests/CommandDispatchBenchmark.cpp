@@ -0,0 +1,299 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the dispatch of the commands of the all-clusters
+ *      app to their handlers, by the sorted table of CommandDispatchTable.h and by a switch
+ *      on the cluster ID then on the command ID, as IMClusterCommandHandler.cpp did before.
+ *
+ */
+
+#include <app/CommandDispatchTable.h>
+#include <app/common/gen/ids/Clusters.h>
+#include <app/common/gen/ids/Commands.h>
+#include <support/CodeUtils.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace chip;
+using namespace chip::app;
+
+// The commands of the all-clusters app, as in examples/all-clusters-app/all-clusters-common/gen/IMClusterCommandHandler.cpp.
+#define ALL_CLUSTERS_APP_COMMANDS(CLUSTER_BEGIN, COMMAND, CLUSTER_END)                                                             \
+    CLUSTER_BEGIN(BarrierControl)                                                                                                  \
+    COMMAND(BarrierControl, BarrierControlGoToPercent)                                                                             \
+    COMMAND(BarrierControl, BarrierControlStop)                                                                                    \
+    CLUSTER_END(BarrierControl)                                                                                                    \
+    CLUSTER_BEGIN(Binding)                                                                                                         \
+    COMMAND(Binding, Bind)                                                                                                         \
+    COMMAND(Binding, Unbind)                                                                                                       \
+    CLUSTER_END(Binding)                                                                                                           \
+    CLUSTER_BEGIN(ColorControl)                                                                                                    \
+    COMMAND(ColorControl, ColorLoopSet)                                                                                            \
+    COMMAND(ColorControl, EnhancedMoveHue)                                                                                         \
+    COMMAND(ColorControl, EnhancedMoveToHue)                                                                                       \
+    COMMAND(ColorControl, EnhancedMoveToHueAndSaturation)                                                                          \
+    COMMAND(ColorControl, EnhancedStepHue)                                                                                         \
+    COMMAND(ColorControl, MoveColor)                                                                                               \
+    COMMAND(ColorControl, MoveColorTemperature)                                                                                    \
+    COMMAND(ColorControl, MoveHue)                                                                                                 \
+    COMMAND(ColorControl, MoveSaturation)                                                                                          \
+    COMMAND(ColorControl, MoveToColor)                                                                                             \
+    COMMAND(ColorControl, MoveToColorTemperature)                                                                                  \
+    COMMAND(ColorControl, MoveToHue)                                                                                               \
+    COMMAND(ColorControl, MoveToHueAndSaturation)                                                                                  \
+    COMMAND(ColorControl, MoveToSaturation)                                                                                        \
+    COMMAND(ColorControl, StepColor)                                                                                               \
+    COMMAND(ColorControl, StepColorTemperature)                                                                                    \
+    COMMAND(ColorControl, StepHue)                                                                                                 \
+    COMMAND(ColorControl, StepSaturation)                                                                                          \
+    COMMAND(ColorControl, StopMoveStep)                                                                                            \
+    CLUSTER_END(ColorControl)                                                                                                      \
+    CLUSTER_BEGIN(DiagnosticLogs)                                                                                                  \
+    COMMAND(DiagnosticLogs, RetrieveLogsRequest)                                                                                   \
+    CLUSTER_END(DiagnosticLogs)                                                                                                    \
+    CLUSTER_BEGIN(DoorLock)                                                                                                        \
+    COMMAND(DoorLock, ClearAllPins)                                                                                                \
+    COMMAND(DoorLock, ClearAllRfids)                                                                                               \
+    COMMAND(DoorLock, ClearHolidaySchedule)                                                                                        \
+    COMMAND(DoorLock, ClearPin)                                                                                                    \
+    COMMAND(DoorLock, ClearRfid)                                                                                                   \
+    COMMAND(DoorLock, ClearWeekdaySchedule)                                                                                        \
+    COMMAND(DoorLock, ClearYeardaySchedule)                                                                                        \
+    COMMAND(DoorLock, GetHolidaySchedule)                                                                                          \
+    COMMAND(DoorLock, GetLogRecord)                                                                                                \
+    COMMAND(DoorLock, GetPin)                                                                                                      \
+    COMMAND(DoorLock, GetRfid)                                                                                                     \
+    COMMAND(DoorLock, GetUserType)                                                                                                 \
+    COMMAND(DoorLock, GetWeekdaySchedule)                                                                                          \
+    COMMAND(DoorLock, GetYeardaySchedule)                                                                                          \
+    COMMAND(DoorLock, LockDoor)                                                                                                    \
+    COMMAND(DoorLock, SetHolidaySchedule)                                                                                          \
+    COMMAND(DoorLock, SetPin)                                                                                                      \
+    COMMAND(DoorLock, SetRfid)                                                                                                     \
+    COMMAND(DoorLock, SetUserType)                                                                                                 \
+    COMMAND(DoorLock, SetWeekdaySchedule)                                                                                          \
+    COMMAND(DoorLock, SetYeardaySchedule)                                                                                          \
+    COMMAND(DoorLock, UnlockDoor)                                                                                                  \
+    COMMAND(DoorLock, UnlockWithTimeout)                                                                                           \
+    CLUSTER_END(DoorLock)                                                                                                          \
+    CLUSTER_BEGIN(GeneralCommissioning)                                                                                            \
+    COMMAND(GeneralCommissioning, ArmFailSafe)                                                                                     \
+    COMMAND(GeneralCommissioning, CommissioningComplete)                                                                           \
+    COMMAND(GeneralCommissioning, SetRegulatoryConfig)                                                                             \
+    CLUSTER_END(GeneralCommissioning)                                                                                              \
+    CLUSTER_BEGIN(Groups)                                                                                                          \
+    COMMAND(Groups, AddGroup)                                                                                                      \
+    COMMAND(Groups, AddGroupIfIdentifying)                                                                                         \
+    COMMAND(Groups, GetGroupMembership)                                                                                            \
+    COMMAND(Groups, RemoveAllGroups)                                                                                               \
+    COMMAND(Groups, RemoveGroup)                                                                                                   \
+    COMMAND(Groups, ViewGroup)                                                                                                     \
+    CLUSTER_END(Groups)                                                                                                            \
+    CLUSTER_BEGIN(IasZone)                                                                                                         \
+    COMMAND(IasZone, ZoneEnrollResponse)                                                                                           \
+    CLUSTER_END(IasZone)                                                                                                           \
+    CLUSTER_BEGIN(Identify)                                                                                                        \
+    COMMAND(Identify, Identify)                                                                                                    \
+    COMMAND(Identify, IdentifyQuery)                                                                                               \
+    CLUSTER_END(Identify)                                                                                                          \
+    CLUSTER_BEGIN(LevelControl)                                                                                                    \
+    COMMAND(LevelControl, Move)                                                                                                    \
+    COMMAND(LevelControl, MoveToLevel)                                                                                             \
+    COMMAND(LevelControl, MoveToLevelWithOnOff)                                                                                    \
+    COMMAND(LevelControl, MoveWithOnOff)                                                                                           \
+    COMMAND(LevelControl, Step)                                                                                                    \
+    COMMAND(LevelControl, StepWithOnOff)                                                                                           \
+    COMMAND(LevelControl, Stop)                                                                                                    \
+    COMMAND(LevelControl, StopWithOnOff)                                                                                           \
+    CLUSTER_END(LevelControl)                                                                                                      \
+    CLUSTER_BEGIN(LowPower)                                                                                                        \
+    COMMAND(LowPower, Sleep)                                                                                                       \
+    CLUSTER_END(LowPower)                                                                                                          \
+    CLUSTER_BEGIN(NetworkCommissioning)                                                                                            \
+    COMMAND(NetworkCommissioning, AddThreadNetwork)                                                                                \
+    COMMAND(NetworkCommissioning, AddWiFiNetwork)                                                                                  \
+    COMMAND(NetworkCommissioning, DisableNetwork)                                                                                  \
+    COMMAND(NetworkCommissioning, EnableNetwork)                                                                                   \
+    COMMAND(NetworkCommissioning, GetLastNetworkCommissioningResult)                                                               \
+    COMMAND(NetworkCommissioning, RemoveNetwork)                                                                                   \
+    COMMAND(NetworkCommissioning, ScanNetworks)                                                                                    \
+    COMMAND(NetworkCommissioning, UpdateThreadNetwork)                                                                             \
+    COMMAND(NetworkCommissioning, UpdateWiFiNetwork)                                                                               \
+    CLUSTER_END(NetworkCommissioning)                                                                                              \
+    CLUSTER_BEGIN(OtaSoftwareUpdateProvider)                                                                                       \
+    COMMAND(OtaSoftwareUpdateProvider, ApplyUpdateRequest)                                                                         \
+    COMMAND(OtaSoftwareUpdateProvider, NotifyUpdateApplied)                                                                        \
+    COMMAND(OtaSoftwareUpdateProvider, QueryImage)                                                                                 \
+    CLUSTER_END(OtaSoftwareUpdateProvider)                                                                                         \
+    CLUSTER_BEGIN(OnOff)                                                                                                           \
+    COMMAND(OnOff, Off)                                                                                                            \
+    COMMAND(OnOff, On)                                                                                                             \
+    COMMAND(OnOff, Toggle)                                                                                                         \
+    CLUSTER_END(OnOff)                                                                                                             \
+    CLUSTER_BEGIN(OperationalCredentials)                                                                                          \
+    COMMAND(OperationalCredentials, AddOpCert)                                                                                     \
+    COMMAND(OperationalCredentials, AddTrustedRootCertificate)                                                                     \
+    COMMAND(OperationalCredentials, OpCSRRequest)                                                                                  \
+    COMMAND(OperationalCredentials, RemoveAllFabrics)                                                                              \
+    COMMAND(OperationalCredentials, RemoveFabric)                                                                                  \
+    COMMAND(OperationalCredentials, RemoveTrustedRootCertificate)                                                                  \
+    COMMAND(OperationalCredentials, SetFabric)                                                                                     \
+    COMMAND(OperationalCredentials, UpdateFabricLabel)                                                                             \
+    CLUSTER_END(OperationalCredentials)                                                                                            \
+    CLUSTER_BEGIN(Scenes)                                                                                                          \
+    COMMAND(Scenes, AddScene)                                                                                                      \
+    COMMAND(Scenes, GetSceneMembership)                                                                                            \
+    COMMAND(Scenes, RecallScene)                                                                                                   \
+    COMMAND(Scenes, RemoveAllScenes)                                                                                               \
+    COMMAND(Scenes, RemoveScene)                                                                                                   \
+    COMMAND(Scenes, StoreScene)                                                                                                    \
+    COMMAND(Scenes, ViewScene)                                                                                                     \
+    CLUSTER_END(Scenes)                                                                                                            \
+    CLUSTER_BEGIN(TestCluster)                                                                                                     \
+    COMMAND(TestCluster, Test)                                                                                                     \
+    COMMAND(TestCluster, TestNotHandled)                                                                                           \
+    COMMAND(TestCluster, TestSpecific)                                                                                             \
+    CLUSTER_END(TestCluster)
+
+namespace {
+
+constexpr size_t kSequenceLength = 4096;
+constexpr int kRounds            = 500;
+
+uint64_t sDispatched;
+
+// A handler of a command without arguments: it reads the end of the Data structure, like the generated handlers
+// do before calling the cluster callback.
+template <ClusterId kClusterId, CommandId kCommandId>
+void Dispatch(Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv)
+{
+    if (aDataTlv.Next() == CHIP_END_OF_TLV)
+    {
+        sDispatched += (static_cast<uint64_t>(kClusterId) << 32) | kCommandId;
+    }
+}
+
+#define TABLE_CLUSTER(cluster)
+#define TABLE_COMMAND(cluster, command)                                                                                            \
+    { Clusters::cluster::Id, Clusters::cluster::Commands::Ids::command,                                                            \
+      Dispatch<Clusters::cluster::Id, Clusters::cluster::Commands::Ids::command> },
+
+constexpr CommandDispatchEntry kEntries[] = { ALL_CLUSTERS_APP_COMMANDS(TABLE_CLUSTER, TABLE_COMMAND, TABLE_CLUSTER) };
+constexpr auto kTable                     = MakeCommandDispatchTable(kEntries);
+static_assert(kTable.IsValid(), "Each command must have a single handler");
+
+bool DispatchWithTable(ClusterId aClusterId, CommandId aCommandId, TLV::TLVReader & aReader)
+{
+    CommandDispatchFunction dispatch = kTable.Find(aClusterId, aCommandId);
+    if (dispatch == nullptr)
+    {
+        return false;
+    }
+    dispatch(nullptr, 1, aReader);
+    return true;
+}
+
+#define SWITCH_CLUSTER_BEGIN(cluster)                                                                                              \
+    case Clusters::cluster::Id:                                                                                                    \
+        switch (aCommandId)                                                                                                        \
+        {
+#define SWITCH_COMMAND(cluster, command)                                                                                           \
+    case Clusters::cluster::Commands::Ids::command:                                                                                \
+        Dispatch<Clusters::cluster::Id, Clusters::cluster::Commands::Ids::command>(nullptr, 1, aReader);                           \
+        return true;
+#define SWITCH_CLUSTER_END(cluster)                                                                                                \
+    }                                                                                                                              \
+    break;
+
+bool DispatchWithSwitch(ClusterId aClusterId, CommandId aCommandId, TLV::TLVReader & aReader)
+{
+    switch (aClusterId)
+    {
+        ALL_CLUSTERS_APP_COMMANDS(SWITCH_CLUSTER_BEGIN, SWITCH_COMMAND, SWITCH_CLUSTER_END)
+    }
+    return false;
+}
+
+struct CommandPath
+{
+    ClusterId mClusterId;
+    CommandId mCommandId;
+};
+
+CommandPath sSequence[kSequenceLength];
+
+/**
+ *  Dispatch the sequence of commands kRounds times, and return the average time of a dispatch in nanoseconds, or
+ *  a negative value if a command was not found.
+ */
+double TimeDispatch(bool (*dispatch)(ClusterId, CommandId, TLV::TLVReader &), uint64_t & dispatched)
+{
+    static const uint8_t kEmptyData[] = { 0x15, 0x18 };
+    TLV::TLVReader reader;
+    TLV::TLVType dataTlvType;
+
+    reader.Init(kEmptyData, sizeof(kEmptyData));
+    VerifyOrReturnError(reader.Next() == CHIP_NO_ERROR && reader.EnterContainer(dataTlvType) == CHIP_NO_ERROR, -1);
+
+    sDispatched = 0;
+    auto start  = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        for (const CommandPath & path : sSequence)
+        {
+            VerifyOrReturnError(dispatch(path.mClusterId, path.mCommandId, reader), -1);
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    dispatched = sDispatched;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / (kRounds * kSequenceLength);
+}
+
+} // namespace
+
+int main()
+{
+    constexpr size_t kCommandCount = sizeof(kEntries) / sizeof(kEntries[0]);
+
+    // The commands in a random order, so that neither form benefits from a predictable sequence.
+    for (CommandPath & path : sSequence)
+    {
+        const CommandDispatchEntry & entry = kEntries[static_cast<size_t>(rand()) % kCommandCount];
+        path                               = { entry.mClusterId, entry.mCommandId };
+    }
+
+    uint64_t switchDispatched = 0;
+    uint64_t tableDispatched  = 0;
+    const double switchTime   = TimeDispatch(DispatchWithSwitch, switchDispatched);
+    const double tableTime    = TimeDispatch(DispatchWithTable, tableDispatched);
+
+    if (switchTime < 0 || tableTime < 0 || switchDispatched != tableDispatched)
+    {
+        fprintf(stderr, "The switch and the table did not dispatch the commands to the same handlers\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("%zu commands of the all-clusters app: %.1f ns per dispatch with a switch, %.1f ns with the table\n", kCommandCount,
+           switchTime, tableTime);
+    return EXIT_SUCCESS;
+}
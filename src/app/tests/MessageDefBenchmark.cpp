@@ -0,0 +1,310 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the decoding of large Interaction Model messages
+ *      with the MessageDef parsers. It compares the parsers, which index the context tags of
+ *      their container, to lookups that scan the container from its beginning for every field.
+ *
+ */
+
+#include <app/MessageDef/ReadRequest.h>
+#include <app/MessageDef/ReportData.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/ScopedBuffer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace chip;
+using namespace chip::app;
+using chip::TLV::ContextTag;
+
+namespace {
+
+constexpr uint32_t kLargeMessageElementCount  = 1000;
+constexpr uint8_t kLargeMessageDataFieldCount = 16;
+constexpr uint32_t kLargeMessageBufferSize    = 256 * 1024;
+constexpr unsigned kDecodeBenchmarkIterations = 50;
+
+void BuildLargeReportData(TLV::TLVWriter & aWriter)
+{
+    ReportData::Builder reportDataBuilder;
+
+    VerifyOrDie(reportDataBuilder.Init(&aWriter) == CHIP_NO_ERROR);
+    reportDataBuilder.SuppressResponse(true).SubscriptionId(2);
+
+    AttributeDataList::Builder & attributeDataListBuilder = reportDataBuilder.CreateAttributeDataListBuilder();
+    for (uint32_t i = 0; i < kLargeMessageElementCount; i++)
+    {
+        AttributeDataElement::Builder & attributeDataElementBuilder = attributeDataListBuilder.CreateAttributeDataElementBuilder();
+        AttributePath::Builder & attributePathBuilder = attributeDataElementBuilder.CreateAttributePathBuilder();
+        attributePathBuilder.NodeId(1).EndpointId(2).ClusterId(3).FieldId(i).EndOfAttributePath();
+        attributeDataElementBuilder.DataVersion(i);
+
+        // The data precedes the more cluster data flag, so it is parsed again by every lookup that starts from the
+        // beginning of the element.
+        TLV::TLVWriter * pWriter = attributeDataElementBuilder.GetWriter();
+        TLV::TLVType dummyType   = TLV::kTLVType_NotSpecified;
+        VerifyOrDie(pWriter->StartContainer(ContextTag(AttributeDataElement::kCsTag_Data), TLV::kTLVType_Structure, dummyType) ==
+                    CHIP_NO_ERROR);
+        for (uint8_t field = 0; field < kLargeMessageDataFieldCount; field++)
+        {
+            VerifyOrDie(pWriter->Put(ContextTag(field), i + field) == CHIP_NO_ERROR);
+        }
+        VerifyOrDie(pWriter->EndContainer(dummyType) == CHIP_NO_ERROR);
+
+        attributeDataElementBuilder.MoreClusterData(true).EndOfAttributeDataElement();
+        VerifyOrDie(attributeDataElementBuilder.GetError() == CHIP_NO_ERROR);
+    }
+    attributeDataListBuilder.EndOfAttributeDataList();
+
+    reportDataBuilder.MoreChunkedMessages(true).EndOfReportData();
+    VerifyOrDie(reportDataBuilder.GetError() == CHIP_NO_ERROR);
+}
+
+uint32_t DecodeLargeReportData(const TLV::TLVReader & aReader)
+{
+    ReportData::Parser reportDataParser;
+    AttributeDataList::Parser attributeDataListParser;
+    bool moreChunkedMessages = false;
+    uint32_t count           = 0;
+
+    VerifyOrDie(reportDataParser.Init(aReader) == CHIP_NO_ERROR);
+    VerifyOrDie(reportDataParser.GetAttributeDataList(&attributeDataListParser) == CHIP_NO_ERROR);
+    VerifyOrDie(reportDataParser.GetMoreChunkedMessages(&moreChunkedMessages) == CHIP_NO_ERROR && moreChunkedMessages);
+
+    while (attributeDataListParser.Next() == CHIP_NO_ERROR)
+    {
+        TLV::TLVReader reader;
+        AttributeDataElement::Parser attributeDataElementParser;
+        AttributePath::Parser attributePathParser;
+        AttributeId fieldId      = 0;
+        DataVersion version      = 0;
+        bool moreClusterDataFlag = false;
+
+        attributeDataListParser.GetReader(&reader);
+        VerifyOrDie(attributeDataElementParser.Init(reader) == CHIP_NO_ERROR);
+        VerifyOrDie(attributeDataElementParser.GetAttributePath(&attributePathParser) == CHIP_NO_ERROR);
+        VerifyOrDie(attributePathParser.GetFieldId(&fieldId) == CHIP_NO_ERROR && fieldId == count);
+        VerifyOrDie(attributeDataElementParser.GetDataVersion(&version) == CHIP_NO_ERROR && version == count);
+        VerifyOrDie(attributeDataElementParser.GetData(&reader) == CHIP_NO_ERROR);
+        VerifyOrDie(attributeDataElementParser.GetMoreClusterDataFlag(&moreClusterDataFlag) == CHIP_NO_ERROR);
+        VerifyOrDie(moreClusterDataFlag);
+        count++;
+    }
+
+    return count;
+}
+
+// Looks up the same fields as DecodeLargeReportData(), the way the parsers do without a tag index, i.e. by scanning the
+// container from its beginning for every field.
+uint32_t DecodeLargeReportDataByRescan(const TLV::TLVReader & aReader)
+{
+    TLV::TLVReader reportData;
+    TLV::TLVReader attributeDataList;
+    TLV::TLVReader field;
+    TLV::TLVType containerType;
+    uint32_t count = 0;
+
+    reportData.Init(aReader);
+    VerifyOrDie(reportData.EnterContainer(containerType) == CHIP_NO_ERROR);
+    VerifyOrDie(reportData.FindElementWithTag(ContextTag(ReportData::kCsTag_AttributeDataList), attributeDataList) ==
+                CHIP_NO_ERROR);
+    VerifyOrDie(reportData.FindElementWithTag(ContextTag(ReportData::kCsTag_MoreChunkedMessages), field) == CHIP_NO_ERROR);
+
+    VerifyOrDie(attributeDataList.EnterContainer(containerType) == CHIP_NO_ERROR);
+    while (attributeDataList.Next() == CHIP_NO_ERROR)
+    {
+        TLV::TLVReader attributeDataElement;
+        TLV::TLVReader attributePath;
+        AttributeId fieldId = 0;
+        DataVersion version = 0;
+
+        attributeDataElement.Init(attributeDataList);
+        VerifyOrDie(attributeDataElement.EnterContainer(containerType) == CHIP_NO_ERROR);
+
+        VerifyOrDie(attributeDataElement.FindElementWithTag(ContextTag(AttributeDataElement::kCsTag_AttributePath),
+                                                            attributePath) == CHIP_NO_ERROR);
+        VerifyOrDie(attributePath.EnterContainer(containerType) == CHIP_NO_ERROR);
+        VerifyOrDie(attributePath.FindElementWithTag(ContextTag(AttributePath::kCsTag_FieldId), field) == CHIP_NO_ERROR);
+        VerifyOrDie(field.Get(fieldId) == CHIP_NO_ERROR && fieldId == count);
+
+        VerifyOrDie(attributeDataElement.FindElementWithTag(ContextTag(AttributeDataElement::kCsTag_DataVersion), field) ==
+                    CHIP_NO_ERROR);
+        VerifyOrDie(field.Get(version) == CHIP_NO_ERROR && version == count);
+
+        VerifyOrDie(attributeDataElement.FindElementWithTag(ContextTag(AttributeDataElement::kCsTag_Data), field) == CHIP_NO_ERROR);
+        VerifyOrDie(attributeDataElement.FindElementWithTag(ContextTag(AttributeDataElement::kCsTag_MoreClusterDataFlag), field) ==
+                    CHIP_NO_ERROR);
+        count++;
+    }
+
+    return count;
+}
+
+void BuildLargeReadRequest(TLV::TLVWriter & aWriter)
+{
+    ReadRequest::Builder readRequestBuilder;
+
+    VerifyOrDie(readRequestBuilder.Init(&aWriter) == CHIP_NO_ERROR);
+
+    AttributePathList::Builder & attributePathListBuilder = readRequestBuilder.CreateAttributePathListBuilder();
+    for (uint32_t i = 0; i < kLargeMessageElementCount; i++)
+    {
+        AttributePath::Builder & attributePathBuilder = attributePathListBuilder.CreateAttributePathBuilder();
+        attributePathBuilder.NodeId(1).EndpointId(2).ClusterId(3).FieldId(i).ListIndex(5).EndOfAttributePath();
+        VerifyOrDie(attributePathBuilder.GetError() == CHIP_NO_ERROR);
+    }
+    attributePathListBuilder.EndOfAttributePathList();
+
+    readRequestBuilder.EventNumber(1).EndOfReadRequest();
+    VerifyOrDie(readRequestBuilder.GetError() == CHIP_NO_ERROR);
+}
+
+uint32_t DecodeLargeReadRequest(const TLV::TLVReader & aReader)
+{
+    ReadRequest::Parser readRequestParser;
+    AttributePathList::Parser attributePathListParser;
+    uint64_t eventNumber = 0;
+    uint32_t count       = 0;
+
+    VerifyOrDie(readRequestParser.Init(aReader) == CHIP_NO_ERROR);
+    VerifyOrDie(readRequestParser.GetAttributePathList(&attributePathListParser) == CHIP_NO_ERROR);
+    VerifyOrDie(readRequestParser.GetEventNumber(&eventNumber) == CHIP_NO_ERROR);
+
+    while (attributePathListParser.Next() == CHIP_NO_ERROR)
+    {
+        TLV::TLVReader reader;
+        AttributePath::Parser attributePathParser;
+        NodeId nodeId         = 0;
+        EndpointId endpointId = 0;
+        ClusterId clusterId   = 0;
+        AttributeId fieldId   = 0;
+        ListIndex listIndex   = 0;
+
+        attributePathListParser.GetReader(&reader);
+        VerifyOrDie(attributePathParser.Init(reader) == CHIP_NO_ERROR);
+        VerifyOrDie(attributePathParser.GetNodeId(&nodeId) == CHIP_NO_ERROR);
+        VerifyOrDie(attributePathParser.GetEndpointId(&endpointId) == CHIP_NO_ERROR);
+        VerifyOrDie(attributePathParser.GetClusterId(&clusterId) == CHIP_NO_ERROR);
+        VerifyOrDie(attributePathParser.GetFieldId(&fieldId) == CHIP_NO_ERROR && fieldId == count);
+        VerifyOrDie(attributePathParser.GetListIndex(&listIndex) == CHIP_NO_ERROR && listIndex == 5);
+        count++;
+    }
+
+    return count;
+}
+
+uint32_t DecodeLargeReadRequestByRescan(const TLV::TLVReader & aReader)
+{
+    TLV::TLVReader readRequest;
+    TLV::TLVReader attributePathList;
+    TLV::TLVReader field;
+    TLV::TLVType containerType;
+    uint32_t count = 0;
+
+    readRequest.Init(aReader);
+    VerifyOrDie(readRequest.EnterContainer(containerType) == CHIP_NO_ERROR);
+    VerifyOrDie(readRequest.FindElementWithTag(ContextTag(ReadRequest::kCsTag_AttributePathList), attributePathList) ==
+                CHIP_NO_ERROR);
+    VerifyOrDie(readRequest.FindElementWithTag(ContextTag(ReadRequest::kCsTag_EventNumber), field) == CHIP_NO_ERROR);
+
+    VerifyOrDie(attributePathList.EnterContainer(containerType) == CHIP_NO_ERROR);
+    while (attributePathList.Next() == CHIP_NO_ERROR)
+    {
+        TLV::TLVReader attributePath;
+        AttributeId fieldId = 0;
+
+        attributePath.Init(attributePathList);
+        VerifyOrDie(attributePath.EnterContainer(containerType) == CHIP_NO_ERROR);
+        for (uint8_t tag = AttributePath::kCsTag_NodeId; tag <= AttributePath::kCsTag_ListIndex; tag++)
+        {
+            VerifyOrDie(attributePath.FindElementWithTag(ContextTag(tag), field) == CHIP_NO_ERROR);
+        }
+        VerifyOrDie(field.Get(fieldId) == CHIP_NO_ERROR);
+        count++;
+    }
+
+    return count;
+}
+
+// Returns the number of elements decoded per second, over the fastest of several decodes of the message.
+template <typename DecodeFunction>
+uint64_t MeasureDecodeRate(const TLV::TLVReader & aReader, DecodeFunction aDecode)
+{
+    using Clock = std::chrono::steady_clock;
+
+    int64_t fastestUs = INT64_MAX;
+    for (unsigned i = 0; i < kDecodeBenchmarkIterations; i++)
+    {
+        const auto start = Clock::now();
+        VerifyOrDie(aDecode(aReader) == kLargeMessageElementCount);
+        const int64_t elapsedUs =
+            static_cast<int64_t>(std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count());
+        fastestUs = std::min(fastestUs, elapsedUs);
+    }
+
+    return static_cast<uint64_t>(kLargeMessageElementCount) * 1000000 / static_cast<uint64_t>(fastestUs + 1);
+}
+
+} // namespace
+
+int main()
+{
+    Platform::ScopedMemoryBuffer<uint8_t> buf;
+    TLV::TLVWriter writer;
+    TLV::TLVReader reader;
+
+    VerifyOrDie(Platform::MemoryInit() == CHIP_NO_ERROR);
+
+    VerifyOrDie(buf.Alloc(kLargeMessageBufferSize));
+
+    writer.Init(buf.Get(), kLargeMessageBufferSize);
+    BuildLargeReportData(writer);
+    VerifyOrDie(writer.Finalize() == CHIP_NO_ERROR);
+
+    reader.Init(buf.Get(), writer.GetLengthWritten());
+    VerifyOrDie(reader.Next() == CHIP_NO_ERROR);
+
+    printf("ReportData with %" PRIu32 " attribute data elements (%" PRIu32 " bytes):\n", kLargeMessageElementCount,
+           writer.GetLengthWritten());
+    printf("  Rescan:  %" PRIu64 " elements/s\n", MeasureDecodeRate(reader, DecodeLargeReportDataByRescan));
+    printf("  Indexed: %" PRIu64 " elements/s\n", MeasureDecodeRate(reader, DecodeLargeReportData));
+
+    writer.Init(buf.Get(), kLargeMessageBufferSize);
+    BuildLargeReadRequest(writer);
+    VerifyOrDie(writer.Finalize() == CHIP_NO_ERROR);
+
+    reader.Init(buf.Get(), writer.GetLengthWritten());
+    VerifyOrDie(reader.Next() == CHIP_NO_ERROR);
+
+    printf("ReadRequest with %" PRIu32 " attribute paths (%" PRIu32 " bytes):\n", kLargeMessageElementCount,
+           writer.GetLengthWritten());
+    printf("  Rescan:  %" PRIu64 " paths/s\n", MeasureDecodeRate(reader, DecodeLargeReadRequestByRescan));
+    printf("  Indexed: %" PRIu64 " paths/s\n", MeasureDecodeRate(reader, DecodeLargeReadRequest));
+
+    buf.Free();
+    Platform::MemoryShutdown();
+    return EXIT_SUCCESS;
+}
@@ -292,6 +292,106 @@ void ShouldFailGetCanceledResponseCallback(nlTestSuite * testSuite, void * apCon
     }
 }
 
+void ShouldPeekResponseCallback(nlTestSuite * testSuite, void * apContext)
+{
+    auto & callbacks = CHIPDeviceCallbacksMgr::GetInstance();
+
+    static constexpr NodeId kTestNodeId    = 0x9b3780f93739918d;
+    static constexpr uint8_t kTestSequence = 0x8b;
+
+    const auto onSuccess = [](void * opaqueContext, uint64_t value) {};
+    const auto onFailure = [](void * opaqueContext, CHIP_ERROR error) {};
+
+    Callback::Callback<SuccessCallback> successCallback{ onSuccess, nullptr };
+    Callback::Callback<FailureCallback> failureCallback{ onFailure, nullptr };
+
+    {
+        Callback::Cancelable * successCancelable = nullptr;
+        CHIP_ERROR error = callbacks.PeekResponseCallback(kTestNodeId, kTestSequence, &successCancelable);
+        NL_TEST_ASSERT(testSuite, error == CHIP_ERROR_KEY_NOT_FOUND);
+    }
+
+    {
+        CHIP_ERROR error =
+            callbacks.AddResponseCallback(kTestNodeId, kTestSequence, successCallback.Cancel(), failureCallback.Cancel());
+        NL_TEST_ASSERT(testSuite, error == CHIP_NO_ERROR);
+    }
+
+    // Peeking leaves the callbacks registered.
+    for (int i = 0; i < 2; i++)
+    {
+        Callback::Cancelable * successCancelable = nullptr;
+        CHIP_ERROR error = callbacks.PeekResponseCallback(kTestNodeId, kTestSequence, &successCancelable);
+        NL_TEST_ASSERT(testSuite, error == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(testSuite, decltype(successCallback)::FromCancelable(successCancelable) == &successCallback);
+    }
+
+    {
+        Callback::Cancelable * successCancelable = nullptr;
+        Callback::Cancelable * failureCancelable = nullptr;
+        CHIP_ERROR error = callbacks.GetResponseCallback(kTestNodeId, kTestSequence, &successCancelable, &failureCancelable);
+        NL_TEST_ASSERT(testSuite, error == CHIP_NO_ERROR);
+    }
+
+    {
+        Callback::Cancelable * successCancelable = nullptr;
+        CHIP_ERROR error = callbacks.PeekResponseCallback(kTestNodeId, kTestSequence, &successCancelable);
+        NL_TEST_ASSERT(testSuite, error == CHIP_ERROR_KEY_NOT_FOUND);
+    }
+}
+
+void ShouldCancelResponseCallbackByCallback(nlTestSuite * testSuite, void * apContext)
+{
+    auto & callbacks = CHIPDeviceCallbacksMgr::GetInstance();
+
+    static constexpr NodeId kTestNodeId           = 0x9b3780f93739918d;
+    static constexpr EndpointId kTestEndpointId   = 0x20;
+    static constexpr ClusterId kTestClusterId     = 0x9103;
+    static constexpr AttributeId kTestAttributeId = 0x2232;
+
+    const auto onSuccess = [](void * opaqueContext, uint64_t value) {};
+    const auto onFailure = [](void * opaqueContext, CHIP_ERROR error) {};
+    const auto filter    = [](TLV::TLVReader * data, Callback::Cancelable * success, Callback::Cancelable * failure) {};
+
+    // Twice as many requests as there are TLV filters: the filter of a canceled request must be freed.
+    for (size_t i = 0; i < 2 * kTLVFilterPoolSize; i++)
+    {
+        const uint8_t sequenceNumber = static_cast<uint8_t>(i);
+
+        Callback::Callback<SuccessCallback> successCallback{ onSuccess, nullptr };
+        Callback::Callback<FailureCallback> failureCallback{ onFailure, nullptr };
+
+        // Keep the cancelables, as Cancel() would unregister the callbacks once registered.
+        Callback::Cancelable * successCancelable = successCallback.Cancel();
+        Callback::Cancelable * failureCancelable = failureCallback.Cancel();
+
+        CHIP_ERROR error = callbacks.AddResponseCallback(kTestNodeId, sequenceNumber, successCancelable, failureCancelable, filter);
+        NL_TEST_ASSERT(testSuite, error == CHIP_NO_ERROR);
+
+        error = callbacks.CancelResponseCallback(i % 2 == 0 ? successCancelable : failureCancelable);
+        NL_TEST_ASSERT(testSuite, error == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(testSuite, !successCallback.IsRegistered() && !failureCallback.IsRegistered());
+
+        error = callbacks.GetResponseCallback(kTestNodeId, sequenceNumber, &successCancelable, &failureCancelable);
+        NL_TEST_ASSERT(testSuite, error == CHIP_ERROR_KEY_NOT_FOUND);
+        NL_TEST_ASSERT(testSuite, callbacks.CancelResponseCallback(successCancelable) == CHIP_ERROR_KEY_NOT_FOUND);
+    }
+
+    // A callback registered for a report is not canceled.
+    {
+        Callback::Callback<SuccessCallback> reportCallback{ onSuccess, nullptr };
+        CHIP_ERROR error =
+            callbacks.AddReportCallback(kTestNodeId, kTestEndpointId, kTestClusterId, kTestAttributeId, reportCallback.Cancel());
+        NL_TEST_ASSERT(testSuite, error == CHIP_NO_ERROR);
+
+        Callback::Cancelable * reportCancelable = nullptr;
+        error = callbacks.GetReportCallback(kTestNodeId, kTestEndpointId, kTestClusterId, kTestAttributeId, &reportCancelable);
+        NL_TEST_ASSERT(testSuite, error == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(testSuite, callbacks.CancelResponseCallback(reportCancelable) == CHIP_ERROR_KEY_NOT_FOUND);
+        NL_TEST_ASSERT(testSuite, reportCallback.IsRegistered());
+    }
+}
+
 void ShouldGetSingleReportCallback(nlTestSuite * testSuite, void * apContext)
 {
     auto & callbacks = CHIPDeviceCallbacksMgr::GetInstance();
@@ -419,9 +519,11 @@ const nlTest sTests[] = {
     NL_TEST_DEF("ShouldGetSingleResponseCallback", chip::app::ShouldGetSingleResponseCallback),             //
     NL_TEST_DEF("ShouldGetMultipleResponseCallbacks", chip::app::ShouldGetMultipleResponseCallbacks),       //
     NL_TEST_DEF("ShouldFailGetCanceledResponseCallback", chip::app::ShouldFailGetCanceledResponseCallback), //
-    NL_TEST_DEF("ShouldGetSingleReportCallback", chip::app::ShouldGetSingleReportCallback),                 //
-    NL_TEST_DEF("ShouldFailGetCanceledReportCallback", chip::app::ShouldFailGetCanceledReportCallback),     //
-    NL_TEST_SENTINEL(),                                                                                     //
+    NL_TEST_DEF("ShouldPeekResponseCallback", chip::app::ShouldPeekResponseCallback),                         //
+    NL_TEST_DEF("ShouldCancelResponseCallbackByCallback", chip::app::ShouldCancelResponseCallbackByCallback), //
+    NL_TEST_DEF("ShouldGetSingleReportCallback", chip::app::ShouldGetSingleReportCallback),                   //
+    NL_TEST_DEF("ShouldFailGetCanceledReportCallback", chip::app::ShouldFailGetCanceledReportCallback),       //
+    NL_TEST_SENTINEL(),                                                                                       //
 };
 
 int TestCHIPDeviceCallbacksMgr()
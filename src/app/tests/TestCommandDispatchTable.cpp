@@ -0,0 +1,109 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for CommandDispatchTable
+ *
+ */
+
+#include <app/CommandDispatchTable.h>
+#include <nlunit-test.h>
+#include <support/UnitTestRegistration.h>
+
+namespace chip {
+namespace app {
+namespace TestCommandDispatchTable {
+
+void DispatchA(Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv) {}
+void DispatchB(Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv) {}
+void DispatchC(Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv) {}
+void DispatchD(Command * apCommandObj, EndpointId aEndpointId, TLV::TLVReader & aDataTlv) {}
+
+// Not in order, as the generated entries are in the order of the cluster names.
+constexpr CommandDispatchEntry kEntries[] = {
+    { 0x0300, 0x01, DispatchC },
+    { 0x0006, 0x02, DispatchB },
+    { 0x0300, 0x00, DispatchD },
+    { 0x0006, 0x00, DispatchA },
+};
+
+constexpr auto kTable = MakeCommandDispatchTable(kEntries);
+static_assert(kTable.IsValid(), "The entries must be sorted and unique");
+
+constexpr CommandDispatchEntry kDuplicateEntries[] = {
+    { 0x0006, 0x00, DispatchA },
+    { 0x0008, 0x00, DispatchB },
+    { 0x0006, 0x00, DispatchC },
+};
+static_assert(!MakeCommandDispatchTable(kDuplicateEntries).IsValid(), "A duplicate command must be rejected");
+
+constexpr CommandDispatchEntry kNullEntries[] = {
+    { 0x0006, 0x00, DispatchA },
+    { 0x0006, 0x01, nullptr },
+};
+static_assert(!MakeCommandDispatchTable(kNullEntries).IsValid(), "A command without a handler must be rejected");
+
+void TestFind(nlTestSuite * apSuite, void * apContext)
+{
+    NL_TEST_ASSERT(apSuite, kTable.Find(0x0006, 0x00) == DispatchA);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0x0006, 0x02) == DispatchB);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0x0300, 0x01) == DispatchC);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0x0300, 0x00) == DispatchD);
+}
+
+void TestFindUnknownCommand(nlTestSuite * apSuite, void * apContext)
+{
+    NL_TEST_ASSERT(apSuite, kTable.Find(0x0006, 0x01) == nullptr);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0x0006, 0x03) == nullptr);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0x0300, 0x02) == nullptr);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0x0000, 0x00) == nullptr);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0x0008, 0x00) == nullptr);
+    NL_TEST_ASSERT(apSuite, kTable.Find(0xFFFFFFFF, 0xFFFFFFFF) == nullptr);
+}
+
+void TestHasCluster(nlTestSuite * apSuite, void * apContext)
+{
+    NL_TEST_ASSERT(apSuite, kTable.HasCluster(0x0006));
+    NL_TEST_ASSERT(apSuite, kTable.HasCluster(0x0300));
+    NL_TEST_ASSERT(apSuite, !kTable.HasCluster(0x0000));
+    NL_TEST_ASSERT(apSuite, !kTable.HasCluster(0x0008));
+    NL_TEST_ASSERT(apSuite, !kTable.HasCluster(0xFFFFFFFF));
+}
+
+} // namespace TestCommandDispatchTable
+} // namespace app
+} // namespace chip
+
+namespace {
+const nlTest sTests[] = { NL_TEST_DEF("TestFind", chip::app::TestCommandDispatchTable::TestFind),
+                          NL_TEST_DEF("TestFindUnknownCommand", chip::app::TestCommandDispatchTable::TestFindUnknownCommand),
+                          NL_TEST_DEF("TestHasCluster", chip::app::TestCommandDispatchTable::TestHasCluster),
+                          NL_TEST_SENTINEL() };
+}
+
+int TestCommandDispatchTable()
+{
+    nlTestSuite theSuite = { "CommandDispatchTable", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCommandDispatchTable)
@@ -1401,6 +1401,73 @@ void CheckPointRollbackTest(nlTestSuite * apSuite, void * apContext)
     NL_TEST_ASSERT(apSuite, NumDataElement == 1);
 }
 
+void BuildAttributeDataElementWithVersion(nlTestSuite * apSuite, chip::TLV::TLVWriter & aWriter, chip::DataVersion aVersion,
+                                          bool aMoreClusterData)
+{
+    AttributeDataElement::Builder attributeDataElementBuilder;
+
+    NL_TEST_ASSERT(apSuite, attributeDataElementBuilder.Init(&aWriter) == CHIP_NO_ERROR);
+    attributeDataElementBuilder.DataVersion(aVersion);
+    if (aMoreClusterData)
+    {
+        attributeDataElementBuilder.MoreClusterData(true);
+    }
+    attributeDataElementBuilder.EndOfAttributeDataElement();
+    NL_TEST_ASSERT(apSuite, attributeDataElementBuilder.GetError() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, aWriter.Finalize() == CHIP_NO_ERROR);
+}
+
+void TagIndexTest(nlTestSuite * apSuite, void * apContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    uint8_t buf[128];
+    chip::TLV::TLVWriter writer;
+    chip::TLV::TLVReader reader;
+    AttributeDataElement::Parser attributeDataElementParser;
+    AttributePath::Parser attributePathParser;
+    chip::DataVersion version = 0;
+    bool moreClusterDataFlag  = false;
+    uint16_t status           = 0;
+
+    writer.Init(buf, sizeof(buf));
+    BuildAttributeDataElementWithVersion(apSuite, writer, 1, true);
+
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, attributeDataElementParser.Init(reader) == CHIP_NO_ERROR);
+
+    // Fields are found in any order, any number of times, and missing ones are reported as such.
+    err = attributeDataElementParser.GetMoreClusterDataFlag(&moreClusterDataFlag);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && moreClusterDataFlag);
+
+    err = attributeDataElementParser.GetDataVersion(&version);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && version == 1);
+
+    version = 0;
+    err     = attributeDataElementParser.GetDataVersion(&version);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && version == 1);
+
+    err = attributeDataElementParser.GetAttributePath(&attributePathParser);
+    NL_TEST_ASSERT(apSuite, err == CHIP_END_OF_TLV);
+
+    err = attributeDataElementParser.GetStatus(&status);
+    NL_TEST_ASSERT(apSuite, err == CHIP_END_OF_TLV);
+
+    // The index of the previous element is not used once the parser is initialized again, even on the same buffer.
+    writer.Init(buf, sizeof(buf));
+    BuildAttributeDataElementWithVersion(apSuite, writer, 7, false);
+
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, attributeDataElementParser.Init(reader) == CHIP_NO_ERROR);
+
+    err = attributeDataElementParser.GetDataVersion(&version);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR && version == 7);
+
+    err = attributeDataElementParser.GetMoreClusterDataFlag(&moreClusterDataFlag);
+    NL_TEST_ASSERT(apSuite, err == CHIP_END_OF_TLV);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -1430,6 +1497,7 @@ const nlTest sTests[] =
                 NL_TEST_DEF("WriteRequestTest", WriteRequestTest),
                 NL_TEST_DEF("WriteResponseTest", WriteResponseTest),
                 NL_TEST_DEF("CheckPointRollbackTest", CheckPointRollbackTest),
+                NL_TEST_DEF("TagIndexTest", TagIndexTest),
                 NL_TEST_SENTINEL()
         };
 // clang-format on
@@ -0,0 +1,820 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements chip-im-load, a load generator for the
+ *      CHIP Interaction Data Model Protocol.
+ *
+ *      It keeps a configurable number of invoke command, read and write
+ *      requests in flight against a chip-im-responder for a given duration,
+ *      and reports the throughput and the latency distribution of each
+ *      kind of request.
+ *
+ */
+
+#include <app/CommandSender.h>
+#include <app/InteractionModelEngine.h>
+#include <app/WriteClient.h>
+#include <app/tests/integration/common.h>
+#include <chrono>
+#include <condition_variable>
+#include <core/CHIPCore.h>
+#include <mutex>
+#include <platform/CHIPDeviceLayer.h>
+#include <protocols/secure_channel/PASESession.h>
+#include <support/CHIPArgParser.hpp>
+#include <support/ErrorStr.h>
+#include <system/SystemLayer.h>
+#include <transport/SecureSessionMgr.h>
+#include <transport/raw/TCP.h>
+#include <transport/raw/UDP.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#define IM_CLIENT_PORT (CHIP_PORT + 1)
+
+namespace {
+
+using namespace chip::ArgParser;
+
+constexpr chip::Transport::AdminId gAdminId = 0;
+
+// The IM engine has a fixed pool of senders and clients per kind of request, which bounds the number of requests in flight.
+constexpr uint32_t kMaxConcurrency = CHIP_MAX_NUM_COMMAND_SENDER + CHIP_MAX_NUM_READ_CLIENT + CHIP_MAX_NUM_WRITE_CLIENT;
+constexpr uint32_t kMaxPayloadSize = 1024;
+// Time left to the requests still in flight at the end of the run to complete, on top of the IM response timeout.
+constexpr uint32_t kDrainMarginSeconds = 2;
+
+enum RequestType : uint8_t
+{
+    kRequestType_Command = 0,
+    kRequestType_Read,
+    kRequestType_Write,
+
+    kRequestType_Count
+};
+
+const char * const kRequestTypeNames[kRequestType_Count] = { "command", "read", "write" };
+
+struct Options
+{
+    uint32_t concurrency                 = 4;
+    uint32_t durationSeconds             = 10;
+    uint32_t weights[kRequestType_Count] = { 1, 1, 1 };
+    uint32_t payloadSize                 = 16;
+    bool useTCP                          = false;
+} gOptions;
+
+/**
+ * Log-linear histogram of latencies in microseconds: values below 64 have a bucket each, and every power of two above is
+ * split in 32 buckets, so that a value is recorded with a precision of about 3% whatever its magnitude.
+ */
+class LatencyHistogram
+{
+public:
+    void Record(uint64_t value)
+    {
+        mBuckets[BucketIndex(value)]++;
+        mCount++;
+        mSum += value;
+        mMin = (mCount == 1 || value < mMin) ? value : mMin;
+        mMax = (value > mMax) ? value : mMax;
+    }
+
+    uint64_t GetCount() const { return mCount; }
+    uint64_t GetMin() const { return mMin; }
+    uint64_t GetMax() const { return mMax; }
+    double GetMean() const { return (mCount != 0) ? static_cast<double>(mSum) / static_cast<double>(mCount) : 0; }
+
+    /**
+     * The value below which the given fraction of the recorded values fall, as the midpoint of the bucket holding it.
+     */
+    uint64_t GetPercentile(double fraction) const
+    {
+        uint64_t target = static_cast<uint64_t>(fraction * static_cast<double>(mCount) + 0.5);
+        uint64_t seen   = 0;
+
+        target = (target == 0) ? 1 : target;
+        for (size_t i = 0; i < kBucketCount; i++)
+        {
+            seen += mBuckets[i];
+            if (seen >= target)
+            {
+                const uint64_t value = BucketLowerBound(i) + BucketWidth(i) / 2;
+                return (value < mMax) ? ((value > mMin) ? value : mMin) : mMax;
+            }
+        }
+        return mMax;
+    }
+
+private:
+    static constexpr unsigned kSubBucketBits = 5;
+    static constexpr size_t kSubBucketCount  = 1u << kSubBucketBits;
+    static constexpr size_t kBucketCount     = (64 - kSubBucketBits + 1) * kSubBucketCount;
+
+    static size_t BucketIndex(uint64_t value)
+    {
+        if (value < 2 * kSubBucketCount)
+        {
+            return static_cast<size_t>(value);
+        }
+
+        unsigned exponent = kSubBucketBits + 1;
+        while ((value >> exponent) > 1)
+        {
+            exponent++;
+        }
+        // value >> (exponent - kSubBucketBits) is in [kSubBucketCount, 2 * kSubBucketCount).
+        return (exponent - kSubBucketBits + 1) * kSubBucketCount + static_cast<size_t>(value >> (exponent - kSubBucketBits)) -
+            kSubBucketCount;
+    }
+
+    static uint64_t BucketLowerBound(size_t index)
+    {
+        if (index < 2 * kSubBucketCount)
+        {
+            return index;
+        }
+        const unsigned exponent = static_cast<unsigned>(index / kSubBucketCount) + kSubBucketBits - 1;
+        return static_cast<uint64_t>(kSubBucketCount + index % kSubBucketCount) << (exponent - kSubBucketBits);
+    }
+
+    static uint64_t BucketWidth(size_t index)
+    {
+        return (index < 2 * kSubBucketCount) ? 1 : (BucketLowerBound(index + 1) - BucketLowerBound(index));
+    }
+
+    uint64_t mBuckets[kBucketCount] = {};
+    uint64_t mCount                 = 0;
+    uint64_t mSum                   = 0;
+    uint64_t mMin                   = 0;
+    uint64_t mMax                   = 0;
+};
+
+struct RequestStats
+{
+    uint64_t sent   = 0;
+    uint64_t errors = 0;
+    // Number of times a request could not be sent because all the IM objects of its kind were in use.
+    uint64_t busy = 0;
+    LatencyHistogram latencies;
+};
+
+struct InFlightRequest
+{
+    bool inUse;
+    RequestType type;
+    // The CommandSender or WriteClient handling the request, or nullptr for a read, which is identified by its slot instead.
+    const void * client;
+    uint64_t startTimeUs;
+};
+
+chip::TransportMgr<chip::Transport::UDP> gUDPManager;
+chip::TransportMgr<chip::Transport::TCP<kMaxTcpActiveConnectionCount, kMaxTcpPendingPackets>> gTCPManager;
+chip::Inet::IPAddress gDestAddr;
+
+uint8_t gPayload[kMaxPayloadSize];
+
+// Only accessed from the CHIP event loop until gDone is set.
+RequestStats gStats[kRequestType_Count];
+InFlightRequest gInFlight[kMaxConcurrency];
+uint32_t gInFlightCount = 0;
+uint64_t gStartTimeUs   = 0;
+uint64_t gEndTimeUs     = 0;
+bool gRefillScheduled   = false;
+
+std::mutex gMutex;
+std::condition_variable gCond;
+bool gDone = false;
+
+bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier, const char * aName, const char * aValue);
+bool HandleNonOptionArgs(const char * aProgram, int argc, char * argv[]);
+
+constexpr uint16_t kOptionConcurrency = 'c';
+constexpr uint16_t kOptionDuration    = 'd';
+constexpr uint16_t kOptionMix         = 'm';
+constexpr uint16_t kOptionPayloadSize = 's';
+constexpr uint16_t kOptionTCP         = 't';
+
+// clang-format off
+OptionDef gCmdOptionDefs[] =
+{
+    { "concurrency",    kArgumentRequired,  kOptionConcurrency },
+    { "duration",       kArgumentRequired,  kOptionDuration },
+    { "mix",            kArgumentRequired,  kOptionMix },
+    { "payload-size",   kArgumentRequired,  kOptionPayloadSize },
+    { "tcp",            kNoArgument,        kOptionTCP },
+    { }
+};
+
+const char * const gCmdOptionHelp =
+    "  -c, --concurrency <num>\n"
+    "\n"
+    "       Number of requests kept in flight, 12 at most. Defaults to 4.\n"
+    "\n"
+    "  -d, --duration <seconds>\n"
+    "\n"
+    "       Duration of the run. Defaults to 10 seconds.\n"
+    "\n"
+    "  -m, --mix <command>:<read>:<write>\n"
+    "\n"
+    "       Relative weights of invoke command, read and write requests.\n"
+    "       Defaults to 1:1:1.\n"
+    "\n"
+    "  -s, --payload-size <bytes>\n"
+    "\n"
+    "       Size of the octet string carried by command and write requests,\n"
+    "       1024 at most. Defaults to 16.\n"
+    "\n"
+    "  -t, --tcp\n"
+    "\n"
+    "       Use TCP instead of UDP. The responder must be started with --tcp.\n"
+    "\n"
+    ;
+
+OptionSet gCmdOptions =
+{
+    HandleOption,
+    gCmdOptionDefs,
+    "PROGRAM OPTIONS",
+    gCmdOptionHelp
+};
+
+HelpOptions gHelpOptions(
+    "chip-im-load",
+    "Usage: chip-im-load [ <options...> ] <server-ip-address>\n",
+    "1.0",
+    "Generate interaction model requests against a chip-im-responder and report\n"
+    "their throughput and latency.\n"
+);
+
+OptionSet * gCmdOptionSets[] =
+{
+    &gCmdOptions,
+    &gHelpOptions,
+    nullptr
+};
+// clang-format on
+
+bool ParseMix(const char * aValue)
+{
+    uint32_t weights[kRequestType_Count];
+    uint32_t total = 0;
+    char * end     = nullptr;
+
+    for (size_t i = 0; i < kRequestType_Count; i++)
+    {
+        const unsigned long weight = strtoul(aValue, &end, 10);
+        if (end == aValue || weight > UINT16_MAX || *end != ((i + 1 < kRequestType_Count) ? ':' : '\0'))
+        {
+            return false;
+        }
+        weights[i] = static_cast<uint32_t>(weight);
+        total += weights[i];
+        aValue = end + 1;
+    }
+
+    VerifyOrReturnError(total != 0, false);
+    memcpy(gOptions.weights, weights, sizeof(weights));
+    return true;
+}
+
+bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier, const char * aName, const char * aValue)
+{
+    switch (aIdentifier)
+    {
+    case kOptionConcurrency:
+        if (!ParseInt(aValue, gOptions.concurrency) || gOptions.concurrency == 0 || gOptions.concurrency > kMaxConcurrency)
+        {
+            PrintArgError("%s: Invalid value specified for concurrency: %s\n", aProgram, aValue);
+            return false;
+        }
+        break;
+    case kOptionDuration:
+        if (!ParseInt(aValue, gOptions.durationSeconds) || gOptions.durationSeconds == 0)
+        {
+            PrintArgError("%s: Invalid value specified for duration: %s\n", aProgram, aValue);
+            return false;
+        }
+        break;
+    case kOptionMix:
+        if (!ParseMix(aValue))
+        {
+            PrintArgError("%s: Invalid value specified for request mix: %s\n", aProgram, aValue);
+            return false;
+        }
+        break;
+    case kOptionPayloadSize:
+        if (!ParseInt(aValue, gOptions.payloadSize) || gOptions.payloadSize > kMaxPayloadSize)
+        {
+            PrintArgError("%s: Invalid value specified for payload size: %s\n", aProgram, aValue);
+            return false;
+        }
+        break;
+    case kOptionTCP:
+        gOptions.useTCP = true;
+        break;
+    default:
+        PrintArgError("%s: Unhandled option: %s\n", aProgram, aName);
+        return false;
+    }
+
+    return true;
+}
+
+bool HandleNonOptionArgs(const char * aProgram, int argc, char * argv[])
+{
+    if (argc == 0)
+    {
+        PrintArgError("%s: Please specify the IP address of the server.\n", aProgram);
+        return false;
+    }
+
+    if (argc > 1)
+    {
+        PrintArgError("%s: Unexpected argument: %s\n", aProgram, argv[1]);
+        return false;
+    }
+
+    if (!chip::Inet::IPAddress::FromString(argv[0], gDestAddr))
+    {
+        PrintArgError("%s: Invalid server IP address: %s\n", aProgram, argv[0]);
+        return false;
+    }
+
+    return true;
+}
+
+CHIP_ERROR SendCommandRequest(chip::app::CommandSender * apCommandSender)
+{
+    chip::app::CommandPathParams commandPathParams = { kTestEndpointId, // Endpoint
+                                                       kTestGroupId,    // GroupId
+                                                       kTestClusterId,  // ClusterId
+                                                       kTestCommandId,  // CommandId
+                                                       chip::app::CommandPathFlags::kEndpointIdValid };
+    chip::TLV::TLVWriter * writer;
+
+    ReturnErrorOnFailure(apCommandSender->PrepareCommand(commandPathParams));
+
+    writer = apCommandSender->GetCommandDataElementTLVWriter();
+    ReturnErrorOnFailure(writer->Put(chip::TLV::ContextTag(1), static_cast<uint8_t>(1)));
+    ReturnErrorOnFailure(writer->PutBytes(chip::TLV::ContextTag(2), gPayload, gOptions.payloadSize));
+
+    ReturnErrorOnFailure(apCommandSender->FinishCommand());
+    return apCommandSender->SendCommandRequest(chip::kTestDeviceNodeId, gAdminId);
+}
+
+CHIP_ERROR SendWriteRequest(chip::app::WriteClient * apWriteClient)
+{
+    chip::app::AttributePathParams attributePathParams(chip::kTestDeviceNodeId, kTestEndpointId, kTestClusterId, kTestFieldId1, 0,
+                                                       chip::app::AttributePathParams::Flags::kFieldIdValid);
+    chip::TLV::TLVWriter * writer;
+
+    ReturnErrorOnFailure(apWriteClient->PrepareAttribute(attributePathParams));
+
+    writer = apWriteClient->GetAttributeDataElementTLVWriter();
+    ReturnErrorOnFailure(
+        writer->PutBytes(chip::TLV::ContextTag(chip::app::AttributeDataElement::kCsTag_Data), gPayload, gOptions.payloadSize));
+
+    ReturnErrorOnFailure(apWriteClient->FinishAttribute());
+    return apWriteClient->SendWriteRequest(chip::kTestDeviceNodeId, gAdminId, nullptr);
+}
+
+CHIP_ERROR SendReadRequest(size_t aSlot)
+{
+    chip::app::AttributePathParams attributePathParams(chip::kTestDeviceNodeId, kTestEndpointId, kTestClusterId, kTestFieldId1, 0,
+                                                       chip::app::AttributePathParams::Flags::kFieldIdValid);
+
+    // The app identifier of the read client is the slot of the request plus one, 0 being the default identifier.
+    return chip::app::InteractionModelEngine::GetInstance()->SendReadRequest(chip::kTestDeviceNodeId, gAdminId, nullptr, nullptr,
+                                                                             0, &attributePathParams, 1, 0,
+                                                                             static_cast<intptr_t>(aSlot + 1));
+}
+
+/**
+ * Send a request of the given type in the given slot. Returns CHIP_ERROR_NO_MEMORY when all the IM objects of that type are
+ * in use, in which case the request can be retried once one completes.
+ */
+CHIP_ERROR SendRequest(RequestType aType, size_t aSlot)
+{
+    InFlightRequest & request = gInFlight[aSlot];
+    CHIP_ERROR err            = CHIP_NO_ERROR;
+
+    request.type        = aType;
+    request.client      = nullptr;
+    request.startTimeUs = chip::System::Layer::GetClock_MonotonicHiRes();
+
+    switch (aType)
+    {
+    case kRequestType_Command: {
+        chip::app::CommandSender * commandSender;
+        ReturnErrorOnFailure(chip::app::InteractionModelEngine::GetInstance()->NewCommandSender(&commandSender));
+        request.client = commandSender;
+        err            = SendCommandRequest(commandSender);
+        if (err != CHIP_NO_ERROR)
+        {
+            commandSender->Shutdown();
+        }
+        break;
+    }
+    case kRequestType_Read:
+        err = SendReadRequest(aSlot);
+        break;
+    case kRequestType_Write: {
+        chip::app::WriteClient * writeClient;
+        ReturnErrorOnFailure(chip::app::InteractionModelEngine::GetInstance()->NewWriteClient(&writeClient));
+        request.client = writeClient;
+        err            = SendWriteRequest(writeClient);
+        if (err != CHIP_NO_ERROR)
+        {
+            writeClient->Shutdown();
+        }
+        break;
+    }
+    default:
+        err = CHIP_ERROR_INVALID_ARGUMENT;
+        break;
+    }
+
+    return err;
+}
+
+RequestType PickRequestType(const bool (&aBusy)[kRequestType_Count])
+{
+    uint32_t total = 0;
+    for (size_t i = 0; i < kRequestType_Count; i++)
+    {
+        total += aBusy[i] ? 0 : gOptions.weights[i];
+    }
+    VerifyOrReturnError(total != 0, kRequestType_Count);
+
+    uint32_t pick = static_cast<uint32_t>(rand()) % total;
+    for (size_t i = 0; i < kRequestType_Count; i++)
+    {
+        const uint32_t weight = aBusy[i] ? 0 : gOptions.weights[i];
+        if (pick < weight)
+        {
+            return static_cast<RequestType>(i);
+        }
+        pick -= weight;
+    }
+    return kRequestType_Count;
+}
+
+void SignalDone()
+{
+    std::lock_guard<std::mutex> lock(gMutex);
+    gDone = true;
+    gCond.notify_one();
+}
+
+/**
+ * Send requests until the configured number is in flight, or until all the IM objects of the selected types are in use.
+ * Runs on the CHIP event loop.
+ */
+void RefillRequests(intptr_t)
+{
+    bool busy[kRequestType_Count] = {};
+
+    gRefillScheduled = false;
+
+    if (chip::System::Layer::GetClock_MonotonicHiRes() >= gEndTimeUs)
+    {
+        if (gInFlightCount == 0)
+        {
+            SignalDone();
+        }
+        return;
+    }
+
+    for (size_t slot = 0; slot < gOptions.concurrency && gInFlightCount < gOptions.concurrency; slot++)
+    {
+        RequestType type = kRequestType_Count;
+        CHIP_ERROR err   = CHIP_ERROR_NO_MEMORY;
+
+        if (gInFlight[slot].inUse)
+        {
+            continue;
+        }
+
+        // Fall back to the other types of request while the picked one is at its limit.
+        while (err == CHIP_ERROR_NO_MEMORY && (type = PickRequestType(busy)) != kRequestType_Count)
+        {
+            err = SendRequest(type, slot);
+            if (err == CHIP_ERROR_NO_MEMORY)
+            {
+                gStats[type].busy++;
+                busy[type] = true;
+            }
+        }
+
+        if (err == CHIP_ERROR_NO_MEMORY)
+        {
+            // Every enabled type of request is at its limit: completions will refill.
+            break;
+        }
+
+        if (err == CHIP_NO_ERROR)
+        {
+            gStats[type].sent++;
+            gInFlight[slot].inUse = true;
+            gInFlightCount++;
+        }
+        else
+        {
+            printf("Send %s request failed, err: %s\n", kRequestTypeNames[type], chip::ErrorStr(err));
+            gStats[type].errors++;
+        }
+    }
+
+    if (gInFlightCount == 0)
+    {
+        // Nothing could be sent: stop rather than spin on the event loop.
+        printf("No request could be sent, stopping\n");
+        gEndTimeUs = chip::System::Layer::GetClock_MonotonicHiRes();
+        SignalDone();
+    }
+}
+
+void ScheduleRefill()
+{
+    // Completions are notified before the IM object that handled the request is shut down, so the object can only be reused
+    // once the current event has been processed.
+    if (!gRefillScheduled)
+    {
+        gRefillScheduled = true;
+        chip::DeviceLayer::PlatformMgr().ScheduleWork(RefillRequests);
+    }
+}
+
+void CompleteRequest(RequestType aType, const void * apClient, intptr_t aAppIdentifier, CHIP_ERROR aError)
+{
+    const uint64_t now = chip::System::Layer::GetClock_MonotonicHiRes();
+
+    for (size_t slot = 0; slot < gOptions.concurrency; slot++)
+    {
+        InFlightRequest & request = gInFlight[slot];
+        if (!request.inUse || request.type != aType)
+        {
+            continue;
+        }
+        if ((aType == kRequestType_Read) ? (aAppIdentifier != static_cast<intptr_t>(slot + 1)) : (apClient != request.client))
+        {
+            continue;
+        }
+
+        if (aError == CHIP_NO_ERROR)
+        {
+            gStats[aType].latencies.Record(now - request.startTimeUs);
+        }
+        else
+        {
+            gStats[aType].errors++;
+        }
+
+        request.inUse = false;
+        gInFlightCount--;
+        ScheduleRefill();
+        return;
+    }
+}
+
+class LoadInteractionModelApp : public chip::app::InteractionModelDelegate
+{
+public:
+    CHIP_ERROR CommandResponseStatus(const chip::app::CommandSender * apCommandSender,
+                                     const chip::Protocols::SecureChannel::GeneralStatusCode aGeneralCode,
+                                     const uint32_t aProtocolId, const uint16_t aProtocolCode, const chip::EndpointId aEndpointId,
+                                     const chip::ClusterId aClusterId, const chip::CommandId aCommandId,
+                                     uint8_t aCommandIndex) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR CommandResponseProcessed(const chip::app::CommandSender * apCommandSender) override
+    {
+        CompleteRequest(kRequestType_Command, apCommandSender, 0, CHIP_NO_ERROR);
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR CommandResponseProtocolError(const chip::app::CommandSender * apCommandSender, uint8_t aCommandIndex) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR CommandResponseError(const chip::app::CommandSender * apCommandSender, CHIP_ERROR aError) override
+    {
+        CompleteRequest(kRequestType_Command, apCommandSender, 0, aError);
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR EventStreamReceived(const chip::Messaging::ExchangeContext * apExchangeContext,
+                                   chip::TLV::TLVReader * apEventListReader) override
+    {
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ReportProcessed(const chip::app::ReadClient * apReadClient) override
+    {
+        CompleteRequest(kRequestType_Read, nullptr, apReadClient->GetAppIdentifier(), CHIP_NO_ERROR);
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR ReportError(const chip::app::ReadClient * apReadClient, CHIP_ERROR aError) override
+    {
+        CompleteRequest(kRequestType_Read, nullptr, apReadClient->GetAppIdentifier(), aError);
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR WriteResponseProcessed(const chip::app::WriteClient * apWriteClient) override
+    {
+        CompleteRequest(kRequestType_Write, apWriteClient, 0, CHIP_NO_ERROR);
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR WriteResponseError(const chip::app::WriteClient * apWriteClient, CHIP_ERROR aError) override
+    {
+        CompleteRequest(kRequestType_Write, apWriteClient, 0, aError);
+        return CHIP_NO_ERROR;
+    }
+};
+
+CHIP_ERROR EstablishSecureSession()
+{
+    chip::Optional<chip::Transport::PeerAddress> peerAddr;
+    chip::SecurePairingUsingTestSecret * testSecurePairingSecret = chip::Platform::New<chip::SecurePairingUsingTestSecret>();
+    VerifyOrReturnError(testSecurePairingSecret != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (gOptions.useTCP)
+    {
+        peerAddr = chip::Optional<chip::Transport::PeerAddress>::Value(chip::Transport::PeerAddress::TCP(gDestAddr, CHIP_PORT));
+    }
+    else
+    {
+        peerAddr = chip::Optional<chip::Transport::PeerAddress>::Value(
+            chip::Transport::PeerAddress::UDP(gDestAddr, CHIP_PORT, INET_NULL_INTERFACEID));
+    }
+
+    return gSessionManager.NewPairing(peerAddr, chip::kTestDeviceNodeId, testSecurePairingSecret,
+                                      chip::SecureSession::SessionRole::kInitiator, gAdminId);
+}
+
+void StartRun(intptr_t)
+{
+    gStartTimeUs = chip::System::Layer::GetClock_MonotonicHiRes();
+    gEndTimeUs   = gStartTimeUs + static_cast<uint64_t>(gOptions.durationSeconds) * 1000000;
+    RefillRequests(0);
+}
+
+void PrintReport()
+{
+    const double elapsedSeconds = static_cast<double>(gEndTimeUs - gStartTimeUs) / 1000000;
+
+    printf("\n%s, concurrency %" PRIu32 ", payload %" PRIu32 " bytes, %.1f s\n", gOptions.useTCP ? "TCP" : "UDP",
+           gOptions.concurrency, gOptions.payloadSize, elapsedSeconds);
+    printf("%-8s %8s %8s %8s %10s %10s %10s %10s %10s %10s %10s\n", "request", "done", "errors", "busy", "req/s", "min(us)",
+           "mean(us)", "p50(us)", "p99(us)", "p999(us)", "max(us)");
+
+    for (size_t i = 0; i < kRequestType_Count; i++)
+    {
+        const RequestStats & stats         = gStats[i];
+        const LatencyHistogram & latencies = stats.latencies;
+
+        if (stats.sent == 0 && stats.errors == 0)
+        {
+            continue;
+        }
+
+        printf("%-8s %8" PRIu64 " %8" PRIu64 " %8" PRIu64 " %10.1f %10" PRIu64 " %10.0f %10" PRIu64 " %10" PRIu64 " %10" PRIu64
+               " %10" PRIu64 "\n",
+               kRequestTypeNames[i], latencies.GetCount(), stats.errors, stats.busy,
+               (elapsedSeconds > 0) ? static_cast<double>(latencies.GetCount()) / elapsedSeconds : 0, latencies.GetMin(),
+               latencies.GetMean(), latencies.GetPercentile(0.50), latencies.GetPercentile(0.99), latencies.GetPercentile(0.999),
+               latencies.GetMax());
+    }
+}
+
+} // namespace
+
+namespace chip {
+namespace app {
+
+bool ServerClusterCommandExists(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId)
+{
+    // Always return true in test.
+    return true;
+}
+
+void DispatchSingleClusterCommand(chip::ClusterId aClusterId, chip::CommandId aCommandId, chip::EndpointId aEndPointId,
+                                  chip::TLV::TLVReader & aReader, Command * apCommandObj)
+{
+    // Command responses carry no data the load generator needs.
+}
+
+CHIP_ERROR ReadSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVWriter * apWriter, bool * apDataExists)
+{
+    // We do not really care about the value, just return a not found status code.
+    VerifyOrReturnError(apWriter != nullptr, CHIP_NO_ERROR);
+    return apWriter->Put(chip::TLV::ContextTag(AttributeDataElement::kCsTag_Status),
+                         Protocols::InteractionModel::ToUint16(Protocols::InteractionModel::ProtocolCode::UnsupportedAttribute));
+}
+} // namespace app
+} // namespace chip
+
+int main(int argc, char * argv[])
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    LoadInteractionModelApp loadDelegate;
+    chip::Transport::AdminPairingTable admins;
+    chip::Transport::AdminPairingInfo * adminInfo = admins.AssignAdminId(gAdminId, chip::kTestControllerNodeId);
+    VerifyOrExit(adminInfo != nullptr, err = CHIP_ERROR_NO_MEMORY);
+
+    if (!ParseArgs("chip-im-load", argc, argv, gCmdOptionSets, HandleNonOptionArgs))
+    {
+        ExitNow(err = CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    for (size_t i = 0; i < sizeof(gPayload); i++)
+    {
+        gPayload[i] = static_cast<uint8_t>(i);
+    }
+
+    InitializeChip();
+
+    chip::DeviceLayer::PlatformMgr().StartEventLoopTask();
+
+    if (gOptions.useTCP)
+    {
+        err = gTCPManager.Init(chip::Transport::TcpListenParameters(&chip::DeviceLayer::InetLayer)
+                                   .SetAddressType(chip::Inet::kIPAddressType_IPv4)
+                                   .SetListenPort(IM_CLIENT_PORT));
+        SuccessOrExit(err);
+
+        err = gSessionManager.Init(chip::kTestControllerNodeId, &chip::DeviceLayer::SystemLayer, &gTCPManager, &admins,
+                                   &gMessageCounterManager);
+        SuccessOrExit(err);
+    }
+    else
+    {
+        err = gUDPManager.Init(chip::Transport::UdpListenParameters(&chip::DeviceLayer::InetLayer)
+                                   .SetAddressType(chip::Inet::kIPAddressType_IPv4)
+                                   .SetListenPort(IM_CLIENT_PORT));
+        SuccessOrExit(err);
+
+        err = gSessionManager.Init(chip::kTestControllerNodeId, &chip::DeviceLayer::SystemLayer, &gUDPManager, &admins,
+                                   &gMessageCounterManager);
+        SuccessOrExit(err);
+    }
+
+    err = gExchangeManager.Init(&gSessionManager);
+    SuccessOrExit(err);
+
+    err = gMessageCounterManager.Init(&gExchangeManager);
+    SuccessOrExit(err);
+
+    err = chip::app::InteractionModelEngine::GetInstance()->Init(&gExchangeManager, &loadDelegate);
+    SuccessOrExit(err);
+
+    err = EstablishSecureSession();
+    SuccessOrExit(err);
+
+    printf("Sending requests for %" PRIu32 " seconds...\n", gOptions.durationSeconds);
+
+    chip::DeviceLayer::PlatformMgr().ScheduleWork(StartRun);
+
+    {
+        std::unique_lock<std::mutex> lock(gMutex);
+        const auto timeout = std::chrono::seconds(gOptions.durationSeconds + kDrainMarginSeconds) +
+            std::chrono::milliseconds(chip::app::kImMessageTimeoutMsec);
+
+        if (!gCond.wait_for(lock, timeout, [] { return gDone; }))
+        {
+            printf("Requests still in flight at the end of the run\n");
+            err = CHIP_ERROR_TIMEOUT;
+        }
+    }
+
+    chip::DeviceLayer::PlatformMgr().LockChipStack();
+    PrintReport();
+    chip::app::InteractionModelEngine::GetInstance()->Shutdown();
+    chip::DeviceLayer::PlatformMgr().UnlockChipStack();
+
+    ShutdownChip();
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        printf("IM load generator failed: %s\n", chip::ErrorStr(err));
+        exit(EXIT_FAILURE);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -39,8 +39,16 @@
 #include <support/ErrorStr.h>
 #include <system/SystemPacketBuffer.h>
 #include <transport/SecureSessionMgr.h>
+#include <transport/raw/TCP.h>
 #include <transport/raw/UDP.h>
 
+#include <string.h>
+
+namespace {
+// Whether to skip printing the requests, which would dominate the response time under load.
+bool gQuiet = false;
+} // namespace
+
 namespace chip {
 namespace app {
 
@@ -60,7 +68,7 @@ void DispatchSingleClusterCommand(chip::ClusterId aClusterId, chip::CommandId aC
         return;
     }
 
-    if (aReader.GetLength() != 0)
+    if (aReader.GetLength() != 0 && !gQuiet)
     {
         chip::TLV::Debug::Dump(aReader, TLVPrettyPrinter);
     }
@@ -74,13 +82,19 @@ void DispatchSingleClusterCommand(chip::ClusterId aClusterId, chip::CommandId aC
     // Add command data here
     if (statusCodeFlipper)
     {
-        printf("responder constructing status code in command");
+        if (!gQuiet)
+        {
+            printf("responder constructing status code in command");
+        }
         apCommandObj->AddStatusCode(commandPathParams, Protocols::SecureChannel::GeneralStatusCode::kSuccess,
                                     Protocols::InteractionModel::Id, Protocols::InteractionModel::ProtocolCode::Success);
     }
     else
     {
-        printf("responder constructing command data in command");
+        if (!gQuiet)
+        {
+            printf("responder constructing command data in command");
+        }
 
         chip::TLV::TLVWriter * writer;
 
@@ -133,7 +147,8 @@ CHIP_ERROR WriteSingleClusterData(ClusterInfo & aClusterInfo, TLV::TLVReader & a
 } // namespace chip
 
 namespace {
-chip::TransportMgr<chip::Transport::UDP> gTransportManager;
+chip::TransportMgr<chip::Transport::UDP> gUDPManager;
+chip::TransportMgr<chip::Transport::TCP<kMaxTcpActiveConnectionCount, kMaxTcpPendingPackets>> gTCPManager;
 chip::SecurePairingUsingTestSecret gTestPairing;
 LivenessEventGenerator gLivenessGenerator;
 
@@ -160,21 +175,52 @@ int main(int argc, char * argv[])
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::app::InteractionModelDelegate mockDelegate;
     chip::Optional<chip::Transport::PeerAddress> peer(chip::Transport::Type::kUndefined);
+    bool useTCP = false;
     const chip::Transport::AdminId gAdminId = 0;
     chip::Transport::AdminPairingTable admins;
     chip::Transport::AdminPairingInfo * adminInfo = admins.AssignAdminId(gAdminId, chip::kTestDeviceNodeId);
 
     VerifyOrExit(adminInfo != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--tcp") == 0)
+        {
+            useTCP = true;
+        }
+        else if (strcmp(argv[i], "--quiet") == 0)
+        {
+            gQuiet = true;
+        }
+        else
+        {
+            printf("Unknown argument: %s\n", argv[i]);
+            ExitNow(err = CHIP_ERROR_INVALID_ARGUMENT);
+        }
+    }
+
     InitializeChip();
 
-    err = gTransportManager.Init(
-        chip::Transport::UdpListenParameters(&chip::DeviceLayer::InetLayer).SetAddressType(chip::Inet::kIPAddressType_IPv4));
-    SuccessOrExit(err);
+    if (useTCP)
+    {
+        err = gTCPManager.Init(
+            chip::Transport::TcpListenParameters(&chip::DeviceLayer::InetLayer).SetAddressType(chip::Inet::kIPAddressType_IPv4));
+        SuccessOrExit(err);
 
-    err = gSessionManager.Init(chip::kTestDeviceNodeId, &chip::DeviceLayer::SystemLayer, &gTransportManager, &admins,
-                               &gMessageCounterManager);
-    SuccessOrExit(err);
+        err = gSessionManager.Init(chip::kTestDeviceNodeId, &chip::DeviceLayer::SystemLayer, &gTCPManager, &admins,
+                                   &gMessageCounterManager);
+        SuccessOrExit(err);
+    }
+    else
+    {
+        err = gUDPManager.Init(
+            chip::Transport::UdpListenParameters(&chip::DeviceLayer::InetLayer).SetAddressType(chip::Inet::kIPAddressType_IPv4));
+        SuccessOrExit(err);
+
+        err = gSessionManager.Init(chip::kTestDeviceNodeId, &chip::DeviceLayer::SystemLayer, &gUDPManager, &admins,
+                                   &gMessageCounterManager);
+        SuccessOrExit(err);
+    }
 
     err = gExchangeManager.Init(&gSessionManager);
     SuccessOrExit(err);
@@ -85,6 +85,24 @@ CHIP_ERROR CHIPDeviceCallbacksMgr::CancelResponseCallback(NodeId nodeId, uint8_t
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CHIPDeviceCallbacksMgr::CancelResponseCallback(Callback::Cancelable * callback)
+{
+    VerifyOrReturnError(callback != nullptr && callback->mCancel != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+
+    ResponseCallbackInfo info;
+    memcpy(&info, callback->mInfo, sizeof(info));
+
+    // The callback may be registered with another queue, whose info does not describe a response.
+    Callback::Cancelable * registered = nullptr;
+    if ((GetCallback(info, mResponsesSuccess, &registered) != CHIP_NO_ERROR || registered != callback) &&
+        (GetCallback(info, mResponsesFailure, &registered) != CHIP_NO_ERROR || registered != callback))
+    {
+        return CHIP_ERROR_KEY_NOT_FOUND;
+    }
+
+    return CancelResponseCallback(info.nodeId, info.sequenceNumber);
+}
+
 CHIP_ERROR CHIPDeviceCallbacksMgr::AddResponseFilter(const ResponseCallbackInfo & info, TLVDataFilter filter)
 {
     constexpr ResponseCallbackInfo kEmptyInfo{ kAnyNodeId, 0 };
@@ -145,6 +163,14 @@ CHIP_ERROR CHIPDeviceCallbacksMgr::GetResponseCallback(NodeId nodeId, uint8_t se
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CHIPDeviceCallbacksMgr::PeekResponseCallback(NodeId nodeId, uint8_t sequenceNumber,
+                                                        Callback::Cancelable ** onSuccessCallback)
+{
+    ResponseCallbackInfo info = { nodeId, sequenceNumber };
+
+    return GetCallback(info, mResponsesSuccess, onSuccessCallback);
+}
+
 CHIP_ERROR CHIPDeviceCallbacksMgr::AddReportCallback(NodeId nodeId, EndpointId endpointId, ClusterId clusterId,
                                                      AttributeId attributeId, Callback::Cancelable * onReportCallback)
 {
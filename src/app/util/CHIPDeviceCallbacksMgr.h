@@ -71,8 +71,17 @@ public:
     CHIP_ERROR AddResponseCallback(NodeId nodeId, uint8_t sequenceNumber, Callback::Cancelable * onSuccessCallback,
                                    Callback::Cancelable * onFailureCallback, TLVDataFilter callbackFilter = nullptr);
     CHIP_ERROR CancelResponseCallback(NodeId nodeId, uint8_t sequenceNumber);
+    /**
+     * Cancel the response callbacks registered along with the given success or failure callback, and free their TLV filter.
+     * Returns CHIP_ERROR_KEY_NOT_FOUND when the callback is not registered for a response.
+     */
+    CHIP_ERROR CancelResponseCallback(Callback::Cancelable * callback);
     CHIP_ERROR GetResponseCallback(NodeId nodeId, uint8_t sequenceNumber, Callback::Cancelable ** onSuccessCallback,
                                    Callback::Cancelable ** onFailureCallback, TLVDataFilter * callbackFilter = nullptr);
+    /**
+     * Same as GetResponseCallback for the success callback only, which is left registered.
+     */
+    CHIP_ERROR PeekResponseCallback(NodeId nodeId, uint8_t sequenceNumber, Callback::Cancelable ** onSuccessCallback);
 
     CHIP_ERROR AddReportCallback(NodeId nodeId, EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
                                  Callback::Cancelable * onReportCallback);
@@ -100,6 +100,16 @@ const uint16_t clusterManufacturerCodeCount                     = GENERATED_CLUS
 const EmberAfManufacturerCodeEntry attributeManufacturerCodes[] = GENERATED_ATTRIBUTE_MANUFACTURER_CODES;
 const uint16_t attributeManufacturerCodeCount                   = GENERATED_ATTRIBUTE_MANUFACTURER_CODE_COUNT;
 
+// Offsets of the attribute values, derived from the generated tables by emberAfEndpointConfigure()
+// so that locating an attribute of a fixed endpoint does not have to add up the sizes of all the
+// endpoints and attributes that are stored before it:
+//  - the offset of the storage of each fixed endpoint in attributeData, followed by the total size
+//    of the fixed endpoints (which is where the storage of the dynamic endpoints starts),
+//  - the offset of the value of each generated attribute within the storage of its cluster, or
+//    within singletonAttributeData for singletons.
+static uint16_t endpointStorageOffsets[FIXED_ENDPOINT_COUNT + 1];
+static uint16_t attributeStorageOffsets[ArraySize(generatedAttributes)];
+
 #if !defined(EMBER_SCRIPTED_TEST)
 #define endpointNumber(x) fixedEndpoints[x]
 #define endpointDeviceId(x) fixedDeviceIds[x]
@@ -115,6 +125,9 @@ const uint16_t attributeManufacturerCodeCount                   = GENERATED_ATTR
 // Returns endpoint index within a given cluster
 static uint16_t findClusterEndpointIndex(EndpointId endpoint, ClusterId clusterId, uint8_t mask, uint16_t manufacturerCode);
 
+// Fills the tables of storage offsets
+static void computeStorageOffsets(void);
+
 #ifdef ZCL_USING_DESCRIPTOR_CLUSTER_SERVER
 void emberAfPluginDescriptorServerInitCallback(void);
 #endif
@@ -145,6 +158,8 @@ void emberAfEndpointConfigure(void)
         emAfEndpoints[ep].bitmask       = EMBER_AF_ENDPOINT_ENABLED;
     }
 
+    computeStorageOffsets();
+
 #ifdef DYNAMIC_ENDPOINT_COUNT
     if (MAX_ENDPOINT_COUNT > FIXED_ENDPOINT_COUNT)
     {
@@ -440,19 +455,40 @@ EmberAfAttributeMetadata * emberAfLocateAttributeMetadata(EndpointId endpoint, C
     return metadata;
 }
 
-static uint8_t * singletonAttributeLocation(EmberAfAttributeMetadata * am)
+static void computeStorageOffsets(void)
 {
-    EmberAfAttributeMetadata * m = (EmberAfAttributeMetadata *) &(generatedAttributes[0]);
-    uint16_t index               = 0;
-    while (m < am)
+    uint16_t offset = 0;
+    for (uint16_t ep = 0; ep < FIXED_ENDPOINT_COUNT; ep++)
+    {
+        endpointStorageOffsets[ep] = offset;
+        offset                     = static_cast<uint16_t>(offset + emAfEndpoints[ep].endpointType->endpointSize);
+    }
+    endpointStorageOffsets[FIXED_ENDPOINT_COUNT] = offset;
+
+    for (uint16_t clusterIndex = 0; clusterIndex < ArraySize(generatedClusters); clusterIndex++)
+    {
+        const EmberAfCluster * cluster = &generatedClusters[clusterIndex];
+        offset                         = 0;
+        for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+        {
+            const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+            {
+                attributeStorageOffsets[am - generatedAttributes] = offset;
+                offset                                            = static_cast<uint16_t>(offset + emberAfAttributeSize(am));
+            }
+        }
+    }
+
+    offset = 0;
+    for (uint16_t attrIndex = 0; attrIndex < ArraySize(generatedAttributes); attrIndex++)
     {
-        if ((m->mask & ATTRIBUTE_MASK_SINGLETON) != 0U)
+        if ((generatedAttributes[attrIndex].mask & ATTRIBUTE_MASK_SINGLETON) != 0U)
         {
-            index = static_cast<uint16_t>(index + m->size);
+            attributeStorageOffsets[attrIndex] = offset;
+            offset                             = static_cast<uint16_t>(offset + generatedAttributes[attrIndex].size);
         }
-        m++;
     }
-    return (uint8_t *) (singletonAttributeData + index);
 }
 
 // This function does mem copy, but smartly, which means that if the type is a
@@ -609,106 +645,132 @@ bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am,
 EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
                                        uint8_t * buffer, uint16_t readLength, bool write, int32_t index)
 {
-    uint8_t i;
-    uint16_t attributeOffsetIndex = 0;
+    EmberAfCluster * cluster;
+    EmberAfAttributeMetadata * am;
+    uint8_t * attributeLocation;
+
+    if (!emAfLocateAttribute(attRecord, &cluster, &am, &attributeLocation))
+    {
+        return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
+    }
+
+    // If passed metadata location is not null, populate
+    if (metadata != NULL)
+    {
+        *metadata = am;
+    }
+
+    return emAfReadOrWriteLocatedAttribute(attRecord, cluster, am, attributeLocation, buffer, readLength, write, index);
+}
+
+static bool isGeneratedAttribute(EmberAfAttributeMetadata * am)
+{
+    return am >= generatedAttributes && am < generatedAttributes + ArraySize(generatedAttributes);
+}
+
+bool emAfLocateAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfCluster ** cluster, EmberAfAttributeMetadata ** metadata,
+                         uint8_t ** location)
+{
+    uint16_t i;
 
     for (i = 0; i < emberAfEndpointCount(); i++)
     {
-        if (emAfEndpoints[i].endpoint == attRecord->endpoint)
+        if (emAfEndpoints[i].endpoint != attRecord->endpoint || !emberAfEndpointIndexIsEnabled(i))
         {
-            EmberAfEndpointType * endpointType = emAfEndpoints[i].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(i))
-            {
+            continue;
+        }
+
+        // The clusters of the fixed endpoints come from the generated tables, so the offsets of
+        // their attributes are known. Dynamic endpoints are stored after the fixed ones.
+        EmberAfEndpointType * endpointType = emAfEndpoints[i].endpointType;
+        bool isFixedEndpoint               = (i < emberAfFixedEndpointCount());
+        uint16_t attributeOffsetIndex      = endpointStorageOffsets[isFixedEndpoint ? i : FIXED_ENDPOINT_COUNT];
+        uint8_t clusterIndex;
+        for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+        {
+            EmberAfCluster * c = &(endpointType->cluster[clusterIndex]);
+            if (!emAfMatchCluster(c, attRecord))
+            { // Not the cluster we are looking for
+                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + c->clusterSize);
                 continue;
             }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+
+            uint16_t clusterOffsetIndex = attributeOffsetIndex;
+            uint16_t attrIndex;
+            for (attrIndex = 0; attrIndex < c->attributeCount; attrIndex++)
             {
-                EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+                EmberAfAttributeMetadata * am = &(c->attributes[attrIndex]);
+                if (emAfMatchAttribute(c, am, attRecord))
+                { // Got the attribute
+                    *cluster  = c;
+                    *metadata = am;
+                    if (am->mask & ATTRIBUTE_MASK_SINGLETON)
                     {
-                        EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != NULL)
-                            {
-                                *metadata = am;
-                            }
-
-                            {
-                                uint8_t * attributeLocation =
-                                    (am->mask & ATTRIBUTE_MASK_SINGLETON ? singletonAttributeLocation(am)
-                                                                         : attributeData + attributeOffsetIndex);
-                                uint8_t *src, *dst;
-                                if (write)
-                                {
-                                    src = buffer;
-                                    dst = attributeLocation;
-                                    if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                             emAfGetManufacturerCodeForAttribute(cluster, am),
-                                                                             am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-                                else
-                                {
-                                    if (buffer == NULL)
-                                    {
-                                        return EMBER_ZCL_STATUS_SUCCESS;
-                                    }
-
-                                    src = attributeLocation;
-                                    dst = buffer;
-                                    if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                            emAfGetManufacturerCodeForAttribute(cluster, am),
-                                                                            am->attributeId))
-                                    {
-                                        return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
-                                    }
-                                }
-
-                                return (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE
-                                            ? (write) ? emberAfExternalAttributeWriteCallback(
-                                                            attRecord->endpoint, attRecord->clusterId, am,
-                                                            emAfGetManufacturerCodeForAttribute(cluster, am), buffer, index)
-                                                      : emberAfExternalAttributeReadCallback(
-                                                            attRecord->endpoint, attRecord->clusterId, am,
-                                                            emAfGetManufacturerCodeForAttribute(cluster, am), buffer,
-                                                            emberAfAttributeSize(am), index)
-                                            : typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength, index));
-                            }
-                        }
-                        else
-                        { // Not the attribute we are looking for
-                            // Increase the index if attribute is not externally stored
-                            if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
-                            {
-                                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
-                            }
-                        }
+                        uint16_t singletonOffset = isGeneratedAttribute(am) ? attributeStorageOffsets[am - generatedAttributes] : 0;
+                        *location                = singletonAttributeData + singletonOffset;
+                    }
+                    else if (isFixedEndpoint)
+                    {
+                        *location = attributeData + attributeOffsetIndex + attributeStorageOffsets[am - generatedAttributes];
                     }
+                    else
+                    {
+                        *location = attributeData + clusterOffsetIndex;
+                    }
+                    return true;
                 }
-                else
-                { // Not the cluster we are looking for
-                    attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+
+                // Not the attribute we are looking for
+                // Increase the index if attribute is not externally stored
+                if (!isFixedEndpoint && !(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+                {
+                    clusterOffsetIndex = static_cast<uint16_t>(clusterOffsetIndex + emberAfAttributeSize(am));
                 }
             }
+            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + c->clusterSize);
         }
-        else
-        { // Not the endpoint we are looking for
-            // Dynamic endpoints are external and don't factor into storage size
-            if (i < emberAfFixedEndpointCount())
-            {
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[i].endpointType->endpointSize);
-            }
+    }
+    return false;
+}
+
+EmberAfStatus emAfReadOrWriteLocatedAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfCluster * cluster,
+                                              EmberAfAttributeMetadata * am, uint8_t * attributeLocation, uint8_t * buffer,
+                                              uint16_t readLength, bool write, int32_t index)
+{
+    uint8_t *src, *dst;
+    if (write)
+    {
+        src = buffer;
+        dst = attributeLocation;
+        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
+                                                 emAfGetManufacturerCodeForAttribute(cluster, am), am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
         }
     }
-    return EMBER_ZCL_STATUS_UNSUPPORTED_ATTRIBUTE; // Sorry, attribute was not found.
+    else
+    {
+        if (buffer == NULL)
+        {
+            return EMBER_ZCL_STATUS_SUCCESS;
+        }
+
+        src = attributeLocation;
+        dst = buffer;
+        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId,
+                                                emAfGetManufacturerCodeForAttribute(cluster, am), am->attributeId))
+        {
+            return EMBER_ZCL_STATUS_NOT_AUTHORIZED;
+        }
+    }
+
+    return (am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE
+                ? (write) ? emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                                  emAfGetManufacturerCodeForAttribute(cluster, am), buffer, index)
+                          : emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am,
+                                                                 emAfGetManufacturerCodeForAttribute(cluster, am), buffer,
+                                                                 emberAfAttributeSize(am), index)
+                : typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength, index));
 }
 
 // Check if a cluster is implemented or not. If yes, the cluster is returned.
@@ -104,6 +104,10 @@
 
 extern uint8_t attributeData[]; // main storage bucket for all attributes
 
+extern uint8_t singletonAttributeData[]; // storage bucket for singleton attributes
+
+extern const EmberAfAttributeMetadata generatedAttributes[]; // metadata of the attributes of the fixed endpoints
+
 extern uint8_t attributeDefaults[]; // storage bucked for > 2b default values
 
 void emAfCallInits(void);
@@ -125,6 +129,16 @@ bool emberAfExtractCommandIds(bool outgoing, EmberAfClusterCommand * cmd, chip::
 EmberAfStatus emAfReadOrWriteAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfAttributeMetadata ** metadata,
                                        uint8_t * buffer, uint16_t readLength, bool write, int32_t index = -1);
 
+// Finds an attribute on an enabled endpoint, along with the location of its value (which is
+// not meaningful if the attribute is stored externally). Returns false if there is no such attribute.
+bool emAfLocateAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfCluster ** cluster, EmberAfAttributeMetadata ** metadata,
+                         uint8_t ** location);
+
+// Same as emAfReadOrWriteAttribute, for an attribute that was found by emAfLocateAttribute.
+EmberAfStatus emAfReadOrWriteLocatedAttribute(EmberAfAttributeSearchRecord * attRecord, EmberAfCluster * cluster,
+                                              EmberAfAttributeMetadata * am, uint8_t * location, uint8_t * buffer,
+                                              uint16_t readLength, bool write, int32_t index = -1);
+
 bool emAfMatchCluster(EmberAfCluster * cluster, EmberAfAttributeSearchRecord * attRecord);
 bool emAfMatchAttribute(EmberAfCluster * cluster, EmberAfAttributeMetadata * am, EmberAfAttributeSearchRecord * attRecord);
 
@@ -487,20 +487,18 @@ EmberAfStatus emAfWriteAttribute(EndpointId endpoint, ClusterId cluster, Attribu
                                  uint16_t manufacturerCode, uint8_t * data, EmberAfAttributeType dataType,
                                  bool overrideReadOnlyAndDataType, bool justTest)
 {
+    EmberAfCluster * clusterMetadata    = NULL;
     EmberAfAttributeMetadata * metadata = NULL;
+    uint8_t * attributeLocation         = NULL;
     EmberAfAttributeSearchRecord record;
     record.endpoint         = endpoint;
     record.clusterId        = cluster;
     record.clusterMask      = mask;
     record.attributeId      = attributeID;
     record.manufacturerCode = manufacturerCode;
-    emAfReadOrWriteAttribute(&record, &metadata,
-                             NULL,   // buffer
-                             0,      // buffer size
-                             false); // write?
 
     // if we dont support that attribute
-    if (metadata == NULL)
+    if (!emAfLocateAttribute(&record, &clusterMetadata, &metadata, &attributeLocation))
     {
         emberAfAttributesPrintln("%pep %x clus %2x attr %2x not supported", "WRITE ERR: ", endpoint, cluster, attributeID);
         emberAfAttributesFlush();
@@ -584,12 +582,10 @@ EmberAfStatus emAfWriteAttribute(EndpointId endpoint, ClusterId cluster, Attribu
             return status;
         }
 
-        // write the attribute
-        status = emAfReadOrWriteAttribute(&record,
-                                          NULL, // metadata
-                                          data,
-                                          0,     // buffer size - unused
-                                          true); // write?
+        // write the attribute, which was located above
+        status = emAfReadOrWriteLocatedAttribute(&record, clusterMetadata, metadata, attributeLocation, data,
+                                                 0,     // buffer size - unused
+                                                 true); // write?
 
         if (status != EMBER_ZCL_STATUS_SUCCESS)
         {
@@ -0,0 +1,166 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the lookup of attribute values in the attribute
+ *      storage, against the endpoint configuration of the all-clusters-app. It compares
+ *      emAfLocateAttribute() to the linear walk it replaced, and times the read and write
+ *      accessors that the generated attribute accessors use.
+ *
+ */
+
+#include "LinearAttributeWalk.h"
+
+#include <app/common/gen/attribute-id.h>
+#include <app/common/gen/attribute-type.h>
+#include <app/common/gen/cluster-id.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+using namespace chip;
+
+namespace {
+
+constexpr unsigned kLookupPasses     = 2000;
+constexpr unsigned kAccessorLoops    = 200000;
+constexpr EndpointId kRootEndpoint   = 0;
+constexpr EndpointId kDeviceEndpoint = 1;
+
+using Clock = std::chrono::steady_clock;
+
+int64_t ElapsedUs(Clock::time_point start)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+}
+
+std::vector<EmberAfAttributeSearchRecord> AllStoredAttributes()
+{
+    std::vector<EmberAfAttributeSearchRecord> records;
+
+    for (uint16_t i = 0; i < emberAfEndpointCount(); i++)
+    {
+        EmberAfEndpointType * endpointType = emAfEndpoints[i].endpointType;
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+        {
+            EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+            for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+            {
+                EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                if (emberAfAttributeIsExternal(am))
+                {
+                    continue;
+                }
+
+                EmberAfAttributeSearchRecord record;
+                record.endpoint         = emAfEndpoints[i].endpoint;
+                record.clusterId        = cluster->clusterId;
+                record.clusterMask      = static_cast<uint8_t>(cluster->mask & (CLUSTER_MASK_SERVER | CLUSTER_MASK_CLIENT));
+                record.attributeId      = am->attributeId;
+                record.manufacturerCode = emAfGetManufacturerCodeForAttribute(cluster, am);
+                records.push_back(record);
+            }
+        }
+    }
+
+    return records;
+}
+
+} // namespace
+
+int main()
+{
+    emberAfEndpointConfigure();
+
+    std::vector<EmberAfAttributeSearchRecord> records = AllStoredAttributes();
+    uintptr_t checksum[2]                             = { 0, 0 };
+    int64_t lookupUs[2];
+
+    // Locate every stored attribute of every endpoint, with the linear walk and with the precomputed offsets.
+    for (int pass = 0; pass < 2; pass++)
+    {
+        Clock::time_point start = Clock::now();
+        for (unsigned i = 0; i < kLookupPasses; i++)
+        {
+            for (EmberAfAttributeSearchRecord & record : records)
+            {
+                EmberAfCluster * cluster;
+                EmberAfAttributeMetadata * metadata;
+                uint8_t * location = nullptr;
+                if (pass == 0)
+                {
+                    Test::LocateAttributeByLinearWalk(&record, &location);
+                }
+                else
+                {
+                    emAfLocateAttribute(&record, &cluster, &metadata, &location);
+                }
+                checksum[pass] += reinterpret_cast<uintptr_t>(location);
+            }
+        }
+        lookupUs[pass] = ElapsedUs(start);
+    }
+
+    if (checksum[0] != checksum[1])
+    {
+        fprintf(stderr, "The two lookups do not locate the same attribute values\n");
+        return EXIT_FAILURE;
+    }
+
+    // One write and two reads, as the generated Set and Get accessors do.
+    EmberAfStatus status    = EMBER_ZCL_STATUS_SUCCESS;
+    Clock::time_point start = Clock::now();
+    for (unsigned i = 0; i < kAccessorLoops && status == EMBER_ZCL_STATUS_SUCCESS; i++)
+    {
+        uint8_t onOff = static_cast<uint8_t>(i & 1);
+        uint16_t clusterRevision;
+        uint8_t localConfigDisabled;
+
+        status = emberAfWriteServerAttribute(kDeviceEndpoint, ZCL_ON_OFF_CLUSTER_ID, ZCL_ON_OFF_ATTRIBUTE_ID, &onOff,
+                                             ZCL_BOOLEAN_ATTRIBUTE_TYPE);
+        if (status == EMBER_ZCL_STATUS_SUCCESS)
+        {
+            status = emberAfReadServerAttribute(kDeviceEndpoint, ZCL_ON_OFF_CLUSTER_ID, ZCL_CLUSTER_REVISION_SERVER_ATTRIBUTE_ID,
+                                                reinterpret_cast<uint8_t *>(&clusterRevision), sizeof(clusterRevision));
+        }
+        if (status == EMBER_ZCL_STATUS_SUCCESS)
+        {
+            status = emberAfReadServerAttribute(kRootEndpoint, ZCL_BASIC_CLUSTER_ID, ZCL_LOCAL_CONFIG_DISABLED_ATTRIBUTE_ID,
+                                                &localConfigDisabled, sizeof(localConfigDisabled));
+        }
+    }
+    int64_t accessorUs = ElapsedUs(start);
+
+    if (status != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        fprintf(stderr, "Accessing the attributes failed with status 0x%02x\n", status);
+        return EXIT_FAILURE;
+    }
+
+    printf("Locating %u attributes %u times: linear walk %lld us, precomputed offsets %lld us (%.1fx)\n",
+           static_cast<unsigned>(records.size()), kLookupPasses, static_cast<long long>(lookupUs[0]),
+           static_cast<long long>(lookupUs[1]), static_cast<double>(lookupUs[0]) / static_cast<double>(lookupUs[1]));
+    printf("%u loops of one write and two reads: %lld us\n", kAccessorLoops, static_cast<long long>(accessorUs));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,94 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "LinearAttributeWalk.h"
+
+namespace chip {
+namespace Test {
+
+namespace {
+
+uint8_t * SingletonAttributeLocation(EmberAfAttributeMetadata * am)
+{
+    const EmberAfAttributeMetadata * m = &(generatedAttributes[0]);
+    uint16_t index                     = 0;
+    while (m < am)
+    {
+        if ((m->mask & ATTRIBUTE_MASK_SINGLETON) != 0U)
+        {
+            index = static_cast<uint16_t>(index + m->size);
+        }
+        m++;
+    }
+    return singletonAttributeData + index;
+}
+
+} // namespace
+
+bool LocateAttributeByLinearWalk(EmberAfAttributeSearchRecord * attRecord, uint8_t ** location)
+{
+    uint16_t attributeOffsetIndex = 0;
+
+    for (uint16_t i = 0; i < emberAfEndpointCount(); i++)
+    {
+        if (emAfEndpoints[i].endpoint != attRecord->endpoint)
+        {
+            // Dynamic endpoints are external and don't factor into storage size
+            if (i < emberAfFixedEndpointCount())
+            {
+                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[i].endpointType->endpointSize);
+            }
+            continue;
+        }
+        if (!emberAfEndpointIndexIsEnabled(i))
+        {
+            continue;
+        }
+
+        EmberAfEndpointType * endpointType = emAfEndpoints[i].endpointType;
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+        {
+            EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+            if (!emAfMatchCluster(cluster, attRecord))
+            {
+                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+                continue;
+            }
+
+            for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+            {
+                EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                if (emAfMatchAttribute(cluster, am, attRecord))
+                {
+                    *location = (am->mask & ATTRIBUTE_MASK_SINGLETON) ? SingletonAttributeLocation(am)
+                                                                      : attributeData + attributeOffsetIndex;
+                    return true;
+                }
+
+                if (!(am->mask & ATTRIBUTE_MASK_EXTERNAL_STORAGE) && !(am->mask & ATTRIBUTE_MASK_SINGLETON))
+                {
+                    attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+} // namespace Test
+} // namespace chip
@@ -0,0 +1,43 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Reference implementation of the attribute lookup that emAfLocateAttribute() replaced, used
+ *      to check and to measure the lookup based on the precomputed storage offsets.
+ *
+ */
+
+#pragma once
+
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+
+namespace chip {
+namespace Test {
+
+/**
+ * Locates the value of an attribute by adding up the storage sizes of all the endpoints, clusters
+ * and attributes that are stored before it, and by walking the generated attribute table for a
+ * singleton.
+ *
+ * @return whether the attribute was found.
+ */
+bool LocateAttributeByLinearWalk(EmberAfAttributeSearchRecord * attRecord, uint8_t ** location);
+
+} // namespace Test
+} // namespace chip
@@ -0,0 +1,175 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the parts of the data model that the attribute storage calls into, so
+ *      that the attribute storage can be tested without the cluster implementations and the
+ *      messaging layer.
+ *
+ */
+
+#include <app/reporting/reporting.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+#include <app/util/util.h>
+
+#include <string.h>
+
+using namespace chip;
+
+uint8_t appResponseData[EMBER_AF_RESPONSE_BUFFER_LEN];
+uint16_t appResponseLength;
+
+const EmberAfClusterName zclClusterNames[] = { { ZCL_NULL_CLUSTER_ID, EMBER_AF_NULL_MANUFACTURER_CODE, NULL } };
+
+uint16_t emberAfFindClusterNameIndexWithMfgCode(ClusterId cluster, uint16_t mfgCode)
+{
+    return 0xFFFF;
+}
+
+void emberAfPrint(int category, const char * format, ...) {}
+
+void emberAfPrintln(int category, const char * format, ...) {}
+
+void emberAfPrintBuffer(int category, const uint8_t * buffer, uint16_t length, bool withSpace) {}
+
+uint8_t * emberAfPutInt8uInResp(uint8_t value)
+{
+    return NULL;
+}
+
+uint32_t * emberAfPutInt32uInResp(uint32_t value)
+{
+    return NULL;
+}
+
+void emberAfPutStatusInResp(EmberAfStatus value) {}
+
+bool emberAfIsTypeSigned(EmberAfAttributeType dataType)
+{
+    return false;
+}
+
+int8_t emberAfCompareValues(uint8_t * val1, uint8_t * val2, uint16_t len, bool signedNumber)
+{
+    int result = memcmp(val1, val2, len);
+    return static_cast<int8_t>((result > 0) - (result < 0));
+}
+
+uint8_t emberAfStringLength(const uint8_t * buffer)
+{
+    return buffer[0];
+}
+
+uint16_t emberAfLongStringLength(const uint8_t * buffer)
+{
+    return static_cast<uint16_t>(buffer[0] | (buffer[1] << 8));
+}
+
+void emberAfCopyString(uint8_t * dest, const uint8_t * src, size_t size)
+{
+    size_t length = (src == NULL) ? 0 : src[0];
+    if (length > size)
+    {
+        length = size;
+    }
+    if (length > 0)
+    {
+        memmove(dest + 1, src + 1, length);
+    }
+    dest[0] = static_cast<uint8_t>(length);
+}
+
+void emberAfCopyLongString(uint8_t * dest, const uint8_t * src, size_t size)
+{
+    size_t length = (src == NULL) ? 0 : emberAfLongStringLength(src);
+    if (length > size)
+    {
+        length = size;
+    }
+    if (length > 0)
+    {
+        memmove(dest + 2, src + 2, length);
+    }
+    dest[0] = static_cast<uint8_t>(length);
+    dest[1] = static_cast<uint8_t>(length >> 8);
+}
+
+uint16_t emberAfCopyList(ClusterId clusterId, EmberAfAttributeMetadata * am, bool write, uint8_t * dest, uint8_t * src,
+                         int32_t index)
+{
+    return 0;
+}
+
+uint16_t emberAfAttributeValueListSize(ClusterId clusterId, AttributeId attributeId, const uint8_t * buffer)
+{
+    return 0;
+}
+
+void emberAfSetDeviceEnabled(EndpointId endpoint, bool enabled) {}
+
+EmberStatus emberAfDeactivateClusterTick(EndpointId endpoint, ClusterId clusterId, bool isClient)
+{
+    return EMBER_SUCCESS;
+}
+
+void emberAfReportingAttributeChangeCallback(EndpointId endpoint, ClusterId clusterId, AttributeId attributeId, uint8_t mask,
+                                             uint16_t manufacturerCode, EmberAfAttributeType type, uint8_t * data)
+{}
+
+// The functions of the clusters of the all-clusters-app that are referenced by its generated endpoint configuration.
+
+void emberAfPluginDescriptorServerInitCallback(void) {}
+
+void emberAfBasicClusterServerInitCallback(EndpointId endpoint) {}
+
+void emberAfColorControlClusterServerInitCallback(EndpointId endpoint) {}
+
+void emberAfDoorLockClusterServerAttributeChangedCallback(EndpointId endpoint, AttributeId attributeId) {}
+
+void emberAfGroupsClusterServerInitCallback(EndpointId endpoint) {}
+
+void emberAfIasZoneClusterServerInitCallback(EndpointId endpoint) {}
+
+void emberAfIasZoneClusterServerMessageSentCallback(const MessageSendDestination & destination, EmberApsFrame * apsFrame,
+                                                    uint16_t msgLen, uint8_t * message, EmberStatus status)
+{}
+
+EmberAfStatus emberAfIasZoneClusterServerPreAttributeChangedCallback(EndpointId endpoint, AttributeId attributeId,
+                                                                     EmberAfAttributeType attributeType, uint16_t size,
+                                                                     uint8_t * value)
+{
+    return EMBER_ZCL_STATUS_SUCCESS;
+}
+
+void emberAfIdentifyClusterServerInitCallback(EndpointId endpoint) {}
+
+void emberAfIdentifyClusterServerAttributeChangedCallback(EndpointId endpoint, AttributeId attributeId) {}
+
+void emberAfLevelControlClusterServerInitCallback(EndpointId endpoint) {}
+
+void emberAfOccupancySensingClusterServerInitCallback(EndpointId endpoint) {}
+
+void emberAfOnOffClusterServerInitCallback(EndpointId endpoint) {}
+
+void emberAfPumpConfigurationAndControlClusterServerInitCallback(EndpointId endpoint) {}
+
+void emberAfPumpConfigurationAndControlClusterServerAttributeChangedCallback(EndpointId endpoint, AttributeId attributeId) {}
+
+void emberAfScenesClusterServerInitCallback(EndpointId endpoint) {}
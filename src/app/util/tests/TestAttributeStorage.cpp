@@ -0,0 +1,203 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the lookup of attribute values in the attribute storage,
+ *      against the endpoint configuration of the all-clusters-app, which has several endpoints with
+ *      many clusters and singleton attributes.
+ *
+ */
+
+#include "LinearAttributeWalk.h"
+
+#include <app/common/gen/attribute-id.h>
+#include <app/common/gen/attribute-type.h>
+#include <app/common/gen/cluster-id.h>
+#include <app/util/af.h>
+#include <app/util/attribute-storage.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+// A bridged light, as declared by the bridge-app. Its attributes are stored externally, except for
+// the cluster revisions and for the on/off attribute, which are stored after the fixed endpoints.
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(onOffAttrs)
+{ ZCL_ON_OFF_ATTRIBUTE_ID, ZAP_TYPE(BOOLEAN), 1, 0, ZAP_EMPTY_DEFAULT() },            /* on/off */
+    DECLARE_DYNAMIC_ATTRIBUTE(ZCL_GLOBAL_SCENE_CONTROL_ATTRIBUTE_ID, BOOLEAN, 1, 0) /* global scene control */
+    DECLARE_DYNAMIC_ATTRIBUTE_LIST_END(0x0001);
+
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(fixedLabelAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(ZCL_LABEL_LIST_ATTRIBUTE_ID, ARRAY, 254, 0) /* label list */
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_END(0x0001);
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(bridgedLightClusters)
+DECLARE_DYNAMIC_CLUSTER(ZCL_ON_OFF_CLUSTER_ID, onOffAttrs),
+    DECLARE_DYNAMIC_CLUSTER(ZCL_FIXED_LABEL_CLUSTER_ID, fixedLabelAttrs) DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(bridgedLightEndpoint, bridgedLightClusters);
+
+constexpr EndpointId kFirstDynamicEndpoint = 3;
+constexpr uint16_t kDynamicEndpointCount   = 2;
+
+// Number of attributes of the bridged light, cluster revisions included.
+constexpr size_t kBridgedLightAttributeCount = 5;
+
+// Locates every attribute of every enabled endpoint with emAfLocateAttribute(), and checks that the
+// value is where the linear walk over the storage finds it. Returns the number of attributes checked.
+size_t CheckAllAttributeLocations(nlTestSuite * inSuite)
+{
+    size_t checkedCount = 0;
+
+    for (uint16_t i = 0; i < emberAfEndpointCount(); i++)
+    {
+        if (!emberAfEndpointIndexIsEnabled(i))
+        {
+            continue;
+        }
+
+        EmberAfEndpointType * endpointType = emAfEndpoints[i].endpointType;
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+        {
+            EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+            for (uint16_t attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+            {
+                EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                EmberAfAttributeSearchRecord record;
+                record.endpoint         = emAfEndpoints[i].endpoint;
+                record.clusterId        = cluster->clusterId;
+                record.clusterMask      = static_cast<uint8_t>(cluster->mask & (CLUSTER_MASK_SERVER | CLUSTER_MASK_CLIENT));
+                record.attributeId      = am->attributeId;
+                record.manufacturerCode = emAfGetManufacturerCodeForAttribute(cluster, am);
+
+                EmberAfCluster * foundCluster            = nullptr;
+                EmberAfAttributeMetadata * foundMetadata = nullptr;
+                uint8_t * location                       = nullptr;
+                uint8_t * expectedLocation               = nullptr;
+                NL_TEST_ASSERT(inSuite, emAfLocateAttribute(&record, &foundCluster, &foundMetadata, &location));
+                NL_TEST_ASSERT(inSuite, Test::LocateAttributeByLinearWalk(&record, &expectedLocation));
+                NL_TEST_ASSERT(inSuite, foundCluster == cluster);
+                NL_TEST_ASSERT(inSuite, foundMetadata == am);
+
+                // The location of an external attribute is meaningless.
+                if (!emberAfAttributeIsExternal(am))
+                {
+                    NL_TEST_ASSERT(inSuite, location == expectedLocation);
+                }
+                checkedCount++;
+            }
+        }
+    }
+
+    return checkedCount;
+}
+
+void CheckFixedEndpoints(nlTestSuite * inSuite, void * inContext)
+{
+    emberAfEndpointConfigure();
+    NL_TEST_ASSERT(inSuite, emberAfFixedEndpointCount() > 1);
+    NL_TEST_ASSERT(inSuite, CheckAllAttributeLocations(inSuite) > 0);
+}
+
+void CheckDynamicEndpoints(nlTestSuite * inSuite, void * inContext)
+{
+    emberAfEndpointConfigure();
+    for (uint16_t index = 0; index < kDynamicEndpointCount; index++)
+    {
+        NL_TEST_ASSERT(inSuite,
+                       emberAfSetDynamicEndpoint(index, static_cast<EndpointId>(kFirstDynamicEndpoint + index),
+                                                 &bridgedLightEndpoint, 0x0100, 1) == EMBER_ZCL_STATUS_SUCCESS);
+    }
+
+    // The attributes of the fixed endpoints are located as before, and those of the dynamic endpoints too.
+    size_t fixedAttributeCount = 0;
+    for (uint16_t i = 0; i < emberAfFixedEndpointCount(); i++)
+    {
+        EmberAfEndpointType * endpointType = emAfEndpoints[i].endpointType;
+        for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+        {
+            fixedAttributeCount += endpointType->cluster[clusterIndex].attributeCount;
+        }
+    }
+    NL_TEST_ASSERT(inSuite,
+                   CheckAllAttributeLocations(inSuite) ==
+                       fixedAttributeCount + kDynamicEndpointCount * kBridgedLightAttributeCount);
+
+    // A cleared dynamic endpoint has no attributes anymore.
+    NL_TEST_ASSERT(inSuite, emberAfClearDynamicEndpoint(0) == kFirstDynamicEndpoint);
+    EmberAfAttributeSearchRecord record = { kFirstDynamicEndpoint, ZCL_ON_OFF_CLUSTER_ID, CLUSTER_MASK_SERVER,
+                                            ZCL_ON_OFF_ATTRIBUTE_ID, EMBER_AF_NULL_MANUFACTURER_CODE };
+    EmberAfCluster * cluster;
+    EmberAfAttributeMetadata * metadata;
+    uint8_t * location;
+    NL_TEST_ASSERT(inSuite, !emAfLocateAttribute(&record, &cluster, &metadata, &location));
+    NL_TEST_ASSERT(inSuite,
+                   CheckAllAttributeLocations(inSuite) ==
+                       fixedAttributeCount + (kDynamicEndpointCount - 1) * kBridgedLightAttributeCount);
+}
+
+void CheckUnknownAttributes(nlTestSuite * inSuite, void * inContext)
+{
+    emberAfEndpointConfigure();
+
+    EmberAfCluster * cluster;
+    EmberAfAttributeMetadata * metadata;
+    uint8_t * location;
+
+    EmberAfAttributeSearchRecord unknownAttribute = { 1, ZCL_ON_OFF_CLUSTER_ID, CLUSTER_MASK_SERVER, 0x7FFF,
+                                                      EMBER_AF_NULL_MANUFACTURER_CODE };
+    NL_TEST_ASSERT(inSuite, !emAfLocateAttribute(&unknownAttribute, &cluster, &metadata, &location));
+
+    EmberAfAttributeSearchRecord unknownEndpoint = { 0xFE, ZCL_ON_OFF_CLUSTER_ID, CLUSTER_MASK_SERVER, ZCL_ON_OFF_ATTRIBUTE_ID,
+                                                     EMBER_AF_NULL_MANUFACTURER_CODE };
+    NL_TEST_ASSERT(inSuite, !emAfLocateAttribute(&unknownEndpoint, &cluster, &metadata, &location));
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("FixedEndpoints", CheckFixedEndpoints),
+    NL_TEST_DEF("DynamicEndpoints", CheckDynamicEndpoints),
+    NL_TEST_DEF("UnknownAttributes", CheckUnknownAttributes),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestAttributeStorage()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "AttributeStorage",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAttributeStorage)
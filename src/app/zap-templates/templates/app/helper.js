@@ -352,6 +352,34 @@ function asTypeLiteralSuffix(type)
   }
 }
 
+/**
+ * Returns true if the command has arguments, all of them integers, so that the
+ * TLV codecs of core/CHIPTLVSchema.h apply to it.
+ *
+ * This function is meant to be used inside a {{#zcl_commands}} or a
+ * {{#all_user_cluster_commands}} block.
+ */
+function isFixedSizeCommand(options)
+{
+  const fixedSizeTypes = [ 'int8_t', 'uint8_t', 'int16_t', 'uint16_t', 'int32_t', 'uint32_t', 'int64_t', 'uint64_t' ];
+
+  function fn(pkgId)
+  {
+    const typeOptions = { 'hash' : {} };
+    return zclQuery.selectCommandArgumentsByCommandId(this.global.db, this.id, pkgId).then(args => {
+      if (args.length == 0 || args.some(arg => arg.isArray)) {
+        return false;
+      }
+
+      const types = args.map(arg => zclHelper.asUnderlyingZclType.call(this, arg.type, typeOptions));
+      return Promise.all(types).then(types => types.every(type => fixedSizeTypes.includes(ChipTypesHelper.asBasicType(type))));
+    })
+  }
+
+  const promise = templateUtil.ensureZclPackageId(this).then(fn.bind(this)).catch(err => console.log(err));
+  return templateUtil.templatePromise(this.global, promise)
+}
+
 //
 // Module exports
 //
@@ -366,3 +394,4 @@ exports.chip_endpoint_cluster_list                    = chip_endpoint_cluster_li
 exports.isSigned                                      = ChipTypesHelper.isSigned;
 exports.isStrEndsWith                                 = isStrEndsWith;
 exports.asTypeLiteralSuffix                           = asTypeLiteralSuffix;
+exports.isFixedSizeCommand                            = isFixedSizeCommand;
@@ -155,9 +155,23 @@ CHIP_ERROR Device::Serialize(SerializedDevice & output)
     static_assert(BASE64_ENCODED_LEN(sizeof(serializable)) <= sizeof(output.inner),
                   "Size of serializable should be <= size of output");
 
-    CHIP_ZERO_AT(serializable);
     CHIP_ZERO_AT(output);
 
+    ReturnErrorOnFailure(ToSerializable(serializable));
+
+    const uint16_t serializedLen = chip::Base64Encode(Uint8::to_const_uchar(reinterpret_cast<uint8_t *>(&serializable)),
+                                                      static_cast<uint16_t>(sizeof(serializable)), Uint8::to_char(output.inner));
+    VerifyOrReturnError(serializedLen > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(serializedLen < sizeof(output.inner), CHIP_ERROR_INVALID_ARGUMENT);
+    output.inner[serializedLen] = '\0';
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Device::ToSerializable(SerializableDevice & serializable)
+{
+    CHIP_ZERO_AT(serializable);
+
     serializable.mOpsCreds   = mPairing;
     serializable.mDeviceId   = Encoding::LittleEndian::HostSwap64(mDeviceId);
     serializable.mDevicePort = Encoding::LittleEndian::HostSwap16(mDeviceAddress.GetPort());
@@ -194,12 +208,6 @@ CHIP_ERROR Device::Serialize(SerializedDevice & output)
     static_assert(sizeof(serializable.mDeviceAddr) <= INET6_ADDRSTRLEN, "Size of device address must fit within INET6_ADDRSTRLEN");
     mDeviceAddress.GetIPAddress().ToString(Uint8::to_char(serializable.mDeviceAddr), sizeof(serializable.mDeviceAddr));
 
-    const uint16_t serializedLen = chip::Base64Encode(Uint8::to_const_uchar(reinterpret_cast<uint8_t *>(&serializable)),
-                                                      static_cast<uint16_t>(sizeof(serializable)), Uint8::to_char(output.inner));
-    VerifyOrReturnError(serializedLen > 0, CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrReturnError(serializedLen < sizeof(output.inner), CHIP_ERROR_INVALID_ARGUMENT);
-    output.inner[serializedLen] = '\0';
-
     return CHIP_NO_ERROR;
 }
 
@@ -219,6 +227,11 @@ CHIP_ERROR Device::Deserialize(const SerializedDevice & input)
     VerifyOrReturnError(deserializedLen > 0, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(deserializedLen <= sizeof(serializable), CHIP_ERROR_INVALID_ARGUMENT);
 
+    return FromSerializable(serializable);
+}
+
+CHIP_ERROR Device::FromSerializable(const SerializableDevice & serializable)
+{
     // The second parameter to FromString takes the strlen value. We are subtracting 1
     // from the sizeof(serializable.mDeviceAddr) to account for null termination, since
     // strlen doesn't include null character in the size.
@@ -405,16 +418,18 @@ CHIP_ERROR Device::UpdateAddress(const Transport::PeerAddress & addr)
     return CHIP_NO_ERROR;
 }
 
+bool Device::IsPersistedOnReset()
+{
+    // If a session can be found, the device is persisted on reset so that we track the newest message counter values
+    return IsActive() && mStorageDelegate != nullptr && mSessionManager != nullptr &&
+        mSessionManager->GetPeerConnectionState(mSecureSession) != nullptr;
+}
+
 void Device::Reset()
 {
-    if (IsActive() && mStorageDelegate != nullptr && mSessionManager != nullptr)
+    if (IsPersistedOnReset())
     {
-        // If a session can be found, persist the device so that we track the newest message counter values
-        Transport::PeerConnectionState * connectionState = mSessionManager->GetPeerConnectionState(mSecureSession);
-        if (connectionState != nullptr)
-        {
-            Persist();
-        }
+        Persist();
     }
 
     SetActive(false);
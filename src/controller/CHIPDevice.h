@@ -57,6 +57,7 @@ namespace Controller {
 
 class DeviceController;
 class DeviceStatusDelegate;
+struct SerializableDevice;
 struct SerializedDevice;
 
 constexpr size_t kMaxBlePendingPackets = 1;
@@ -232,6 +233,20 @@ public:
      **/
     CHIP_ERROR Deserialize(const SerializedDevice & input);
 
+    /** @brief Capture the device state in its decoded (not base64 encoded) form. This is the
+     *         representation that Serialize() encodes.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR ToSerializable(SerializableDevice & output);
+
+    /** @brief Restore the device state from its decoded form, as produced by ToSerializable()
+     *         or decoded by Deserialize().
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR FromSerializable(const SerializableDevice & input);
+
     /**
      * @brief Serialize and store the Device in persistent storage
      *
@@ -326,6 +341,13 @@ public:
 
     void Reset();
 
+    /**
+     * @brief
+     *   Return whether Reset() will write the device state to the persistent storage, i.e. whether
+     *   the device has a secure session whose message counters need to be tracked.
+     */
+    bool IsPersistedOnReset();
+
     NodeId GetDeviceId() const { return mDeviceId; }
 
     bool MatchesSession(SecureSessionHandle session) const { return mSecureSession == session; }
@@ -403,7 +425,7 @@ private:
         kNo,
     };
     /* Node ID assigned to the CHIP device */
-    NodeId mDeviceId;
+    NodeId mDeviceId = kUndefinedNodeId;
 
     /** Address used to communicate with the device.
      */
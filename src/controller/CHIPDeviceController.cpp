@@ -131,6 +131,8 @@ CHIP_ERROR DeviceController::Init(NodeId localDeviceId, ControllerInitParams par
     VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(mInetLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
+    ReturnErrorOnFailure(mActiveDevices.Init(params.maxActiveDevices));
+
     mStorageDelegate = params.storageDelegate;
 #if CONFIG_NETWORK_LAYER_BLE
 #if CONFIG_DEVICE_LAYER
@@ -316,7 +318,8 @@ CHIP_ERROR DeviceController::LoadLocalCredentials(Transport::AdminPairingInfo *
     }
 
     ChipLogProgress(Controller, "Generating credentials");
-    ReturnErrorOnFailure(admin->GetCredentials(mCredentials, mCertificates, mRootKeyId));
+    // The controller keeps its credentials for its lifetime: they don't take a state of the certificate decode pool.
+    ReturnErrorOnFailure(admin->GetCredentials(mCredentials, mCertificates, mRootKeyId, /* borrowDecodeState = */ false));
 
     ChipLogProgress(Controller, "Loaded credentials successfully");
     return CHIP_NO_ERROR;
@@ -328,10 +331,7 @@ CHIP_ERROR DeviceController::Shutdown()
 
     ChipLogDetail(Controller, "Shutting down the controller");
 
-    for (uint32_t i = 0; i < kNumMaxActiveDevices; i++)
-    {
-        mActiveDevices[i].Reset();
-    }
+    ReleaseAllDevices();
 
 #if CONFIG_DEVICE_LAYER
     //
@@ -373,6 +373,7 @@ CHIP_ERROR DeviceController::Shutdown()
     mStorageDelegate = nullptr;
 
     ReleaseAllDevices();
+    mActiveDevices.Shutdown();
 
     if (mMessageCounterManager != nullptr)
     {
@@ -429,26 +430,32 @@ CHIP_ERROR DeviceController::GetDevice(NodeId deviceId, Device ** out_device)
 {
     CHIP_ERROR err  = CHIP_NO_ERROR;
     Device * device = nullptr;
-    uint16_t index  = 0;
 
     VerifyOrExit(out_device != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
-    index = FindDeviceIndex(deviceId);
+    device = mActiveDevices.FindDevice(deviceId);
 
-    if (index < kNumMaxActiveDevices)
-    {
-        device = &mActiveDevices[index];
-    }
-    else
+    if (device == nullptr)
     {
+        SerializableDevice cachedState;
+
         err = InitializePairedDeviceList();
         SuccessOrExit(err);
 
         VerifyOrExit(mPairedDevices.Contains(deviceId), err = CHIP_ERROR_NOT_CONNECTED);
 
-        index = GetInactiveDeviceIndex();
-        VerifyOrExit(index < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
-        device = &mActiveDevices[index];
+        // The state of a recently released device is still cached in its decoded form.
+        // Rehydrate the device from it, instead of reading it back from the storage.
+        const bool hasCachedState = mActiveDevices.TakeCachedState(deviceId, cachedState);
+
+        device = AllocateDevice(deviceId);
+        VerifyOrExit(device != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
+        if (hasCachedState)
+        {
+            err = device->FromSerializable(cachedState);
+            SuccessOrExit(err);
+        }
+        else
         {
             SerializedDevice deviceInfo;
             uint16_t size = sizeof(deviceInfo.inner);
@@ -459,10 +466,10 @@ CHIP_ERROR DeviceController::GetDevice(NodeId deviceId, Device ** out_device)
             VerifyOrExit(size <= sizeof(deviceInfo.inner), err = CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
 
             err = device->Deserialize(deviceInfo);
-            VerifyOrExit(err == CHIP_NO_ERROR, ReleaseDevice(device));
-
-            device->Init(GetControllerDeviceInitParams(), mListenPort, mAdminId);
+            SuccessOrExit(err);
         }
+
+        device->Init(GetControllerDeviceInitParams(), mListenPort, mAdminId);
     }
 
     *out_device = device;
@@ -571,19 +578,19 @@ CHIP_ERROR DeviceController::GetFabricId(uint64_t & fabricId)
 CHIP_ERROR DeviceController::OnMessageReceived(Messaging::ExchangeContext * ec, const PacketHeader & packetHeader,
                                                const PayloadHeader & payloadHeader, System::PacketBufferHandle && msgBuf)
 {
-    uint16_t index;
-    bool needClose = true;
+    Device * device = nullptr;
+    bool needClose  = true;
 
     VerifyOrExit(mState == State::Initialized, ChipLogError(Controller, "OnMessageReceived was called in incorrect state"));
 
     VerifyOrExit(packetHeader.GetSourceNodeId().HasValue(),
                  ChipLogError(Controller, "OnMessageReceived was called for unknown source node"));
 
-    index = FindDeviceIndex(packetHeader.GetSourceNodeId().Value());
-    VerifyOrExit(index < kNumMaxActiveDevices, ChipLogError(Controller, "OnMessageReceived was called for unknown device object"));
+    device = mActiveDevices.FindDevice(packetHeader.GetSourceNodeId().Value());
+    VerifyOrExit(device != nullptr, ChipLogError(Controller, "OnMessageReceived was called for unknown device object"));
 
     needClose = false; // Device will handle it
-    mActiveDevices[index].OnMessageReceived(ec, packetHeader, payloadHeader, std::move(msgBuf));
+    device->OnMessageReceived(ec, packetHeader, payloadHeader, std::move(msgBuf));
 
 exit:
     if (needClose)
@@ -602,95 +609,58 @@ void DeviceController::OnNewConnection(SecureSessionHandle session, Messaging::E
 {
     VerifyOrReturn(mState == State::Initialized, ChipLogError(Controller, "OnNewConnection was called in incorrect state"));
 
-    uint16_t index = FindDeviceIndex(mgr->GetSessionMgr()->GetPeerConnectionState(session)->GetPeerNodeId());
-    VerifyOrReturn(index < kNumMaxActiveDevices,
-                   ChipLogDetail(Controller, "OnNewConnection was called for unknown device, ignoring it."));
+    Device * device = mActiveDevices.FindDevice(mgr->GetSessionMgr()->GetPeerConnectionState(session)->GetPeerNodeId());
+    VerifyOrReturn(device != nullptr, ChipLogDetail(Controller, "OnNewConnection was called for unknown device, ignoring it."));
 
-    mActiveDevices[index].OnNewConnection(session);
+    device->OnNewConnection(session);
 }
 
 void DeviceController::OnConnectionExpired(SecureSessionHandle session, Messaging::ExchangeManager * mgr)
 {
     VerifyOrReturn(mState == State::Initialized, ChipLogError(Controller, "OnConnectionExpired was called in incorrect state"));
 
-    uint16_t index = FindDeviceIndex(session);
-    VerifyOrReturn(index < kNumMaxActiveDevices,
-                   ChipLogDetail(Controller, "OnConnectionExpired was called for unknown device, ignoring it."));
+    Device * device = mActiveDevices.FindDevice(session);
+    VerifyOrReturn(device != nullptr, ChipLogDetail(Controller, "OnConnectionExpired was called for unknown device, ignoring it."));
 
-    mActiveDevices[index].OnConnectionExpired(session);
+    device->OnConnectionExpired(session);
 }
 
-uint16_t DeviceController::GetInactiveDeviceIndex()
+Device * DeviceController::AllocateDevice(NodeId id)
 {
-    uint16_t i = 0;
-    while (i < kNumMaxActiveDevices && mActiveDevices[i].IsActive())
-        i++;
-    if (i < kNumMaxActiveDevices)
+    if (mActiveDevices.IsFull())
     {
-        mActiveDevices[i].SetActive(true);
+        Device * evicted = mActiveDevices.FindEvictionCandidate([this](Device * device) { return IsDeviceEvictable(device); });
+        VerifyOrReturnError(evicted != nullptr, nullptr);
+
+        ChipLogDetail(Controller, "Evicting device 0x" ChipLogFormatX64 " from the active device table",
+                      ChipLogValueX64(evicted->GetDeviceId()));
+        ReleaseDevice(evicted);
     }
 
-    return i;
+    return mActiveDevices.AllocateDevice(id);
 }
 
-void DeviceController::ReleaseDevice(Device * device)
+bool DeviceController::IsDeviceEvictable(Device * device)
 {
-    device->Reset();
+    return !device->IsSessionSetupInProgress();
 }
 
-void DeviceController::ReleaseDevice(uint16_t index)
+void DeviceController::ReleaseDevice(Device * device)
 {
-    if (index < kNumMaxActiveDevices)
-    {
-        ReleaseDevice(&mActiveDevices[index]);
-    }
+    mActiveDevices.ReleaseDevice(device);
 }
 
 void DeviceController::ReleaseDeviceById(NodeId remoteDeviceId)
 {
-    for (uint16_t i = 0; i < kNumMaxActiveDevices; i++)
-    {
-        if (mActiveDevices[i].GetDeviceId() == remoteDeviceId)
-        {
-            ReleaseDevice(&mActiveDevices[i]);
-        }
-    }
+    mActiveDevices.RemoveDevice(remoteDeviceId);
 }
 
 void DeviceController::ReleaseAllDevices()
 {
-    for (uint16_t i = 0; i < kNumMaxActiveDevices; i++)
-    {
-        ReleaseDevice(&mActiveDevices[i]);
-    }
-}
-
-uint16_t DeviceController::FindDeviceIndex(SecureSessionHandle session)
-{
-    uint16_t i = 0;
-    while (i < kNumMaxActiveDevices)
-    {
-        if (mActiveDevices[i].IsActive() && mActiveDevices[i].IsSecureConnected() && mActiveDevices[i].MatchesSession(session))
-        {
-            return i;
-        }
-        i++;
-    }
-    return i;
-}
-
-uint16_t DeviceController::FindDeviceIndex(NodeId id)
-{
-    uint16_t i = 0;
-    while (i < kNumMaxActiveDevices)
-    {
-        if (mActiveDevices[i].IsActive() && mActiveDevices[i].GetDeviceId() == id)
-        {
-            return i;
-        }
-        i++;
-    }
-    return i;
+    mActiveDevices.ForEachActiveDevice([this](Device * device) {
+        ReleaseDevice(device);
+        return true;
+    });
 }
 
 CHIP_ERROR DeviceController::InitializePairedDeviceList()
@@ -719,6 +689,19 @@ CHIP_ERROR DeviceController::InitializePairedDeviceList()
             err = SetPairedDeviceList(ByteSpan(buffer, size));
             SuccessOrExit(err);
         }
+
+        // Apply the devices added or removed since the list was last persisted in full.
+        size = max_size;
+        PERSISTENT_KEY_OP(static_cast<uint64_t>(0), kPairedDeviceListDeltaKeyPrefix, key,
+                          lookupError = mStorageDelegate->SyncGetKeyValue(key, buffer, size));
+        if (lookupError != CHIP_ERROR_KEY_NOT_FOUND)
+        {
+            VerifyOrExit(size <= max_size, err = CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
+            err = mPairedDevices.DeserializeDelta(ByteSpan(buffer, size));
+            SuccessOrExit(err);
+        }
+
+        mPairedDevicesInitialized = true;
     }
 
 exit:
@@ -817,7 +800,7 @@ DeviceCommissioner::DeviceCommissioner() :
     mOnDeviceConnectionFailureCallback(OnDeviceConnectionFailureFn, this), mDeviceNOCCallback(OnDeviceNOCGenerated, this)
 {
     mPairingDelegate      = nullptr;
-    mDeviceBeingPaired    = kNumMaxActiveDevices;
+    mDeviceBeingPaired    = nullptr;
     mPairedDevicesUpdated = false;
 }
 
@@ -866,7 +849,7 @@ CHIP_ERROR DeviceCommissioner::PairDevice(NodeId remoteDeviceId, RendezvousParam
 
     VerifyOrExit(remoteDeviceId != kAnyNodeId && remoteDeviceId != kUndefinedNodeId, err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mDeviceBeingPaired == kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mDeviceBeingPaired == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
     VerifyOrExit(admin != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     err = InitializePairedDeviceList();
@@ -893,9 +876,9 @@ CHIP_ERROR DeviceCommissioner::PairDevice(NodeId remoteDeviceId, RendezvousParam
                                                   params.GetPeerAddress().GetInterface());
     }
 
-    mDeviceBeingPaired = GetInactiveDeviceIndex();
-    VerifyOrExit(mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
-    device = &mActiveDevices[mDeviceBeingPaired];
+    device = AllocateDevice(remoteDeviceId);
+    VerifyOrExit(device != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    mDeviceBeingPaired = device;
 
     // If the CSRNonce is passed in, using that else using a random one..
     if (params.HasCSRNonce())
@@ -954,7 +937,7 @@ exit:
     if (err != CHIP_NO_ERROR)
     {
         // Delete the current rendezvous session only if a device is not currently being paired.
-        if (mDeviceBeingPaired == kNumMaxActiveDevices)
+        if (mDeviceBeingPaired == nullptr)
         {
             FreeRendezvousSession();
         }
@@ -962,7 +945,7 @@ exit:
         if (device != nullptr)
         {
             ReleaseDevice(device);
-            mDeviceBeingPaired = kNumMaxActiveDevices;
+            mDeviceBeingPaired = nullptr;
         }
     }
 
@@ -982,14 +965,14 @@ CHIP_ERROR DeviceCommissioner::PairTestDeviceWithoutSecurity(NodeId remoteDevice
     VerifyOrExit(remoteDeviceId != kUndefinedNodeId && remoteDeviceId != kAnyNodeId, err = CHIP_ERROR_INVALID_ARGUMENT);
 
     VerifyOrExit(mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(mDeviceBeingPaired == kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(mDeviceBeingPaired == nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
     testSecurePairingSecret = chip::Platform::New<SecurePairingUsingTestSecret>();
     VerifyOrExit(testSecurePairingSecret != nullptr, err = CHIP_ERROR_NO_MEMORY);
 
-    mDeviceBeingPaired = GetInactiveDeviceIndex();
-    VerifyOrExit(mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_NO_MEMORY);
-    device = &mActiveDevices[mDeviceBeingPaired];
+    device = AllocateDevice(remoteDeviceId);
+    VerifyOrExit(device != nullptr, err = CHIP_ERROR_NO_MEMORY);
+    mDeviceBeingPaired = device;
 
     testSecurePairingSecret->ToSerializable(device->GetPairing());
 
@@ -1034,7 +1017,7 @@ exit:
         if (device != nullptr)
         {
             ReleaseDevice(device);
-            mDeviceBeingPaired = kNumMaxActiveDevices;
+            mDeviceBeingPaired = nullptr;
         }
     }
 
@@ -1044,15 +1027,15 @@ exit:
 CHIP_ERROR DeviceCommissioner::StopPairing(NodeId remoteDeviceId)
 {
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mDeviceBeingPaired < kNumMaxActiveDevices, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mDeviceBeingPaired != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
     VerifyOrReturnError(device->GetDeviceId() == remoteDeviceId, CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR);
 
     FreeRendezvousSession();
 
     ReleaseDevice(device);
-    mDeviceBeingPaired = kNumMaxActiveDevices;
+    mDeviceBeingPaired = nullptr;
     return CHIP_NO_ERROR;
 }
 
@@ -1062,13 +1045,9 @@ CHIP_ERROR DeviceCommissioner::UnpairDevice(NodeId remoteDeviceId)
 
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
 
-    if (mDeviceBeingPaired < kNumMaxActiveDevices)
+    if (mDeviceBeingPaired != nullptr && mDeviceBeingPaired->GetDeviceId() == remoteDeviceId)
     {
-        Device * device = &mActiveDevices[mDeviceBeingPaired];
-        if (device->GetDeviceId() == remoteDeviceId)
-        {
-            FreeRendezvousSession();
-        }
+        FreeRendezvousSession();
     }
 
     if (mStorageDelegate != nullptr)
@@ -1110,7 +1089,7 @@ void DeviceCommissioner::RendezvousCleanup(CHIP_ERROR status)
     FreeRendezvousSession();
 
     // TODO: make mStorageDelegate mandatory once all controller applications implement the interface.
-    if (mDeviceBeingPaired != kNumMaxActiveDevices && mStorageDelegate != nullptr)
+    if (mDeviceBeingPaired != nullptr && mStorageDelegate != nullptr)
     {
         // Let's release the device that's being paired.
         // If pairing was successful, its information is
@@ -1120,7 +1099,7 @@ void DeviceCommissioner::RendezvousCleanup(CHIP_ERROR status)
         DeviceController::ReleaseDevice(mDeviceBeingPaired);
     }
 
-    mDeviceBeingPaired = kNumMaxActiveDevices;
+    mDeviceBeingPaired = nullptr;
 
     if (mPairingDelegate != nullptr)
     {
@@ -1142,9 +1121,9 @@ void DeviceCommissioner::OnSessionEstablishmentError(CHIP_ERROR err)
 
 void DeviceCommissioner::OnSessionEstablished()
 {
-    VerifyOrReturn(mDeviceBeingPaired < kNumMaxActiveDevices, OnSessionEstablishmentError(CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR));
+    VerifyOrReturn(mDeviceBeingPaired != nullptr, OnSessionEstablishmentError(CHIP_ERROR_INVALID_DEVICE_DESCRIPTOR));
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
 
     mPairingSession.PeerConnection().SetPeerNodeId(device->GetDeviceId());
 
@@ -1242,9 +1221,9 @@ void DeviceCommissioner::OnDeviceNOCGenerated(void * context, const ByteSpan & n
 
     Device * device = nullptr;
     VerifyOrExit(commissioner->mState == State::Initialized, err = CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrExit(commissioner->mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissioner->mDeviceBeingPaired != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
-    device = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+    device = commissioner->mDeviceBeingPaired;
 
     VerifyOrExit(chipCert.Alloc(chipCertAllocatedLen), err = CHIP_ERROR_NO_MEMORY);
 
@@ -1271,9 +1250,9 @@ CHIP_ERROR DeviceCommissioner::ProcessOpCSR(const ByteSpan & CSR, const ByteSpan
                                             const ByteSpan & Signature)
 {
     VerifyOrReturnError(mState == State::Initialized, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mDeviceBeingPaired < kNumMaxActiveDevices, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mDeviceBeingPaired != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
 
     // Verify that Nonce matches with what we sent
     const ByteSpan nonce = device->GetCSRNonce();
@@ -1331,9 +1310,9 @@ void DeviceCommissioner::OnOperationalCertificateAddResponse(void * context, uin
     commissioner->mOpCSRResponseCallback.Cancel();
     commissioner->mOnCertFailureCallback.Cancel();
 
-    VerifyOrExit(commissioner->mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissioner->mDeviceBeingPaired != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
-    device = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+    device = commissioner->mDeviceBeingPaired;
 
     err = commissioner->OnOperationalCredentialsProvisioningCompletion(device);
 
@@ -1383,9 +1362,9 @@ void DeviceCommissioner::OnRootCertSuccessResponse(void * context)
     commissioner->mRootCertResponseCallback.Cancel();
     commissioner->mOnRootCertFailureCallback.Cancel();
 
-    VerifyOrExit(commissioner->mDeviceBeingPaired < kNumMaxActiveDevices, err = CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrExit(commissioner->mDeviceBeingPaired != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
 
-    device = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+    device = commissioner->mDeviceBeingPaired;
 
     err = commissioner->SendOperationalCertificateSigningRequestCommand(device);
     SuccessOrExit(err);
@@ -1446,13 +1425,40 @@ void DeviceCommissioner::PersistDeviceList()
 {
     if (mStorageDelegate != nullptr && mPairedDevicesUpdated && mState == State::Initialized)
     {
-        mPairedDevices.Serialize([&](ByteSpan data) -> CHIP_ERROR {
+        // Only persist the devices added or removed since the list was last persisted in full,
+        // unless there are too many of them.
+        CHIP_ERROR err = mPairedDevices.SerializeDelta([&](ByteSpan data) -> CHIP_ERROR {
             VerifyOrReturnError(data.size() <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
-            PERSISTENT_KEY_OP(static_cast<uint64_t>(0), kPairedDeviceListKeyPrefix, key,
-                              mStorageDelegate->SyncSetKeyValue(key, data.data(), static_cast<uint16_t>(data.size())));
-            mPairedDevicesUpdated = false;
-            return CHIP_NO_ERROR;
+            CHIP_ERROR error = CHIP_NO_ERROR;
+            PERSISTENT_KEY_OP(static_cast<uint64_t>(0), kPairedDeviceListDeltaKeyPrefix, key,
+                              error = mStorageDelegate->SyncSetKeyValue(key, data.data(), static_cast<uint16_t>(data.size())));
+            return error;
         });
+
+        if (err != CHIP_NO_ERROR)
+        {
+            err = mPairedDevices.Serialize([&](ByteSpan data) -> CHIP_ERROR {
+                VerifyOrReturnError(data.size() <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+                CHIP_ERROR error = CHIP_NO_ERROR;
+                PERSISTENT_KEY_OP(static_cast<uint64_t>(0), kPairedDeviceListKeyPrefix, key,
+                                  error = mStorageDelegate->SyncSetKeyValue(key, data.data(), static_cast<uint16_t>(data.size())));
+                return error;
+            });
+
+            // The persisted changes are now part of the list. They would be ignored anyway, since they
+            // don't apply to the new list.
+            PERSISTENT_KEY_OP(static_cast<uint64_t>(0), kPairedDeviceListDeltaKeyPrefix, key,
+                              mStorageDelegate->SyncDeleteKeyValue(key));
+        }
+
+        if (err == CHIP_NO_ERROR)
+        {
+            mPairedDevicesUpdated = false;
+        }
+        else
+        {
+            ChipLogError(Controller, "Failed to persist the device list: %" CHIP_ERROR_FORMAT, err);
+        }
     }
 }
 
@@ -1462,6 +1468,11 @@ void DeviceCommissioner::ReleaseDevice(Device * device)
     DeviceController::ReleaseDevice(device);
 }
 
+bool DeviceCommissioner::IsDeviceEvictable(Device * device)
+{
+    return device != mDeviceBeingPaired && DeviceController::IsDeviceEvictable(device);
+}
+
 #if CONFIG_NETWORK_LAYER_BLE
 CHIP_ERROR DeviceCommissioner::CloseBleConnection()
 {
@@ -1475,9 +1486,9 @@ CHIP_ERROR DeviceCommissioner::CloseBleConnection()
 void DeviceCommissioner::OnSessionEstablishmentTimeout()
 {
     VerifyOrReturn(mState == State::Initialized);
-    VerifyOrReturn(mDeviceBeingPaired < kNumMaxActiveDevices);
+    VerifyOrReturn(mDeviceBeingPaired != nullptr);
 
-    Device * device = &mActiveDevices[mDeviceBeingPaired];
+    Device * device = mDeviceBeingPaired;
     StopPairing(device->GetDeviceId());
 
     if (mPairingDelegate != nullptr)
@@ -1592,9 +1603,9 @@ void DeviceCommissioner::OnNodeIdResolved(const chip::Mdns::ResolvedNodeData & n
 
 void DeviceCommissioner::OnNodeIdResolutionFailed(const chip::PeerId & peer, CHIP_ERROR error)
 {
-    if (mDeviceBeingPaired < kNumMaxActiveDevices)
+    if (mDeviceBeingPaired != nullptr)
     {
-        Device * device = &mActiveDevices[mDeviceBeingPaired];
+        Device * device = mDeviceBeingPaired;
         if (device->GetDeviceId() == peer.GetNodeId() && mCommissioningStage == CommissioningStage::kFindOperational)
         {
             OnSessionEstablishmentError(error);
@@ -1610,9 +1621,9 @@ void DeviceCommissioner::OnDeviceConnectedFn(void * context, Device * device)
     DeviceCommissioner * commissioner = reinterpret_cast<DeviceCommissioner *>(context);
     VerifyOrReturn(commissioner != nullptr, ChipLogProgress(Controller, "Device connected callback with null context. Ignoring"));
 
-    if (commissioner->mDeviceBeingPaired < kNumMaxActiveDevices)
+    if (commissioner->mDeviceBeingPaired != nullptr)
     {
-        Device * deviceBeingPaired = &commissioner->mActiveDevices[commissioner->mDeviceBeingPaired];
+        Device * deviceBeingPaired = commissioner->mDeviceBeingPaired;
         if (device == deviceBeingPaired && commissioner->mCommissioningStage == CommissioningStage::kFindOperational)
         {
             commissioner->AdvanceCommissioningStage(CHIP_NO_ERROR);
@@ -1687,12 +1698,12 @@ void DeviceCommissioner::AdvanceCommissioningStage(CHIP_ERROR err)
         return;
     }
     Device * device = nullptr;
-    if (mDeviceBeingPaired >= kNumMaxActiveDevices)
+    if (mDeviceBeingPaired == nullptr)
     {
         return;
     }
 
-    device = &mActiveDevices[mDeviceBeingPaired];
+    device = mDeviceBeingPaired;
 
     // TODO(cecille): We probably want something better than this for breadcrumbs.
     uint64_t breadcrumb = static_cast<uint64_t>(nextStage);
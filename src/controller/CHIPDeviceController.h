@@ -31,6 +31,7 @@
 #include <app/InteractionModelDelegate.h>
 #include <controller/AbstractMdnsDiscoveryController.h>
 #include <controller/CHIPDevice.h>
+#include <controller/DeviceTable.h>
 #include <controller/OperationalCredentialsDelegate.h>
 #include <controller/data_model/gen/CHIPClientCallbacks.h>
 #include <core/CHIPCore.h>
@@ -65,7 +66,9 @@ namespace chip {
 
 namespace Controller {
 
-constexpr uint16_t kNumMaxActiveDevices = 64;
+// Suggested soft limit on the number of simultaneously active device objects, for applications
+// that opt in to eviction (see ControllerInitParams::maxActiveDevices).
+constexpr uint32_t kNumMaxActiveDevices = 64;
 constexpr uint16_t kNumMaxPairedDevices = 128;
 
 // Raw functions for cluster callbacks
@@ -88,6 +91,13 @@ struct ControllerInitParams
     DeviceAddressUpdateDelegate * mDeviceAddressUpdateDelegate = nullptr;
 #endif
     OperationalCredentialsDelegate * operationalCredentialsDelegate = nullptr;
+
+    /* Soft limit on the number of device objects that are kept active. When the limit is reached,
+       the least recently used idle device is evicted to the persistent storage, and its device
+       object is recycled for another node. Applications that keep the Device pointers returned
+       by GetDevice() must leave this at zero (the default), which disables eviction so that the
+       number of active devices is limited only by the available memory. */
+    uint32_t maxActiveDevices = 0;
 };
 
 enum CommissioningStage : uint8_t
@@ -293,13 +303,13 @@ protected:
 
     State mState;
 
-    /* A list of device objects that can be used for communicating with corresponding
-       CHIP devices. The list does not contain all the paired devices, but only the ones
+    /* A table of device objects that can be used for communicating with corresponding
+       CHIP devices. The table does not contain all the paired devices, but only the ones
        which the controller application is currently accessing.
     */
-    Device mActiveDevices[kNumMaxActiveDevices];
+    DeviceTable mActiveDevices;
 
-    SerializableU64Set<kNumMaxPairedDevices> mPairedDevices;
+    SortedSerializableU64Set<kNumMaxPairedDevices> mPairedDevices;
     bool mPairedDevicesInitialized;
 
     NodeId mLocalDeviceId;
@@ -322,10 +332,14 @@ protected:
     System::Layer * mSystemLayer = nullptr;
 
     uint16_t mListenPort;
-    uint16_t GetInactiveDeviceIndex();
-    uint16_t FindDeviceIndex(SecureSessionHandle session);
-    uint16_t FindDeviceIndex(NodeId id);
-    void ReleaseDevice(uint16_t index);
+
+    /* Allocate an active device object for the given node. If the active device table is full,
+       the least recently used device that can be evicted is released first. */
+    Device * AllocateDevice(NodeId id);
+
+    /* Return whether the device object can be released to make room for another device. */
+    virtual bool IsDeviceEvictable(Device * device);
+
     void ReleaseDeviceById(NodeId remoteDeviceId);
     CHIP_ERROR InitializePairedDeviceList();
     CHIP_ERROR SetPairedDeviceList(ByteSpan pairedDeviceSerializedSet);
@@ -526,12 +540,13 @@ public:
     void RegisterPairingDelegate(DevicePairingDelegate * pairingDelegate) { mPairingDelegate = pairingDelegate; }
 
 private:
+    friend class TestDeviceCommissioner;
     DevicePairingDelegate * mPairingDelegate;
 
-    /* This field is an index in mActiveDevices list. The object at this index in the list
-       contains the device object that's tracking the state of the device that's being paired.
-       If no device is currently being paired, this value will be kNumMaxPairedDevices.  */
-    uint16_t mDeviceBeingPaired;
+    /* This field points to the device object in mActiveDevices that's tracking the state of
+       the device that's being paired. If no device is currently being paired, this value will
+       be nullptr.  */
+    Device * mDeviceBeingPaired;
 
     /* TODO: BLE rendezvous and IP rendezvous should share the same procedure, so this is just a
        workaround-like flag and should be removed in the future.
@@ -550,6 +565,8 @@ private:
 
     void PersistDeviceList();
 
+    bool IsDeviceEvictable(Device * device) override;
+
     void FreeRendezvousSession();
 
     CHIP_ERROR LoadKeyId(PersistentStorageDelegate * delegate, uint16_t & out);
@@ -0,0 +1,357 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Implementation of DeviceTable, the set of device objects that a controller
+ *      is currently accessing, indexed by node ID.
+ *
+ */
+
+#include <controller/DeviceTable.h>
+
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+
+namespace chip {
+namespace Controller {
+
+CHIP_ERROR DeviceTable::Init(uint32_t maxActiveDevices)
+{
+    VerifyOrReturnError(mBuckets == nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    mBuckets = static_cast<Entry **>(chip::Platform::MemoryCalloc(kInitialBucketCount, sizeof(Entry *)));
+    VerifyOrReturnError(mBuckets != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    mBucketCount      = kInitialBucketCount;
+    mEntryCount       = 0;
+    mActiveCount      = 0;
+    mMaxActiveDevices = maxActiveDevices;
+    return CHIP_NO_ERROR;
+}
+
+void DeviceTable::Shutdown()
+{
+    for (uint32_t i = 0; i < mBucketCount; i++)
+    {
+        Entry * entry = mBuckets[i];
+        while (entry != nullptr)
+        {
+            Entry * next = entry->mHashNext;
+            if (entry->mSlot != nullptr)
+            {
+                chip::Platform::Delete(entry->mSlot);
+            }
+            chip::Platform::Delete(entry);
+            entry = next;
+        }
+    }
+
+    while (mFreeSlots != nullptr)
+    {
+        Slot * next = mFreeSlots->mNextFree;
+        chip::Platform::Delete(mFreeSlots);
+        mFreeSlots = next;
+    }
+
+    if (mBuckets != nullptr)
+    {
+        chip::Platform::MemoryFree(mBuckets);
+        mBuckets = nullptr;
+    }
+
+    mBucketCount = 0;
+    mEntryCount  = 0;
+    mActiveCount = 0;
+    mLruHead     = nullptr;
+    mLruTail     = nullptr;
+}
+
+Device * DeviceTable::FindDevice(NodeId nodeId)
+{
+    Entry * entry = Lookup(nodeId);
+    VerifyOrReturnError(entry != nullptr && entry->mSlot != nullptr, nullptr);
+
+    if (entry != mLruHead)
+    {
+        Unlink(entry);
+        LinkMostRecent(entry);
+    }
+    return &entry->mSlot->mDevice;
+}
+
+Device * DeviceTable::FindDevice(SecureSessionHandle session)
+{
+    // The secure session handle carries the peer node ID, so the device is found by its key,
+    // and then verified against the session.
+    Device * device = FindDevice(session.GetPeerNodeId());
+    VerifyOrReturnError(device != nullptr && device->IsSecureConnected() && device->MatchesSession(session), nullptr);
+    return device;
+}
+
+Device * DeviceTable::AllocateDevice(NodeId nodeId)
+{
+    VerifyOrReturnError(mBuckets != nullptr, nullptr);
+
+    Entry * entry = LookupOrInsert(nodeId);
+    VerifyOrReturnError(entry != nullptr && entry->mSlot == nullptr, nullptr);
+
+    entry->mSlot = AllocateSlot();
+    if (entry->mSlot == nullptr)
+    {
+        if (!entry->mHasCachedState)
+        {
+            Remove(entry);
+        }
+        return nullptr;
+    }
+
+    entry->mHasCachedState = false;
+    LinkMostRecent(entry);
+    mActiveCount++;
+
+    Device * device = &entry->mSlot->mDevice;
+    device->SetActive(true);
+    return device;
+}
+
+void DeviceTable::ReleaseDevice(Device * device)
+{
+    VerifyOrReturn(device != nullptr);
+
+    Entry * entry = Lookup(device->GetDeviceId());
+    if (entry == nullptr || entry->mSlot == nullptr || &entry->mSlot->mDevice != device)
+    {
+        // The device was not initialized with its node ID (e.g. an error occurred while setting
+        // up the pairing), so it cannot be found by its key.
+        entry = nullptr;
+        for (Entry * active = mLruHead; active != nullptr; active = active->mLruNext)
+        {
+            if (&active->mSlot->mDevice == device)
+            {
+                entry = active;
+                break;
+            }
+        }
+    }
+
+    if (entry == nullptr)
+    {
+        // Not owned by the table (or already released), just reset it.
+        device->Reset();
+        return;
+    }
+
+    // The state is cached only if it is also written to the storage by Reset(), so that the
+    // cached copy never differs from the persisted one.
+    entry->mHasCachedState = device->IsPersistedOnReset() && device->ToSerializable(entry->mCachedState) == CHIP_NO_ERROR;
+
+    device->Reset();
+    DeactivateEntry(entry);
+
+    if (!entry->mHasCachedState)
+    {
+        Remove(entry);
+    }
+}
+
+void DeviceTable::RemoveDevice(NodeId nodeId)
+{
+    Entry * entry = Lookup(nodeId);
+    VerifyOrReturn(entry != nullptr);
+
+    if (entry->mSlot != nullptr)
+    {
+        entry->mSlot->mDevice.Reset();
+        DeactivateEntry(entry);
+    }
+
+    Remove(entry);
+}
+
+bool DeviceTable::TakeCachedState(NodeId nodeId, SerializableDevice & output)
+{
+    Entry * entry = Lookup(nodeId);
+    VerifyOrReturnError(entry != nullptr && entry->mSlot == nullptr && entry->mHasCachedState, false);
+
+    output = entry->mCachedState;
+    Remove(entry);
+    return true;
+}
+
+size_t DeviceTable::Hash(NodeId nodeId)
+{
+    // 64-bit finalizer from MurmurHash3. Node IDs are often allocated sequentially, so the bits
+    // are mixed before the bucket index is taken from the low order bits.
+    uint64_t hash = nodeId;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return static_cast<size_t>(hash);
+}
+
+DeviceTable::Entry * DeviceTable::Lookup(NodeId nodeId)
+{
+    VerifyOrReturnError(mBuckets != nullptr, nullptr);
+
+    Entry * entry = mBuckets[Hash(nodeId) & (mBucketCount - 1)];
+    while (entry != nullptr && entry->mNodeId != nodeId)
+    {
+        entry = entry->mHashNext;
+    }
+    return entry;
+}
+
+DeviceTable::Entry * DeviceTable::LookupOrInsert(NodeId nodeId)
+{
+    Entry * entry = Lookup(nodeId);
+    if (entry != nullptr)
+    {
+        return entry;
+    }
+
+    if (mEntryCount >= mBucketCount)
+    {
+        // Growing is an optimization, the table remains usable (with longer chains) if it fails.
+        Grow();
+    }
+
+    entry = chip::Platform::New<Entry>();
+    VerifyOrReturnError(entry != nullptr, nullptr);
+
+    Entry *& bucket  = mBuckets[Hash(nodeId) & (mBucketCount - 1)];
+    entry->mNodeId   = nodeId;
+    entry->mHashNext = bucket;
+    bucket           = entry;
+    mEntryCount++;
+    return entry;
+}
+
+void DeviceTable::Remove(Entry * entry)
+{
+    Entry ** link = &mBuckets[Hash(entry->mNodeId) & (mBucketCount - 1)];
+    while (*link != nullptr && *link != entry)
+    {
+        link = &(*link)->mHashNext;
+    }
+
+    VerifyOrReturn(*link == entry);
+    *link = entry->mHashNext;
+    mEntryCount--;
+    chip::Platform::Delete(entry);
+}
+
+CHIP_ERROR DeviceTable::Grow()
+{
+    VerifyOrReturnError(mBucketCount <= UINT32_MAX / 2, CHIP_ERROR_NO_MEMORY);
+
+    const uint32_t newBucketCount = mBucketCount * 2;
+    Entry ** newBuckets           = static_cast<Entry **>(chip::Platform::MemoryCalloc(newBucketCount, sizeof(Entry *)));
+    VerifyOrReturnError(newBuckets != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    for (uint32_t i = 0; i < mBucketCount; i++)
+    {
+        Entry * entry = mBuckets[i];
+        while (entry != nullptr)
+        {
+            Entry * next     = entry->mHashNext;
+            Entry *& bucket  = newBuckets[Hash(entry->mNodeId) & (newBucketCount - 1)];
+            entry->mHashNext = bucket;
+            bucket           = entry;
+            entry            = next;
+        }
+    }
+
+    chip::Platform::MemoryFree(mBuckets);
+    mBuckets     = newBuckets;
+    mBucketCount = newBucketCount;
+    return CHIP_NO_ERROR;
+}
+
+void DeviceTable::LinkMostRecent(Entry * entry)
+{
+    entry->mLruPrev = nullptr;
+    entry->mLruNext = mLruHead;
+    if (mLruHead != nullptr)
+    {
+        mLruHead->mLruPrev = entry;
+    }
+    mLruHead = entry;
+    if (mLruTail == nullptr)
+    {
+        mLruTail = entry;
+    }
+}
+
+void DeviceTable::Unlink(Entry * entry)
+{
+    if (entry->mLruPrev != nullptr)
+    {
+        entry->mLruPrev->mLruNext = entry->mLruNext;
+    }
+    else
+    {
+        mLruHead = entry->mLruNext;
+    }
+
+    if (entry->mLruNext != nullptr)
+    {
+        entry->mLruNext->mLruPrev = entry->mLruPrev;
+    }
+    else
+    {
+        mLruTail = entry->mLruPrev;
+    }
+
+    entry->mLruPrev = nullptr;
+    entry->mLruNext = nullptr;
+}
+
+DeviceTable::Slot * DeviceTable::AllocateSlot()
+{
+    // Released device objects are recycled rather than freed, as the application may still
+    // hold a pointer to a released device (matching the behavior of a fixed array of devices).
+    Slot * slot = mFreeSlots;
+    if (slot != nullptr)
+    {
+        mFreeSlots      = slot->mNextFree;
+        slot->mNextFree = nullptr;
+        return slot;
+    }
+
+    return chip::Platform::New<Slot>();
+}
+
+void DeviceTable::FreeSlot(Slot * slot)
+{
+    slot->mNextFree = mFreeSlots;
+    mFreeSlots      = slot;
+}
+
+void DeviceTable::DeactivateEntry(Entry * entry)
+{
+    Unlink(entry);
+    FreeSlot(entry->mSlot);
+    entry->mSlot = nullptr;
+    mActiveCount--;
+}
+
+} // namespace Controller
+} // namespace chip
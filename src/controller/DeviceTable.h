@@ -0,0 +1,223 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Declaration of DeviceTable, the set of device objects that a controller
+ *      is currently accessing, indexed by node ID.
+ *
+ */
+
+#pragma once
+
+#include <controller/CHIPDevice.h>
+#include <core/CHIPCore.h>
+#include <support/DLLUtil.h>
+#include <transport/SecureSessionHandle.h>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * @brief
+ *   A growable, hash indexed table of the device objects that the controller application is
+ *   currently accessing.
+ *
+ *   Device objects are allocated on demand and recycled when released, so the number of
+ *   tracked devices is limited only by memory (or by the optional soft capacity). Lookups
+ *   by node ID or by secure session are O(1). Active devices are kept in least recently
+ *   used order, so that the controller can evict the coldest device to the persistent
+ *   storage when the soft capacity is reached.
+ *
+ *   When a device that has a secure session is released, the table keeps the decoded form
+ *   of the state that is being persisted for it. The next access to that device rehydrates
+ *   it from that cached copy, without reading and base64 decoding the storage entry.
+ */
+class DLL_EXPORT DeviceTable
+{
+public:
+    DeviceTable() = default;
+    ~DeviceTable() { Shutdown(); }
+
+    DeviceTable(const DeviceTable &) = delete;
+    DeviceTable & operator=(const DeviceTable &) = delete;
+
+    /**
+     * @brief
+     *   Initialize the table.
+     *
+     * @param[in] maxActiveDevices  Soft limit on the number of simultaneously active device objects.
+     *                              Zero means that the number is limited only by the available memory.
+     */
+    CHIP_ERROR Init(uint32_t maxActiveDevices);
+
+    /**
+     * @brief
+     *   Free all device objects and cached device state. Devices must have been released (reset) beforehand.
+     */
+    void Shutdown();
+
+    /**
+     * @brief
+     *   Find the active device object for the given node ID, and mark it as the most recently used one.
+     *
+     * @return The device object, or nullptr if the device is not currently active.
+     */
+    Device * FindDevice(NodeId nodeId);
+
+    /**
+     * @brief
+     *   Find the active, securely connected device object that is using the given secure session.
+     *
+     * @return The device object, or nullptr if no device is using the session.
+     */
+    Device * FindDevice(SecureSessionHandle session);
+
+    /**
+     * @brief
+     *   Allocate an active device object for the given node ID. The caller is expected to initialize
+     *   the returned object. Any cached state for the node is discarded.
+     *
+     * @return The device object, or nullptr if the node already has an active device object, or if
+     *         the memory could not be allocated.
+     */
+    Device * AllocateDevice(NodeId nodeId);
+
+    /**
+     * @brief
+     *   Reset the device object and return it to the table. If the device is persisted as part of the
+     *   reset, the persisted state is also cached in its decoded form.
+     */
+    void ReleaseDevice(Device * device);
+
+    /**
+     * @brief
+     *   Release the device object for the given node ID, if any, and drop any cached state for it.
+     */
+    void RemoveDevice(NodeId nodeId);
+
+    /**
+     * @brief
+     *   Retrieve and drop the cached decoded state of a device that is not currently active.
+     *
+     * @return true if cached state was found and copied to `output`.
+     */
+    bool TakeCachedState(NodeId nodeId, SerializableDevice & output);
+
+    /**
+     * @brief
+     *   Return whether the number of active devices reached the soft capacity of the table.
+     */
+    bool IsFull() const { return mMaxActiveDevices != 0 && mActiveCount >= mMaxActiveDevices; }
+
+    uint32_t ActiveCount() const { return mActiveCount; }
+
+    /**
+     * @brief
+     *   Find the least recently used active device for which `canEvict` returns true.
+     *
+     *  @param     canEvict  The functor of type `bool (*)(Device *)`.
+     *  @return    The eviction candidate, or nullptr if no active device can be evicted.
+     */
+    template <typename F>
+    Device * FindEvictionCandidate(F canEvict)
+    {
+        for (Entry * entry = mLruTail; entry != nullptr; entry = entry->mLruPrev)
+        {
+            if (canEvict(&entry->mSlot->mDevice))
+            {
+                return &entry->mSlot->mDevice;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief
+     *   Run a functor for each active device, from the most to the least recently used one.
+     *   The functor may release the device it is called for.
+     *
+     *  @param     f    The functor of type `bool (*)(Device *)`, return false to break the iteration
+     *  @return    bool Returns false if broke during iteration
+     */
+    template <typename F>
+    bool ForEachActiveDevice(F f)
+    {
+        Entry * next = nullptr;
+        for (Entry * entry = mLruHead; entry != nullptr; entry = next)
+        {
+            next = entry->mLruNext;
+            if (!f(&entry->mSlot->mDevice))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    struct Slot
+    {
+        Device mDevice;
+        Slot * mNextFree = nullptr;
+    };
+
+    struct Entry
+    {
+        NodeId mNodeId;
+        Entry * mHashNext = nullptr;
+
+        // Set while the device is active; active entries are linked in LRU order.
+        Slot * mSlot     = nullptr;
+        Entry * mLruPrev = nullptr;
+        Entry * mLruNext = nullptr;
+
+        // Decoded copy of the persisted device state, kept while the device is not active.
+        bool mHasCachedState = false;
+        SerializableDevice mCachedState;
+    };
+
+    static constexpr uint32_t kInitialBucketCount = 16;
+
+    static size_t Hash(NodeId nodeId);
+
+    Entry * Lookup(NodeId nodeId);
+    Entry * LookupOrInsert(NodeId nodeId);
+    void Remove(Entry * entry);
+    CHIP_ERROR Grow();
+
+    void LinkMostRecent(Entry * entry);
+    void Unlink(Entry * entry);
+
+    Slot * AllocateSlot();
+    void FreeSlot(Slot * slot);
+    void DeactivateEntry(Entry * entry);
+
+    Entry ** mBuckets          = nullptr;
+    uint32_t mBucketCount      = 0;
+    uint32_t mEntryCount       = 0;
+    uint32_t mActiveCount      = 0;
+    uint32_t mMaxActiveDevices = 0;
+
+    Entry * mLruHead  = nullptr;
+    Entry * mLruTail  = nullptr;
+    Slot * mFreeSlots = nullptr;
+};
+
+} // namespace Controller
+} // namespace chip
@@ -17,6 +17,7 @@
  */
 
 #include <controller/ExampleOperationalCredentialsIssuer.h>
+#include <core/CHIPTLV.h>
 #include <credentials/CHIPCert.h>
 #include <support/CHIPMem.h>
 #include <support/ScopedBuffer.h>
@@ -142,5 +143,203 @@ CHIP_ERROR ExampleOperationalCredentialsIssuer::GetRootCACertificate(FabricId fa
     return CHIP_NO_ERROR;
 }
 
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+struct ExampleOperationalCredentialsIssuer::NOCBatch
+{
+    // Set up on the event loop thread before the jobs are submitted, and then only read by the worker threads.
+    X509CertRequestParams mRequestParams;
+    X509IssuerEncoding mIssuer;
+    uint8_t mICAC[kMaxCHIPCertLength];
+    uint32_t mICACLen;
+
+    // Only accessed by the event loop thread.
+    NOCBatchRequest * mRequests;
+    size_t mCount;
+    size_t mSubmitted;
+    size_t mCompleted;
+    Callback::Callback<NOCBatchGenerated> * mOnGenerated;
+};
+
+class ExampleOperationalCredentialsIssuer::NOCIssuanceJob : public CryptoWorkerPool::Job
+{
+public:
+    NOCIssuanceJob(ExampleOperationalCredentialsIssuer & issuer, NOCBatchRequest & request) :
+        mIssuer(issuer), mBatch(*issuer.mBatch), mRequest(request)
+    {}
+
+    void Run() override { mRequest.mStatus = Issue(); }
+
+    void Complete() override { mIssuer.OnIssuanceJobCompleted(); }
+
+private:
+    CHIP_ERROR Issue()
+    {
+        X509CertRequestParams request = mBatch.mRequestParams;
+        request.NodeID                = mRequest.mNodeId.Value();
+
+        P256PublicKey pubkey;
+        ReturnErrorOnFailure(VerifyCertificateSigningRequest(mRequest.mCSR.data(), mRequest.mCSR.size(), pubkey));
+
+        uint32_t nocLen = 0;
+        {
+#if CHIP_EXAMPLE_ISSUER_SERIALIZE_SIGNING
+            std::lock_guard<std::mutex> lock(mIssuer.mIntermediateIssuerMutex);
+#endif
+            ReturnErrorOnFailure(NewNodeOperationalX509Cert(request, mBatch.mIssuer, pubkey, mIssuer.mIntermediateIssuer,
+                                                            mX509NOC, sizeof(mX509NOC), nocLen));
+        }
+        ReturnErrorOnFailure(ConvertX509CertToChipCert(ByteSpan(mX509NOC, nocLen), mNOC, sizeof(mNOC), nocLen));
+
+        // The ICAC was converted once for the batch: copy it after the NOC.
+        TLV::TLVWriter writer;
+        TLV::TLVType outerContainer;
+        size_t bufSize = mRequest.mChipCertArray.size();
+        writer.Init(mRequest.mChipCertArray.data(), (bufSize > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(bufSize));
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Array, outerContainer));
+        ReturnErrorOnFailure(CopyCert(ByteSpan(mNOC, nocLen), writer));
+        ReturnErrorOnFailure(CopyCert(ByteSpan(mBatch.mICAC, mBatch.mICACLen), writer));
+        ReturnErrorOnFailure(writer.EndContainer(outerContainer));
+        ReturnErrorOnFailure(writer.Finalize());
+
+        mRequest.mChipCertArray.reduce_size(writer.GetLengthWritten());
+        return CHIP_NO_ERROR;
+    }
+
+    static CHIP_ERROR CopyCert(const ByteSpan & chipCert, TLV::TLVWriter & writer)
+    {
+        TLV::TLVReader reader;
+        reader.Init(chipCert.data(), static_cast<uint32_t>(chipCert.size()));
+        ReturnErrorOnFailure(reader.Next());
+        return writer.CopyElement(TLV::AnonymousTag, reader);
+    }
+
+    ExampleOperationalCredentialsIssuer & mIssuer;
+    const NOCBatch & mBatch;
+    NOCBatchRequest & mRequest;
+    uint8_t mX509NOC[kMaxCHIPDERCertLength];
+    uint8_t mNOC[kMaxCHIPCertLength];
+};
+
+CHIP_ERROR ExampleOperationalCredentialsIssuer::InitBatchIssuance(System::Layer & systemLayer, unsigned threadCount)
+{
+    // Keep a few jobs queued for each thread, so that the workers do not wait for the event loop to submit more.
+    return mWorkerPool.Init(systemLayer, threadCount, 4 * threadCount);
+}
+
+void ExampleOperationalCredentialsIssuer::ShutdownBatchIssuance()
+{
+    mWorkerPool.Shutdown();
+}
+
+CHIP_ERROR ExampleOperationalCredentialsIssuer::GenerateNodeOperationalCertificates(
+    FabricId fabricId, NOCBatchRequest * requests, size_t count, Callback::Callback<NOCBatchGenerated> * onBatchGenerated)
+{
+    VerifyOrReturnError(mInitialized && mWorkerPool.IsRunning(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mBatch == nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(requests != nullptr && count > 0 && onBatchGenerated != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    NOCBatch * batch = chip::Platform::New<NOCBatch>();
+    VerifyOrReturnError(batch != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    CHIP_ERROR err        = CHIP_NO_ERROR;
+    batch->mRequestParams = { 1, mIntermediateIssuerId, mNow, mNow + mValidity, true, fabricId, true, 0 };
+    batch->mRequests      = requests;
+    batch->mCount         = count;
+    batch->mSubmitted     = 0;
+    batch->mCompleted     = 0;
+    batch->mOnGenerated   = onBatchGenerated;
+
+    // Encode what all the certificates of the batch have in common once.
+    SuccessOrExit(err = EncodeX509Issuer(batch->mRequestParams, CertificateIssuerLevel::kIssuerIsIntermediateCA,
+                                         mIntermediateIssuer.Pubkey(), batch->mIssuer));
+    {
+        chip::Platform::ScopedMemoryBuffer<uint8_t> icac;
+        VerifyOrExit(icac.Alloc(kMaxCHIPDERCertLength), err = CHIP_ERROR_NO_MEMORY);
+        MutableByteSpan icacSpan(icac.Get(), kMaxCHIPDERCertLength);
+        SuccessOrExit(err = GetIntermediateCACertificate(fabricId, icacSpan));
+        SuccessOrExit(err = ConvertX509CertToChipCert(icacSpan, batch->mICAC, sizeof(batch->mICAC), batch->mICACLen));
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        requests[i].mStatus = CHIP_ERROR_INTERNAL;
+    }
+
+    mBatch = batch;
+    err    = SubmitIssuanceJobs();
+    if (batch->mSubmitted == 0)
+    {
+        mBatch = nullptr;
+        ExitNow();
+    }
+
+    // Some of the jobs are in flight: the batch is completed with the status of each request.
+    return CHIP_NO_ERROR;
+
+exit:
+    chip::Platform::Delete(batch);
+    return err;
+}
+
+CHIP_ERROR ExampleOperationalCredentialsIssuer::SubmitIssuanceJobs()
+{
+    while (mBatch->mSubmitted < mBatch->mCount && !mWorkerPool.IsFull())
+    {
+        NOCBatchRequest & request = mBatch->mRequests[mBatch->mSubmitted];
+        NOCIssuanceJob * job      = chip::Platform::New<NOCIssuanceJob>(*this, request);
+        VerifyOrReturnError(job != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        // The worker reads the node ID, so it is set before the job is submitted, but only consumed once it is.
+        const bool assignNodeId = !request.mNodeId.HasValue();
+        if (assignNodeId)
+        {
+            request.mNodeId.SetValue(mNextAvailableNodeId);
+        }
+
+        CHIP_ERROR err = mWorkerPool.Submit(job);
+        if (err != CHIP_NO_ERROR)
+        {
+            if (assignNodeId)
+            {
+                request.mNodeId.ClearValue();
+            }
+            chip::Platform::Delete(job);
+            return err;
+        }
+        if (assignNodeId)
+        {
+            mNextAvailableNodeId++;
+        }
+        mBatch->mSubmitted++;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void ExampleOperationalCredentialsIssuer::OnIssuanceJobCompleted()
+{
+    mBatch->mCompleted++;
+
+    CHIP_ERROR err = SubmitIssuanceJobs();
+    if (err != CHIP_NO_ERROR)
+    {
+        // Fail the requests that could not be submitted, rather than leaving the batch hanging.
+        for (; mBatch->mSubmitted < mBatch->mCount; mBatch->mSubmitted++, mBatch->mCompleted++)
+        {
+            mBatch->mRequests[mBatch->mSubmitted].mStatus = err;
+        }
+    }
+
+    VerifyOrReturn(mBatch->mCompleted == mBatch->mCount);
+
+    NOCBatch * batch = mBatch;
+    mBatch           = nullptr;
+    batch->mOnGenerated->mCall(batch->mOnGenerated->mContext, batch->mRequests, batch->mCount);
+    chip::Platform::Delete(batch);
+}
+
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
 } // namespace Controller
 } // namespace chip
@@ -34,14 +34,41 @@
 #include <core/CHIPPersistentStorageDelegate.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <support/CodeUtils.h>
+#include <transport/CryptoWorkerPool.h>
+
+/**
+ * Whether the worker threads of a batch issuance take turns to sign with the intermediate issuer key. Signing is
+ * thread-safe with the OpenSSL crypto PAL, but not with the other ones (e.g. mbedTLS shares its DRBG) nor with an HSM.
+ */
+#define CHIP_EXAMPLE_ISSUER_SERIALIZE_SIGNING (CHIP_CRYPTO_WORKER_POOL_SUPPORTED && !(CHIP_CRYPTO_OPENSSL && !CHIP_CRYPTO_HSM))
+
+#if CHIP_EXAMPLE_ISSUER_SERIALIZE_SIGNING
+#include <mutex>
+#endif
 
 namespace chip {
 namespace Controller {
 
+/// A node operational certificate request of a batch, see GenerateNodeOperationalCertificates()
+struct NOCBatchRequest
+{
+    Optional<NodeId> mNodeId;       ///< The node ID to assign, if any. Set to the assigned node ID once submitted.
+    ByteSpan mCSR;                  ///< The certificate signing request from the node in DER format.
+    MutableByteSpan mChipCertArray; ///< The buffer for the certificates. Set to the NOC and ICAC as a CHIP certificate array.
+    CHIP_ERROR mStatus;             ///< Set to the result of the issuance of the certificate.
+};
+
+typedef void (*NOCBatchGenerated)(void * context, NOCBatchRequest * requests, size_t count);
+
 class DLL_EXPORT ExampleOperationalCredentialsIssuer : public OperationalCredentialsDelegate
 {
 public:
-    virtual ~ExampleOperationalCredentialsIssuer() {}
+    virtual ~ExampleOperationalCredentialsIssuer()
+    {
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+        ShutdownBatchIssuance();
+#endif
+    }
 
     CHIP_ERROR GenerateNodeOperationalCertificate(const Optional<NodeId> & nodeId, FabricId fabricId, const ByteSpan & csr,
                                                   const ByteSpan & DAC, Callback::Callback<NOCGenerated> * onNOCGenerated) override;
@@ -69,6 +96,48 @@ public:
 
     void SetCertificateValidityPeriod(uint32_t validity) { mValidity = validity; }
 
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+    /**
+     * @brief Start the worker threads that issue the certificates of batches.
+     *
+     *        The certificates are generated concurrently, but signed with the intermediate CA key one at a time,
+     *        since not every crypto PAL supports the concurrent use of a keypair.
+     *
+     * @param[in] systemLayer  The system layer of the event loop on which the batches are completed.
+     * @param[in] threadCount  The number of worker threads.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR InitBatchIssuance(System::Layer & systemLayer, unsigned threadCount);
+
+    /**
+     * @brief Complete the batch in progress, if any, and stop the worker threads.
+     **/
+    void ShutdownBatchIssuance();
+
+    /**
+     * @brief Issue the node operational certificates of a batch of nodes on the worker threads.
+     *
+     *        The issuer DN and intermediate CA certificate are encoded once for the batch when this is called. Each
+     *        request is assigned a node ID, if it has none, when it is submitted to a worker thread, where its
+     *        certificate is generated, signed, and converted to a CHIP certificate array. Requests that cannot be
+     *        submitted fail without consuming a node ID. `onBatchGenerated` is called on the event loop thread once all
+     *        of them are done, with the status of each request. The requests, their CSRs and buffers must remain valid
+     *        until then.
+     *
+     *        Only one batch may be in progress at a time.
+     *
+     * @param[in] fabricId          Fabric ID for which the certificates are being requested.
+     * @param[in] requests          The requests of the nodes.
+     * @param[in] count             The number of requests.
+     * @param[in] onBatchGenerated  Callback handler called when all the certificates of the batch are issued.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise. On error, the callback is not called.
+     **/
+    CHIP_ERROR GenerateNodeOperationalCertificates(FabricId fabricId, NOCBatchRequest * requests, size_t count,
+                                                   Callback::Callback<NOCBatchGenerated> * onBatchGenerated);
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
 private:
     Crypto::P256Keypair mIssuer;
     Crypto::P256Keypair mIntermediateIssuer;
@@ -81,6 +150,22 @@ private:
     uint32_t mValidity = 365 * 24 * 60 * 60 * 10;
 
     NodeId mNextAvailableNodeId = 1;
+
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+    struct NOCBatch;
+    class NOCIssuanceJob;
+
+    CHIP_ERROR SubmitIssuanceJobs();
+    void OnIssuanceJobCompleted();
+
+    CryptoWorkerPool mWorkerPool;
+    NOCBatch * mBatch = nullptr;
+
+#if CHIP_EXAMPLE_ISSUER_SERIALIZE_SIGNING
+    // Serializes the signatures of the worker threads with mIntermediateIssuer.
+    std::mutex mIntermediateIssuerMutex;
+#endif
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
 };
 
 } // namespace Controller
@@ -27,6 +27,7 @@
 
 from __future__ import absolute_import
 from __future__ import print_function
+import asyncio
 import time
 from threading import Thread
 from ctypes import *
@@ -324,6 +325,38 @@ class ChipDeviceController(object):
             # We only send 1 command by this function, so index is always 0
             return im.WaitCommandIndexStatus(commandSenderHandle, 1)
 
+    def _GetDevice(self, nodeid):
+        device = c_void_p(None)
+        res = self._ChipStack.Call(lambda: self._dmLib.pychip_GetDeviceByNodeId(
+            self.devCtrl, nodeid, pointer(device)))
+        if res != 0:
+            raise self._ChipStack.ErrorToException(res)
+        return device
+
+    async def ZCLSendAsync(self, cluster, command, nodeid, endpoint, groupid, args):
+        """Send a cluster command, returning once the device responded. Unlike ZCLSend, any
+        number of commands, to any number of nodes, can be awaited at once.
+        Raises ClusterStatusError when the device reports a failure."""
+        future = self._Cluster.SendCommandFuture(
+            self._GetDevice(nodeid), cluster, command, endpoint, groupid, args)
+        return await asyncio.wrap_future(future)
+
+    async def ZCLReadAttributeAsync(self, cluster, attribute, nodeid, endpoint, groupid):
+        """Read an attribute, returning its AttributeReadResult. Unlike ZCLReadAttribute, any
+        number of reads, of any number of nodes, can be awaited at once."""
+        # The report of the read is handed over to the IM delegate under the context ID of its
+        # request, right before the read completes.
+        future = self._Cluster.ReadAttributeFuture(
+            self._GetDevice(nodeid), cluster, attribute, endpoint, groupid,
+            lambda contextId: im.TakeAttributeReadResponse(contextId))
+        return await asyncio.wrap_future(future)
+
+    async def ZCLWriteAttributeAsync(self, cluster, attribute, nodeid, endpoint, groupid, value):
+        """Write an attribute, returning once the device responded."""
+        future = self._Cluster.WriteAttributeFuture(
+            self._GetDevice(nodeid), cluster, attribute, endpoint, groupid, value)
+        return await asyncio.wrap_future(future)
+
     def ZCLCommandList(self):
         return self._Cluster.ListClusterCommands()
 
@@ -26,6 +26,8 @@
 
 from __future__ import absolute_import
 from __future__ import print_function
+import asyncio
+import concurrent.futures
 import sys
 import os
 import time
@@ -124,6 +126,11 @@ class ChipLogFormatter(logging.Formatter):
 _CompleteFunct = CFUNCTYPE(None, c_void_p, c_void_p)
 _ErrorFunct = CFUNCTYPE(None, c_void_p, c_void_p, c_ulong, POINTER(DeviceStatusStruct))
 _LogMessageFunct = CFUNCTYPE(None, c_int64, c_int64, c_char_p, c_uint8, c_char_p)
+_RequestCompleteFunct = CFUNCTYPE(None, c_uint64, c_uint32, c_uint8)
+_IssueRequestFunct = CFUNCTYPE(c_uint32)
+
+# Time given to a request issued by CallWithFuture to receive its response.
+DEFAULT_REQUEST_TIMEOUT_MS = 30000
 
 
 @_singleton
@@ -135,6 +142,11 @@ class ChipStack(object):
         self._chipDLLPath = None
         self.devMgr = None
         self.callbackRes = None
+        self.requestLock = Lock()
+        self.pendingRequests = {}
+        # Reports of reads which are not issued by CallWithFuture are keyed by an 8 bit sequence number:
+        # the context IDs of requests start above it.
+        self.nextContextId = 256
         self._activeLogFunct = None
         self.addModulePrefixToLogMessage = True
 
@@ -193,8 +205,31 @@ class ChipStack(object):
             self.callbackRes = self.ErrorToException(err, devStatusPtr)
             self.completeEvent.set()
 
+        def HandleRequestComplete(contextId, err, status):
+            with self.requestLock:
+                request = self.pendingRequests.pop(contextId, None)
+            if request is None:
+                return
+            future, resultFunct = request
+            # Always collect what the response left for the request, so that it is not kept around.
+            try:
+                result = resultFunct(contextId) if resultFunct else None
+            except Exception as ex:
+                result = ex
+            if not future.set_running_or_notify_cancel():
+                return
+            if err != 0:
+                future.set_exception(self.ErrorToException(err))
+            elif status != 0:
+                future.set_exception(ClusterStatusError(status))
+            elif isinstance(result, Exception):
+                future.set_exception(result)
+            else:
+                future.set_result(result)
+
         self.cbHandleComplete = _CompleteFunct(HandleComplete)
         self.cbHandleError = _ErrorFunct(HandleError)
+        self.cbHandleRequestComplete = _RequestCompleteFunct(HandleRequestComplete)
         self.blockingCB = None  # set by other modules(BLE) that require service by thread while thread blocks.
 
         # Initialize the chip library
@@ -206,6 +241,9 @@ class ChipStack(object):
         if res != 0:
             raise self.ErrorToException(res)
 
+        self._ChipStackLib.pychip_InteractionModelDelegate_SetOnRequestCompleteCallback(
+            self.cbHandleRequestComplete)
+
     @property
     def defaultLogFunct(self):
         """Returns a python callable which, when called, logs a message to the python logger object
@@ -287,6 +325,52 @@ class ChipStack(object):
             raise self.callbackRes
         return self.callbackRes
 
+    def CallWithFuture(self, callFunct, resultFunct=None, timeoutMs=DEFAULT_REQUEST_TIMEOUT_MS):
+        """Issue a cluster command or attribute request without waiting for its response.
+        callFunct issues the request through the cluster bindings, which register per-request
+        callbacks for it, so that any number of requests can be in flight at once. It is called
+        on the CHIP thread, like the responses are dispatched.
+        Returns a concurrent.futures.Future, resolved on the CHIP thread once the response is
+        received: with the value returned by resultFunct (called with the context ID of the
+        request on the CHIP thread) or None, or with a ClusterStatusError when the device reports
+        a failure. When no response is received within timeoutMs, the future fails with a
+        ChipStackError. Cancelling the future releases the request."""
+        future = concurrent.futures.Future()
+        with self.requestLock:
+            contextId = self.nextContextId
+            self.nextContextId += 1
+            self.pendingRequests[contextId] = (future, resultFunct)
+
+        failures = []
+
+        def IssueRequest():
+            try:
+                return callFunct()
+            except BaseException as ex:
+                # The request was not sent, the exception is raised once the stack dropped it.
+                failures.append(ex)
+                return self._ChipStackLib.pychip_InteractionModel_GetInternalError()
+
+        with self.networkLock:
+            res = self._ChipStackLib.pychip_InteractionModel_IssueRequest(
+                contextId, timeoutMs, _IssueRequestFunct(IssueRequest))
+        if res != 0:
+            with self.requestLock:
+                self.pendingRequests.pop(contextId, None)
+            if failures:
+                raise failures[0]
+            future.set_exception(self.ErrorToException(res))
+            return future
+
+        # The stack completes a cancelled request too, which then drops the future.
+        future.add_done_callback(
+            lambda f: self._ChipStackLib.pychip_InteractionModel_CancelRequest(contextId) if f.cancelled() else None)
+        return future
+
+    async def CallAsyncio(self, callFunct, resultFunct=None, timeoutMs=DEFAULT_REQUEST_TIMEOUT_MS):
+        """Same as CallWithFuture, awaiting the response from an asyncio event loop."""
+        return await asyncio.wrap_future(self.CallWithFuture(callFunct, resultFunct, timeoutMs))
+
     def ErrorToException(self, err, devStatusPtr=None):
         if err == 4044 and devStatusPtr:
             devStatus = devStatusPtr.contents
@@ -379,3 +463,14 @@ class ChipStack(object):
 
             self._ChipStackLib.pychip_BLEMgrImpl_ConfigureBle.argtypes = [c_uint32]
             self._ChipStackLib.pychip_BLEMgrImpl_ConfigureBle.restype = c_uint32
+
+            self._ChipStackLib.pychip_InteractionModelDelegate_SetOnRequestCompleteCallback.argtypes = [
+                _RequestCompleteFunct]
+            self._ChipStackLib.pychip_InteractionModelDelegate_SetOnRequestCompleteCallback.restype = None
+            self._ChipStackLib.pychip_InteractionModel_IssueRequest.argtypes = [
+                c_uint64, c_uint32, _IssueRequestFunct]
+            self._ChipStackLib.pychip_InteractionModel_IssueRequest.restype = c_uint32
+            self._ChipStackLib.pychip_InteractionModel_CancelRequest.argtypes = [c_uint64]
+            self._ChipStackLib.pychip_InteractionModel_CancelRequest.restype = None
+            self._ChipStackLib.pychip_InteractionModel_GetInternalError.argtypes = []
+            self._ChipStackLib.pychip_InteractionModel_GetInternalError.restype = c_uint32
@@ -24,12 +24,14 @@
 #include <lib/support/Span.h>
 
 #include <controller/CHIPDevice.h>
+#include <controller/python/chip/interaction_model/Delegate.h>
 
 #include "gen/CHIPClientCallbacks.h"
 #include "gen/CHIPClusters.h"
 
 using namespace chip;
 using namespace chip::app;
+using chip::Controller::PythonRequest;
 
 namespace {
 
@@ -42,29 +44,35 @@ FailureResponseDelegate gFailureResponseDelegate;
 
 // Define callbacks for ZCL commands and attribute requests.
 
-void OnDefaultSuccessResponse(void * /* context */)
+void OnDefaultSuccessResponse(void * context)
 {
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
 
-void OnDefaultFailureResponse(void * /* context */, uint8_t status)
+void OnDefaultFailureResponse(void * context, uint8_t status)
 {
+    if (PythonRequest::Complete(context, status))
+        return;
     if (gFailureResponseDelegate != nullptr)
         gFailureResponseDelegate(status);
 }
 
 template <class AttributeType>
-void OnAttributeResponse(void * /* context */, AttributeType value)
+void OnAttributeResponse(void * context, AttributeType value)
 {
     std::string strValue = std::to_string(value);
     ChipLogProgress(Zcl, "  attributeValue: %s", strValue.c_str());
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
 
 template <>
-void OnAttributeResponse<chip::ByteSpan>(void * /* context */, chip::ByteSpan value)
+void OnAttributeResponse<chip::ByteSpan>(void * context, chip::ByteSpan value)
 {
     std::string strValue = "";
     for (size_t i = 0; i < value.size(); i++)
@@ -73,14 +81,18 @@ void OnAttributeResponse<chip::ByteSpan>(void * /* context */, chip::ByteSpan va
         strValue += std::to_string(value.data()[i]);
     }
     ChipLogProgress(Zcl, "  attributeValue: (span of length %zd) %s", value.size(), strValue.c_str());
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
 
 template <>
-void OnAttributeResponse<bool>(void * /* context */, bool value)
+void OnAttributeResponse<bool>(void * context, bool value)
 {
     ChipLogProgress(Zcl, "  attributeValue: %s", value ? "true" : "false");
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -88,6 +100,8 @@ void OnAttributeResponse<bool>(void * /* context */, bool value)
 static void OnApplicationLauncherApplicationLauncherListListAttributeResponse(void * context, uint16_t count, uint16_t * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -98,6 +112,8 @@ chip::Callback::Callback<ApplicationLauncherApplicationLauncherListListAttribute
 static void OnAudioOutputAudioOutputListListAttributeResponse(void * context, uint16_t count, _AudioOutputInfo * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -107,6 +123,8 @@ chip::Callback::Callback<AudioOutputAudioOutputListListAttributeCallback> gAudio
 static void OnContentLauncherAcceptsHeaderListListAttributeResponse(void * context, uint16_t count, chip::ByteSpan * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -115,6 +133,8 @@ chip::Callback::Callback<ContentLauncherAcceptsHeaderListListAttributeCallback>
 static void OnContentLauncherSupportedStreamingTypesListAttributeResponse(void * context, uint16_t count, uint8_t * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -124,6 +144,8 @@ chip::Callback::Callback<ContentLauncherSupportedStreamingTypesListAttributeCall
 static void OnDescriptorDeviceListListAttributeResponse(void * context, uint16_t count, _DeviceType * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -133,6 +155,8 @@ chip::Callback::Callback<DescriptorDeviceListListAttributeCallback> gDescriptorD
 static void OnDescriptorServerListListAttributeResponse(void * context, uint16_t count, chip::ClusterId * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -142,6 +166,8 @@ chip::Callback::Callback<DescriptorServerListListAttributeCallback> gDescriptorS
 static void OnDescriptorClientListListAttributeResponse(void * context, uint16_t count, chip::ClusterId * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -151,6 +177,8 @@ chip::Callback::Callback<DescriptorClientListListAttributeCallback> gDescriptorC
 static void OnDescriptorPartsListListAttributeResponse(void * context, uint16_t count, chip::EndpointId * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -160,6 +188,8 @@ chip::Callback::Callback<DescriptorPartsListListAttributeCallback> gDescriptorPa
 static void OnFixedLabelLabelListListAttributeResponse(void * context, uint16_t count, _LabelStruct * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -170,6 +200,8 @@ static void OnGeneralDiagnosticsNetworkInterfacesListAttributeResponse(void * co
                                                                        _NetworkInterfaceType * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -179,6 +211,8 @@ chip::Callback::Callback<GeneralDiagnosticsNetworkInterfacesListAttributeCallbac
 static void OnGroupKeyManagementGroupsListAttributeResponse(void * context, uint16_t count, _GroupState * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -188,6 +222,8 @@ chip::Callback::Callback<GroupKeyManagementGroupsListAttributeCallback> gGroupKe
 static void OnGroupKeyManagementGroupKeysListAttributeResponse(void * context, uint16_t count, _GroupKey * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -197,6 +233,8 @@ chip::Callback::Callback<GroupKeyManagementGroupKeysListAttributeCallback> gGrou
 static void OnMediaInputMediaInputListListAttributeResponse(void * context, uint16_t count, _MediaInputInfo * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -206,6 +244,8 @@ chip::Callback::Callback<MediaInputMediaInputListListAttributeCallback> gMediaIn
 static void OnOperationalCredentialsFabricsListListAttributeResponse(void * context, uint16_t count, _FabricDescriptor * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -214,6 +254,8 @@ chip::Callback::Callback<OperationalCredentialsFabricsListListAttributeCallback>
 static void OnTvChannelTvChannelListListAttributeResponse(void * context, uint16_t count, _TvChannelInfo * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -224,6 +266,8 @@ static void OnTargetNavigatorTargetNavigatorListListAttributeResponse(void * con
                                                                       _NavigateTargetTargetInfo * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -232,6 +276,8 @@ chip::Callback::Callback<TargetNavigatorTargetNavigatorListListAttributeCallback
 static void OnTestClusterListInt8uListAttributeResponse(void * context, uint16_t count, uint8_t * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -241,6 +287,8 @@ chip::Callback::Callback<TestClusterListInt8uListAttributeCallback> gTestCluster
 static void OnTestClusterListOctetStringListAttributeResponse(void * context, uint16_t count, chip::ByteSpan * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -250,6 +298,8 @@ chip::Callback::Callback<TestClusterListOctetStringListAttributeCallback> gTestC
 static void OnTestClusterListStructOctetStringListAttributeResponse(void * context, uint16_t count, _TestListStructOctet * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -259,6 +309,8 @@ static void OnThreadNetworkDiagnosticsNeighborTableListListAttributeResponse(voi
                                                                              _NeighborTable * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -269,6 +321,8 @@ chip::Callback::Callback<ThreadNetworkDiagnosticsNeighborTableListListAttributeC
 static void OnThreadNetworkDiagnosticsRouteTableListListAttributeResponse(void * context, uint16_t count, _RouteTable * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -278,6 +332,8 @@ chip::Callback::Callback<ThreadNetworkDiagnosticsRouteTableListListAttributeCall
 static void OnThreadNetworkDiagnosticsSecurityPolicyListAttributeResponse(void * context, uint16_t count, _SecurityPolicy * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -288,6 +344,8 @@ static void OnThreadNetworkDiagnosticsOperationalDatasetComponentsListAttributeR
                                                                                         _OperationalDatasetComponents * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -299,6 +357,8 @@ static void OnThreadNetworkDiagnosticsActiveNetworkFaultsListListAttributeRespon
                                                                                    uint8_t * entries)
 {
     ChipLogProgress(Zcl, "  attributeValue: List of length %" PRIu16, count);
+    if (PythonRequest::Complete(context, EMBER_ZCL_STATUS_SUCCESS))
+        return;
     if (gSuccessResponseDelegate != nullptr)
         gSuccessResponseDelegate();
 }
@@ -343,7 +403,9 @@ CHIP_ERROR chip_ime_AppendCommand_AccountLogin_GetSetupPIN(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::AccountLoginCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetSetupPIN(nullptr, nullptr, chip::ByteSpan(tempAccountIdentifier, tempAccountIdentifier_Len));
+    return cluster.GetSetupPIN(PythonRequest::BindResponse<AccountLoginClusterGetSetupPINResponseCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback),
+                               chip::ByteSpan(tempAccountIdentifier, tempAccountIdentifier_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_AccountLogin_Login(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId, const uint8_t * tempAccountIdentifier,
@@ -353,8 +415,9 @@ CHIP_ERROR chip_ime_AppendCommand_AccountLogin_Login(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::AccountLoginCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.Login(nullptr, nullptr, chip::ByteSpan(tempAccountIdentifier, tempAccountIdentifier_Len),
-                         chip::ByteSpan(setupPIN, setupPIN_Len));
+    return cluster.Login(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                         PythonRequest::BindIfPending(gDefaultFailureCallback),
+                         chip::ByteSpan(tempAccountIdentifier, tempAccountIdentifier_Len), chip::ByteSpan(setupPIN, setupPIN_Len));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_AccountLogin_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -363,7 +426,8 @@ CHIP_ERROR chip_ime_ReadAttribute_AccountLogin_ClusterRevision(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::AccountLoginCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster AccountLogin
@@ -375,7 +439,8 @@ CHIP_ERROR chip_ime_AppendCommand_ApplicationBasic_ChangeStatus(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ChangeStatus(nullptr, nullptr, status);
+    return cluster.ChangeStatus(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                PythonRequest::BindIfPending(gDefaultFailureCallback), status);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_VendorName(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -384,7 +449,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_VendorName(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeVendorName(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeVendorName(PythonRequest::Bind(gStringAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_VendorId(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -393,7 +459,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_VendorId(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeVendorId(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeVendorId(PythonRequest::Bind(gInt16uAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_ApplicationName(chip::Controller::Device * device,
@@ -402,7 +469,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_ApplicationName(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeApplicationName(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeApplicationName(PythonRequest::Bind(gStringAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_ProductId(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -411,7 +479,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_ProductId(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeProductId(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeProductId(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_ApplicationId(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -420,7 +489,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_ApplicationId(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeApplicationId(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeApplicationId(PythonRequest::Bind(gStringAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_CatalogVendorId(chip::Controller::Device * device,
@@ -429,7 +499,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_CatalogVendorId(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCatalogVendorId(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCatalogVendorId(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_ApplicationStatus(chip::Controller::Device * device,
@@ -438,7 +509,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_ApplicationStatus(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeApplicationStatus(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeApplicationStatus(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_ClusterRevision(chip::Controller::Device * device,
@@ -447,7 +519,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationBasic_ClusterRevision(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster ApplicationBasic
@@ -461,7 +534,8 @@ CHIP_ERROR chip_ime_AppendCommand_ApplicationLauncher_LaunchApp(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationLauncherCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.LaunchApp(nullptr, nullptr, chip::ByteSpan(data, data_Len), catalogVendorId,
+    return cluster.LaunchApp(PythonRequest::BindResponse<ApplicationLauncherClusterLaunchAppResponseCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(data, data_Len), catalogVendorId,
                              chip::ByteSpan(applicationId, applicationId_Len));
 }
 
@@ -472,8 +546,9 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationLauncher_ApplicationLauncherList(ch
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationLauncherCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeApplicationLauncherList(gApplicationLauncherApplicationLauncherListListAttributeCallback.Cancel(),
-                                                        gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeApplicationLauncherList(
+            PythonRequest::Bind(gApplicationLauncherApplicationLauncherListListAttributeCallback),
+            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ApplicationLauncher_CatalogVendorId(chip::Controller::Device * device,
@@ -483,7 +558,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationLauncher_CatalogVendorId(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationLauncherCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCatalogVendorId(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCatalogVendorId(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ApplicationLauncher_ApplicationId(chip::Controller::Device * device,
@@ -492,7 +568,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationLauncher_ApplicationId(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationLauncherCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeApplicationId(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeApplicationId(PythonRequest::Bind(gInt8uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ApplicationLauncher_ClusterRevision(chip::Controller::Device * device,
@@ -502,7 +579,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ApplicationLauncher_ClusterRevision(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ApplicationLauncherCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster ApplicationLauncher
@@ -514,7 +592,8 @@ CHIP_ERROR chip_ime_AppendCommand_AudioOutput_RenameOutput(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::AudioOutputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RenameOutput(nullptr, nullptr, index, chip::ByteSpan(name, name_Len));
+    return cluster.RenameOutput(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                PythonRequest::BindIfPending(gDefaultFailureCallback), index, chip::ByteSpan(name, name_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_AudioOutput_SelectOutput(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                            chip::GroupId, uint8_t index)
@@ -522,7 +601,8 @@ CHIP_ERROR chip_ime_AppendCommand_AudioOutput_SelectOutput(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::AudioOutputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SelectOutput(nullptr, nullptr, index);
+    return cluster.SelectOutput(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                PythonRequest::BindIfPending(gDefaultFailureCallback), index);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_AudioOutput_AudioOutputList(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -531,8 +611,8 @@ CHIP_ERROR chip_ime_ReadAttribute_AudioOutput_AudioOutputList(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::AudioOutputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeAudioOutputList(gAudioOutputAudioOutputListListAttributeCallback.Cancel(),
-                                                gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeAudioOutputList(PythonRequest::Bind(gAudioOutputAudioOutputListListAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_AudioOutput_CurrentAudioOutput(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -541,7 +621,8 @@ CHIP_ERROR chip_ime_ReadAttribute_AudioOutput_CurrentAudioOutput(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::AudioOutputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentAudioOutput(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentAudioOutput(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                   PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_AudioOutput_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -550,7 +631,8 @@ CHIP_ERROR chip_ime_ReadAttribute_AudioOutput_ClusterRevision(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::AudioOutputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster AudioOutput
@@ -563,7 +645,8 @@ CHIP_ERROR chip_ime_AppendCommand_BarrierControl_BarrierControlGoToPercent(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BarrierControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.BarrierControlGoToPercent(nullptr, nullptr, percentOpen);
+    return cluster.BarrierControlGoToPercent(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                             PythonRequest::BindIfPending(gDefaultFailureCallback), percentOpen);
 }
 CHIP_ERROR chip_ime_AppendCommand_BarrierControl_BarrierControlStop(chip::Controller::Device * device,
                                                                     chip::EndpointId ZCLendpointId, chip::GroupId)
@@ -571,7 +654,8 @@ CHIP_ERROR chip_ime_AppendCommand_BarrierControl_BarrierControlStop(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BarrierControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.BarrierControlStop(nullptr, nullptr);
+    return cluster.BarrierControlStop(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BarrierControl_BarrierMovingState(chip::Controller::Device * device,
@@ -580,7 +664,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BarrierControl_BarrierMovingState(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BarrierControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBarrierMovingState(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBarrierMovingState(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                   PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BarrierControl_BarrierSafetyStatus(chip::Controller::Device * device,
@@ -589,7 +674,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BarrierControl_BarrierSafetyStatus(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BarrierControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBarrierSafetyStatus(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBarrierSafetyStatus(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                    PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BarrierControl_BarrierCapabilities(chip::Controller::Device * device,
@@ -598,7 +684,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BarrierControl_BarrierCapabilities(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BarrierControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBarrierCapabilities(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBarrierCapabilities(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                    PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BarrierControl_BarrierPosition(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -607,7 +694,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BarrierControl_BarrierPosition(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BarrierControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBarrierPosition(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBarrierPosition(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BarrierControl_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -616,7 +704,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BarrierControl_ClusterRevision(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BarrierControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster BarrierControl
@@ -628,7 +717,8 @@ CHIP_ERROR chip_ime_AppendCommand_Basic_MfgSpecificPing(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MfgSpecificPing(nullptr, nullptr);
+    return cluster.MfgSpecificPing(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                   PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_InteractionModelVersion(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -637,7 +727,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_InteractionModelVersion(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInteractionModelVersion(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInteractionModelVersion(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                        PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_VendorName(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -646,7 +737,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_VendorName(chip::Controller::Device * de
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeVendorName(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeVendorName(PythonRequest::Bind(gStringAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_VendorID(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -655,7 +747,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_VendorID(chip::Controller::Device * devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeVendorID(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeVendorID(PythonRequest::Bind(gInt16uAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_ProductName(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -664,7 +757,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_ProductName(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeProductName(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeProductName(PythonRequest::Bind(gStringAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_ProductID(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -673,7 +767,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_ProductID(chip::Controller::Device * dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeProductID(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeProductID(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_UserLabel(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -682,7 +777,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_UserLabel(chip::Controller::Device * dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeUserLabel(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeUserLabel(PythonRequest::Bind(gStringAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_Basic_UserLabel(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -691,8 +787,8 @@ CHIP_ERROR chip_ime_WriteAttribute_Basic_UserLabel(chip::Controller::Device * de
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeUserLabel(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                           chip::ByteSpan(value, len));
+    return cluster.WriteAttributeUserLabel(PythonRequest::Bind(gDefaultSuccessCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback), chip::ByteSpan(value, len));
 }
 CHIP_ERROR chip_ime_ReadAttribute_Basic_Location(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                  chip::GroupId /* ZCLgroupId */)
@@ -700,7 +796,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_Location(chip::Controller::Device * devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeLocation(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeLocation(PythonRequest::Bind(gStringAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_Basic_Location(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -709,8 +806,8 @@ CHIP_ERROR chip_ime_WriteAttribute_Basic_Location(chip::Controller::Device * dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeLocation(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                          chip::ByteSpan(value, len));
+    return cluster.WriteAttributeLocation(PythonRequest::Bind(gDefaultSuccessCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback), chip::ByteSpan(value, len));
 }
 CHIP_ERROR chip_ime_ReadAttribute_Basic_HardwareVersion(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                         chip::GroupId /* ZCLgroupId */)
@@ -718,7 +815,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_HardwareVersion(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeHardwareVersion(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeHardwareVersion(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_HardwareVersionString(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -727,7 +825,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_HardwareVersionString(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeHardwareVersionString(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeHardwareVersionString(PythonRequest::Bind(gStringAttributeCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_SoftwareVersion(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -736,7 +835,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_SoftwareVersion(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSoftwareVersion(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSoftwareVersion(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_SoftwareVersionString(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -745,7 +845,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_SoftwareVersionString(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSoftwareVersionString(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSoftwareVersionString(PythonRequest::Bind(gStringAttributeCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_ManufacturingDate(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -754,7 +855,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_ManufacturingDate(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeManufacturingDate(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeManufacturingDate(PythonRequest::Bind(gStringAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_PartNumber(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -763,7 +865,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_PartNumber(chip::Controller::Device * de
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePartNumber(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePartNumber(PythonRequest::Bind(gStringAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_ProductURL(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -772,7 +875,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_ProductURL(chip::Controller::Device * de
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeProductURL(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeProductURL(PythonRequest::Bind(gStringAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_ProductLabel(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -781,7 +885,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_ProductLabel(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeProductLabel(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeProductLabel(PythonRequest::Bind(gStringAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_SerialNumber(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -790,7 +895,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_SerialNumber(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSerialNumber(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSerialNumber(PythonRequest::Bind(gStringAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_LocalConfigDisabled(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -799,7 +905,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_LocalConfigDisabled(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeLocalConfigDisabled(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeLocalConfigDisabled(PythonRequest::Bind(gBooleanAttributeCallback),
+                                                    PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_Basic_LocalConfigDisabled(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -808,7 +915,8 @@ CHIP_ERROR chip_ime_WriteAttribute_Basic_LocalConfigDisabled(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeLocalConfigDisabled(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeLocalConfigDisabled(PythonRequest::Bind(gDefaultSuccessCallback),
+                                                     PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_Basic_Reachable(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                   chip::GroupId /* ZCLgroupId */)
@@ -816,7 +924,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_Reachable(chip::Controller::Device * dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeReachable(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeReachable(PythonRequest::Bind(gBooleanAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Basic_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -825,7 +934,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Basic_ClusterRevision(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster Basic
@@ -837,7 +947,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BinaryInputBasic_OutOfService(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BinaryInputBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOutOfService(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOutOfService(PythonRequest::Bind(gBooleanAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_BinaryInputBasic_OutOfService(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -846,7 +957,8 @@ CHIP_ERROR chip_ime_WriteAttribute_BinaryInputBasic_OutOfService(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BinaryInputBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeOutOfService(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeOutOfService(PythonRequest::Bind(gDefaultSuccessCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_BinaryInputBasic_PresentValue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                 chip::GroupId /* ZCLgroupId */)
@@ -854,7 +966,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BinaryInputBasic_PresentValue(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BinaryInputBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePresentValue(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePresentValue(PythonRequest::Bind(gBooleanAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_BinaryInputBasic_PresentValue(chip::Controller::Device * device,
@@ -864,8 +977,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_BinaryInputBasic_PresentValue(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BinaryInputBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributePresentValue(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                                  maxInterval);
+    return cluster.ConfigureAttributePresentValue(PythonRequest::Bind(gBooleanAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval);
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_BinaryInputBasic_PresentValue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -874,7 +987,8 @@ CHIP_ERROR chip_ime_WriteAttribute_BinaryInputBasic_PresentValue(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BinaryInputBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributePresentValue(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributePresentValue(PythonRequest::Bind(gDefaultSuccessCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_BinaryInputBasic_StatusFlags(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                chip::GroupId /* ZCLgroupId */)
@@ -882,7 +996,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BinaryInputBasic_StatusFlags(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BinaryInputBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeStatusFlags(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeStatusFlags(PythonRequest::Bind(gInt8uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_BinaryInputBasic_StatusFlags(chip::Controller::Device * device,
@@ -892,8 +1007,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_BinaryInputBasic_StatusFlags(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BinaryInputBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeStatusFlags(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                                 maxInterval);
+    return cluster.ConfigureAttributeStatusFlags(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BinaryInputBasic_ClusterRevision(chip::Controller::Device * device,
@@ -902,7 +1017,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BinaryInputBasic_ClusterRevision(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BinaryInputBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster BinaryInputBasic
@@ -915,7 +1031,8 @@ CHIP_ERROR chip_ime_AppendCommand_Binding_Bind(chip::Controller::Device * device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BindingCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.Bind(nullptr, nullptr, nodeId, groupId, endpointId, clusterId);
+    return cluster.Bind(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                        PythonRequest::BindIfPending(gDefaultFailureCallback), nodeId, groupId, endpointId, clusterId);
 }
 CHIP_ERROR chip_ime_AppendCommand_Binding_Unbind(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId,
                                                  chip::NodeId nodeId, chip::GroupId groupId, chip::EndpointId endpointId,
@@ -924,7 +1041,8 @@ CHIP_ERROR chip_ime_AppendCommand_Binding_Unbind(chip::Controller::Device * devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BindingCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.Unbind(nullptr, nullptr, nodeId, groupId, endpointId, clusterId);
+    return cluster.Unbind(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                          PythonRequest::BindIfPending(gDefaultFailureCallback), nodeId, groupId, endpointId, clusterId);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Binding_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -933,7 +1051,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Binding_ClusterRevision(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BindingCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster Binding
@@ -945,7 +1064,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_VendorName(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeVendorName(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeVendorName(PythonRequest::Bind(gStringAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_VendorID(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -954,7 +1074,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_VendorID(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeVendorID(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeVendorID(PythonRequest::Bind(gInt16uAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_ProductName(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -963,7 +1084,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_ProductName(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeProductName(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeProductName(PythonRequest::Bind(gStringAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_UserLabel(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -972,7 +1094,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_UserLabel(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeUserLabel(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeUserLabel(PythonRequest::Bind(gStringAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_BridgedDeviceBasic_UserLabel(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -981,8 +1104,8 @@ CHIP_ERROR chip_ime_WriteAttribute_BridgedDeviceBasic_UserLabel(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeUserLabel(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                           chip::ByteSpan(value, len));
+    return cluster.WriteAttributeUserLabel(PythonRequest::Bind(gDefaultSuccessCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback), chip::ByteSpan(value, len));
 }
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_HardwareVersion(chip::Controller::Device * device,
                                                                      chip::EndpointId ZCLendpointId, chip::GroupId /* ZCLgroupId */)
@@ -990,7 +1113,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_HardwareVersion(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeHardwareVersion(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeHardwareVersion(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_HardwareVersionString(chip::Controller::Device * device,
@@ -1000,7 +1124,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_HardwareVersionString(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeHardwareVersionString(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeHardwareVersionString(PythonRequest::Bind(gStringAttributeCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_SoftwareVersion(chip::Controller::Device * device,
@@ -1009,7 +1134,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_SoftwareVersion(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSoftwareVersion(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSoftwareVersion(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_SoftwareVersionString(chip::Controller::Device * device,
@@ -1019,7 +1145,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_SoftwareVersionString(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSoftwareVersionString(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSoftwareVersionString(PythonRequest::Bind(gStringAttributeCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_ManufacturingDate(chip::Controller::Device * device,
@@ -1029,7 +1156,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_ManufacturingDate(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeManufacturingDate(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeManufacturingDate(PythonRequest::Bind(gStringAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_PartNumber(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1038,7 +1166,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_PartNumber(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePartNumber(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePartNumber(PythonRequest::Bind(gStringAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_ProductURL(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1047,7 +1176,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_ProductURL(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeProductURL(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeProductURL(PythonRequest::Bind(gStringAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_ProductLabel(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1056,7 +1186,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_ProductLabel(chip::Controll
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeProductLabel(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeProductLabel(PythonRequest::Bind(gStringAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_SerialNumber(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1065,7 +1196,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_SerialNumber(chip::Controll
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSerialNumber(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSerialNumber(PythonRequest::Bind(gStringAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_Reachable(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1074,7 +1206,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_Reachable(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeReachable(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeReachable(PythonRequest::Bind(gBooleanAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_ClusterRevision(chip::Controller::Device * device,
@@ -1083,7 +1216,8 @@ CHIP_ERROR chip_ime_ReadAttribute_BridgedDeviceBasic_ClusterRevision(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::BridgedDeviceBasicCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster BridgedDeviceBasic
@@ -1097,7 +1231,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_ColorLoopSet(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ColorLoopSet(nullptr, nullptr, updateFlags, action, direction, time, startHue, optionsMask, optionsOverride);
+    return cluster.ColorLoopSet(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                PythonRequest::BindIfPending(gDefaultFailureCallback), updateFlags, action, direction, time,
+                                startHue, optionsMask, optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_EnhancedMoveHue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                chip::GroupId, uint8_t moveMode, uint16_t rate, uint8_t optionsMask,
@@ -1106,7 +1242,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_EnhancedMoveHue(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.EnhancedMoveHue(nullptr, nullptr, moveMode, rate, optionsMask, optionsOverride);
+    return cluster.EnhancedMoveHue(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                   PythonRequest::BindIfPending(gDefaultFailureCallback), moveMode, rate, optionsMask,
+                                   optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_EnhancedMoveToHue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                  chip::GroupId, uint16_t enhancedHue, uint8_t direction,
@@ -1116,7 +1254,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_EnhancedMoveToHue(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.EnhancedMoveToHue(nullptr, nullptr, enhancedHue, direction, transitionTime, optionsMask, optionsOverride);
+    return cluster.EnhancedMoveToHue(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                     PythonRequest::BindIfPending(gDefaultFailureCallback), enhancedHue, direction, transitionTime,
+                                     optionsMask, optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_EnhancedMoveToHueAndSaturation(chip::Controller::Device * device,
                                                                               chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -1127,8 +1267,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_EnhancedMoveToHueAndSaturation(ch
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.EnhancedMoveToHueAndSaturation(nullptr, nullptr, enhancedHue, saturation, transitionTime, optionsMask,
-                                                  optionsOverride);
+    return cluster.EnhancedMoveToHueAndSaturation(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                                  PythonRequest::BindIfPending(gDefaultFailureCallback), enhancedHue, saturation,
+                                                  transitionTime, optionsMask, optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_EnhancedStepHue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                chip::GroupId, uint8_t stepMode, uint16_t stepSize,
@@ -1138,7 +1279,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_EnhancedStepHue(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.EnhancedStepHue(nullptr, nullptr, stepMode, stepSize, transitionTime, optionsMask, optionsOverride);
+    return cluster.EnhancedStepHue(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                   PythonRequest::BindIfPending(gDefaultFailureCallback), stepMode, stepSize, transitionTime,
+                                   optionsMask, optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveColor(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                          chip::GroupId, int16_t rateX, int16_t rateY, uint8_t optionsMask,
@@ -1147,7 +1290,8 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveColor(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveColor(nullptr, nullptr, rateX, rateY, optionsMask, optionsOverride);
+    return cluster.MoveColor(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback), rateX, rateY, optionsMask, optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveColorTemperature(chip::Controller::Device * device,
                                                                     chip::EndpointId ZCLendpointId, chip::GroupId, uint8_t moveMode,
@@ -1158,8 +1302,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveColorTemperature(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveColorTemperature(nullptr, nullptr, moveMode, rate, colorTemperatureMinimum, colorTemperatureMaximum,
-                                        optionsMask, optionsOverride);
+    return cluster.MoveColorTemperature(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                        PythonRequest::BindIfPending(gDefaultFailureCallback), moveMode, rate,
+                                        colorTemperatureMinimum, colorTemperatureMaximum, optionsMask, optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveHue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                        chip::GroupId, uint8_t moveMode, uint8_t rate, uint8_t optionsMask,
@@ -1168,7 +1313,8 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveHue(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveHue(nullptr, nullptr, moveMode, rate, optionsMask, optionsOverride);
+    return cluster.MoveHue(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                           PythonRequest::BindIfPending(gDefaultFailureCallback), moveMode, rate, optionsMask, optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveSaturation(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                               chip::GroupId, uint8_t moveMode, uint8_t rate, uint8_t optionsMask,
@@ -1177,7 +1323,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveSaturation(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveSaturation(nullptr, nullptr, moveMode, rate, optionsMask, optionsOverride);
+    return cluster.MoveSaturation(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                  PythonRequest::BindIfPending(gDefaultFailureCallback), moveMode, rate, optionsMask,
+                                  optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveToColor(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                            chip::GroupId, uint16_t colorX, uint16_t colorY, uint16_t transitionTime,
@@ -1186,7 +1334,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveToColor(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveToColor(nullptr, nullptr, colorX, colorY, transitionTime, optionsMask, optionsOverride);
+    return cluster.MoveToColor(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback), colorX, colorY, transitionTime, optionsMask,
+                               optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveToColorTemperature(chip::Controller::Device * device,
                                                                       chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -1196,7 +1346,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveToColorTemperature(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveToColorTemperature(nullptr, nullptr, colorTemperature, transitionTime, optionsMask, optionsOverride);
+    return cluster.MoveToColorTemperature(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                          PythonRequest::BindIfPending(gDefaultFailureCallback), colorTemperature, transitionTime,
+                                          optionsMask, optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveToHue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                          chip::GroupId, uint8_t hue, uint8_t direction, uint16_t transitionTime,
@@ -1205,7 +1357,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveToHue(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveToHue(nullptr, nullptr, hue, direction, transitionTime, optionsMask, optionsOverride);
+    return cluster.MoveToHue(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback), hue, direction, transitionTime, optionsMask,
+                             optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveToHueAndSaturation(chip::Controller::Device * device,
                                                                       chip::EndpointId ZCLendpointId, chip::GroupId, uint8_t hue,
@@ -1215,7 +1369,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveToHueAndSaturation(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveToHueAndSaturation(nullptr, nullptr, hue, saturation, transitionTime, optionsMask, optionsOverride);
+    return cluster.MoveToHueAndSaturation(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                          PythonRequest::BindIfPending(gDefaultFailureCallback), hue, saturation, transitionTime,
+                                          optionsMask, optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveToSaturation(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                 chip::GroupId, uint8_t saturation, uint16_t transitionTime,
@@ -1224,7 +1380,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_MoveToSaturation(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveToSaturation(nullptr, nullptr, saturation, transitionTime, optionsMask, optionsOverride);
+    return cluster.MoveToSaturation(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                    PythonRequest::BindIfPending(gDefaultFailureCallback), saturation, transitionTime, optionsMask,
+                                    optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_StepColor(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                          chip::GroupId, int16_t stepX, int16_t stepY, uint16_t transitionTime,
@@ -1233,7 +1391,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_StepColor(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.StepColor(nullptr, nullptr, stepX, stepY, transitionTime, optionsMask, optionsOverride);
+    return cluster.StepColor(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback), stepX, stepY, transitionTime, optionsMask,
+                             optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_StepColorTemperature(chip::Controller::Device * device,
                                                                     chip::EndpointId ZCLendpointId, chip::GroupId, uint8_t stepMode,
@@ -1245,8 +1405,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_StepColorTemperature(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.StepColorTemperature(nullptr, nullptr, stepMode, stepSize, transitionTime, colorTemperatureMinimum,
-                                        colorTemperatureMaximum, optionsMask, optionsOverride);
+    return cluster.StepColorTemperature(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                        PythonRequest::BindIfPending(gDefaultFailureCallback), stepMode, stepSize, transitionTime,
+                                        colorTemperatureMinimum, colorTemperatureMaximum, optionsMask, optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_StepHue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                        chip::GroupId, uint8_t stepMode, uint8_t stepSize, uint8_t transitionTime,
@@ -1255,7 +1416,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_StepHue(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.StepHue(nullptr, nullptr, stepMode, stepSize, transitionTime, optionsMask, optionsOverride);
+    return cluster.StepHue(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                           PythonRequest::BindIfPending(gDefaultFailureCallback), stepMode, stepSize, transitionTime, optionsMask,
+                           optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_StepSaturation(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                               chip::GroupId, uint8_t stepMode, uint8_t stepSize,
@@ -1264,7 +1427,9 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_StepSaturation(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.StepSaturation(nullptr, nullptr, stepMode, stepSize, transitionTime, optionsMask, optionsOverride);
+    return cluster.StepSaturation(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                  PythonRequest::BindIfPending(gDefaultFailureCallback), stepMode, stepSize, transitionTime,
+                                  optionsMask, optionsOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_ColorControl_StopMoveStep(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId, uint8_t optionsMask, uint8_t optionsOverride)
@@ -1272,7 +1437,8 @@ CHIP_ERROR chip_ime_AppendCommand_ColorControl_StopMoveStep(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.StopMoveStep(nullptr, nullptr, optionsMask, optionsOverride);
+    return cluster.StopMoveStep(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                PythonRequest::BindIfPending(gDefaultFailureCallback), optionsMask, optionsOverride);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CurrentHue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1281,7 +1447,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CurrentHue(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentHue(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentHue(PythonRequest::Bind(gInt8uAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_ColorControl_CurrentHue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1290,8 +1457,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_ColorControl_CurrentHue(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeCurrentHue(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                                maxInterval, change);
+    return cluster.ConfigureAttributeCurrentHue(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CurrentSaturation(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1300,7 +1467,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CurrentSaturation(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentSaturation(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentSaturation(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_ColorControl_CurrentSaturation(chip::Controller::Device * device,
@@ -1310,8 +1478,9 @@ CHIP_ERROR chip_ime_ConfigureAttribute_ColorControl_CurrentSaturation(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeCurrentSaturation(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                                       minInterval, maxInterval, change);
+    return cluster.ConfigureAttributeCurrentSaturation(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                       PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval,
+                                                       change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_RemainingTime(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1320,7 +1489,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_RemainingTime(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRemainingTime(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRemainingTime(PythonRequest::Bind(gInt16uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CurrentX(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1329,7 +1499,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CurrentX(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentX(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentX(PythonRequest::Bind(gInt16uAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_ColorControl_CurrentX(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1338,8 +1509,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_ColorControl_CurrentX(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeCurrentX(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                              maxInterval, change);
+    return cluster.ConfigureAttributeCurrentX(PythonRequest::Bind(gInt16uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CurrentY(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1348,7 +1519,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CurrentY(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentY(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentY(PythonRequest::Bind(gInt16uAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_ColorControl_CurrentY(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1357,8 +1529,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_ColorControl_CurrentY(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeCurrentY(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                              maxInterval, change);
+    return cluster.ConfigureAttributeCurrentY(PythonRequest::Bind(gInt16uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_DriftCompensation(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1367,7 +1539,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_DriftCompensation(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeDriftCompensation(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeDriftCompensation(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CompensationText(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1376,7 +1549,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CompensationText(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCompensationText(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCompensationText(PythonRequest::Bind(gStringAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorTemperature(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1385,7 +1559,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorTemperature(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorTemperature(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorTemperature(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_ColorControl_ColorTemperature(chip::Controller::Device * device,
@@ -1395,8 +1570,9 @@ CHIP_ERROR chip_ime_ConfigureAttribute_ColorControl_ColorTemperature(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeColorTemperature(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                                      minInterval, maxInterval, change);
+    return cluster.ConfigureAttributeColorTemperature(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval,
+                                                      change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorMode(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1405,7 +1581,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorMode(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorMode(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorMode(PythonRequest::Bind(gInt8uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorControlOptions(chip::Controller::Device * device,
@@ -1414,7 +1591,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorControlOptions(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorControlOptions(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorControlOptions(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                    PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorControlOptions(chip::Controller::Device * device,
@@ -1423,7 +1601,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorControlOptions(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeColorControlOptions(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeColorControlOptions(PythonRequest::Bind(gDefaultSuccessCallback),
+                                                     PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_NumberOfPrimaries(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                  chip::GroupId /* ZCLgroupId */)
@@ -1431,7 +1610,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_NumberOfPrimaries(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeNumberOfPrimaries(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeNumberOfPrimaries(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary1X(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1440,7 +1620,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary1X(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary1X(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary1X(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary1Y(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1449,7 +1630,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary1Y(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary1Y(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary1Y(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary1Intensity(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1458,7 +1640,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary1Intensity(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary1Intensity(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary1Intensity(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary2X(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1467,7 +1650,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary2X(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary2X(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary2X(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary2Y(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1476,7 +1660,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary2Y(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary2Y(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary2Y(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary2Intensity(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1485,7 +1670,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary2Intensity(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary2Intensity(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary2Intensity(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary3X(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1494,7 +1680,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary3X(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary3X(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary3X(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary3Y(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1503,7 +1690,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary3Y(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary3Y(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary3Y(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary3Intensity(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1512,7 +1700,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary3Intensity(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary3Intensity(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary3Intensity(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary4X(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1521,7 +1710,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary4X(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary4X(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary4X(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary4Y(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1530,7 +1720,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary4Y(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary4Y(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary4Y(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary4Intensity(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1539,7 +1730,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary4Intensity(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary4Intensity(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary4Intensity(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary5X(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1548,7 +1740,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary5X(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary5X(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary5X(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary5Y(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1557,7 +1750,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary5Y(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary5Y(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary5Y(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary5Intensity(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1566,7 +1760,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary5Intensity(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary5Intensity(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary5Intensity(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary6X(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1575,7 +1770,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary6X(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary6X(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary6X(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary6Y(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1584,7 +1780,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary6Y(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary6Y(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary6Y(PythonRequest::Bind(gInt16uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary6Intensity(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1593,7 +1790,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_Primary6Intensity(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePrimary6Intensity(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePrimary6Intensity(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_WhitePointX(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1602,7 +1800,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_WhitePointX(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeWhitePointX(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeWhitePointX(PythonRequest::Bind(gInt16uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_WhitePointX(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1611,7 +1810,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_WhitePointX(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeWhitePointX(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeWhitePointX(PythonRequest::Bind(gDefaultSuccessCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_WhitePointY(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                            chip::GroupId /* ZCLgroupId */)
@@ -1619,7 +1819,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_WhitePointY(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeWhitePointY(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeWhitePointY(PythonRequest::Bind(gInt16uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_WhitePointY(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1628,7 +1829,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_WhitePointY(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeWhitePointY(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeWhitePointY(PythonRequest::Bind(gDefaultSuccessCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointRX(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId /* ZCLgroupId */)
@@ -1636,7 +1838,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointRX(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorPointRX(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorPointRX(PythonRequest::Bind(gInt16uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointRX(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1645,7 +1848,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointRX(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeColorPointRX(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeColorPointRX(PythonRequest::Bind(gDefaultSuccessCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointRY(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId /* ZCLgroupId */)
@@ -1653,7 +1857,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointRY(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorPointRY(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorPointRY(PythonRequest::Bind(gInt16uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointRY(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1662,7 +1867,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointRY(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeColorPointRY(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeColorPointRY(PythonRequest::Bind(gDefaultSuccessCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointRIntensity(chip::Controller::Device * device,
                                                                     chip::EndpointId ZCLendpointId, chip::GroupId /* ZCLgroupId */)
@@ -1670,7 +1876,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointRIntensity(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorPointRIntensity(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorPointRIntensity(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                     PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointRIntensity(chip::Controller::Device * device,
@@ -1679,7 +1886,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointRIntensity(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeColorPointRIntensity(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeColorPointRIntensity(PythonRequest::Bind(gDefaultSuccessCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointGX(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId /* ZCLgroupId */)
@@ -1687,7 +1895,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointGX(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorPointGX(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorPointGX(PythonRequest::Bind(gInt16uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointGX(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1696,7 +1905,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointGX(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeColorPointGX(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeColorPointGX(PythonRequest::Bind(gDefaultSuccessCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointGY(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId /* ZCLgroupId */)
@@ -1704,7 +1914,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointGY(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorPointGY(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorPointGY(PythonRequest::Bind(gInt16uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointGY(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1713,7 +1924,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointGY(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeColorPointGY(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeColorPointGY(PythonRequest::Bind(gDefaultSuccessCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointGIntensity(chip::Controller::Device * device,
                                                                     chip::EndpointId ZCLendpointId, chip::GroupId /* ZCLgroupId */)
@@ -1721,7 +1933,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointGIntensity(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorPointGIntensity(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorPointGIntensity(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                     PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointGIntensity(chip::Controller::Device * device,
@@ -1730,7 +1943,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointGIntensity(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeColorPointGIntensity(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeColorPointGIntensity(PythonRequest::Bind(gDefaultSuccessCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointBX(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId /* ZCLgroupId */)
@@ -1738,7 +1952,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointBX(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorPointBX(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorPointBX(PythonRequest::Bind(gInt16uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointBX(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1747,7 +1962,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointBX(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeColorPointBX(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeColorPointBX(PythonRequest::Bind(gDefaultSuccessCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointBY(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId /* ZCLgroupId */)
@@ -1755,7 +1971,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointBY(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorPointBY(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorPointBY(PythonRequest::Bind(gInt16uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointBY(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1764,7 +1981,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointBY(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeColorPointBY(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeColorPointBY(PythonRequest::Bind(gDefaultSuccessCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointBIntensity(chip::Controller::Device * device,
                                                                     chip::EndpointId ZCLendpointId, chip::GroupId /* ZCLgroupId */)
@@ -1772,7 +1990,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorPointBIntensity(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorPointBIntensity(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorPointBIntensity(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                     PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointBIntensity(chip::Controller::Device * device,
@@ -1781,7 +2000,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_ColorPointBIntensity(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeColorPointBIntensity(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeColorPointBIntensity(PythonRequest::Bind(gDefaultSuccessCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_EnhancedCurrentHue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                   chip::GroupId /* ZCLgroupId */)
@@ -1789,7 +2009,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_EnhancedCurrentHue(chip::Controll
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeEnhancedCurrentHue(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeEnhancedCurrentHue(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                   PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_EnhancedColorMode(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1798,7 +2019,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_EnhancedColorMode(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeEnhancedColorMode(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeEnhancedColorMode(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorLoopActive(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1807,7 +2029,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorLoopActive(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorLoopActive(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorLoopActive(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorLoopDirection(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1816,7 +2039,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorLoopDirection(chip::Controll
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorLoopDirection(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorLoopDirection(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                   PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorLoopTime(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1825,7 +2049,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorLoopTime(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorLoopTime(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorLoopTime(PythonRequest::Bind(gInt16uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorCapabilities(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1834,7 +2059,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorCapabilities(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorCapabilities(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorCapabilities(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorTempPhysicalMin(chip::Controller::Device * device,
@@ -1843,7 +2069,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorTempPhysicalMin(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorTempPhysicalMin(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorTempPhysicalMin(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                     PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorTempPhysicalMax(chip::Controller::Device * device,
@@ -1852,7 +2079,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ColorTempPhysicalMax(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeColorTempPhysicalMax(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeColorTempPhysicalMax(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                     PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CoupleColorTempToLevelMinMireds(chip::Controller::Device * device,
@@ -1862,8 +2090,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_CoupleColorTempToLevelMinMireds(c
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCoupleColorTempToLevelMinMireds(gInt16uAttributeCallback.Cancel(),
-                                                                gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCoupleColorTempToLevelMinMireds(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_StartUpColorTemperatureMireds(chip::Controller::Device * device,
@@ -1873,7 +2101,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_StartUpColorTemperatureMireds(chi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeStartUpColorTemperatureMireds(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeStartUpColorTemperatureMireds(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_ColorControl_StartUpColorTemperatureMireds(chip::Controller::Device * device,
@@ -1883,8 +2112,8 @@ CHIP_ERROR chip_ime_WriteAttribute_ColorControl_StartUpColorTemperatureMireds(ch
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeStartUpColorTemperatureMireds(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                                               value);
+    return cluster.WriteAttributeStartUpColorTemperatureMireds(PythonRequest::Bind(gDefaultSuccessCallback),
+                                                               PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                chip::GroupId /* ZCLgroupId */)
@@ -1892,7 +2121,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ColorControl_ClusterRevision(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ColorControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster ColorControl
@@ -1905,7 +2135,8 @@ CHIP_ERROR chip_ime_AppendCommand_ContentLauncher_LaunchContent(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ContentLauncherCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.LaunchContent(nullptr, nullptr, autoPlay, chip::ByteSpan(data, data_Len));
+    return cluster.LaunchContent(PythonRequest::BindResponse<ContentLauncherClusterLaunchContentResponseCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback), autoPlay, chip::ByteSpan(data, data_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_ContentLauncher_LaunchURL(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId, const uint8_t * contentURL, uint32_t contentURL_Len,
@@ -1914,7 +2145,8 @@ CHIP_ERROR chip_ime_AppendCommand_ContentLauncher_LaunchURL(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ContentLauncherCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.LaunchURL(nullptr, nullptr, chip::ByteSpan(contentURL, contentURL_Len),
+    return cluster.LaunchURL(PythonRequest::BindResponse<ContentLauncherClusterLaunchURLResponseCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(contentURL, contentURL_Len),
                              chip::ByteSpan(displayString, displayString_Len));
 }
 
@@ -1924,8 +2156,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ContentLauncher_AcceptsHeaderList(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ContentLauncherCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeAcceptsHeaderList(gContentLauncherAcceptsHeaderListListAttributeCallback.Cancel(),
-                                                  gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeAcceptsHeaderList(PythonRequest::Bind(gContentLauncherAcceptsHeaderListListAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ContentLauncher_SupportedStreamingTypes(chip::Controller::Device * device,
@@ -1935,8 +2167,9 @@ CHIP_ERROR chip_ime_ReadAttribute_ContentLauncher_SupportedStreamingTypes(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ContentLauncherCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSupportedStreamingTypes(gContentLauncherSupportedStreamingTypesListAttributeCallback.Cancel(),
-                                                        gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSupportedStreamingTypes(
+            PythonRequest::Bind(gContentLauncherSupportedStreamingTypesListAttributeCallback),
+            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ContentLauncher_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1945,7 +2178,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ContentLauncher_ClusterRevision(chip::Controll
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ContentLauncherCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster ContentLauncher
@@ -1957,7 +2191,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Descriptor_DeviceList(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DescriptorCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeDeviceList(gDescriptorDeviceListListAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeDeviceList(PythonRequest::Bind(gDescriptorDeviceListListAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Descriptor_ServerList(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1966,7 +2201,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Descriptor_ServerList(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DescriptorCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeServerList(gDescriptorServerListListAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeServerList(PythonRequest::Bind(gDescriptorServerListListAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Descriptor_ClientList(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1975,7 +2211,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Descriptor_ClientList(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DescriptorCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClientList(gDescriptorClientListListAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClientList(PythonRequest::Bind(gDescriptorClientListListAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Descriptor_PartsList(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1984,7 +2221,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Descriptor_PartsList(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DescriptorCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePartsList(gDescriptorPartsListListAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePartsList(PythonRequest::Bind(gDescriptorPartsListListAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Descriptor_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -1993,7 +2231,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Descriptor_ClusterRevision(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DescriptorCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster Descriptor
@@ -2008,7 +2247,8 @@ CHIP_ERROR chip_ime_AppendCommand_DiagnosticLogs_RetrieveLogsRequest(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DiagnosticLogsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RetrieveLogsRequest(nullptr, nullptr, intent, requestedProtocol,
+    return cluster.RetrieveLogsRequest(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                       PythonRequest::BindIfPending(gDefaultFailureCallback), intent, requestedProtocol,
                                        chip::ByteSpan(transferFileDesignator, transferFileDesignator_Len));
 }
 
@@ -2021,7 +2261,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearAllPins(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ClearAllPins(nullptr, nullptr);
+    return cluster.ClearAllPins(PythonRequest::BindResponse<DoorLockClusterClearAllPinsResponseCallback>(),
+                                PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearAllRfids(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                          chip::GroupId)
@@ -2029,7 +2270,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearAllRfids(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ClearAllRfids(nullptr, nullptr);
+    return cluster.ClearAllRfids(PythonRequest::BindResponse<DoorLockClusterClearAllRfidsResponseCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearHolidaySchedule(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                 chip::GroupId, uint8_t scheduleId)
@@ -2037,7 +2279,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearHolidaySchedule(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ClearHolidaySchedule(nullptr, nullptr, scheduleId);
+    return cluster.ClearHolidaySchedule(PythonRequest::BindResponse<DoorLockClusterClearHolidayScheduleResponseCallback>(),
+                                        PythonRequest::BindIfPending(gDefaultFailureCallback), scheduleId);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearPin(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                     chip::GroupId, uint16_t userId)
@@ -2045,7 +2288,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearPin(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ClearPin(nullptr, nullptr, userId);
+    return cluster.ClearPin(PythonRequest::BindResponse<DoorLockClusterClearPinResponseCallback>(),
+                            PythonRequest::BindIfPending(gDefaultFailureCallback), userId);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearRfid(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId, uint16_t userId)
@@ -2053,7 +2297,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearRfid(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ClearRfid(nullptr, nullptr, userId);
+    return cluster.ClearRfid(PythonRequest::BindResponse<DoorLockClusterClearRfidResponseCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback), userId);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearWeekdaySchedule(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                 chip::GroupId, uint8_t scheduleId, uint16_t userId)
@@ -2061,7 +2306,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearWeekdaySchedule(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ClearWeekdaySchedule(nullptr, nullptr, scheduleId, userId);
+    return cluster.ClearWeekdaySchedule(PythonRequest::BindResponse<DoorLockClusterClearWeekdayScheduleResponseCallback>(),
+                                        PythonRequest::BindIfPending(gDefaultFailureCallback), scheduleId, userId);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearYeardaySchedule(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                 chip::GroupId, uint8_t scheduleId, uint16_t userId)
@@ -2069,7 +2315,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_ClearYeardaySchedule(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ClearYeardaySchedule(nullptr, nullptr, scheduleId, userId);
+    return cluster.ClearYeardaySchedule(PythonRequest::BindResponse<DoorLockClusterClearYeardayScheduleResponseCallback>(),
+                                        PythonRequest::BindIfPending(gDefaultFailureCallback), scheduleId, userId);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetHolidaySchedule(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                               chip::GroupId, uint8_t scheduleId)
@@ -2077,7 +2324,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetHolidaySchedule(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetHolidaySchedule(nullptr, nullptr, scheduleId);
+    return cluster.GetHolidaySchedule(PythonRequest::BindResponse<DoorLockClusterGetHolidayScheduleResponseCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback), scheduleId);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetLogRecord(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                         chip::GroupId, uint16_t logIndex)
@@ -2085,7 +2333,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetLogRecord(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetLogRecord(nullptr, nullptr, logIndex);
+    return cluster.GetLogRecord(PythonRequest::BindResponse<DoorLockClusterGetLogRecordResponseCallback>(),
+                                PythonRequest::BindIfPending(gDefaultFailureCallback), logIndex);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetPin(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId,
                                                   uint16_t userId)
@@ -2093,7 +2342,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetPin(chip::Controller::Device * dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetPin(nullptr, nullptr, userId);
+    return cluster.GetPin(PythonRequest::BindResponse<DoorLockClusterGetPinResponseCallback>(),
+                          PythonRequest::BindIfPending(gDefaultFailureCallback), userId);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetRfid(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId,
                                                    uint16_t userId)
@@ -2101,7 +2351,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetRfid(chip::Controller::Device * de
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetRfid(nullptr, nullptr, userId);
+    return cluster.GetRfid(PythonRequest::BindResponse<DoorLockClusterGetRfidResponseCallback>(),
+                           PythonRequest::BindIfPending(gDefaultFailureCallback), userId);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetUserType(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                        chip::GroupId, uint16_t userId)
@@ -2109,7 +2360,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetUserType(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetUserType(nullptr, nullptr, userId);
+    return cluster.GetUserType(PythonRequest::BindResponse<DoorLockClusterGetUserTypeResponseCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback), userId);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetWeekdaySchedule(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                               chip::GroupId, uint8_t scheduleId, uint16_t userId)
@@ -2117,7 +2369,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetWeekdaySchedule(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetWeekdaySchedule(nullptr, nullptr, scheduleId, userId);
+    return cluster.GetWeekdaySchedule(PythonRequest::BindResponse<DoorLockClusterGetWeekdayScheduleResponseCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback), scheduleId, userId);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetYeardaySchedule(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                               chip::GroupId, uint8_t scheduleId, uint16_t userId)
@@ -2125,7 +2378,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_GetYeardaySchedule(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetYeardaySchedule(nullptr, nullptr, scheduleId, userId);
+    return cluster.GetYeardaySchedule(PythonRequest::BindResponse<DoorLockClusterGetYeardayScheduleResponseCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback), scheduleId, userId);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_LockDoor(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                     chip::GroupId, const uint8_t * pin, uint32_t pin_Len)
@@ -2133,7 +2387,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_LockDoor(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.LockDoor(nullptr, nullptr, chip::ByteSpan(pin, pin_Len));
+    return cluster.LockDoor(PythonRequest::BindResponse<DoorLockClusterLockDoorResponseCallback>(),
+                            PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(pin, pin_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetHolidaySchedule(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                               chip::GroupId, uint8_t scheduleId, uint32_t localStartTime,
@@ -2142,7 +2397,9 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetHolidaySchedule(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SetHolidaySchedule(nullptr, nullptr, scheduleId, localStartTime, localEndTime, operatingModeDuringHoliday);
+    return cluster.SetHolidaySchedule(PythonRequest::BindResponse<DoorLockClusterSetHolidayScheduleResponseCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback), scheduleId, localStartTime,
+                                      localEndTime, operatingModeDuringHoliday);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetPin(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId,
                                                   uint16_t userId, uint8_t userStatus, uint8_t userType, const uint8_t * pin,
@@ -2151,7 +2408,9 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetPin(chip::Controller::Device * dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SetPin(nullptr, nullptr, userId, userStatus, userType, chip::ByteSpan(pin, pin_Len));
+    return cluster.SetPin(PythonRequest::BindResponse<DoorLockClusterSetPinResponseCallback>(),
+                          PythonRequest::BindIfPending(gDefaultFailureCallback), userId, userStatus, userType,
+                          chip::ByteSpan(pin, pin_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetRfid(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId,
                                                    uint16_t userId, uint8_t userStatus, uint8_t userType, const uint8_t * id,
@@ -2160,7 +2419,9 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetRfid(chip::Controller::Device * de
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SetRfid(nullptr, nullptr, userId, userStatus, userType, chip::ByteSpan(id, id_Len));
+    return cluster.SetRfid(PythonRequest::BindResponse<DoorLockClusterSetRfidResponseCallback>(),
+                           PythonRequest::BindIfPending(gDefaultFailureCallback), userId, userStatus, userType,
+                           chip::ByteSpan(id, id_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetUserType(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                        chip::GroupId, uint16_t userId, uint8_t userType)
@@ -2168,7 +2429,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetUserType(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SetUserType(nullptr, nullptr, userId, userType);
+    return cluster.SetUserType(PythonRequest::BindResponse<DoorLockClusterSetUserTypeResponseCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback), userId, userType);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetWeekdaySchedule(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                               chip::GroupId, uint8_t scheduleId, uint16_t userId, uint8_t daysMask,
@@ -2178,7 +2440,9 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetWeekdaySchedule(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SetWeekdaySchedule(nullptr, nullptr, scheduleId, userId, daysMask, startHour, startMinute, endHour, endMinute);
+    return cluster.SetWeekdaySchedule(PythonRequest::BindResponse<DoorLockClusterSetWeekdayScheduleResponseCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback), scheduleId, userId, daysMask,
+                                      startHour, startMinute, endHour, endMinute);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetYeardaySchedule(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                               chip::GroupId, uint8_t scheduleId, uint16_t userId,
@@ -2187,7 +2451,9 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_SetYeardaySchedule(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SetYeardaySchedule(nullptr, nullptr, scheduleId, userId, localStartTime, localEndTime);
+    return cluster.SetYeardaySchedule(PythonRequest::BindResponse<DoorLockClusterSetYeardayScheduleResponseCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback), scheduleId, userId, localStartTime,
+                                      localEndTime);
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_UnlockDoor(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                       chip::GroupId, const uint8_t * pin, uint32_t pin_Len)
@@ -2195,7 +2461,8 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_UnlockDoor(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.UnlockDoor(nullptr, nullptr, chip::ByteSpan(pin, pin_Len));
+    return cluster.UnlockDoor(PythonRequest::BindResponse<DoorLockClusterUnlockDoorResponseCallback>(),
+                              PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(pin, pin_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_DoorLock_UnlockWithTimeout(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                              chip::GroupId, uint16_t timeoutInSeconds, const uint8_t * pin,
@@ -2204,7 +2471,9 @@ CHIP_ERROR chip_ime_AppendCommand_DoorLock_UnlockWithTimeout(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.UnlockWithTimeout(nullptr, nullptr, timeoutInSeconds, chip::ByteSpan(pin, pin_Len));
+    return cluster.UnlockWithTimeout(PythonRequest::BindResponse<DoorLockClusterUnlockWithTimeoutResponseCallback>(),
+                                     PythonRequest::BindIfPending(gDefaultFailureCallback), timeoutInSeconds,
+                                     chip::ByteSpan(pin, pin_Len));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_DoorLock_LockState(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2213,7 +2482,8 @@ CHIP_ERROR chip_ime_ReadAttribute_DoorLock_LockState(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeLockState(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeLockState(PythonRequest::Bind(gInt8uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_DoorLock_LockState(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2222,8 +2492,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_DoorLock_LockState(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeLockState(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                               maxInterval);
+    return cluster.ConfigureAttributeLockState(PythonRequest::Bind(gInt8uAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_DoorLock_LockType(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2232,7 +2502,8 @@ CHIP_ERROR chip_ime_ReadAttribute_DoorLock_LockType(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeLockType(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeLockType(PythonRequest::Bind(gInt8uAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_DoorLock_ActuatorEnabled(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2241,7 +2512,8 @@ CHIP_ERROR chip_ime_ReadAttribute_DoorLock_ActuatorEnabled(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeActuatorEnabled(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeActuatorEnabled(PythonRequest::Bind(gBooleanAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_DoorLock_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2250,7 +2522,8 @@ CHIP_ERROR chip_ime_ReadAttribute_DoorLock_ClusterRevision(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::DoorLockCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster DoorLock
@@ -2263,7 +2536,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_MeasurementType(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMeasurementType(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMeasurementType(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_TotalActivePower(chip::Controller::Device * device,
@@ -2273,7 +2547,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_TotalActivePower(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTotalActivePower(gInt32sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTotalActivePower(PythonRequest::Bind(gInt32sAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsVoltage(chip::Controller::Device * device,
@@ -2282,7 +2557,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsVoltage(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRmsVoltage(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRmsVoltage(PythonRequest::Bind(gInt16uAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsVoltageMin(chip::Controller::Device * device,
@@ -2292,7 +2568,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsVoltageMin(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRmsVoltageMin(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRmsVoltageMin(PythonRequest::Bind(gInt16uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsVoltageMax(chip::Controller::Device * device,
@@ -2302,7 +2579,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsVoltageMax(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRmsVoltageMax(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRmsVoltageMax(PythonRequest::Bind(gInt16uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsCurrent(chip::Controller::Device * device,
@@ -2311,7 +2589,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsCurrent(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRmsCurrent(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRmsCurrent(PythonRequest::Bind(gInt16uAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsCurrentMin(chip::Controller::Device * device,
@@ -2321,7 +2600,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsCurrentMin(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRmsCurrentMin(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRmsCurrentMin(PythonRequest::Bind(gInt16uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsCurrentMax(chip::Controller::Device * device,
@@ -2331,7 +2611,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_RmsCurrentMax(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRmsCurrentMax(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRmsCurrentMax(PythonRequest::Bind(gInt16uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_ActivePower(chip::Controller::Device * device,
@@ -2340,7 +2621,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_ActivePower(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeActivePower(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeActivePower(PythonRequest::Bind(gInt16sAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_ActivePowerMin(chip::Controller::Device * device,
@@ -2350,7 +2632,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_ActivePowerMin(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeActivePowerMin(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeActivePowerMin(PythonRequest::Bind(gInt16sAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_ActivePowerMax(chip::Controller::Device * device,
@@ -2360,7 +2643,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_ActivePowerMax(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeActivePowerMax(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeActivePowerMax(PythonRequest::Bind(gInt16sAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_ClusterRevision(chip::Controller::Device * device,
@@ -2370,7 +2654,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ElectricalMeasurement_ClusterRevision(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ElectricalMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster ElectricalMeasurement
@@ -2382,7 +2667,8 @@ CHIP_ERROR chip_ime_AppendCommand_EthernetNetworkDiagnostics_ResetCounts(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::EthernetNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ResetCounts(nullptr, nullptr);
+    return cluster.ResetCounts(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_PacketRxCount(chip::Controller::Device * device,
@@ -2392,7 +2678,8 @@ CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_PacketRxCount(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::EthernetNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePacketRxCount(gInt64uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePacketRxCount(PythonRequest::Bind(gInt64uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_PacketTxCount(chip::Controller::Device * device,
@@ -2402,7 +2689,8 @@ CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_PacketTxCount(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::EthernetNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePacketTxCount(gInt64uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePacketTxCount(PythonRequest::Bind(gInt64uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_TxErrCount(chip::Controller::Device * device,
@@ -2412,7 +2700,8 @@ CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_TxErrCount(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::EthernetNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxErrCount(gInt64uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxErrCount(PythonRequest::Bind(gInt64uAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_CollisionCount(chip::Controller::Device * device,
@@ -2422,7 +2711,8 @@ CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_CollisionCount(chip
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::EthernetNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCollisionCount(gInt64uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCollisionCount(PythonRequest::Bind(gInt64uAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_OverrunCount(chip::Controller::Device * device,
@@ -2432,7 +2722,8 @@ CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_OverrunCount(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::EthernetNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOverrunCount(gInt64uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOverrunCount(PythonRequest::Bind(gInt64uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_ClusterRevision(chip::Controller::Device * device,
@@ -2442,7 +2733,8 @@ CHIP_ERROR chip_ime_ReadAttribute_EthernetNetworkDiagnostics_ClusterRevision(chi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::EthernetNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster EthernetNetworkDiagnostics
@@ -2454,7 +2746,8 @@ CHIP_ERROR chip_ime_ReadAttribute_FixedLabel_LabelList(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::FixedLabelCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeLabelList(gFixedLabelLabelListListAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeLabelList(PythonRequest::Bind(gFixedLabelLabelListListAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_FixedLabel_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2463,7 +2756,8 @@ CHIP_ERROR chip_ime_ReadAttribute_FixedLabel_ClusterRevision(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::FixedLabelCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster FixedLabel
@@ -2475,7 +2769,8 @@ CHIP_ERROR chip_ime_ReadAttribute_FlowMeasurement_MeasuredValue(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::FlowMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMeasuredValue(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMeasuredValue(PythonRequest::Bind(gInt16sAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_FlowMeasurement_MinMeasuredValue(chip::Controller::Device * device,
@@ -2484,7 +2779,8 @@ CHIP_ERROR chip_ime_ReadAttribute_FlowMeasurement_MinMeasuredValue(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::FlowMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMinMeasuredValue(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMinMeasuredValue(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_FlowMeasurement_MaxMeasuredValue(chip::Controller::Device * device,
@@ -2493,7 +2789,8 @@ CHIP_ERROR chip_ime_ReadAttribute_FlowMeasurement_MaxMeasuredValue(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::FlowMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMaxMeasuredValue(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMaxMeasuredValue(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_FlowMeasurement_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2502,7 +2799,8 @@ CHIP_ERROR chip_ime_ReadAttribute_FlowMeasurement_ClusterRevision(chip::Controll
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::FlowMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster FlowMeasurement
@@ -2516,7 +2814,8 @@ CHIP_ERROR chip_ime_AppendCommand_GeneralCommissioning_ArmFailSafe(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GeneralCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ArmFailSafe(nullptr, nullptr, expiryLengthSeconds, breadcrumb, timeoutMs);
+    return cluster.ArmFailSafe(PythonRequest::BindResponse<GeneralCommissioningClusterArmFailSafeResponseCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback), expiryLengthSeconds, breadcrumb, timeoutMs);
 }
 CHIP_ERROR chip_ime_AppendCommand_GeneralCommissioning_CommissioningComplete(chip::Controller::Device * device,
                                                                              chip::EndpointId ZCLendpointId, chip::GroupId)
@@ -2524,7 +2823,9 @@ CHIP_ERROR chip_ime_AppendCommand_GeneralCommissioning_CommissioningComplete(chi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GeneralCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.CommissioningComplete(nullptr, nullptr);
+    return cluster.CommissioningComplete(
+            PythonRequest::BindResponse<GeneralCommissioningClusterCommissioningCompleteResponseCallback>(),
+            PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_GeneralCommissioning_SetRegulatoryConfig(chip::Controller::Device * device,
                                                                            chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -2535,8 +2836,10 @@ CHIP_ERROR chip_ime_AppendCommand_GeneralCommissioning_SetRegulatoryConfig(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GeneralCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SetRegulatoryConfig(nullptr, nullptr, location, chip::ByteSpan(countryCode, countryCode_Len), breadcrumb,
-                                       timeoutMs);
+    return cluster.SetRegulatoryConfig(
+            PythonRequest::BindResponse<GeneralCommissioningClusterSetRegulatoryConfigResponseCallback>(),
+            PythonRequest::BindIfPending(gDefaultFailureCallback), location, chip::ByteSpan(countryCode, countryCode_Len),
+            breadcrumb, timeoutMs);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_GeneralCommissioning_FabricId(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2545,7 +2848,8 @@ CHIP_ERROR chip_ime_ReadAttribute_GeneralCommissioning_FabricId(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GeneralCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeFabricId(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeFabricId(PythonRequest::Bind(gStringAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_GeneralCommissioning_Breadcrumb(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2554,7 +2858,8 @@ CHIP_ERROR chip_ime_ReadAttribute_GeneralCommissioning_Breadcrumb(chip::Controll
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GeneralCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBreadcrumb(gInt64uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBreadcrumb(PythonRequest::Bind(gInt64uAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_GeneralCommissioning_Breadcrumb(chip::Controller::Device * device,
@@ -2563,7 +2868,8 @@ CHIP_ERROR chip_ime_WriteAttribute_GeneralCommissioning_Breadcrumb(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GeneralCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeBreadcrumb(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeBreadcrumb(PythonRequest::Bind(gDefaultSuccessCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_GeneralCommissioning_ClusterRevision(chip::Controller::Device * device,
                                                                        chip::EndpointId ZCLendpointId,
@@ -2572,7 +2878,8 @@ CHIP_ERROR chip_ime_ReadAttribute_GeneralCommissioning_ClusterRevision(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GeneralCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster GeneralCommissioning
@@ -2585,8 +2892,8 @@ CHIP_ERROR chip_ime_ReadAttribute_GeneralDiagnostics_NetworkInterfaces(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GeneralDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeNetworkInterfaces(gGeneralDiagnosticsNetworkInterfacesListAttributeCallback.Cancel(),
-                                                  gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeNetworkInterfaces(PythonRequest::Bind(gGeneralDiagnosticsNetworkInterfacesListAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_GeneralDiagnostics_RebootCount(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2595,7 +2902,8 @@ CHIP_ERROR chip_ime_ReadAttribute_GeneralDiagnostics_RebootCount(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GeneralDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRebootCount(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRebootCount(PythonRequest::Bind(gInt16uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_GeneralDiagnostics_ClusterRevision(chip::Controller::Device * device,
@@ -2604,7 +2912,8 @@ CHIP_ERROR chip_ime_ReadAttribute_GeneralDiagnostics_ClusterRevision(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GeneralDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster GeneralDiagnostics
@@ -2616,7 +2925,8 @@ CHIP_ERROR chip_ime_ReadAttribute_GroupKeyManagement_Groups(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GroupKeyManagementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeGroups(gGroupKeyManagementGroupsListAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeGroups(PythonRequest::Bind(gGroupKeyManagementGroupsListAttributeCallback),
+                                       PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_GroupKeyManagement_GroupKeys(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2625,8 +2935,8 @@ CHIP_ERROR chip_ime_ReadAttribute_GroupKeyManagement_GroupKeys(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GroupKeyManagementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeGroupKeys(gGroupKeyManagementGroupKeysListAttributeCallback.Cancel(),
-                                          gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeGroupKeys(PythonRequest::Bind(gGroupKeyManagementGroupKeysListAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_GroupKeyManagement_ClusterRevision(chip::Controller::Device * device,
@@ -2635,7 +2945,8 @@ CHIP_ERROR chip_ime_ReadAttribute_GroupKeyManagement_ClusterRevision(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GroupKeyManagementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster GroupKeyManagement
@@ -2647,7 +2958,9 @@ CHIP_ERROR chip_ime_AppendCommand_Groups_AddGroup(chip::Controller::Device * dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GroupsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.AddGroup(nullptr, nullptr, groupId, chip::ByteSpan(groupName, groupName_Len));
+    return cluster.AddGroup(PythonRequest::BindResponse<GroupsClusterAddGroupResponseCallback>(),
+                            PythonRequest::BindIfPending(gDefaultFailureCallback), groupId,
+                            chip::ByteSpan(groupName, groupName_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_Groups_AddGroupIfIdentifying(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                chip::GroupId, uint16_t groupId, const uint8_t * groupName,
@@ -2656,7 +2969,9 @@ CHIP_ERROR chip_ime_AppendCommand_Groups_AddGroupIfIdentifying(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GroupsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.AddGroupIfIdentifying(nullptr, nullptr, groupId, chip::ByteSpan(groupName, groupName_Len));
+    return cluster.AddGroupIfIdentifying(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                         PythonRequest::BindIfPending(gDefaultFailureCallback), groupId,
+                                         chip::ByteSpan(groupName, groupName_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_Groups_GetGroupMembership(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId, uint8_t groupCount, uint16_t groupList)
@@ -2664,7 +2979,8 @@ CHIP_ERROR chip_ime_AppendCommand_Groups_GetGroupMembership(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GroupsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetGroupMembership(nullptr, nullptr, groupCount, groupList);
+    return cluster.GetGroupMembership(PythonRequest::BindResponse<GroupsClusterGetGroupMembershipResponseCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback), groupCount, groupList);
 }
 CHIP_ERROR chip_ime_AppendCommand_Groups_RemoveAllGroups(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                          chip::GroupId)
@@ -2672,7 +2988,8 @@ CHIP_ERROR chip_ime_AppendCommand_Groups_RemoveAllGroups(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GroupsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RemoveAllGroups(nullptr, nullptr);
+    return cluster.RemoveAllGroups(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                   PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_Groups_RemoveGroup(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId, uint16_t groupId)
@@ -2680,7 +2997,8 @@ CHIP_ERROR chip_ime_AppendCommand_Groups_RemoveGroup(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GroupsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RemoveGroup(nullptr, nullptr, groupId);
+    return cluster.RemoveGroup(PythonRequest::BindResponse<GroupsClusterRemoveGroupResponseCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback), groupId);
 }
 CHIP_ERROR chip_ime_AppendCommand_Groups_ViewGroup(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId,
                                                    uint16_t groupId)
@@ -2688,7 +3006,8 @@ CHIP_ERROR chip_ime_AppendCommand_Groups_ViewGroup(chip::Controller::Device * de
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GroupsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ViewGroup(nullptr, nullptr, groupId);
+    return cluster.ViewGroup(PythonRequest::BindResponse<GroupsClusterViewGroupResponseCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback), groupId);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Groups_NameSupport(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2697,7 +3016,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Groups_NameSupport(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GroupsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeNameSupport(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeNameSupport(PythonRequest::Bind(gInt8uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Groups_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2706,7 +3026,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Groups_ClusterRevision(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::GroupsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster Groups
@@ -2718,7 +3039,8 @@ CHIP_ERROR chip_ime_AppendCommand_Identify_Identify(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::IdentifyCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.Identify(nullptr, nullptr, identifyTime);
+    return cluster.Identify(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                            PythonRequest::BindIfPending(gDefaultFailureCallback), identifyTime);
 }
 CHIP_ERROR chip_ime_AppendCommand_Identify_IdentifyQuery(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                          chip::GroupId)
@@ -2726,7 +3048,8 @@ CHIP_ERROR chip_ime_AppendCommand_Identify_IdentifyQuery(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::IdentifyCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.IdentifyQuery(nullptr, nullptr);
+    return cluster.IdentifyQuery(PythonRequest::BindResponse<IdentifyClusterIdentifyQueryResponseCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Identify_IdentifyTime(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2735,7 +3058,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Identify_IdentifyTime(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::IdentifyCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeIdentifyTime(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeIdentifyTime(PythonRequest::Bind(gInt16uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_Identify_IdentifyTime(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2744,7 +3068,8 @@ CHIP_ERROR chip_ime_WriteAttribute_Identify_IdentifyTime(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::IdentifyCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeIdentifyTime(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeIdentifyTime(PythonRequest::Bind(gDefaultSuccessCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_Identify_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                            chip::GroupId /* ZCLgroupId */)
@@ -2752,7 +3077,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Identify_ClusterRevision(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::IdentifyCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster Identify
@@ -2764,7 +3090,8 @@ CHIP_ERROR chip_ime_AppendCommand_KeypadInput_SendKey(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::KeypadInputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SendKey(nullptr, nullptr, keyCode);
+    return cluster.SendKey(PythonRequest::BindResponse<KeypadInputClusterSendKeyResponseCallback>(),
+                           PythonRequest::BindIfPending(gDefaultFailureCallback), keyCode);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_KeypadInput_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2773,7 +3100,8 @@ CHIP_ERROR chip_ime_ReadAttribute_KeypadInput_ClusterRevision(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::KeypadInputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster KeypadInput
@@ -2786,7 +3114,8 @@ CHIP_ERROR chip_ime_AppendCommand_LevelControl_Move(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LevelControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.Move(nullptr, nullptr, moveMode, rate, optionMask, optionOverride);
+    return cluster.Move(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                        PythonRequest::BindIfPending(gDefaultFailureCallback), moveMode, rate, optionMask, optionOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_LevelControl_MoveToLevel(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                            chip::GroupId, uint8_t level, uint16_t transitionTime,
@@ -2795,7 +3124,9 @@ CHIP_ERROR chip_ime_AppendCommand_LevelControl_MoveToLevel(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LevelControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveToLevel(nullptr, nullptr, level, transitionTime, optionMask, optionOverride);
+    return cluster.MoveToLevel(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback), level, transitionTime, optionMask,
+                               optionOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_LevelControl_MoveToLevelWithOnOff(chip::Controller::Device * device,
                                                                     chip::EndpointId ZCLendpointId, chip::GroupId, uint8_t level,
@@ -2804,7 +3135,8 @@ CHIP_ERROR chip_ime_AppendCommand_LevelControl_MoveToLevelWithOnOff(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LevelControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveToLevelWithOnOff(nullptr, nullptr, level, transitionTime);
+    return cluster.MoveToLevelWithOnOff(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                        PythonRequest::BindIfPending(gDefaultFailureCallback), level, transitionTime);
 }
 CHIP_ERROR chip_ime_AppendCommand_LevelControl_MoveWithOnOff(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                              chip::GroupId, uint8_t moveMode, uint8_t rate)
@@ -2812,7 +3144,8 @@ CHIP_ERROR chip_ime_AppendCommand_LevelControl_MoveWithOnOff(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LevelControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MoveWithOnOff(nullptr, nullptr, moveMode, rate);
+    return cluster.MoveWithOnOff(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback), moveMode, rate);
 }
 CHIP_ERROR chip_ime_AppendCommand_LevelControl_Step(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                     chip::GroupId, uint8_t stepMode, uint8_t stepSize, uint16_t transitionTime,
@@ -2821,7 +3154,9 @@ CHIP_ERROR chip_ime_AppendCommand_LevelControl_Step(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LevelControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.Step(nullptr, nullptr, stepMode, stepSize, transitionTime, optionMask, optionOverride);
+    return cluster.Step(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                        PythonRequest::BindIfPending(gDefaultFailureCallback), stepMode, stepSize, transitionTime, optionMask,
+                        optionOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_LevelControl_StepWithOnOff(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                              chip::GroupId, uint8_t stepMode, uint8_t stepSize,
@@ -2830,7 +3165,8 @@ CHIP_ERROR chip_ime_AppendCommand_LevelControl_StepWithOnOff(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LevelControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.StepWithOnOff(nullptr, nullptr, stepMode, stepSize, transitionTime);
+    return cluster.StepWithOnOff(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback), stepMode, stepSize, transitionTime);
 }
 CHIP_ERROR chip_ime_AppendCommand_LevelControl_Stop(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                     chip::GroupId, uint8_t optionMask, uint8_t optionOverride)
@@ -2838,7 +3174,8 @@ CHIP_ERROR chip_ime_AppendCommand_LevelControl_Stop(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LevelControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.Stop(nullptr, nullptr, optionMask, optionOverride);
+    return cluster.Stop(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                        PythonRequest::BindIfPending(gDefaultFailureCallback), optionMask, optionOverride);
 }
 CHIP_ERROR chip_ime_AppendCommand_LevelControl_StopWithOnOff(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                              chip::GroupId)
@@ -2846,7 +3183,8 @@ CHIP_ERROR chip_ime_AppendCommand_LevelControl_StopWithOnOff(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LevelControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.StopWithOnOff(nullptr, nullptr);
+    return cluster.StopWithOnOff(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_LevelControl_CurrentLevel(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2855,7 +3193,8 @@ CHIP_ERROR chip_ime_ReadAttribute_LevelControl_CurrentLevel(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LevelControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentLevel(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentLevel(PythonRequest::Bind(gInt8uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_LevelControl_CurrentLevel(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2864,8 +3203,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_LevelControl_CurrentLevel(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LevelControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeCurrentLevel(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                                  maxInterval, change);
+    return cluster.ConfigureAttributeCurrentLevel(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_LevelControl_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2874,7 +3213,8 @@ CHIP_ERROR chip_ime_ReadAttribute_LevelControl_ClusterRevision(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LevelControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster LevelControl
@@ -2885,7 +3225,8 @@ CHIP_ERROR chip_ime_AppendCommand_LowPower_Sleep(chip::Controller::Device * devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LowPowerCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.Sleep(nullptr, nullptr);
+    return cluster.Sleep(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                         PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_LowPower_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2894,7 +3235,8 @@ CHIP_ERROR chip_ime_ReadAttribute_LowPower_ClusterRevision(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::LowPowerCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster LowPower
@@ -2906,7 +3248,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaInput_HideInputStatus(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaInputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.HideInputStatus(nullptr, nullptr);
+    return cluster.HideInputStatus(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                   PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaInput_RenameInput(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                          chip::GroupId, uint8_t index, const uint8_t * name, uint32_t name_Len)
@@ -2914,7 +3257,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaInput_RenameInput(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaInputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RenameInput(nullptr, nullptr, index, chip::ByteSpan(name, name_Len));
+    return cluster.RenameInput(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback), index, chip::ByteSpan(name, name_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaInput_SelectInput(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                          chip::GroupId, uint8_t index)
@@ -2922,7 +3266,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaInput_SelectInput(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaInputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SelectInput(nullptr, nullptr, index);
+    return cluster.SelectInput(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback), index);
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaInput_ShowInputStatus(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                              chip::GroupId)
@@ -2930,7 +3275,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaInput_ShowInputStatus(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaInputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ShowInputStatus(nullptr, nullptr);
+    return cluster.ShowInputStatus(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                   PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_MediaInput_MediaInputList(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2939,8 +3285,8 @@ CHIP_ERROR chip_ime_ReadAttribute_MediaInput_MediaInputList(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaInputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMediaInputList(gMediaInputMediaInputListListAttributeCallback.Cancel(),
-                                               gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMediaInputList(PythonRequest::Bind(gMediaInputMediaInputListListAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_MediaInput_CurrentMediaInput(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2949,7 +3295,8 @@ CHIP_ERROR chip_ime_ReadAttribute_MediaInput_CurrentMediaInput(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaInputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentMediaInput(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentMediaInput(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_MediaInput_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -2958,7 +3305,8 @@ CHIP_ERROR chip_ime_ReadAttribute_MediaInput_ClusterRevision(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaInputCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster MediaInput
@@ -2970,7 +3318,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaFastForward(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MediaFastForward(nullptr, nullptr);
+    return cluster.MediaFastForward(PythonRequest::BindResponse<MediaPlaybackClusterMediaFastForwardResponseCallback>(),
+                                    PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaNext(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                           chip::GroupId)
@@ -2978,7 +3327,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaNext(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MediaNext(nullptr, nullptr);
+    return cluster.MediaNext(PythonRequest::BindResponse<MediaPlaybackClusterMediaNextResponseCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaPause(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                            chip::GroupId)
@@ -2986,7 +3336,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaPause(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MediaPause(nullptr, nullptr);
+    return cluster.MediaPause(PythonRequest::BindResponse<MediaPlaybackClusterMediaPauseResponseCallback>(),
+                              PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaPlay(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                           chip::GroupId)
@@ -2994,7 +3345,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaPlay(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MediaPlay(nullptr, nullptr);
+    return cluster.MediaPlay(PythonRequest::BindResponse<MediaPlaybackClusterMediaPlayResponseCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaPrevious(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                               chip::GroupId)
@@ -3002,7 +3354,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaPrevious(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MediaPrevious(nullptr, nullptr);
+    return cluster.MediaPrevious(PythonRequest::BindResponse<MediaPlaybackClusterMediaPreviousResponseCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaRewind(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId)
@@ -3010,7 +3363,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaRewind(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MediaRewind(nullptr, nullptr);
+    return cluster.MediaRewind(PythonRequest::BindResponse<MediaPlaybackClusterMediaRewindResponseCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaSeek(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                           chip::GroupId, uint64_t position)
@@ -3018,7 +3372,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaSeek(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MediaSeek(nullptr, nullptr, position);
+    return cluster.MediaSeek(PythonRequest::BindResponse<MediaPlaybackClusterMediaSeekResponseCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback), position);
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaSkipBackward(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                   chip::GroupId, uint64_t deltaPositionMilliseconds)
@@ -3026,7 +3381,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaSkipBackward(chip::Controll
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MediaSkipBackward(nullptr, nullptr, deltaPositionMilliseconds);
+    return cluster.MediaSkipBackward(PythonRequest::BindResponse<MediaPlaybackClusterMediaSkipBackwardResponseCallback>(),
+                                     PythonRequest::BindIfPending(gDefaultFailureCallback), deltaPositionMilliseconds);
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaSkipForward(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                  chip::GroupId, uint64_t deltaPositionMilliseconds)
@@ -3034,7 +3390,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaSkipForward(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MediaSkipForward(nullptr, nullptr, deltaPositionMilliseconds);
+    return cluster.MediaSkipForward(PythonRequest::BindResponse<MediaPlaybackClusterMediaSkipForwardResponseCallback>(),
+                                    PythonRequest::BindIfPending(gDefaultFailureCallback), deltaPositionMilliseconds);
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaStartOver(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                chip::GroupId)
@@ -3042,7 +3399,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaStartOver(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MediaStartOver(nullptr, nullptr);
+    return cluster.MediaStartOver(PythonRequest::BindResponse<MediaPlaybackClusterMediaStartOverResponseCallback>(),
+                                  PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaStop(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                           chip::GroupId)
@@ -3050,7 +3408,8 @@ CHIP_ERROR chip_ime_AppendCommand_MediaPlayback_MediaStop(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.MediaStop(nullptr, nullptr);
+    return cluster.MediaStop(PythonRequest::BindResponse<MediaPlaybackClusterMediaStopResponseCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_MediaPlayback_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3059,7 +3418,8 @@ CHIP_ERROR chip_ime_ReadAttribute_MediaPlayback_ClusterRevision(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::MediaPlaybackCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster MediaPlayback
@@ -3074,8 +3434,9 @@ CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_AddThreadNetwork(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::NetworkCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.AddThreadNetwork(nullptr, nullptr, chip::ByteSpan(operationalDataset, operationalDataset_Len), breadcrumb,
-                                    timeoutMs);
+    return cluster.AddThreadNetwork(PythonRequest::BindResponse<NetworkCommissioningClusterAddThreadNetworkResponseCallback>(),
+                                    PythonRequest::BindIfPending(gDefaultFailureCallback),
+                                    chip::ByteSpan(operationalDataset, operationalDataset_Len), breadcrumb, timeoutMs);
 }
 CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_AddWiFiNetwork(chip::Controller::Device * device,
                                                                       chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3086,8 +3447,9 @@ CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_AddWiFiNetwork(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::NetworkCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.AddWiFiNetwork(nullptr, nullptr, chip::ByteSpan(ssid, ssid_Len), chip::ByteSpan(credentials, credentials_Len),
-                                  breadcrumb, timeoutMs);
+    return cluster.AddWiFiNetwork(PythonRequest::BindResponse<NetworkCommissioningClusterAddWiFiNetworkResponseCallback>(),
+                                  PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(ssid, ssid_Len),
+                                  chip::ByteSpan(credentials, credentials_Len), breadcrumb, timeoutMs);
 }
 CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_DisableNetwork(chip::Controller::Device * device,
                                                                       chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3097,7 +3459,9 @@ CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_DisableNetwork(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::NetworkCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.DisableNetwork(nullptr, nullptr, chip::ByteSpan(networkID, networkID_Len), breadcrumb, timeoutMs);
+    return cluster.DisableNetwork(PythonRequest::BindResponse<NetworkCommissioningClusterDisableNetworkResponseCallback>(),
+                                  PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(networkID, networkID_Len),
+                                  breadcrumb, timeoutMs);
 }
 CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_EnableNetwork(chip::Controller::Device * device,
                                                                      chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3107,7 +3471,9 @@ CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_EnableNetwork(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::NetworkCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.EnableNetwork(nullptr, nullptr, chip::ByteSpan(networkID, networkID_Len), breadcrumb, timeoutMs);
+    return cluster.EnableNetwork(PythonRequest::BindResponse<NetworkCommissioningClusterEnableNetworkResponseCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(networkID, networkID_Len),
+                                 breadcrumb, timeoutMs);
 }
 CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_GetLastNetworkCommissioningResult(chip::Controller::Device * device,
                                                                                          chip::EndpointId ZCLendpointId,
@@ -3116,7 +3482,8 @@ CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_GetLastNetworkCommissioni
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::NetworkCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetLastNetworkCommissioningResult(nullptr, nullptr, timeoutMs);
+    return cluster.GetLastNetworkCommissioningResult(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                                     PythonRequest::BindIfPending(gDefaultFailureCallback), timeoutMs);
 }
 CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_RemoveNetwork(chip::Controller::Device * device,
                                                                      chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3126,7 +3493,9 @@ CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_RemoveNetwork(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::NetworkCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RemoveNetwork(nullptr, nullptr, chip::ByteSpan(networkID, networkID_Len), breadcrumb, timeoutMs);
+    return cluster.RemoveNetwork(PythonRequest::BindResponse<NetworkCommissioningClusterRemoveNetworkResponseCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(networkID, networkID_Len),
+                                 breadcrumb, timeoutMs);
 }
 CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_ScanNetworks(chip::Controller::Device * device,
                                                                     chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3136,7 +3505,9 @@ CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_ScanNetworks(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::NetworkCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ScanNetworks(nullptr, nullptr, chip::ByteSpan(ssid, ssid_Len), breadcrumb, timeoutMs);
+    return cluster.ScanNetworks(PythonRequest::BindResponse<NetworkCommissioningClusterScanNetworksResponseCallback>(),
+                                PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(ssid, ssid_Len), breadcrumb,
+                                timeoutMs);
 }
 CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_UpdateThreadNetwork(chip::Controller::Device * device,
                                                                            chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3147,8 +3518,10 @@ CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_UpdateThreadNetwork(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::NetworkCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.UpdateThreadNetwork(nullptr, nullptr, chip::ByteSpan(operationalDataset, operationalDataset_Len), breadcrumb,
-                                       timeoutMs);
+    return cluster.UpdateThreadNetwork(
+            PythonRequest::BindResponse<NetworkCommissioningClusterUpdateThreadNetworkResponseCallback>(),
+            PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(operationalDataset, operationalDataset_Len),
+            breadcrumb, timeoutMs);
 }
 CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_UpdateWiFiNetwork(chip::Controller::Device * device,
                                                                          chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3159,8 +3532,9 @@ CHIP_ERROR chip_ime_AppendCommand_NetworkCommissioning_UpdateWiFiNetwork(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::NetworkCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.UpdateWiFiNetwork(nullptr, nullptr, chip::ByteSpan(ssid, ssid_Len), chip::ByteSpan(credentials, credentials_Len),
-                                     breadcrumb, timeoutMs);
+    return cluster.UpdateWiFiNetwork(PythonRequest::BindResponse<NetworkCommissioningClusterUpdateWiFiNetworkResponseCallback>(),
+                                     PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(ssid, ssid_Len),
+                                     chip::ByteSpan(credentials, credentials_Len), breadcrumb, timeoutMs);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_NetworkCommissioning_ClusterRevision(chip::Controller::Device * device,
@@ -3170,7 +3544,8 @@ CHIP_ERROR chip_ime_ReadAttribute_NetworkCommissioning_ClusterRevision(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::NetworkCommissioningCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster NetworkCommissioning
@@ -3184,7 +3559,9 @@ CHIP_ERROR chip_ime_AppendCommand_OtaSoftwareUpdateProvider_ApplyUpdateRequest(c
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OtaSoftwareUpdateProviderCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ApplyUpdateRequest(nullptr, nullptr, chip::ByteSpan(updateToken, updateToken_Len), newVersion);
+    return cluster.ApplyUpdateRequest(
+            PythonRequest::BindResponse<OtaSoftwareUpdateProviderClusterApplyUpdateRequestResponseCallback>(),
+            PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(updateToken, updateToken_Len), newVersion);
 }
 CHIP_ERROR chip_ime_AppendCommand_OtaSoftwareUpdateProvider_NotifyUpdateApplied(chip::Controller::Device * device,
                                                                                 chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3194,7 +3571,9 @@ CHIP_ERROR chip_ime_AppendCommand_OtaSoftwareUpdateProvider_NotifyUpdateApplied(
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OtaSoftwareUpdateProviderCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.NotifyUpdateApplied(nullptr, nullptr, chip::ByteSpan(updateToken, updateToken_Len), currentVersion);
+    return cluster.NotifyUpdateApplied(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                       PythonRequest::BindIfPending(gDefaultFailureCallback),
+                                       chip::ByteSpan(updateToken, updateToken_Len), currentVersion);
 }
 CHIP_ERROR chip_ime_AppendCommand_OtaSoftwareUpdateProvider_QueryImage(
     chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId, uint16_t vendorId, uint16_t productId,
@@ -3204,9 +3583,10 @@ CHIP_ERROR chip_ime_AppendCommand_OtaSoftwareUpdateProvider_QueryImage(
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OtaSoftwareUpdateProviderCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.QueryImage(nullptr, nullptr, vendorId, productId, imageType, hardwareVersion, currentVersion, protocolsSupported,
-                              chip::ByteSpan(location, location_Len), requestorCanConsent,
-                              chip::ByteSpan(metadataForProvider, metadataForProvider_Len));
+    return cluster.QueryImage(PythonRequest::BindResponse<OtaSoftwareUpdateProviderClusterQueryImageResponseCallback>(),
+                              PythonRequest::BindIfPending(gDefaultFailureCallback), vendorId, productId, imageType,
+                              hardwareVersion, currentVersion, protocolsSupported, chip::ByteSpan(location, location_Len),
+                              requestorCanConsent, chip::ByteSpan(metadataForProvider, metadataForProvider_Len));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_OtaSoftwareUpdateProvider_ClusterRevision(chip::Controller::Device * device,
@@ -3216,7 +3596,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OtaSoftwareUpdateProvider_ClusterRevision(chip
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OtaSoftwareUpdateProviderCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster OtaSoftwareUpdateProvider
@@ -3228,7 +3609,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OccupancySensing_Occupancy(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OccupancySensingCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOccupancy(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOccupancy(PythonRequest::Bind(gInt8uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_OccupancySensing_Occupancy(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3237,8 +3619,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_OccupancySensing_Occupancy(chip::Controll
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OccupancySensingCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeOccupancy(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                               maxInterval);
+    return cluster.ConfigureAttributeOccupancy(PythonRequest::Bind(gInt8uAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_OccupancySensing_OccupancySensorType(chip::Controller::Device * device,
@@ -3248,7 +3630,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OccupancySensing_OccupancySensorType(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OccupancySensingCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOccupancySensorType(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOccupancySensorType(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                    PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_OccupancySensing_OccupancySensorTypeBitmap(chip::Controller::Device * device,
@@ -3258,7 +3641,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OccupancySensing_OccupancySensorTypeBitmap(chi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OccupancySensingCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOccupancySensorTypeBitmap(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOccupancySensorTypeBitmap(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_OccupancySensing_ClusterRevision(chip::Controller::Device * device,
@@ -3267,7 +3651,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OccupancySensing_ClusterRevision(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OccupancySensingCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster OccupancySensing
@@ -3278,21 +3663,23 @@ CHIP_ERROR chip_ime_AppendCommand_OnOff_Off(chip::Controller::Device * device, c
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.Off(nullptr, nullptr);
+    return cluster.Off(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                       PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_OnOff_On(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId)
 {
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.On(nullptr, nullptr);
+    return cluster.On(PythonRequest::BindResponse<DefaultSuccessCallback>(), PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_OnOff_Toggle(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId)
 {
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.Toggle(nullptr, nullptr);
+    return cluster.Toggle(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                          PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_OnOff_OnOff(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3301,7 +3688,7 @@ CHIP_ERROR chip_ime_ReadAttribute_OnOff_OnOff(chip::Controller::Device * device,
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOnOff(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOnOff(PythonRequest::Bind(gBooleanAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_OnOff_OnOff(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3310,8 +3697,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_OnOff_OnOff(chip::Controller::Device * de
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeOnOff(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                           maxInterval);
+    return cluster.ConfigureAttributeOnOff(PythonRequest::Bind(gBooleanAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_OnOff_GlobalSceneControl(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3320,7 +3707,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OnOff_GlobalSceneControl(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeGlobalSceneControl(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeGlobalSceneControl(PythonRequest::Bind(gBooleanAttributeCallback),
+                                                   PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_OnOff_OnTime(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3329,7 +3717,7 @@ CHIP_ERROR chip_ime_ReadAttribute_OnOff_OnTime(chip::Controller::Device * device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOnTime(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOnTime(PythonRequest::Bind(gInt16uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_OnOff_OnTime(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3338,7 +3726,8 @@ CHIP_ERROR chip_ime_WriteAttribute_OnOff_OnTime(chip::Controller::Device * devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeOnTime(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeOnTime(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                        value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_OnOff_OffWaitTime(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                     chip::GroupId /* ZCLgroupId */)
@@ -3346,7 +3735,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OnOff_OffWaitTime(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOffWaitTime(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOffWaitTime(PythonRequest::Bind(gInt16uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_OnOff_OffWaitTime(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3355,7 +3745,8 @@ CHIP_ERROR chip_ime_WriteAttribute_OnOff_OffWaitTime(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeOffWaitTime(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeOffWaitTime(PythonRequest::Bind(gDefaultSuccessCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_OnOff_StartUpOnOff(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId /* ZCLgroupId */)
@@ -3363,7 +3754,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OnOff_StartUpOnOff(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeStartUpOnOff(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeStartUpOnOff(PythonRequest::Bind(gInt8uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_OnOff_StartUpOnOff(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3372,7 +3764,8 @@ CHIP_ERROR chip_ime_WriteAttribute_OnOff_StartUpOnOff(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeStartUpOnOff(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeStartUpOnOff(PythonRequest::Bind(gDefaultSuccessCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_OnOff_FeatureMap(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                    chip::GroupId /* ZCLgroupId */)
@@ -3380,7 +3773,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OnOff_FeatureMap(chip::Controller::Device * de
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeFeatureMap(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeFeatureMap(PythonRequest::Bind(gInt32uAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_OnOff_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3389,7 +3783,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OnOff_ClusterRevision(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OnOffCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster OnOff
@@ -3404,8 +3799,9 @@ CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_AddOpCert(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OperationalCredentialsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.AddOpCert(nullptr, nullptr, chip::ByteSpan(nOCArray, nOCArray_Len), chip::ByteSpan(iPKValue, iPKValue_Len),
-                             caseAdminNode, adminVendorId);
+    return cluster.AddOpCert(PythonRequest::BindResponse<OperationalCredentialsClusterOpCertResponseCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(nOCArray, nOCArray_Len),
+                             chip::ByteSpan(iPKValue, iPKValue_Len), caseAdminNode, adminVendorId);
 }
 CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_AddTrustedRootCertificate(chip::Controller::Device * device,
                                                                                    chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3415,7 +3811,9 @@ CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_AddTrustedRootCertifica
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OperationalCredentialsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.AddTrustedRootCertificate(nullptr, nullptr, chip::ByteSpan(rootCertificate, rootCertificate_Len));
+    return cluster.AddTrustedRootCertificate(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                             PythonRequest::BindIfPending(gDefaultFailureCallback),
+                                             chip::ByteSpan(rootCertificate, rootCertificate_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_OpCSRRequest(chip::Controller::Device * device,
                                                                       chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3424,7 +3822,8 @@ CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_OpCSRRequest(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OperationalCredentialsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.OpCSRRequest(nullptr, nullptr, chip::ByteSpan(cSRNonce, cSRNonce_Len));
+    return cluster.OpCSRRequest(PythonRequest::BindResponse<OperationalCredentialsClusterOpCSRResponseCallback>(),
+                                PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(cSRNonce, cSRNonce_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_RemoveAllFabrics(chip::Controller::Device * device,
                                                                           chip::EndpointId ZCLendpointId, chip::GroupId)
@@ -3432,7 +3831,8 @@ CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_RemoveAllFabrics(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OperationalCredentialsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RemoveAllFabrics(nullptr, nullptr);
+    return cluster.RemoveAllFabrics(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                    PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_RemoveFabric(chip::Controller::Device * device,
                                                                       chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3442,7 +3842,8 @@ CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_RemoveFabric(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OperationalCredentialsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RemoveFabric(nullptr, nullptr, fabricId, nodeId, vendorId);
+    return cluster.RemoveFabric(PythonRequest::BindResponse<OperationalCredentialsClusterOpCertResponseCallback>(),
+                                PythonRequest::BindIfPending(gDefaultFailureCallback), fabricId, nodeId, vendorId);
 }
 CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_RemoveTrustedRootCertificate(chip::Controller::Device * device,
                                                                                       chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3452,7 +3853,9 @@ CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_RemoveTrustedRootCertif
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OperationalCredentialsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RemoveTrustedRootCertificate(nullptr, nullptr, chip::ByteSpan(trustedRootIdentifier, trustedRootIdentifier_Len));
+    return cluster.RemoveTrustedRootCertificate(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                                PythonRequest::BindIfPending(gDefaultFailureCallback),
+                                                chip::ByteSpan(trustedRootIdentifier, trustedRootIdentifier_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_SetFabric(chip::Controller::Device * device,
                                                                    chip::EndpointId ZCLendpointId, chip::GroupId, uint16_t vendorId)
@@ -3460,7 +3863,8 @@ CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_SetFabric(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OperationalCredentialsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SetFabric(nullptr, nullptr, vendorId);
+    return cluster.SetFabric(PythonRequest::BindResponse<OperationalCredentialsClusterSetFabricResponseCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback), vendorId);
 }
 CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_UpdateFabricLabel(chip::Controller::Device * device,
                                                                            chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -3469,7 +3873,8 @@ CHIP_ERROR chip_ime_AppendCommand_OperationalCredentials_UpdateFabricLabel(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OperationalCredentialsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.UpdateFabricLabel(nullptr, nullptr, chip::ByteSpan(label, label_Len));
+    return cluster.UpdateFabricLabel(PythonRequest::BindResponse<OperationalCredentialsClusterOpCertResponseCallback>(),
+                                     PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(label, label_Len));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_OperationalCredentials_FabricsList(chip::Controller::Device * device,
@@ -3478,8 +3883,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OperationalCredentials_FabricsList(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OperationalCredentialsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeFabricsList(gOperationalCredentialsFabricsListListAttributeCallback.Cancel(),
-                                            gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeFabricsList(PythonRequest::Bind(gOperationalCredentialsFabricsListListAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_OperationalCredentials_ClusterRevision(chip::Controller::Device * device,
@@ -3489,7 +3894,8 @@ CHIP_ERROR chip_ime_ReadAttribute_OperationalCredentials_ClusterRevision(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::OperationalCredentialsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster OperationalCredentials
@@ -3501,7 +3907,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PressureMeasurement_MeasuredValue(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PressureMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMeasuredValue(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMeasuredValue(PythonRequest::Bind(gInt16sAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_PressureMeasurement_MeasuredValue(chip::Controller::Device * device,
@@ -3511,8 +3918,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_PressureMeasurement_MeasuredValue(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PressureMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeMeasuredValue(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                                   maxInterval, change);
+    return cluster.ConfigureAttributeMeasuredValue(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                   PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_PressureMeasurement_MinMeasuredValue(chip::Controller::Device * device,
@@ -3522,7 +3929,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PressureMeasurement_MinMeasuredValue(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PressureMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMinMeasuredValue(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMinMeasuredValue(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_PressureMeasurement_MaxMeasuredValue(chip::Controller::Device * device,
@@ -3532,7 +3940,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PressureMeasurement_MaxMeasuredValue(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PressureMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMaxMeasuredValue(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMaxMeasuredValue(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_PressureMeasurement_ClusterRevision(chip::Controller::Device * device,
@@ -3542,7 +3951,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PressureMeasurement_ClusterRevision(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PressureMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster PressureMeasurement
@@ -3555,7 +3965,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_MaxPressure(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PumpConfigurationAndControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMaxPressure(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMaxPressure(PythonRequest::Bind(gInt16sAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_MaxSpeed(chip::Controller::Device * device,
@@ -3565,7 +3976,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_MaxSpeed(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PumpConfigurationAndControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMaxSpeed(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMaxSpeed(PythonRequest::Bind(gInt16uAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_MaxFlow(chip::Controller::Device * device,
@@ -3575,7 +3987,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_MaxFlow(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PumpConfigurationAndControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMaxFlow(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMaxFlow(PythonRequest::Bind(gInt16uAttributeCallback),
+                                        PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_EffectiveOperationMode(chip::Controller::Device * device,
@@ -3585,7 +3998,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_EffectiveOperation
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PumpConfigurationAndControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeEffectiveOperationMode(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeEffectiveOperationMode(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                       PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_EffectiveControlMode(chip::Controller::Device * device,
@@ -3595,7 +4009,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_EffectiveControlMo
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PumpConfigurationAndControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeEffectiveControlMode(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeEffectiveControlMode(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                     PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_Capacity(chip::Controller::Device * device,
@@ -3605,7 +4020,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_Capacity(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PumpConfigurationAndControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCapacity(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCapacity(PythonRequest::Bind(gInt16sAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_PumpConfigurationAndControl_Capacity(chip::Controller::Device * device,
@@ -3615,8 +4031,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_PumpConfigurationAndControl_Capacity(chip
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PumpConfigurationAndControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeCapacity(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                              maxInterval, change);
+    return cluster.ConfigureAttributeCapacity(PythonRequest::Bind(gInt16sAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_OperationMode(chip::Controller::Device * device,
@@ -3626,7 +4042,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_OperationMode(chip
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PumpConfigurationAndControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOperationMode(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOperationMode(PythonRequest::Bind(gInt8uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_PumpConfigurationAndControl_OperationMode(chip::Controller::Device * device,
@@ -3636,7 +4053,8 @@ CHIP_ERROR chip_ime_WriteAttribute_PumpConfigurationAndControl_OperationMode(chi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PumpConfigurationAndControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeOperationMode(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeOperationMode(PythonRequest::Bind(gDefaultSuccessCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_ClusterRevision(chip::Controller::Device * device,
                                                                               chip::EndpointId ZCLendpointId,
@@ -3645,7 +4063,8 @@ CHIP_ERROR chip_ime_ReadAttribute_PumpConfigurationAndControl_ClusterRevision(ch
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::PumpConfigurationAndControlCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster PumpConfigurationAndControl
@@ -3658,7 +4077,8 @@ CHIP_ERROR chip_ime_ReadAttribute_RelativeHumidityMeasurement_MeasuredValue(chip
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::RelativeHumidityMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMeasuredValue(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMeasuredValue(PythonRequest::Bind(gInt16uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_RelativeHumidityMeasurement_MeasuredValue(chip::Controller::Device * device,
@@ -3669,8 +4089,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_RelativeHumidityMeasurement_MeasuredValue
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::RelativeHumidityMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeMeasuredValue(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                                   maxInterval, change);
+    return cluster.ConfigureAttributeMeasuredValue(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                   PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_RelativeHumidityMeasurement_MinMeasuredValue(chip::Controller::Device * device,
@@ -3680,7 +4100,8 @@ CHIP_ERROR chip_ime_ReadAttribute_RelativeHumidityMeasurement_MinMeasuredValue(c
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::RelativeHumidityMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMinMeasuredValue(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMinMeasuredValue(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_RelativeHumidityMeasurement_MaxMeasuredValue(chip::Controller::Device * device,
@@ -3690,7 +4111,8 @@ CHIP_ERROR chip_ime_ReadAttribute_RelativeHumidityMeasurement_MaxMeasuredValue(c
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::RelativeHumidityMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMaxMeasuredValue(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMaxMeasuredValue(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_RelativeHumidityMeasurement_ClusterRevision(chip::Controller::Device * device,
@@ -3700,7 +4122,8 @@ CHIP_ERROR chip_ime_ReadAttribute_RelativeHumidityMeasurement_ClusterRevision(ch
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::RelativeHumidityMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster RelativeHumidityMeasurement
@@ -3714,8 +4137,9 @@ CHIP_ERROR chip_ime_AppendCommand_Scenes_AddScene(chip::Controller::Device * dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.AddScene(nullptr, nullptr, groupId, sceneId, transitionTime, chip::ByteSpan(sceneName, sceneName_Len), clusterId,
-                            length, value);
+    return cluster.AddScene(PythonRequest::BindResponse<ScenesClusterAddSceneResponseCallback>(),
+                            PythonRequest::BindIfPending(gDefaultFailureCallback), groupId, sceneId, transitionTime,
+                            chip::ByteSpan(sceneName, sceneName_Len), clusterId, length, value);
 }
 CHIP_ERROR chip_ime_AppendCommand_Scenes_GetSceneMembership(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId, uint16_t groupId)
@@ -3723,7 +4147,8 @@ CHIP_ERROR chip_ime_AppendCommand_Scenes_GetSceneMembership(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetSceneMembership(nullptr, nullptr, groupId);
+    return cluster.GetSceneMembership(PythonRequest::BindResponse<ScenesClusterGetSceneMembershipResponseCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback), groupId);
 }
 CHIP_ERROR chip_ime_AppendCommand_Scenes_RecallScene(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId, uint16_t groupId, uint8_t sceneId, uint16_t transitionTime)
@@ -3731,7 +4156,8 @@ CHIP_ERROR chip_ime_AppendCommand_Scenes_RecallScene(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RecallScene(nullptr, nullptr, groupId, sceneId, transitionTime);
+    return cluster.RecallScene(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback), groupId, sceneId, transitionTime);
 }
 CHIP_ERROR chip_ime_AppendCommand_Scenes_RemoveAllScenes(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                          chip::GroupId, uint16_t groupId)
@@ -3739,7 +4165,8 @@ CHIP_ERROR chip_ime_AppendCommand_Scenes_RemoveAllScenes(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RemoveAllScenes(nullptr, nullptr, groupId);
+    return cluster.RemoveAllScenes(PythonRequest::BindResponse<ScenesClusterRemoveAllScenesResponseCallback>(),
+                                   PythonRequest::BindIfPending(gDefaultFailureCallback), groupId);
 }
 CHIP_ERROR chip_ime_AppendCommand_Scenes_RemoveScene(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId, uint16_t groupId, uint8_t sceneId)
@@ -3747,7 +4174,8 @@ CHIP_ERROR chip_ime_AppendCommand_Scenes_RemoveScene(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.RemoveScene(nullptr, nullptr, groupId, sceneId);
+    return cluster.RemoveScene(PythonRequest::BindResponse<ScenesClusterRemoveSceneResponseCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback), groupId, sceneId);
 }
 CHIP_ERROR chip_ime_AppendCommand_Scenes_StoreScene(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                     chip::GroupId, uint16_t groupId, uint8_t sceneId)
@@ -3755,7 +4183,8 @@ CHIP_ERROR chip_ime_AppendCommand_Scenes_StoreScene(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.StoreScene(nullptr, nullptr, groupId, sceneId);
+    return cluster.StoreScene(PythonRequest::BindResponse<ScenesClusterStoreSceneResponseCallback>(),
+                              PythonRequest::BindIfPending(gDefaultFailureCallback), groupId, sceneId);
 }
 CHIP_ERROR chip_ime_AppendCommand_Scenes_ViewScene(chip::Controller::Device * device, chip::EndpointId ZCLendpointId, chip::GroupId,
                                                    uint16_t groupId, uint8_t sceneId)
@@ -3763,7 +4192,8 @@ CHIP_ERROR chip_ime_AppendCommand_Scenes_ViewScene(chip::Controller::Device * de
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ViewScene(nullptr, nullptr, groupId, sceneId);
+    return cluster.ViewScene(PythonRequest::BindResponse<ScenesClusterViewSceneResponseCallback>(),
+                             PythonRequest::BindIfPending(gDefaultFailureCallback), groupId, sceneId);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Scenes_SceneCount(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3772,7 +4202,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Scenes_SceneCount(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSceneCount(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSceneCount(PythonRequest::Bind(gInt8uAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Scenes_CurrentScene(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3781,7 +4212,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Scenes_CurrentScene(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentScene(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentScene(PythonRequest::Bind(gInt8uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Scenes_CurrentGroup(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3790,7 +4222,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Scenes_CurrentGroup(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentGroup(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentGroup(PythonRequest::Bind(gInt16uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Scenes_SceneValid(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3799,7 +4232,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Scenes_SceneValid(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSceneValid(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSceneValid(PythonRequest::Bind(gBooleanAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Scenes_NameSupport(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3808,7 +4242,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Scenes_NameSupport(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeNameSupport(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeNameSupport(PythonRequest::Bind(gInt8uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Scenes_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3817,7 +4252,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Scenes_ClusterRevision(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ScenesCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster Scenes
@@ -3829,7 +4265,8 @@ CHIP_ERROR chip_ime_AppendCommand_SoftwareDiagnostics_ResetWatermarks(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::SoftwareDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ResetWatermarks(nullptr, nullptr);
+    return cluster.ResetWatermarks(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                   PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_SoftwareDiagnostics_CurrentHeapHighWatermark(chip::Controller::Device * device,
@@ -3839,7 +4276,8 @@ CHIP_ERROR chip_ime_ReadAttribute_SoftwareDiagnostics_CurrentHeapHighWatermark(c
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::SoftwareDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentHeapHighWatermark(gInt64uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentHeapHighWatermark(PythonRequest::Bind(gInt64uAttributeCallback),
+                                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_SoftwareDiagnostics_ClusterRevision(chip::Controller::Device * device,
@@ -3849,7 +4287,8 @@ CHIP_ERROR chip_ime_ReadAttribute_SoftwareDiagnostics_ClusterRevision(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::SoftwareDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster SoftwareDiagnostics
@@ -3861,7 +4300,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Switch_NumberOfPositions(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::SwitchCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeNumberOfPositions(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeNumberOfPositions(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Switch_CurrentPosition(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3870,7 +4310,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Switch_CurrentPosition(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::SwitchCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentPosition(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentPosition(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_Switch_CurrentPosition(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3879,8 +4320,9 @@ CHIP_ERROR chip_ime_ConfigureAttribute_Switch_CurrentPosition(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::SwitchCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeCurrentPosition(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                                     minInterval, maxInterval, change);
+    return cluster.ConfigureAttributeCurrentPosition(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                     PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval,
+                                                     change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Switch_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3889,7 +4331,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Switch_ClusterRevision(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::SwitchCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster Switch
@@ -3901,7 +4344,8 @@ CHIP_ERROR chip_ime_AppendCommand_TvChannel_ChangeChannel(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TvChannelCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ChangeChannel(nullptr, nullptr, chip::ByteSpan(match, match_Len));
+    return cluster.ChangeChannel(PythonRequest::BindResponse<TvChannelClusterChangeChannelResponseCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback), chip::ByteSpan(match, match_Len));
 }
 CHIP_ERROR chip_ime_AppendCommand_TvChannel_ChangeChannelByNumber(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                   chip::GroupId, uint16_t majorNumber, uint16_t minorNumber)
@@ -3909,7 +4353,8 @@ CHIP_ERROR chip_ime_AppendCommand_TvChannel_ChangeChannelByNumber(chip::Controll
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TvChannelCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ChangeChannelByNumber(nullptr, nullptr, majorNumber, minorNumber);
+    return cluster.ChangeChannelByNumber(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                         PythonRequest::BindIfPending(gDefaultFailureCallback), majorNumber, minorNumber);
 }
 CHIP_ERROR chip_ime_AppendCommand_TvChannel_SkipChannel(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                         chip::GroupId, uint16_t count)
@@ -3917,7 +4362,8 @@ CHIP_ERROR chip_ime_AppendCommand_TvChannel_SkipChannel(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TvChannelCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SkipChannel(nullptr, nullptr, count);
+    return cluster.SkipChannel(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback), count);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TvChannel_TvChannelList(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3926,8 +4372,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TvChannel_TvChannelList(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TvChannelCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTvChannelList(gTvChannelTvChannelListListAttributeCallback.Cancel(),
-                                              gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTvChannelList(PythonRequest::Bind(gTvChannelTvChannelListListAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TvChannel_TvChannelLineup(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3936,7 +4382,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TvChannel_TvChannelLineup(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TvChannelCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTvChannelLineup(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTvChannelLineup(PythonRequest::Bind(gStringAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TvChannel_CurrentTvChannel(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3945,7 +4392,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TvChannel_CurrentTvChannel(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TvChannelCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentTvChannel(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentTvChannel(PythonRequest::Bind(gStringAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TvChannel_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3954,7 +4402,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TvChannel_ClusterRevision(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TvChannelCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster TvChannel
@@ -3967,7 +4416,8 @@ CHIP_ERROR chip_ime_AppendCommand_TargetNavigator_NavigateTarget(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TargetNavigatorCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.NavigateTarget(nullptr, nullptr, target, chip::ByteSpan(data, data_Len));
+    return cluster.NavigateTarget(PythonRequest::BindResponse<TargetNavigatorClusterNavigateTargetResponseCallback>(),
+                                  PythonRequest::BindIfPending(gDefaultFailureCallback), target, chip::ByteSpan(data, data_Len));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TargetNavigator_TargetNavigatorList(chip::Controller::Device * device,
@@ -3977,8 +4427,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TargetNavigator_TargetNavigatorList(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TargetNavigatorCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTargetNavigatorList(gTargetNavigatorTargetNavigatorListListAttributeCallback.Cancel(),
-                                                    gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTargetNavigatorList(PythonRequest::Bind(gTargetNavigatorTargetNavigatorListListAttributeCallback),
+                                                    PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TargetNavigator_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -3987,7 +4437,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TargetNavigator_ClusterRevision(chip::Controll
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TargetNavigatorCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster TargetNavigator
@@ -4000,7 +4451,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TemperatureMeasurement_MeasuredValue(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TemperatureMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMeasuredValue(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMeasuredValue(PythonRequest::Bind(gInt16sAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_TemperatureMeasurement_MeasuredValue(chip::Controller::Device * device,
@@ -4010,8 +4462,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_TemperatureMeasurement_MeasuredValue(chip
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TemperatureMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeMeasuredValue(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                                   maxInterval, change);
+    return cluster.ConfigureAttributeMeasuredValue(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                   PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TemperatureMeasurement_MinMeasuredValue(chip::Controller::Device * device,
@@ -4021,7 +4473,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TemperatureMeasurement_MinMeasuredValue(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TemperatureMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMinMeasuredValue(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMinMeasuredValue(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TemperatureMeasurement_MaxMeasuredValue(chip::Controller::Device * device,
@@ -4031,7 +4484,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TemperatureMeasurement_MaxMeasuredValue(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TemperatureMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMaxMeasuredValue(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMaxMeasuredValue(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TemperatureMeasurement_ClusterRevision(chip::Controller::Device * device,
@@ -4041,7 +4495,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TemperatureMeasurement_ClusterRevision(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TemperatureMeasurementCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster TemperatureMeasurement
@@ -4052,7 +4507,8 @@ CHIP_ERROR chip_ime_AppendCommand_TestCluster_Test(chip::Controller::Device * de
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.Test(nullptr, nullptr);
+    return cluster.Test(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                        PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_TestCluster_TestNotHandled(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                              chip::GroupId)
@@ -4060,7 +4516,8 @@ CHIP_ERROR chip_ime_AppendCommand_TestCluster_TestNotHandled(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.TestNotHandled(nullptr, nullptr);
+    return cluster.TestNotHandled(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                  PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_TestCluster_TestSpecific(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                            chip::GroupId)
@@ -4068,7 +4525,8 @@ CHIP_ERROR chip_ime_AppendCommand_TestCluster_TestSpecific(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.TestSpecific(nullptr, nullptr);
+    return cluster.TestSpecific(PythonRequest::BindResponse<TestClusterClusterTestSpecificResponseCallback>(),
+                                PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_TestCluster_TestUnknownCommand(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                  chip::GroupId)
@@ -4076,7 +4534,8 @@ CHIP_ERROR chip_ime_AppendCommand_TestCluster_TestUnknownCommand(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.TestUnknownCommand(nullptr, nullptr);
+    return cluster.TestUnknownCommand(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Boolean(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4085,7 +4544,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Boolean(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBoolean(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBoolean(PythonRequest::Bind(gBooleanAttributeCallback),
+                                        PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Boolean(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4094,7 +4554,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Boolean(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeBoolean(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeBoolean(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                         value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Bitmap8(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                       chip::GroupId /* ZCLgroupId */)
@@ -4102,7 +4563,7 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Bitmap8(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBitmap8(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBitmap8(PythonRequest::Bind(gInt8uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Bitmap8(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4111,7 +4572,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Bitmap8(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeBitmap8(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeBitmap8(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                         value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Bitmap16(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                        chip::GroupId /* ZCLgroupId */)
@@ -4119,7 +4581,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Bitmap16(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBitmap16(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBitmap16(PythonRequest::Bind(gInt16uAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Bitmap16(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4128,7 +4591,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Bitmap16(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeBitmap16(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeBitmap16(PythonRequest::Bind(gDefaultSuccessCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Bitmap32(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                        chip::GroupId /* ZCLgroupId */)
@@ -4136,7 +4600,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Bitmap32(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBitmap32(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBitmap32(PythonRequest::Bind(gInt32uAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Bitmap32(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4145,7 +4610,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Bitmap32(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeBitmap32(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeBitmap32(PythonRequest::Bind(gDefaultSuccessCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Bitmap64(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                        chip::GroupId /* ZCLgroupId */)
@@ -4153,7 +4619,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Bitmap64(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBitmap64(gInt64uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBitmap64(PythonRequest::Bind(gInt64uAttributeCallback),
+                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Bitmap64(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4162,7 +4629,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Bitmap64(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeBitmap64(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeBitmap64(PythonRequest::Bind(gDefaultSuccessCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int8u(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                     chip::GroupId /* ZCLgroupId */)
@@ -4170,7 +4638,7 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int8u(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInt8u(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInt8u(PythonRequest::Bind(gInt8uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int8u(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4179,7 +4647,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int8u(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeInt8u(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeInt8u(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                       value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int16u(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId /* ZCLgroupId */)
@@ -4187,7 +4656,7 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int16u(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInt16u(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInt16u(PythonRequest::Bind(gInt16uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int16u(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4196,7 +4665,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int16u(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeInt16u(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeInt16u(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                        value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int32u(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId /* ZCLgroupId */)
@@ -4204,7 +4674,7 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int32u(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInt32u(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInt32u(PythonRequest::Bind(gInt32uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int32u(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4213,7 +4683,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int32u(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeInt32u(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeInt32u(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                        value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int64u(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId /* ZCLgroupId */)
@@ -4221,7 +4692,7 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int64u(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInt64u(gInt64uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInt64u(PythonRequest::Bind(gInt64uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int64u(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4230,7 +4701,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int64u(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeInt64u(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeInt64u(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                        value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int8s(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                     chip::GroupId /* ZCLgroupId */)
@@ -4238,7 +4710,7 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int8s(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInt8s(gInt8sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInt8s(PythonRequest::Bind(gInt8sAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int8s(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4247,7 +4719,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int8s(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeInt8s(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeInt8s(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                       value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int16s(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId /* ZCLgroupId */)
@@ -4255,7 +4728,7 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int16s(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInt16s(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInt16s(PythonRequest::Bind(gInt16sAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int16s(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4264,7 +4737,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int16s(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeInt16s(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeInt16s(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                        value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int32s(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId /* ZCLgroupId */)
@@ -4272,7 +4746,7 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int32s(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInt32s(gInt32sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInt32s(PythonRequest::Bind(gInt32sAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int32s(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4281,7 +4755,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int32s(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeInt32s(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeInt32s(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                        value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int64s(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId /* ZCLgroupId */)
@@ -4289,7 +4764,7 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Int64s(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInt64s(gInt64sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInt64s(PythonRequest::Bind(gInt64sAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int64s(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4298,7 +4773,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Int64s(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeInt64s(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeInt64s(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                        value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Enum8(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                     chip::GroupId /* ZCLgroupId */)
@@ -4306,7 +4782,7 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Enum8(chip::Controller::Device * d
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeEnum8(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeEnum8(PythonRequest::Bind(gInt8uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Enum8(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4315,7 +4791,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Enum8(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeEnum8(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeEnum8(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                       value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Enum16(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                      chip::GroupId /* ZCLgroupId */)
@@ -4323,7 +4800,7 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Enum16(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeEnum16(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeEnum16(PythonRequest::Bind(gInt16uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Enum16(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4332,7 +4809,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Enum16(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeEnum16(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeEnum16(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                        value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_OctetString(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                           chip::GroupId /* ZCLgroupId */)
@@ -4340,7 +4818,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_OctetString(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOctetString(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOctetString(PythonRequest::Bind(gStringAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_OctetString(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4349,8 +4828,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_OctetString(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeOctetString(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                             chip::ByteSpan(value, len));
+    return cluster.WriteAttributeOctetString(PythonRequest::Bind(gDefaultSuccessCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback), chip::ByteSpan(value, len));
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_ListInt8u(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                         chip::GroupId /* ZCLgroupId */)
@@ -4358,7 +4837,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_ListInt8u(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeListInt8u(gTestClusterListInt8uListAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeListInt8u(PythonRequest::Bind(gTestClusterListInt8uListAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_ListOctetString(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4367,8 +4847,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_ListOctetString(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeListOctetString(gTestClusterListOctetStringListAttributeCallback.Cancel(),
-                                                gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeListOctetString(PythonRequest::Bind(gTestClusterListOctetStringListAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_ListStructOctetString(chip::Controller::Device * device,
@@ -4377,8 +4857,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_ListStructOctetString(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeListStructOctetString(gTestClusterListStructOctetStringListAttributeCallback.Cancel(),
-                                                      gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeListStructOctetString(PythonRequest::Bind(gTestClusterListStructOctetStringListAttributeCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_LongOctetString(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4387,7 +4867,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_LongOctetString(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeLongOctetString(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeLongOctetString(PythonRequest::Bind(gStringAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_LongOctetString(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4396,8 +4877,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_LongOctetString(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeLongOctetString(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                                 chip::ByteSpan(value, len));
+    return cluster.WriteAttributeLongOctetString(PythonRequest::Bind(gDefaultSuccessCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback), chip::ByteSpan(value, len));
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Unsupported(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                           chip::GroupId /* ZCLgroupId */)
@@ -4405,7 +4886,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_Unsupported(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeUnsupported(gBooleanAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeUnsupported(PythonRequest::Bind(gBooleanAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Unsupported(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4414,7 +4896,8 @@ CHIP_ERROR chip_ime_WriteAttribute_TestCluster_Unsupported(chip::Controller::Dev
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeUnsupported(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeUnsupported(PythonRequest::Bind(gDefaultSuccessCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_TestCluster_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                               chip::GroupId /* ZCLgroupId */)
@@ -4422,7 +4905,8 @@ CHIP_ERROR chip_ime_ReadAttribute_TestCluster_ClusterRevision(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::TestClusterCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster TestCluster
@@ -4434,7 +4918,8 @@ CHIP_ERROR chip_ime_AppendCommand_Thermostat_ClearWeeklySchedule(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ClearWeeklySchedule(nullptr, nullptr);
+    return cluster.ClearWeeklySchedule(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                       PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_Thermostat_GetRelayStatusLog(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                chip::GroupId)
@@ -4442,7 +4927,8 @@ CHIP_ERROR chip_ime_AppendCommand_Thermostat_GetRelayStatusLog(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetRelayStatusLog(nullptr, nullptr);
+    return cluster.GetRelayStatusLog(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                     PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_Thermostat_GetWeeklySchedule(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                chip::GroupId, uint8_t daysToReturn, uint8_t modeToReturn)
@@ -4450,7 +4936,8 @@ CHIP_ERROR chip_ime_AppendCommand_Thermostat_GetWeeklySchedule(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GetWeeklySchedule(nullptr, nullptr, daysToReturn, modeToReturn);
+    return cluster.GetWeeklySchedule(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                     PythonRequest::BindIfPending(gDefaultFailureCallback), daysToReturn, modeToReturn);
 }
 CHIP_ERROR chip_ime_AppendCommand_Thermostat_SetWeeklySchedule(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                chip::GroupId, uint8_t numberOfTransitionsForSequence,
@@ -4460,8 +4947,9 @@ CHIP_ERROR chip_ime_AppendCommand_Thermostat_SetWeeklySchedule(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SetWeeklySchedule(nullptr, nullptr, numberOfTransitionsForSequence, dayOfWeekForSequence, modeForSequence,
-                                     payload);
+    return cluster.SetWeeklySchedule(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                     PythonRequest::BindIfPending(gDefaultFailureCallback), numberOfTransitionsForSequence,
+                                     dayOfWeekForSequence, modeForSequence, payload);
 }
 CHIP_ERROR chip_ime_AppendCommand_Thermostat_SetpointRaiseLower(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                 chip::GroupId, uint8_t mode, int8_t amount)
@@ -4469,7 +4957,8 @@ CHIP_ERROR chip_ime_AppendCommand_Thermostat_SetpointRaiseLower(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.SetpointRaiseLower(nullptr, nullptr, mode, amount);
+    return cluster.SetpointRaiseLower(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback), mode, amount);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Thermostat_LocalTemperature(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4478,7 +4967,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Thermostat_LocalTemperature(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeLocalTemperature(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeLocalTemperature(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_Thermostat_LocalTemperature(chip::Controller::Device * device,
@@ -4488,8 +4978,9 @@ CHIP_ERROR chip_ime_ConfigureAttribute_Thermostat_LocalTemperature(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeLocalTemperature(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                                      minInterval, maxInterval, change);
+    return cluster.ConfigureAttributeLocalTemperature(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval,
+                                                      change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_Thermostat_OccupiedCoolingSetpoint(chip::Controller::Device * device,
@@ -4498,7 +4989,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Thermostat_OccupiedCoolingSetpoint(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOccupiedCoolingSetpoint(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOccupiedCoolingSetpoint(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                        PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_Thermostat_OccupiedCoolingSetpoint(chip::Controller::Device * device,
@@ -4507,7 +4999,8 @@ CHIP_ERROR chip_ime_WriteAttribute_Thermostat_OccupiedCoolingSetpoint(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeOccupiedCoolingSetpoint(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeOccupiedCoolingSetpoint(PythonRequest::Bind(gDefaultSuccessCallback),
+                                                         PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_Thermostat_OccupiedHeatingSetpoint(chip::Controller::Device * device,
                                                                      chip::EndpointId ZCLendpointId, chip::GroupId /* ZCLgroupId */)
@@ -4515,7 +5008,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Thermostat_OccupiedHeatingSetpoint(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOccupiedHeatingSetpoint(gInt16sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOccupiedHeatingSetpoint(PythonRequest::Bind(gInt16sAttributeCallback),
+                                                        PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_Thermostat_OccupiedHeatingSetpoint(chip::Controller::Device * device,
@@ -4524,7 +5018,8 @@ CHIP_ERROR chip_ime_WriteAttribute_Thermostat_OccupiedHeatingSetpoint(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeOccupiedHeatingSetpoint(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeOccupiedHeatingSetpoint(PythonRequest::Bind(gDefaultSuccessCallback),
+                                                         PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_Thermostat_ControlSequenceOfOperation(chip::Controller::Device * device,
                                                                         chip::EndpointId ZCLendpointId,
@@ -4533,7 +5028,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Thermostat_ControlSequenceOfOperation(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeControlSequenceOfOperation(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeControlSequenceOfOperation(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_Thermostat_ControlSequenceOfOperation(chip::Controller::Device * device,
@@ -4543,8 +5039,8 @@ CHIP_ERROR chip_ime_WriteAttribute_Thermostat_ControlSequenceOfOperation(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeControlSequenceOfOperation(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                                            value);
+    return cluster.WriteAttributeControlSequenceOfOperation(PythonRequest::Bind(gDefaultSuccessCallback),
+                                                            PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_Thermostat_SystemMode(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                         chip::GroupId /* ZCLgroupId */)
@@ -4552,7 +5048,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Thermostat_SystemMode(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSystemMode(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSystemMode(PythonRequest::Bind(gInt8uAttributeCallback),
+                                           PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_Thermostat_SystemMode(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4561,7 +5058,8 @@ CHIP_ERROR chip_ime_WriteAttribute_Thermostat_SystemMode(chip::Controller::Devic
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeSystemMode(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeSystemMode(PythonRequest::Bind(gDefaultSuccessCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback), value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_Thermostat_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                              chip::GroupId /* ZCLgroupId */)
@@ -4569,7 +5067,8 @@ CHIP_ERROR chip_ime_ReadAttribute_Thermostat_ClusterRevision(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThermostatCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster Thermostat
@@ -4581,7 +5080,8 @@ CHIP_ERROR chip_ime_AppendCommand_ThreadNetworkDiagnostics_ResetCounts(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ResetCounts(nullptr, nullptr);
+    return cluster.ResetCounts(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_Channel(chip::Controller::Device * device,
@@ -4590,7 +5090,7 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_Channel(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeChannel(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeChannel(PythonRequest::Bind(gInt8uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RoutingRole(chip::Controller::Device * device,
@@ -4600,7 +5100,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RoutingRole(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRoutingRole(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRoutingRole(PythonRequest::Bind(gInt8uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_NetworkName(chip::Controller::Device * device,
@@ -4610,7 +5111,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_NetworkName(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeNetworkName(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeNetworkName(PythonRequest::Bind(gStringAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_PanId(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -4619,7 +5121,7 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_PanId(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePanId(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePanId(PythonRequest::Bind(gInt16uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ExtendedPanId(chip::Controller::Device * device,
@@ -4629,7 +5131,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ExtendedPanId(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeExtendedPanId(gInt64uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeExtendedPanId(PythonRequest::Bind(gInt64uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_MeshLocalPrefix(chip::Controller::Device * device,
@@ -4639,7 +5142,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_MeshLocalPrefix(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMeshLocalPrefix(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMeshLocalPrefix(PythonRequest::Bind(gStringAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_OverrunCount(chip::Controller::Device * device,
@@ -4649,7 +5153,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_OverrunCount(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOverrunCount(gInt64uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOverrunCount(PythonRequest::Bind(gInt64uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_NeighborTableList(chip::Controller::Device * device,
@@ -4659,8 +5164,9 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_NeighborTableList(chi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeNeighborTableList(gThreadNetworkDiagnosticsNeighborTableListListAttributeCallback.Cancel(),
-                                                  gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeNeighborTableList(
+            PythonRequest::Bind(gThreadNetworkDiagnosticsNeighborTableListListAttributeCallback),
+            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RouteTableList(chip::Controller::Device * device,
@@ -4670,8 +5176,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RouteTableList(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRouteTableList(gThreadNetworkDiagnosticsRouteTableListListAttributeCallback.Cancel(),
-                                               gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRouteTableList(PythonRequest::Bind(gThreadNetworkDiagnosticsRouteTableListListAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_PartitionId(chip::Controller::Device * device,
@@ -4681,7 +5187,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_PartitionId(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePartitionId(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePartitionId(PythonRequest::Bind(gInt32uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_Weighting(chip::Controller::Device * device,
@@ -4690,7 +5197,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_Weighting(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeWeighting(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeWeighting(PythonRequest::Bind(gInt8uAttributeCallback),
+                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_DataVersion(chip::Controller::Device * device,
@@ -4700,7 +5208,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_DataVersion(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeDataVersion(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeDataVersion(PythonRequest::Bind(gInt8uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_StableDataVersion(chip::Controller::Device * device,
@@ -4710,7 +5219,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_StableDataVersion(chi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeStableDataVersion(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeStableDataVersion(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_LeaderRouterId(chip::Controller::Device * device,
@@ -4720,7 +5230,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_LeaderRouterId(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeLeaderRouterId(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeLeaderRouterId(PythonRequest::Bind(gInt8uAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_DetachedRoleCount(chip::Controller::Device * device,
@@ -4730,7 +5241,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_DetachedRoleCount(chi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeDetachedRoleCount(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeDetachedRoleCount(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ChildRoleCount(chip::Controller::Device * device,
@@ -4740,7 +5252,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ChildRoleCount(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeChildRoleCount(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeChildRoleCount(PythonRequest::Bind(gInt16uAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RouterRoleCount(chip::Controller::Device * device,
@@ -4750,7 +5263,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RouterRoleCount(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRouterRoleCount(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRouterRoleCount(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_LeaderRoleCount(chip::Controller::Device * device,
@@ -4760,7 +5274,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_LeaderRoleCount(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeLeaderRoleCount(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeLeaderRoleCount(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_AttachAttemptCount(chip::Controller::Device * device,
@@ -4770,7 +5285,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_AttachAttemptCount(ch
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeAttachAttemptCount(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeAttachAttemptCount(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                   PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_PartitionIdChangeCount(chip::Controller::Device * device,
@@ -4780,7 +5296,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_PartitionIdChangeCoun
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributePartitionIdChangeCount(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributePartitionIdChangeCount(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                       PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_BetterPartitionAttachAttemptCount(chip::Controller::Device * device,
@@ -4790,8 +5307,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_BetterPartitionAttach
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBetterPartitionAttachAttemptCount(gInt16uAttributeCallback.Cancel(),
-                                                                  gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBetterPartitionAttachAttemptCount(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ParentChangeCount(chip::Controller::Device * device,
@@ -4801,7 +5318,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ParentChangeCount(chi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeParentChangeCount(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeParentChangeCount(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxTotalCount(chip::Controller::Device * device,
@@ -4811,7 +5329,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxTotalCount(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxTotalCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxTotalCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxUnicastCount(chip::Controller::Device * device,
@@ -4821,7 +5340,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxUnicastCount(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxUnicastCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxUnicastCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxBroadcastCount(chip::Controller::Device * device,
@@ -4831,7 +5351,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxBroadcastCount(chip
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxBroadcastCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxBroadcastCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxAckRequestedCount(chip::Controller::Device * device,
@@ -4841,7 +5362,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxAckRequestedCount(c
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxAckRequestedCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxAckRequestedCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                    PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxAckedCount(chip::Controller::Device * device,
@@ -4851,7 +5373,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxAckedCount(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxAckedCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxAckedCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxNoAckRequestedCount(chip::Controller::Device * device,
@@ -4861,7 +5384,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxNoAckRequestedCount
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxNoAckRequestedCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxNoAckRequestedCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxDataCount(chip::Controller::Device * device,
@@ -4871,7 +5395,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxDataCount(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxDataCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxDataCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxDataPollCount(chip::Controller::Device * device,
@@ -4881,7 +5406,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxDataPollCount(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxDataPollCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxDataPollCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxBeaconCount(chip::Controller::Device * device,
@@ -4891,7 +5417,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxBeaconCount(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxBeaconCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxBeaconCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxBeaconRequestCount(chip::Controller::Device * device,
@@ -4901,7 +5428,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxBeaconRequestCount(
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxBeaconRequestCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxBeaconRequestCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                     PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxOtherCount(chip::Controller::Device * device,
@@ -4911,7 +5439,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxOtherCount(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxOtherCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxOtherCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxRetryCount(chip::Controller::Device * device,
@@ -4921,7 +5450,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxRetryCount(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxRetryCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxRetryCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxDirectMaxRetryExpiryCount(chip::Controller::Device * device,
@@ -4931,7 +5461,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxDirectMaxRetryExpir
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxDirectMaxRetryExpiryCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxDirectMaxRetryExpiryCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxIndirectMaxRetryExpiryCount(chip::Controller::Device * device,
@@ -4941,7 +5472,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxIndirectMaxRetryExp
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxIndirectMaxRetryExpiryCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxIndirectMaxRetryExpiryCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxErrCcaCount(chip::Controller::Device * device,
@@ -4951,7 +5483,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxErrCcaCount(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxErrCcaCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxErrCcaCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxErrAbortCount(chip::Controller::Device * device,
@@ -4961,7 +5494,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxErrAbortCount(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxErrAbortCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxErrAbortCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxErrBusyChannelCount(chip::Controller::Device * device,
@@ -4971,7 +5505,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_TxErrBusyChannelCount
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTxErrBusyChannelCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTxErrBusyChannelCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                      PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxTotalCount(chip::Controller::Device * device,
@@ -4981,7 +5516,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxTotalCount(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxTotalCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxTotalCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxUnicastCount(chip::Controller::Device * device,
@@ -4991,7 +5527,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxUnicastCount(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxUnicastCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxUnicastCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxBroadcastCount(chip::Controller::Device * device,
@@ -5001,7 +5538,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxBroadcastCount(chip
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxBroadcastCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxBroadcastCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxDataCount(chip::Controller::Device * device,
@@ -5011,7 +5549,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxDataCount(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxDataCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxDataCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxDataPollCount(chip::Controller::Device * device,
@@ -5021,7 +5560,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxDataPollCount(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxDataPollCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxDataPollCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxBeaconCount(chip::Controller::Device * device,
@@ -5031,7 +5571,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxBeaconCount(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxBeaconCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxBeaconCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxBeaconRequestCount(chip::Controller::Device * device,
@@ -5041,7 +5582,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxBeaconRequestCount(
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxBeaconRequestCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxBeaconRequestCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                     PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxOtherCount(chip::Controller::Device * device,
@@ -5051,7 +5593,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxOtherCount(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxOtherCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxOtherCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxAddressFilteredCount(chip::Controller::Device * device,
@@ -5061,7 +5604,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxAddressFilteredCoun
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxAddressFilteredCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxAddressFilteredCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                       PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxDestAddrFilteredCount(chip::Controller::Device * device,
@@ -5071,7 +5615,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxDestAddrFilteredCou
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxDestAddrFilteredCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxDestAddrFilteredCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                        PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxDuplicatedCount(chip::Controller::Device * device,
@@ -5081,7 +5626,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxDuplicatedCount(chi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxDuplicatedCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxDuplicatedCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrNoFrameCount(chip::Controller::Device * device,
@@ -5091,7 +5637,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrNoFrameCount(chi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxErrNoFrameCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxErrNoFrameCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrUnknownNeighborCount(chip::Controller::Device * device,
@@ -5101,7 +5648,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrUnknownNeighborC
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxErrUnknownNeighborCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxErrUnknownNeighborCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                          PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrInvalidSrcAddrCount(chip::Controller::Device * device,
@@ -5111,7 +5659,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrInvalidSrcAddrCo
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxErrInvalidSrcAddrCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxErrInvalidSrcAddrCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrSecCount(chip::Controller::Device * device,
@@ -5121,7 +5670,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrSecCount(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxErrSecCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxErrSecCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrFcsCount(chip::Controller::Device * device,
@@ -5131,7 +5681,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrFcsCount(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxErrFcsCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxErrFcsCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrOtherCount(chip::Controller::Device * device,
@@ -5141,7 +5692,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_RxErrOtherCount(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRxErrOtherCount(gInt32uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRxErrOtherCount(PythonRequest::Bind(gInt32uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_SecurityPolicy(chip::Controller::Device * device,
@@ -5151,8 +5703,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_SecurityPolicy(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSecurityPolicy(gThreadNetworkDiagnosticsSecurityPolicyListAttributeCallback.Cancel(),
-                                               gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSecurityPolicy(PythonRequest::Bind(gThreadNetworkDiagnosticsSecurityPolicyListAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ChannelMask(chip::Controller::Device * device,
@@ -5162,7 +5714,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ChannelMask(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeChannelMask(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeChannelMask(PythonRequest::Bind(gInt8uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_OperationalDatasetComponents(chip::Controller::Device * device,
@@ -5173,7 +5726,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_OperationalDatasetCom
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
     return cluster.ReadAttributeOperationalDatasetComponents(
-        gThreadNetworkDiagnosticsOperationalDatasetComponentsListAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+            PythonRequest::Bind(gThreadNetworkDiagnosticsOperationalDatasetComponentsListAttributeCallback),
+            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ActiveNetworkFaultsList(chip::Controller::Device * device,
@@ -5184,7 +5738,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ActiveNetworkFaultsLi
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
     return cluster.ReadAttributeActiveNetworkFaultsList(
-        gThreadNetworkDiagnosticsActiveNetworkFaultsListListAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+            PythonRequest::Bind(gThreadNetworkDiagnosticsActiveNetworkFaultsListListAttributeCallback),
+            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ClusterRevision(chip::Controller::Device * device,
@@ -5194,7 +5749,8 @@ CHIP_ERROR chip_ime_ReadAttribute_ThreadNetworkDiagnostics_ClusterRevision(chip:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::ThreadNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster ThreadNetworkDiagnostics
@@ -5206,7 +5762,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WakeOnLan_WakeOnLanMacAddress(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WakeOnLanCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeWakeOnLanMacAddress(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeWakeOnLanMacAddress(PythonRequest::Bind(gStringAttributeCallback),
+                                                    PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WakeOnLan_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -5215,7 +5772,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WakeOnLan_ClusterRevision(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WakeOnLanCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster WakeOnLan
@@ -5227,7 +5785,7 @@ CHIP_ERROR chip_ime_ReadAttribute_WiFiNetworkDiagnostics_Bssid(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WiFiNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeBssid(gStringAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeBssid(PythonRequest::Bind(gStringAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WiFiNetworkDiagnostics_SecurityType(chip::Controller::Device * device,
@@ -5237,7 +5795,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WiFiNetworkDiagnostics_SecurityType(chip::Cont
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WiFiNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSecurityType(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSecurityType(PythonRequest::Bind(gInt8uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WiFiNetworkDiagnostics_WiFiVersion(chip::Controller::Device * device,
@@ -5246,7 +5805,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WiFiNetworkDiagnostics_WiFiVersion(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WiFiNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeWiFiVersion(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeWiFiVersion(PythonRequest::Bind(gInt8uAttributeCallback),
+                                            PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WiFiNetworkDiagnostics_ChannelNumber(chip::Controller::Device * device,
@@ -5256,7 +5816,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WiFiNetworkDiagnostics_ChannelNumber(chip::Con
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WiFiNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeChannelNumber(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeChannelNumber(PythonRequest::Bind(gInt16uAttributeCallback),
+                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WiFiNetworkDiagnostics_Rssi(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -5265,7 +5826,7 @@ CHIP_ERROR chip_ime_ReadAttribute_WiFiNetworkDiagnostics_Rssi(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WiFiNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeRssi(gInt8sAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeRssi(PythonRequest::Bind(gInt8sAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WiFiNetworkDiagnostics_ClusterRevision(chip::Controller::Device * device,
@@ -5275,7 +5836,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WiFiNetworkDiagnostics_ClusterRevision(chip::C
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WiFiNetworkDiagnosticsCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster WiFiNetworkDiagnostics
@@ -5287,7 +5849,8 @@ CHIP_ERROR chip_ime_AppendCommand_WindowCovering_DownOrClose(chip::Controller::D
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.DownOrClose(nullptr, nullptr);
+    return cluster.DownOrClose(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                               PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_WindowCovering_GoToLiftPercentage(chip::Controller::Device * device,
                                                                     chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -5296,7 +5859,9 @@ CHIP_ERROR chip_ime_AppendCommand_WindowCovering_GoToLiftPercentage(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GoToLiftPercentage(nullptr, nullptr, liftPercentageValue, liftPercent100thsValue);
+    return cluster.GoToLiftPercentage(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback), liftPercentageValue,
+                                      liftPercent100thsValue);
 }
 CHIP_ERROR chip_ime_AppendCommand_WindowCovering_GoToLiftValue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                chip::GroupId, uint16_t liftValue)
@@ -5304,7 +5869,8 @@ CHIP_ERROR chip_ime_AppendCommand_WindowCovering_GoToLiftValue(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GoToLiftValue(nullptr, nullptr, liftValue);
+    return cluster.GoToLiftValue(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback), liftValue);
 }
 CHIP_ERROR chip_ime_AppendCommand_WindowCovering_GoToTiltPercentage(chip::Controller::Device * device,
                                                                     chip::EndpointId ZCLendpointId, chip::GroupId,
@@ -5313,7 +5879,9 @@ CHIP_ERROR chip_ime_AppendCommand_WindowCovering_GoToTiltPercentage(chip::Contro
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GoToTiltPercentage(nullptr, nullptr, tiltPercentageValue, tiltPercent100thsValue);
+    return cluster.GoToTiltPercentage(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                      PythonRequest::BindIfPending(gDefaultFailureCallback), tiltPercentageValue,
+                                      tiltPercent100thsValue);
 }
 CHIP_ERROR chip_ime_AppendCommand_WindowCovering_GoToTiltValue(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                                chip::GroupId, uint16_t tiltValue)
@@ -5321,7 +5889,8 @@ CHIP_ERROR chip_ime_AppendCommand_WindowCovering_GoToTiltValue(chip::Controller:
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.GoToTiltValue(nullptr, nullptr, tiltValue);
+    return cluster.GoToTiltValue(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                                 PythonRequest::BindIfPending(gDefaultFailureCallback), tiltValue);
 }
 CHIP_ERROR chip_ime_AppendCommand_WindowCovering_StopMotion(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                             chip::GroupId)
@@ -5329,7 +5898,8 @@ CHIP_ERROR chip_ime_AppendCommand_WindowCovering_StopMotion(chip::Controller::De
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.StopMotion(nullptr, nullptr);
+    return cluster.StopMotion(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                              PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 CHIP_ERROR chip_ime_AppendCommand_WindowCovering_UpOrOpen(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                           chip::GroupId)
@@ -5337,7 +5907,8 @@ CHIP_ERROR chip_ime_AppendCommand_WindowCovering_UpOrOpen(chip::Controller::Devi
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.UpOrOpen(nullptr, nullptr);
+    return cluster.UpOrOpen(PythonRequest::BindResponse<DefaultSuccessCallback>(),
+                            PythonRequest::BindIfPending(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_Type(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -5346,7 +5917,7 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_Type(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeType(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeType(PythonRequest::Bind(gInt8uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionLift(chip::Controller::Device * device,
@@ -5355,7 +5926,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionLift(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentPositionLift(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentPositionLift(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                    PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionTilt(chip::Controller::Device * device,
@@ -5364,7 +5936,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionTilt(chip::Contr
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentPositionTilt(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentPositionTilt(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                    PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_ConfigStatus(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -5373,7 +5946,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_ConfigStatus(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeConfigStatus(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeConfigStatus(PythonRequest::Bind(gInt8uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionLiftPercentage(chip::Controller::Device * device,
@@ -5383,7 +5957,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionLiftPercentage(c
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentPositionLiftPercentage(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentPositionLiftPercentage(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_CurrentPositionLiftPercentage(chip::Controller::Device * device,
@@ -5394,8 +5969,9 @@ CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_CurrentPositionLiftPercent
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeCurrentPositionLiftPercentage(
-        gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval, maxInterval, change);
+    return cluster.ConfigureAttributeCurrentPositionLiftPercentage(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                                   PythonRequest::Bind(gDefaultFailureCallback), minInterval,
+                                                                   maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionTiltPercentage(chip::Controller::Device * device,
@@ -5405,7 +5981,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionTiltPercentage(c
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentPositionTiltPercentage(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentPositionTiltPercentage(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                              PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_CurrentPositionTiltPercentage(chip::Controller::Device * device,
@@ -5416,8 +5993,9 @@ CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_CurrentPositionTiltPercent
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeCurrentPositionTiltPercentage(
-        gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval, maxInterval, change);
+    return cluster.ConfigureAttributeCurrentPositionTiltPercentage(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                                   PythonRequest::Bind(gDefaultFailureCallback), minInterval,
+                                                                   maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_OperationalStatus(chip::Controller::Device * device,
@@ -5426,7 +6004,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_OperationalStatus(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeOperationalStatus(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeOperationalStatus(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_OperationalStatus(chip::Controller::Device * device,
@@ -5436,8 +6015,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_OperationalStatus(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeOperationalStatus(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(),
-                                                       minInterval, maxInterval);
+    return cluster.ConfigureAttributeOperationalStatus(PythonRequest::Bind(gInt8uAttributeCallback),
+                                                       PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_TargetPositionLiftPercent100ths(chip::Controller::Device * device,
@@ -5447,8 +6026,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_TargetPositionLiftPercent100ths
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTargetPositionLiftPercent100ths(gInt16uAttributeCallback.Cancel(),
-                                                                gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTargetPositionLiftPercent100ths(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_TargetPositionLiftPercent100ths(chip::Controller::Device * device,
@@ -5459,8 +6038,9 @@ CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_TargetPositionLiftPercent1
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeTargetPositionLiftPercent100ths(
-        gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval, maxInterval, change);
+    return cluster.ConfigureAttributeTargetPositionLiftPercent100ths(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                                     PythonRequest::Bind(gDefaultFailureCallback), minInterval,
+                                                                     maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_TargetPositionTiltPercent100ths(chip::Controller::Device * device,
@@ -5470,8 +6050,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_TargetPositionTiltPercent100ths
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeTargetPositionTiltPercent100ths(gInt16uAttributeCallback.Cancel(),
-                                                                gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeTargetPositionTiltPercent100ths(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_TargetPositionTiltPercent100ths(chip::Controller::Device * device,
@@ -5482,8 +6062,9 @@ CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_TargetPositionTiltPercent1
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeTargetPositionTiltPercent100ths(
-        gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval, maxInterval, change);
+    return cluster.ConfigureAttributeTargetPositionTiltPercent100ths(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                                     PythonRequest::Bind(gDefaultFailureCallback), minInterval,
+                                                                     maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_EndProductType(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -5492,7 +6073,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_EndProductType(chip::Controller
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeEndProductType(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeEndProductType(PythonRequest::Bind(gInt8uAttributeCallback),
+                                               PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionLiftPercent100ths(chip::Controller::Device * device,
@@ -5502,8 +6084,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionLiftPercent100th
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentPositionLiftPercent100ths(gInt16uAttributeCallback.Cancel(),
-                                                                 gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentPositionLiftPercent100ths(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_CurrentPositionLiftPercent100ths(chip::Controller::Device * device,
@@ -5514,8 +6096,9 @@ CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_CurrentPositionLiftPercent
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeCurrentPositionLiftPercent100ths(
-        gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval, maxInterval, change);
+    return cluster.ConfigureAttributeCurrentPositionLiftPercent100ths(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                                      PythonRequest::Bind(gDefaultFailureCallback), minInterval,
+                                                                      maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionTiltPercent100ths(chip::Controller::Device * device,
@@ -5525,8 +6108,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_CurrentPositionTiltPercent100th
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeCurrentPositionTiltPercent100ths(gInt16uAttributeCallback.Cancel(),
-                                                                 gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeCurrentPositionTiltPercent100ths(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                                 PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_CurrentPositionTiltPercent100ths(chip::Controller::Device * device,
@@ -5537,8 +6120,9 @@ CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_CurrentPositionTiltPercent
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeCurrentPositionTiltPercent100ths(
-        gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval, maxInterval, change);
+    return cluster.ConfigureAttributeCurrentPositionTiltPercent100ths(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                                      PythonRequest::Bind(gDefaultFailureCallback), minInterval,
+                                                                      maxInterval, change);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_InstalledOpenLimitLift(chip::Controller::Device * device,
@@ -5548,7 +6132,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_InstalledOpenLimitLift(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInstalledOpenLimitLift(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInstalledOpenLimitLift(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                       PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_InstalledClosedLimitLift(chip::Controller::Device * device,
@@ -5558,7 +6143,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_InstalledClosedLimitLift(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInstalledClosedLimitLift(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInstalledClosedLimitLift(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_InstalledOpenLimitTilt(chip::Controller::Device * device,
@@ -5568,7 +6154,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_InstalledOpenLimitTilt(chip::Co
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInstalledOpenLimitTilt(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInstalledOpenLimitTilt(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                       PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_InstalledClosedLimitTilt(chip::Controller::Device * device,
@@ -5578,7 +6165,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_InstalledClosedLimitTilt(chip::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeInstalledClosedLimitTilt(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeInstalledClosedLimitTilt(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                         PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_Mode(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -5587,7 +6175,7 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_Mode(chip::Controller::Device *
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeMode(gInt8uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeMode(PythonRequest::Bind(gInt8uAttributeCallback), PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_WriteAttribute_WindowCovering_Mode(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -5596,7 +6184,8 @@ CHIP_ERROR chip_ime_WriteAttribute_WindowCovering_Mode(chip::Controller::Device
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.WriteAttributeMode(gDefaultSuccessCallback.Cancel(), gDefaultFailureCallback.Cancel(), value);
+    return cluster.WriteAttributeMode(PythonRequest::Bind(gDefaultSuccessCallback), PythonRequest::Bind(gDefaultFailureCallback),
+                                      value);
 }
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_SafetyStatus(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
                                                               chip::GroupId /* ZCLgroupId */)
@@ -5604,7 +6193,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_SafetyStatus(chip::Controller::
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeSafetyStatus(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeSafetyStatus(PythonRequest::Bind(gInt16uAttributeCallback),
+                                             PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_SafetyStatus(chip::Controller::Device * device,
@@ -5614,8 +6204,8 @@ CHIP_ERROR chip_ime_ConfigureAttribute_WindowCovering_SafetyStatus(chip::Control
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ConfigureAttributeSafetyStatus(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel(), minInterval,
-                                                  maxInterval);
+    return cluster.ConfigureAttributeSafetyStatus(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                  PythonRequest::Bind(gDefaultFailureCallback), minInterval, maxInterval);
 }
 
 CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_ClusterRevision(chip::Controller::Device * device, chip::EndpointId ZCLendpointId,
@@ -5624,7 +6214,8 @@ CHIP_ERROR chip_ime_ReadAttribute_WindowCovering_ClusterRevision(chip::Controlle
     VerifyOrReturnError(device != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     chip::Controller::WindowCoveringCluster cluster;
     cluster.Associate(device, ZCLendpointId);
-    return cluster.ReadAttributeClusterRevision(gInt16uAttributeCallback.Cancel(), gDefaultFailureCallback.Cancel());
+    return cluster.ReadAttributeClusterRevision(PythonRequest::Bind(gInt16uAttributeCallback),
+                                                PythonRequest::Bind(gDefaultFailureCallback));
 }
 
 // End of Cluster WindowCovering
@@ -2272,6 +2272,24 @@ class ChipClusters:
         funcCaller = self._ChipStack.Call if imEnabled else self._ChipStack.CallAsync
         funcCaller(lambda: func(device, endpoint, groupid, value))
 
+    def SendCommandFuture(self, device: ctypes.c_void_p, cluster: str, command: str, endpoint: int, groupid: int, args):
+        func = getattr(self, "Cluster{}_Command{}".format(cluster, command), None)
+        if not func:
+            raise UnknownCommand(cluster, command)
+        return self._ChipStack.CallWithFuture(lambda: func(device, endpoint, groupid, **args))
+
+    def ReadAttributeFuture(self, device: ctypes.c_void_p, cluster: str, attribute: str, endpoint: int, groupid: int, resultFunct=None):
+        func = getattr(self, "Cluster{}_ReadAttribute{}".format(cluster, attribute), None)
+        if not func:
+            raise UnknownAttribute(cluster, attribute)
+        return self._ChipStack.CallWithFuture(lambda: func(device, endpoint, groupid), resultFunct)
+
+    def WriteAttributeFuture(self, device: ctypes.c_void_p, cluster: str, attribute: str, endpoint: int, groupid: int, value):
+        func = getattr(self, "Cluster{}_WriteAttribute{}".format(cluster, attribute), None)
+        if not func:
+            raise UnknownAttribute(cluster, attribute)
+        return self._ChipStack.CallWithFuture(lambda: func(device, endpoint, groupid, value))
+
     # Cluster commands
 
     def ClusterAccountLogin_CommandGetSetupPIN(self, device: ctypes.c_void_p, ZCLendpoint: int, ZCLgroupid: int, tempAccountIdentifier: bytes):
@@ -18,6 +18,7 @@
 __all__ = [
     "ChipStackException",
     "ChipStackError",
+    "ClusterStatusError",
     "DeviceError",
     "InvalidArgumentCount",
     "InvalidArgumentType",
@@ -60,6 +61,14 @@ class ClusterError(ChipStackException):
     pass
 
 
+class ClusterStatusError(ClusterError):
+    def __init__(self, status: int):
+        self.status = status
+
+    def __str__(self):
+        return "ClusterStatusError: status: 0x{:02X}".format(self.status)
+
+
 class InvalidArgumentCount(ChipStackException):
     def __init__(self, expect: int, given: int):
         self.expect = expect
@@ -19,7 +19,10 @@
 
 #include <app/CommandSender.h>
 #include <app/InteractionModelEngine.h>
+#include <app/util/CHIPDeviceCallbacksMgr.h>
 #include <controller/python/chip/interaction_model/Delegate.h>
+#include <controller/python/chip/internal/ChipThreadWork.h>
+#include <platform/CHIPDeviceLayer.h>
 #include <support/TypeTraits.h>
 #include <support/logging/CHIPLogging.h>
 
@@ -102,10 +105,23 @@ void PythonInteractionModelDelegate::OnReportData(const app::ReadClient * apRead
         }
         if (CHIP_NO_ERROR == err)
         {
+            // The report of a read issued as a python request is keyed by the context id of that request, so that python can
+            // tell apart the reports of concurrent reads.
+            intptr_t appIdentifier                   = apReadClient->GetAppIdentifier();
+            Callback::Cancelable * onSuccessCallback = nullptr;
+            if (app::CHIPDeviceCallbacksMgr::GetInstance().PeekResponseCallback(
+                    aPath.mNodeId, static_cast<uint8_t>(appIdentifier), &onSuccessCallback) == CHIP_NO_ERROR)
+            {
+                PythonRequest * request = PythonRequest::FromCallback(onSuccessCallback);
+                if (request != nullptr)
+                {
+                    appIdentifier = static_cast<intptr_t>(request->GetContextId());
+                }
+            }
+
             AttributePath path{ .endpointId = aPath.mEndpointId, .clusterId = aPath.mClusterId, .fieldId = aPath.mFieldId };
-            onReportDataFunct(apReadClient->GetExchangeContext()->GetSecureSession().GetPeerNodeId(),
-                              apReadClient->GetAppIdentifier(), &path, sizeof(path), writerBuffer, writer.GetLengthWritten(),
-                              to_underlying(status));
+            onReportDataFunct(apReadClient->GetExchangeContext()->GetSecureSession().GetPeerNodeId(), appIdentifier, &path,
+                              sizeof(path), writerBuffer, writer.GetLengthWritten(), to_underlying(status));
         }
         else
         {
@@ -117,6 +133,133 @@ void PythonInteractionModelDelegate::OnReportData(const app::ReadClient * apRead
     DeviceControllerInteractionModelDelegate::OnReportData(apReadClient, aPath, apData, status);
 }
 
+PythonRequest * PythonRequest::sPending   = nullptr;
+PythonRequest * PythonRequest::sFirstSent = nullptr;
+
+PythonRequest::~PythonRequest()
+{
+    for (size_t i = 0; i < mCallbackCount; i++)
+    {
+        // Unregister the callbacks still waiting for a response, along with their TLV filter, before deleting them.
+        app::CHIPDeviceCallbacksMgr::GetInstance().CancelResponseCallback(mCallbacks[i]);
+        mDeleters[i](mCallbacks[i]);
+    }
+}
+
+CHIP_ERROR PythonRequest::Issue(uint64_t contextId, uint32_t timeoutMs, PythonInteractionModel_IssueRequestFunct issue)
+{
+    VerifyOrReturnError(issue != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(timeoutMs > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Responses are dispatched on the CHIP thread: sending the request from there too means that they never race with it.
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    python::ChipMainThreadScheduleAndWait([&]() { IssueOnChipThread(contextId, timeoutMs, issue, err); });
+    return err;
+}
+
+void PythonRequest::IssueOnChipThread(uint64_t contextId, uint32_t timeoutMs, PythonInteractionModel_IssueRequestFunct issue,
+                                      CHIP_ERROR & err)
+{
+    if (sPending != nullptr)
+    {
+        err = CHIP_ERROR_INCORRECT_STATE;
+        return;
+    }
+
+    sPending = new PythonRequest(contextId);
+    err      = issue();
+    // Nothing to wait for when the bindings did not register any callback for this request.
+    if (err == CHIP_NO_ERROR && sPending->mCallbackCount == 0)
+    {
+        err = CHIP_ERROR_INCORRECT_STATE;
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        err = DeviceLayer::SystemLayer.StartTimer(timeoutMs, HandleTimeout, sPending);
+    }
+    if (err == CHIP_NO_ERROR)
+    {
+        sPending->mNext = sFirstSent;
+        sFirstSent      = sPending;
+    }
+    else
+    {
+        delete sPending;
+    }
+    sPending = nullptr;
+}
+
+void PythonRequest::Cancel(uint64_t contextId)
+{
+    // Does not wait for the CHIP thread, so that a future can be canceled from any thread.
+    DeviceLayer::PlatformMgr().ScheduleWork(CancelOnChipThread, static_cast<intptr_t>(contextId));
+}
+
+void PythonRequest::CancelOnChipThread(intptr_t contextId)
+{
+    for (PythonRequest * request = sFirstSent; request != nullptr; request = request->mNext)
+    {
+        if (request->mContextId == static_cast<uint64_t>(contextId))
+        {
+            request->Finish(CHIP_ERROR_TRANSACTION_CANCELED, 0);
+            return;
+        }
+    }
+}
+
+void PythonRequest::HandleTimeout(System::Layer * layer, void * appState, CHIP_ERROR error)
+{
+    static_cast<PythonRequest *>(appState)->Finish(CHIP_ERROR_TIMEOUT, 0);
+}
+
+PythonRequest * PythonRequest::FromCallback(Callback::Cancelable * callback)
+{
+    for (PythonRequest * request = sFirstSent; request != nullptr; request = request->mNext)
+    {
+        for (size_t i = 0; i < request->mCallbackCount; i++)
+        {
+            if (request->mCallbacks[i] == callback)
+            {
+                return request;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void PythonRequest::Track(Callback::Cancelable * callback, CallbackDeleter deleter)
+{
+    VerifyOrDie(mCallbackCount < kMaxCallbacks);
+    mCallbacks[mCallbackCount] = callback;
+    mDeleters[mCallbackCount]  = deleter;
+    mCallbackCount++;
+}
+
+void PythonRequest::Finish(CHIP_ERROR error, uint8_t status)
+{
+    for (PythonRequest ** link = &sFirstSent; *link != nullptr; link = &(*link)->mNext)
+    {
+        if (*link == this)
+        {
+            *link = mNext;
+            break;
+        }
+    }
+    DeviceLayer::SystemLayer.CancelTimer(HandleTimeout, this);
+
+    gPythonInteractionModelDelegate.OnRequestComplete(mContextId, error, status);
+    delete this;
+}
+
+bool PythonRequest::Complete(void * context, uint8_t status)
+{
+    VerifyOrReturnError(context != nullptr, false);
+
+    // The response dispatch no longer touches the callbacks once it called one of them.
+    static_cast<PythonRequest *>(context)->Finish(CHIP_NO_ERROR, status);
+    return true;
+}
+
 void pychip_InteractionModelDelegate_SetCommandResponseStatusCallback(
     PythonInteractionModelDelegate_OnCommandResponseStatusCodeReceivedFunct f)
 {
@@ -139,6 +282,26 @@ void pychip_InteractionModelDelegate_SetOnReportDataCallback(PythonInteractionMo
     gPythonInteractionModelDelegate.SetOnReportDataCallback(f);
 }
 
+void pychip_InteractionModelDelegate_SetOnRequestCompleteCallback(PythonInteractionModelDelegate_OnRequestCompleteFunct f)
+{
+    gPythonInteractionModelDelegate.SetOnRequestCompleteCallback(f);
+}
+
+CHIP_ERROR pychip_InteractionModel_IssueRequest(uint64_t contextId, uint32_t timeoutMs, PythonInteractionModel_IssueRequestFunct f)
+{
+    return PythonRequest::Issue(contextId, timeoutMs, f);
+}
+
+void pychip_InteractionModel_CancelRequest(uint64_t contextId)
+{
+    PythonRequest::Cancel(contextId);
+}
+
+CHIP_ERROR pychip_InteractionModel_GetInternalError()
+{
+    return CHIP_ERROR_INTERNAL;
+}
+
 PythonInteractionModelDelegate & PythonInteractionModelDelegate::Instance()
 {
     return gPythonInteractionModelDelegate;
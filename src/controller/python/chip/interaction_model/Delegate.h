@@ -21,6 +21,8 @@
 
 #include <app/InteractionModelDelegate.h>
 #include <controller/CHIPDeviceController.h>
+#include <core/CHIPCallback.h>
+#include <system/SystemLayer.h>
 
 namespace chip {
 namespace Controller {
@@ -64,6 +66,8 @@ typedef void (*PythonInteractionModelDelegate_OnCommandResponseFunct)(uint64_t c
 typedef void (*PythonInteractionModelDelegate_OnReportDataFunct)(chip::NodeId nodeId, intptr_t readClientAppIdentifier,
                                                                  void * attributePathBuf, size_t attributePathBufLen,
                                                                  uint8_t * readTlvData, size_t readTlvDataLen, uint16_t statusCode);
+typedef void (*PythonInteractionModelDelegate_OnRequestCompleteFunct)(uint64_t contextId, CHIP_ERROR error, uint8_t status);
+typedef CHIP_ERROR (*PythonInteractionModel_IssueRequestFunct)();
 
 void pychip_InteractionModelDelegate_SetCommandResponseStatusCallback(
     PythonInteractionModelDelegate_OnCommandResponseStatusCodeReceivedFunct f);
@@ -71,8 +75,130 @@ void pychip_InteractionModelDelegate_SetCommandResponseProtocolErrorCallback(
     PythonInteractionModelDelegate_OnCommandResponseProtocolErrorFunct f);
 void pychip_InteractionModelDelegate_SetCommandResponseErrorCallback(PythonInteractionModelDelegate_OnCommandResponseFunct f);
 void pychip_InteractionModelDelegate_SetOnReportDataCallback(PythonInteractionModelDelegate_OnReportDataFunct f);
+void pychip_InteractionModelDelegate_SetOnRequestCompleteCallback(PythonInteractionModelDelegate_OnRequestCompleteFunct f);
+
+CHIP_ERROR pychip_InteractionModel_IssueRequest(uint64_t contextId, uint32_t timeoutMs, PythonInteractionModel_IssueRequestFunct f);
+void pychip_InteractionModel_CancelRequest(uint64_t contextId);
+CHIP_ERROR pychip_InteractionModel_GetInternalError();
 }
 
+/**
+ * A cluster command or attribute request issued from python with a context id, completed by calling back python with that
+ * context id once the response (or a failure) is received. This lets many requests be in flight at once, whereas the shared
+ * callbacks of the cluster bindings can only be registered for one request at a time.
+ *
+ * Requests are issued on the CHIP thread by pychip_InteractionModel_IssueRequest, which calls back python to send the request
+ * through the cluster bindings: these then get per-request callbacks from Bind / BindResponse, which carry the request as
+ * their context. A request which is sent completes on its response, when no response is received within its timeout, or when
+ * python cancels it, and then deletes itself along with its callbacks. A request which could not be sent is deleted right
+ * away, without completing.
+ */
+class PythonRequest
+{
+public:
+    static constexpr size_t kMaxCallbacks = 2;
+
+    static CHIP_ERROR Issue(uint64_t contextId, uint32_t timeoutMs, PythonInteractionModel_IssueRequestFunct issue);
+    static void Cancel(uint64_t contextId);
+
+    /**
+     * Find the request, sent and not yet completed, which registered the given callback.
+     */
+    static PythonRequest * FromCallback(Callback::Cancelable * callback);
+
+    uint64_t GetContextId() const { return mContextId; }
+
+    /**
+     * Callback to register for the request being issued: a copy of the shared callback with the request as context, or the
+     * shared callback itself when no request is being issued.
+     */
+    template <typename T>
+    static Callback::Cancelable * Bind(Callback::Callback<T> & callback)
+    {
+        Callback::Cancelable * bound = BindIfPending(callback);
+        return (bound != nullptr) ? bound : callback.Cancel();
+    }
+
+    /**
+     * Same as Bind, but nullptr when no request is being issued, for the bindings which do not register any callback then.
+     */
+    template <typename T>
+    static Callback::Cancelable * BindIfPending(Callback::Callback<T> & callback)
+    {
+        if (sPending == nullptr)
+        {
+            return nullptr;
+        }
+        return sPending->Add(callback.mCall);
+    }
+
+    /**
+     * Callback completing the request being issued on a command response of type T, or nullptr when no request is being
+     * issued: command responses are then only reported through the interaction model delegate.
+     */
+    template <typename T>
+    static Callback::Cancelable * BindResponse()
+    {
+        if (sPending == nullptr)
+        {
+            return nullptr;
+        }
+        return sPending->Add<T>(ResponseHandler<T>::OnResponse);
+    }
+
+    /**
+     * Complete the request passed as the context of a callback with a ZCL status. Returns false, doing nothing, when the
+     * context is not a request, i.e. for the shared callbacks.
+     */
+    static bool Complete(void * context, uint8_t status);
+
+private:
+    using CallbackDeleter = void (*)(Callback::Cancelable *);
+
+    template <typename T>
+    struct ResponseHandler;
+
+    template <typename... Args>
+    struct ResponseHandler<void (*)(void *, Args...)>
+    {
+        static void OnResponse(void * context, Args...) { Complete(context, 0); }
+    };
+
+    template <typename T>
+    static void DeleteCallback(Callback::Cancelable * cancelable)
+    {
+        delete Callback::Callback<T>::FromCancelable(cancelable);
+    }
+
+    explicit PythonRequest(uint64_t contextId) : mContextId(contextId) {}
+    ~PythonRequest();
+
+    static void IssueOnChipThread(uint64_t contextId, uint32_t timeoutMs, PythonInteractionModel_IssueRequestFunct issue,
+                                  CHIP_ERROR & err);
+    static void CancelOnChipThread(intptr_t contextId);
+    static void HandleTimeout(System::Layer * layer, void * appState, CHIP_ERROR error);
+
+    template <typename T>
+    Callback::Cancelable * Add(T call)
+    {
+        auto * callback = new Callback::Callback<T>(call, this);
+        Track(callback->Cancel(), DeleteCallback<T>);
+        return callback->Cancel();
+    }
+
+    void Track(Callback::Cancelable * callback, CallbackDeleter deleter);
+    void Finish(CHIP_ERROR error, uint8_t status);
+
+    static PythonRequest * sPending;
+    static PythonRequest * sFirstSent;
+
+    uint64_t mContextId;
+    PythonRequest * mNext = nullptr;
+    size_t mCallbackCount = 0;
+    Callback::Cancelable * mCallbacks[kMaxCallbacks];
+    CallbackDeleter mDeleters[kMaxCallbacks];
+};
+
 class PythonInteractionModelDelegate : public chip::Controller::DeviceControllerInteractionModelDelegate
 {
 public:
@@ -106,11 +232,22 @@ public:
 
     void SetOnReportDataCallback(PythonInteractionModelDelegate_OnReportDataFunct f) { onReportDataFunct = f; }
 
+    void SetOnRequestCompleteCallback(PythonInteractionModelDelegate_OnRequestCompleteFunct f) { onRequestCompleteFunct = f; }
+
+    void OnRequestComplete(uint64_t contextId, CHIP_ERROR error, uint8_t status)
+    {
+        if (onRequestCompleteFunct != nullptr)
+        {
+            onRequestCompleteFunct(contextId, error, status);
+        }
+    }
+
 private:
     PythonInteractionModelDelegate_OnCommandResponseStatusCodeReceivedFunct commandResponseStatusFunct   = nullptr;
     PythonInteractionModelDelegate_OnCommandResponseProtocolErrorFunct commandResponseProtocolErrorFunct = nullptr;
     PythonInteractionModelDelegate_OnCommandResponseFunct commandResponseErrorFunct                      = nullptr;
     PythonInteractionModelDelegate_OnReportDataFunct onReportDataFunct                                   = nullptr;
+    PythonInteractionModelDelegate_OnRequestCompleteFunct onRequestCompleteFunct                         = nullptr;
 };
 
 } // namespace Controller
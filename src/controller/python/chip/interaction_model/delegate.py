@@ -129,6 +129,7 @@ def _OnReportData(nodeId: int, appId: int, attrPathBuf, attrPathBufLen: int, tlv
 
     if appId < 256:
         # For all attribute read requests using CHIPCluster API, appId is filled by CHIPDevice, and should be smaller than 256 (UINT8_MAX).
+        # Reads issued by ChipStack.CallWithFuture are reported with the context ID of their request instead.
         appId = DEFAULT_ATTRIBUTEREAD_APPID
 
     with _attributeDictLock:
@@ -201,3 +202,7 @@ def GetCommandSenderHandle()->int:
 def GetAttributeReadResponse(appId: int) -> AttributeReadResult:
     with _attributeDictLock:
         return _attributeDict.get(appId, None)
+
+def TakeAttributeReadResponse(appId: int) -> AttributeReadResult:
+    with _attributeDictLock:
+        return _attributeDict.pop(appId, None)
@@ -0,0 +1,234 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the issuance of node operational certificates
+ *      by the ExampleOperationalCredentialsIssuer, one at a time on the event loop thread
+ *      and in batches on 1 to 8 worker threads.
+ *
+ */
+
+#include <controller/ExampleOperationalCredentialsIssuer.h>
+#include <credentials/CHIPCert.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <chrono>
+#include <inttypes.h>
+#include <map>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+namespace {
+
+using namespace chip;
+using namespace chip::Controller;
+using namespace chip::Credentials;
+using namespace chip::Crypto;
+
+using Clock = std::chrono::steady_clock;
+
+constexpr FabricId kFabricId   = 0x8888;
+constexpr size_t kCertArrayLen = 2 * kMaxCHIPCertLength;
+constexpr size_t kCount        = 64;
+
+class BenchmarkStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        auto it = mValues.find(key);
+        VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_KEY_NOT_FOUND);
+        VerifyOrReturnError(it->second.size() <= size, CHIP_ERROR_BUFFER_TOO_SMALL);
+        memcpy(buffer, it->second.data(), it->second.size());
+        size = static_cast<uint16_t>(it->second.size());
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mValues[key] = std::string(static_cast<const char *>(value), size);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override
+    {
+        mValues.erase(key);
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    std::map<std::string, std::string> mValues;
+};
+
+struct CSR
+{
+    uint8_t mBuf[kMAX_CSR_Length];
+    size_t mLen;
+};
+
+CSR sCSRs[kCount];
+uint8_t sCertArrays[kCount][kCertArrayLen];
+
+CHIP_ERROR GenerateCSRs()
+{
+    for (CSR & csr : sCSRs)
+    {
+        P256Keypair keypair;
+        ReturnErrorOnFailure(keypair.Initialize());
+        csr.mLen = sizeof(csr.mBuf);
+        ReturnErrorOnFailure(keypair.NewCertificateSigningRequest(csr.mBuf, csr.mLen));
+    }
+    return CHIP_NO_ERROR;
+}
+
+uint64_t Rate(Clock::time_point start)
+{
+    const auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+    return static_cast<uint64_t>(kCount) * 1000000 / static_cast<uint64_t>(elapsedUs > 0 ? elapsedUs : 1);
+}
+
+// Issues the certificates one at a time, converting each NOC and the ICAC to a CHIP certificate array.
+CHIP_ERROR BenchmarkSingleIssuance(ExampleOperationalCredentialsIssuer & issuer)
+{
+    struct SyncContext
+    {
+        uint8_t * mCertArray;
+        ByteSpan mICAC;
+        CHIP_ERROR mStatus;
+    };
+
+    static uint8_t x509ICAC[kMaxCHIPDERCertLength];
+    MutableByteSpan icacSpan(x509ICAC);
+    ReturnErrorOnFailure(issuer.GetIntermediateCACertificate(kFabricId, icacSpan));
+
+    SyncContext syncContext = { nullptr, icacSpan, CHIP_NO_ERROR };
+    Callback::Callback<NOCGenerated> onNOCGenerated(
+        [](void * context, const ByteSpan & noc) {
+            SyncContext * sync = static_cast<SyncContext *>(context);
+            MutableByteSpan certArray(sync->mCertArray, kCertArrayLen);
+            sync->mStatus = ConvertX509CertsToChipCertArray(noc, sync->mICAC, certArray);
+        },
+        &syncContext);
+
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < kCount; i++)
+    {
+        syncContext.mCertArray = sCertArrays[i];
+        ReturnErrorOnFailure(issuer.GenerateNodeOperationalCertificate(Optional<NodeId>(), kFabricId,
+                                                                       ByteSpan(sCSRs[i].mBuf, sCSRs[i].mLen), ByteSpan(),
+                                                                       &onNOCGenerated));
+        ReturnErrorOnFailure(syncContext.mStatus);
+    }
+
+    printf("Event loop thread: %" PRIu64 " certs/s\n", Rate(start));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BenchmarkBatchIssuance(chip::Test::IOContext & ctx, ExampleOperationalCredentialsIssuer & issuer, unsigned threadCount)
+{
+    NOCBatchRequest requests[kCount];
+    for (size_t i = 0; i < kCount; i++)
+    {
+        requests[i].mCSR           = ByteSpan(sCSRs[i].mBuf, sCSRs[i].mLen);
+        requests[i].mChipCertArray = MutableByteSpan(sCertArrays[i], kCertArrayLen);
+    }
+
+    bool done = false;
+    Callback::Callback<NOCBatchGenerated> onBatchGenerated(
+        [](void * context, NOCBatchRequest * batchRequests, size_t count) { *static_cast<bool *>(context) = true; }, &done);
+    ReturnErrorOnFailure(issuer.InitBatchIssuance(ctx.GetSystemLayer(), threadCount));
+
+    Clock::time_point start = Clock::now();
+    CHIP_ERROR err          = issuer.GenerateNodeOperationalCertificates(kFabricId, requests, kCount, &onBatchGenerated);
+    if (err == CHIP_NO_ERROR)
+    {
+        ctx.DriveIOUntil(20000, [&done] { return done; });
+    }
+    const uint64_t rate = Rate(start);
+
+    issuer.ShutdownBatchIssuance();
+    ReturnErrorOnFailure(err);
+    VerifyOrReturnError(done, CHIP_ERROR_TIMEOUT);
+    for (const NOCBatchRequest & request : requests)
+    {
+        ReturnErrorOnFailure(request.mStatus);
+    }
+
+    printf("%u issuance workers: %" PRIu64 " certs/s\n", threadCount, rate);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR RunBenchmarks(chip::Test::IOContext & ctx)
+{
+    BenchmarkStorageDelegate storage;
+    ExampleOperationalCredentialsIssuer issuer;
+
+    ReturnErrorOnFailure(issuer.Initialize(storage));
+    ReturnErrorOnFailure(GenerateCSRs());
+
+#if CHIP_EXAMPLE_ISSUER_SERIALIZE_SIGNING
+    printf("Issuing %zu node operational certificates, one signature at a time\n", kCount);
+#else
+    printf("Issuing %zu node operational certificates\n", kCount);
+#endif
+    ReturnErrorOnFailure(BenchmarkSingleIssuance(issuer));
+    for (unsigned threadCount : { 1u, 2u, 4u, 8u })
+    {
+        ReturnErrorOnFailure(BenchmarkBatchIssuance(ctx, issuer, threadCount));
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+int main()
+{
+    chip::Test::IOContext ctx;
+
+    if (ctx.Init(nullptr) != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to initialize the system layer\n");
+        return EXIT_FAILURE;
+    }
+
+    CHIP_ERROR err = RunBenchmarks(ctx);
+    if (err != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to issue the certificates: %s\n", chip::ErrorStr(err));
+    }
+
+    ctx.Shutdown();
+    return (err == CHIP_NO_ERROR) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+int main()
+{
+    printf("The crypto worker pool is not supported on this platform\n");
+    return EXIT_SUCCESS;
+}
+
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
@@ -0,0 +1,209 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the DeviceTable, and for the eviction of
+ *      active devices by the device controller and commissioner.
+ *
+ */
+
+#include <controller/CHIPDeviceController.h>
+#include <controller/DeviceTable.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace chip {
+namespace Controller {
+
+class TestDeviceCommissioner
+{
+public:
+    static void CheckCommissionerKeepsDeviceBeingPaired(nlTestSuite * inSuite, void * inContext)
+    {
+        DeviceCommissioner commissioner;
+        NL_TEST_ASSERT(inSuite, commissioner.mActiveDevices.Init(2) == CHIP_NO_ERROR);
+
+        Device * beingPaired = commissioner.AllocateDevice(1);
+        Device * idle        = commissioner.AllocateDevice(2);
+        NL_TEST_ASSERT(inSuite, beingPaired != nullptr && idle != nullptr);
+        commissioner.mDeviceBeingPaired = beingPaired;
+
+        // Node 1 is the least recently used device, but it is exempt from eviction while it is being paired.
+        Device * device = commissioner.AllocateDevice(3);
+        NL_TEST_ASSERT(inSuite, device != nullptr);
+        NL_TEST_ASSERT(inSuite, commissioner.mActiveDevices.FindDevice(1) == beingPaired);
+        NL_TEST_ASSERT(inSuite, commissioner.mActiveDevices.FindDevice(2) == nullptr);
+        NL_TEST_ASSERT(inSuite, commissioner.mActiveDevices.ActiveCount() == 2);
+
+        // Once pairing is over, the device can be evicted like any other.
+        commissioner.mDeviceBeingPaired = nullptr;
+        commissioner.mActiveDevices.FindDevice(3);
+        NL_TEST_ASSERT(inSuite, commissioner.AllocateDevice(4) != nullptr);
+        NL_TEST_ASSERT(inSuite, commissioner.mActiveDevices.FindDevice(1) == nullptr);
+        NL_TEST_ASSERT(inSuite, commissioner.mActiveDevices.FindDevice(3) != nullptr);
+
+        commissioner.mActiveDevices.Shutdown();
+    }
+};
+
+} // namespace Controller
+} // namespace chip
+
+namespace {
+
+using namespace chip;
+using namespace chip::Controller;
+
+void CheckAllocateAndFind(nlTestSuite * inSuite, void * inContext)
+{
+    DeviceTable table;
+    NL_TEST_ASSERT(inSuite, table.Init(0) == CHIP_NO_ERROR);
+
+    // Allocate enough devices to grow the hash table, eviction is disabled so the table is never full.
+    constexpr NodeId kDeviceCount = 100;
+    Device * devices[kDeviceCount];
+    for (NodeId id = 0; id < kDeviceCount; id++)
+    {
+        devices[id] = table.AllocateDevice(id + 1);
+        NL_TEST_ASSERT(inSuite, devices[id] != nullptr);
+        NL_TEST_ASSERT(inSuite, devices[id]->IsActive());
+        NL_TEST_ASSERT(inSuite, !table.IsFull());
+    }
+    NL_TEST_ASSERT(inSuite, table.ActiveCount() == kDeviceCount);
+
+    for (NodeId id = 0; id < kDeviceCount; id++)
+    {
+        NL_TEST_ASSERT(inSuite, table.FindDevice(id + 1) == devices[id]);
+    }
+    NL_TEST_ASSERT(inSuite, table.FindDevice(kDeviceCount + 1) == nullptr);
+
+    // A node has at most one active device object.
+    NL_TEST_ASSERT(inSuite, table.AllocateDevice(1) == nullptr);
+    NL_TEST_ASSERT(inSuite, table.ActiveCount() == kDeviceCount);
+}
+
+void CheckEvictLeastRecentlyUsed(nlTestSuite * inSuite, void * inContext)
+{
+    DeviceTable table;
+    NL_TEST_ASSERT(inSuite, table.Init(2) == CHIP_NO_ERROR);
+
+    Device * first  = table.AllocateDevice(1);
+    Device * second = table.AllocateDevice(2);
+    NL_TEST_ASSERT(inSuite, first != nullptr && second != nullptr);
+    NL_TEST_ASSERT(inSuite, table.IsFull());
+
+    auto canEvict = [](Device * device) { return true; };
+    NL_TEST_ASSERT(inSuite, table.FindEvictionCandidate(canEvict) == first);
+
+    // Looking a device up makes it the most recently used one.
+    NL_TEST_ASSERT(inSuite, table.FindDevice(1) == first);
+    NL_TEST_ASSERT(inSuite, table.FindEvictionCandidate(canEvict) == second);
+
+    // Devices that cannot be evicted are skipped.
+    NL_TEST_ASSERT(inSuite, table.FindEvictionCandidate([second](Device * device) { return device != second; }) == first);
+    NL_TEST_ASSERT(inSuite, table.FindEvictionCandidate([](Device * device) { return false; }) == nullptr);
+
+    table.ReleaseDevice(second);
+    NL_TEST_ASSERT(inSuite, !second->IsActive());
+    NL_TEST_ASSERT(inSuite, !table.IsFull());
+    NL_TEST_ASSERT(inSuite, table.ActiveCount() == 1);
+    NL_TEST_ASSERT(inSuite, table.FindDevice(2) == nullptr);
+
+    // The device was never connected, so none of its state is cached.
+    SerializableDevice serializable;
+    NL_TEST_ASSERT(inSuite, !table.TakeCachedState(2, serializable));
+}
+
+void CheckRelookupAfterRelease(nlTestSuite * inSuite, void * inContext)
+{
+    DeviceTable table;
+    NL_TEST_ASSERT(inSuite, table.Init(2) == CHIP_NO_ERROR);
+
+    Device * first = table.AllocateDevice(1);
+    NL_TEST_ASSERT(inSuite, first != nullptr);
+    table.ReleaseDevice(first);
+    NL_TEST_ASSERT(inSuite, table.FindDevice(1) == nullptr);
+
+    // Released device objects are recycled, so an application pointer to a released device
+    // refers to whichever node the object is allocated to next.
+    Device * other = table.AllocateDevice(3);
+    NL_TEST_ASSERT(inSuite, other == first);
+    NL_TEST_ASSERT(inSuite, table.FindDevice(3) == other);
+
+    // The released node can be allocated again.
+    Device * again = table.AllocateDevice(1);
+    NL_TEST_ASSERT(inSuite, again != nullptr && again != other);
+    NL_TEST_ASSERT(inSuite, table.FindDevice(1) == again);
+
+    table.RemoveDevice(3);
+    NL_TEST_ASSERT(inSuite, table.FindDevice(3) == nullptr);
+    NL_TEST_ASSERT(inSuite, table.ActiveCount() == 1);
+}
+
+void CheckEvictionIsOptIn(nlTestSuite * inSuite, void * inContext)
+{
+    ControllerInitParams params;
+    NL_TEST_ASSERT(inSuite, params.maxActiveDevices == 0);
+}
+
+int Initialize(void * aContext)
+{
+    return (chip::Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int Finalize(void * aContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("AllocateAndFind", CheckAllocateAndFind),
+    NL_TEST_DEF("EvictLeastRecentlyUsed", CheckEvictLeastRecentlyUsed),
+    NL_TEST_DEF("RelookupAfterRelease", CheckRelookupAfterRelease),
+    NL_TEST_DEF("EvictionIsOptIn", CheckEvictionIsOptIn),
+    NL_TEST_DEF("CommissionerKeepsDeviceBeingPaired", TestDeviceCommissioner::CheckCommissionerKeepsDeviceBeingPaired),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestDeviceTable()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Controller-DeviceTable",
+        &sTests[0],
+        Initialize,
+        Finalize
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDeviceTable)
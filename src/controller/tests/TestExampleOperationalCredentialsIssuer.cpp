@@ -0,0 +1,267 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the batch issuance of node operational
+ *      certificates by the ExampleOperationalCredentialsIssuer.
+ *
+ */
+
+#include <controller/ExampleOperationalCredentialsIssuer.h>
+#include <credentials/CHIPCert.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <nlunit-test.h>
+
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+#include <map>
+#include <string>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Controller;
+using namespace chip::Credentials;
+using namespace chip::Crypto;
+
+using TestContext = chip::Test::IOContext;
+
+TestContext sContext;
+
+constexpr FabricId kFabricId   = 0x8888;
+constexpr size_t kCertArrayLen = 2 * kMaxCHIPCertLength;
+
+class TestPersistentStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        auto it = mValues.find(key);
+        VerifyOrReturnError(it != mValues.end(), CHIP_ERROR_KEY_NOT_FOUND);
+        VerifyOrReturnError(it->second.size() <= size, CHIP_ERROR_BUFFER_TOO_SMALL);
+        memcpy(buffer, it->second.data(), it->second.size());
+        size = static_cast<uint16_t>(it->second.size());
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mValues[key] = std::string(static_cast<const char *>(value), size);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override
+    {
+        mValues.erase(key);
+        return CHIP_NO_ERROR;
+    }
+
+private:
+    std::map<std::string, std::string> mValues;
+};
+
+struct CSR
+{
+    uint8_t mBuf[kMAX_CSR_Length];
+    size_t mLen;
+};
+
+CHIP_ERROR GenerateCSRs(CSR * csrs, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        P256Keypair keypair;
+        ReturnErrorOnFailure(keypair.Initialize());
+        csrs[i].mLen = sizeof(csrs[i].mBuf);
+        ReturnErrorOnFailure(keypair.NewCertificateSigningRequest(csrs[i].mBuf, csrs[i].mLen));
+    }
+    return CHIP_NO_ERROR;
+}
+
+struct BatchResult
+{
+    bool mDone = false;
+};
+
+void OnBatchGenerated(void * context, NOCBatchRequest * requests, size_t count)
+{
+    static_cast<BatchResult *>(context)->mDone = true;
+}
+
+void CheckBatchIssuance(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx       = *reinterpret_cast<TestContext *>(inContext);
+    constexpr size_t kCount = 8;
+
+    TestPersistentStorageDelegate storage;
+    ExampleOperationalCredentialsIssuer issuer;
+    NL_TEST_ASSERT(inSuite, issuer.Initialize(storage) == CHIP_NO_ERROR);
+
+    static CSR csrs[kCount];
+    static uint8_t certArrays[kCount][kCertArrayLen];
+    NOCBatchRequest requests[kCount];
+    NL_TEST_ASSERT(inSuite, GenerateCSRs(csrs, kCount) == CHIP_NO_ERROR);
+    for (size_t i = 0; i < kCount; i++)
+    {
+        requests[i].mCSR           = ByteSpan(csrs[i].mBuf, csrs[i].mLen);
+        requests[i].mChipCertArray = MutableByteSpan(certArrays[i], kCertArrayLen);
+    }
+    requests[2].mNodeId.SetValue(0x1234);
+    requests[5].mCSR = ByteSpan(csrs[5].mBuf, csrs[5].mLen / 2);
+
+    BatchResult result;
+    Callback::Callback<NOCBatchGenerated> onBatchGenerated(OnBatchGenerated, &result);
+
+    // The worker threads must be started first.
+    NL_TEST_ASSERT(inSuite,
+                   issuer.GenerateNodeOperationalCertificates(kFabricId, requests, kCount, &onBatchGenerated) ==
+                       CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, issuer.InitBatchIssuance(ctx.GetSystemLayer(), 4) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite,
+                   issuer.GenerateNodeOperationalCertificates(kFabricId, requests, kCount, &onBatchGenerated) == CHIP_NO_ERROR);
+
+    // Only one batch may be in progress at a time.
+    NL_TEST_ASSERT(inSuite,
+                   issuer.GenerateNodeOperationalCertificates(kFabricId, requests, kCount, &onBatchGenerated) ==
+                       CHIP_ERROR_INCORRECT_STATE);
+
+    ctx.DriveIOUntil(5000, [&result] { return result.mDone; });
+    NL_TEST_ASSERT(inSuite, result.mDone);
+
+    // Validate the issued certificates against the root certificate.
+    uint8_t x509Root[kMaxCHIPDERCertLength];
+    MutableByteSpan x509RootSpan(x509Root);
+    static uint8_t root[kMaxCHIPCertLength];
+    uint32_t rootLen = 0;
+    NL_TEST_ASSERT(inSuite, issuer.GetRootCACertificate(kFabricId, x509RootSpan) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ConvertX509CertToChipCert(x509RootSpan, root, sizeof(root), rootLen) == CHIP_NO_ERROR);
+
+    // Validate at the start of 2022, within the validity period of the certificates.
+    ASN1::ASN1UniversalTime effectiveTime;
+    CHIP_ZERO_AT(effectiveTime);
+    effectiveTime.Year  = 2022;
+    effectiveTime.Month = 1;
+    effectiveTime.Day   = 1;
+
+    uint32_t effectiveEpoch = 0;
+    NL_TEST_ASSERT(inSuite, ASN1ToChipEpochTime(effectiveTime, effectiveEpoch) == CHIP_NO_ERROR);
+
+    uint64_t previousNodeId = 0;
+    for (size_t i = 0; i < kCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, requests[i].mNodeId.HasValue());
+        if (i == 5)
+        {
+            NL_TEST_ASSERT(inSuite, requests[i].mStatus != CHIP_NO_ERROR);
+            continue;
+        }
+        NL_TEST_ASSERT(inSuite, requests[i].mStatus == CHIP_NO_ERROR);
+
+        ByteSpan noc, icac;
+        NL_TEST_ASSERT(inSuite, ExtractCertsFromCertArray(requests[i].mChipCertArray, noc, icac) == CHIP_NO_ERROR);
+
+        ChipCertificateSet certSet;
+        NL_TEST_ASSERT(inSuite, certSet.Init(3, kMaxCHIPCertDecodeBufLength) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       certSet.LoadCert(root, rootLen,
+                                        BitFlags<CertDecodeFlags>(CertDecodeFlags::kIsTrustAnchor)
+                                            .Set(CertDecodeFlags::kGenerateTBSHash)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       certSet.LoadCert(icac.data(), static_cast<uint32_t>(icac.size()),
+                                        BitFlags<CertDecodeFlags>(CertDecodeFlags::kGenerateTBSHash)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite,
+                       certSet.LoadCert(noc.data(), static_cast<uint32_t>(noc.size()),
+                                        BitFlags<CertDecodeFlags>(CertDecodeFlags::kGenerateTBSHash)) == CHIP_NO_ERROR);
+
+        ValidationContext validContext;
+        validContext.Reset();
+        validContext.mEffectiveTime = effectiveEpoch;
+        validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+        NL_TEST_ASSERT(inSuite, certSet.ValidateCert(certSet.GetLastCert(), validContext) == CHIP_NO_ERROR);
+
+        // The certificate is issued to the requested node ID, or to the next available ones in order.
+        uint64_t nodeId = 0;
+        NL_TEST_ASSERT(inSuite, certSet.GetLastCert()->mSubjectDN.GetCertChipId(nodeId) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, nodeId == requests[i].mNodeId.Value());
+        NL_TEST_ASSERT(inSuite, (i == 2) ? (nodeId == 0x1234) : (nodeId > previousNodeId));
+        if (i != 2)
+        {
+            previousNodeId = nodeId;
+        }
+
+        certSet.Release();
+    }
+
+    issuer.ShutdownBatchIssuance();
+}
+
+int Initialize(void * aContext);
+int Finalize(void * aContext);
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("BatchIssuance", CheckBatchIssuance),
+    NL_TEST_SENTINEL()
+};
+
+nlTestSuite sSuite =
+{
+    "Controller-ExampleOperationalCredentialsIssuer",
+    &sTests[0],
+    Initialize,
+    Finalize
+};
+// clang-format on
+
+int Initialize(void * aContext)
+{
+    CHIP_ERROR err = reinterpret_cast<TestContext *>(aContext)->Init(&sSuite);
+    return (err == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int Finalize(void * aContext)
+{
+    CHIP_ERROR err = reinterpret_cast<TestContext *>(aContext)->Shutdown();
+    return (err == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+} // namespace
+
+int TestExampleOperationalCredentialsIssuer()
+{
+    nlTestRunner(&sSuite, &sContext);
+    return nlTestRunnerStats(&sSuite);
+}
+
+#else // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+int TestExampleOperationalCredentialsIssuer()
+{
+    return SUCCESS;
+}
+
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+CHIP_REGISTER_TEST_SUITE(TestExampleOperationalCredentialsIssuer)
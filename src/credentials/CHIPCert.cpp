@@ -37,9 +37,11 @@
 #include <core/CHIPSafeCasts.h>
 #include <core/CHIPTLV.h>
 #include <credentials/CHIPCert.h>
+#include <credentials/VerifiedCertCache.h>
 #include <protocols/Protocols.h>
 #include <support/CHIPMem.h>
 #include <support/CodeUtils.h>
+#include <support/Pool.h>
 #include <support/TimeUtils.h>
 
 namespace chip {
@@ -53,6 +55,55 @@ using namespace chip::Crypto;
 extern CHIP_ERROR DecodeConvertTBSCert(TLVReader & reader, ASN1Writer & writer, ChipCertificateData & certData);
 extern CHIP_ERROR DecodeECDSASignature(TLVReader & reader, ChipCertificateData & certData);
 
+struct CertificateDecodeState
+{
+    ChipCertificateData mCerts[CertificateDecodeHandle::kMaxCerts];
+    uint8_t mDecodeBuf[kMaxCHIPCertDecodeBufLength];
+};
+
+#if CHIP_CONFIG_CERT_DECODE_POOL_SIZE > 0
+static BitMapObjectPool<CertificateDecodeState, CHIP_CONFIG_CERT_DECODE_POOL_SIZE> sCertificateDecodePool;
+#endif
+
+CertificateDecodeHandle & CertificateDecodeHandle::operator=(CertificateDecodeHandle && aOther)
+{
+    if (this != &aOther)
+    {
+        Release();
+        mState        = aOther.mState;
+        aOther.mState = nullptr;
+    }
+
+    return *this;
+}
+
+CertificateDecodeHandle CertificateDecodeHandle::Acquire()
+{
+    CertificateDecodeHandle handle;
+#if CHIP_CONFIG_CERT_DECODE_POOL_SIZE > 0
+    handle.mState = sCertificateDecodePool.CreateObject();
+#endif
+    return handle;
+}
+
+void CertificateDecodeHandle::Release()
+{
+#if CHIP_CONFIG_CERT_DECODE_POOL_SIZE > 0
+    sCertificateDecodePool.ReleaseObject(mState);
+#endif
+    mState = nullptr;
+}
+
+ChipCertificateData * CertificateDecodeHandle::GetCerts() const
+{
+    return (mState != nullptr) ? mState->mCerts : nullptr;
+}
+
+uint8_t * CertificateDecodeHandle::GetDecodeBuf() const
+{
+    return (mState != nullptr) ? mState->mDecodeBuf : nullptr;
+}
+
 ChipCertificateSet::ChipCertificateSet()
 {
     mCerts               = nullptr;
@@ -117,9 +168,28 @@ exit:
     return err;
 }
 
+CHIP_ERROR ChipCertificateSet::Init(CertificateDecodeHandle && decodeState)
+{
+    VerifyOrReturnError(!decodeState.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    ReturnErrorOnFailure(
+        Init(decodeState.GetCerts(), CertificateDecodeHandle::kMaxCerts, decodeState.GetDecodeBuf(), kMaxCHIPCertDecodeBufLength));
+    mDecodeState = std::move(decodeState);
+
+    return CHIP_NO_ERROR;
+}
+
 void ChipCertificateSet::Release()
 {
-    if (mMemoryAllocInternal)
+    if (!mDecodeState.IsNull())
+    {
+        Clear();
+        mDecodeState.Release();
+        mCerts     = nullptr;
+        mMaxCerts  = 0;
+        mDecodeBuf = nullptr;
+    }
+    else if (mMemoryAllocInternal)
     {
         if (mCerts != nullptr)
         {
@@ -186,6 +256,18 @@ CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeF
 
     cert.mCertificate = chipCert;
 
+    // If the same encoding was decoded before, reuse the decoded data rather than converting the TBS portion again.
+    if (!chipCert.empty() && VerifiedCertCache::Instance().GetDecodedCert(chipCert, cert))
+    {
+        if (!decodeFlags.Has(CertDecodeFlags::kGenerateTBSHash))
+        {
+            cert.mCertFlags.Clear(CertFlags::kTBSHashPresent);
+            memset(cert.mTBSHash, 0, sizeof(cert.mTBSHash));
+        }
+
+        ReturnErrorOnFailure(reader.Skip());
+    }
+    else
     {
         TLVType containerType;
 
@@ -222,6 +304,8 @@ CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeF
         ReturnErrorOnFailure(reader.VerifyEndOfContainer());
 
         ReturnErrorOnFailure(reader.ExitContainer(containerType));
+
+        VerifiedCertCache::Instance().AddDecodedCert(cert);
     }
 
     // If requested by the caller, mark the certificate as trusted.
@@ -230,6 +314,11 @@ CHIP_ERROR ChipCertificateSet::LoadCert(TLVReader & reader, BitFlags<CertDecodeF
         cert.mCertFlags.Set(CertFlags::kIsTrustAnchor);
     }
 
+    return LoadCert(cert);
+}
+
+CHIP_ERROR ChipCertificateSet::LoadCert(const ChipCertificateData & cert)
+{
     // Check if this cert matches any currently loaded certificates
     for (uint32_t i = 0; i < mCertCount; i++)
     {
@@ -389,6 +478,12 @@ CHIP_ERROR ChipCertificateSet::VerifySignature(const ChipCertificateData * cert,
     P256ECDSASignature signature;
     uint16_t derSigLen;
 
+    // Skip the verification if this signature was already verified with the same CA public key.
+    if (VerifiedCertCache::Instance().IsSignatureVerified(*cert, *caCert))
+    {
+        return CHIP_NO_ERROR;
+    }
+
     ReturnErrorOnFailure(
         ConvertECDSASignatureRawToDER(cert->mSignature, signature, static_cast<uint16_t>(signature.Capacity()), derSigLen));
 
@@ -398,6 +493,8 @@ CHIP_ERROR ChipCertificateSet::VerifySignature(const ChipCertificateData * cert,
 
     ReturnErrorOnFailure(caPublicKey.ECDSA_validate_hash_signature(cert->mTBSHash, chip::Crypto::kSHA256_Hash_Length, signature));
 
+    VerifiedCertCache::Instance().AddVerifiedSignature(*cert, *caCert);
+
     return CHIP_NO_ERROR;
 }
 
@@ -476,7 +573,12 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
     }
     if (cert->mNotAfterTime != 0 && !validateFlags.Has(CertValidateFlags::kIgnoreNotAfter))
     {
-        VerifyOrExit(context.mEffectiveTime <= cert->mNotAfterTime, err = CHIP_ERROR_CERT_EXPIRED);
+        if (context.mEffectiveTime > cert->mNotAfterTime)
+        {
+            // Expired certificates are not worth caching anymore.
+            VerifiedCertCache::Instance().RemoveCert(*cert);
+            ExitNow(err = CHIP_ERROR_CERT_EXPIRED);
+        }
     }
 
     // If the certificate itself is trusted, then it is implicitly valid.  Record this certificate as the trust
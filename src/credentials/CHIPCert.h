@@ -28,6 +28,7 @@
 #pragma once
 
 #include <string.h>
+#include <utility>
 
 #include <asn1/ASN1.h>
 #include <core/CHIPConfig.h>
@@ -350,6 +351,51 @@ struct ValidationContext
     void Reset();
 };
 
+struct CertificateDecodeState;
+
+/**
+ *  @class CertificateDecodeHandle
+ *
+ *  @brief
+ *    Move-only handle to a certificate decode state of the process-wide, fixed-capacity
+ *    pool: an array of kMaxCerts certificate data entries and a decode buffer of
+ *    kMaxCHIPCertDecodeBufLength bytes. The state returns to the pool when the handle
+ *    is released or destroyed.
+ */
+class DLL_EXPORT CertificateDecodeHandle
+{
+public:
+    static constexpr uint8_t kMaxCerts = 3; /**< Enough for a NOC, an ICA certificate and a root certificate. */
+
+    CertificateDecodeHandle() {}
+    CertificateDecodeHandle(CertificateDecodeHandle && aOther) : mState(aOther.mState) { aOther.mState = nullptr; }
+    CertificateDecodeHandle & operator=(CertificateDecodeHandle && aOther);
+    ~CertificateDecodeHandle() { Release(); }
+
+    CertificateDecodeHandle(const CertificateDecodeHandle &) = delete;
+    CertificateDecodeHandle & operator=(const CertificateDecodeHandle &) = delete;
+
+    /**
+     * @brief Take a certificate decode state from the pool.
+     *
+     * @return A handle to the state, or a null handle if all the states are in use.
+     **/
+    static CertificateDecodeHandle Acquire();
+
+    /**
+     * @brief Return the certificate decode state to the pool.
+     **/
+    void Release();
+
+    bool IsNull() const { return mState == nullptr; }
+
+    ChipCertificateData * GetCerts() const;
+    uint8_t * GetDecodeBuf() const;
+
+private:
+    CertificateDecodeState * mState = nullptr;
+};
+
 /**
  *  @class ChipCertificateSet
  *
@@ -373,6 +419,7 @@ public:
         aOther.mDecodeBuf    = nullptr;
         mDecodeBufSize       = aOther.mDecodeBufSize;
         mMemoryAllocInternal = aOther.mMemoryAllocInternal;
+        mDecodeState         = std::move(aOther.mDecodeState);
 
         return *this;
     }
@@ -403,6 +450,18 @@ public:
      **/
     CHIP_ERROR Init(ChipCertificateData * certsArray, uint8_t certsArraySize, uint8_t * decodeBuf, uint16_t decodeBufSize);
 
+    /**
+     * @brief Initialize ChipCertificateSet.
+     *        This initialization method is used when the memory structures needed for operation are
+     *        borrowed from the certificate decode pool, e.g. during a CASE handshake, so that no heap
+     *        allocation is made. The set holds the decode state until it is released.
+     *
+     * @param decodeState  A handle to a certificate decode state, which the set takes.
+     *
+     * @return Returns CHIP_ERROR_NO_MEMORY if the handle is null, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR Init(CertificateDecodeHandle && decodeState);
+
     /**
      * @brief Release resources allocated by this class.
      **/
@@ -442,6 +501,17 @@ public:
      **/
     CHIP_ERROR LoadCert(chip::TLV::TLVReader & reader, BitFlags<CertDecodeFlags> decodeFlags, ByteSpan chipCert = ByteSpan());
 
+    /**
+     * @brief Load already decoded CHIP certificate data into set.
+     *        It is required that the CHIP certificate buffer referenced by the certificate data stays valid while
+     *        the certificate data in the set is used.
+     *
+     * @param cert  Certificate data, e.g. as previously loaded into another set.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
+    CHIP_ERROR LoadCert(const ChipCertificateData & cert);
+
     /**
      * @brief Load CHIP certificates into set.
      *        It is required that the CHIP certificates in the chipCerts buffer stays valid while
@@ -551,6 +621,8 @@ private:
     uint16_t mDecodeBufSize;      /**< Certificate decode buffer size. */
     bool mMemoryAllocInternal;    /**< Indicates whether temporary memory buffers are allocated internally. */
 
+    CertificateDecodeHandle mDecodeState; /**< Certificate decode state the memory buffers are borrowed from, if any. */
+
     /**
      * @brief Find and validate CHIP certificate.
      *
@@ -759,6 +831,56 @@ CHIP_ERROR NewNodeOperationalX509Cert(const X509CertRequestParams & requestParam
                                       const Crypto::P256PublicKey & subjectPubkey, Crypto::P256Keypair & issuerKeypair,
                                       uint8_t * x509CertBuf, uint32_t x509CertBufSize, uint32_t & x509CertLen);
 
+/**
+ * @brief The parts of the X.509 certificates issued by a CA that only depend on the issuer: the issuer DN, and the
+ *        authority key identifier extension. They are encoded once by EncodeX509Issuer(), and then copied into each
+ *        certificate issued with them, e.g. when issuing node operational certificates in bulk.
+ **/
+struct X509IssuerEncoding
+{
+    static constexpr uint16_t kMaxDNLength                      = 80;
+    static constexpr uint16_t kMaxAuthorityKeyIdExtensionLength = 40;
+
+    uint64_t Issuer;
+    bool HasFabricID;
+    uint64_t FabricID;
+    Crypto::P256PublicKey IssuerPubkey;
+    uint8_t DN[kMaxDNLength];
+    uint16_t DNLen;
+    uint8_t AuthorityKeyIdExtension[kMaxAuthorityKeyIdExtensionLength];
+    uint16_t AuthorityKeyIdExtensionLen;
+};
+
+/**
+ * @brief Encode the parts of the X.509 certificates issued by a CA that only depend on the issuer
+ *
+ * @param requestParams   Certificate request parameters. Only the issuer and fabric IDs are used.
+ * @param issuerLevel     Indicates if the issuer is a root CA or an intermediate CA
+ * @param issuerPubkey    The public key of the issuer
+ * @param issuer          The encoded issuer DN and authority key identifier extension.
+ *
+ * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+ **/
+CHIP_ERROR EncodeX509Issuer(const X509CertRequestParams & requestParams, CertificateIssuerLevel issuerLevel,
+                            const Crypto::P256PublicKey & issuerPubkey, X509IssuerEncoding & issuer);
+
+/**
+ * @brief Generate a new X.509 DER encoded Node operational certificate, with the issuer encoded by EncodeX509Issuer()
+ *
+ * @param requestParams   Certificate request parameters. The issuer and fabric IDs must match the ones of the issuer.
+ * @param issuer          The encoded issuer, which public key must be the one of issuerKeypair
+ * @param subjectPubkey   The public key of subject
+ * @param issuerKeypair   The certificate signing key
+ * @param x509CertBuf     Buffer to store signed certificate in X.509 DER format.
+ * @param x509CertBufSize The size of the buffer to store converted certificate.
+ * @param x509CertLen     The length of the converted certificate.
+ *
+ * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+ **/
+CHIP_ERROR NewNodeOperationalX509Cert(const X509CertRequestParams & requestParams, const X509IssuerEncoding & issuer,
+                                      const Crypto::P256PublicKey & subjectPubkey, Crypto::P256Keypair & issuerKeypair,
+                                      uint8_t * x509CertBuf, uint32_t x509CertBufSize, uint32_t & x509CertLen);
+
 /**
  * @brief
  *   Convert a certificate date/time (in the form of an ASN.1 universal time structure) into a CHIP Epoch UTC time.
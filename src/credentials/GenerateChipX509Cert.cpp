@@ -28,6 +28,7 @@
 
 #include <inttypes.h>
 #include <stddef.h>
+#include <string.h>
 
 #include <asn1/ASN1.h>
 #include <asn1/ASN1Macros.h>
@@ -236,7 +237,7 @@ exit:
     return err;
 }
 
-CHIP_ERROR EncodeExtensions(bool isCA, const Crypto::P256PublicKey & SKI, const Crypto::P256PublicKey & AKI, ASN1Writer & writer)
+CHIP_ERROR EncodeExtensions(bool isCA, const Crypto::P256PublicKey & SKI, const X509IssuerEncoding & issuer, ASN1Writer & writer)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
@@ -255,7 +256,7 @@ CHIP_ERROR EncodeExtensions(bool isCA, const Crypto::P256PublicKey & SKI, const
 
             ReturnErrorOnFailure(EncodeSubjectKeyIdentifierExtension(SKI, writer));
 
-            ReturnErrorOnFailure(EncodeAuthorityKeyIdentifierExtension(AKI, writer));
+            ReturnErrorOnFailure(writer.PutConstructedType(issuer.AuthorityKeyIdExtension, issuer.AuthorityKeyIdExtensionLen));
         }
         ASN1_END_SEQUENCE;
     }
@@ -327,9 +328,8 @@ exit:
 
 } // namespace
 
-CHIP_ERROR EncodeTBSCert(const X509CertRequestParams & requestParams, CertificateIssuerLevel issuerLevel, uint64_t subject,
-                         const Crypto::P256PublicKey & subjectPubkey, const Crypto::P256PublicKey & issuerPubkey,
-                         ASN1Writer & writer)
+CHIP_ERROR EncodeTBSCert(const X509CertRequestParams & requestParams, const X509IssuerEncoding & issuer, uint64_t subject,
+                         const Crypto::P256PublicKey & subjectPubkey, ASN1Writer & writer)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     ChipDNParams dnParams[2];
@@ -353,24 +353,8 @@ CHIP_ERROR EncodeTBSCert(const X509CertRequestParams & requestParams, Certificat
         ASN1_START_SEQUENCE { ASN1_ENCODE_OBJECT_ID(kOID_SigAlgo_ECDSAWithSHA256); }
         ASN1_END_SEQUENCE;
 
-        // Issuer OID depends on if cert is being signed by the root CA
-        if (issuerLevel == kIssuerIsRootCA)
-        {
-            dnParams[0].AttrOID = chip::ASN1::kOID_AttributeType_ChipRootId;
-        }
-        else
-        {
-            dnParams[0].AttrOID = chip::ASN1::kOID_AttributeType_ChipICAId;
-        }
-        dnParams[0].Value = requestParams.Issuer;
-
-        if (requestParams.HasFabricID)
-        {
-            dnParams[1].AttrOID = chip::ASN1::kOID_AttributeType_ChipFabricId;
-            dnParams[1].Value   = requestParams.FabricID;
-            numDNs              = 2;
-        }
-        ReturnErrorOnFailure(EncodeChipDNs(dnParams, numDNs, writer));
+        // issuer Name
+        ReturnErrorOnFailure(writer.PutConstructedType(issuer.DN, issuer.DNLen));
 
         // validity Validity,
         ReturnErrorOnFailure(EncodeValidity(requestParams.ValidityStart, requestParams.ValidityEnd, writer));
@@ -382,18 +366,28 @@ CHIP_ERROR EncodeTBSCert(const X509CertRequestParams & requestParams, Certificat
 
             isCA = false;
         }
-        else if (subjectPubkey != issuerPubkey)
+        else if (memcmp(subjectPubkey, issuer.IssuerPubkey, subjectPubkey.Length()) != 0)
         {
             dnParams[0].AttrOID = chip::ASN1::kOID_AttributeType_ChipICAId;
         }
+        else
+        {
+            dnParams[0].AttrOID = chip::ASN1::kOID_AttributeType_ChipRootId;
+        }
         dnParams[0].Value = subject;
 
+        if (requestParams.HasFabricID)
+        {
+            dnParams[1].AttrOID = chip::ASN1::kOID_AttributeType_ChipFabricId;
+            dnParams[1].Value   = requestParams.FabricID;
+            numDNs              = 2;
+        }
         ReturnErrorOnFailure(EncodeChipDNs(dnParams, numDNs, writer));
 
         ReturnErrorOnFailure(EncodeSubjectPublicKeyInfo(subjectPubkey, writer));
 
         // certificate extensions
-        ReturnErrorOnFailure(EncodeExtensions(isCA, subjectPubkey, issuerPubkey, writer));
+        ReturnErrorOnFailure(EncodeExtensions(isCA, subjectPubkey, issuer, writer));
     }
     ASN1_END_SEQUENCE;
 
@@ -401,7 +395,7 @@ exit:
     return err;
 }
 
-CHIP_ERROR NewChipX509Cert(const X509CertRequestParams & requestParams, CertificateIssuerLevel issuerLevel, uint64_t subject,
+CHIP_ERROR NewChipX509Cert(const X509CertRequestParams & requestParams, const X509IssuerEncoding & issuer, uint64_t subject,
                            const Crypto::P256PublicKey & subjectPubkey, Crypto::P256Keypair & issuerKeypair, uint8_t * x509CertBuf,
                            uint32_t x509CertBufSize, uint32_t & x509CertLen)
 {
@@ -409,7 +403,7 @@ CHIP_ERROR NewChipX509Cert(const X509CertRequestParams & requestParams, Certific
     ASN1Writer writer;
     writer.Init(x509CertBuf, x509CertBufSize);
 
-    ReturnErrorOnFailure(EncodeTBSCert(requestParams, issuerLevel, subject, subjectPubkey, issuerKeypair.Pubkey(), writer));
+    ReturnErrorOnFailure(EncodeTBSCert(requestParams, issuer, subject, subjectPubkey, writer));
 
     Crypto::P256ECDSASignature signature;
     ReturnErrorOnFailure(issuerKeypair.ECDSA_sign_msg(x509CertBuf, writer.GetLengthWritten(), signature));
@@ -418,7 +412,7 @@ CHIP_ERROR NewChipX509Cert(const X509CertRequestParams & requestParams, Certific
 
     ASN1_START_SEQUENCE
     {
-        ReturnErrorOnFailure(EncodeTBSCert(requestParams, issuerLevel, subject, subjectPubkey, issuerKeypair.Pubkey(), writer));
+        ReturnErrorOnFailure(EncodeTBSCert(requestParams, issuer, subject, subjectPubkey, writer));
 
         ASN1_START_SEQUENCE { ASN1_ENCODE_OBJECT_ID(kOID_SigAlgo_ECDSAWithSHA256); }
         ASN1_END_SEQUENCE;
@@ -433,6 +427,57 @@ exit:
     return err;
 }
 
+CHIP_ERROR NewChipX509Cert(const X509CertRequestParams & requestParams, CertificateIssuerLevel issuerLevel, uint64_t subject,
+                           const Crypto::P256PublicKey & subjectPubkey, Crypto::P256Keypair & issuerKeypair, uint8_t * x509CertBuf,
+                           uint32_t x509CertBufSize, uint32_t & x509CertLen)
+{
+    X509IssuerEncoding issuer;
+    ReturnErrorOnFailure(EncodeX509Issuer(requestParams, issuerLevel, issuerKeypair.Pubkey(), issuer));
+    return NewChipX509Cert(requestParams, issuer, subject, subjectPubkey, issuerKeypair, x509CertBuf, x509CertBufSize,
+                           x509CertLen);
+}
+
+DLL_EXPORT CHIP_ERROR EncodeX509Issuer(const X509CertRequestParams & requestParams, CertificateIssuerLevel issuerLevel,
+                                       const Crypto::P256PublicKey & issuerPubkey, X509IssuerEncoding & issuer)
+{
+    ChipDNParams dnParams[2];
+    uint8_t numDNs = 1;
+    ASN1Writer writer;
+
+    // Issuer OID depends on if cert is being signed by the root CA
+    if (issuerLevel == kIssuerIsRootCA)
+    {
+        dnParams[0].AttrOID = chip::ASN1::kOID_AttributeType_ChipRootId;
+    }
+    else
+    {
+        dnParams[0].AttrOID = chip::ASN1::kOID_AttributeType_ChipICAId;
+    }
+    dnParams[0].Value = requestParams.Issuer;
+
+    if (requestParams.HasFabricID)
+    {
+        dnParams[1].AttrOID = chip::ASN1::kOID_AttributeType_ChipFabricId;
+        dnParams[1].Value   = requestParams.FabricID;
+        numDNs              = 2;
+    }
+
+    writer.Init(issuer.DN, sizeof(issuer.DN));
+    ReturnErrorOnFailure(EncodeChipDNs(dnParams, numDNs, writer));
+    issuer.DNLen = writer.GetLengthWritten();
+
+    writer.Init(issuer.AuthorityKeyIdExtension, sizeof(issuer.AuthorityKeyIdExtension));
+    ReturnErrorOnFailure(EncodeAuthorityKeyIdentifierExtension(issuerPubkey, writer));
+    issuer.AuthorityKeyIdExtensionLen = writer.GetLengthWritten();
+
+    issuer.Issuer       = requestParams.Issuer;
+    issuer.HasFabricID  = requestParams.HasFabricID;
+    issuer.FabricID     = requestParams.FabricID;
+    issuer.IssuerPubkey = issuerPubkey;
+
+    return CHIP_NO_ERROR;
+}
+
 DLL_EXPORT CHIP_ERROR NewRootX509Cert(const X509CertRequestParams & requestParams, Crypto::P256Keypair & issuerKeypair,
                                       uint8_t * x509CertBuf, uint32_t x509CertBufSize, uint32_t & x509CertLen)
 {
@@ -460,5 +505,19 @@ DLL_EXPORT CHIP_ERROR NewNodeOperationalX509Cert(const X509CertRequestParams & r
                            x509CertBufSize, x509CertLen);
 }
 
+DLL_EXPORT CHIP_ERROR NewNodeOperationalX509Cert(const X509CertRequestParams & requestParams, const X509IssuerEncoding & issuer,
+                                                 const Crypto::P256PublicKey & subjectPubkey, Crypto::P256Keypair & issuerKeypair,
+                                                 uint8_t * x509CertBuf, uint32_t x509CertBufSize, uint32_t & x509CertLen)
+{
+    VerifyOrReturnError(requestParams.HasNodeID, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(requestParams.HasFabricID && issuer.HasFabricID, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(requestParams.Issuer == issuer.Issuer && requestParams.FabricID == issuer.FabricID,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(memcmp(issuerKeypair.Pubkey(), issuer.IssuerPubkey, issuer.IssuerPubkey.Length()) == 0,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    return NewChipX509Cert(requestParams, issuer, requestParams.NodeID, subjectPubkey, issuerKeypair, x509CertBuf,
+                           x509CertBufSize, x509CertLen);
+}
+
 } // namespace Credentials
 } // namespace chip
@@ -0,0 +1,329 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the process-wide cache of decoded and verified
+ *      CHIP certificates.
+ *
+ */
+
+#include <credentials/VerifiedCertCache.h>
+
+#include <support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace Credentials {
+
+#if CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE > 0
+
+namespace {
+
+bool IsInBuffer(const uint8_t * data, size_t size, const ByteSpan & buffer)
+{
+    return data == nullptr ||
+        (data >= buffer.data() && data <= buffer.data() + buffer.size() &&
+         size <= static_cast<size_t>(buffer.data() + buffer.size() - data));
+}
+
+// Whether all the spans of the certificate data point into its mCertificate buffer.
+bool IsSelfContained(const ChipCertificateData & cert)
+{
+    for (const ChipDN * dn : { &cert.mSubjectDN, &cert.mIssuerDN })
+    {
+        for (const ChipRDN & rdn : dn->rdn)
+        {
+            if (!rdn.IsEmpty() && !IsInBuffer(rdn.mString.data(), rdn.mString.size(), cert.mCertificate))
+            {
+                return false;
+            }
+        }
+    }
+
+    return IsInBuffer(cert.mSubjectKeyId.data(), cert.mSubjectKeyId.size(), cert.mCertificate) &&
+        IsInBuffer(cert.mAuthKeyId.data(), cert.mAuthKeyId.size(), cert.mCertificate) &&
+        IsInBuffer(cert.mPublicKey.data(), cert.mPublicKey.size(), cert.mCertificate) &&
+        IsInBuffer(cert.mSignature.data(), cert.mSignature.size(), cert.mCertificate);
+}
+
+const uint8_t * Rebase(const uint8_t * data, const uint8_t * from, const uint8_t * to)
+{
+    return (data == nullptr) ? nullptr : to + (data - from);
+}
+
+// Copy self-contained certificate data, making its spans point into another copy of its buffer.
+void CopyCertData(const ChipCertificateData & source, const ByteSpan & target, ChipCertificateData & cert)
+{
+    const uint8_t * from = source.mCertificate.data();
+    const uint8_t * to   = target.data();
+
+    cert              = source;
+    cert.mCertificate = target;
+
+    for (ChipDN * dn : { &cert.mSubjectDN, &cert.mIssuerDN })
+    {
+        for (ChipRDN & rdn : dn->rdn)
+        {
+            if (!rdn.IsEmpty())
+            {
+                rdn.mString = ByteSpan(Rebase(rdn.mString.data(), from, to), rdn.mString.size());
+            }
+        }
+    }
+
+    cert.mSubjectKeyId = CertificateKeyId(Rebase(source.mSubjectKeyId.data(), from, to));
+    cert.mAuthKeyId    = CertificateKeyId(Rebase(source.mAuthKeyId.data(), from, to));
+    cert.mPublicKey    = P256PublicKeySpan(Rebase(source.mPublicKey.data(), from, to));
+    cert.mSignature    = P256ECDSASignatureSpan(Rebase(source.mSignature.data(), from, to));
+}
+
+} // namespace
+
+class VerifiedCertCache::ScopedLock
+{
+public:
+    explicit ScopedLock(VerifiedCertCache & cache) : mCache(cache) { mCache.Lock(); }
+    ~ScopedLock() { mCache.Unlock(); }
+
+private:
+    VerifiedCertCache & mCache;
+};
+
+VerifiedCertCache & VerifiedCertCache::Instance()
+{
+    static VerifiedCertCache sInstance;
+    return sInstance;
+}
+
+VerifiedCertCache::VerifiedCertCache()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    System::Mutex::Init(mLock);
+#endif
+    Clear();
+}
+
+void VerifiedCertCache::Lock()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    mLock.Lock();
+#endif
+}
+
+void VerifiedCertCache::Unlock()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    mLock.Unlock();
+#endif
+}
+
+VerifiedCertCache::Entry * VerifiedCertCache::Find(const ChipCertificateData & cert)
+{
+    VerifyOrReturnError(cert.mCertFlags.Has(CertFlags::kTBSHashPresent), nullptr);
+    VerifyOrReturnError(!cert.mSignature.empty() && !cert.mAuthKeyId.empty(), nullptr);
+
+    for (Entry & entry : mEntries)
+    {
+        if (entry.mLastUse != 0 && memcmp(entry.mTBSHash, cert.mTBSHash, sizeof(entry.mTBSHash)) == 0 &&
+            memcmp(entry.mSignature, cert.mSignature.data(), sizeof(entry.mSignature)) == 0 &&
+            memcmp(entry.mAuthKeyId, cert.mAuthKeyId.data(), sizeof(entry.mAuthKeyId)) == 0)
+        {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+VerifiedCertCache::Entry * VerifiedCertCache::FindOrAllocate(const ChipCertificateData & cert)
+{
+    VerifyOrReturnError(cert.mCertFlags.Has(CertFlags::kTBSHashPresent), nullptr);
+    VerifyOrReturnError(!cert.mSignature.empty() && !cert.mAuthKeyId.empty(), nullptr);
+
+    Entry * entry = Find(cert);
+    if (entry == nullptr)
+    {
+        // Replace a free entry, or else the least recently used one.
+        entry = &mEntries[0];
+        for (Entry & candidate : mEntries)
+        {
+            if (candidate.mLastUse < entry->mLastUse)
+            {
+                entry = &candidate;
+            }
+        }
+
+        memcpy(entry->mTBSHash, cert.mTBSHash, sizeof(entry->mTBSHash));
+        memcpy(entry->mSignature, cert.mSignature.data(), sizeof(entry->mSignature));
+        memcpy(entry->mAuthKeyId, cert.mAuthKeyId.data(), sizeof(entry->mAuthKeyId));
+        entry->mSignatureVerified = false;
+        entry->mCertLen           = 0;
+        entry->mCert.Clear();
+    }
+
+    Touch(*entry);
+    return entry;
+}
+
+void VerifiedCertCache::Touch(Entry & entry)
+{
+    entry.mLastUse = ++mUseCount;
+
+    // On wrap around, start over rather than confuse the oldest entries with free ones.
+    if (mUseCount == UINT32_MAX)
+    {
+        for (Entry & other : mEntries)
+        {
+            other.mLastUse = (&other == &entry) ? 1 : 0;
+        }
+        mUseCount = 1;
+    }
+}
+
+bool VerifiedCertCache::GetDecodedCert(const ByteSpan & chipCert, ChipCertificateData & cert)
+{
+    ScopedLock lock(*this);
+
+    for (Entry & entry : mEntries)
+    {
+        if (entry.mLastUse != 0 && entry.mCertLen != 0 && entry.mCertLen == chipCert.size() &&
+            memcmp(entry.mCertBuf, chipCert.data(), entry.mCertLen) == 0)
+        {
+            CopyCertData(entry.mCert, chipCert, cert);
+            Touch(entry);
+            mStats.mDecodeHits++;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void VerifiedCertCache::AddDecodedCert(const ChipCertificateData & cert)
+{
+    VerifyOrReturn(!cert.mCertificate.empty() && cert.mCertificate.size() <= kMaxCHIPCertLength);
+    VerifyOrReturn(!cert.mCertFlags.Has(CertFlags::kIsTrustAnchor));
+    VerifyOrReturn(IsSelfContained(cert));
+
+    ScopedLock lock(*this);
+
+    Entry * entry = FindOrAllocate(cert);
+    VerifyOrReturn(entry != nullptr);
+
+    // Different encodings may decode to the same certificate: keep the latest one.
+    memcpy(entry->mCertBuf, cert.mCertificate.data(), cert.mCertificate.size());
+    entry->mCertLen = static_cast<uint16_t>(cert.mCertificate.size());
+    CopyCertData(cert, ByteSpan(entry->mCertBuf, entry->mCertLen), entry->mCert);
+}
+
+bool VerifiedCertCache::IsSignatureVerified(const ChipCertificateData & cert, const ChipCertificateData & caCert)
+{
+    VerifyOrReturnError(!caCert.mPublicKey.empty(), false);
+
+    ScopedLock lock(*this);
+
+    Entry * entry = Find(cert);
+    VerifyOrReturnError(entry != nullptr && entry->mSignatureVerified, false);
+    VerifyOrReturnError(memcmp(entry->mCAPublicKey, caCert.mPublicKey.data(), sizeof(entry->mCAPublicKey)) == 0, false);
+
+    Touch(*entry);
+    mStats.mSignatureHits++;
+    return true;
+}
+
+void VerifiedCertCache::AddVerifiedSignature(const ChipCertificateData & cert, const ChipCertificateData & caCert)
+{
+    VerifyOrReturn(!caCert.mPublicKey.empty());
+
+    ScopedLock lock(*this);
+
+    Entry * entry = FindOrAllocate(cert);
+    VerifyOrReturn(entry != nullptr);
+
+    memcpy(entry->mCAPublicKey, caCert.mPublicKey.data(), sizeof(entry->mCAPublicKey));
+    entry->mSignatureVerified = true;
+}
+
+void VerifiedCertCache::RemoveCert(const ChipCertificateData & cert)
+{
+    ScopedLock lock(*this);
+
+    Entry * entry = Find(cert);
+    VerifyOrReturn(entry != nullptr);
+
+    entry->mLastUse = 0;
+    entry->mCertLen = 0;
+    entry->mCert.Clear();
+}
+
+void VerifiedCertCache::Clear()
+{
+    ScopedLock lock(*this);
+
+    for (Entry & entry : mEntries)
+    {
+        entry.mLastUse = 0;
+        entry.mCertLen = 0;
+        entry.mCert.Clear();
+    }
+    mUseCount = 0;
+    mStats    = {};
+}
+
+VerifiedCertCache::Stats VerifiedCertCache::GetStats()
+{
+    ScopedLock lock(*this);
+    return mStats;
+}
+
+#else // CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE > 0
+
+VerifiedCertCache & VerifiedCertCache::Instance()
+{
+    static VerifiedCertCache sInstance;
+    return sInstance;
+}
+
+bool VerifiedCertCache::GetDecodedCert(const ByteSpan & chipCert, ChipCertificateData & cert)
+{
+    return false;
+}
+
+void VerifiedCertCache::AddDecodedCert(const ChipCertificateData & cert) {}
+
+bool VerifiedCertCache::IsSignatureVerified(const ChipCertificateData & cert, const ChipCertificateData & caCert)
+{
+    return false;
+}
+
+void VerifiedCertCache::AddVerifiedSignature(const ChipCertificateData & cert, const ChipCertificateData & caCert) {}
+
+void VerifiedCertCache::RemoveCert(const ChipCertificateData & cert) {}
+
+void VerifiedCertCache::Clear() {}
+
+VerifiedCertCache::Stats VerifiedCertCache::GetStats()
+{
+    return Stats{};
+}
+
+#endif // CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE > 0
+
+} // namespace Credentials
+} // namespace chip
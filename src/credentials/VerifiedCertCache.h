@@ -0,0 +1,146 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the process-wide cache of decoded and verified
+ *      CHIP certificates used by ChipCertificateSet.
+ *
+ */
+
+#pragma once
+
+#include <credentials/CHIPCert.h>
+
+#if CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE > 0 && !CHIP_SYSTEM_CONFIG_NO_LOCKING
+#include <system/SystemMutex.h>
+#endif
+
+namespace chip {
+namespace Credentials {
+
+/**
+ *  @class VerifiedCertCache
+ *
+ *  @brief
+ *    Bounded, process-wide cache of decoded and verified CHIP certificates.
+ *
+ *    Each entry is keyed by the TBS hash of a certificate, its signature and
+ *    its issuer (authority) key identifier, and may record:
+ *      - the decoded certificate data, together with a copy of the CHIP TLV
+ *        encoding it was decoded from, so that loading the same encoding
+ *        again skips the conversion of the TBS section to DER and its hash;
+ *      - the public key of the CA that verified the certificate signature,
+ *        so that validating a chain with the same CA skips the ECDSA
+ *        signature verification.
+ *
+ *    A cached result is only used for the exact inputs it was computed from:
+ *    the decoded data for the same encoded bytes, the verified signature for
+ *    the same TBS hash, signature and CA public key. The validity window of
+ *    the certificate is still checked at each validation, and the entry of
+ *    a certificate found to be expired is removed. When the cache is full,
+ *    the least recently used entry is replaced.
+ *
+ *    The size of the cache is set by CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE;
+ *    with a size of 0, all lookups miss and nothing is recorded.
+ */
+class DLL_EXPORT VerifiedCertCache
+{
+public:
+    struct Stats
+    {
+        uint32_t mDecodeHits;    /**< Number of certificates loaded from the cache. */
+        uint32_t mSignatureHits; /**< Number of signature verifications skipped. */
+    };
+
+    static VerifiedCertCache & Instance();
+
+    /**
+     * @brief Get the decoded data of a CHIP certificate from the cache.
+     *
+     * @param chipCert  The CHIP TLV encoding of the certificate, which the spans of the
+     *                  returned data point into.
+     * @param cert      Set to the decoded certificate data, with its TBS hash, on success.
+     *
+     * @return True if the certificate was found, false otherwise.
+     **/
+    bool GetDecodedCert(const ByteSpan & chipCert, ChipCertificateData & cert);
+
+    /**
+     * @brief Record the decoded data of a CHIP certificate. Certificates without TBS hash, or
+     *        which data does not point into their mCertificate buffer, are not recorded.
+     **/
+    void AddDecodedCert(const ChipCertificateData & cert);
+
+    /**
+     * @brief Check whether the signature of a certificate was verified with the public key of a CA.
+     **/
+    bool IsSignatureVerified(const ChipCertificateData & cert, const ChipCertificateData & caCert);
+
+    /**
+     * @brief Record that the signature of a certificate was verified with the public key of a CA.
+     **/
+    void AddVerifiedSignature(const ChipCertificateData & cert, const ChipCertificateData & caCert);
+
+    /**
+     * @brief Remove the entry of a certificate, e.g. once it expired.
+     **/
+    void RemoveCert(const ChipCertificateData & cert);
+
+    /**
+     * @brief Remove all entries and reset the statistics.
+     **/
+    void Clear();
+
+    Stats GetStats();
+
+private:
+#if CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE > 0
+    struct Entry
+    {
+        uint8_t mTBSHash[Crypto::kSHA256_Hash_Length];
+        uint8_t mSignature[Crypto::kP256_ECDSA_Signature_Length_Raw];
+        uint8_t mAuthKeyId[kKeyIdentifierLength];
+        uint8_t mCAPublicKey[Crypto::kP256_Point_Length];
+        bool mSignatureVerified;
+        uint16_t mCertLen; /**< Length of mCertBuf, or 0 if the decoded data is not recorded. */
+        uint8_t mCertBuf[kMaxCHIPCertLength];
+        ChipCertificateData mCert; /**< Decoded data, pointing into mCertBuf. */
+        uint32_t mLastUse;         /**< Value of mUseCount at the last use, or 0 if the entry is free. */
+    };
+
+    class ScopedLock;
+
+    VerifiedCertCache();
+
+    void Lock();
+    void Unlock();
+    Entry * Find(const ChipCertificateData & cert);
+    Entry * FindOrAllocate(const ChipCertificateData & cert);
+    void Touch(Entry & entry);
+
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    System::Mutex mLock;
+#endif
+    Entry mEntries[CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE];
+    uint32_t mUseCount = 0;
+    Stats mStats       = {};
+#endif // CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE > 0
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -0,0 +1,145 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the validation of a CHIP certificate chain,
+ *      with an empty and with a warm verified certificate cache.
+ *
+ */
+
+#include <credentials/CHIPCert.h>
+#include <credentials/VerifiedCertCache.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+
+#include "CHIPCert_test_vectors.h"
+
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace chip;
+using namespace chip::ASN1;
+using namespace chip::Credentials;
+using namespace chip::TestCerts;
+
+namespace {
+
+constexpr size_t kStandardCertsCount = 3;
+constexpr size_t kValidationCount    = 200;
+
+const BitFlags<CertDecodeFlags> sGenTBSHashFlag(CertDecodeFlags::kGenerateTBSHash);
+const BitFlags<CertDecodeFlags> sTrustAnchorFlag(CertDecodeFlags::kIsTrustAnchor);
+const BitFlags<TestCertLoadFlags> sNullLoadFlag;
+
+CHIP_ERROR LoadTestCertSet01(ChipCertificateSet & certSet)
+{
+    ReturnErrorOnFailure(LoadTestCert(certSet, TestCert::kRoot01, sNullLoadFlag, sTrustAnchorFlag));
+    ReturnErrorOnFailure(LoadTestCert(certSet, TestCert::kICA01, sNullLoadFlag, sGenTBSHashFlag));
+    return LoadTestCert(certSet, TestCert::kNode01_01, sNullLoadFlag, sGenTBSHashFlag);
+}
+
+CHIP_ERROR InitValidationContext(ValidationContext & validContext)
+{
+    ASN1UniversalTime effectiveTime;
+
+    effectiveTime.Year   = 2022;
+    effectiveTime.Month  = 1;
+    effectiveTime.Day    = 1;
+    effectiveTime.Hour   = 0;
+    effectiveTime.Minute = 0;
+    effectiveTime.Second = 0;
+
+    validContext.Reset();
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    return ASN1ToChipEpochTime(effectiveTime, validContext.mEffectiveTime);
+}
+
+// Loads and validates the same chain, as each CASE session with the same peer does, and returns the number of
+// successful validations.
+size_t ValidateChain(ValidationContext & validContext, bool cached, int64_t & elapsedUs)
+{
+    VerifiedCertCache & cache = VerifiedCertCache::Instance();
+    size_t validCount         = 0;
+
+    cache.Clear();
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < kValidationCount; i++)
+    {
+        ChipCertificateSet certSet;
+
+        if (!cached)
+        {
+            cache.Clear();
+        }
+
+        certSet.Init(kStandardCertsCount, kMaxCHIPCertDecodeBufLength);
+        if (LoadTestCertSet01(certSet) != CHIP_NO_ERROR)
+        {
+            continue;
+        }
+        if (certSet.ValidateCert(certSet.GetLastCert(), validContext) == CHIP_NO_ERROR)
+        {
+            validCount++;
+        }
+    }
+    elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    cache.Clear();
+    return validCount;
+}
+
+uint64_t Rate(size_t count, int64_t elapsedUs)
+{
+    return static_cast<uint64_t>(count) * 1000000 / static_cast<uint64_t>(elapsedUs + 1);
+}
+
+} // namespace
+
+int main()
+{
+    ValidationContext validContext;
+    int64_t uncachedUs, cachedUs;
+
+    if (Platform::MemoryInit() != CHIP_NO_ERROR || InitValidationContext(validContext) != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to initialize the benchmark\n");
+        return EXIT_FAILURE;
+    }
+
+    size_t uncachedCount = ValidateChain(validContext, false, uncachedUs);
+    size_t cachedCount   = ValidateChain(validContext, true, cachedUs);
+
+    Platform::MemoryShutdown();
+
+    if (uncachedCount != kValidationCount || cachedCount != kValidationCount)
+    {
+        fprintf(stderr, "Validated the chain %zu times uncached and %zu times cached, out of %zu\n", uncachedCount, cachedCount,
+                kValidationCount);
+        return EXIT_FAILURE;
+    }
+
+    printf("Validated a certificate chain %zu times\n", kValidationCount);
+    printf("Uncached: %" PRIu64 " validations/s\n", Rate(kValidationCount, uncachedUs));
+    printf("Cached: %" PRIu64 " validations/s\n", Rate(kValidationCount, cachedUs));
+    return EXIT_SUCCESS;
+}
@@ -27,6 +27,7 @@
 #include <core/CHIPTLV.h>
 #include <credentials/CHIPCert.h>
 #include <credentials/CHIPOperationalCredentials.h>
+#include <credentials/VerifiedCertCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <support/CHIPMem.h>
 #include <support/CodeUtils.h>
@@ -900,6 +901,99 @@ static void TestChipCert_GenerateNOCICA(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, DecodeChipCert(outCertBuf, outCertLen, certData) == CHIP_NO_ERROR);
 }
 
+static void TestChipCert_GenerateNOCWithIssuerEncoding(nlTestSuite * inSuite, void * inContext)
+{
+    // Generate a new keypair for cert signing
+    P256Keypair keypair;
+    NL_TEST_ASSERT(inSuite, keypair.Initialize() == CHIP_NO_ERROR);
+
+    static uint8_t root_cert[kMaxDERCertLength];
+    uint32_t root_len = 0;
+
+    X509CertRequestParams root_params = { 1234, 0xabcdabcd, 631161876, 729942000, true, 0x8888, false, 0 };
+    NL_TEST_ASSERT(inSuite, NewRootX509Cert(root_params, keypair, root_cert, sizeof(root_cert), root_len) == CHIP_NO_ERROR);
+
+    static uint8_t signed_cert[kMaxDERCertLength];
+    uint32_t signed_len = 0;
+
+    static uint8_t rootCertBuf[kMaxCHIPCertLength];
+    static uint8_t nocCertBuf[kMaxCHIPCertLength];
+    static uint8_t refCertBuf[kMaxCHIPCertLength];
+    uint32_t rootCertLen, nocCertLen, refCertLen;
+
+    X509CertRequestParams noc_params = { 1234, 0xabcdabcd, 631161876, 729942000, true, 0x8888, true, 0x1234 };
+    P256Keypair noc_keypair;
+    NL_TEST_ASSERT(inSuite, noc_keypair.Initialize() == CHIP_NO_ERROR);
+
+    X509IssuerEncoding issuer;
+    NL_TEST_ASSERT(inSuite, EncodeX509Issuer(noc_params, kIssuerIsRootCA, keypair.Pubkey(), issuer) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite,
+                   NewNodeOperationalX509Cert(noc_params, issuer, noc_keypair.Pubkey(), keypair, signed_cert, sizeof(signed_cert),
+                                              signed_len) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   ConvertX509CertToChipCert(ByteSpan(signed_cert, signed_len), nocCertBuf, sizeof(nocCertBuf), nocCertLen) ==
+                       CHIP_NO_ERROR);
+
+    // The certificate is the same as the one issued without the pre-encoded issuer, but for the signature.
+    NL_TEST_ASSERT(inSuite,
+                   NewNodeOperationalX509Cert(noc_params, kIssuerIsRootCA, noc_keypair.Pubkey(), keypair, signed_cert,
+                                              sizeof(signed_cert), signed_len) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   ConvertX509CertToChipCert(ByteSpan(signed_cert, signed_len), refCertBuf, sizeof(refCertBuf), refCertLen) ==
+                       CHIP_NO_ERROR);
+
+    ChipCertificateData nocData, refData;
+    NL_TEST_ASSERT(inSuite, DecodeChipCert(nocCertBuf, nocCertLen, nocData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DecodeChipCert(refCertBuf, refCertLen, refData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, nocData.mIssuerDN.IsEqual(refData.mIssuerDN));
+    NL_TEST_ASSERT(inSuite, nocData.mSubjectDN.IsEqual(refData.mSubjectDN));
+    NL_TEST_ASSERT(inSuite, nocData.mAuthKeyId.data_equal(refData.mAuthKeyId));
+    NL_TEST_ASSERT(inSuite, nocData.mSubjectKeyId.data_equal(refData.mSubjectKeyId));
+
+    // The certificate is signed by the root.
+    NL_TEST_ASSERT(inSuite,
+                   ConvertX509CertToChipCert(ByteSpan(root_cert, root_len), rootCertBuf, sizeof(rootCertBuf), rootCertLen) ==
+                       CHIP_NO_ERROR);
+
+    ChipCertificateSet certSet;
+    NL_TEST_ASSERT(inSuite, certSet.Init(2, kMaxCHIPCertDecodeBufLength) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(
+        inSuite,
+        certSet.LoadCert(rootCertBuf, rootCertLen,
+                         BitFlags<CertDecodeFlags>(CertDecodeFlags::kIsTrustAnchor).Set(CertDecodeFlags::kGenerateTBSHash)) ==
+            CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   certSet.LoadCert(nocCertBuf, nocCertLen, BitFlags<CertDecodeFlags>(CertDecodeFlags::kGenerateTBSHash)) ==
+                       CHIP_NO_ERROR);
+
+    ValidationContext validContext;
+    validContext.Reset();
+    NL_TEST_ASSERT(inSuite, SetEffectiveTime(validContext, 2022, 1, 1) == CHIP_NO_ERROR);
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    NL_TEST_ASSERT(inSuite, certSet.ValidateCert(certSet.GetLastCert(), validContext) == CHIP_NO_ERROR);
+
+    // Test that the request must match the issuer
+    noc_params.Issuer = 0xaabbccdd;
+    NL_TEST_ASSERT(inSuite,
+                   NewNodeOperationalX509Cert(noc_params, issuer, noc_keypair.Pubkey(), keypair, signed_cert, sizeof(signed_cert),
+                                              signed_len) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    noc_params.Issuer   = 0xabcdabcd;
+    noc_params.FabricID = 0x9999;
+    NL_TEST_ASSERT(inSuite,
+                   NewNodeOperationalX509Cert(noc_params, issuer, noc_keypair.Pubkey(), keypair, signed_cert, sizeof(signed_cert),
+                                              signed_len) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Test that the signing key must be the one of the issuer
+    noc_params.FabricID = 0x8888;
+    NL_TEST_ASSERT(inSuite,
+                   NewNodeOperationalX509Cert(noc_params, issuer, noc_keypair.Pubkey(), noc_keypair, signed_cert,
+                                              sizeof(signed_cert), signed_len) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    certSet.Release();
+}
+
 static void TestChipCert_VerifyGeneratedCerts(nlTestSuite * inSuite, void * inContext)
 {
     // Generate a new keypair for cert signing
@@ -1328,6 +1422,147 @@ static void TestChipCert_ChipArrayToChipCertsNoICA(nlTestSuite * inSuite, void *
     NL_TEST_ASSERT(inSuite, certSet.FindValidCert(subjectDN, subjectKeyId, validContext, resultCert) == CHIP_NO_ERROR);
 }
 
+static void TestChipCert_VerifiedCertCache(nlTestSuite * inSuite, void * inContext)
+{
+#if CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE > 0
+    CHIP_ERROR err;
+    VerifiedCertCache & cache = VerifiedCertCache::Instance();
+    ChipCertificateSet certSet;
+    ChipCertificateSet cachedCertSet;
+    ValidationContext validContext;
+    ByteSpan nodeCert;
+    uint8_t nodeCertCopy[kMaxCHIPCertLength];
+
+    cache.Clear();
+
+    validContext.Reset();
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+
+    certSet.Init(kStandardCertsCount, kMaxCHIPCertDecodeBufLength);
+    err = LoadTestCertSet01(certSet);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = SetEffectiveTime(validContext, 2022, 1, 1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = certSet.ValidateCert(certSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.GetStats().mDecodeHits == 0);
+    NL_TEST_ASSERT(inSuite, cache.GetStats().mSignatureHits == 0);
+
+    // The ICA and node certificates, which were decoded with their TBS hash, are loaded from the cache,
+    // and the signatures are not verified again. The trust anchor, decoded without TBS hash, is not cached.
+    cachedCertSet.Init(kStandardCertsCount + 1, kMaxCHIPCertDecodeBufLength);
+    err = LoadTestCertSet01(cachedCertSet);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.GetStats().mDecodeHits == 2);
+    for (uint8_t i = 0; i < kStandardCertsCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, cachedCertSet.GetCertSet()[i].IsEqual(certSet.GetCertSet()[i]));
+    }
+
+    err = cachedCertSet.ValidateCert(cachedCertSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.GetStats().mSignatureHits == 2);
+
+    // The cached data points into the buffer of the certificate being loaded.
+    err = GetTestCert(TestCert::kNode01_01, sNullLoadFlag, nodeCert);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR && nodeCert.size() <= sizeof(nodeCertCopy));
+    memcpy(nodeCertCopy, nodeCert.data(), nodeCert.size());
+    cachedCertSet.Clear();
+    err = cachedCertSet.LoadCert(nodeCertCopy, static_cast<uint32_t>(nodeCert.size()), sNullDecodeFlag);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.GetStats().mDecodeHits == 3);
+
+    const ChipCertificateData * cachedCert = cachedCertSet.GetLastCert();
+    NL_TEST_ASSERT(inSuite, cachedCert->mCertificate.data() == nodeCertCopy);
+    NL_TEST_ASSERT(inSuite, cachedCert->mSubjectKeyId.data() >= nodeCertCopy);
+    NL_TEST_ASSERT(inSuite, cachedCert->mSubjectKeyId.data() < nodeCertCopy + nodeCert.size());
+    NL_TEST_ASSERT(inSuite, cachedCert->mSubjectKeyId.data_equal(certSet.GetLastCert()->mSubjectKeyId));
+
+    // The TBS hash is only given when requested.
+    NL_TEST_ASSERT(inSuite, !cachedCert->mCertFlags.Has(CertFlags::kTBSHashPresent));
+
+    // An expired certificate is removed from the cache, so its signature is verified again once it is valid.
+    err = SetEffectiveTime(validContext, 2042, 4, 25);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = certSet.ValidateCert(certSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_CERT_EXPIRED);
+
+    err = SetEffectiveTime(validContext, 2022, 1, 1);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = certSet.ValidateCert(certSet.GetLastCert(), validContext);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.GetStats().mSignatureHits == 3);
+
+    cache.Clear();
+    certSet.Release();
+    cachedCertSet.Release();
+#endif // CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE > 0
+}
+
+static void TestChipCert_DecodePool(nlTestSuite * inSuite, void * inContext)
+{
+#if CHIP_CONFIG_CERT_DECODE_POOL_SIZE > 0
+    CertificateDecodeHandle handles[CHIP_CONFIG_CERT_DECODE_POOL_SIZE];
+    ValidationContext validContext;
+
+    // The pool has a fixed capacity.
+    for (CertificateDecodeHandle & handle : handles)
+    {
+        handle = CertificateDecodeHandle::Acquire();
+        NL_TEST_ASSERT(inSuite, !handle.IsNull());
+    }
+    NL_TEST_ASSERT(inSuite, CertificateDecodeHandle::Acquire().IsNull());
+
+    // A state returns to the pool when the handle that owns it is released, and the handles are move-only.
+    CertificateDecodeHandle handle = std::move(handles[0]);
+    NL_TEST_ASSERT(inSuite, handles[0].IsNull() && !handle.IsNull());
+    handle.Release();
+    handle = CertificateDecodeHandle::Acquire();
+    NL_TEST_ASSERT(inSuite, !handle.IsNull());
+    NL_TEST_ASSERT(inSuite, CertificateDecodeHandle::Acquire().IsNull());
+
+    for (CertificateDecodeHandle & other : handles)
+    {
+        other.Release();
+    }
+    handle.Release();
+
+    // Loading and validating a chain in a certificate set that borrows its memory from the pool does not allocate
+    // any memory, and the set returns it to the pool, including when it is moved.
+    validContext.Reset();
+    validContext.mRequiredKeyUsages.Set(KeyUsageFlags::kDigitalSignature);
+    validContext.mRequiredKeyPurposes.Set(KeyPurposeFlags::kServerAuth);
+    NL_TEST_ASSERT(inSuite, SetEffectiveTime(validContext, 2022, 1, 1) == CHIP_NO_ERROR);
+
+    const size_t allocationCount = chip::Platform::MemoryDebugAllocationCount();
+    for (int i = 0; i < 10; i++)
+    {
+        ChipCertificateSet certSet;
+        ChipCertificateSet movedCertSet;
+
+        NL_TEST_ASSERT(inSuite, certSet.Init(CertificateDecodeHandle::Acquire()) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, LoadTestCertSet01(certSet) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, certSet.ValidateCert(certSet.GetLastCert(), validContext) == CHIP_NO_ERROR);
+
+        movedCertSet = std::move(certSet);
+        NL_TEST_ASSERT(inSuite, movedCertSet.GetCertCount() == kStandardCertsCount);
+    }
+    NL_TEST_ASSERT(inSuite, chip::Platform::MemoryDebugAllocationCount() == allocationCount);
+
+    for (CertificateDecodeHandle & other : handles)
+    {
+        other = CertificateDecodeHandle::Acquire();
+        NL_TEST_ASSERT(inSuite, !other.IsNull());
+    }
+
+    // A certificate set cannot be initialized with a null handle.
+    ChipCertificateSet certSet;
+    NL_TEST_ASSERT(inSuite, certSet.Init(CertificateDecodeHandle::Acquire()) == CHIP_ERROR_NO_MEMORY);
+#endif // CHIP_CONFIG_CERT_DECODE_POOL_SIZE > 0
+}
+
 /**
  *  Set up the test suite.
  */
@@ -1370,12 +1605,15 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test CHIP Generate ICA Certificate", TestChipCert_GenerateICACert),
     NL_TEST_DEF("Test CHIP Generate NOC using Root", TestChipCert_GenerateNOCRoot),
     NL_TEST_DEF("Test CHIP Generate NOC using ICA", TestChipCert_GenerateNOCICA),
+    NL_TEST_DEF("Test CHIP Generate NOC with Pre-encoded Issuer", TestChipCert_GenerateNOCWithIssuerEncoding),
     NL_TEST_DEF("Test CHIP Verify Generated Cert Chain", TestChipCert_VerifyGeneratedCerts),
     NL_TEST_DEF("Test CHIP Certificates X509 to CHIP Array Conversion", TestChipCert_X509ToChipArray),
     NL_TEST_DEF("Test CHIP Certificates X509 No ICA to CHIP Array Conversion", TestChipCert_X509ToChipArrayNoICA),
     NL_TEST_DEF("Test CHIP Certificates X509 to CHIP Array Conversion Error Scenarios", TestChipCert_X509ToChipArrayErrorScenarios),
     NL_TEST_DEF("Test CHIP Array to Chip Certificates Conversion", TestChipCert_ChipArrayToChipCerts),
     NL_TEST_DEF("Test No ICA CHIP Array to Chip Certificates Conversion", TestChipCert_ChipArrayToChipCertsNoICA),
+    NL_TEST_DEF("Test CHIP Verified Certificate Cache", TestChipCert_VerifiedCertCache),
+    NL_TEST_DEF("Test CHIP Certificate Decode Pool", TestChipCert_DecodePool),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -170,10 +170,46 @@ public:
      */
     CHIP_ERROR Delete(const char * key);
 
+    /**
+     * @brief
+     * Starts a batch of writes. The entries added, updated or deleted until the
+     * batch is committed are persisted together: after a reset either all of
+     * them or none of them are present. Batches cannot be nested.
+     *
+     * @return CHIP_NO_ERROR the batch was started
+     *         CHIP_ERROR_INCORRECT_STATE a batch is already in progress
+     *         CHIP_ERROR_NOT_IMPLEMENTED the platform does not support batches,
+     *                                    entries are persisted as they are
+     *                                    written
+     */
+    CHIP_ERROR BeginTransaction();
+
+    /**
+     * @brief
+     * Persists all the writes made since BeginTransaction. If they cannot be
+     * persisted, none of them is kept.
+     *
+     * @return CHIP_NO_ERROR the batch was persisted
+     *         CHIP_ERROR_INCORRECT_STATE no batch is in progress
+     *         other errors failed to persist the batch, which was discarded
+     */
+    CHIP_ERROR CommitTransaction();
+
+    /**
+     * @brief
+     * Discards all the writes made since BeginTransaction.
+     */
+    void AbortTransaction();
+
 private:
     using ImplClass = ::chip::DeviceLayer::PersistedStorage::KeyValueStoreManagerImpl;
 
 protected:
+    // Defaults for the platforms that do not support batched writes.
+    CHIP_ERROR _BeginTransaction() { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR _CommitTransaction() { return CHIP_ERROR_INCORRECT_STATE; }
+    void _AbortTransaction() {}
+
     // Construction/destruction limited to subclasses.
     KeyValueStoreManager()  = default;
     ~KeyValueStoreManager() = default;
@@ -233,6 +269,21 @@ inline CHIP_ERROR KeyValueStoreManager::Delete(const char * key)
     return static_cast<ImplClass *>(this)->_Delete(key);
 }
 
+inline CHIP_ERROR KeyValueStoreManager::BeginTransaction()
+{
+    return static_cast<ImplClass *>(this)->_BeginTransaction();
+}
+
+inline CHIP_ERROR KeyValueStoreManager::CommitTransaction()
+{
+    return static_cast<ImplClass *>(this)->_CommitTransaction();
+}
+
+inline void KeyValueStoreManager::AbortTransaction()
+{
+    static_cast<ImplClass *>(this)->_AbortTransaction();
+}
+
 } // namespace PersistedStorage
 } // namespace DeviceLayer
 } // namespace chip
@@ -135,21 +135,41 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartChipTimer(int64_t
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDeviceEvent * event)
 {
-    mChipEventQueue.Push(*event);
+    bool wakeConsumer;
+
+    while (!mChipEventQueue.Push(*event, wakeConsumer))
+    {
+        // The queue is full. Other threads wait for the event loop to make room, but the event loop
+        // cannot wait for itself (and may not be running yet): its events are spilled instead.
+        pthread_mutex_lock(&mStateLock);
+        bool canWait = mHasValidChipTask && !mEventQueueHasStopped && (pthread_equal(pthread_self(), mChipTask) == 0);
+        pthread_mutex_unlock(&mStateLock);
+
+        if (!canWait)
+        {
+            mChipEventQueue.PushOrSpill(*event, wakeConsumer);
+            break;
+        }
 
 #if CHIP_SYSTEM_CONFIG_USE_IO_THREAD
-    SystemLayer.WakeIOThread(); // Trigger wake select on CHIP thread
-#endif                          // CHIP_SYSTEM_CONFIG_USE_IO_THREAD
+        SystemLayer.WakeIOThread();
+#endif // CHIP_SYSTEM_CONFIG_USE_IO_THREAD
+        sched_yield();
+    }
+
+#if CHIP_SYSTEM_CONFIG_USE_IO_THREAD
+    // Only the first event posted since the event loop started draining the queue needs to wake it up.
+    if (wakeConsumer)
+    {
+        SystemLayer.WakeIOThread(); // Trigger wake select on CHIP thread
+    }
+#endif // CHIP_SYSTEM_CONFIG_USE_IO_THREAD
 }
 
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
 {
-    while (!mChipEventQueue.Empty())
-    {
-        const ChipDeviceEvent event = mChipEventQueue.PopFront();
-        Impl()->DispatchEvent(&event);
-    }
+    mChipEventQueue.DrainAll([this](const ChipDeviceEvent & event) { Impl()->DispatchEvent(&event); });
 }
 
 template <class ImplClass>
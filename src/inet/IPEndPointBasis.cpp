@@ -795,17 +795,23 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     // Ensure the destination address type is compatible with the endpoint address type.
     VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!aBuffer->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
-
-    struct iovec msgIOV;
-    msgIOV.iov_base = aBuffer->Start();
-    msgIOV.iov_len  = aBuffer->DataLength();
+    // Gather a chained message into one datagram, up to a small fixed number of buffers.
+    constexpr size_t kMaxSendMsgSegments = 8;
+    System::PacketBufferSegment segments[kMaxSendMsgSegments];
+    const size_t segmentCount = aBuffer->GetSegments(segments, kMaxSendMsgSegments);
+    VerifyOrReturnError(segmentCount <= kMaxSendMsgSegments, CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    struct iovec msgIOV[kMaxSendMsgSegments];
+    for (size_t i = 0; i < segmentCount; i++)
+    {
+        msgIOV[i].iov_base = segments[i].data;
+        msgIOV[i].iov_len  = segments[i].length;
+    }
 
     struct msghdr msgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
+    msgHeader.msg_iov    = msgIOV;
+    msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(segmentCount);
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
     PeerSockAddr peerSockAddr;
@@ -910,7 +916,7 @@ CHIP_ERROR IPEndPointBasis::SendMsg(const IPPacketInfo * aPktInfo, chip::System:
     const ssize_t lenSent = sendmsg(mSocket.GetFD(), &msgHeader, 0);
     if (lenSent == -1)
         return chip::System::MapErrorPOSIX(errno);
-    if (lenSent != aBuffer->DataLength())
+    if (lenSent != aBuffer->TotalLength())
         return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
     return CHIP_NO_ERROR;
 }
@@ -28,6 +28,7 @@
 #endif
 
 #include "InetInterface.h"
+#include "InterfaceCache.h"
 
 #include "InetLayer.h"
 #include "InetLayerEvents.h"
@@ -52,11 +53,6 @@
 #endif /* HAVE_SYS_SOCKIO_H */
 #include <net/if.h>
 #include <sys/ioctl.h>
-#ifdef __ANDROID__
-#include "ifaddrs-android.h"
-#else // !defined(__ANDROID__)
-#include <ifaddrs.h>
-#endif // !defined(__ANDROID__)
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -255,150 +251,7 @@ void CloseIOCTLSocket()
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
-#if __ANDROID__ && __ANDROID_API__ < 24
-
-static struct if_nameindex * backport_if_nameindex(void);
-static void backport_if_freenameindex(struct if_nameindex *);
-
-static void backport_if_freenameindex(struct if_nameindex * inArray)
-{
-    if (inArray == NULL)
-    {
-        return;
-    }
-
-    for (size_t i = 0; inArray[i].if_index != 0; i++)
-    {
-        if (inArray[i].if_name != NULL)
-        {
-            free(inArray[i].if_name);
-        }
-    }
-
-    free(inArray);
-}
-
-static struct if_nameindex * backport_if_nameindex(void)
-{
-    int err;
-    unsigned index;
-    size_t intfIter              = 0;
-    size_t maxIntfNum            = 0;
-    size_t numIntf               = 0;
-    size_t numAddrs              = 0;
-    struct if_nameindex * retval = NULL;
-    struct if_nameindex * tmpval = NULL;
-    struct ifaddrs * addrList    = NULL;
-    struct ifaddrs * addrIter    = NULL;
-    const char * lastIntfName    = "";
-
-    err = getifaddrs(&addrList);
-    VerifyOrExit(err >= 0, );
-
-    // coalesce on consecutive interface names
-    for (addrIter = addrList; addrIter != NULL; addrIter = addrIter->ifa_next)
-    {
-        numAddrs++;
-        if (strcmp(addrIter->ifa_name, lastIntfName) == 0)
-        {
-            continue;
-        }
-        numIntf++;
-        lastIntfName = addrIter->ifa_name;
-    }
-
-    tmpval = (struct if_nameindex *) malloc((numIntf + 1) * sizeof(struct if_nameindex));
-    VerifyOrExit(tmpval != NULL, );
-    memset(tmpval, 0, (numIntf + 1) * sizeof(struct if_nameindex));
-
-    lastIntfName = "";
-    for (addrIter = addrList; addrIter != NULL; addrIter = addrIter->ifa_next)
-    {
-        if (strcmp(addrIter->ifa_name, lastIntfName) == 0)
-        {
-            continue;
-        }
-
-        index = if_nametoindex(addrIter->ifa_name);
-        if (index != 0)
-        {
-            tmpval[intfIter].if_index = index;
-            tmpval[intfIter].if_name  = strdup(addrIter->ifa_name);
-            intfIter++;
-        }
-        lastIntfName = addrIter->ifa_name;
-    }
-
-    // coalesce on interface index
-    maxIntfNum = 0;
-    for (size_t i = 0; tmpval[i].if_index != 0; i++)
-    {
-        if (maxIntfNum < tmpval[i].if_index)
-        {
-            maxIntfNum = tmpval[i].if_index;
-        }
-    }
-
-    retval = (struct if_nameindex *) malloc((maxIntfNum + 1) * sizeof(struct if_nameindex));
-    VerifyOrExit(retval != NULL, );
-    memset(retval, 0, (maxIntfNum + 1) * sizeof(struct if_nameindex));
-
-    for (size_t i = 0; tmpval[i].if_index != 0; i++)
-    {
-        struct if_nameindex * intf = &tmpval[i];
-        if (retval[intf->if_index - 1].if_index == 0)
-        {
-            retval[intf->if_index - 1] = *intf;
-        }
-        else
-        {
-            free(intf->if_name);
-            intf->if_index = 0;
-            intf->if_name  = 0;
-        }
-    }
-
-    intfIter = 0;
-
-    // coalesce potential gaps between indeces
-    for (size_t i = 0; i < maxIntfNum; i++)
-    {
-        if (retval[i].if_index != 0)
-        {
-            retval[intfIter] = retval[i];
-            intfIter++;
-        }
-    }
-
-    for (size_t i = intfIter; i < maxIntfNum; i++)
-    {
-        retval[i].if_index = 0;
-        retval[i].if_name  = NULL;
-    }
-
-exit:
-    if (tmpval != NULL)
-    {
-        free(tmpval);
-    }
-
-    if (addrList != NULL)
-    {
-        freeifaddrs(addrList);
-    }
-
-    return retval;
-}
-
-#endif // __ANDROID__ && __ANDROID_API__ < 24
-
-InterfaceIterator::InterfaceIterator()
-{
-    mIntfArray       = nullptr;
-    mCurIntf         = 0;
-    mIntfFlags       = 0;
-    mIntfFlagsCached = false;
-}
+InterfaceIterator::InterfaceIterator() = default;
 
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
@@ -417,18 +270,7 @@ InterfaceIterator::InterfaceIterator() : mCurrentInterface(net_if_get_by_index(m
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
-InterfaceIterator::~InterfaceIterator()
-{
-    if (mIntfArray != nullptr)
-    {
-#if __ANDROID__ && __ANDROID_API__ < 24
-        backport_if_freenameindex(mIntfArray);
-#else
-        if_freenameindex(mIntfArray);
-#endif
-        mIntfArray = nullptr;
-    }
-}
+InterfaceIterator::~InterfaceIterator() = default;
 
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
@@ -444,7 +286,7 @@ InterfaceIterator::~InterfaceIterator()
 #if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 bool InterfaceIterator::HasCurrent()
 {
-    return (mIntfArray != nullptr) ? mIntfArray[mCurIntf].if_index != 0 : Next();
+    return (mSnapshot != nullptr) ? mCurIntf < mSnapshot->GetInterfaces().size() : Next();
 }
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
@@ -479,21 +321,16 @@ bool InterfaceIterator::Next()
 {
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
-    if (mIntfArray == nullptr)
+    if (mSnapshot == nullptr)
     {
-#if __ANDROID__ && __ANDROID_API__ < 24
-        mIntfArray = backport_if_nameindex();
-#else
-        mIntfArray = if_nameindex();
-#endif
+        mSnapshot = InterfaceCache::Instance().GetSnapshot();
+        mCurIntf  = 0;
     }
-    else if (mIntfArray[mCurIntf].if_index != 0)
+    else if (mCurIntf < mSnapshot->GetInterfaces().size())
     {
         mCurIntf++;
-        mIntfFlags       = 0;
-        mIntfFlagsCached = false;
     }
-    return (mIntfArray != nullptr && mIntfArray[mCurIntf].if_index != 0);
+    return (mSnapshot != nullptr && mCurIntf < mSnapshot->GetInterfaces().size());
 
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
@@ -543,7 +380,7 @@ bool InterfaceIterator::Next()
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 InterfaceId InterfaceIterator::GetInterfaceId()
 {
-    return (HasCurrent()) ? mIntfArray[mCurIntf].if_index : INET_NULL_INTERFACEID;
+    return (HasCurrent()) ? mSnapshot->GetInterfaces()[mCurIntf].id : INET_NULL_INTERFACEID;
 }
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
@@ -576,8 +413,9 @@ CHIP_ERROR InterfaceIterator::GetInterfaceName(char * nameBuf, size_t nameBufSiz
     VerifyOrReturnError(HasCurrent(), CHIP_ERROR_INCORRECT_STATE);
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-    VerifyOrReturnError(strlen(mIntfArray[mCurIntf].if_name) < nameBufSize, CHIP_ERROR_NO_MEMORY);
-    strncpy(nameBuf, mIntfArray[mCurIntf].if_name, nameBufSize);
+    const char * name = mSnapshot->GetInterfaces()[mCurIntf].name;
+    VerifyOrReturnError(strlen(name) < nameBufSize, CHIP_ERROR_NO_MEMORY);
+    strncpy(nameBuf, name, nameBufSize);
     return CHIP_NO_ERROR;
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
@@ -664,28 +502,13 @@ bool InterfaceIterator::HasBroadcastAddress()
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 /**
- * @fn      short InterfaceIterator::GetFlags(void)
+ * @fn      unsigned int InterfaceIterator::GetFlags(void)
  *
- * @brief   Returns the ifr_flags value for the current interface.
+ * @brief   Returns the IFF_* flags of the current interface.
  */
-short InterfaceIterator::GetFlags()
+unsigned int InterfaceIterator::GetFlags()
 {
-    struct ifreq intfData;
-
-    if (!mIntfFlagsCached && HasCurrent())
-    {
-        strncpy(intfData.ifr_name, mIntfArray[mCurIntf].if_name, IFNAMSIZ);
-        intfData.ifr_name[IFNAMSIZ - 1] = '\0';
-
-        int res = ioctl(GetIOCTLSocket(), SIOCGIFFLAGS, &intfData);
-        if (res == 0)
-        {
-            mIntfFlags       = intfData.ifr_flags;
-            mIntfFlagsCached = true;
-        }
-    }
-
-    return mIntfFlags;
+    return HasCurrent() ? mSnapshot->GetInterfaces()[mCurIntf].flags : 0;
 }
 
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
@@ -700,11 +523,7 @@ short InterfaceIterator::GetFlags()
  *     Starts the iterator at the first network address. On some platforms,
  *     this constructor may allocate resources recycled by the destructor.
  */
-InterfaceAddressIterator::InterfaceAddressIterator()
-{
-    mAddrsList = nullptr;
-    mCurAddr   = nullptr;
-}
+InterfaceAddressIterator::InterfaceAddressIterator() = default;
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -721,14 +540,7 @@ InterfaceAddressIterator::InterfaceAddressIterator() = default;
  */
 
 #if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-InterfaceAddressIterator::~InterfaceAddressIterator()
-{
-    if (mAddrsList != nullptr)
-    {
-        freeifaddrs(mAddrsList);
-        mAddrsList = mCurAddr = nullptr;
-    }
-}
+InterfaceAddressIterator::~InterfaceAddressIterator() = default;
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 /**
@@ -742,7 +554,7 @@ InterfaceAddressIterator::~InterfaceAddressIterator()
 bool InterfaceAddressIterator::HasCurrent()
 {
 #if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-    return (mAddrsList != nullptr) ? (mCurAddr != nullptr) : Next();
+    return (mSnapshot != nullptr) ? mCurAddr < mSnapshot->GetAddresses().size() : Next();
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -773,37 +585,16 @@ bool InterfaceAddressIterator::HasCurrent()
 bool InterfaceAddressIterator::Next()
 {
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-    while (true)
+    if (mSnapshot == nullptr)
     {
-        if (mAddrsList == nullptr)
-        {
-            int res = getifaddrs(&mAddrsList);
-            if (res < 0)
-            {
-                return false;
-            }
-            mCurAddr = mAddrsList;
-        }
-        else if (mCurAddr != nullptr)
-        {
-            mCurAddr = mCurAddr->ifa_next;
-        }
-
-        if (mCurAddr == nullptr)
-        {
-            return false;
-        }
-
-        if (mCurAddr->ifa_addr != nullptr &&
-            (mCurAddr->ifa_addr->sa_family == AF_INET6
-#if INET_CONFIG_ENABLE_IPV4
-             || mCurAddr->ifa_addr->sa_family == AF_INET
-#endif // INET_CONFIG_ENABLE_IPV4
-             ))
-        {
-            return true;
-        }
+        mSnapshot = InterfaceCache::Instance().GetSnapshot();
+        mCurAddr  = 0;
     }
+    else if (mCurAddr < mSnapshot->GetAddresses().size())
+    {
+        mCurAddr++;
+    }
+    return (mSnapshot != nullptr && mCurAddr < mSnapshot->GetAddresses().size());
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -873,7 +664,7 @@ IPAddress InterfaceAddressIterator::GetAddress()
     if (HasCurrent())
     {
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-        return IPAddress::FromSockAddr(*mCurAddr->ifa_addr);
+        return mSnapshot->GetAddresses()[mCurAddr].address;
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -921,22 +712,7 @@ uint8_t InterfaceAddressIterator::GetPrefixLength()
     if (HasCurrent())
     {
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-        if (mCurAddr->ifa_addr->sa_family == AF_INET6)
-        {
-#if !__MBED__
-            struct sockaddr_in6 & netmask = *reinterpret_cast<struct sockaddr_in6 *>(mCurAddr->ifa_netmask);
-            return NetmaskToPrefixLength(netmask.sin6_addr.s6_addr, 16);
-#else  // __MBED__
-       // netmask is not available through an API for IPv6 interface in Mbed.
-       // Default prefix length to 64.
-            return 64;
-#endif // !__MBED__
-        }
-        if (mCurAddr->ifa_addr->sa_family == AF_INET)
-        {
-            struct sockaddr_in & netmask = *reinterpret_cast<struct sockaddr_in *>(mCurAddr->ifa_netmask);
-            return NetmaskToPrefixLength(reinterpret_cast<const uint8_t *>(&netmask.sin_addr.s_addr), 4);
-        }
+        return mSnapshot->GetAddresses()[mCurAddr].prefixLength;
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -976,7 +752,8 @@ InterfaceId InterfaceAddressIterator::GetInterfaceId()
     if (HasCurrent())
     {
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-        return if_nametoindex(mCurAddr->ifa_name);
+        const InterfaceSnapshot::Address & address = mSnapshot->GetAddresses()[mCurAddr];
+        return mSnapshot->GetInterfaces()[address.interfaceIndex].id;
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP || CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -1011,8 +788,10 @@ CHIP_ERROR InterfaceAddressIterator::GetInterfaceName(char * nameBuf, size_t nam
     VerifyOrReturnError(HasCurrent(), CHIP_ERROR_INCORRECT_STATE);
 
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-    VerifyOrReturnError(strlen(mCurAddr->ifa_name) < nameBufSize, CHIP_ERROR_NO_MEMORY);
-    strncpy(nameBuf, mCurAddr->ifa_name, nameBufSize);
+    const InterfaceSnapshot::Address & address = mSnapshot->GetAddresses()[mCurAddr];
+    const char * name                          = mSnapshot->GetInterfaces()[address.interfaceIndex].name;
+    VerifyOrReturnError(strlen(name) < nameBufSize, CHIP_ERROR_NO_MEMORY);
+    strncpy(nameBuf, name, nameBufSize);
     return CHIP_NO_ERROR;
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
@@ -1037,7 +816,7 @@ bool InterfaceAddressIterator::IsUp()
     if (HasCurrent())
     {
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-        return (mCurAddr->ifa_flags & IFF_UP) != 0;
+        return (GetFlags() & IFF_UP) != 0;
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP || CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -1061,7 +840,7 @@ bool InterfaceAddressIterator::SupportsMulticast()
     if (HasCurrent())
     {
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-        return (mCurAddr->ifa_flags & IFF_MULTICAST) != 0;
+        return (GetFlags() & IFF_MULTICAST) != 0;
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP || CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -1085,7 +864,7 @@ bool InterfaceAddressIterator::HasBroadcastAddress()
     if (HasCurrent())
     {
 #if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-        return (mCurAddr->ifa_flags & IFF_BROADCAST) != 0;
+        return (GetFlags() & IFF_BROADCAST) != 0;
 #endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_LWIP || CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -1095,6 +874,24 @@ bool InterfaceAddressIterator::HasBroadcastAddress()
     return false;
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
+/**
+ * @fn      unsigned int InterfaceAddressIterator::GetFlags(void)
+ *
+ * @brief   Returns the IFF_* flags of the interface of the current address.
+ */
+unsigned int InterfaceAddressIterator::GetFlags()
+{
+    if (!HasCurrent())
+    {
+        return 0;
+    }
+
+    const InterfaceSnapshot::Address & address = mSnapshot->GetAddresses()[mCurAddr];
+    return mSnapshot->GetInterfaces()[address.interfaceIndex].flags;
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
+
 /**
  * @fn       void InterfaceAddressIterator::GetAddressWithPrefix(IPPrefix & addrWithPrefix)
  *
@@ -37,8 +37,7 @@
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
 #if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-struct if_nameindex;
-struct ifaddrs;
+#include <memory>
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -58,6 +57,10 @@ namespace Inet {
 class IPAddress;
 class IPPrefix;
 
+#if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
+class InterfaceSnapshot;
+#endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
+
 /**
  * @typedef     InterfaceId
  *
@@ -133,7 +136,8 @@ extern uint8_t NetmaskToPrefixLength(const uint8_t * netmask, uint16_t netmaskLe
  *  themselves are never destroyed.
  *
  *  On sockets-based systems, iteration is always stable in the face of changes
- *  to the underlying system's interfaces.
+ *  to the underlying system's interfaces: the iterator reads a snapshot of the
+ *  InterfaceCache, which is only refreshed when the system reports a change.
  *
  *  On LwIP systems, iteration is stable except in the case where the currently
  *  selected interface is removed from the list, in which case iteration ends
@@ -173,12 +177,10 @@ protected:
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
 #if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-    struct if_nameindex * mIntfArray;
-    size_t mCurIntf;
-    short mIntfFlags;
-    bool mIntfFlagsCached;
+    std::shared_ptr<const InterfaceSnapshot> mSnapshot; ///< Taken from the InterfaceCache by the first call to Next()
+    size_t mCurIntf = 0;
 
-    short GetFlags();
+    unsigned int GetFlags();
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -203,7 +205,8 @@ protected:
  *  themselves are never destroyed.
  *
  *  On sockets-based systems, iteration is always stable in the face of changes
- *  to the underlying system's interfaces and/or addresses.
+ *  to the underlying system's interfaces and/or addresses: the iterator reads a
+ *  snapshot of the InterfaceCache.
  *
  *  On LwIP systems, iteration is stable except in the case where the interface
  *  associated with the current address is removed, in which case iteration may
@@ -240,8 +243,10 @@ private:
 #endif // CHIP_SYSTEM_CONFIG_USE_LWIP
 
 #if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
-    struct ifaddrs * mAddrsList;
-    struct ifaddrs * mCurAddr;
+    std::shared_ptr<const InterfaceSnapshot> mSnapshot; ///< Taken from the InterfaceCache by the first call to Next()
+    size_t mCurAddr = 0;
+
+    unsigned int GetFlags();
 #endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
 
 #if CHIP_SYSTEM_CONFIG_USE_ZEPHYR_NET_IF
@@ -0,0 +1,484 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Implementation of the process-wide cache of the system network interfaces and addresses.
+ */
+
+#include "InterfaceCache.h"
+
+#if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
+
+#include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
+#include <support/logging/CHIPLogging.h>
+#include <system/SystemError.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#ifdef __ANDROID__
+#include "ifaddrs-android.h"
+#else // !defined(__ANDROID__)
+#include <ifaddrs.h>
+#endif // !defined(__ANDROID__)
+
+#if defined(__linux__)
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#endif // defined(__linux__)
+
+namespace chip {
+namespace Inet {
+
+namespace {
+
+bool IsCachedAddressFamily(const struct sockaddr * addr)
+{
+    return addr != nullptr &&
+        (addr->sa_family == AF_INET6
+#if INET_CONFIG_ENABLE_IPV4
+         || addr->sa_family == AF_INET
+#endif // INET_CONFIG_ENABLE_IPV4
+        );
+}
+
+uint8_t GetPrefixLength(const struct ifaddrs & addr)
+{
+    if (addr.ifa_netmask == nullptr)
+    {
+        return 0;
+    }
+
+    if (addr.ifa_addr->sa_family == AF_INET6)
+    {
+#if !__MBED__
+        const struct sockaddr_in6 & netmask = *reinterpret_cast<const struct sockaddr_in6 *>(addr.ifa_netmask);
+        return NetmaskToPrefixLength(netmask.sin6_addr.s6_addr, 16);
+#else  // __MBED__
+        // netmask is not available through an API for IPv6 interface in Mbed.
+        // Default prefix length to 64.
+        return 64;
+#endif // !__MBED__
+    }
+
+    const struct sockaddr_in & netmask = *reinterpret_cast<const struct sockaddr_in *>(addr.ifa_netmask);
+    return NetmaskToPrefixLength(reinterpret_cast<const uint8_t *>(&netmask.sin_addr.s_addr), 4);
+}
+
+} // namespace
+
+CHIP_ERROR InterfaceSnapshot::Load()
+{
+    struct ifaddrs * addrsList;
+
+    VerifyOrReturnError(getifaddrs(&addrsList) == 0, System::MapErrorPOSIX(errno));
+
+    // Every interface is listed at least once, with its link-layer address if it has no IP address.
+    for (struct ifaddrs * addr = addrsList; addr != nullptr; addr = addr->ifa_next)
+    {
+        auto sameName = [addr](const Interface & intf) { return strncmp(intf.name, addr->ifa_name, IF_NAMESIZE) == 0; };
+        if (std::find_if(mInterfaces.begin(), mInterfaces.end(), sameName) != mInterfaces.end())
+        {
+            continue;
+        }
+
+        Interface intf;
+        intf.id = if_nametoindex(addr->ifa_name);
+        if (intf.id == INET_NULL_INTERFACEID || strlen(addr->ifa_name) >= sizeof(intf.name))
+        {
+            // The interface was removed while it was listed.
+            continue;
+        }
+        strncpy(intf.name, addr->ifa_name, sizeof(intf.name));
+        intf.flags = addr->ifa_flags;
+        mInterfaces.push_back(intf);
+    }
+
+    std::sort(mInterfaces.begin(), mInterfaces.end(), [](const Interface & a, const Interface & b) { return a.id < b.id; });
+
+    for (struct ifaddrs * addr = addrsList; addr != nullptr; addr = addr->ifa_next)
+    {
+        if (!IsCachedAddressFamily(addr->ifa_addr))
+        {
+            continue;
+        }
+
+        auto sameName = [addr](const Interface & intf) { return strncmp(intf.name, addr->ifa_name, IF_NAMESIZE) == 0; };
+        auto intf     = std::find_if(mInterfaces.begin(), mInterfaces.end(), sameName);
+        if (intf == mInterfaces.end())
+        {
+            continue;
+        }
+
+        Address address;
+        address.address        = IPAddress::FromSockAddr(*addr->ifa_addr);
+        address.prefixLength   = GetPrefixLength(*addr);
+        address.interfaceIndex = static_cast<size_t>(intf - mInterfaces.begin());
+        mAddresses.push_back(address);
+    }
+
+    freeifaddrs(addrsList);
+
+    return CHIP_NO_ERROR;
+}
+
+bool InterfaceSnapshot::HasSameContent(const InterfaceSnapshot & other) const
+{
+    if (mInterfaces.size() != other.mInterfaces.size() || mAddresses.size() != other.mAddresses.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < mInterfaces.size(); i++)
+    {
+        const Interface & a = mInterfaces[i];
+        const Interface & b = other.mInterfaces[i];
+        if (a.id != b.id || a.flags != b.flags || strcmp(a.name, b.name) != 0)
+        {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < mAddresses.size(); i++)
+    {
+        const Address & a = mAddresses[i];
+        const Address & b = other.mAddresses[i];
+        if (a.address != b.address || a.prefixLength != b.prefixLength || a.interfaceIndex != b.interfaceIndex)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+class InterfaceCache::ScopedLock
+{
+public:
+    explicit ScopedLock(InterfaceCache & cache) : mCache(cache) { mCache.Lock(); }
+    ~ScopedLock() { mCache.Unlock(); }
+
+private:
+    InterfaceCache & mCache;
+};
+
+InterfaceCache & InterfaceCache::Instance()
+{
+    static InterfaceCache sInstance;
+    return sInstance;
+}
+
+InterfaceCache::InterfaceCache()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    System::Mutex::Init(mLock);
+#endif
+}
+
+void InterfaceCache::Lock()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    mLock.Lock();
+#endif
+}
+
+void InterfaceCache::Unlock()
+{
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    mLock.Unlock();
+#endif
+}
+
+std::shared_ptr<const InterfaceSnapshot> InterfaceCache::GetSnapshot()
+{
+    ScopedLock lock(*this);
+    Refresh();
+    return mSnapshot;
+}
+
+uint32_t InterfaceCache::GetGeneration()
+{
+    ScopedLock lock(*this);
+    Refresh();
+    return mGeneration;
+}
+
+void InterfaceCache::Invalidate()
+{
+    ScopedLock lock(*this);
+    mIsStale = true;
+}
+
+/**
+ * Query the system again if needed, with the lock held. The generation is incremented if the interfaces or their
+ * addresses changed since the previous snapshot.
+ */
+void InterfaceCache::Refresh()
+{
+    if (mSnapshot == nullptr)
+    {
+        // Listen to the changes before the first query, so that none of them is missed.
+        OpenChangeSocket();
+    }
+
+    // While the changes are watched, the notifications are only read from the event loop, which then calls the callbacks.
+    const bool hasPendingChanges = (mWatchingLayer == nullptr) && HasPendingChanges();
+    VerifyOrReturn(hasPendingChanges || mIsStale || mSnapshot == nullptr);
+
+    std::shared_ptr<InterfaceSnapshot> snapshot = std::make_shared<InterfaceSnapshot>();
+
+    CHIP_ERROR err = snapshot->Load();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to list the network interfaces: %s", ErrorStr(err));
+        mIsStale = true;
+        return;
+    }
+
+    // Without change notifications, the next access queries the system again.
+    mIsStale = (mChangeSocket < 0);
+
+    VerifyOrReturn(mSnapshot == nullptr || !snapshot->HasSameContent(*mSnapshot));
+
+    snapshot->mGeneration = ++mGeneration;
+    mSnapshot             = std::move(snapshot);
+}
+
+void InterfaceCache::OpenChangeSocket()
+{
+#if defined(__linux__)
+    VerifyOrReturn(mChangeSocket < 0);
+
+    int fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_ROUTE);
+    VerifyOrReturn(fd >= 0, ChipLogError(Inet, "Failed to open a netlink socket: %d", errno));
+
+    struct sockaddr_nl addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    addr.nl_groups = RTMGRP_LINK | RTMGRP_IPV4_IFADDR | RTMGRP_IPV6_IFADDR;
+
+    if (bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0)
+    {
+        ChipLogError(Inet, "Failed to bind a netlink socket: %d", errno);
+        close(fd);
+        return;
+    }
+
+    mChangeSocket = fd;
+#endif // defined(__linux__)
+}
+
+/**
+ * Read all the change notifications received since the previous call, with the lock held.
+ *
+ * @return true if the system reported a change, or may have.
+ */
+bool InterfaceCache::HasPendingChanges()
+{
+    bool hasPendingChanges = false;
+    uint8_t buffer[4096];
+
+    VerifyOrReturnError(mChangeSocket >= 0, false);
+
+    while (true)
+    {
+        const ssize_t length = recv(mChangeSocket, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (length > 0)
+        {
+            // Only the link and address groups are subscribed to: any message is a change.
+            hasPendingChanges = true;
+        }
+        else if (length < 0 && errno == ENOBUFS)
+        {
+            // Notifications were dropped because the socket buffer was full.
+            hasPendingChanges = true;
+        }
+        else if (length < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return hasPendingChanges;
+}
+
+CHIP_ERROR InterfaceCache::AddChangeCallback(ChangeCallback callback, void * context)
+{
+    ScopedLock lock(*this);
+
+    for (const CallbackEntry & entry : mCallbacks)
+    {
+        VerifyOrReturnError(entry.callback != callback || entry.context != context, CHIP_ERROR_DUPLICATE_KEY_ID);
+    }
+
+    mCallbacks.push_back({ callback, context });
+    return CHIP_NO_ERROR;
+}
+
+void InterfaceCache::RemoveChangeCallback(ChangeCallback callback, void * context)
+{
+    ScopedLock lock(*this);
+
+    auto sameEntry = [=](const CallbackEntry & entry) { return entry.callback == callback && entry.context == context; };
+
+    if (mIsDispatching)
+    {
+        // The entries are erased once all the callbacks are called.
+        std::replace_if(mCallbacks.begin(), mCallbacks.end(), sameEntry, CallbackEntry{ nullptr, nullptr });
+        return;
+    }
+
+    mCallbacks.erase(std::remove_if(mCallbacks.begin(), mCallbacks.end(), sameEntry), mCallbacks.end());
+}
+
+CHIP_ERROR InterfaceCache::WatchChanges(System::Layer & systemLayer)
+{
+    ScopedLock lock(*this);
+
+    // Take the first snapshot, which opens the change socket.
+    Refresh();
+
+    VerifyOrReturnError(mChangeSocket >= 0, CHIP_ERROR_NOT_IMPLEMENTED);
+    VerifyOrReturnError(mWatchingLayer != &systemLayer, CHIP_NO_ERROR);
+
+    if (mWatchingLayer != nullptr)
+    {
+        mWatch.ReleaseFD();
+        mWatchingLayer->CancelTimer(HandleDispatchWork, this);
+        mIsDispatchScheduled = false;
+    }
+
+    // The changes are reported relative to the current snapshot.
+    mNotifiedGeneration = mGeneration;
+
+    mWatch.Init(systemLayer.WatchableEvents())
+        .Attach(mChangeSocket)
+        .SetCallback(HandleChangeNotification, 0)
+        .RequestCallbackOnPendingRead();
+    mWatchingLayer = &systemLayer;
+
+    return CHIP_NO_ERROR;
+}
+
+void InterfaceCache::StopWatchingChanges()
+{
+    ScopedLock lock(*this);
+
+    VerifyOrReturn(mWatchingLayer != nullptr);
+
+    // The socket stays open: it is owned by the cache.
+    mWatch.ReleaseFD();
+    mWatchingLayer->CancelTimer(HandleDispatchWork, this);
+    mWatchingLayer       = nullptr;
+    mIsDispatchScheduled = false;
+}
+
+void InterfaceCache::HandleChangeNotification(System::WatchableSocket & socket)
+{
+    InterfaceCache & cache = Instance();
+    System::Layer * systemLayer;
+
+    socket.ClearPendingIO();
+
+    {
+        ScopedLock lock(cache);
+
+        const bool hasPendingChanges = cache.HasPendingChanges();
+        cache.mIsStale               = cache.mIsStale || hasPendingChanges;
+        VerifyOrReturn(hasPendingChanges && cache.mWatchingLayer != nullptr && !cache.mIsDispatchScheduled);
+
+        cache.mIsDispatchScheduled = true;
+        systemLayer                = cache.mWatchingLayer;
+    }
+
+    // The callbacks are called once the event loop is done with the watched sockets, since they may listen on the new
+    // interfaces.
+    CHIP_ERROR err = systemLayer->ScheduleWork(HandleDispatchWork, &cache);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to schedule the network interface change callbacks: %s", ErrorStr(err));
+
+        ScopedLock lock(cache);
+        cache.mIsDispatchScheduled = false;
+    }
+}
+
+void InterfaceCache::HandleDispatchWork(System::Layer * systemLayer, void * appState, CHIP_ERROR error)
+{
+    VerifyOrReturn(error == CHIP_NO_ERROR);
+    static_cast<InterfaceCache *>(appState)->DispatchChanges();
+}
+
+/**
+ * Query the system again, and call the change callbacks if the interfaces or their addresses changed since the callbacks
+ * were last called. Called on the CHIP thread only.
+ */
+void InterfaceCache::DispatchChanges()
+{
+    uint32_t generation;
+    size_t callbackCount;
+
+    {
+        ScopedLock lock(*this);
+
+        mIsDispatchScheduled = false;
+        Refresh();
+        VerifyOrReturn(mGeneration != mNotifiedGeneration);
+
+        generation          = mGeneration;
+        mNotifiedGeneration = mGeneration;
+        callbackCount       = mCallbacks.size();
+        mIsDispatching      = true;
+    }
+
+    ChipLogProgress(Inet, "Network interfaces changed (generation %" PRIu32 ")", generation);
+
+    // The lock is not held while a callback is called, as it may list the interfaces. The callbacks added meanwhile are only
+    // called for the next change, and those removed meanwhile are cleared rather than erased, so that the indices stay valid.
+    for (size_t i = 0; i < callbackCount; i++)
+    {
+        CallbackEntry entry;
+        {
+            ScopedLock lock(*this);
+            entry = mCallbacks[i];
+        }
+
+        if (entry.callback != nullptr)
+        {
+            entry.callback(entry.context, generation);
+        }
+    }
+
+    ScopedLock lock(*this);
+    auto isCleared = [](const CallbackEntry & entry) { return entry.callback == nullptr; };
+    mCallbacks.erase(std::remove_if(mCallbacks.begin(), mCallbacks.end(), isCleared), mCallbacks.end());
+    mIsDispatching = false;
+}
+
+} // namespace Inet
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
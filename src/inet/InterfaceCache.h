@@ -0,0 +1,206 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ * @file
+ *  This file defines a process-wide cache of the system network interfaces
+ *  and of their addresses, which InterfaceIterator and
+ *  InterfaceAddressIterator read on sockets-based systems instead of querying
+ *  the system each time they are constructed.
+ */
+
+#pragma once
+
+#include <inet/InetInterface.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
+
+#include <system/SystemLayer.h>
+#include <system/SystemMutex.h>
+#include <system/SystemSockets.h>
+
+#include <memory>
+#include <net/if.h>
+#include <vector>
+
+namespace chip {
+namespace Inet {
+
+/**
+ * @brief   An immutable list of the system network interfaces and of their
+ *          IPv6 (and IPv4, if enabled) addresses.
+ */
+class InterfaceSnapshot
+{
+public:
+    struct Interface
+    {
+        InterfaceId id;
+        char name[IF_NAMESIZE];
+        unsigned int flags; ///< IFF_* flags of the interface
+    };
+
+    struct Address
+    {
+        IPAddress address;
+        uint8_t prefixLength;
+        size_t interfaceIndex; ///< Index of the interface of the address in GetInterfaces()
+    };
+
+    const std::vector<Interface> & GetInterfaces() const { return mInterfaces; }
+    const std::vector<Address> & GetAddresses() const { return mAddresses; }
+
+    /// Generation of the InterfaceCache in which the snapshot was taken.
+    uint32_t GetGeneration() const { return mGeneration; }
+
+    /// Whether two snapshots list the same interfaces, with the same flags and addresses.
+    bool HasSameContent(const InterfaceSnapshot & other) const;
+
+private:
+    friend class InterfaceCache;
+
+    CHIP_ERROR Load();
+
+    std::vector<Interface> mInterfaces; ///< Sorted by interface ID
+    std::vector<Address> mAddresses;    ///< In the order listed by the system
+    uint32_t mGeneration = 0;
+};
+
+/**
+ * @brief   The process-wide cache of the system network interfaces and addresses.
+ *
+ * @details
+ *  The system is queried again only when it reports a change: on Linux, the
+ *  cache listens to the link and address notifications of a netlink socket.
+ *  Where no such notifications are available, the system is queried each
+ *  time a snapshot is requested, as the iterators used to do.
+ *
+ *  Each time the interfaces, their flags or their addresses actually change,
+ *  the generation of the cache is incremented. Notifications that do not
+ *  change anything (for example, an address lifetime update) are ignored.
+ *
+ *  Once WatchChanges() is called, the notifications are read from the CHIP
+ *  event loop, and the change callbacks are called from a work item scheduled
+ *  on the CHIP thread, so that consumers such as the mDNS server may bind to
+ *  the new interfaces without polling. The callbacks are never called from
+ *  GetSnapshot() or GetGeneration(), which may be called from any thread.
+ */
+class DLL_EXPORT InterfaceCache
+{
+public:
+    /**
+     * A function called when the interfaces change.
+     *
+     * @param[in] context       The context given to AddChangeCallback()
+     * @param[in] generation    The new generation of the cache
+     */
+    using ChangeCallback = void (*)(void * context, uint32_t generation);
+
+    static InterfaceCache & Instance();
+
+    /**
+     * @brief   Get the current list of interfaces and addresses, querying the
+     *          system again if it reported a change that the CHIP event loop
+     *          does not watch.
+     *
+     * @return  the snapshot, which stays valid and unchanged as long as it is
+     *          held, or nullptr if the system could not be queried.
+     */
+    std::shared_ptr<const InterfaceSnapshot> GetSnapshot();
+
+    /**
+     * @brief   Get the generation of the cache, which is incremented each time
+     *          the interfaces or their addresses change.
+     */
+    uint32_t GetGeneration();
+
+    /**
+     * @brief   Query the system again at the next access, even though it did not
+     *          report a change.
+     */
+    void Invalidate();
+
+    /**
+     * @brief   Register a function called when the interfaces change.
+     *
+     *  The callbacks must be added and removed on the CHIP thread: once
+     *  RemoveChangeCallback() returns, the callback is not called anymore,
+     *  even if it is removed by another callback during a dispatch.
+     *
+     * @retval  CHIP_ERROR_DUPLICATE_KEY_ID if the callback is already registered
+     *          with the same context.
+     */
+    CHIP_ERROR AddChangeCallback(ChangeCallback callback, void * context);
+    void RemoveChangeCallback(ChangeCallback callback, void * context);
+
+    /**
+     * @brief   Watch the change notifications of the system from the event
+     *          loop of a system layer, and call the change callbacks from work
+     *          items scheduled on that layer.
+     *
+     *  The changes are watched from a single system layer: watching them from
+     *  another layer stops watching them from the previous one.
+     *  StopWatchingChanges() must be called, on the CHIP thread, before the
+     *  layer is shut down.
+     *
+     * @retval  CHIP_ERROR_NOT_IMPLEMENTED if the system does not report changes.
+     */
+    CHIP_ERROR WatchChanges(System::Layer & systemLayer);
+    void StopWatchingChanges();
+
+private:
+    friend class TestInterfaceCacheDispatch;
+
+    struct CallbackEntry
+    {
+        ChangeCallback callback;
+        void * context;
+    };
+
+    class ScopedLock;
+
+    InterfaceCache();
+
+    void Lock();
+    void Unlock();
+    void Refresh();
+    bool HasPendingChanges();
+    void OpenChangeSocket();
+    void DispatchChanges();
+    static void HandleChangeNotification(System::WatchableSocket & socket);
+    static void HandleDispatchWork(System::Layer * systemLayer, void * appState, CHIP_ERROR error);
+
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    System::Mutex mLock;
+#endif
+    std::shared_ptr<const InterfaceSnapshot> mSnapshot;
+    std::vector<CallbackEntry> mCallbacks; ///< Removed entries are cleared while the callbacks are being called
+    uint32_t mGeneration         = 0;
+    uint32_t mNotifiedGeneration = 0; ///< Generation for which the change callbacks were called
+    int mChangeSocket            = -1;
+    bool mIsStale                = true;
+    bool mIsDispatching          = false;
+    bool mIsDispatchScheduled    = false;
+
+    System::Layer * mWatchingLayer = nullptr;
+    System::WatchableSocket mWatch;
+};
+
+} // namespace Inet
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
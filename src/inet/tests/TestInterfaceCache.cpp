@@ -0,0 +1,220 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the InterfaceCache, which
+ *      the interface iterators read on sockets-based systems.
+ */
+
+#include <inet/InterfaceCache.h>
+
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <ifaddrs.h>
+#include <string.h>
+
+namespace chip {
+namespace Inet {
+
+class TestInterfaceCacheDispatch
+{
+public:
+    // Simulate a change reported by the system, as if the event loop had read a notification.
+    static void Dispatch(InterfaceCache & cache)
+    {
+        cache.mNotifiedGeneration = cache.GetGeneration() - 1;
+        cache.DispatchChanges();
+    }
+};
+
+} // namespace Inet
+} // namespace chip
+
+using namespace chip;
+using namespace chip::Inet;
+
+namespace {
+
+size_t sChangeCount = 0;
+
+void CountChanges(void * context, uint32_t generation)
+{
+    sChangeCount++;
+}
+
+void RemoveCountChanges(void * context, uint32_t generation)
+{
+    InterfaceCache::Instance().RemoveChangeCallback(CountChanges, context);
+    sChangeCount += 10;
+}
+
+// The snapshot lists the same interfaces and addresses as the system.
+void TestSnapshotContent(nlTestSuite * inSuite, void * inContext)
+{
+    std::shared_ptr<const InterfaceSnapshot> snapshot = InterfaceCache::Instance().GetSnapshot();
+    NL_TEST_ASSERT(inSuite, snapshot != nullptr);
+    VerifyOrReturn(snapshot != nullptr);
+
+    for (const InterfaceSnapshot::Interface & intf : snapshot->GetInterfaces())
+    {
+        NL_TEST_ASSERT(inSuite, intf.id == if_nametoindex(intf.name));
+    }
+
+    struct ifaddrs * addrsList;
+    size_t addressCount = 0;
+    NL_TEST_ASSERT(inSuite, getifaddrs(&addrsList) == 0);
+    for (struct ifaddrs * addr = addrsList; addr != nullptr; addr = addr->ifa_next)
+    {
+        if (addr->ifa_addr != nullptr &&
+            (addr->ifa_addr->sa_family == AF_INET6 || (INET_CONFIG_ENABLE_IPV4 && addr->ifa_addr->sa_family == AF_INET)))
+        {
+            addressCount++;
+        }
+    }
+    freeifaddrs(addrsList);
+
+    NL_TEST_ASSERT(inSuite, snapshot->GetAddresses().size() == addressCount);
+    for (const InterfaceSnapshot::Address & address : snapshot->GetAddresses())
+    {
+        NL_TEST_ASSERT(inSuite, address.interfaceIndex < snapshot->GetInterfaces().size());
+    }
+}
+
+// The iterators read the snapshot of the cache instead of querying the system.
+void TestIterators(nlTestSuite * inSuite, void * inContext)
+{
+    std::shared_ptr<const InterfaceSnapshot> snapshot = InterfaceCache::Instance().GetSnapshot();
+    VerifyOrReturn(snapshot != nullptr);
+
+    size_t index = 0;
+    for (InterfaceIterator it; it.HasCurrent(); it.Next(), index++)
+    {
+        char name[InterfaceIterator::kMaxIfNameLength];
+        NL_TEST_ASSERT(inSuite, index < snapshot->GetInterfaces().size());
+        VerifyOrReturn(index < snapshot->GetInterfaces().size());
+        NL_TEST_ASSERT(inSuite, it.GetInterfaceId() == snapshot->GetInterfaces()[index].id);
+        NL_TEST_ASSERT(inSuite, it.GetInterfaceName(name, sizeof(name)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, strcmp(name, snapshot->GetInterfaces()[index].name) == 0);
+        NL_TEST_ASSERT(inSuite, it.IsUp() == ((snapshot->GetInterfaces()[index].flags & IFF_UP) != 0));
+    }
+    NL_TEST_ASSERT(inSuite, index == snapshot->GetInterfaces().size());
+
+    index = 0;
+    for (InterfaceAddressIterator it; it.HasCurrent(); it.Next(), index++)
+    {
+        NL_TEST_ASSERT(inSuite, index < snapshot->GetAddresses().size());
+        VerifyOrReturn(index < snapshot->GetAddresses().size());
+
+        const InterfaceSnapshot::Address & address = snapshot->GetAddresses()[index];
+        NL_TEST_ASSERT(inSuite, it.GetAddress() == address.address);
+        NL_TEST_ASSERT(inSuite, it.GetPrefixLength() == address.prefixLength);
+        NL_TEST_ASSERT(inSuite, it.GetInterfaceId() == snapshot->GetInterfaces()[address.interfaceIndex].id);
+    }
+    NL_TEST_ASSERT(inSuite, index == snapshot->GetAddresses().size());
+}
+
+// Querying the system again does not change the generation nor call the callbacks when nothing changed.
+void TestNoChange(nlTestSuite * inSuite, void * inContext)
+{
+    InterfaceCache & cache = InterfaceCache::Instance();
+
+    NL_TEST_ASSERT(inSuite, cache.AddChangeCallback(CountChanges, nullptr) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.AddChangeCallback(CountChanges, nullptr) == CHIP_ERROR_DUPLICATE_KEY_ID);
+
+    const uint32_t generation                          = cache.GetGeneration();
+    std::shared_ptr<const InterfaceSnapshot> snapshot1 = cache.GetSnapshot();
+
+    cache.Invalidate();
+    std::shared_ptr<const InterfaceSnapshot> snapshot2 = cache.GetSnapshot();
+
+    NL_TEST_ASSERT(inSuite, cache.GetGeneration() == generation);
+    NL_TEST_ASSERT(inSuite, snapshot1 == snapshot2);
+    NL_TEST_ASSERT(inSuite, snapshot2 != nullptr && snapshot2->GetGeneration() == generation);
+    NL_TEST_ASSERT(inSuite, sChangeCount == 0);
+
+    cache.RemoveChangeCallback(CountChanges, nullptr);
+    NL_TEST_ASSERT(inSuite, cache.AddChangeCallback(CountChanges, nullptr) == CHIP_NO_ERROR);
+    cache.RemoveChangeCallback(CountChanges, nullptr);
+}
+
+// The callbacks are called by the dispatch of the changes only, and never after they are removed.
+void TestDispatch(nlTestSuite * inSuite, void * inContext)
+{
+    InterfaceCache & cache = InterfaceCache::Instance();
+    int first;
+    int second;
+
+    sChangeCount = 0;
+    NL_TEST_ASSERT(inSuite, cache.AddChangeCallback(CountChanges, &first) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.AddChangeCallback(RemoveCountChanges, &second) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.AddChangeCallback(CountChanges, &second) == CHIP_NO_ERROR);
+
+    TestInterfaceCacheDispatch::Dispatch(cache);
+    NL_TEST_ASSERT(inSuite, sChangeCount == 11);
+
+    // Nothing changed since the callbacks were called.
+    cache.Invalidate();
+    NL_TEST_ASSERT(inSuite, cache.GetSnapshot() != nullptr);
+    NL_TEST_ASSERT(inSuite, sChangeCount == 11);
+
+    // The callback removed during the previous dispatch is erased, so it can be added again.
+    cache.RemoveChangeCallback(RemoveCountChanges, &second);
+    NL_TEST_ASSERT(inSuite, cache.AddChangeCallback(CountChanges, &second) == CHIP_NO_ERROR);
+    TestInterfaceCacheDispatch::Dispatch(cache);
+    NL_TEST_ASSERT(inSuite, sChangeCount == 13);
+
+    cache.RemoveChangeCallback(CountChanges, &first);
+    cache.RemoveChangeCallback(CountChanges, &second);
+    TestInterfaceCacheDispatch::Dispatch(cache);
+    NL_TEST_ASSERT(inSuite, sChangeCount == 13);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestSnapshotContent", TestSnapshotContent),
+    NL_TEST_DEF("TestIterators", TestIterators),
+    NL_TEST_DEF("TestNoChange", TestNoChange),
+    NL_TEST_DEF("TestDispatch", TestDispatch),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestInterfaceCache()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Test-CHIP-InterfaceCache",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestInterfaceCache)
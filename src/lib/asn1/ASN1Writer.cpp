@@ -295,6 +295,9 @@ CHIP_ERROR ASN1Writer::PutConstructedType(const uint8_t * val, uint16_t valLen)
     // Do nothing for a null writer.
     VerifyOrReturnError(mBuf != nullptr, CHIP_NO_ERROR);
 
+    // Make sure there's enough space to copy the entire value.
+    VerifyOrReturnError((mWritePoint + valLen) <= mBufEnd, ASN1_ERROR_OVERFLOW);
+
     memcpy(mWritePoint, val, valLen);
     mWritePoint += valLen;
 
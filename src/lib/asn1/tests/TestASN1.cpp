@@ -300,6 +300,24 @@ static void TestASN1_NullWriter(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, encodedLen == 0);
 }
 
+static void TestASN1_ConstructedTypeOverflow(nlTestSuite * inSuite, void * inContext)
+{
+    // An empty SEQUENCE, then an empty SET.
+    const uint8_t kConstructedType[] = { 0x30, 0x00, 0x31, 0x00 };
+    uint8_t buf[sizeof(kConstructedType)];
+    ASN1Writer writer;
+
+    writer.Init(buf, sizeof(kConstructedType) - 1);
+    NL_TEST_ASSERT(inSuite, writer.PutConstructedType(kConstructedType, sizeof(kConstructedType)) == ASN1_ERROR_OVERFLOW);
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == 0);
+
+    writer.Init(buf, sizeof(kConstructedType));
+    NL_TEST_ASSERT(inSuite, writer.PutConstructedType(kConstructedType, sizeof(kConstructedType)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == sizeof(kConstructedType));
+    NL_TEST_ASSERT(inSuite, memcmp(buf, kConstructedType, sizeof(kConstructedType)) == 0);
+    NL_TEST_ASSERT(inSuite, writer.PutConstructedType(kConstructedType, 1) == ASN1_ERROR_OVERFLOW);
+}
+
 static void TestASN1_ObjectID(nlTestSuite * inSuite, void * inContext)
 {
     CHIP_ERROR err;
@@ -374,6 +392,7 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Test ASN1 encoding macros", TestASN1_Encode),
     NL_TEST_DEF("Test ASN1 decoding macros", TestASN1_Decode),
     NL_TEST_DEF("Test ASN1 NULL writer", TestASN1_NullWriter),
+    NL_TEST_DEF("Test ASN1 constructed type overflow", TestASN1_ConstructedTypeOverflow),
     NL_TEST_DEF("Test ASN1 Object IDs", TestASN1_ObjectID),
     NL_TEST_SENTINEL()
 };
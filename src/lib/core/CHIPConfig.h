@@ -1500,6 +1500,41 @@
 #define CHIP_CONFIG_DEBUG_CERT_VALIDATION 1
 #endif // CHIP_CONFIG_DEBUG_CERT_VALIDATION
 
+/**
+ *  @def CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE
+ *
+ *  @brief
+ *    The number of certificates kept in the process-wide cache of decoded
+ *    and verified CHIP certificates, which lets repeated certificate
+ *    validations (e.g. one per CASE session with the same peer) skip the
+ *    TBS conversion and the ECDSA signature verification.
+ *
+ *    Each entry holds a copy of the certificate, so the cache takes about
+ *    1 KB of static memory per entry. Set to 0 to disable the cache.
+ *
+ */
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE 0
+#endif // CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE
+
+/**
+ *  @def CHIP_CONFIG_CERT_DECODE_POOL_SIZE
+ *
+ *  @brief
+ *    The number of certificate decode states (an array of 3 certificate
+ *    data entries and a decode buffer) in the process-wide pool that
+ *    certificate sets used during CASE handshakes borrow instead of
+ *    allocating them from the heap.
+ *
+ *    A CASE responder holds one state for its operational credentials and
+ *    another one while it validates the peer certificates. When all the
+ *    states are in use, certificate sets fall back to heap allocations.
+ *
+ */
+#ifndef CHIP_CONFIG_CERT_DECODE_POOL_SIZE
+#define CHIP_CONFIG_CERT_DECODE_POOL_SIZE 2
+#endif // CHIP_CONFIG_CERT_DECODE_POOL_SIZE
+
 /**
  *  @def CHIP_CONFIG_OPERATIONAL_DEVICE_CERT_CURVE_ID
  *
@@ -1613,6 +1648,59 @@
 #define CHIP_CONFIG_PERSISTED_STORAGE_KEY_GLOBAL_MESSAGE_COUNTER "GlobalMCTR"
 #endif // CHIP_CONFIG_PERSISTED_STORAGE_KEY_GLOBAL_MESSAGE_COUNTER
 
+/**
+ *  @def CHIP_CONFIG_GLOBAL_MESSAGE_COUNTER_MIN_EPOCH
+ *
+ *  @brief
+ *    The minimum number of global encrypted message counter values reserved
+ *    in persistent storage at once. This is also the number of values the
+ *    counter skips on reboot when messages are rarely sent.
+ *
+ */
+#ifndef CHIP_CONFIG_GLOBAL_MESSAGE_COUNTER_MIN_EPOCH
+#define CHIP_CONFIG_GLOBAL_MESSAGE_COUNTER_MIN_EPOCH 1000
+#endif // CHIP_CONFIG_GLOBAL_MESSAGE_COUNTER_MIN_EPOCH
+
+/**
+ *  @def CHIP_CONFIG_GLOBAL_MESSAGE_COUNTER_MAX_EPOCH
+ *
+ *  @brief
+ *    The maximum number of global encrypted message counter values reserved
+ *    in persistent storage at once, when messages are sent at a high rate.
+ *
+ */
+#ifndef CHIP_CONFIG_GLOBAL_MESSAGE_COUNTER_MAX_EPOCH
+#define CHIP_CONFIG_GLOBAL_MESSAGE_COUNTER_MAX_EPOCH 65536
+#endif // CHIP_CONFIG_GLOBAL_MESSAGE_COUNTER_MAX_EPOCH
+
+/**
+ *  @def CHIP_CONFIG_CRYPTO_WORKER_THREADS
+ *
+ *  @brief
+ *    The number of worker threads that decrypt received messages, and that verify
+ *    the CASE signatures, off the CHIP event loop thread.
+ *
+ *    Zero (the default) runs all cryptographic operations synchronously on the
+ *    event loop thread. Worker threads require POSIX sockets and locking.
+ *
+ */
+#ifndef CHIP_CONFIG_CRYPTO_WORKER_THREADS
+#define CHIP_CONFIG_CRYPTO_WORKER_THREADS 0
+#endif // CHIP_CONFIG_CRYPTO_WORKER_THREADS
+
+/**
+ *  @def CHIP_CONFIG_CRYPTO_WORKER_QUEUE_SIZE
+ *
+ *  @brief
+ *    The maximum number of jobs that can be pending in the crypto worker pool.
+ *    When the pool is full, the event loop thread waits for the pending jobs
+ *    before it decrypts more received messages.
+ *
+ */
+#ifndef CHIP_CONFIG_CRYPTO_WORKER_QUEUE_SIZE
+#define CHIP_CONFIG_CRYPTO_WORKER_QUEUE_SIZE 64
+#endif // CHIP_CONFIG_CRYPTO_WORKER_QUEUE_SIZE
+
 /**
  *  @def CHIP_CONFIG_DEFAULT_CASE_CURVE_ID
  *
@@ -65,6 +65,66 @@ public:
      * @param[in] key Key to be deleted
      */
     virtual CHIP_ERROR SyncDeleteKeyValue(const char * key) = 0;
+
+    /**
+     * @brief
+     *   Starts a batch of writes. The values set or deleted until the batch is committed are
+     *   persisted together, or not at all. Batches cannot be nested.
+     *
+     *   Storage that does not support batches returns CHIP_ERROR_NOT_IMPLEMENTED, and keeps
+     *   persisting each value as it is set.
+     */
+    virtual CHIP_ERROR BeginTransaction() { return CHIP_ERROR_NOT_IMPLEMENTED; }
+
+    /**
+     * @brief
+     *   Persists the writes made since BeginTransaction. On failure, none of them is kept.
+     */
+    virtual CHIP_ERROR CommitTransaction() { return CHIP_ERROR_INCORRECT_STATE; }
+
+    /**
+     * @brief
+     *   Discards the writes made since BeginTransaction.
+     */
+    virtual void AbortTransaction() {}
+};
+
+/**
+ * Batches the writes made to a PersistentStorageDelegate while it is in scope: they are persisted
+ * together by Commit(), and discarded if it goes out of scope first.
+ *
+ * If the storage does not support batches, or a batch is already in progress, the writes are
+ * persisted as they would have been without it, and Commit() does nothing.
+ */
+class PersistentStorageTransaction
+{
+public:
+    explicit PersistentStorageTransaction(PersistentStorageDelegate & storage) :
+        mStorage(storage), mActive(storage.BeginTransaction() == CHIP_NO_ERROR)
+    {}
+
+    ~PersistentStorageTransaction()
+    {
+        if (mActive)
+        {
+            mStorage.AbortTransaction();
+        }
+    }
+
+    CHIP_ERROR Commit()
+    {
+        if (!mActive)
+        {
+            return CHIP_NO_ERROR;
+        }
+
+        mActive = false;
+        return mStorage.CommitTransaction();
+    }
+
+private:
+    PersistentStorageDelegate & mStorage;
+    bool mActive;
 };
 
 } // namespace chip
@@ -109,6 +109,9 @@ public:
     /**
      * Initializes a TLVReader object to read from a single input buffer.
      *
+     * Without a backing store, the reader decodes element heads in place and skips containers by jumping over
+     * their elements, which makes it faster than one reading the same buffer through a backing store.
+     *
      * @param[in]   data    A pointer to a buffer containing the TLV data to be parsed.
      * @param[in]   dataLen The length of the TLV data to be parsed.
      *
@@ -758,6 +761,26 @@ public:
      */
     CHIP_ERROR FindElementWithTag(const uint64_t tagInApiForm, TLVReader & destReader) const;
 
+    /**
+     * Advances the TLVReader object to the element of the current container that starts at the given
+     * offset.
+     *
+     * The offset is the value returned by GetLengthRead() when a reader was positioned immediately
+     * before the element (e.g. after a call to Skip()), during an earlier traversal of the same TLV
+     * encoding. The bytes that precede the element are skipped without being parsed, so that elements
+     * found by a single traversal can then be accessed in any order.
+     *
+     * @param[in] elementOffset             The offset of the element within the TLV encoding.
+     *
+     * @retval #CHIP_NO_ERROR              If the reader was successfully positioned on the element.
+     * @retval #CHIP_END_OF_TLV            If the offset is that of the end of the container.
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT
+     *                                      If the offset precedes the current position of the reader.
+     * @retval other                        Other errors returned by Next().
+     *
+     */
+    CHIP_ERROR SeekToElement(uint32_t elementOffset);
+
     /**
      * The profile id to be used for profile tags encoded in implicit form.
      *
@@ -798,11 +821,14 @@ protected:
     void SetContainerOpen(bool aContainerOpen) { mContainerOpen = aContainerOpen; }
 
     CHIP_ERROR ReadElement();
+    CHIP_ERROR ReadElementContiguous();
+    CHIP_ERROR SkipContainerContents(TLVType containerType, bool isSkippedContainer);
     void ClearElementState();
     CHIP_ERROR SkipData();
     CHIP_ERROR SkipToEndOfContainer();
     CHIP_ERROR VerifyElement();
     uint64_t ReadTag(TLVTagControl tagControl, const uint8_t *& p);
+    static uint64_t ReadLengthOrValue(TLVFieldSize fieldSize, const uint8_t *& p);
     CHIP_ERROR EnsureData(CHIP_ERROR noDataErr);
     CHIP_ERROR ReadData(uint8_t * buf, uint32_t len);
     CHIP_ERROR GetElementHeadLength(uint8_t & elemHeadBytes) const;
@@ -1652,6 +1678,35 @@ public:
      */
     CHIP_ERROR PutPreEncodedContainer(uint64_t tag, TLVType containerType, const uint8_t * data, uint32_t dataLen);
 
+    /**
+     * Encodes a set of pre-encoded members in the current structure
+     *
+     * The PutPreEncodedElements() method copies one or more fully-encoded TLV elements, taken from a pre-encoded
+     * buffer, to the output as they are.  This lets a codec that knows the layout of a set of structure members in
+     * advance encode them in a local buffer and write them in one call.  The writer must be positioned in a structure,
+     * and the elements are expected to have context-specific tags; the writer does not decode them to check their tags.
+     *
+     * @param[in]   data            A pointer to a buffer containing one or more encoded TLV elements.
+     * @param[in]   dataLen         The number of bytes in the @p data buffer.
+     *
+     * @retval #CHIP_NO_ERROR      If the method succeeded.
+     * @retval #CHIP_ERROR_TLV_CONTAINER_OPEN
+     *                              If a container writer has been opened on the current writer and not
+     *                              yet closed.
+     * @retval #CHIP_ERROR_WRONG_TLV_TYPE
+     *                              If the writer is not positioned in a structure.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL
+     *                              If writing the elements would exceed the limit on the maximum number of
+     *                              bytes specified when the writer was initialized.
+     * @retval #CHIP_ERROR_NO_MEMORY
+     *                              If an attempt to allocate an output buffer failed due to lack of
+     *                              memory.
+     * @retval other                Other CHIP or platform-specific errors returned by the configured
+     *                              TLVBackingStore.
+     *
+     */
+    CHIP_ERROR PutPreEncodedElements(const uint8_t * data, uint32_t dataLen);
+
     /**
      * Copies a TLV container element from TLVReader object
      *
@@ -464,7 +464,18 @@ CHIP_ERROR TLVReader::Skip()
     if (elemType == TLVElementType::EndOfContainer)
         return CHIP_END_OF_TLV;
 
-    if (TLVTypeIsContainer(elemType))
+    if (TLVTypeIsContainer(elemType) && mBackingStore == nullptr)
+    {
+        SetContainerOpen(false);
+
+        err = SkipContainerContents(static_cast<TLVType>(elemType), true);
+        if (err != CHIP_NO_ERROR)
+            return err;
+
+        ClearElementState();
+    }
+
+    else if (TLVTypeIsContainer(elemType))
     {
         TLVType outerContainerType;
         err = EnterContainer(outerContainerType);
@@ -513,7 +524,18 @@ CHIP_ERROR TLVReader::SkipData()
     CHIP_ERROR err          = CHIP_NO_ERROR;
     TLVElementType elemType = ElementType();
 
-    if (TLVTypeHasLength(elemType))
+    if (TLVTypeHasLength(elemType) && mBackingStore == nullptr)
+    {
+        uint32_t len = static_cast<uint32_t>(mElemLenOrVal);
+
+        if (len > mBufEnd - mReadPoint)
+            return CHIP_ERROR_TLV_UNDERRUN;
+
+        mReadPoint += len;
+        mLenRead += len;
+    }
+
+    else if (TLVTypeHasLength(elemType))
     {
         err = ReadData(nullptr, static_cast<uint32_t>(mElemLenOrVal));
         if (err != CHIP_NO_ERROR)
@@ -548,6 +570,13 @@ CHIP_ERROR TLVReader::SkipToEndOfContainer()
             mContainerType = (nestLevel == 0) ? outerContainerType : kTLVType_UnknownContainer;
         }
 
+        else if (TLVTypeIsContainer(elemType) && mBackingStore == nullptr)
+        {
+            err = SkipContainerContents(static_cast<TLVType>(elemType), false);
+            if (err != CHIP_NO_ERROR)
+                return err;
+        }
+
         else if (TLVTypeIsContainer(elemType))
         {
             nestLevel++;
@@ -571,6 +600,9 @@ CHIP_ERROR TLVReader::ReadElement()
     const uint8_t * p;
     TLVElementType elemType;
 
+    if (mBackingStore == nullptr)
+        return ReadElementContiguous();
+
     // Make sure we have input data. Return CHIP_END_OF_TLV if no more data is available.
     err = EnsureData(CHIP_END_OF_TLV);
     if (err != CHIP_NO_ERROR)
@@ -649,6 +681,153 @@ CHIP_ERROR TLVReader::ReadElement()
     return VerifyElement();
 }
 
+/**
+ * Read the head of the next element of an encoding that is in a single buffer, i.e. of a reader without a backing
+ * store. The head is decoded in place, with a single check that it is in the buffer.
+ */
+CHIP_ERROR TLVReader::ReadElementContiguous()
+{
+    const uint8_t * p = mReadPoint;
+
+    if (p == mBufEnd)
+        return CHIP_END_OF_TLV;
+    if (p == nullptr)
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
+
+    mControlByte = *p;
+
+    TLVElementType elemType = ElementType();
+    if (!IsValidTLVType(elemType))
+        return CHIP_ERROR_INVALID_TLV_ELEMENT;
+
+    TLVTagControl tagControl       = static_cast<TLVTagControl>(mControlByte & kTLVTagControlMask);
+    TLVFieldSize lenOrValFieldSize = GetTLVFieldSize(elemType);
+    uint8_t valOrLenBytes          = TLVFieldSizeToBytes(lenOrValFieldSize);
+    uint8_t elemHeadBytes          = static_cast<uint8_t>(1 + sTagSizes[tagControl >> kTLVTagControlShift] + valOrLenBytes);
+
+    if (elemHeadBytes > (mBufEnd - p))
+        return CHIP_ERROR_TLV_UNDERRUN;
+
+    mReadPoint += elemHeadBytes;
+    mLenRead += elemHeadBytes;
+
+    // Context and anonymous tags are the common case, which does not need ReadTag().
+    p++;
+    if (tagControl == TLVTagControl::ContextSpecific)
+        mElemTag = ContextTag(*p++);
+    else if (tagControl == TLVTagControl::Anonymous)
+        mElemTag = AnonymousTag;
+    else
+        mElemTag = ReadTag(tagControl, p);
+
+    mElemLenOrVal = ReadLengthOrValue(lenOrValFieldSize, p);
+
+    return VerifyElement();
+}
+
+/**
+ * Skip the contents of a container of an encoding that is in a single buffer, after its head and up to and including
+ * its end, with the checks that SkipToEndOfContainer() makes.
+ *
+ * Elements are jumped over from the lengths in their heads, without decoding their tags and values, and nested
+ * containers are only counted. As in SkipToEndOfContainer(), the elements that follow a nested container are no
+ * longer checked against the type of their container, except in the outermost one when it is being skipped.
+ *
+ * @param[in] containerType         The type of the container.
+ * @param[in] isSkippedContainer    True if the container is skipped, false if it is nested in a container the
+ *                                  reader exits.
+ */
+CHIP_ERROR TLVReader::SkipContainerContents(TLVType containerType, bool isSkippedContainer)
+{
+    TLVType elemContainerType = containerType;
+    uint32_t nestLevel        = 0;
+
+    while (true)
+    {
+        const uint8_t * p = mReadPoint;
+
+        if (p == mBufEnd)
+            return CHIP_END_OF_TLV;
+
+        TLVElementType elemType = static_cast<TLVElementType>(*p & kTLVTypeMask);
+        if (!IsValidTLVType(elemType))
+            return CHIP_ERROR_INVALID_TLV_ELEMENT;
+
+        TLVTagControl tagControl       = static_cast<TLVTagControl>(*p & kTLVTagControlMask);
+        TLVFieldSize lenOrValFieldSize = GetTLVFieldSize(elemType);
+        uint8_t valOrLenBytes          = TLVFieldSizeToBytes(lenOrValFieldSize);
+        uint8_t elemHeadBytes          = static_cast<uint8_t>(1 + sTagSizes[tagControl >> kTLVTagControlShift] + valOrLenBytes);
+
+        if (elemHeadBytes > (mBufEnd - p))
+            return CHIP_ERROR_TLV_UNDERRUN;
+
+        if (elemType == TLVElementType::EndOfContainer)
+        {
+            if (tagControl != TLVTagControl::Anonymous)
+                return CHIP_ERROR_INVALID_TLV_TAG;
+        }
+        else
+        {
+            if ((tagControl == TLVTagControl::ImplicitProfile_2Bytes || tagControl == TLVTagControl::ImplicitProfile_4Bytes) &&
+                ImplicitProfileId == kProfileIdNotSpecified)
+                return CHIP_ERROR_UNKNOWN_IMPLICIT_TLV_TAG;
+            if (elemContainerType == kTLVType_Structure && tagControl == TLVTagControl::Anonymous)
+                return CHIP_ERROR_INVALID_TLV_TAG;
+            if (elemContainerType == kTLVType_Array && tagControl != TLVTagControl::Anonymous)
+                return CHIP_ERROR_INVALID_TLV_TAG;
+        }
+
+        mReadPoint += elemHeadBytes;
+        mLenRead += elemHeadBytes;
+
+        if (TLVTypeHasLength(elemType))
+        {
+            const uint8_t * lenField = p + elemHeadBytes - valOrLenBytes;
+            uint32_t len             = static_cast<uint32_t>(ReadLengthOrValue(lenOrValFieldSize, lenField));
+
+            if (len > mMaxLen - mLenRead || len > mBufEnd - mReadPoint)
+                return CHIP_ERROR_TLV_UNDERRUN;
+
+            mReadPoint += len;
+            mLenRead += len;
+        }
+
+        if (elemType == TLVElementType::EndOfContainer)
+        {
+            if (nestLevel == 0)
+                return CHIP_NO_ERROR;
+            nestLevel--;
+            elemContainerType = (nestLevel == 0 && isSkippedContainer) ? containerType : kTLVType_UnknownContainer;
+        }
+        else if (TLVTypeIsContainer(elemType))
+        {
+            nestLevel++;
+            elemContainerType = static_cast<TLVType>(elemType);
+        }
+    }
+}
+
+/**
+ * Read the length or value field of an element head, of the given size.
+ */
+uint64_t TLVReader::ReadLengthOrValue(TLVFieldSize fieldSize, const uint8_t *& p)
+{
+    switch (fieldSize)
+    {
+    case kTLVFieldSize_1Byte:
+        return Read8(p);
+    case kTLVFieldSize_2Byte:
+        return LittleEndian::Read16(p);
+    case kTLVFieldSize_4Byte:
+        return LittleEndian::Read32(p);
+    case kTLVFieldSize_8Byte:
+        return LittleEndian::Read64(p);
+    case kTLVFieldSize_0Byte:
+    default:
+        return 0;
+    }
+}
+
 CHIP_ERROR TLVReader::VerifyElement()
 {
     if (ElementType() == TLVElementType::EndOfContainer)
@@ -867,5 +1046,15 @@ exit:
     return err;
 }
 
+CHIP_ERROR TLVReader::SeekToElement(uint32_t elementOffset)
+{
+    ReturnErrorOnFailure(Skip());
+    VerifyOrReturnError(elementOffset >= mLenRead, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(ReadData(nullptr, elementOffset - mLenRead));
+
+    return Next();
+}
+
 } // namespace TLV
 } // namespace chip
@@ -0,0 +1,325 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines TLV codecs declared from the list of members of a structure, for structures whose
+ *      members are integers or booleans with context tags 0, 1, 2... in declaration order, such as cluster command arguments.
+ *
+ *      The members are given as a tuple of references, e.g. std::tie(level, transitionTime). The encoder writes
+ *      each member with a fixed size encoding whose control byte and tag are known at compile time, in a local
+ *      buffer, and hands the whole to the writer in one call. The decoder expects the members in order, with a
+ *      fall back to a decoding in any order, ignoring unknown and non-context tags, when they are not.
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <core/CHIPEncoding.h>
+#include <core/CHIPError.h>
+#include <core/CHIPTLV.h>
+#include <support/CodeUtils.h>
+
+namespace chip {
+namespace TLV {
+namespace Schema {
+
+namespace Internal {
+
+// A context tag of one byte, with the control byte before it.
+constexpr size_t kFieldHeadLength = 2;
+
+// The members of a structure are limited to those that fit in the mask of the members decoded.
+constexpr size_t kMaxFieldCount = 32;
+
+constexpr uint8_t ControlByte(TLVElementType type)
+{
+    return static_cast<uint8_t>(static_cast<uint8_t>(TLVTagControl::ContextSpecific) | static_cast<uint8_t>(type));
+}
+
+// The low bits of the element type of an integer, for its size.
+constexpr uint8_t SizeField(size_t size)
+{
+    return static_cast<uint8_t>((size == 1) ? kTLVFieldSize_1Byte
+                                            : (size == 2) ? kTLVFieldSize_2Byte
+                                                          : (size == 4) ? kTLVFieldSize_4Byte : kTLVFieldSize_8Byte);
+}
+
+inline void PutValue(uint8_t * p, uint8_t v)
+{
+    Encoding::Put8(p, v);
+}
+inline void PutValue(uint8_t * p, uint16_t v)
+{
+    Encoding::LittleEndian::Put16(p, v);
+}
+inline void PutValue(uint8_t * p, uint32_t v)
+{
+    Encoding::LittleEndian::Put32(p, v);
+}
+inline void PutValue(uint8_t * p, uint64_t v)
+{
+    Encoding::LittleEndian::Put64(p, v);
+}
+
+/**
+ * The fixed size encoding of a member of type T: integers with the element type of their own size, whatever their
+ * value, and booleans as such.
+ */
+template <typename T, typename Enable = void>
+struct FixedEncoding;
+
+template <typename T>
+struct FixedEncoding<T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type>
+{
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8, "Unsupported integer size");
+
+    using Unsigned = typename std::make_unsigned<T>::type;
+
+    static constexpr size_t kValueLength  = sizeof(T);
+    static constexpr TLVElementType kType = static_cast<TLVElementType>(
+        static_cast<uint8_t>(std::is_signed<T>::value ? TLVElementType::Int8 : TLVElementType::UInt8) + SizeField(sizeof(T)));
+
+    static uint8_t * Encode(uint8_t * p, uint8_t tag, T value)
+    {
+        p[0] = ControlByte(kType);
+        p[1] = tag;
+        PutValue(&p[kFieldHeadLength], static_cast<Unsigned>(value));
+        return p + kFieldHeadLength + kValueLength;
+    }
+};
+
+template <>
+struct FixedEncoding<bool>
+{
+    static constexpr size_t kValueLength = 0;
+
+    static uint8_t * Encode(uint8_t * p, uint8_t tag, bool value)
+    {
+        p[0] = ControlByte(value ? TLVElementType::BooleanTrue : TLVElementType::BooleanFalse);
+        p[1] = tag;
+        return p + kFieldHeadLength;
+    }
+};
+
+template <typename... Ts>
+struct EncodedLength;
+
+template <>
+struct EncodedLength<>
+{
+    static constexpr size_t value = 0;
+};
+
+template <typename T, typename... Ts>
+struct EncodedLength<T, Ts...>
+{
+    static constexpr size_t value = kFieldHeadLength + FixedEncoding<typename std::decay<T>::type>::kValueLength +
+        EncodedLength<Ts...>::value;
+};
+
+template <typename T>
+uint8_t * EncodeField(uint8_t * p, uint8_t tag, const T & value)
+{
+    return FixedEncoding<T>::Encode(p, tag, value);
+}
+
+template <typename Tuple, size_t... Is>
+uint8_t * EncodeFields(uint8_t * p, const Tuple & fields, std::index_sequence<Is...>)
+{
+    int unused[] = { 0, ((p = EncodeField(p, static_cast<uint8_t>(Is), std::get<Is>(fields))), 0)... };
+    (void) unused;
+    return p;
+}
+
+// Decode the next element as the member with the given tag, unless decoding already failed.
+template <typename T>
+void DecodeNextField(TLVReader & reader, uint8_t tag, T & value, CHIP_ERROR & err)
+{
+    if (err != CHIP_NO_ERROR)
+    {
+        return;
+    }
+
+    err = reader.Next();
+    if (err == CHIP_END_OF_TLV)
+    {
+        err = CHIP_ERROR_TLV_TAG_NOT_FOUND;
+    }
+    else if (err == CHIP_NO_ERROR)
+    {
+        err = (reader.GetTag() == ContextTag(tag)) ? reader.Get(value) : CHIP_ERROR_UNEXPECTED_TLV_ELEMENT;
+    }
+}
+
+template <typename Tuple, size_t... Is>
+CHIP_ERROR DecodeFieldsInOrder(TLVReader & reader, Tuple & fields, std::index_sequence<Is...>)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    int unused[]   = { 0, (DecodeNextField(reader, static_cast<uint8_t>(Is), std::get<Is>(fields), err), 0)... };
+    (void) unused;
+    ReturnErrorOnFailure(err);
+
+    // Anything after the last member is for the generic path to ignore.
+    err = reader.Next();
+    if (err == CHIP_END_OF_TLV)
+    {
+        return CHIP_NO_ERROR;
+    }
+    return (err == CHIP_NO_ERROR) ? CHIP_ERROR_UNEXPECTED_TLV_ELEMENT : err;
+}
+
+template <typename Tuple, size_t... Is>
+CHIP_ERROR DecodeFieldAt(TLVReader & reader, uint32_t index, Tuple & fields, std::index_sequence<Is...>)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    int unused[]   = { 0, ((Is == index) ? ((err = reader.Get(std::get<Is>(fields))), 0) : 0)... };
+    (void) unused;
+    return err;
+}
+
+template <typename Tuple, size_t... Is>
+CHIP_ERROR DecodeFieldsInAnyOrder(TLVReader & reader, Tuple & fields, std::index_sequence<Is...> indices)
+{
+    constexpr size_t kFieldCount  = sizeof...(Is);
+    constexpr uint32_t kAllFields = (kFieldCount == kMaxFieldCount) ? UINT32_MAX : ((1u << kFieldCount) - 1);
+    uint32_t decoded              = 0;
+    CHIP_ERROR err;
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (!IsContextTag(reader.GetTag()))
+        {
+            continue;
+        }
+
+        const uint32_t tagNum = TagNumFromTag(reader.GetTag());
+        if (tagNum >= kFieldCount)
+        {
+            continue;
+        }
+
+        VerifyOrReturnError((decoded & (1u << tagNum)) == 0, CHIP_ERROR_INVALID_TLV_ELEMENT);
+        decoded |= (1u << tagNum);
+
+        ReturnErrorOnFailure(DecodeFieldAt(reader, tagNum, fields, indices));
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    VerifyOrReturnError(decoded == kAllFields, CHIP_ERROR_TLV_TAG_NOT_FOUND);
+    return CHIP_NO_ERROR;
+}
+
+} // namespace Internal
+
+/**
+ * The maximum length of the encoding of members of types Ts by EncodeFields().
+ */
+template <typename... Ts>
+constexpr size_t EncodedLength()
+{
+    return Internal::EncodedLength<Ts...>::value;
+}
+
+/**
+ * Encode the members of a structure in the current container of a writer, with context tags in order.
+ *
+ * @param[in] writer    The writer, in a structure.
+ * @param[in] fields    The members, e.g. std::tie(level, transitionTime).
+ *
+ * @return The error returned by the writer.
+ */
+template <typename... Ts>
+CHIP_ERROR EncodeFields(TLVWriter & writer, const std::tuple<Ts &...> & fields)
+{
+    static_assert(sizeof...(Ts) > 0 && sizeof...(Ts) <= Internal::kMaxFieldCount, "Unsupported number of members");
+
+    uint8_t buf[EncodedLength<Ts...>()];
+    const uint8_t * end = Internal::EncodeFields(buf, fields, std::index_sequence_for<Ts...>());
+    return writer.PutPreEncodedElements(buf, static_cast<uint32_t>(end - buf));
+}
+
+/**
+ * Decode the members of a structure from the current container of a reader.
+ *
+ * The members are expected with context tags in order, and decoded in a single pass. When they are not, the reader
+ * goes back to the start of the container and decodes them in any order: elements with non-context tags or unknown
+ * context tags are ignored.
+ *
+ * @param[in] reader    The reader, in a structure, before its first element.
+ * @param[in] fields    The members, e.g. std::tie(level, transitionTime).
+ *
+ * @retval #CHIP_NO_ERROR                   If all the members were decoded.
+ * @retval #CHIP_ERROR_TLV_TAG_NOT_FOUND    If a member is missing.
+ * @retval #CHIP_ERROR_INVALID_TLV_ELEMENT  If a member is present twice.
+ * @retval other                            The error returned by the reader, e.g. #CHIP_ERROR_WRONG_TLV_TYPE.
+ */
+template <typename... Ts>
+CHIP_ERROR DecodeFields(TLVReader & reader, const std::tuple<Ts &...> & fields)
+{
+    static_assert(sizeof...(Ts) > 0 && sizeof...(Ts) <= Internal::kMaxFieldCount, "Unsupported number of members");
+
+    TLVReader start = reader;
+
+    CHIP_ERROR err = Internal::DecodeFieldsInOrder(reader, fields, std::index_sequence_for<Ts...>());
+    if (err != CHIP_ERROR_UNEXPECTED_TLV_ELEMENT)
+    {
+        return err;
+    }
+
+    reader = start;
+    return Internal::DecodeFieldsInAnyOrder(reader, fields, std::index_sequence_for<Ts...>());
+}
+
+/**
+ * Encode a structure element whose members are encoded by EncodeFields().
+ */
+template <typename... Ts>
+CHIP_ERROR EncodeStruct(TLVWriter & writer, uint64_t tag, const std::tuple<Ts &...> & fields)
+{
+    TLVType outerContainerType;
+
+    ReturnErrorOnFailure(writer.StartContainer(tag, kTLVType_Structure, outerContainerType));
+    ReturnErrorOnFailure(EncodeFields(writer, fields));
+    return writer.EndContainer(outerContainerType);
+}
+
+/**
+ * Decode the structure element the reader is positioned on, with DecodeFields().
+ */
+template <typename... Ts>
+CHIP_ERROR DecodeStruct(TLVReader & reader, const std::tuple<Ts &...> & fields)
+{
+    TLVType outerContainerType;
+
+    VerifyOrReturnError(reader.GetType() == kTLVType_Structure, CHIP_ERROR_WRONG_TLV_TYPE);
+    ReturnErrorOnFailure(reader.EnterContainer(outerContainerType));
+    ReturnErrorOnFailure(DecodeFields(reader, fields));
+    return reader.ExitContainer(outerContainerType);
+}
+
+} // namespace Schema
+} // namespace TLV
+} // namespace chip
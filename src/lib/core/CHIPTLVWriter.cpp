@@ -563,6 +563,21 @@ CHIP_ERROR TLVWriter::PutPreEncodedContainer(uint64_t tag, TLVType containerType
     return WriteData(data, dataLen);
 }
 
+CHIP_ERROR TLVWriter::PutPreEncodedElements(const uint8_t * data, uint32_t dataLen)
+{
+    if (IsContainerOpen())
+        return CHIP_ERROR_TLV_CONTAINER_OPEN;
+
+    // The elements are only written as structure members, where their context tags are valid.
+    if (mContainerType != kTLVType_Structure)
+        return CHIP_ERROR_WRONG_TLV_TYPE;
+
+    if (mLenWritten > mMaxLen || dataLen > mMaxLen - mLenWritten)
+        return CHIP_ERROR_BUFFER_TOO_SMALL;
+
+    return WriteData(data, dataLen);
+}
+
 CHIP_ERROR TLVWriter::CopyContainer(TLVReader & container)
 {
     return CopyContainer(container.GetTag(), container);
@@ -0,0 +1,226 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the decoding of a report like those of the
+ *      interaction model, by a TLV reader initialized with a contiguous buffer and by one
+ *      going through a backing store.
+ *
+ */
+
+#include <core/CHIPTLV.h>
+#include <support/CodeUtils.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+constexpr uint16_t kAttributeCount = 20;
+constexpr int kRounds              = 20000;
+
+/**
+ *  A backing store that hands a single buffer to a reader, so that the reader goes through EnsureData() and
+ *  ReadData() rather than the path of a reader initialized with a contiguous buffer.
+ */
+class SingleBufferBackingStore : public TLVBackingStore
+{
+public:
+    SingleBufferBackingStore(const uint8_t * buf, uint32_t len) : mBuf(buf), mLen(len) {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mBuf;
+        bufLen   = mLen;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mBuf + mLen;
+        bufLen   = 0;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const uint8_t * mBuf;
+    uint32_t mLen;
+};
+
+/**
+ *  Read all the elements of an encoding, entering containers and getting the values of integers and strings.
+ */
+CHIP_ERROR ReadAllElements(TLVReader & reader, size_t & count)
+{
+    CHIP_ERROR err;
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        count++;
+
+        if (TLVTypeIsContainer(reader.GetType()))
+        {
+            TLVType outerContainerType;
+            ReturnErrorOnFailure(reader.EnterContainer(outerContainerType));
+            ReturnErrorOnFailure(ReadAllElements(reader, count));
+            ReturnErrorOnFailure(reader.ExitContainer(outerContainerType));
+        }
+        else if (reader.GetType() == kTLVType_UnsignedInteger)
+        {
+            uint64_t v;
+            ReturnErrorOnFailure(reader.Get(v));
+        }
+        else if (reader.GetType() == kTLVType_SignedInteger)
+        {
+            int64_t v;
+            ReturnErrorOnFailure(reader.Get(v));
+        }
+        else if (reader.GetType() == kTLVType_UTF8String || reader.GetType() == kTLVType_ByteString)
+        {
+            const uint8_t * data;
+            ReturnErrorOnFailure(reader.GetDataPtr(data));
+        }
+    }
+
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+/**
+ *  Skip all the top level elements of an encoding.
+ */
+CHIP_ERROR SkipAllElements(TLVReader & reader, size_t & count)
+{
+    CHIP_ERROR err;
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        count++;
+        ReturnErrorOnFailure(reader.Skip());
+    }
+
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+/**
+ *  Write a report like those of the interaction model: attribute data elements with a path, a version and a value.
+ */
+CHIP_ERROR WriteReport(uint8_t * buf, uint32_t bufLen, uint16_t attributeCount, uint32_t & len)
+{
+    TLVWriter writer;
+    TLVType report, list, element, path;
+
+    writer.Init(buf, bufLen);
+
+    ReturnErrorOnFailure(writer.StartContainer(AnonymousTag, kTLVType_Structure, report));
+    ReturnErrorOnFailure(writer.StartContainer(ContextTag(1), kTLVType_Array, list));
+    for (uint16_t i = 0; i < attributeCount; i++)
+    {
+        ReturnErrorOnFailure(writer.StartContainer(AnonymousTag, kTLVType_Structure, element));
+        ReturnErrorOnFailure(writer.StartContainer(ContextTag(0), kTLVType_List, path));
+        ReturnErrorOnFailure(writer.Put(ContextTag(1), static_cast<uint16_t>(1)));
+        ReturnErrorOnFailure(writer.Put(ContextTag(2), static_cast<uint32_t>(0x0008)));
+        ReturnErrorOnFailure(writer.Put(ContextTag(3), static_cast<uint32_t>(i)));
+        ReturnErrorOnFailure(writer.EndContainer(path));
+        ReturnErrorOnFailure(writer.Put(ContextTag(1), static_cast<uint64_t>(0x12345678 + i)));
+        if (i % 2)
+        {
+            ReturnErrorOnFailure(writer.PutString(ContextTag(2), "attribute value"));
+        }
+        else
+        {
+            ReturnErrorOnFailure(writer.Put(ContextTag(2), static_cast<int16_t>(-i)));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(element));
+    }
+    ReturnErrorOnFailure(writer.EndContainer(list));
+    ReturnErrorOnFailure(writer.PutBoolean(ContextTag(2), true));
+    ReturnErrorOnFailure(writer.EndContainer(report));
+    ReturnErrorOnFailure(writer.Finalize());
+
+    len = writer.GetLengthWritten();
+    return CHIP_NO_ERROR;
+}
+
+/**
+ *  Decode the report kRounds times, and return the average time of a decode in nanoseconds, or a negative value
+ *  if a decode failed.
+ */
+double TimeDecode(const uint8_t * buf, uint32_t len, bool contiguous, CHIP_ERROR (*decode)(TLVReader &, size_t &))
+{
+    SingleBufferBackingStore store(buf, len);
+    size_t count = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        TLVReader reader;
+        if (contiguous)
+        {
+            reader.Init(buf, len);
+        }
+        else
+        {
+            reader.Init(store, len);
+        }
+        VerifyOrReturnError(decode(reader, count) == CHIP_NO_ERROR, -1);
+    }
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kRounds;
+}
+
+} // namespace
+
+int main()
+{
+    uint8_t buf[2048];
+    uint32_t len;
+
+    if (WriteReport(buf, sizeof(buf), kAttributeCount, len) != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to write the report\n");
+        return EXIT_FAILURE;
+    }
+
+    const double storeRead      = TimeDecode(buf, len, false, ReadAllElements);
+    const double contiguousRead = TimeDecode(buf, len, true, ReadAllElements);
+    const double storeSkip      = TimeDecode(buf, len, false, SkipAllElements);
+    const double contiguousSkip = TimeDecode(buf, len, true, SkipAllElements);
+
+    if (storeRead < 0 || contiguousRead < 0 || storeSkip < 0 || contiguousSkip < 0)
+    {
+        fprintf(stderr, "Failed to decode the report\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Report of %u attributes (%u bytes): read %.0f ns with a backing store, %.0f ns contiguous; "
+           "skip %.0f ns with a backing store, %.0f ns contiguous\n",
+           kAttributeCount, static_cast<unsigned>(len), storeRead, contiguousRead, storeSkip, contiguousSkip);
+    return EXIT_SUCCESS;
+}
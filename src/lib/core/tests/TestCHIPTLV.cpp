@@ -2477,6 +2477,187 @@ void CheckBufferOverflow(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+/**
+ *  Test Growable Packet Buffer Chain
+ */
+void CheckGrowablePacketBuffer(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferTLVReader reader;
+    System::PacketBufferHandle buf;
+    uint8_t bytes[64];
+
+    memset(bytes, 0x5A, sizeof(bytes));
+
+    // The chain grows as the encoding is written, from a first buffer much smaller than the encoding.
+    err = writer.InitGrowable(1024, 16, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    writer.ImplicitProfileId = TestProfile_2;
+
+    WriteEncoding1(inSuite, writer);
+
+    err = writer.Finalize(&buf);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buf->TotalLength() == sizeof(Encoding1));
+
+    TestBufferContents(inSuite, buf, Encoding1, sizeof(Encoding1));
+
+    reader.Init(buf.Retain(), /* useChainedBuffers = */ true);
+    reader.ImplicitProfileId = TestProfile_2;
+
+    ReadEncoding1(inSuite, reader);
+
+    // The chain does not grow beyond the maximum length.
+    err = writer.InitGrowable(sizeof(bytes), 16, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.PutBytes(AnonymousTag, bytes, sizeof(bytes));
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL);
+    writer.Reset();
+
+    // A first buffer of the largest size still grows into further buffers.
+    err = writer.InitGrowable(UINT16_MAX, System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    for (size_t written = 0; written <= System::PacketBuffer::kMaxSizeWithoutReserve; written += sizeof(bytes) + 2)
+    {
+        err = writer.PutBytes(AnonymousTag, bytes, sizeof(bytes));
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    }
+
+    err = writer.Finalize(&buf);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buf->HasChainedBuffer());
+
+    err = writer.InitGrowable(0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+/**
+ *  Test Rollback Of A Growable Packet Buffer Chain
+ */
+void CheckGrowablePacketBufferRollback(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle buf;
+    TLVWriter checkpoint;
+    TLVWriter expectedWriter;
+    uint8_t expected[64];
+    static uint8_t bytes[System::PacketBuffer::kMaxSizeWithoutReserve + 100];
+
+    memset(bytes, 0x5A, sizeof(bytes));
+
+    expectedWriter.Init(expected, sizeof(expected));
+    err = expectedWriter.Put(ProfileTag(TestProfile_1, 1), static_cast<uint32_t>(42));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = expectedWriter.PutString(ProfileTag(TestProfile_1, 3), "after rollback");
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = expectedWriter.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Roll back to a checkpoint taken in the first buffer after the encoding has spilled into further buffers.
+    err = writer.InitGrowable(2 * sizeof(bytes), 16, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Put(ProfileTag(TestProfile_1, 1), static_cast<uint32_t>(42));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    checkpoint = writer;
+
+    err = writer.PutBytes(ProfileTag(TestProfile_1, 2), bytes, sizeof(bytes));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    static_cast<TLVWriter &>(writer) = checkpoint;
+
+    err = writer.PutString(ProfileTag(TestProfile_1, 3), "after rollback");
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.Finalize(&buf);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, buf->TotalLength() == expectedWriter.GetLengthWritten());
+
+    TestBufferContents(inSuite, buf, expected, expectedWriter.GetLengthWritten());
+}
+
+/**
+ *  Test Finalizing A Growable Packet Buffer Chain
+ */
+void CheckGrowablePacketBufferFinalize(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle buf;
+    System::PacketBufferSegment segments[8];
+    size_t segmentCount;
+    static uint8_t bytes[System::PacketBuffer::kMaxSizeWithoutReserve + 100];
+    static uint8_t flattened[sizeof(bytes) + 16];
+    size_t offset = 0;
+
+    memset(bytes, 0x5A, sizeof(bytes));
+
+    // A chained encoding is copied to a single buffer, with the requested room around it.
+    err = writer.InitGrowable(1024, 16, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    writer.ImplicitProfileId = TestProfile_2;
+
+    WriteEncoding1(inSuite, writer);
+
+    err = writer.FinalizeContiguous(&buf, 8, 16);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !buf->HasChainedBuffer());
+    NL_TEST_ASSERT(inSuite, buf->ReservedSize() >= 8);
+    NL_TEST_ASSERT(inSuite, buf->AvailableDataLength() >= 16);
+
+    TestBufferContents(inSuite, buf, Encoding1, sizeof(Encoding1));
+
+    // An encoding that fits in the first buffer, with enough room around it, is left in place.
+    err = writer.InitGrowable(1024, sizeof(Encoding1) + 16, 8);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    writer.ImplicitProfileId = TestProfile_2;
+
+    WriteEncoding1(inSuite, writer);
+
+    err = writer.FinalizeContiguous(&buf, 8, 16);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, !buf->HasChainedBuffer());
+
+    TestBufferContents(inSuite, buf, Encoding1, sizeof(Encoding1));
+
+    // An encoding longer than a buffer is described segment by segment.
+    err = writer.InitGrowable(sizeof(flattened), 16, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.PutBytes(AnonymousTag, bytes, sizeof(bytes));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    segmentCount = ArraySize(segments);
+    err          = writer.Finalize(&buf, segments, segmentCount);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, segmentCount > 1 && segmentCount <= ArraySize(segments));
+
+    for (size_t i = 0; i < segmentCount && offset + segments[i].length <= sizeof(flattened); i++)
+    {
+        memcpy(&flattened[offset], segments[i].data, segments[i].length);
+        offset += segments[i].length;
+    }
+    NL_TEST_ASSERT(inSuite, offset == buf->TotalLength());
+    NL_TEST_ASSERT(inSuite, offset > sizeof(bytes));
+    NL_TEST_ASSERT(inSuite, memcmp(&flattened[offset - sizeof(bytes)], bytes, sizeof(bytes)) == 0);
+
+    // Too few segments for the chain.
+    err = writer.InitGrowable(sizeof(flattened), 16, 0);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = writer.PutBytes(AnonymousTag, bytes, sizeof(bytes));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    segmentCount = 1;
+    err          = writer.Finalize(&buf, segments, segmentCount);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
 /**
  * Test case to verify the correctness of TLVReader::GetTag()
  *
@@ -3159,6 +3340,89 @@ void TestCHIPTLVReader_SkipOverContainer(nlTestSuite * inSuite)
 /**
  *  Test CHIP TLV Reader
  */
+/**
+ *  Test CHIP TLV Reader SeekToElement function
+ */
+void TestCHIPTLVReaderSeekToElement(nlTestSuite * inSuite)
+{
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVReader reader;
+    TLVType outerContainerType;
+    TLVType innerContainerType;
+    uint32_t offsets[4];
+    bool value = false;
+    CHIP_ERROR err;
+
+    writer.Init(buf, sizeof(buf));
+    err = writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Put(ContextTag(1), static_cast<uint32_t>(1));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.StartContainer(ContextTag(2), kTLVType_Structure, innerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Put(ContextTag(1), static_cast<uint32_t>(2));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.EndContainer(innerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.PutBoolean(ContextTag(3), true);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.EndContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = writer.Finalize();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    // Record the offsets of the members of the structure, and of its end.
+    reader.Init(buf, writer.GetLengthWritten());
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    for (uint32_t & offset : offsets)
+    {
+        err = reader.Skip();
+        NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+        offset = reader.GetLengthRead();
+        reader.Next();
+    }
+
+    reader.Init(buf, writer.GetLengthWritten());
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = reader.SeekToElement(offsets[2]);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.GetTag() == ContextTag(3));
+    err = reader.Get(value);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR && value);
+
+    // The reader cannot seek backwards.
+    err = reader.SeekToElement(offsets[1]);
+    NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_INVALID_ARGUMENT);
+
+    err = reader.SeekToElement(offsets[3]);
+    NL_TEST_ASSERT(inSuite, err == CHIP_END_OF_TLV);
+
+    // Seeking from an element skips it first, like Next().
+    reader.Init(buf, writer.GetLengthWritten());
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.EnterContainer(outerContainerType);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    err = reader.Next();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    err = reader.SeekToElement(offsets[1]);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.GetTag() == ContextTag(2) && reader.GetType() == kTLVType_Structure);
+
+    err = reader.SeekToElement(offsets[2]);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.GetTag() == ContextTag(3));
+}
+
 void CheckCHIPTLVReader(nlTestSuite * inSuite, void * inContext)
 {
     TestCHIPTLVReaderSkip(inSuite);
@@ -3172,6 +3436,8 @@ void CheckCHIPTLVReader(nlTestSuite * inSuite, void * inContext)
     TestCHIPTLVReader_NextOverContainer(inSuite);
 
     TestCHIPTLVReader_SkipOverContainer(inSuite);
+
+    TestCHIPTLVReaderSeekToElement(inSuite);
 }
 
 /**
@@ -3523,6 +3789,277 @@ static void CheckCloseContainerReserve(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+/**
+ *  A backing store that hands a single buffer to a reader, so that the reader goes through EnsureData() and
+ *  ReadData() rather than the path of a reader initialized with a contiguous buffer.
+ */
+class SingleBufferBackingStore : public TLVBackingStore
+{
+public:
+    SingleBufferBackingStore(const uint8_t * buf, uint32_t len) : mBuf(buf), mLen(len) {}
+
+    CHIP_ERROR OnInit(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mBuf;
+        bufLen   = mLen;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR GetNextBuffer(TLVReader & reader, const uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        bufStart = mBuf + mLen;
+        bufLen   = 0;
+        return CHIP_NO_ERROR;
+    }
+    CHIP_ERROR OnInit(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
+    CHIP_ERROR GetNewBuffer(TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+    CHIP_ERROR FinalizeBuffer(TLVWriter & writer, uint8_t * bufStart, uint32_t bufLen) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+
+private:
+    const uint8_t * mBuf;
+    uint32_t mLen;
+};
+
+/**
+ *  Read all the elements of an encoding, entering containers, and return the first error other than the end of the
+ *  encoding, and the number of elements read.
+ */
+static CHIP_ERROR ReadAllElements(TLVReader & reader, size_t & count)
+{
+    CHIP_ERROR err;
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        count++;
+
+        if (TLVTypeIsContainer(reader.GetType()))
+        {
+            TLVType outerContainerType;
+            ReturnErrorOnFailure(reader.EnterContainer(outerContainerType));
+            ReturnErrorOnFailure(ReadAllElements(reader, count));
+            ReturnErrorOnFailure(reader.ExitContainer(outerContainerType));
+        }
+        else if (reader.GetType() == kTLVType_UnsignedInteger)
+        {
+            uint64_t v;
+            ReturnErrorOnFailure(reader.Get(v));
+        }
+        else if (reader.GetType() == kTLVType_SignedInteger)
+        {
+            int64_t v;
+            ReturnErrorOnFailure(reader.Get(v));
+        }
+        else if (reader.GetType() == kTLVType_UTF8String || reader.GetType() == kTLVType_ByteString)
+        {
+            const uint8_t * data;
+            ReturnErrorOnFailure(reader.GetDataPtr(data));
+        }
+    }
+
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+/**
+ *  Skip all the top level elements of an encoding, and return the first error other than the end of the encoding.
+ */
+static CHIP_ERROR SkipAllElements(TLVReader & reader, size_t & count)
+{
+    CHIP_ERROR err;
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        count++;
+        ReturnErrorOnFailure(reader.Skip());
+    }
+
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+/**
+ *  Check that a reader initialized with a contiguous buffer reads an encoding the way a reader with a backing store
+ *  does, whether it is well formed or not.
+ */
+static void CheckContiguousReaderMatches(nlTestSuite * inSuite, const uint8_t * buf, uint32_t len)
+{
+    SingleBufferBackingStore store(buf, len);
+    TLVReader contiguousReader;
+    TLVReader storeReader;
+    size_t contiguousCount = 0;
+    size_t storeCount      = 0;
+
+    contiguousReader.Init(buf, len);
+    contiguousReader.ImplicitProfileId = TestProfile_2;
+    storeReader.Init(store, len);
+    storeReader.ImplicitProfileId = TestProfile_2;
+
+    CHIP_ERROR err = ReadAllElements(contiguousReader, contiguousCount);
+    NL_TEST_ASSERT(inSuite, err == ReadAllElements(storeReader, storeCount));
+    NL_TEST_ASSERT(inSuite, contiguousCount == storeCount);
+    if (err == CHIP_NO_ERROR)
+    {
+        NL_TEST_ASSERT(inSuite, contiguousReader.GetLengthRead() == storeReader.GetLengthRead());
+    }
+
+    contiguousCount = 0;
+    storeCount      = 0;
+    contiguousReader.Init(buf, len);
+    contiguousReader.ImplicitProfileId = TestProfile_2;
+    storeReader.Init(store, len);
+    storeReader.ImplicitProfileId = TestProfile_2;
+
+    NL_TEST_ASSERT(inSuite, SkipAllElements(contiguousReader, contiguousCount) == SkipAllElements(storeReader, storeCount));
+    NL_TEST_ASSERT(inSuite, contiguousCount == storeCount);
+}
+
+void CheckContiguousReader(nlTestSuite * inSuite, void * inContext)
+{
+    // clang-format off
+    static const uint8_t sAnonymousMemberInStruct[] =
+    {
+        CHIP_TLV_STRUCTURE(CHIP_TLV_TAG_ANONYMOUS),
+            CHIP_TLV_UINT8(CHIP_TLV_TAG_ANONYMOUS, 1),
+        CHIP_TLV_END_OF_CONTAINER,
+    };
+    static const uint8_t sTaggedMemberInArray[] =
+    {
+        CHIP_TLV_ARRAY(CHIP_TLV_TAG_ANONYMOUS),
+            CHIP_TLV_UINT8(CHIP_TLV_TAG_CONTEXT_SPECIFIC(1), 1),
+        CHIP_TLV_END_OF_CONTAINER,
+    };
+    static const uint8_t sNestedAnonymousMemberInStruct[] =
+    {
+        CHIP_TLV_ARRAY(CHIP_TLV_TAG_ANONYMOUS),
+            CHIP_TLV_STRUCTURE(CHIP_TLV_TAG_ANONYMOUS),
+                CHIP_TLV_UINT8(CHIP_TLV_TAG_ANONYMOUS, 1),
+            CHIP_TLV_END_OF_CONTAINER,
+        CHIP_TLV_END_OF_CONTAINER,
+    };
+    static const uint8_t sUnknownImplicitTag[] =
+    {
+        CHIP_TLV_LIST(CHIP_TLV_TAG_ANONYMOUS),
+            CHIP_TLV_LIST(CHIP_TLV_TAG_ANONYMOUS),
+                CHIP_TLV_UINT8(CHIP_TLV_TAG_IMPLICIT_PROFILE_2Bytes(1), 1),
+            CHIP_TLV_END_OF_CONTAINER,
+        CHIP_TLV_END_OF_CONTAINER,
+    };
+    static const uint8_t sTruncatedString[] =
+    {
+        CHIP_TLV_LIST(CHIP_TLV_TAG_ANONYMOUS),
+            CHIP_TLV_LIST(CHIP_TLV_TAG_ANONYMOUS),
+                CHIP_TLV_UTF8_STRING_1ByteLength(CHIP_TLV_TAG_ANONYMOUS, 4, 'a', 'b'),
+    };
+    static const uint8_t sTruncatedHead[] =
+    {
+        CHIP_TLV_LIST(CHIP_TLV_TAG_ANONYMOUS),
+            CHIP_TLV_LIST(CHIP_TLV_TAG_ANONYMOUS),
+                CHIP_TLV_UINT32(CHIP_TLV_TAG_ANONYMOUS, 1),
+    };
+    static const uint8_t sMissingEndOfContainer[] =
+    {
+        CHIP_TLV_ARRAY(CHIP_TLV_TAG_ANONYMOUS),
+            CHIP_TLV_ARRAY(CHIP_TLV_TAG_ANONYMOUS),
+                CHIP_TLV_BOOL(CHIP_TLV_TAG_ANONYMOUS, true),
+            CHIP_TLV_END_OF_CONTAINER,
+    };
+    static const uint8_t sTaggedEndOfContainer[] =
+    {
+        CHIP_TLV_ARRAY(CHIP_TLV_TAG_ANONYMOUS),
+            CHIP_TLV_ARRAY(CHIP_TLV_TAG_ANONYMOUS),
+            chip::TLV::TLVElementType::EndOfContainer | CHIP_TLV_TAG_CONTEXT_SPECIFIC(1),
+        CHIP_TLV_END_OF_CONTAINER,
+    };
+    static const uint8_t sInvalidType[] =
+    {
+        CHIP_TLV_ARRAY(CHIP_TLV_TAG_ANONYMOUS),
+            CHIP_TLV_ARRAY(CHIP_TLV_TAG_ANONYMOUS),
+                0x1F,
+            CHIP_TLV_END_OF_CONTAINER,
+        CHIP_TLV_END_OF_CONTAINER,
+    };
+    // clang-format on
+
+    CheckContiguousReaderMatches(inSuite, Encoding1, sizeof(Encoding1));
+    CheckContiguousReaderMatches(inSuite, sAnonymousMemberInStruct, sizeof(sAnonymousMemberInStruct));
+    CheckContiguousReaderMatches(inSuite, sTaggedMemberInArray, sizeof(sTaggedMemberInArray));
+    CheckContiguousReaderMatches(inSuite, sNestedAnonymousMemberInStruct, sizeof(sNestedAnonymousMemberInStruct));
+    CheckContiguousReaderMatches(inSuite, sUnknownImplicitTag, sizeof(sUnknownImplicitTag));
+    CheckContiguousReaderMatches(inSuite, sTruncatedString, sizeof(sTruncatedString));
+    CheckContiguousReaderMatches(inSuite, sTruncatedHead, sizeof(sTruncatedHead));
+    CheckContiguousReaderMatches(inSuite, sMissingEndOfContainer, sizeof(sMissingEndOfContainer));
+    CheckContiguousReaderMatches(inSuite, sTaggedEndOfContainer, sizeof(sTaggedEndOfContainer));
+    CheckContiguousReaderMatches(inSuite, sInvalidType, sizeof(sInvalidType));
+
+    // Skipping a malformed container fails the way exiting it does.
+    TLVReader reader;
+    reader.Init(sAnonymousMemberInStruct, sizeof(sAnonymousMemberInStruct));
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Skip() == CHIP_ERROR_INVALID_TLV_TAG);
+
+    reader.Init(sUnknownImplicitTag, sizeof(sUnknownImplicitTag));
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Skip() == CHIP_ERROR_UNKNOWN_IMPLICIT_TLV_TAG);
+
+    reader.Init(sTruncatedString, sizeof(sTruncatedString));
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Skip() == CHIP_ERROR_TLV_UNDERRUN);
+
+    reader.Init(sMissingEndOfContainer, sizeof(sMissingEndOfContainer));
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Skip() == CHIP_END_OF_TLV);
+}
+
+/**
+ *  Write a report like those of the interaction model: attribute data elements with a path, a version and a value.
+ */
+static uint32_t WriteReport(nlTestSuite * inSuite, uint8_t * buf, uint32_t bufLen, uint16_t attributeCount)
+{
+    TLVWriter writer;
+    TLVType report, list, element, path;
+
+    writer.Init(buf, bufLen);
+
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, report) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(ContextTag(1), kTLVType_Array, list) == CHIP_NO_ERROR);
+    for (uint16_t i = 0; i < attributeCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, element) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, writer.StartContainer(ContextTag(0), kTLVType_List, path) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(1), static_cast<uint16_t>(1)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(2), static_cast<uint32_t>(0x0008)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(3), static_cast<uint32_t>(i)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, writer.EndContainer(path) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(1), static_cast<uint64_t>(0x12345678 + i)) == CHIP_NO_ERROR);
+        if (i % 2)
+        {
+            NL_TEST_ASSERT(inSuite, writer.PutString(ContextTag(2), "attribute value") == CHIP_NO_ERROR);
+        }
+        else
+        {
+            NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(2), static_cast<int16_t>(-i)) == CHIP_NO_ERROR);
+        }
+        NL_TEST_ASSERT(inSuite, writer.EndContainer(element) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(list) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.PutBoolean(ContextTag(2), true) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(report) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    return writer.GetLengthWritten();
+}
+
+void CheckContiguousReport(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[2048];
+
+    const uint32_t len = WriteReport(inSuite, buf, sizeof(buf), 20);
+    CheckContiguousReaderMatches(inSuite, buf, len);
+}
+
 static CHIP_ERROR ReadFuzzedEncoding1(nlTestSuite * inSuite, TLVReader & reader)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -3721,6 +4258,8 @@ static void TLVReaderFuzzTest(nlTestSuite * inSuite, void * inContext)
             CHIP_ERROR readRes = ReadFuzzedEncoding1(inSuite, reader);
             NL_TEST_ASSERT(inSuite, readRes != CHIP_NO_ERROR);
 
+            CheckContiguousReaderMatches(inSuite, fuzzedData, sizeof(fuzzedData));
+
             if (readRes == CHIP_NO_ERROR)
             {
                 printf("Unexpected success of fuzz test: offset %u, original value 0x%02X, mutated value 0x%02X\n",
@@ -3751,6 +4290,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Simple Write Read Test",              CheckSimpleWriteRead),
     NL_TEST_DEF("Inet Buffer Test",                    CheckPacketBuffer),
     NL_TEST_DEF("Buffer Overflow Test",                CheckBufferOverflow),
+    NL_TEST_DEF("Growable Buffer Test",                CheckGrowablePacketBuffer),
+    NL_TEST_DEF("Growable Buffer Rollback Test",       CheckGrowablePacketBufferRollback),
+    NL_TEST_DEF("Growable Buffer Finalize Test",       CheckGrowablePacketBufferFinalize),
     NL_TEST_DEF("Pretty Print Test",                   CheckPrettyPrinter),
     NL_TEST_DEF("Data Macro Test",                     CheckDataMacro),
     NL_TEST_DEF("Strict Aliasing Test",                CheckStrictAliasing),
@@ -3768,6 +4310,8 @@ static const nlTest sTests[] =
     NL_TEST_DEF("CHIP TLV Printf, Circular TLV buf",   CheckCHIPTLVPutStringFCircular),
     NL_TEST_DEF("CHIP TLV Skip non-contiguous",        CheckCHIPTLVSkipCircular),
     NL_TEST_DEF("CHIP TLV Check reserve",              CheckCloseContainerReserve),
+    NL_TEST_DEF("CHIP TLV Contiguous Reader",          CheckContiguousReader),
+    NL_TEST_DEF("CHIP TLV Contiguous Report",          CheckContiguousReport),
     NL_TEST_DEF("CHIP TLV Reader Fuzz Test",           TLVReaderFuzzTest),
 
     NL_TEST_SENTINEL()
@@ -0,0 +1,377 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the TLV codecs compiled from a schema.
+ *
+ */
+
+#include <string.h>
+
+#include <core/CHIPTLV.h>
+#include <core/CHIPTLVSchema.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+// A command whose arguments are all integers, with its codec declared from the list of its arguments.
+struct TestCommand
+{
+    uint8_t level;
+    uint16_t transitionTime;
+    int32_t delta;
+    bool enable;
+    uint64_t nodeId;
+
+    CHIP_ERROR Encode(TLVWriter & writer) const
+    {
+        return Schema::EncodeFields(writer, std::tie(level, transitionTime, delta, enable, nodeId));
+    }
+    CHIP_ERROR Decode(TLVReader & reader)
+    {
+        return Schema::DecodeFields(reader, std::tie(level, transitionTime, delta, enable, nodeId));
+    }
+};
+
+const TestCommand sCommand = { 5, 10, -2, true, 0x1122334455667788 };
+
+// clang-format off
+const uint8_t sCommandEncoding[] =
+{
+    0x15,
+    0x24, 0x00, 0x05,
+    0x25, 0x01, 0x0A, 0x00,
+    0x22, 0x02, 0xFE, 0xFF, 0xFF, 0xFF,
+    0x29, 0x03,
+    0x27, 0x04, 0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11,
+    0x18,
+};
+// clang-format on
+
+bool operator==(const TestCommand & a, const TestCommand & b)
+{
+    return a.level == b.level && a.transitionTime == b.transitionTime && a.delta == b.delta && a.enable == b.enable &&
+        a.nodeId == b.nodeId;
+}
+
+// The field by field encoding of a command, as done by the generated cluster code today.
+CHIP_ERROR EncodeGeneric(TLVWriter & writer, const TestCommand & command)
+{
+    uint8_t argSeqNumber = 0;
+
+    ReturnErrorOnFailure(writer.Put(ContextTag(argSeqNumber++), command.level));
+    ReturnErrorOnFailure(writer.Put(ContextTag(argSeqNumber++), command.transitionTime));
+    ReturnErrorOnFailure(writer.Put(ContextTag(argSeqNumber++), command.delta));
+    ReturnErrorOnFailure(writer.PutBoolean(ContextTag(argSeqNumber++), command.enable));
+    return writer.Put(ContextTag(argSeqNumber++), command.nodeId);
+}
+
+// The decoding of a command with a runtime tag switch, as done by the generated IM command handlers today.
+CHIP_ERROR DecodeGeneric(TLVReader & reader, TestCommand & command)
+{
+    CHIP_ERROR err;
+    bool argExists[5]           = { false };
+    uint32_t validArgumentCount = 0;
+
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (!IsContextTag(reader.GetTag()))
+        {
+            continue;
+        }
+        const uint32_t tagNum = TagNumFromTag(reader.GetTag());
+        if (tagNum < ArraySize(argExists))
+        {
+            VerifyOrReturnError(!argExists[tagNum], CHIP_ERROR_INVALID_TLV_ELEMENT);
+            argExists[tagNum] = true;
+            validArgumentCount++;
+        }
+        switch (tagNum)
+        {
+        case 0:
+            err = reader.Get(command.level);
+            break;
+        case 1:
+            err = reader.Get(command.transitionTime);
+            break;
+        case 2:
+            err = reader.Get(command.delta);
+            break;
+        case 3:
+            err = reader.Get(command.enable);
+            break;
+        case 4:
+            err = reader.Get(command.nodeId);
+            break;
+        default:
+            break;
+        }
+        ReturnErrorOnFailure(err);
+    }
+
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    VerifyOrReturnError(validArgumentCount == ArraySize(argExists), CHIP_ERROR_TLV_TAG_NOT_FOUND);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DecodeCommand(const uint8_t * buf, uint32_t len, TestCommand & command)
+{
+    TLVReader reader;
+    TLVType outerContainerType;
+
+    reader.Init(buf, len);
+    ReturnErrorOnFailure(reader.Next(kTLVType_Structure, AnonymousTag));
+    ReturnErrorOnFailure(reader.EnterContainer(outerContainerType));
+    ReturnErrorOnFailure(command.Decode(reader));
+    return reader.ExitContainer(outerContainerType);
+}
+
+void CheckEncode(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVReader reader;
+    TLVType outerContainerType;
+    TestCommand command;
+
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sCommand.Encode(writer) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    // Each member takes the size of its type, with precomputed control bytes and tags.
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == sizeof(sCommandEncoding));
+    NL_TEST_ASSERT(inSuite, memcmp(buf, sCommandEncoding, sizeof(sCommandEncoding)) == 0);
+
+    // The encoding decodes with the generic reader.
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.EnterContainer(outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, DecodeGeneric(reader, command) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, command == sCommand);
+
+    // The encoding does not fit.
+    writer.Init(buf, sizeof(sCommandEncoding) - 2);
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sCommand.Encode(writer) == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+void CheckDecode(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVType outerContainerType;
+    TestCommand command;
+
+    // Members in order, fixed size.
+    NL_TEST_ASSERT(inSuite, DecodeCommand(sCommandEncoding, sizeof(sCommandEncoding), command) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, command == sCommand);
+
+    // Members in order, with the smallest encodings the generic writer picks.
+    command = TestCommand();
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, EncodeGeneric(writer, sCommand) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, DecodeCommand(buf, writer.GetLengthWritten(), command) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, command == sCommand);
+
+    // Members out of order, and elements to ignore: the generic path decodes them.
+    command = TestCommand();
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(4), sCommand.nodeId) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ProfileTag(0x235A0000, 1), static_cast<uint8_t>(7)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(0), sCommand.level) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(1), sCommand.transitionTime) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.PutString(ContextTag(9), "unknown") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.PutBoolean(ContextTag(3), sCommand.enable) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(2), sCommand.delta) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, DecodeCommand(buf, writer.GetLengthWritten(), command) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, command == sCommand);
+
+    // Members in order, followed by an unknown one.
+    command = TestCommand();
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, EncodeGeneric(writer, sCommand) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(5), static_cast<uint8_t>(1)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, DecodeCommand(buf, writer.GetLengthWritten(), command) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, command == sCommand);
+}
+
+void CheckDecodeErrors(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVType outerContainerType;
+    TestCommand command;
+
+    // A member is missing.
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(0), sCommand.level) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(1), sCommand.transitionTime) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, DecodeCommand(buf, writer.GetLengthWritten(), command) == CHIP_ERROR_TLV_TAG_NOT_FOUND);
+
+    // A member is missing, out of order.
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(1), sCommand.transitionTime) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(0), sCommand.level) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, DecodeCommand(buf, writer.GetLengthWritten(), command) == CHIP_ERROR_TLV_TAG_NOT_FOUND);
+
+    // A member is present twice.
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, EncodeGeneric(writer, sCommand) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(2), sCommand.delta) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, DecodeCommand(buf, writer.GetLengthWritten(), command) == CHIP_ERROR_INVALID_TLV_ELEMENT);
+
+    // A member has the wrong type.
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Put(ContextTag(0), sCommand.level) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.PutString(ContextTag(1), "ten") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.EndContainer(outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, DecodeCommand(buf, writer.GetLengthWritten(), command) == CHIP_ERROR_WRONG_TLV_TYPE);
+}
+
+void CheckStruct(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVReader reader;
+    TLVType outerContainerType;
+    uint16_t vendorId = 0xFFF1;
+    uint32_t timeout  = 30000;
+    int16_t offset    = -300;
+
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(inSuite, Schema::EncodeStruct(writer, AnonymousTag, std::tie(vendorId, timeout, offset)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    vendorId = 0;
+    timeout  = 0;
+    offset   = 0;
+
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, Schema::DecodeStruct(reader, std::tie(vendorId, timeout, offset)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, vendorId == 0xFFF1 && timeout == 30000 && offset == -300);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_END_OF_TLV);
+
+    reader.Init(buf, writer.GetLengthWritten());
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.EnterContainer(outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_NO_ERROR);
+
+    // The reader is not on a structure.
+    NL_TEST_ASSERT(inSuite, Schema::DecodeStruct(reader, std::tie(vendorId)) == CHIP_ERROR_WRONG_TLV_TYPE);
+}
+
+void CheckPreEncodedElements(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t buf[64];
+    TLVWriter writer;
+    TLVType outerContainerType;
+    TLVType innerContainerType;
+
+    // The elements are only written as the members of a structure.
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(inSuite, sCommand.Encode(writer) == CHIP_ERROR_WRONG_TLV_TYPE);
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Array, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sCommand.Encode(writer) == CHIP_ERROR_WRONG_TLV_TYPE);
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == 1);
+
+    // Not while a container is open.
+    writer.Init(buf, sizeof(buf));
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    TLVWriter containerWriter;
+    NL_TEST_ASSERT(inSuite, writer.OpenContainer(ContextTag(5), kTLVType_Structure, containerWriter) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sCommand.Encode(writer) == CHIP_ERROR_TLV_CONTAINER_OPEN);
+    NL_TEST_ASSERT(inSuite, sCommand.Encode(containerWriter) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.CloseContainer(containerWriter) == CHIP_NO_ERROR);
+
+    // Nothing is written past the maximum length, even when the data is longer than the space left.
+    writer.Init(buf, sizeof(sCommandEncoding) - 1);
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(AnonymousTag, kTLVType_Structure, outerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.StartContainer(ContextTag(5), kTLVType_Structure, innerContainerType) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.PutPreEncodedElements(buf, UINT32_MAX) == CHIP_ERROR_BUFFER_TOO_SMALL);
+    NL_TEST_ASSERT(inSuite, sCommand.Encode(writer) == CHIP_ERROR_BUFFER_TOO_SMALL);
+    NL_TEST_ASSERT(inSuite, writer.GetLengthWritten() == 3);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Schema Encode",        CheckEncode),
+    NL_TEST_DEF("Schema Decode",        CheckDecode),
+    NL_TEST_DEF("Schema Decode Errors", CheckDecodeErrors),
+    NL_TEST_DEF("Schema Struct",        CheckStruct),
+    NL_TEST_DEF("Schema Pre-Encoded",   CheckPreEncodedElements),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestCHIPTLVSchema(void)
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "chip-tlv-schema",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestCHIPTLVSchema)
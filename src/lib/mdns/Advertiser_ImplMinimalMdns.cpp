@@ -132,6 +132,9 @@ private:
     /// Usable as boot-time advertisement of available SRV records.
     void AdvertiseRecords();
 
+    /// Advertises the records again, once the server listens on the new interfaces
+    static void OnInterfacesChanged(void * context) { static_cast<AdvertiserMinMdns *>(context)->AdvertiseRecords(); }
+
     /// Determine if advertisement on the specified interface/address is ok given the
     /// interfaces on which the mDNS server is listening
     bool ShouldAdvertiseOn(const chip::Inet::InterfaceId id, const chip::Inet::IPAddress & addr);
@@ -198,6 +201,7 @@ CHIP_ERROR AdvertiserMinMdns::Start(chip::Inet::InetLayer * inetLayer, uint16_t
     mCommissionInstanceName2 = GetRandU32();
 
     ReturnErrorOnFailure(GlobalMinimalMdnsServer::Instance().StartServer(inetLayer, port));
+    GlobalMinimalMdnsServer::Instance().SetInterfacesChangedCallback(OnInterfacesChanged, this);
 
     ChipLogProgress(Discovery, "CHIP minimal mDNS started advertising.");
 
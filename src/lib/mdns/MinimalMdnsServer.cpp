@@ -16,6 +16,9 @@
  */
 #include "MinimalMdnsServer.h"
 
+#include <inet/InterfaceCache.h>
+#include <support/ErrorStr.h>
+
 namespace chip {
 namespace Mdns {
 namespace {
@@ -102,10 +105,53 @@ GlobalMinimalMdnsServer & GlobalMinimalMdnsServer::Instance()
 
 CHIP_ERROR GlobalMinimalMdnsServer::StartServer(chip::Inet::InetLayer * inetLayer, uint16_t port)
 {
+    mInetLayer = inetLayer;
+    mPort      = port;
+
+#if CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
+    if (!mIsWatchingInterfaces)
+    {
+        chip::Inet::InterfaceCache & interfaceCache = chip::Inet::InterfaceCache::Instance();
+        ReturnErrorOnFailure(interfaceCache.AddChangeCallback(OnInterfacesChanged, this));
+        mIsWatchingInterfaces = true;
+
+        // Without change notifications, the changes are only found when the interfaces are listed again.
+        CHIP_ERROR err = interfaceCache.WatchChanges(*inetLayer->SystemLayer());
+        if (err != CHIP_NO_ERROR && err != CHIP_ERROR_NOT_IMPLEMENTED)
+        {
+            ChipLogError(Discovery, "Failed to watch the network interfaces: %s", chip::ErrorStr(err));
+        }
+    }
+#endif // CHIP_SYSTEM_CONFIG_USE_BSD_IFADDRS
+
     GlobalMinimalMdnsServer::Server().Shutdown();
     AllInterfaces allInterfaces;
     return GlobalMinimalMdnsServer::Server().Listen(inetLayer, &allInterfaces, port);
 }
 
+void GlobalMinimalMdnsServer::OnInterfacesChanged(void * context, uint32_t generation)
+{
+    GlobalMinimalMdnsServer * self = static_cast<GlobalMinimalMdnsServer *>(context);
+
+    if (!self->mServer.IsListening())
+    {
+        return;
+    }
+
+    ChipLogProgress(Discovery, "Network interfaces changed, listening again on all interfaces");
+
+    CHIP_ERROR err = self->StartServer(self->mInetLayer, self->mPort);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Failed to listen on the network interfaces: %s", chip::ErrorStr(err));
+        return;
+    }
+
+    if (self->mInterfacesChangedCallback != nullptr)
+    {
+        self->mInterfacesChangedCallback(self->mInterfacesChangedContext);
+    }
+}
+
 } // namespace Mdns
 } // namespace chip
@@ -78,9 +78,19 @@ public:
     static GlobalMinimalMdnsServer & Instance();
     static ServerType & Server() { return Instance().mServer; }
 
-    /// Calls Server().Listen() on all available interfaces
+    /// Calls Server().Listen() on all available interfaces, and again each time
+    /// the interfaces change while the server is listening
     CHIP_ERROR StartServer(chip::Inet::InetLayer * inetLayer, uint16_t port);
 
+    /// Sets a function called after the server listened again on the interfaces
+    /// because they changed
+    using InterfacesChangedCallback = void (*)(void * context);
+    void SetInterfacesChangedCallback(InterfacesChangedCallback callback, void * context)
+    {
+        mInterfacesChangedCallback = callback;
+        mInterfacesChangedContext  = context;
+    }
+
     void SetQueryDelegate(MdnsPacketDelegate * delegate) { mQueryDelegate = delegate; }
     void SetResponseDelegate(MdnsPacketDelegate * delegate) { mResponseDelegate = delegate; }
 
@@ -102,9 +112,17 @@ public:
     }
 
 private:
+    static void OnInterfacesChanged(void * context, uint32_t generation);
+
     ServerType mServer;
     MdnsPacketDelegate * mQueryDelegate    = nullptr;
     MdnsPacketDelegate * mResponseDelegate = nullptr;
+
+    chip::Inet::InetLayer * mInetLayer                   = nullptr;
+    uint16_t mPort                                       = 0;
+    bool mIsWatchingInterfaces                           = false;
+    InterfacesChangedCallback mInterfacesChangedCallback = nullptr;
+    void * mInterfacesChangedContext                     = nullptr;
 };
 
 } // namespace Mdns
@@ -47,12 +47,14 @@ namespace Platform {
 
 #define VERIFY_INITIALIZED()
 #define VERIFY_POINTER(p)
+#define COUNT_ALLOCATION(p)
 
 #else
 
 #define VERIFY_INITIALIZED() VerifyInitialized(__func__)
 
 static std::atomic_int memoryInitialized{ 0 };
+static std::atomic<size_t> memoryAllocationCount{ 0 };
 
 static void VerifyInitialized(const char * func)
 {
@@ -72,6 +74,14 @@ static void VerifyInitialized(const char * func)
         }                                                                                                                          \
     while (0)
 
+#define COUNT_ALLOCATION(p)                                                                                                        \
+    do                                                                                                                             \
+        if ((p) != nullptr)                                                                                                        \
+        {                                                                                                                          \
+            memoryAllocationCount++;                                                                                               \
+        }                                                                                                                          \
+    while (0)
+
 #endif
 
 CHIP_ERROR MemoryAllocatorInit(void * buf, size_t bufSize)
@@ -103,20 +113,26 @@ void MemoryAllocatorShutdown()
 void * MemoryAlloc(size_t size)
 {
     VERIFY_INITIALIZED();
-    return malloc(size);
+    void * ptr = malloc(size);
+    COUNT_ALLOCATION(ptr);
+    return ptr;
 }
 
 void * MemoryCalloc(size_t num, size_t size)
 {
     VERIFY_INITIALIZED();
-    return calloc(num, size);
+    void * ptr = calloc(num, size);
+    COUNT_ALLOCATION(ptr);
+    return ptr;
 }
 
 void * MemoryRealloc(void * p, size_t size)
 {
     VERIFY_INITIALIZED();
     VERIFY_POINTER(p);
-    return realloc(p, size);
+    void * ptr = realloc(p, size);
+    COUNT_ALLOCATION(ptr);
+    return ptr;
 }
 
 void MemoryFree(void * p)
@@ -126,6 +142,15 @@ void MemoryFree(void * p)
     free(p);
 }
 
+size_t MemoryDebugAllocationCount()
+{
+#ifdef NDEBUG
+    return 0;
+#else
+    return memoryAllocationCount;
+#endif
+}
+
 bool MemoryInternalCheckPointer(const void * p, size_t min_size)
 {
 #if CHIP_CONFIG_MEMORY_DEBUG_DMALLOC
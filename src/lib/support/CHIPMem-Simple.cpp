@@ -126,5 +126,10 @@ void MemoryFree(void * p)
     PrivateHeapFree(p);
 }
 
+size_t MemoryDebugAllocationCount()
+{
+    return 0;
+}
+
 } // namespace Platform
 } // namespace chip
@@ -163,6 +163,14 @@ inline void Delete(T * p)
     MemoryFree(p);
 }
 
+/**
+ * In debug builds, get the number of memory blocks allocated with MemoryAlloc, MemoryCalloc, MemoryRealloc, or New
+ * since the start of the program, so that tests can verify that some code does not allocate memory.
+ *
+ * @return  The number of allocations, or 0 if the allocator does not count them.
+ */
+extern size_t MemoryDebugAllocationCount();
+
 // See MemoryDebugCheckPointer().
 extern bool MemoryInternalCheckPointer(const void * p, size_t min_size);
 
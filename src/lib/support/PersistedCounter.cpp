@@ -22,12 +22,16 @@
 #include <support/CodeUtils.h>
 #include <support/logging/CHIPLogging.h>
 
+#include <algorithm>
 #include <stdlib.h>
 #include <string.h>
 
 namespace chip {
 
-PersistedCounter::PersistedCounter() : mId(chip::Platform::PersistedStorage::kEmptyKey), mEpoch(0), mNextEpoch(0) {}
+PersistedCounter::PersistedCounter() :
+    mId(chip::Platform::PersistedStorage::kEmptyKey), mEpoch(0), mMinEpoch(0), mMaxEpoch(0), mNextEpoch(0), mReservedEpoch(0),
+    mFlushState(kFlushIdle), mFlusher(nullptr)
+{}
 
 PersistedCounter::~PersistedCounter() {}
 
@@ -37,8 +41,12 @@ PersistedCounter::Init(const chip::Platform::PersistedStorage::Key aId, uint32_t
     VerifyOrReturnError(aEpoch > 0, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
     // Store the ID.
-    mId    = aId;
-    mEpoch = aEpoch;
+    mId         = aId;
+    mEpoch      = aEpoch;
+    mMinEpoch   = aEpoch;
+    mMaxEpoch   = aEpoch;
+    mFlusher    = nullptr;
+    mFlushState = kFlushIdle;
 
     uint32_t startValue;
 
@@ -55,6 +63,20 @@ PersistedCounter::Init(const chip::Platform::PersistedStorage::Key aId, uint32_t
     return MonotonicallyIncreasingCounter::Init(startValue);
 }
 
+CHIP_ERROR
+PersistedCounter::Init(const chip::Platform::PersistedStorage::Key aId, uint32_t aEpoch, uint32_t aMaxEpoch,
+                       PersistedCounterFlusher * aFlusher)
+{
+    VerifyOrReturnError(aFlusher != nullptr && aMaxEpoch >= aEpoch, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The first epoch is still reserved synchronously, as values are vended right away.
+    ReturnErrorOnFailure(Init(aId, aEpoch));
+
+    mMaxEpoch = aMaxEpoch;
+    mFlusher  = aFlusher;
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR
 PersistedCounter::Advance()
 {
@@ -62,28 +84,94 @@ PersistedCounter::Advance()
 
     ReturnErrorOnFailure(MonotonicallyIncreasingCounter::Advance());
 
+    if (mFlusher != nullptr && mFlushState == kFlushIdle && GetValue() < mNextEpoch && mNextEpoch - GetValue() <= mEpoch / 2)
+    {
+        // Half of the epoch is used, let the flusher reserve the next one in the background.
+        RequestReservation();
+    }
+
     if (GetValue() >= mNextEpoch)
     {
         // Value advanced past the previously persisted "start point".
         // Ensure that a new starting point is persisted.
-        ReturnErrorOnFailure(PersistNextEpochStart(mNextEpoch + mEpoch));
+        ReturnErrorOnFailure(ReserveCurrentValue());
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR
+PersistedCounter::Flush()
+{
+    uint8_t state = kFlushRequested;
+
+    // Nothing to do if there is no reservation, or if another caller took it.
+    VerifyOrReturnError(mFlushState.compare_exchange_strong(state, kFlushWriting), CHIP_NO_ERROR);
+
+    CHIP_ERROR err = PersistNextEpochStart(mReservedEpoch);
+
+    // On failure, the reservation is requested again by the next Advance().
+    mFlushState = kFlushIdle;
+    return err;
+}
+
+void PersistedCounter::SetEpoch(uint32_t aEpoch)
+{
+    mEpoch = std::min(std::max(aEpoch, mMinEpoch), mMaxEpoch);
+}
+
+void PersistedCounter::RequestReservation()
+{
+    mReservedEpoch = mNextEpoch + mEpoch;
+    mFlushState    = kFlushRequested;
+
+    // If the flush cannot be scheduled, ReserveCurrentValue() writes the reservation
+    // once the current epoch is exhausted.
+    (void) mFlusher->ScheduleFlush(*this);
+}
 
-        // Advancing the epoch should have ensured that the current value
-        // is valid
-        VerifyOrReturnError(GetValue() < mNextEpoch, CHIP_ERROR_INTERNAL);
+CHIP_ERROR
+PersistedCounter::ReserveCurrentValue()
+{
+    if (mFlushState != kFlushIdle)
+    {
+        // The flusher did not keep up with the counter, reserve larger epochs from now on.
+        SetEpoch(mEpoch > UINT32_MAX / 2 ? UINT32_MAX : mEpoch * 2);
     }
+
+    while (GetValue() >= mNextEpoch)
+    {
+        uint8_t state = mFlushState;
+        if (state == kFlushWriting)
+        {
+            // The flusher is writing the reservation from another thread, no value may be vended until it is done.
+            mFlusher->WaitForFlush(*this);
+            continue;
+        }
+
+        if (state == kFlushIdle)
+        {
+            mReservedEpoch = mNextEpoch + mEpoch;
+            mFlushState    = kFlushRequested;
+        }
+
+        ReturnErrorOnFailure(Flush());
+    }
+
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR
 PersistedCounter::PersistNextEpochStart(uint32_t aStartValue)
 {
-    mNextEpoch = aStartValue;
 #if CHIP_CONFIG_PERSISTED_COUNTER_DEBUG_LOGGING
     ChipLogDetail(EventLogging, "PersistedCounter::WriteStartValue() aStartValue 0x%x", aStartValue);
 #endif
 
-    return chip::Platform::PersistedStorage::Write(mId, aStartValue);
+    ReturnErrorOnFailure(chip::Platform::PersistedStorage::Write(mId, aStartValue));
+
+    // Values below the start of the next epoch can only be vended once it is persisted.
+    mNextEpoch = aStartValue;
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR
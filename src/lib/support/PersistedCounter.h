@@ -30,8 +30,48 @@
 #include <platform/PersistedStorage.h>
 #include <support/CHIPCounter.h>
 
+#include <atomic>
+
 namespace chip {
 
+class PersistedCounter;
+
+/**
+ * @class PersistedCounterFlusher
+ *
+ * @brief
+ *   Interface of a service that writes the reservations of write-behind
+ *   PersistedCounter objects to persistent storage, away from the code path
+ *   that advances the counter.
+ */
+class PersistedCounterFlusher
+{
+public:
+    virtual ~PersistedCounterFlusher() {}
+
+    /**
+     *  @brief
+     *    Arrange for aCounter.Flush() to be called soon. Flush() may be called
+     *    from any task or thread, but not after the counter is destroyed.
+     *
+     *  @param[in] aCounter  The counter that has a pending reservation.
+     *
+     *  @return CHIP_NO_ERROR if the flush was scheduled. Otherwise the counter
+     *          writes the reservation itself once it needs it.
+     */
+    virtual CHIP_ERROR ScheduleFlush(PersistedCounter & aCounter) = 0;
+
+    /**
+     *  @brief
+     *    Wait for a call to aCounter.Flush() that is in progress on another
+     *    thread. The counter calls this when it needs the reservation that is
+     *    being written to vend its next value, again until the write is done.
+     *
+     *  @param[in] aCounter  The counter that is being flushed.
+     */
+    virtual void WaitForFlush(PersistedCounter & aCounter) = 0;
+};
+
 /**
  * @class PersistedCounter
  *
@@ -52,6 +92,15 @@ namespace chip {
  *   - Output: 200, 201, 202, ...., 299, 300, 301, 302 <reboot/reinit>
  *   - Output: 400, 401 ...
  *
+ * By default, the start of the next epoch is written to persistent storage
+ * from Advance(), when the current epoch is exhausted. A write-behind counter
+ * (see Init() with a PersistedCounterFlusher) instead reserves the next epoch
+ * once half of the current one is used, and lets the flusher write that
+ * reservation in the background. Values are never vended past the last
+ * reservation known to be written, so no value is reused after a crash;
+ * Advance() only writes synchronously if the flusher did not keep up, in
+ * which case the epoch is doubled.
+ *
  */
 class PersistedCounter : public MonotonicallyIncreasingCounter
 {
@@ -75,6 +124,21 @@ public:
      */
     CHIP_ERROR Init(chip::Platform::PersistedStorage::Key aId, uint32_t aEpoch);
 
+    /**
+     *  @brief
+     *    Initialize a write-behind PersistedCounter object.
+     *
+     *  @param[in] aId        The identifier of this PersistedCounter instance.
+     *  @param[in] aEpoch     The initial, and minimum, size of the reserved epochs.
+     *  @param[in] aMaxEpoch  The maximum size of the reserved epochs.
+     *  @param[in] aFlusher   The service that writes reservations to persistent storage.
+     *
+     *  @return CHIP_ERROR_INVALID_ARGUMENT if aFlusher is NULL or aMaxEpoch is
+     *          less than aEpoch, or any error returned by Init(aId, aEpoch).
+     */
+    CHIP_ERROR Init(chip::Platform::PersistedStorage::Key aId, uint32_t aEpoch, uint32_t aMaxEpoch,
+                    PersistedCounterFlusher * aFlusher);
+
     /**
      *  @brief
      *  Increment the counter and write to persisted storage if we've completed
@@ -84,7 +148,52 @@ public:
      */
     CHIP_ERROR Advance() override;
 
+    /**
+     *  @brief
+     *    Write the pending reservation, if any, to persistent storage. This is
+     *    called by the PersistedCounterFlusher, from any thread.
+     *
+     *  @return Any error returned by a write to persistent storage.
+     */
+    CHIP_ERROR Flush();
+
+    /**
+     *  @brief
+     *    Return the size of the next reserved epoch.
+     */
+    uint32_t GetEpoch() const { return mEpoch; }
+
+    /**
+     *  @brief
+     *    Set the size of the next reserved epochs, e.g. to adapt it to the rate
+     *    at which the counter advances. The value is clamped to the bounds given
+     *    to Init(). Must be called from the task that advances the counter.
+     */
+    void SetEpoch(uint32_t aEpoch);
+
 private:
+    enum FlushState : uint8_t
+    {
+        kFlushIdle,      // No reservation beyond mNextEpoch is pending
+        kFlushRequested, // mReservedEpoch is waiting to be written
+        kFlushWriting,   // mReservedEpoch is being written
+    };
+
+    /**
+     *  @brief
+     *    Request the reservation of the epoch that follows mNextEpoch.
+     */
+    void RequestReservation();
+
+    /**
+     *  @brief
+     *    Ensure that the current value is below the persisted start of the next
+     *    epoch, writing a reservation from the calling task if necessary.
+     *
+     *  @return Any error returned by a write to persistent storage.
+     */
+    CHIP_ERROR ReserveCurrentValue();
+
     /**
      *  @brief
      *    Write out the counter value to persistent storage.
@@ -107,7 +216,12 @@ private:
 
     chip::Platform::PersistedStorage::Key mId; // start value is stored here
     uint32_t mEpoch;                           // epoch modulus value
-    uint32_t mNextEpoch;                       // next epoch start
+    uint32_t mMinEpoch;                        // lower bound of mEpoch
+    uint32_t mMaxEpoch;                        // upper bound of mEpoch
+    std::atomic<uint32_t> mNextEpoch;          // next epoch start, as persisted
+    uint32_t mReservedEpoch;                   // next epoch start, as requested from the flusher
+    std::atomic<uint8_t> mFlushState;          // FlushState of mReservedEpoch
+    PersistedCounterFlusher * mFlusher;        // write-behind service, if any
 };
 
 } // namespace chip
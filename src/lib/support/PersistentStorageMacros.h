@@ -27,9 +27,10 @@
 
 namespace chip {
 
-constexpr const char kPairedDeviceListKeyPrefix[] = "ListPairedDevices";
-constexpr const char kPairedDeviceKeyPrefix[]     = "PairedDevice";
-constexpr const char kNextAvailableKeyID[]        = "StartKeyID";
+constexpr const char kPairedDeviceListKeyPrefix[]      = "ListPairedDevices";
+constexpr const char kPairedDeviceListDeltaKeyPrefix[] = "ListPairedDevicesDelta";
+constexpr const char kPairedDeviceKeyPrefix[]          = "PairedDevice";
+constexpr const char kNextAvailableKeyID[]             = "StartKeyID";
 
 // This macro generates a key for storage using a node ID and a key prefix, and performs the given action
 // on that key.
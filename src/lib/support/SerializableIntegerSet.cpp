@@ -20,6 +20,9 @@
 
 #include <core/CHIPEncoding.h>
 #include <lib/support/CodeUtils.h>
+#include <support/ScopedBuffer.h>
+
+#include <algorithm>
 
 namespace chip {
 
@@ -121,3 +124,240 @@ uint16_t SerializableU64SetBase::FirstAvailableForUniqueId(uint64_t value)
 }
 
 } // namespace chip
+
+namespace chip {
+
+CHIP_ERROR SortedSerializableU64SetBase::Deserialize(ByteSpan serialized)
+{
+    VerifyOrReturnError(serialized.size() % sizeof(uint64_t) == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(serialized.size() <= MaxSerializedSize(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint8_t * p = serialized.data();
+    mCount            = 0;
+    for (size_t i = 0; i < serialized.size() / sizeof(uint64_t); i++)
+    {
+        const uint64_t value = Encoding::LittleEndian::Read64(p);
+        if (value != mEmptyValue)
+        {
+            InsertSorted(value);
+        }
+    }
+
+    ClearDelta(Digest(serialized));
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SortedSerializableU64SetBase::DeserializeDelta(ByteSpan serialized)
+{
+    VerifyOrReturnError(serialized.size() >= kDeltaHeaderSize, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(serialized.size() <= mDeltaCapacity, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError((serialized.size() - kDeltaHeaderSize) % kDeltaRecordSize == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint8_t * p = serialized.data();
+    if (Encoding::LittleEndian::Read32(p) != mBaseDigest)
+    {
+        // The journal was produced against another base (e.g. the set was serialized in full
+        // afterwards), so its changes are already part of the deserialized values.
+        return CHIP_NO_ERROR;
+    }
+
+    for (size_t i = 0; i < (serialized.size() - kDeltaHeaderSize) / kDeltaRecordSize; i++)
+    {
+        const DeltaOp op     = static_cast<DeltaOp>(Encoding::Read8(p));
+        const uint64_t value = Encoding::LittleEndian::Read64(p);
+
+        VerifyOrReturnError(value != mEmptyValue, CHIP_ERROR_INVALID_ARGUMENT);
+        switch (op)
+        {
+        case DeltaOp::kInsert:
+            ReturnErrorOnFailure(Insert(value));
+            break;
+        case DeltaOp::kRemove:
+            Remove(value);
+            break;
+        default:
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool SortedSerializableU64SetBase::Find(uint64_t value, uint16_t & index) const
+{
+    uint16_t low  = 0;
+    uint16_t high = mCount;
+    while (low < high)
+    {
+        const uint16_t mid = static_cast<uint16_t>(low + (high - low) / 2);
+        if (mData[mid] < value)
+        {
+            low = static_cast<uint16_t>(mid + 1);
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    index = low;
+    return index < mCount && mData[index] == value;
+}
+
+bool SortedSerializableU64SetBase::InsertSorted(uint64_t value)
+{
+    uint16_t index;
+    VerifyOrReturnError(!Find(value, index), false);
+    VerifyOrReturnError(mCount < mCapacity, false);
+
+    memmove(&mData[index + 1], &mData[index], sizeof(uint64_t) * static_cast<size_t>(mCount - index));
+    mData[index] = value;
+    mCount++;
+    return true;
+}
+
+bool SortedSerializableU64SetBase::RemoveSorted(uint64_t value)
+{
+    uint16_t index;
+    VerifyOrReturnError(Find(value, index), false);
+
+    memmove(&mData[index], &mData[index + 1], sizeof(uint64_t) * static_cast<size_t>(mCount - index - 1));
+    mCount--;
+    return true;
+}
+
+CHIP_ERROR SortedSerializableU64SetBase::Insert(uint64_t value)
+{
+    VerifyOrReturnError(value != mEmptyValue, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(!Contains(value), CHIP_NO_ERROR);
+    VerifyOrReturnError(InsertSorted(value), CHIP_ERROR_NO_MEMORY);
+
+    RecordDelta(DeltaOp::kInsert, value);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SortedSerializableU64SetBase::Insert(const uint64_t * values, uint16_t count)
+{
+    VerifyOrReturnError(values != nullptr || count == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(count > 0, CHIP_NO_ERROR);
+
+    Platform::ScopedMemoryBuffer<uint64_t> batch;
+    VerifyOrReturnError(batch.Alloc(count), CHIP_ERROR_NO_MEMORY);
+
+    // Sort the batch and keep only the distinct values that are not stored yet, so that the batch
+    // is either inserted as a whole or not at all.
+    uint16_t added = 0;
+    memcpy(batch.Get(), values, sizeof(uint64_t) * count);
+    std::sort(batch.Get(), batch.Get() + count);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        const uint64_t value = batch[i];
+        VerifyOrReturnError(value != mEmptyValue, CHIP_ERROR_INVALID_ARGUMENT);
+        if ((added == 0 || batch[added - 1] != value) && !Contains(value))
+        {
+            batch[added++] = value;
+        }
+    }
+    VerifyOrReturnError(added <= mCapacity - mCount, CHIP_ERROR_NO_MEMORY);
+
+    // Merge both sorted runs from the back, so that each stored value is moved at most once.
+    uint16_t stored  = mCount;
+    uint16_t pending = added;
+    uint16_t out     = static_cast<uint16_t>(mCount + added);
+    while (pending > 0)
+    {
+        if (stored > 0 && mData[stored - 1] > batch[pending - 1])
+        {
+            mData[--out] = mData[--stored];
+        }
+        else
+        {
+            mData[--out] = batch[--pending];
+        }
+    }
+    mCount = static_cast<uint16_t>(mCount + added);
+
+    for (uint16_t i = 0; i < added; i++)
+    {
+        RecordDelta(DeltaOp::kInsert, batch[i]);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void SortedSerializableU64SetBase::Remove(uint64_t value)
+{
+    if (value != mEmptyValue && RemoveSorted(value))
+    {
+        RecordDelta(DeltaOp::kRemove, value);
+    }
+}
+
+void SortedSerializableU64SetBase::ClearDelta(uint32_t baseDigest)
+{
+    mBaseDigest    = baseDigest;
+    mDeltaOverflow = false;
+    mDeltaSize     = 0;
+
+    if (mDeltaCapacity < kDeltaHeaderSize)
+    {
+        mDeltaOverflow = true;
+        return;
+    }
+
+    uint8_t * p = mDelta;
+    Encoding::LittleEndian::Write32(p, baseDigest);
+    mDeltaSize = kDeltaHeaderSize;
+}
+
+void SortedSerializableU64SetBase::RecordDelta(DeltaOp op, uint64_t value)
+{
+    VerifyOrReturn(!mDeltaOverflow);
+
+    // Only the final state of each value matters, so a value that is already in the journal
+    // gets its record updated in place.
+    for (uint16_t offset = kDeltaHeaderSize; offset < mDeltaSize; offset = static_cast<uint16_t>(offset + kDeltaRecordSize))
+    {
+        const uint8_t * p = &mDelta[offset + sizeof(uint8_t)];
+        if (Encoding::LittleEndian::Read64(p) == value)
+        {
+            mDelta[offset] = static_cast<uint8_t>(op);
+            return;
+        }
+    }
+
+    if (mDeltaSize + kDeltaRecordSize > mDeltaCapacity)
+    {
+        mDeltaOverflow = true;
+        return;
+    }
+
+    uint8_t * p = &mDelta[mDeltaSize];
+    Encoding::Write8(p, static_cast<uint8_t>(op));
+    Encoding::LittleEndian::Write64(p, value);
+    mDeltaSize = static_cast<uint16_t>(mDeltaSize + kDeltaRecordSize);
+}
+
+uint32_t SortedSerializableU64SetBase::Digest(ByteSpan serialized)
+{
+    // 32-bit FNV-1a. It only needs to tell apart successive serializations of the set.
+    uint32_t digest = 2166136261u;
+    for (size_t i = 0; i < serialized.size(); i++)
+    {
+        digest = (digest ^ serialized.data()[i]) * 16777619u;
+    }
+    return digest;
+}
+
+void SortedSerializableU64SetBase::SwapByteOrderIfNeeded()
+{
+    if (nl::ByteOrder::GetCurrent() != nl::ByteOrder::LittleEndian)
+    {
+        for (uint16_t i = 0; i < mCount; i++)
+        {
+            mData[i] = Encoding::LittleEndian::HostSwap64(mData[i]);
+        }
+    }
+}
+
+} // namespace chip
@@ -159,4 +159,215 @@ private:
     uint64_t mBuffer[kCapacity];
 };
 
+/**
+ * @brief
+ *   A set of uint64_t values that is kept sorted, so that membership is checked with a binary search.
+ *
+ *   The full serialized form is the same little-endian array of values as the one produced by
+ *   SerializableU64SetBase, so a set persisted by either class can be deserialized by the other.
+ *
+ *   In addition, the set keeps a journal of the values inserted and removed since the last full
+ *   serialization. The journal can be serialized on its own (see SerializeDelta()), so that
+ *   persisting a single change doesn't require rewriting the entire set. The serialized journal
+ *   records a digest of the full serialization it applies to, and is ignored when applied on top
+ *   of any other base.
+ */
+class SortedSerializableU64SetBase
+{
+public:
+    SortedSerializableU64SetBase(uint64_t * data, uint16_t capacity, uint64_t emptyValue, uint8_t * delta, uint16_t deltaCapacity) :
+        mData(data), mCapacity(capacity), mEmptyValue(emptyValue), mCount(0), mDelta(delta), mDeltaCapacity(deltaCapacity),
+        mDeltaSize(0), mDeltaOverflow(false), mBaseDigest(0)
+    {
+        ClearDelta(Digest(ByteSpan()));
+    }
+
+    /**
+     * @brief
+     *   Serialize the set by calling a callback with a ByteSpan to serialize. The serialized values
+     *   are stored in ascending order, in little-endian byte order.
+     *
+     *   If the callback succeeds, the journal of changes is cleared, and subsequent calls to
+     *   SerializeDelta() produce changes relative to this serialization.
+     *
+     * @param[in] callback the serialization callback to call.
+     */
+    template <typename F>
+    CHIP_ERROR Serialize(F callback)
+    {
+        // Ensure that we are holding little-endian data while the serialization
+        // callback runs.
+        SwapByteOrderIfNeeded();
+
+        const ByteSpan serialized(reinterpret_cast<uint8_t *>(mData), SerializedSize());
+        const uint32_t digest = Digest(serialized);
+        CHIP_ERROR err        = callback(serialized);
+
+        SwapByteOrderIfNeeded();
+
+        if (err == CHIP_NO_ERROR)
+        {
+            ClearDelta(digest);
+        }
+        return err;
+    }
+
+    /**
+     * @brief
+     *   Deserialize a previously serialized byte buffer into the set. The buffer may have been
+     *   produced by SerializableU64SetBase, i.e. it may be unsorted and contain empty values.
+     *
+     * @param[in] serialized Serialized buffer
+     */
+    CHIP_ERROR Deserialize(ByteSpan serialized);
+
+    /**
+     * @brief
+     *   Serialize the journal of changes since the last full serialization (or deserialization)
+     *   by calling a callback with a ByteSpan to serialize.
+     *
+     * @param[in] callback the serialization callback to call.
+     * @return CHIP_ERROR_BUFFER_TOO_SMALL if the journal overflowed, in which case the set must be
+     *         serialized in full, or the error returned by the callback.
+     */
+    template <typename F>
+    CHIP_ERROR SerializeDelta(F callback)
+    {
+        VerifyOrReturnError(!mDeltaOverflow, CHIP_ERROR_BUFFER_TOO_SMALL);
+        return callback(ByteSpan(mDelta, mDeltaSize));
+    }
+
+    /**
+     * @brief
+     *   Apply a previously serialized journal of changes on top of the deserialized set. The
+     *   journal is ignored if it was not produced relative to the currently deserialized base.
+     *   The applied changes are kept in the journal, so that they are serialized again by the
+     *   next call to SerializeDelta().
+     *
+     * @param[in] serialized Serialized journal
+     */
+    CHIP_ERROR DeserializeDelta(ByteSpan serialized);
+
+    /**
+     * @brief
+     *   Return whether the journal of changes is full, and a full serialization is needed to
+     *   persist the set.
+     */
+    bool HasDeltaOverflowed() const { return mDeltaOverflow; }
+
+    /**
+     * @brief
+     *   Get the length of the byte data if the set is serialized.
+     */
+    size_t SerializedSize() const { return sizeof(uint64_t) * mCount; }
+
+    /**
+     * @brief
+     *   Get the maximum length of the byte data if the set were full and serialized.
+     */
+    size_t MaxSerializedSize() const { return sizeof(uint64_t) * mCapacity; }
+
+    /**
+     * @brief
+     *   Get the maximum length of a serialized journal of changes.
+     */
+    size_t MaxSerializedDeltaSize() const { return mDeltaCapacity; }
+
+    /**
+     * @brief
+     *   Get the number of values in the set.
+     */
+    uint16_t Size() const { return mCount; }
+
+    /**
+     * @brief
+     *   Check if the value is in the set.
+     *
+     * @param[in] value Value to find
+     * @return True, if it's present in the set.
+     */
+    bool Contains(uint64_t value) const
+    {
+        uint16_t index;
+        return Find(value, index);
+    }
+
+    /**
+     * @brief
+     *   Insert the value in the set. If the value is duplicate, it won't be inserted.
+     *
+     * @return CHIP_NO_ERROR in case of success, or the error code
+     */
+    CHIP_ERROR Insert(uint64_t value);
+
+    /**
+     * @brief
+     *   Insert a batch of values in the set, in a single pass over the stored values.
+     *   Duplicate values are ignored. Either all values are inserted, or none is.
+     *
+     * @return CHIP_NO_ERROR in case of success, or the error code
+     */
+    CHIP_ERROR Insert(const uint64_t * values, uint16_t count);
+
+    /**
+     * @brief
+     *   Delete the value from the set.
+     */
+    void Remove(uint64_t value);
+
+private:
+    enum class DeltaOp : uint8_t
+    {
+        kInsert = 1,
+        kRemove = 2,
+    };
+
+    static constexpr uint16_t kDeltaHeaderSize = sizeof(uint32_t);
+    static constexpr uint16_t kDeltaRecordSize = sizeof(uint8_t) + sizeof(uint64_t);
+
+    uint64_t * const mData;
+    const uint16_t mCapacity;
+    const uint64_t mEmptyValue;
+    uint16_t mCount;
+
+    uint8_t * const mDelta;
+    const uint16_t mDeltaCapacity;
+    uint16_t mDeltaSize;
+    bool mDeltaOverflow;
+    uint32_t mBaseDigest;
+
+    /**
+     * @brief
+     *   Find the index of the value, or the index at which it would be inserted.
+     *
+     * @return True, if the value was found.
+     */
+    bool Find(uint64_t value, uint16_t & index) const;
+
+    bool InsertSorted(uint64_t value);
+    bool RemoveSorted(uint64_t value);
+
+    void ClearDelta(uint32_t baseDigest);
+    void RecordDelta(DeltaOp op, uint64_t value);
+
+    static uint32_t Digest(ByteSpan serialized);
+
+    void SwapByteOrderIfNeeded();
+};
+
+template <uint16_t kCapacity, uint64_t kEmptyValue = 0, uint16_t kDeltaRecords = 16>
+class SortedSerializableU64Set : public SortedSerializableU64SetBase
+{
+public:
+    SortedSerializableU64Set() : SortedSerializableU64SetBase(mBuffer, kCapacity, kEmptyValue, mDeltaBuffer, sizeof(mDeltaBuffer))
+    {
+        nlSTATIC_ASSERT_PRINT(kCapacity < UINT16_MAX / sizeof(uint64_t),
+                              "Serializable u64 set capacity cannot be more than UINT16_MAX / sizeof(uint64_t)");
+    }
+
+private:
+    uint64_t mBuffer[kCapacity];
+    uint8_t mDeltaBuffer[sizeof(uint32_t) + kDeltaRecords * (sizeof(uint8_t) + sizeof(uint64_t))];
+};
+
 } // namespace chip
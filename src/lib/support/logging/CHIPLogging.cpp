@@ -24,6 +24,7 @@
  */
 
 #include "CHIPLogging.h"
+#include "DeferredLogging.h"
 
 #include <core/CHIPCore.h>
 #include <support/CodeUtils.h>
@@ -141,11 +142,33 @@ DLL_EXPORT void Log(uint8_t module, uint8_t category, const char * msg, ...)
 
 void LogV(uint8_t module, uint8_t category, const char * msg, va_list args)
 {
-    if (!IsCategoryEnabled(category))
+    if (!IsCategoryEnabled(category) || !IsModuleEnabled(module))
     {
         return;
     }
 
+#if CHIP_LOG_DEFERRED
+    if (Internal::DeferLog(module, category, msg, args))
+    {
+        return;
+    }
+#endif
+
+    Internal::OutputLogV(module, category, msg, args);
+}
+
+namespace Internal {
+
+void OutputLog(uint8_t module, uint8_t category, const char * msg, ...)
+{
+    va_list v;
+    va_start(v, msg);
+    OutputLogV(module, category, msg, v);
+    va_end(v);
+}
+
+void OutputLogV(uint8_t module, uint8_t category, const char * msg, va_list args)
+{
     char moduleName[chip::Logging::kMaxModuleNameLen + 1];
     GetModuleName(moduleName, sizeof(moduleName), module);
 
@@ -161,6 +184,8 @@ void LogV(uint8_t module, uint8_t category, const char * msg, va_list args)
     }
 }
 
+} // namespace Internal
+
 #if CHIP_LOG_FILTERING
 uint8_t gLogFilter = kLogCategory_Max;
 DLL_EXPORT bool IsCategoryEnabled(uint8_t category)
@@ -178,6 +203,23 @@ DLL_EXPORT void SetLogFilter(uint8_t category)
     gLogFilter = category;
 }
 
+static_assert(kLogModule_Max <= 64, "The modules filter has one bit per module");
+uint64_t gLogModuleFilter = UINT64_MAX;
+DLL_EXPORT bool IsModuleEnabled(uint8_t module)
+{
+    return (module >= 64) || ((gLogModuleFilter >> module) & 1);
+}
+
+DLL_EXPORT uint64_t GetLogModuleFilter()
+{
+    return gLogModuleFilter;
+}
+
+DLL_EXPORT void SetLogModuleFilter(uint64_t modules)
+{
+    gLogModuleFilter = modules;
+}
+
 #else  // CHIP_LOG_FILTERING
 
 DLL_EXPORT bool IsCategoryEnabled(uint8_t category)
@@ -195,6 +237,22 @@ DLL_EXPORT void SetLogFilter(uint8_t category)
 {
     (void) category;
 }
+
+DLL_EXPORT bool IsModuleEnabled(uint8_t module)
+{
+    (void) module;
+    return true;
+}
+
+DLL_EXPORT uint64_t GetLogModuleFilter()
+{
+    return UINT64_MAX;
+}
+
+DLL_EXPORT void SetLogModuleFilter(uint64_t modules)
+{
+    (void) modules;
+}
 #endif // CHIP_LOG_FILTERING
 
 #endif /* _CHIP_USE_LOGGING */
@@ -42,6 +42,7 @@
 
 #include <inttypes.h>
 #include <stdarg.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /**
@@ -91,6 +92,13 @@ void Log(uint8_t module, uint8_t category, const char * msg, ...) ENFORCE_FORMAT
 uint8_t GetLogFilter();
 void SetLogFilter(uint8_t category);
 
+/**
+ * The modules filter is a bitmap with one bit per LogModule: messages of the modules whose bit is cleared are not logged. All
+ * the modules are logged by default.
+ */
+uint64_t GetLogModuleFilter();
+void SetLogModuleFilter(uint64_t modules);
+
 #ifndef CHIP_ERROR_LOGGING
 #define CHIP_ERROR_LOGGING 1
 #endif
@@ -99,6 +107,74 @@ void SetLogFilter(uint8_t category);
 #define CHIP_LOG_FILTERING 1
 #endif
 
+/**
+ *  @def CHIP_LOG_DEFERRED
+ *
+ *  @brief
+ *    Enable the deferred logging mode, in which log messages are not formatted by the thread that logs them. The address of
+ *    the format string and the arguments of each message are copied into a lock-free ring buffer instead, and the messages are
+ *    formatted and output later by DrainDeferredLogs(), from any thread. The format strings are not copied, so in this mode
+ *    they must have a static lifetime, e.g. be string literals. String arguments are copied.
+ *
+ *    The mode must also be enabled at runtime with SetDeferredLogging().
+ */
+#ifndef CHIP_LOG_DEFERRED
+#define CHIP_LOG_DEFERRED 0
+#endif
+
+/**
+ *  @def CHIP_LOG_DEFERRED_BUFFER_SIZE
+ *
+ *  @brief
+ *    Number of messages the deferred logging ring buffer holds, a power of two. Messages logged while it is full are
+ *    dropped, and their number is logged when it is drained.
+ */
+#ifndef CHIP_LOG_DEFERRED_BUFFER_SIZE
+#define CHIP_LOG_DEFERRED_BUFFER_SIZE 256
+#endif
+
+/**
+ *  @def CHIP_LOG_DEFERRED_DRAIN_THREAD
+ *
+ *  @brief
+ *    Provide StartDeferredLogDrainThread(), which drains the deferred logs from a POSIX thread.
+ */
+#ifndef CHIP_LOG_DEFERRED_DRAIN_THREAD
+#define CHIP_LOG_DEFERRED_DRAIN_THREAD 0
+#endif
+
+#if CHIP_LOG_DEFERRED
+
+/**
+ * Enable or disable the deferred logging mode at runtime. Messages that are still deferred when it is disabled are output
+ * immediately.
+ *
+ * The platform logging adds its timestamp, if any, when the messages are output.
+ */
+void SetDeferredLogging(bool enabled);
+bool IsDeferredLoggingEnabled();
+
+/**
+ * Format and output up to maxCount of the deferred messages, in the order they were logged.
+ *
+ * @return The number of messages that were output.
+ */
+size_t DrainDeferredLogs(size_t maxCount = SIZE_MAX);
+
+#if CHIP_LOG_DEFERRED_DRAIN_THREAD
+/**
+ * Enable the deferred logging mode, and start a thread that drains the deferred messages every intervalMs milliseconds.
+ */
+bool StartDeferredLogDrainThread(uint32_t intervalMs);
+
+/**
+ * Stop the thread started by StartDeferredLogDrainThread(), and disable the deferred logging mode.
+ */
+void StopDeferredLogDrainThread();
+#endif // CHIP_LOG_DEFERRED_DRAIN_THREAD
+
+#endif // CHIP_LOG_DEFERRED
+
 #if CHIP_ERROR_LOGGING
 /**
  * @def ChipLogError(MOD, MSG, ...)
@@ -194,6 +270,7 @@ static inline void GetModuleName(char * buf, uint8_t bufSize, uint8_t module)
 #endif // _CHIP_USE_LOGGING
 
 bool IsCategoryEnabled(uint8_t category);
+bool IsModuleEnabled(uint8_t module);
 
 /**
  *  @def ChipLogIfFalse(aCondition)
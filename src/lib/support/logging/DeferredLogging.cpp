@@ -0,0 +1,698 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Implementation of the deferred logging mode.
+ *
+ *      Log messages are copied into a bounded lock-free ring buffer of fixed size records: the address of the format string,
+ *      which is a literal that stays valid, and the raw values of the arguments, found by parsing the format string. Strings
+ *      are copied, as they may not outlive the call. The ring buffer is a multi-producer multi-consumer queue in which each
+ *      record has a sequence number telling whether it is free or written, so that producers only contend on the enqueue
+ *      position and never wait for a lock.
+ */
+
+#include "DeferredLogging.h"
+
+#if _CHIP_USE_LOGGING && CHIP_LOG_DEFERRED
+
+#include <support/CodeUtils.h>
+
+#include <atomic>
+#include <limits.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#if CHIP_LOG_DEFERRED_DRAIN_THREAD
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+namespace chip {
+namespace Logging {
+
+namespace {
+
+static_assert((CHIP_LOG_DEFERRED_BUFFER_SIZE & (CHIP_LOG_DEFERRED_BUFFER_SIZE - 1)) == 0,
+              "CHIP_LOG_DEFERRED_BUFFER_SIZE must be a power of two");
+
+// Space for the arguments of a message. Each integer, floating point or pointer argument takes 8 bytes or less, and each
+// string argument its length plus one. Strings that do not fit are truncated, other arguments that do not fit are output as
+// "...".
+constexpr size_t kMaxArgsSize = 104;
+
+// Maximum length of a message once formatted.
+constexpr size_t kMaxMessageLength = 256;
+
+struct Record
+{
+    std::atomic<size_t> sequence;
+    const char * format;
+    uint8_t module;
+    uint8_t category;
+    uint8_t argsSize;
+    uint8_t args[kMaxArgsSize];
+};
+
+Record sRecords[CHIP_LOG_DEFERRED_BUFFER_SIZE];
+std::atomic<size_t> sEnqueuePosition{ 0 };
+std::atomic<size_t> sDequeuePosition{ 0 };
+std::atomic<uint32_t> sDroppedCount{ 0 };
+std::atomic<bool> sEnabled{ false };
+bool sRecordsInitialized = false;
+
+enum class ArgLength : uint8_t
+{
+    kDefault,
+    kChar,
+    kShort,
+    kLong,
+    kLongLong,
+    kIntMax,
+    kSize,
+    kPtrDiff,
+    kLongDouble,
+};
+
+// A conversion specification of a format string.
+struct Conversion
+{
+    const char * start; ///< The '%' that starts the specification
+    const char * end;   ///< The character after the conversion specifier
+    bool widthFromArg;
+    bool precisionFromArg;
+    int precision; ///< -1 if the precision is not specified in the format string
+    ArgLength length;
+    char specifier; ///< 0 if the specification is not supported
+};
+
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+bool IsIntegerSpecifier(char specifier)
+{
+    return strchr("diouxXc", specifier) != nullptr;
+}
+
+bool IsFloatSpecifier(char specifier)
+{
+    return strchr("fFeEgGaA", specifier) != nullptr;
+}
+
+/**
+ * Find the next conversion specification of a format string, and move the format string after it.
+ *
+ * @return false if there is no other conversion specification.
+ */
+bool NextConversion(const char *& format, Conversion & conversion)
+{
+    const char * p = strchr(format, '%');
+    VerifyOrReturnError(p != nullptr, false);
+
+    conversion           = Conversion();
+    conversion.start     = p++;
+    conversion.precision = -1;
+
+    while (*p != '\0' && strchr("-+ #0'", *p) != nullptr)
+    {
+        p++;
+    }
+
+    if (*p == '*')
+    {
+        conversion.widthFromArg = true;
+        p++;
+    }
+    while (IsDigit(*p))
+    {
+        p++;
+    }
+
+    if (*p == '.')
+    {
+        p++;
+        if (*p == '*')
+        {
+            conversion.precisionFromArg = true;
+            p++;
+        }
+        else
+        {
+            // A '.' alone is a precision of zero.
+            conversion.precision = 0;
+        }
+        while (IsDigit(*p))
+        {
+            if (conversion.precision < INT_MAX / 10)
+            {
+                conversion.precision = conversion.precision * 10 + (*p - '0');
+            }
+            p++;
+        }
+    }
+
+    switch (*p)
+    {
+    case 'h':
+        conversion.length = (p[1] == 'h') ? ArgLength::kChar : ArgLength::kShort;
+        p += (p[1] == 'h') ? 2 : 1;
+        break;
+    case 'l':
+        conversion.length = (p[1] == 'l') ? ArgLength::kLongLong : ArgLength::kLong;
+        p += (p[1] == 'l') ? 2 : 1;
+        break;
+    case 'q':
+        conversion.length = ArgLength::kLongLong;
+        p++;
+        break;
+    case 'j':
+        conversion.length = ArgLength::kIntMax;
+        p++;
+        break;
+    case 'z':
+        conversion.length = ArgLength::kSize;
+        p++;
+        break;
+    case 't':
+        conversion.length = ArgLength::kPtrDiff;
+        p++;
+        break;
+    case 'L':
+        conversion.length = ArgLength::kLongDouble;
+        p++;
+        break;
+    default:
+        break;
+    }
+
+    if (*p != '\0' && strchr("diouxXcfFeEgGaAspn%", *p) != nullptr)
+    {
+        conversion.specifier = *p++;
+    }
+
+    conversion.end = p;
+    format         = p;
+    return true;
+}
+
+template <typename T>
+bool PutArg(Record & record, T value)
+{
+    VerifyOrReturnError(record.argsSize + sizeof(T) <= kMaxArgsSize, false);
+    memcpy(&record.args[record.argsSize], &value, sizeof(T));
+    record.argsSize = static_cast<uint8_t>(record.argsSize + sizeof(T));
+    return true;
+}
+
+/**
+ * Copy a string argument into a record. With a precision, the string does not need to be null terminated, and at most
+ * precision characters are read from it.
+ *
+ * @param precision  The precision of the conversion, negative if there is none.
+ */
+bool PutString(Record & record, const char * str, int precision)
+{
+    VerifyOrReturnError(record.argsSize < kMaxArgsSize, false);
+
+    if (str == nullptr)
+    {
+        str = "(null)";
+    }
+
+    size_t maxLength = kMaxArgsSize - record.argsSize - 1;
+    if (precision >= 0 && static_cast<size_t>(precision) < maxLength)
+    {
+        maxLength = static_cast<size_t>(precision);
+    }
+
+    const size_t length          = strnlen(str, maxLength);
+    record.args[record.argsSize] = static_cast<uint8_t>(length);
+    memcpy(&record.args[record.argsSize + 1], str, length);
+    record.argsSize = static_cast<uint8_t>(record.argsSize + 1 + length);
+    return true;
+}
+
+/**
+ * Copy the arguments of a message into a record, stopping at the first one that does not fit.
+ */
+void PutArgs(Record & record, const char * format, va_list args)
+{
+    Conversion conversion;
+    bool fits = true;
+
+    record.argsSize = 0;
+
+    while (fits && NextConversion(format, conversion))
+    {
+        if (conversion.widthFromArg)
+        {
+            fits = PutArg<int>(record, va_arg(args, int));
+        }
+        if (conversion.precisionFromArg && fits)
+        {
+            conversion.precision = va_arg(args, int);
+            fits                 = PutArg<int>(record, conversion.precision);
+        }
+
+        const char specifier = conversion.specifier;
+        if (!fits || specifier == '%')
+        {
+            continue;
+        }
+
+        if (IsIntegerSpecifier(specifier))
+        {
+            int64_t value;
+            switch (conversion.length)
+            {
+            case ArgLength::kLong:
+                value = va_arg(args, long);
+                break;
+            case ArgLength::kLongLong:
+                value = va_arg(args, long long);
+                break;
+            case ArgLength::kIntMax:
+                value = va_arg(args, intmax_t);
+                break;
+            case ArgLength::kSize:
+                value = static_cast<int64_t>(va_arg(args, size_t));
+                break;
+            case ArgLength::kPtrDiff:
+                value = va_arg(args, ptrdiff_t);
+                break;
+            default:
+                value = va_arg(args, int);
+                break;
+            }
+            fits = PutArg<int64_t>(record, value);
+        }
+        else if (IsFloatSpecifier(specifier))
+        {
+            const double value = (conversion.length == ArgLength::kLongDouble) ? static_cast<double>(va_arg(args, long double))
+                                                                                : va_arg(args, double);
+            fits = PutArg<double>(record, value);
+        }
+        else if (specifier == 's')
+        {
+            fits = PutString(record, va_arg(args, const char *), conversion.precision);
+        }
+        else if (specifier == 'p')
+        {
+            fits = PutArg<const void *>(record, va_arg(args, const void *));
+        }
+        else if (specifier == 'n')
+        {
+            // Nothing is written back to the caller.
+            (void) va_arg(args, void *);
+        }
+        else
+        {
+            // The types of the remaining arguments are unknown.
+            break;
+        }
+    }
+}
+
+// Reads the arguments of a record in order.
+class ArgReader
+{
+public:
+    explicit ArgReader(const Record & record) : mRecord(record) {}
+
+    template <typename T>
+    bool Get(T & value)
+    {
+        VerifyOrReturnError(mOffset + sizeof(T) <= mRecord.argsSize, false);
+        memcpy(&value, &mRecord.args[mOffset], sizeof(T));
+        mOffset += sizeof(T);
+        return true;
+    }
+
+    bool GetString(char * str)
+    {
+        VerifyOrReturnError(mOffset < mRecord.argsSize, false);
+        const size_t length = mRecord.args[mOffset];
+        VerifyOrReturnError(mOffset + 1 + length <= mRecord.argsSize, false);
+        memcpy(str, &mRecord.args[mOffset + 1], length);
+        str[length] = '\0';
+        mOffset += 1 + length;
+        return true;
+    }
+
+private:
+    const Record & mRecord;
+    size_t mOffset = 0;
+};
+
+// Writes a formatted message, truncating it when it is too long.
+class MessageWriter
+{
+public:
+    MessageWriter(char * buffer, size_t size) : mBuffer(buffer), mSize(size) { mBuffer[0] = '\0'; }
+
+    void Append(const char * str, size_t length)
+    {
+        length = (length < mSize - mLength - 1) ? length : mSize - mLength - 1;
+        memcpy(&mBuffer[mLength], str, length);
+        mLength += length;
+        mBuffer[mLength] = '\0';
+    }
+
+    template <typename T>
+    void AppendFormatted(const char * spec, T value)
+    {
+        const int written = snprintf(&mBuffer[mLength], mSize - mLength, spec, value);
+        if (written > 0)
+        {
+            mLength += (static_cast<size_t>(written) < mSize - mLength) ? static_cast<size_t>(written) : mSize - mLength - 1;
+        }
+    }
+
+private:
+    char * mBuffer;
+    size_t mSize;
+    size_t mLength = 0;
+};
+
+/**
+ * Rewrite a conversion specification for a single argument: widths and precisions taken from the arguments are replaced by
+ * their values, and the length of long double arguments, which were converted to double, is removed.
+ */
+bool MakeSpec(const Conversion & conversion, ArgReader & reader, char * spec, size_t specSize)
+{
+    size_t length = 0;
+
+    for (const char * p = conversion.start; p < conversion.end && length + 12 < specSize; p++)
+    {
+        if (*p == '*')
+        {
+            int value;
+            VerifyOrReturnError(reader.Get(value), false);
+
+            if (p[-1] == '.' && value < 0)
+            {
+                // A negative precision is taken as if it was omitted.
+                length--;
+                continue;
+            }
+            length += static_cast<size_t>(snprintf(&spec[length], specSize - length, "%d", value));
+        }
+        else if (*p != 'L')
+        {
+            spec[length++] = *p;
+        }
+    }
+
+    spec[length] = '\0';
+    return true;
+}
+
+/**
+ * Format the argument of a conversion specification.
+ *
+ * @return false if the argument was not copied into the record.
+ */
+bool FormatArg(const Conversion & conversion, ArgReader & reader, MessageWriter & writer)
+{
+    char spec[32];
+    VerifyOrReturnError(MakeSpec(conversion, reader, spec, sizeof(spec)), false);
+
+    if (IsIntegerSpecifier(conversion.specifier))
+    {
+        int64_t value;
+        VerifyOrReturnError(reader.Get(value), false);
+        switch (conversion.length)
+        {
+        case ArgLength::kLong:
+            writer.AppendFormatted(spec, static_cast<long>(value));
+            break;
+        case ArgLength::kLongLong:
+            writer.AppendFormatted(spec, static_cast<long long>(value));
+            break;
+        case ArgLength::kIntMax:
+            writer.AppendFormatted(spec, static_cast<intmax_t>(value));
+            break;
+        case ArgLength::kSize:
+            writer.AppendFormatted(spec, static_cast<size_t>(value));
+            break;
+        case ArgLength::kPtrDiff:
+            writer.AppendFormatted(spec, static_cast<ptrdiff_t>(value));
+            break;
+        default:
+            writer.AppendFormatted(spec, static_cast<int>(value));
+            break;
+        }
+    }
+    else if (IsFloatSpecifier(conversion.specifier))
+    {
+        double value;
+        VerifyOrReturnError(reader.Get(value), false);
+        writer.AppendFormatted(spec, value);
+    }
+    else if (conversion.specifier == 's')
+    {
+        char str[kMaxArgsSize];
+        VerifyOrReturnError(reader.GetString(str), false);
+        writer.AppendFormatted(spec, str);
+    }
+    else if (conversion.specifier == 'p')
+    {
+        const void * value;
+        VerifyOrReturnError(reader.Get(value), false);
+        writer.AppendFormatted(spec, value);
+    }
+
+    return true;
+}
+
+void FormatRecord(const Record & record, char * message, size_t messageSize)
+{
+    MessageWriter writer(message, messageSize);
+    ArgReader reader(record);
+    const char * format  = record.format;
+    const char * literal = format;
+    Conversion conversion;
+
+    while (NextConversion(format, conversion))
+    {
+        writer.Append(literal, static_cast<size_t>(conversion.start - literal));
+        literal = conversion.end;
+
+        const char specifier = conversion.specifier;
+        if (specifier == 0)
+        {
+            literal = conversion.start;
+            break;
+        }
+        if (specifier == '%')
+        {
+            writer.Append("%", 1);
+            continue;
+        }
+
+        if (!FormatArg(conversion, reader, writer))
+        {
+            writer.Append("...", 3);
+            literal = nullptr;
+            break;
+        }
+    }
+
+    if (literal != nullptr)
+    {
+        writer.Append(literal, strlen(literal));
+    }
+}
+
+bool Dequeue(char * message, size_t messageSize, uint8_t & module, uint8_t & category)
+{
+    size_t position = sDequeuePosition.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        Record & record       = sRecords[position & (CHIP_LOG_DEFERRED_BUFFER_SIZE - 1)];
+        const size_t sequence = record.sequence.load(std::memory_order_acquire);
+        const intptr_t diff   = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+        if (diff == 0)
+        {
+            if (sDequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                FormatRecord(record, message, messageSize);
+                module   = record.module;
+                category = record.category;
+                record.sequence.store(position + CHIP_LOG_DEFERRED_BUFFER_SIZE, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = sDequeuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+#if CHIP_LOG_DEFERRED_DRAIN_THREAD
+pthread_t sDrainThread;
+std::atomic<bool> sDrainThreadRunning{ false };
+uint32_t sDrainIntervalMs = 0;
+
+void * DrainThreadMain(void *)
+{
+    while (sDrainThreadRunning.load())
+    {
+        DrainDeferredLogs();
+        usleep(sDrainIntervalMs * 1000);
+    }
+    return nullptr;
+}
+#endif // CHIP_LOG_DEFERRED_DRAIN_THREAD
+
+} // namespace
+
+namespace Internal {
+
+bool DeferLog(uint8_t module, uint8_t category, const char * msg, va_list args)
+{
+    VerifyOrReturnError(sEnabled.load(std::memory_order_acquire), false);
+
+    size_t position = sEnqueuePosition.load(std::memory_order_relaxed);
+    Record * record;
+
+    while (true)
+    {
+        record                = &sRecords[position & (CHIP_LOG_DEFERRED_BUFFER_SIZE - 1)];
+        const size_t sequence = record->sequence.load(std::memory_order_acquire);
+        const intptr_t diff   = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if (diff == 0)
+        {
+            if (sEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The ring buffer is full.
+            sDroppedCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        else
+        {
+            position = sEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->format   = msg;
+    record->module   = module;
+    record->category = category;
+    PutArgs(*record, msg, args);
+    record->sequence.store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+} // namespace Internal
+
+void SetDeferredLogging(bool enabled)
+{
+    if (enabled && !sRecordsInitialized)
+    {
+        for (size_t i = 0; i < CHIP_LOG_DEFERRED_BUFFER_SIZE; i++)
+        {
+            sRecords[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        sRecordsInitialized = true;
+    }
+
+    sEnabled.store(enabled, std::memory_order_release);
+
+    if (!enabled && sRecordsInitialized)
+    {
+        DrainDeferredLogs();
+    }
+}
+
+bool IsDeferredLoggingEnabled()
+{
+    return sEnabled.load(std::memory_order_acquire);
+}
+
+size_t DrainDeferredLogs(size_t maxCount)
+{
+    char message[kMaxMessageLength];
+    uint8_t module;
+    uint8_t category;
+    size_t count = 0;
+
+    VerifyOrReturnError(sRecordsInitialized, 0);
+
+    const uint32_t dropped = sDroppedCount.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0)
+    {
+        Internal::OutputLog(kLogModule_Support, kLogCategory_Error, "%" PRIu32 " deferred log messages were dropped", dropped);
+    }
+
+    while (count < maxCount && Dequeue(message, sizeof(message), module, category))
+    {
+        Internal::OutputLog(module, category, "%s", message);
+        count++;
+    }
+
+    return count;
+}
+
+#if CHIP_LOG_DEFERRED_DRAIN_THREAD
+bool StartDeferredLogDrainThread(uint32_t intervalMs)
+{
+    VerifyOrReturnError(!sDrainThreadRunning.load(), false);
+
+    SetDeferredLogging(true);
+    sDrainIntervalMs = intervalMs;
+    sDrainThreadRunning.store(true);
+
+    if (pthread_create(&sDrainThread, nullptr, DrainThreadMain, nullptr) != 0)
+    {
+        sDrainThreadRunning.store(false);
+        SetDeferredLogging(false);
+        return false;
+    }
+    return true;
+}
+
+void StopDeferredLogDrainThread()
+{
+    VerifyOrReturn(sDrainThreadRunning.load());
+
+    sDrainThreadRunning.store(false);
+    pthread_join(sDrainThread, nullptr);
+    SetDeferredLogging(false);
+}
+#endif // CHIP_LOG_DEFERRED_DRAIN_THREAD
+
+} // namespace Logging
+} // namespace chip
+
+#endif // _CHIP_USE_LOGGING && CHIP_LOG_DEFERRED
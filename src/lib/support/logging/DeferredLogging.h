@@ -0,0 +1,50 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Interfaces between the logging functions and the deferred logging mode. Not for use outside of the logging
+ *      implementation: see CHIPLogging.h for the public interface.
+ */
+
+#pragma once
+
+#include "CHIPLogging.h"
+
+namespace chip {
+namespace Logging {
+namespace Internal {
+
+/**
+ * Output a log message through the log redirect callback or the platform logging, whether the deferred logging mode is
+ * enabled or not.
+ */
+void OutputLog(uint8_t module, uint8_t category, const char * msg, ...) ENFORCE_FORMAT(3, 4);
+void OutputLogV(uint8_t module, uint8_t category, const char * msg, va_list args);
+
+#if CHIP_LOG_DEFERRED
+/**
+ * Copy a log message into the deferred logging ring buffer, if the deferred logging mode is enabled.
+ *
+ * @return false if the message must be output immediately, because the mode is disabled.
+ */
+bool DeferLog(uint8_t module, uint8_t category, const char * msg, va_list args);
+#endif
+
+} // namespace Internal
+} // namespace Logging
+} // namespace chip
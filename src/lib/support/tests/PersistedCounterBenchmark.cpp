@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of a PersistedCounter advanced the way the global
+ *      message counter is advanced for every sent message, with synchronous and with
+ *      write-behind persistence, over a storage whose writes take 2 ms.
+ *
+ */
+
+#include <support/CHIPMem.h>
+#include <support/PersistedCounter.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "PersistedCounterThreadFlusher.h"
+#include "TestPersistedStorageImplementation.h"
+
+namespace {
+
+constexpr const char * kCounterKey = "benchcounter";
+constexpr uint32_t kAdvanceCount   = 200000;
+
+struct SendRate
+{
+    uint32_t mAdvancesPerSecond;
+    uint32_t mMaxAdvanceUs;
+};
+
+SendRate MeasureSendRate(chip::PersistedCounter & counter, uint32_t count)
+{
+    using Clock = std::chrono::steady_clock;
+
+    SendRate rate = { 0, 0 };
+    auto start    = Clock::now();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto advanceStart = Clock::now();
+        counter.Advance();
+        auto advanceUs = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - advanceStart).count();
+        if (static_cast<uint64_t>(advanceUs) > rate.mMaxAdvanceUs)
+        {
+            rate.mMaxAdvanceUs = static_cast<uint32_t>(advanceUs);
+        }
+    }
+
+    auto elapsedUs          = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start).count();
+    rate.mAdvancesPerSecond = static_cast<uint32_t>(static_cast<uint64_t>(count) * 1000000 / static_cast<uint64_t>(elapsedUs + 1));
+    return rate;
+}
+
+} // namespace
+
+int main()
+{
+    SendRate syncRate, writeBehindRate;
+
+    if (chip::Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        return EXIT_FAILURE;
+    }
+
+    sPersistentStoreWriteDelayUs = 2000;
+
+    {
+        chip::PersistedCounter counter;
+        if (counter.Init(kCounterKey, 1000) != CHIP_NO_ERROR)
+        {
+            fprintf(stderr, "Failed to initialize the synchronous counter\n");
+            return EXIT_FAILURE;
+        }
+        syncRate = MeasureSendRate(counter, kAdvanceCount);
+    }
+
+    {
+        ThreadFlusher flusher;
+        chip::PersistedCounter counter;
+        if (counter.Init(kCounterKey, 1000, 65536, &flusher) != CHIP_NO_ERROR)
+        {
+            fprintf(stderr, "Failed to initialize the write-behind counter\n");
+            return EXIT_FAILURE;
+        }
+        writeBehindRate = MeasureSendRate(counter, kAdvanceCount);
+    }
+
+    printf("Synchronous:  %u advances/s, longest advance %u us\n", syncRate.mAdvancesPerSecond, syncRate.mMaxAdvanceUs);
+    printf("Write-behind: %u advances/s, longest advance %u us\n", writeBehindRate.mAdvancesPerSecond,
+           writeBehindRate.mMaxAdvanceUs);
+
+    chip::Platform::MemoryShutdown();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,86 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <support/PersistedCounter.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Flushes reservations from a separate thread, like the global message counter does on Linux.
+class ThreadFlusher : public chip::PersistedCounterFlusher
+{
+public:
+    ThreadFlusher() : mThread(&ThreadFlusher::Run, this) {}
+
+    ~ThreadFlusher() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mCondition.notify_all();
+        mThread.join();
+    }
+
+    CHIP_ERROR ScheduleFlush(chip::PersistedCounter & aCounter) override
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mCounter = &aCounter;
+        mCondition.notify_all();
+        return CHIP_NO_ERROR;
+    }
+
+    void WaitForFlush(chip::PersistedCounter & aCounter) override
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return !mFlushing; });
+    }
+
+private:
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true)
+        {
+            mCondition.wait(lock, [this] { return mCounter != nullptr || mStop; });
+            if (mStop)
+            {
+                break;
+            }
+
+            chip::PersistedCounter * counter = mCounter;
+            mCounter                         = nullptr;
+            mFlushing                        = true;
+            lock.unlock();
+            counter->Flush();
+            lock.lock();
+            mFlushing = false;
+            mCondition.notify_all();
+        }
+    }
+
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    chip::PersistedCounter * mCounter = nullptr;
+    bool mFlushing                    = false;
+    bool mStop                        = false;
+    std::thread mThread;
+};
@@ -0,0 +1,217 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests for the deferred logging mode and the modules log filter.
+ */
+
+#include <support/UnitTestRegistration.h>
+#include <support/logging/CHIPLogging.h>
+
+#include <nlunit-test.h>
+
+#include <stdio.h>
+#include <string.h>
+
+using namespace chip::Logging;
+
+namespace {
+
+#if _CHIP_USE_LOGGING
+
+constexpr size_t kMaxMessages = 8;
+
+char sMessages[kMaxMessages][256];
+size_t sMessageCount = 0;
+
+void CaptureLog(const char * module, uint8_t category, const char * msg, va_list args)
+{
+    if (sMessageCount < kMaxMessages)
+    {
+        vsnprintf(sMessages[sMessageCount], sizeof(sMessages[0]), msg, args);
+    }
+    sMessageCount++;
+}
+
+// Log a message, and also format it with vsnprintf into expected.
+void LogAndFormat(char * expected, size_t expectedSize, const char * msg, ...) ENFORCE_FORMAT(3, 4);
+void LogAndFormat(char * expected, size_t expectedSize, const char * msg, ...)
+{
+    va_list args;
+
+    va_start(args, msg);
+    LogV(kLogModule_Support, kLogCategory_Progress, msg, args);
+    va_end(args);
+
+    va_start(args, msg);
+    vsnprintf(expected, expectedSize, msg, args);
+    va_end(args);
+}
+
+#if CHIP_LOG_DEFERRED
+
+void TestDeferredFormatting(nlTestSuite * inSuite, void * inContext)
+{
+    char expected[6][256];
+    int written = 0;
+
+    SetLogRedirectCallback(CaptureLog);
+    SetDeferredLogging(true);
+    sMessageCount = 0;
+
+    LogAndFormat(expected[0], sizeof(expected[0]), "value %" PRIu32 " 0x%08" PRIX32 " %d%%", 4000000000u, 0xABCDu, -5);
+    LogAndFormat(expected[1], sizeof(expected[1]), "%s-%.3s-[%-6s] %c", "abc", "defgh", "ij", 'k');
+    LogAndFormat(expected[2], sizeof(expected[2]), "[%*d] [%-*.*f] %e", 6, 42, 10, 2, 3.14159, -1.5e-10);
+    LogAndFormat(expected[3], sizeof(expected[3]), "id " ChipLogFormatX64 " %zu %hhu %p", ChipLogValueX64(0x0123456789ABCDEFull),
+                 static_cast<size_t>(12345), static_cast<unsigned char>(200), &written);
+    LogAndFormat(expected[4], sizeof(expected[4]), "%lld %llx %ld", -1234567890123ll, 0xFEDCBA9876543210ull, -7l);
+    LogAndFormat(expected[5], sizeof(expected[5]), "no arguments");
+
+    // Nothing is output until the messages are drained
+    NL_TEST_ASSERT(inSuite, sMessageCount == 0);
+    NL_TEST_ASSERT(inSuite, DrainDeferredLogs(2) == 2);
+    NL_TEST_ASSERT(inSuite, sMessageCount == 2);
+    NL_TEST_ASSERT(inSuite, DrainDeferredLogs() == 4);
+    NL_TEST_ASSERT(inSuite, DrainDeferredLogs() == 0);
+    NL_TEST_ASSERT(inSuite, sMessageCount == 6);
+
+    for (size_t i = 0; i < 6; i++)
+    {
+        NL_TEST_ASSERT(inSuite, strcmp(sMessages[i], expected[i]) == 0);
+    }
+
+    // Strings are copied, so they may change before the messages are drained
+    char str[] = "before";
+    sMessageCount = 0;
+    ChipLogProgress(Support, "%s", str);
+    strcpy(str, "after");
+    NL_TEST_ASSERT(inSuite, DrainDeferredLogs() == 1);
+    NL_TEST_ASSERT(inSuite, strcmp(sMessages[0], "before") == 0);
+
+    // With a precision, strings do not need to be null terminated, and nothing is read past the precision: a copy of the
+    // bytes that follow the span would leave no room for the next argument.
+    struct
+    {
+        char span[4];
+        char following[200];
+    } unterminated;
+    memcpy(unterminated.span, "span", sizeof(unterminated.span));
+    memset(unterminated.following, 'x', sizeof(unterminated.following));
+    sMessageCount = 0;
+    ChipLogProgress(Support, "%.*s %d", static_cast<int>(sizeof(unterminated.span)), unterminated.span, 42);
+    ChipLogProgress(Support, "%.2s %d", unterminated.span, 43);
+    NL_TEST_ASSERT(inSuite, DrainDeferredLogs() == 2);
+    NL_TEST_ASSERT(inSuite, strcmp(sMessages[0], "span 42") == 0);
+    NL_TEST_ASSERT(inSuite, strcmp(sMessages[1], "sp 43") == 0);
+
+    // Messages are output immediately when the mode is disabled
+    SetDeferredLogging(false);
+    sMessageCount = 0;
+    ChipLogProgress(Support, "immediate %d", 1);
+    NL_TEST_ASSERT(inSuite, sMessageCount == 1 && strcmp(sMessages[0], "immediate 1") == 0);
+
+    SetLogRedirectCallback(nullptr);
+}
+
+void TestDeferredOverflow(nlTestSuite * inSuite, void * inContext)
+{
+    SetLogRedirectCallback(CaptureLog);
+    SetDeferredLogging(true);
+    sMessageCount = 0;
+
+    for (int i = 0; i < CHIP_LOG_DEFERRED_BUFFER_SIZE + 3; i++)
+    {
+        ChipLogProgress(Support, "message %d", i);
+    }
+    NL_TEST_ASSERT(inSuite, sMessageCount == 0);
+
+    // The messages that did not fit are counted, and the count is output first
+    NL_TEST_ASSERT(inSuite, DrainDeferredLogs() == CHIP_LOG_DEFERRED_BUFFER_SIZE);
+    NL_TEST_ASSERT(inSuite, sMessageCount == CHIP_LOG_DEFERRED_BUFFER_SIZE + 1);
+    NL_TEST_ASSERT(inSuite, strcmp(sMessages[0], "3 deferred log messages were dropped") == 0);
+    NL_TEST_ASSERT(inSuite, strcmp(sMessages[1], "message 0") == 0);
+
+    // Messages left in the buffer are output when the mode is disabled
+    sMessageCount = 0;
+    ChipLogProgress(Support, "left");
+    SetDeferredLogging(false);
+    NL_TEST_ASSERT(inSuite, sMessageCount == 1 && strcmp(sMessages[0], "left") == 0);
+
+    SetLogRedirectCallback(nullptr);
+}
+
+#endif // CHIP_LOG_DEFERRED
+
+#if CHIP_LOG_FILTERING
+void TestModuleFilter(nlTestSuite * inSuite, void * inContext)
+{
+    SetLogRedirectCallback(CaptureLog);
+    sMessageCount = 0;
+
+    SetLogModuleFilter(GetLogModuleFilter() & ~(1ull << kLogModule_Support));
+    NL_TEST_ASSERT(inSuite, !IsModuleEnabled(kLogModule_Support));
+    NL_TEST_ASSERT(inSuite, IsModuleEnabled(kLogModule_Inet));
+    ChipLogProgress(Support, "filtered");
+    NL_TEST_ASSERT(inSuite, sMessageCount == 0);
+
+    SetLogModuleFilter(UINT64_MAX);
+    ChipLogProgress(Support, "not filtered");
+    NL_TEST_ASSERT(inSuite, sMessageCount == 1);
+
+    SetLogRedirectCallback(nullptr);
+}
+#endif // CHIP_LOG_FILTERING
+
+#endif // _CHIP_USE_LOGGING
+
+// clang-format off
+const nlTest sTests[] =
+{
+#if _CHIP_USE_LOGGING
+#if CHIP_LOG_DEFERRED
+    NL_TEST_DEF("TestDeferredFormatting", TestDeferredFormatting),
+    NL_TEST_DEF("TestDeferredOverflow", TestDeferredOverflow),
+#endif
+#if CHIP_LOG_FILTERING
+    NL_TEST_DEF("TestModuleFilter", TestModuleFilter),
+#endif
+#endif
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestDeferredLogging()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Test-CHIP-DeferredLogging",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDeferredLogging)
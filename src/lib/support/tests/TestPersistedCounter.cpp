@@ -27,9 +27,12 @@
 #define __STDC_FORMAT_MACROS
 #endif
 
+#include <atomic>
+#include <chrono>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <thread>
 #include <unistd.h>
 
 #include <nlunit-test.h>
@@ -40,6 +43,7 @@
 #include <support/PersistedCounter.h>
 #include <support/UnitTestRegistration.h>
 
+#include "PersistedCounterThreadFlusher.h"
 #include "TestPersistedStorageImplementation.h"
 
 struct TestPersistedCounterContext
@@ -50,6 +54,31 @@ struct TestPersistedCounterContext
 
 TestPersistedCounterContext::TestPersistedCounterContext() : mVerbose(false) {}
 
+// Flushes the pending reservation only when asked to, so that tests control the timing of writes.
+class ManualFlusher : public chip::PersistedCounterFlusher
+{
+public:
+    CHIP_ERROR ScheduleFlush(chip::PersistedCounter & aCounter) override
+    {
+        mCounter = &aCounter;
+        mScheduled++;
+        return CHIP_NO_ERROR;
+    }
+
+    // FlushNow() may be called from another thread while the counter waits for it.
+    void WaitForFlush(chip::PersistedCounter & aCounter) override
+    {
+        mWaits++;
+        std::this_thread::yield();
+    }
+
+    CHIP_ERROR FlushNow() { return mCounter != nullptr ? mCounter->Flush() : CHIP_NO_ERROR; }
+
+    chip::PersistedCounter * mCounter = nullptr;
+    uint32_t mScheduled               = 0;
+    std::atomic<uint32_t> mWaits{ 0 };
+};
+
 static void InitializePersistedStorage(TestPersistedCounterContext * context)
 {
     sPersistentStore.clear();
@@ -165,6 +194,158 @@ static void CheckWriteNextCounterStart(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, value == 0x20000);
 }
 
+static void CheckWriteBehind(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistedCounterContext * context = static_cast<TestPersistedCounterContext *>(inContext);
+    CHIP_ERROR err                        = CHIP_NO_ERROR;
+    chip::PersistedCounter counter;
+    ManualFlusher flusher;
+    const char * testKey = "testcounter";
+    uint32_t stored      = 0;
+
+    InitializePersistedStorage(context);
+
+    NL_TEST_ASSERT(inSuite, counter.Init(testKey, 100, 100, nullptr) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, counter.Init(testKey, 100, 50, &flusher) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The first epoch is reserved synchronously.
+    err = counter.Init(testKey, 100, 400, &flusher);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, chip::Platform::PersistedStorage::Read(testKey, stored) == CHIP_NO_ERROR && stored == 100);
+
+    // Nothing is written until half of the epoch is used, and then only when the flusher runs.
+    for (uint32_t i = 0; i < 49; i++)
+    {
+        NL_TEST_ASSERT(inSuite, counter.Advance() == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, flusher.mScheduled == 0);
+
+    NL_TEST_ASSERT(inSuite, counter.Advance() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, flusher.mScheduled == 1);
+    NL_TEST_ASSERT(inSuite, chip::Platform::PersistedStorage::Read(testKey, stored) == CHIP_NO_ERROR && stored == 100);
+
+    NL_TEST_ASSERT(inSuite, flusher.FlushNow() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, chip::Platform::PersistedStorage::Read(testKey, stored) == CHIP_NO_ERROR && stored == 200);
+
+    // A second flush of the same reservation does nothing.
+    NL_TEST_ASSERT(inSuite, flusher.FlushNow() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, chip::Platform::PersistedStorage::Read(testKey, stored) == CHIP_NO_ERROR && stored == 200);
+
+    // Crossing into the reserved epoch does not write anything.
+    for (uint32_t i = 0; i < 50; i++)
+    {
+        NL_TEST_ASSERT(inSuite, counter.Advance() == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, counter.GetValue() == 100);
+    NL_TEST_ASSERT(inSuite, flusher.mScheduled == 1);
+    NL_TEST_ASSERT(inSuite, chip::Platform::PersistedStorage::Read(testKey, stored) == CHIP_NO_ERROR && stored == 200);
+}
+
+static void CheckWriteBehindNoReuse(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistedCounterContext * context = static_cast<TestPersistedCounterContext *>(inContext);
+    chip::PersistedCounter counter, counter2;
+    ManualFlusher flusher;
+    const char * testKey = "testcounter";
+    uint32_t stored      = 0;
+
+    InitializePersistedStorage(context);
+
+    NL_TEST_ASSERT(inSuite, counter.Init(testKey, 100, 400, &flusher) == CHIP_NO_ERROR);
+
+    // The flusher never runs: the counter reserves the next epoch itself before vending
+    // a value past the persisted one, and reserves larger epochs afterwards.
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        NL_TEST_ASSERT(inSuite, counter.Advance() == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, counter.GetValue() == 100);
+    NL_TEST_ASSERT(inSuite, chip::Platform::PersistedStorage::Read(testKey, stored) == CHIP_NO_ERROR && stored == 200);
+    NL_TEST_ASSERT(inSuite, counter.GetEpoch() == 200);
+
+    // The late flush finds nothing to write.
+    NL_TEST_ASSERT(inSuite, flusher.FlushNow() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, chip::Platform::PersistedStorage::Read(testKey, stored) == CHIP_NO_ERROR && stored == 200);
+
+    // A reservation is pending but not written when we "crash": the values vended
+    // so far are not reused.
+    for (uint32_t i = 0; i < 60; i++)
+    {
+        NL_TEST_ASSERT(inSuite, counter.Advance() == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, flusher.mScheduled == 2);
+
+    NL_TEST_ASSERT(inSuite, counter2.Init(testKey, 100, 400, &flusher) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter2.GetValue() > counter.GetValue());
+
+    // The epoch stays within its bounds.
+    counter2.SetEpoch(1);
+    NL_TEST_ASSERT(inSuite, counter2.GetEpoch() == 100);
+    counter2.SetEpoch(1000);
+    NL_TEST_ASSERT(inSuite, counter2.GetEpoch() == 400);
+}
+
+static void CheckWriteBehindWait(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistedCounterContext * context = static_cast<TestPersistedCounterContext *>(inContext);
+    chip::PersistedCounter counter;
+    ManualFlusher flusher;
+    const char * testKey = "testcounter";
+    uint32_t stored      = 0;
+
+    InitializePersistedStorage(context);
+
+    NL_TEST_ASSERT(inSuite, counter.Init(testKey, 100, 100, &flusher) == CHIP_NO_ERROR);
+    for (uint32_t i = 0; i < 50; i++)
+    {
+        NL_TEST_ASSERT(inSuite, counter.Advance() == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, flusher.mScheduled == 1);
+
+    // The flusher is still writing the reservation from another thread when the epoch is exhausted:
+    // the counter waits for the write rather than failing the advance.
+    sPersistentStoreWriteDelayUs = 500000;
+    std::thread flushThread([&flusher] { flusher.FlushNow(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    for (uint32_t i = 0; i < 50; i++)
+    {
+        NL_TEST_ASSERT(inSuite, counter.Advance() == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, counter.GetValue() == 100);
+    NL_TEST_ASSERT(inSuite, flusher.mWaits > 0);
+    NL_TEST_ASSERT(inSuite, chip::Platform::PersistedStorage::Read(testKey, stored) == CHIP_NO_ERROR && stored == 200);
+
+    flushThread.join();
+    sPersistentStoreWriteDelayUs = 0;
+}
+
+static void CheckWriteBehindThread(nlTestSuite * inSuite, void * inContext)
+{
+    TestPersistedCounterContext * context = static_cast<TestPersistedCounterContext *>(inContext);
+    chip::PersistedCounter counter, counter2;
+    const char * testKey = "testcounter";
+    uint32_t stored      = 0;
+
+    InitializePersistedStorage(context);
+
+    {
+        ThreadFlusher flusher;
+        NL_TEST_ASSERT(inSuite, counter.Init(testKey, 16, 1024, &flusher) == CHIP_NO_ERROR);
+        for (uint32_t i = 0; i < 100000; i++)
+        {
+            NL_TEST_ASSERT(inSuite, counter.Advance() == CHIP_NO_ERROR);
+        }
+    }
+
+    // Whatever the interleaving with the flusher, the persisted value is ahead of the counter.
+    NL_TEST_ASSERT(inSuite, chip::Platform::PersistedStorage::Read(testKey, stored) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, stored > counter.GetValue());
+
+    NL_TEST_ASSERT(inSuite, counter2.Init(testKey, 16) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, counter2.GetValue() > counter.GetValue());
+}
+
 // Test Suite
 
 /**
@@ -174,6 +355,10 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Out of box Test", CheckOOB),                                 //
     NL_TEST_DEF("Reboot Test", CheckReboot),                                  //
     NL_TEST_DEF("Write Next Counter Start Test", CheckWriteNextCounterStart), //
+    NL_TEST_DEF("Write-Behind Test", CheckWriteBehind),                       //
+    NL_TEST_DEF("Write-Behind No Reuse Test", CheckWriteBehindNoReuse),       //
+    NL_TEST_DEF("Write-Behind Wait Test", CheckWriteBehindWait),              //
+    NL_TEST_DEF("Write-Behind Thread Test", CheckWriteBehindThread),          //
     NL_TEST_SENTINEL()                                                        //
 };
 
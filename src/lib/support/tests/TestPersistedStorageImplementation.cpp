@@ -48,6 +48,8 @@ std::map<std::string, std::string> sPersistentStore;
 
 FILE * sPersistentStoreFile = nullptr;
 
+useconds_t sPersistentStoreWriteDelayUs = 0;
+
 namespace chip {
 namespace Platform {
 namespace PersistedStorage {
@@ -162,6 +164,11 @@ CHIP_ERROR Write(const char * aKey, uint32_t aValue)
     VerifyOrReturnError(aKey != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(strlen(aKey) <= CHIP_CONFIG_PERSISTED_STORAGE_MAX_KEY_LENGTH, CHIP_ERROR_INVALID_STRING_LENGTH);
 
+    if (sPersistentStoreWriteDelayUs != 0)
+    {
+        usleep(sPersistentStoreWriteDelayUs);
+    }
+
     if (sPersistentStoreFile)
     {
         err = SaveCounterValueToFile(aKey, aValue);
@@ -19,7 +19,11 @@
 
 #include <map>
 #include <string>
+#include <unistd.h>
 
 extern std::map<std::string, std::string> sPersistentStore;
 
 extern FILE * sPersistentStoreFile;
+
+// Time added to every write, to emulate storage that commits a whole file.
+extern useconds_t sPersistentStoreWriteDelayUs;
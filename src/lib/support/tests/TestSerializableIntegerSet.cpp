@@ -16,6 +16,7 @@
  *    limitations under the License.
  */
 
+#include <core/CHIPEncoding.h>
 #include <support/CHIPMem.h>
 #include <support/CHIPMemString.h>
 #include <support/SerializableIntegerSet.h>
@@ -23,6 +24,8 @@
 
 #include <nlunit-test.h>
 
+#include <string.h>
+
 namespace {
 
 void TestSerializableIntegerSet(nlTestSuite * inSuite, void * inContext)
@@ -145,6 +148,159 @@ void TestSerializableIntegerSetSerialize(nlTestSuite * inSuite, void * inContext
     }) == CHIP_NO_ERROR);
 }
 
+void TestSortedSerializableIntegerSet(nlTestSuite * inSuite, void * inContext)
+{
+    chip::SortedSerializableU64Set<8> set;
+    NL_TEST_ASSERT(inSuite, !set.Contains(123));
+    NL_TEST_ASSERT(inSuite, set.Insert(0) != CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, set.Insert(123) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.Insert(123) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.Contains(123));
+    NL_TEST_ASSERT(inSuite, set.Size() == 1);
+
+    set.Remove(123);
+    NL_TEST_ASSERT(inSuite, !set.Contains(123));
+    NL_TEST_ASSERT(inSuite, set.Size() == 0);
+
+    for (uint64_t i = 8; i >= 1; i--)
+    {
+        NL_TEST_ASSERT(inSuite, set.Insert(i) == CHIP_NO_ERROR);
+    }
+
+    NL_TEST_ASSERT(inSuite, set.Insert(9) != CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.SerializedSize() == set.MaxSerializedSize());
+
+    for (uint64_t i = 1; i <= 8; i++)
+    {
+        NL_TEST_ASSERT(inSuite, set.Contains(i));
+    }
+
+    NL_TEST_ASSERT(inSuite, set.Serialize([&](chip::ByteSpan serialized) -> CHIP_ERROR {
+        const uint8_t * p = serialized.data();
+        for (uint64_t i = 1; i <= 8; i++)
+        {
+            NL_TEST_ASSERT(inSuite, chip::Encoding::LittleEndian::Read64(p) == i);
+        }
+        return CHIP_NO_ERROR;
+    }) == CHIP_NO_ERROR);
+}
+
+void TestSortedSerializableIntegerSetBatchInsert(nlTestSuite * inSuite, void * inContext)
+{
+    chip::SortedSerializableU64Set<8> set;
+    NL_TEST_ASSERT(inSuite, set.Insert(4) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.Insert(10) == CHIP_NO_ERROR);
+
+    const uint64_t batch[] = { 7, 1, 10, 7, 12, 5 };
+    NL_TEST_ASSERT(inSuite, set.Insert(batch, 6) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.Size() == 6);
+
+    const uint64_t expected[] = { 1, 4, 5, 7, 10, 12 };
+    for (uint64_t value : expected)
+    {
+        NL_TEST_ASSERT(inSuite, set.Contains(value));
+    }
+
+    // The batch doesn't fit, so none of it is inserted.
+    const uint64_t tooLarge[] = { 2, 3, 6 };
+    NL_TEST_ASSERT(inSuite, set.Insert(tooLarge, 3) == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(inSuite, set.Size() == 6);
+    NL_TEST_ASSERT(inSuite, !set.Contains(2));
+
+    // Values already in the set don't count against the capacity.
+    const uint64_t withDuplicates[] = { 12, 2, 1, 3 };
+    NL_TEST_ASSERT(inSuite, set.Insert(withDuplicates, 4) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.Size() == 8);
+    NL_TEST_ASSERT(inSuite, set.Contains(2) && set.Contains(3));
+}
+
+void TestSortedSerializableIntegerSetLegacyFormat(nlTestSuite * inSuite, void * inContext)
+{
+    chip::SerializableU64Set<8> legacy;
+    NL_TEST_ASSERT(inSuite, legacy.Insert(30) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, legacy.Insert(10) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, legacy.Insert(20) == CHIP_NO_ERROR);
+    legacy.Remove(10);
+
+    NL_TEST_ASSERT(inSuite, legacy.Serialize([&](chip::ByteSpan serialized) -> CHIP_ERROR {
+        chip::SortedSerializableU64Set<8> set;
+        NL_TEST_ASSERT(inSuite, set.Deserialize(serialized) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, set.Size() == 2);
+        NL_TEST_ASSERT(inSuite, set.Contains(20) && set.Contains(30));
+        NL_TEST_ASSERT(inSuite, !set.Contains(10));
+
+        return set.Serialize([&](chip::ByteSpan sorted) -> CHIP_ERROR {
+            chip::SerializableU64Set<8> legacy2;
+            NL_TEST_ASSERT(inSuite, legacy2.Deserialize(sorted) == CHIP_NO_ERROR);
+            NL_TEST_ASSERT(inSuite, legacy2.Contains(20) && legacy2.Contains(30));
+            return CHIP_NO_ERROR;
+        });
+    }) == CHIP_NO_ERROR);
+}
+
+void TestSortedSerializableIntegerSetDelta(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t base[8 * sizeof(uint64_t)];
+    size_t baseSize = 0;
+    uint8_t delta[64];
+    size_t deltaSize = 0;
+
+    chip::SortedSerializableU64Set<8, 0, 4> set;
+    NL_TEST_ASSERT(inSuite, set.Insert(1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.Insert(2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.Serialize([&](chip::ByteSpan serialized) -> CHIP_ERROR {
+        memcpy(base, serialized.data(), serialized.size());
+        baseSize = serialized.size();
+        return CHIP_NO_ERROR;
+    }) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, set.Insert(3) == CHIP_NO_ERROR);
+    set.Remove(1);
+    set.Remove(3);
+    NL_TEST_ASSERT(inSuite, set.Insert(4) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, set.SerializeDelta([&](chip::ByteSpan serialized) -> CHIP_ERROR {
+        NL_TEST_ASSERT(inSuite, serialized.size() <= sizeof(delta));
+        memcpy(delta, serialized.data(), serialized.size());
+        deltaSize = serialized.size();
+        return CHIP_NO_ERROR;
+    }) == CHIP_NO_ERROR);
+
+    // Three distinct values were changed, each is recorded once.
+    NL_TEST_ASSERT(inSuite, deltaSize == sizeof(uint32_t) + 3 * (sizeof(uint8_t) + sizeof(uint64_t)));
+
+    chip::SortedSerializableU64Set<8, 0, 4> restored;
+    NL_TEST_ASSERT(inSuite, restored.Deserialize(chip::ByteSpan(base, baseSize)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, restored.DeserializeDelta(chip::ByteSpan(delta, deltaSize)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, restored.Size() == 2);
+    NL_TEST_ASSERT(inSuite, restored.Contains(2) && restored.Contains(4));
+    NL_TEST_ASSERT(inSuite, !restored.Contains(1) && !restored.Contains(3));
+
+    // Once the set is serialized in full, the previous journal no longer applies.
+    NL_TEST_ASSERT(inSuite, set.Serialize([&](chip::ByteSpan serialized) -> CHIP_ERROR {
+        memcpy(base, serialized.data(), serialized.size());
+        baseSize = serialized.size();
+        return CHIP_NO_ERROR;
+    }) == CHIP_NO_ERROR);
+
+    chip::SortedSerializableU64Set<8, 0, 4> compacted;
+    NL_TEST_ASSERT(inSuite, compacted.Deserialize(chip::ByteSpan(base, baseSize)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, compacted.DeserializeDelta(chip::ByteSpan(delta, deltaSize)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, compacted.Size() == 2);
+    NL_TEST_ASSERT(inSuite, compacted.Contains(2) && compacted.Contains(4));
+
+    // The journal overflows past its capacity, requiring a full serialization.
+    for (uint64_t i = 5; i <= 8; i++)
+    {
+        NL_TEST_ASSERT(inSuite, set.Insert(i) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, !set.HasDeltaOverflowed());
+    set.Remove(2);
+    NL_TEST_ASSERT(inSuite, set.HasDeltaOverflowed());
+    NL_TEST_ASSERT(inSuite,
+                   set.SerializeDelta([](chip::ByteSpan) -> CHIP_ERROR { return CHIP_NO_ERROR; }) == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
 int Setup(void * inContext)
 {
     CHIP_ERROR error = chip::Platform::MemoryInit();
@@ -166,10 +322,14 @@ int Teardown(void * inContext)
  *   Test Suite. It lists all the test functions.
  */
 static const nlTest sTests[] = {
-    NL_TEST_DEF_FN(TestSerializableIntegerSet),          //
-    NL_TEST_DEF_FN(TestSerializableIntegerSetNonZero),   //
-    NL_TEST_DEF_FN(TestSerializableIntegerSetSerialize), //
-    NL_TEST_SENTINEL()                                   //
+    NL_TEST_DEF_FN(TestSerializableIntegerSet),                   //
+    NL_TEST_DEF_FN(TestSerializableIntegerSetNonZero),            //
+    NL_TEST_DEF_FN(TestSerializableIntegerSetSerialize),          //
+    NL_TEST_DEF_FN(TestSortedSerializableIntegerSet),             //
+    NL_TEST_DEF_FN(TestSortedSerializableIntegerSetBatchInsert),  //
+    NL_TEST_DEF_FN(TestSortedSerializableIntegerSetLegacyFormat), //
+    NL_TEST_DEF_FN(TestSortedSerializableIntegerSetDelta),        //
+    NL_TEST_SENTINEL()                                            //
 };
 
 int TestSerializableIntegerSet(void)
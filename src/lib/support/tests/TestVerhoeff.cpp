@@ -0,0 +1,184 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <support/UnitTestRegistration.h>
+#include <support/verhoeff/Verhoeff.h>
+
+#include <nlunit-test.h>
+
+class VerhoeffTest
+{
+public:
+    // Check character of the string computed as originally specified, permuting the character at
+    // position i by applying the permutation table i times.
+    static char ReferenceCheckChar10(const char * str, size_t strLen)
+    {
+        int c = 0;
+
+        for (size_t i = 1; i <= strLen; i++)
+        {
+            int val = Verhoeff10::CharToVal(str[strLen - i]);
+            if (val < 0)
+                return 0;
+
+            int p = Verhoeff::Permute(val, Verhoeff10::sPermTable, Verhoeff10::Base, i);
+            c     = Verhoeff::DihedralMultiply(c, p, Verhoeff10::PolygonSize);
+        }
+
+        return Verhoeff10::ValToChar(Verhoeff::DihedralInvert(c, Verhoeff10::PolygonSize));
+    }
+
+    static bool PermPowerTableMatches()
+    {
+        for (int power = 0; power < 2 * Verhoeff10::PermOrder; power++)
+        {
+            for (int val = 0; val < Verhoeff10::Base; val++)
+            {
+                const int expected = Verhoeff::Permute(val, Verhoeff10::sPermTable, Verhoeff10::Base, static_cast<uint64_t>(power));
+                const int actual   = Verhoeff10::sPermPowerTable[(power % Verhoeff10::PermOrder) * Verhoeff10::Base + val];
+                if (expected != actual)
+                    return false;
+            }
+        }
+        return true;
+    }
+};
+
+namespace {
+
+constexpr size_t kStrLen   = 10;
+constexpr size_t kStride   = 16;
+constexpr size_t kMaxCount = 1000;
+
+char sStrings[kMaxCount * kStride];
+
+void FillRandomDigits(size_t count, size_t strLen)
+{
+    for (size_t i = 0; i < count * kStride; i++)
+    {
+        sStrings[i] = static_cast<char>('0' + rand() % 10);
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        sStrings[i * kStride + strLen] = '\0';
+    }
+}
+
+void TestVerhoeff10Known(nlTestSuite * inSuite, void * inContext)
+{
+    NL_TEST_ASSERT(inSuite, Verhoeff10::ComputeCheckChar("236") == '3');
+    NL_TEST_ASSERT(inSuite, Verhoeff10::ValidateCheckChar("2363"));
+    NL_TEST_ASSERT(inSuite, !Verhoeff10::ValidateCheckChar("2364"));
+    NL_TEST_ASSERT(inSuite, Verhoeff10::ComputeCheckChar("12A4") == 0);
+    NL_TEST_ASSERT(inSuite, !Verhoeff10::ValidateCheckChar(""));
+}
+
+void TestVerhoeff10PermPowerTable(nlTestSuite * inSuite, void * inContext)
+{
+    NL_TEST_ASSERT(inSuite, VerhoeffTest::PermPowerTableMatches());
+}
+
+void TestVerhoeff10MatchesReference(nlTestSuite * inSuite, void * inContext)
+{
+    char str[40];
+
+    for (size_t strLen = 0; strLen < sizeof(str); strLen++)
+    {
+        for (int round = 0; round < 100; round++)
+        {
+            for (size_t i = 0; i < strLen; i++)
+            {
+                str[i] = static_cast<char>('0' + rand() % 10);
+            }
+            NL_TEST_ASSERT(inSuite, Verhoeff10::ComputeCheckChar(str, strLen) == VerhoeffTest::ReferenceCheckChar10(str, strLen));
+        }
+    }
+}
+
+void TestVerhoeff10Batch(nlTestSuite * inSuite, void * inContext)
+{
+    static char checkChars[kMaxCount];
+    static bool results[kMaxCount];
+
+    // Counts that do and do not fill whole groups of strings.
+    const size_t counts[] = { 0, 1, 7, 8, 9, 63, kMaxCount };
+
+    for (size_t count : counts)
+    {
+        FillRandomDigits(count, kStrLen);
+
+        // Invalid characters in some of the strings.
+        for (size_t i = 3; i < count; i += 11)
+        {
+            sStrings[i * kStride + (i % kStrLen)] = 'x';
+        }
+
+        Verhoeff10::ComputeCheckChars(sStrings, kStrLen, kStride, count, checkChars);
+        for (size_t i = 0; i < count; i++)
+        {
+            NL_TEST_ASSERT(inSuite, checkChars[i] == Verhoeff10::ComputeCheckChar(&sStrings[i * kStride], kStrLen));
+        }
+
+        // Append the check characters, corrupting some, then validate.
+        size_t expectedValid = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            char checkChar = Verhoeff10::ComputeCheckChar(&sStrings[i * kStride], kStrLen);
+            if (i % 5 == 0 && checkChar != 0)
+            {
+                checkChar = static_cast<char>('0' + (checkChar - '0' + 1) % 10);
+            }
+            sStrings[i * kStride + kStrLen] = (checkChar != 0) ? checkChar : '0';
+        }
+        for (size_t i = 0; i < count; i++)
+        {
+            expectedValid += Verhoeff10::ValidateCheckChar(&sStrings[i * kStride], kStrLen + 1) ? 1 : 0;
+        }
+
+        NL_TEST_ASSERT(inSuite, Verhoeff10::ValidateCheckChars(sStrings, kStrLen + 1, kStride, count, results) == expectedValid);
+        NL_TEST_ASSERT(inSuite, Verhoeff10::ValidateCheckChars(sStrings, kStrLen + 1, kStride, count) == expectedValid);
+        for (size_t i = 0; i < count; i++)
+        {
+            NL_TEST_ASSERT(inSuite, results[i] == Verhoeff10::ValidateCheckChar(&sStrings[i * kStride], kStrLen + 1));
+        }
+    }
+
+    NL_TEST_ASSERT(inSuite, Verhoeff10::ValidateCheckChars(sStrings, 0, kStride, 8, results) == 0);
+    NL_TEST_ASSERT(inSuite, !results[0] && !results[7]);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("TestVerhoeff10Known", TestVerhoeff10Known),                       //
+    NL_TEST_DEF("TestVerhoeff10PermPowerTable", TestVerhoeff10PermPowerTable),     //
+    NL_TEST_DEF("TestVerhoeff10MatchesReference", TestVerhoeff10MatchesReference), //
+    NL_TEST_DEF("TestVerhoeff10Batch", TestVerhoeff10Batch),                       //
+    NL_TEST_SENTINEL()                                                             //
+};
+
+} // namespace
+
+int TestVerhoeff(void)
+{
+    nlTestSuite theSuite = { "Verhoeff", sTests, nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestVerhoeff)
@@ -0,0 +1,97 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the computation of Verhoeff10 check characters,
+ *      one string at a time and batched.
+ *
+ */
+
+#include <support/verhoeff/Verhoeff.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+// The length of a manual setup code without its check character.
+constexpr size_t kStrLen = 10;
+constexpr size_t kStride = 16;
+constexpr size_t kCount  = 1000;
+constexpr int kRounds    = 200;
+
+char sStrings[kCount * kStride];
+char sCheckChars[kCount];
+
+double Rate(std::chrono::steady_clock::duration duration)
+{
+    const double seconds = std::chrono::duration<double>(duration).count();
+    return static_cast<double>(kRounds * kCount) / (seconds > 0 ? seconds : 1e-9);
+}
+
+} // namespace
+
+int main()
+{
+    for (size_t i = 0; i < kCount; i++)
+    {
+        for (size_t c = 0; c < kStrLen; c++)
+        {
+            sStrings[i * kStride + c] = static_cast<char>('0' + rand() % 10);
+        }
+        sStrings[i * kStride + kStrLen] = '\0';
+    }
+
+    size_t mismatches = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        for (size_t i = 0; i < kCount; i++)
+        {
+            sCheckChars[i] = Verhoeff10::ComputeCheckChar(&sStrings[i * kStride], kStrLen);
+        }
+    }
+    auto single = std::chrono::steady_clock::now() - start;
+
+    char singleCheckChars[kCount];
+    memcpy(singleCheckChars, sCheckChars, sizeof(sCheckChars));
+
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        Verhoeff10::ComputeCheckChars(sStrings, kStrLen, kStride, kCount, sCheckChars);
+    }
+    auto batch = std::chrono::steady_clock::now() - start;
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        mismatches += (sCheckChars[i] != singleCheckChars[i]) ? 1 : 0;
+    }
+    if (mismatches != 0)
+    {
+        fprintf(stderr, "%zu batched check characters differ from the ones computed one at a time\n", mismatches);
+        return EXIT_FAILURE;
+    }
+
+    printf("Verhoeff10 check characters of %zu digits: %.0f/s one at a time, %.0f/s batched\n", kStrLen, Rate(single), Rate(batch));
+    return EXIT_SUCCESS;
+}
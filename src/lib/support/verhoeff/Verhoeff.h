@@ -58,6 +58,17 @@ public:
     static bool ValidateCheckChar(const char * str);
     static bool ValidateCheckChar(const char * str, size_t strLen);
 
+    // Compute the check characters of count strings of strLen characters, the string i starting at
+    // strs + i * stride. Strings are processed in interleaved groups, which is faster than
+    // computing their check characters one at a time. As with ComputeCheckChar, the check
+    // character of a string with an invalid character is 0.
+    static void ComputeCheckChars(const char * strs, size_t strLen, size_t stride, size_t count, char * checkChars);
+
+    // Verify the check characters at the end of count strings of strLen characters, the string i
+    // starting at strs + i * stride. Returns the number of valid strings; when results is not
+    // null, results[i] is set to whether the string i is valid.
+    static size_t ValidateCheckChars(const char * strs, size_t strLen, size_t stride, size_t count, bool * results = nullptr);
+
     // Convert between a character and its corresponding value.
     static int CharToVal(char ch);
     static char ValToChar(int val);
@@ -66,8 +77,16 @@ private:
     Verhoeff10()  = delete;
     ~Verhoeff10() = delete;
 
+    enum
+    {
+        PermOrder = 8 // sPermTable applied PermOrder times is the identity.
+    };
+
+    static int Multiply(int c, int p);
+
     static uint8_t sMultiplyTable[];
     static uint8_t sPermTable[];
+    static uint8_t sPermPowerTable[];
 };
 
 // Verhoeff16 -- Implements Verhoeff's check-digit algorithm for base-16 (hex) strings.
@@ -40,6 +40,32 @@ uint8_t Verhoeff10::sMultiplyTable[] = {
 
 uint8_t Verhoeff10::sPermTable[] = { 1, 5, 7, 6, 2, 8, 3, 0, 9, 4 };
 
+// sPermTable applied 0 to PermOrder - 1 times, one row per count: the permutation of the character at
+// position i is a single lookup in row i % PermOrder, rather than i lookups in sPermTable.
+uint8_t Verhoeff10::sPermPowerTable[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, //
+    1, 5, 7, 6, 2, 8, 3, 0, 9, 4, //
+    5, 8, 0, 3, 7, 9, 6, 1, 4, 2, //
+    8, 9, 1, 6, 0, 4, 3, 5, 2, 7, //
+    9, 4, 5, 3, 1, 2, 6, 8, 7, 0, //
+    4, 2, 8, 6, 5, 7, 3, 9, 0, 1, //
+    2, 7, 9, 3, 8, 0, 6, 4, 1, 5, //
+    7, 0, 4, 6, 9, 1, 3, 2, 5, 8, //
+};
+
+// Number of strings whose check characters ComputeCheckChars computes together. Their dependency
+// chains through the multiplication table are independent, and so overlap in the pipeline.
+static constexpr size_t kLanes = 8;
+
+inline int Verhoeff10::Multiply(int c, int p)
+{
+#ifdef VERHOEFF10_NO_MULTIPLY_TABLE
+    return Verhoeff::DihedralMultiply(c, p, PolygonSize);
+#else
+    return sMultiplyTable[c * Base + p];
+#endif
+}
+
 char Verhoeff10::ComputeCheckChar(const char * str)
 {
     return ComputeCheckChar(str, strlen(str));
@@ -57,13 +83,7 @@ char Verhoeff10::ComputeCheckChar(const char * str, size_t strLen)
         if (val < 0)
             return 0; // invalid character
 
-        int p = Verhoeff::Permute(val, sPermTable, Base, i);
-
-#ifdef VERHOEFF10_NO_MULTIPLY_TABLE
-        c = Verhoeff::DihedralMultiply(c, p, PolygonSize);
-#else
-        c = sMultiplyTable[c * Base + p];
-#endif
+        c = Multiply(c, sPermPowerTable[(i % PermOrder) * Base + static_cast<size_t>(val)]);
     }
 
     c = Verhoeff::DihedralInvert(c, PolygonSize);
@@ -71,6 +91,76 @@ char Verhoeff10::ComputeCheckChar(const char * str, size_t strLen)
     return ValToChar(c);
 }
 
+void Verhoeff10::ComputeCheckChars(const char * strs, size_t strLen, size_t stride, size_t count, char * checkChars)
+{
+    size_t item = 0;
+
+    for (; item + kLanes <= count; item += kLanes)
+    {
+        const char * str = strs + item * stride;
+        int c[kLanes]    = {};
+        int invalid      = 0;
+
+        for (size_t i = 1; i <= strLen; i++)
+        {
+            const uint8_t * perm = &sPermPowerTable[(i % PermOrder) * Base];
+
+            for (size_t lane = 0; lane < kLanes; lane++)
+            {
+                // Invalid characters are flagged rather than returned from, so that the lanes stay in step.
+                const unsigned val = static_cast<unsigned>(str[lane * stride + strLen - i] - '0');
+                invalid |= static_cast<int>(val >= Base) << lane;
+                c[lane] = Multiply(c[lane], perm[val < Base ? val : 0]);
+            }
+        }
+
+        for (size_t lane = 0; lane < kLanes; lane++)
+        {
+            checkChars[item + lane] =
+                (invalid & (1 << lane)) ? 0 : ValToChar(Verhoeff::DihedralInvert(c[lane], PolygonSize));
+        }
+    }
+
+    for (; item < count; item++)
+    {
+        checkChars[item] = ComputeCheckChar(strs + item * stride, strLen);
+    }
+}
+
+size_t Verhoeff10::ValidateCheckChars(const char * strs, size_t strLen, size_t stride, size_t count, bool * results)
+{
+    char checkChars[kLanes];
+    size_t validCount = 0;
+
+    if (strLen == 0)
+    {
+        for (size_t item = 0; results != nullptr && item < count; item++)
+        {
+            results[item] = false;
+        }
+        return 0;
+    }
+
+    for (size_t item = 0; item < count; item += kLanes)
+    {
+        const size_t groupCount = (count - item < kLanes) ? count - item : kLanes;
+
+        ComputeCheckChars(strs + item * stride, strLen - 1, stride, groupCount, checkChars);
+
+        for (size_t lane = 0; lane < groupCount; lane++)
+        {
+            const bool valid = (checkChars[lane] == strs[(item + lane) * stride + strLen - 1]);
+            validCount += valid ? 1 : 0;
+            if (results != nullptr)
+            {
+                results[item + lane] = valid;
+            }
+        }
+    }
+
+    return validCount;
+}
+
 bool Verhoeff10::ValidateCheckChar(char checkChar, const char * str)
 {
     return ValidateCheckChar(checkChar, str, strlen(str));
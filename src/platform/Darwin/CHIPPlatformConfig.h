@@ -99,6 +99,18 @@
 #define CHIP_LOG_FILTERING 1
 #endif // CHIP_LOG_FILTERING
 
+#ifndef CHIP_LOG_DEFERRED
+#define CHIP_LOG_DEFERRED 1
+#endif // CHIP_LOG_DEFERRED
+
+#ifndef CHIP_LOG_DEFERRED_DRAIN_THREAD
+#define CHIP_LOG_DEFERRED_DRAIN_THREAD 1
+#endif // CHIP_LOG_DEFERRED_DRAIN_THREAD
+
+#ifndef CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE 8
+#endif // CHIP_CONFIG_VERIFIED_CERT_CACHE_SIZE
+
 #ifndef CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
 #define CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS 1
 #endif // CHIP_CONFIG_BDX_MAX_NUM_TRANSFERS
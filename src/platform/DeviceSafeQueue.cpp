@@ -28,26 +28,95 @@ namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
-void DeviceSafeQueue::Push(const ChipDeviceEvent & event)
+DeviceSafeQueue::DeviceSafeQueue() : mPushPosition(0), mPopPosition(0), mWakePending(false), mSpillPending(false)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    mEventQueue.push(event);
+    for (size_t i = 0; i < kCapacity; i++)
+    {
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
 }
 
-bool DeviceSafeQueue::Empty()
+bool DeviceSafeQueue::Push(const ChipDeviceEvent & event, bool & wakeConsumer)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    return mEventQueue.empty();
+    size_t position = mPushPosition.load(std::memory_order_relaxed);
+    Slot * slot;
+
+    if (mSpillPending.load())
+    {
+        // Events must not overtake the ones that were spilled.
+        Spill(event, wakeConsumer);
+        return true;
+    }
+
+    while (true)
+    {
+        slot                = &mSlots[position & kMask];
+        size_t sequence     = slot->mSequence.load(std::memory_order_acquire);
+        ptrdiff_t available = static_cast<ptrdiff_t>(sequence - position);
+
+        if (available == 0)
+        {
+            // The slot is free, claim its position.
+            if (mPushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (available < 0)
+        {
+            // The slot still holds the event pushed one lap earlier.
+            wakeConsumer = false;
+            return false;
+        }
+        else
+        {
+            // Another producer claimed the position.
+            position = mPushPosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->mEvent = event;
+
+    // Publishing the event and testing the wake flag must not be reordered, as the consumer clears the
+    // flag before it looks for events (see DrainAll()).
+    slot->mSequence.store(position + 1, std::memory_order_seq_cst);
+    wakeConsumer = !mWakePending.exchange(true);
+    return true;
+}
+
+void DeviceSafeQueue::PushOrSpill(const ChipDeviceEvent & event, bool & wakeConsumer)
+{
+    if (!Push(event, wakeConsumer))
+    {
+        Spill(event, wakeConsumer);
+    }
+}
+
+void DeviceSafeQueue::Spill(const ChipDeviceEvent & event, bool & wakeConsumer)
+{
+    {
+        std::lock_guard<std::mutex> lock(mSpillLock);
+        mSpill.push_back(event);
+        mSpillPending.store(true);
+    }
+    wakeConsumer = !mWakePending.exchange(true);
 }
 
-const ChipDeviceEvent DeviceSafeQueue::PopFront()
+bool DeviceSafeQueue::Pop(ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
+    Slot & slot = mSlots[mPopPosition & kMask];
 
-    const ChipDeviceEvent event = mEventQueue.front();
-    mEventQueue.pop();
+    // The slot is not published yet if the queue is empty, or if a producer is still writing it. In the latter
+    // case, that producer wakes the consumer once it is done.
+    if (slot.mSequence.load(std::memory_order_seq_cst) != mPopPosition + 1)
+    {
+        return false;
+    }
 
-    return event;
+    event = slot.mEvent;
+    slot.mSequence.store(mPopPosition + kCapacity, std::memory_order_release);
+    mPopPosition++;
+    return true;
 }
 
 } // namespace Internal
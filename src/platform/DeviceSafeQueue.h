@@ -24,8 +24,10 @@
 
 #pragma once
 
+#include <atomic>
+#include <deque>
 #include <mutex>
-#include <queue>
+#include <stddef.h>
 
 #include <core/CHIPCore.h>
 #include <platform/CHIPDeviceConfig.h>
@@ -35,28 +37,116 @@ namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
+constexpr size_t RoundUpToPowerOfTwo(size_t value, size_t power = 1)
+{
+    return power >= value ? power : RoundUpToPowerOfTwo(value, power * 2);
+}
+
 /**
  *  @class DeviceSafeQueue
  *
  *  @brief
- *      This class represents a thread-safe message queue implemented with C++ Standard Library, the message queue
- *      is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued, decoded,
- *      and then an action is performed.
+ *      This class represents a bounded, lock-free, multi-producer single-consumer message queue, the message
+ *      queue is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued,
+ *      decoded, and then an action is performed.
+ *
+ *      Any thread may push events, but only the thread running the event loop may drain them. Each slot of the
+ *      ring carries a sequence number, which tells producers whether the slot is free and the consumer whether
+ *      it was published. The queue also tracks whether the consumer was asked to wake up since it last started
+ *      draining, so that producers wake it only once per batch of events.
  *
+ *      Producers that cannot wait for the consumer to make room in a full ring, such as the consumer itself,
+ *      spill their events into an unbounded overflow list instead. While that list holds events, every push
+ *      goes to it, so that events keep their order.
  */
 class DeviceSafeQueue
 {
 public:
-    DeviceSafeQueue()  = default;
+    DeviceSafeQueue();
     ~DeviceSafeQueue() = default;
 
-    void Push(const ChipDeviceEvent & event);
-    bool Empty();
-    const ChipDeviceEvent PopFront();
+    /**
+     * Add an event at the end of the queue.
+     *
+     * @param[in]  event          The event to add.
+     * @param[out] wakeConsumer   Set to true if the consumer may be waiting for events, and must be woken up.
+     *
+     * @return false if the queue is full.
+     */
+    bool Push(const ChipDeviceEvent & event, bool & wakeConsumer);
+
+    /**
+     * Add an event at the end of the queue, in the overflow list if the ring is full.
+     *
+     * @param[in]  event          The event to add.
+     * @param[out] wakeConsumer   Set to true if the consumer may be waiting for events, and must be woken up.
+     */
+    void PushOrSpill(const ChipDeviceEvent & event, bool & wakeConsumer);
+
+    /**
+     * Remove the events from the queue and call the handler for each of them, in order. Events pushed while
+     * the handler runs are also handled. Must only be called by the consumer.
+     *
+     * @param[in] handler  The functor of type `void (*)(const ChipDeviceEvent &)`.
+     */
+    template <typename F>
+    void DrainAll(F handler)
+    {
+        // Producers that push from now on wake the consumer again, so no event can be left behind
+        // once the queue looks empty.
+        mWakePending.store(false);
+
+        ChipDeviceEvent event;
+        while (true)
+        {
+            while (Pop(event))
+            {
+                handler(event);
+            }
+
+            // Spilled events follow those of the ring, including the ones still being published by their
+            // producer, which wakes the consumer once it is done.
+            if (!mSpillPending.load() || mPushPosition.load() != mPopPosition)
+            {
+                break;
+            }
+
+            std::deque<ChipDeviceEvent> spilled;
+            {
+                std::lock_guard<std::mutex> lock(mSpillLock);
+                spilled.swap(mSpill);
+                mSpillPending.store(false);
+            }
+            for (const ChipDeviceEvent & spilledEvent : spilled)
+            {
+                handler(spilledEvent);
+            }
+        }
+    }
 
 private:
-    std::queue<ChipDeviceEvent> mEventQueue;
-    std::mutex mEventQueueLock;
+    static constexpr size_t kCapacity = RoundUpToPowerOfTwo(CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE);
+    static constexpr size_t kMask     = kCapacity - 1;
+
+    struct Slot
+    {
+        // Equal to the position of the slot when it is free for that position, and to the position plus
+        // one once the event for that position is published.
+        std::atomic<size_t> mSequence;
+        ChipDeviceEvent mEvent;
+    };
+
+    bool Pop(ChipDeviceEvent & event);
+    void Spill(const ChipDeviceEvent & event, bool & wakeConsumer);
+
+    Slot mSlots[kCapacity];
+    std::atomic<size_t> mPushPosition;
+    size_t mPopPosition;
+    std::atomic<bool> mWakePending;
+
+    std::mutex mSpillLock;
+    std::deque<ChipDeviceEvent> mSpill; // Protected by mSpillLock
+    std::atomic<bool> mSpillPending;    // Set while mSpill may hold events
 
     DeviceSafeQueue(const DeviceSafeQueue &) = delete;
     DeviceSafeQueue & operator=(const DeviceSafeQueue &) = delete;
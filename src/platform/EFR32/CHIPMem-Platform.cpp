@@ -145,6 +145,11 @@ void MemoryFree(void * p)
     sl_free(p);
 }
 
+size_t MemoryDebugAllocationCount()
+{
+    return 0;
+}
+
 bool MemoryInternalCheckPointer(const void * p, size_t min_size)
 {
     return (p != nullptr);
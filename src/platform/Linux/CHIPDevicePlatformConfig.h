@@ -72,6 +72,10 @@
 
 // ========== Platform-specific Configuration Overrides =========
 
+#ifndef CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE
+#define CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE 1024
+#endif // CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE
+
 #ifndef CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
 #define CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE 8192
 #endif // CHIP_DEVICE_CONFIG_CHIP_TASK_STACK_SIZE
@@ -44,7 +44,8 @@ namespace Internal {
 
 ChipLinuxStorage::ChipLinuxStorage()
 {
-    mDirty = false;
+    mDirty         = false;
+    mInTransaction = false;
 }
 
 ChipLinuxStorage::~ChipLinuxStorage() {}
@@ -304,7 +305,11 @@ CHIP_ERROR ChipLinuxStorage::Commit()
     {
         mLock.lock();
 
-        retval = ChipLinuxStorageIni::CommitConfig(mConfigPath);
+        // The file is written once, when the transaction is committed.
+        if (!mInTransaction)
+        {
+            retval = ChipLinuxStorageIni::CommitConfig(mConfigPath);
+        }
 
         mLock.unlock();
     }
@@ -316,6 +321,75 @@ CHIP_ERROR ChipLinuxStorage::Commit()
     return retval;
 }
 
+CHIP_ERROR ChipLinuxStorage::BeginTransaction()
+{
+    CHIP_ERROR retval = CHIP_NO_ERROR;
+
+    mLock.lock();
+
+    if (mInTransaction)
+    {
+        retval = CHIP_ERROR_INCORRECT_STATE;
+    }
+    else
+    {
+        ChipLinuxStorageIni::SaveSections(mTransactionSnapshot);
+        mInTransaction = true;
+    }
+
+    mLock.unlock();
+
+    return retval;
+}
+
+CHIP_ERROR ChipLinuxStorage::CommitTransaction()
+{
+    CHIP_ERROR retval = CHIP_NO_ERROR;
+
+    mLock.lock();
+
+    if (!mInTransaction)
+    {
+        retval = CHIP_ERROR_INCORRECT_STATE;
+    }
+    else
+    {
+        mInTransaction = false;
+
+        if (mDirty && !mConfigPath.empty())
+        {
+            retval = ChipLinuxStorageIni::CommitConfig(mConfigPath);
+        }
+
+        if (retval == CHIP_NO_ERROR)
+        {
+            mTransactionSnapshot.clear();
+        }
+        else
+        {
+            // Keep the settings in line with the file, which still holds the values from before the transaction.
+            ChipLinuxStorageIni::RestoreSections(mTransactionSnapshot);
+        }
+    }
+
+    mLock.unlock();
+
+    return retval;
+}
+
+void ChipLinuxStorage::AbortTransaction()
+{
+    mLock.lock();
+
+    if (mInTransaction)
+    {
+        ChipLinuxStorageIni::RestoreSections(mTransactionSnapshot);
+        mInTransaction = false;
+    }
+
+    mLock.unlock();
+}
+
 } // namespace Internal
 } // namespace DeviceLayer
 } // namespace chip
@@ -84,10 +84,18 @@ public:
     CHIP_ERROR Commit();
     bool HasValue(const char * key);
 
+    // While a transaction is in progress, Commit() does not write the file. The changes made since
+    // BeginTransaction() are written together by CommitTransaction(), or discarded by AbortTransaction().
+    CHIP_ERROR BeginTransaction();
+    CHIP_ERROR CommitTransaction();
+    void AbortTransaction();
+
 private:
     std::mutex mLock;
     bool mDirty;
+    bool mInTransaction;
     std::string mConfigPath;
+    Sections mTransactionSnapshot;
 };
 
 } // namespace Internal
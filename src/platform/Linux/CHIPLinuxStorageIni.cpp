@@ -23,6 +23,7 @@
  *
  */
 
+#include <fcntl.h>
 #include <fstream>
 #include <string>
 #include <unistd.h>
@@ -103,14 +104,27 @@ CHIP_ERROR ChipLinuxStorageIni::CommitConfig(const std::string & configFile)
         mConfigStore.generate(ofs);
         ofs.close();
 
-        if (rename(tmpPath.c_str(), configFile.c_str()) == 0)
+        if (ofs.fail())
         {
-            ChipLogError(DeviceLayer, "renamed tmp file to file (%s)", configFile.c_str());
+            ChipLogError(DeviceLayer, "failed to write file (%s)", tmpPath.c_str());
+            retval = CHIP_ERROR_WRITE_FAILED;
         }
         else
         {
-            ChipLogError(DeviceLayer, "failed to rename (%s), %s (%d)", tmpPath.c_str(), strerror(errno), errno);
-            retval = CHIP_ERROR_WRITE_FAILED;
+            retval = SyncFile(tmpPath);
+        }
+
+        if (retval == CHIP_NO_ERROR)
+        {
+            if (rename(tmpPath.c_str(), configFile.c_str()) == 0)
+            {
+                ChipLogError(DeviceLayer, "renamed tmp file to file (%s)", configFile.c_str());
+            }
+            else
+            {
+                ChipLogError(DeviceLayer, "failed to rename (%s), %s (%d)", tmpPath.c_str(), strerror(errno), errno);
+                retval = CHIP_ERROR_WRITE_FAILED;
+            }
         }
     }
     else
@@ -122,6 +136,25 @@ CHIP_ERROR ChipLinuxStorageIni::CommitConfig(const std::string & configFile)
     return retval;
 }
 
+CHIP_ERROR ChipLinuxStorageIni::SyncFile(const std::string & path)
+{
+    CHIP_ERROR retval = CHIP_NO_ERROR;
+    int fd            = open(path.c_str(), O_RDONLY);
+
+    if (fd < 0 || fsync(fd) != 0)
+    {
+        ChipLogError(DeviceLayer, "failed to sync (%s), %s (%d)", path.c_str(), strerror(errno), errno);
+        retval = CHIP_ERROR_WRITE_FAILED;
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return retval;
+}
+
 CHIP_ERROR ChipLinuxStorageIni::GetUIntValue(const char * key, uint32_t & val)
 {
     CHIP_ERROR retval = CHIP_NO_ERROR;
@@ -361,6 +394,17 @@ CHIP_ERROR ChipLinuxStorageIni::RemoveAll()
     return CHIP_NO_ERROR;
 }
 
+void ChipLinuxStorageIni::SaveSections(Sections & sections) const
+{
+    sections = mConfigStore.sections;
+}
+
+void ChipLinuxStorageIni::RestoreSections(Sections & sections)
+{
+    mConfigStore.sections.swap(sections);
+    sections.clear();
+}
+
 } // namespace Internal
 } // namespace DeviceLayer
 } // namespace chip
@@ -46,11 +46,17 @@ public:
     bool HasValue(const char * key);
 
 protected:
+    using Sections = inipp::Ini<char>::Sections;
+
     CHIP_ERROR AddEntry(const char * key, const char * value);
     CHIP_ERROR RemoveEntry(const char * key);
     CHIP_ERROR RemoveAll();
+    void SaveSections(Sections & sections) const;
+    // Replaces the settings with the ones saved by SaveSections, leaving sections empty.
+    void RestoreSections(Sections & sections);
 
 private:
+    static CHIP_ERROR SyncFile(const std::string & path);
     CHIP_ERROR GetDefaultSection(std::map<std::string, std::string> & section);
     CHIP_ERROR GetBinaryBlobDataAndLengths(const char * key, chip::Platform::ScopedMemoryBuffer<char> & encodedData,
                                            size_t & encodedDataLen, size_t & decodedDataLen);
@@ -20,24 +20,22 @@
 #include <algorithm>
 #include <sstream>
 #include <string.h>
-#include <time.h>
 #include <vector>
 
 #include <netinet/in.h>
 
+#include <avahi-common/timeval.h>
+
 #include <platform/internal/CHIPDeviceLayerInternal.h>
 #include <support/CHIPMem.h>
 #include <support/CHIPMemString.h>
 #include <support/CodeUtils.h>
+#include <support/ErrorStr.h>
 
 using chip::Mdns::kMdnsTypeMaxSize;
 using chip::Mdns::MdnsServiceProtocol;
 using chip::Mdns::TextEntry;
 using chip::System::SocketEvents;
-using std::chrono::duration_cast;
-using std::chrono::microseconds;
-using std::chrono::seconds;
-using std::chrono::steady_clock;
 
 namespace {
 
@@ -135,8 +133,6 @@ namespace Mdns {
 
 MdnsAvahi MdnsAvahi::sInstance;
 
-constexpr uint64_t kUsPerSec = 1000 * 1000;
-
 Poller::Poller()
 {
     mAvahiPoller.userdata         = this;
@@ -150,6 +146,7 @@ Poller::Poller()
     mAvahiPoller.timeout_free   = TimeoutFree;
 
     mWatchableEvents = &DeviceLayer::SystemLayer.WatchableEvents();
+    mSystemLayer     = &DeviceLayer::SystemLayer;
 }
 
 AvahiWatch * Poller::WatchNew(const struct AvahiPoll * poller, int fd, AvahiWatchEvent event, AvahiWatchCallback callback,
@@ -162,18 +159,18 @@ AvahiWatch * Poller::WatchNew(int fd, AvahiWatchEvent event, AvahiWatchCallback
 {
     VerifyOrDie(callback != nullptr && fd >= 0);
 
-    auto watch = std::make_unique<AvahiWatch>();
+    AvahiWatch * watch = chip::Platform::New<AvahiWatch>();
+    VerifyOrReturnError(watch != nullptr, nullptr);
+
     watch->mSocket.Init(*mWatchableEvents)
         .Attach(fd)
-        .SetCallback(AvahiWatchCallbackTrampoline, reinterpret_cast<intptr_t>(watch.get()))
+        .SetCallback(AvahiWatchCallbackTrampoline, reinterpret_cast<intptr_t>(watch))
         .RequestCallbackOnPendingRead(event & AVAHI_WATCH_IN)
         .RequestCallbackOnPendingWrite(event & AVAHI_WATCH_OUT);
     watch->mCallback = callback;
     watch->mContext  = context;
-    watch->mPoller   = this;
-    mWatches.emplace_back(std::move(watch));
 
-    return mWatches.back().get();
+    return watch;
 }
 
 void Poller::WatchUpdate(AvahiWatch * watch, AvahiWatchEvent event)
@@ -203,15 +200,8 @@ AvahiWatchEvent Poller::WatchGetEvents(AvahiWatch * watch)
 
 void Poller::WatchFree(AvahiWatch * watch)
 {
-    reinterpret_cast<Poller *>(watch->mPoller)->WatchFree(*watch);
-}
-
-void Poller::WatchFree(AvahiWatch & watch)
-{
-    (void) watch.mSocket.ReleaseFD();
-    mWatches.erase(std::remove_if(mWatches.begin(), mWatches.end(),
-                                  [&watch](const std::unique_ptr<AvahiWatch> & aValue) { return aValue.get() == &watch; }),
-                   mWatches.end());
+    (void) watch->mSocket.ReleaseFD();
+    chip::Platform::Delete(watch);
 }
 
 AvahiTimeout * Poller::TimeoutNew(const AvahiPoll * poller, const struct timeval * timeout, AvahiTimeoutCallback callback,
@@ -222,37 +212,45 @@ AvahiTimeout * Poller::TimeoutNew(const AvahiPoll * poller, const struct timeval
     return static_cast<Poller *>(poller->userdata)->TimeoutNew(timeout, callback, context);
 }
 
-steady_clock::time_point GetAbsTimeout(const struct timeval * timeout)
+AvahiTimeout * Poller::TimeoutNew(const struct timeval * timeout, AvahiTimeoutCallback callback, void * context)
 {
-    steady_clock::time_point now        = steady_clock::now();
-    steady_clock::time_point absTimeout = now;
+    AvahiTimeout * timer = chip::Platform::New<AvahiTimeout>();
+    VerifyOrReturnError(timer != nullptr, nullptr);
 
-    if (timeout != nullptr)
-    {
-        absTimeout += seconds(timeout->tv_sec);
-        absTimeout += microseconds(timeout->tv_usec);
-    }
+    timer->mCallback = callback;
+    timer->mContext  = context;
+    timer->mPoller   = this;
+    TimeoutUpdate(*timer, timeout);
 
-    return absTimeout;
+    return timer;
 }
 
-AvahiTimeout * Poller::TimeoutNew(const struct timeval * timeout, AvahiTimeoutCallback callback, void * context)
+void Poller::TimeoutUpdate(AvahiTimeout * timer, const struct timeval * timeout)
 {
-
-    mTimers.emplace_back(new AvahiTimeout{ GetAbsTimeout(timeout), callback, timeout != nullptr, context, this });
-    return mTimers.back().get();
+    static_cast<Poller *>(timer->mPoller)->TimeoutUpdate(*timer, timeout);
 }
 
-void Poller::TimeoutUpdate(AvahiTimeout * timer, const struct timeval * timeout)
+void Poller::TimeoutUpdate(AvahiTimeout & timer, const struct timeval * timeout)
 {
-    if (timeout)
+    if (timeout == nullptr)
     {
-        timer->mAbsTimeout = GetAbsTimeout(timeout);
-        timer->mEnabled    = true;
+        mSystemLayer->CancelTimer(HandleTimeout, &timer);
+        return;
     }
-    else
+
+    // Avahi timeouts are absolute times in the gettimeofday() timebase, avahi_age() is negative
+    // as long as the timeout is in the future.
+    const AvahiUsec age = avahi_age(timeout);
+    uint32_t delayMs    = 0;
+    if (age < 0)
     {
-        timer->mEnabled = false;
+        delayMs = static_cast<uint32_t>(std::min<AvahiUsec>((-age + 999) / 1000, UINT32_MAX));
+    }
+
+    CHIP_ERROR error = mSystemLayer->StartTimer(delayMs, HandleTimeout, &timer);
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to start Avahi timeout: %s", ErrorStr(error));
     }
 }
 
@@ -263,54 +261,16 @@ void Poller::TimeoutFree(AvahiTimeout * timer)
 
 void Poller::TimeoutFree(AvahiTimeout & timer)
 {
-    mTimers.erase(std::remove_if(mTimers.begin(), mTimers.end(),
-                                 [&timer](const std::unique_ptr<AvahiTimeout> & aValue) { return aValue.get() == &timer; }),
-                  mTimers.end());
-}
-
-void Poller::GetTimeout(timeval & timeout)
-{
-    microseconds timeoutVal = seconds(timeout.tv_sec) + microseconds(timeout.tv_usec);
-
-    for (auto && timer : mTimers)
-    {
-        steady_clock::time_point absTimeout = timer->mAbsTimeout;
-        steady_clock::time_point now        = steady_clock::now();
-
-        if (!timer->mEnabled)
-        {
-            continue;
-        }
-        if (absTimeout < now)
-        {
-            timeoutVal = microseconds(0);
-            break;
-        }
-        else
-        {
-            timeoutVal = std::min(timeoutVal, duration_cast<microseconds>(absTimeout - now));
-        }
-    }
-
-    timeout.tv_sec  = static_cast<uint64_t>(timeoutVal.count()) / kUsPerSec;
-    timeout.tv_usec = static_cast<uint64_t>(timeoutVal.count()) % kUsPerSec;
+    mSystemLayer->CancelTimer(HandleTimeout, &timer);
+    chip::Platform::Delete(&timer);
 }
 
-void Poller::HandleTimeout()
+void Poller::HandleTimeout(System::Layer * /*layer*/, void * appState, CHIP_ERROR /*error*/)
 {
-    steady_clock::time_point now = steady_clock::now();
+    AvahiTimeout * const timer = static_cast<AvahiTimeout *>(appState);
 
-    for (auto && timer : mTimers)
-    {
-        if (!timer->mEnabled)
-        {
-            continue;
-        }
-        if (timer->mAbsTimeout <= now)
-        {
-            timer->mCallback(timer.get(), timer->mContext);
-        }
-    }
+    // The callback may update or free the timeout.
+    timer->mCallback(timer, timer->mContext);
 }
 
 CHIP_ERROR MdnsAvahi::Init(MdnsAsyncReturnCallback initCallback, MdnsAsyncReturnCallback errorCallback, void * context)
@@ -739,16 +699,6 @@ MdnsAvahi::~MdnsAvahi()
     }
 }
 
-void GetMdnsTimeout(timeval & timeout)
-{
-    MdnsAvahi::GetInstance().GetPoller().GetTimeout(timeout);
-}
-
-void HandleMdnsTimeout()
-{
-    MdnsAvahi::GetInstance().GetPoller().HandleTimeout();
-}
-
 CHIP_ERROR ChipMdnsInit(MdnsAsyncReturnCallback initCallback, MdnsAsyncReturnCallback errorCallback, void * context)
 {
     return MdnsAvahi::GetInstance().Init(initCallback, errorCallback, context);
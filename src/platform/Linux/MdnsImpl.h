@@ -17,10 +17,8 @@
 
 #pragma once
 
-#include <sys/select.h>
 #include <unistd.h>
 
-#include <chrono>
 #include <map>
 #include <memory>
 #include <set>
@@ -34,6 +32,7 @@
 #include <avahi-common/watch.h>
 
 #include "lib/mdns/platform/Mdns.h"
+#include "system/SystemLayer.h"
 #include "system/SystemSockets.h"
 
 struct AvahiWatch
@@ -41,29 +40,30 @@ struct AvahiWatch
     chip::System::WatchableSocket mSocket;
     AvahiWatchCallback mCallback; ///< The function to be called when interested events happened on mFd.
     void * mContext;              ///< A pointer to application-specific context.
-    void * mPoller;               ///< The poller created this watch.
 };
 
 struct AvahiTimeout
 {
-    std::chrono::steady_clock::time_point mAbsTimeout; ///< Absolute time when this timer timeout.
-    AvahiTimeoutCallback mCallback;                    ///< The function to be called when timeout.
-    bool mEnabled;                                     ///< Whether the timeout is enabled.
-    void * mContext;                                   ///< The pointer to application-specific context.
-    void * mPoller;                                    ///< The poller created this timer.
+    AvahiTimeoutCallback mCallback; ///< The function to be called when timeout.
+    void * mContext;                ///< The pointer to application-specific context.
+    void * mPoller;                 ///< The poller created this timer.
 };
 
 namespace chip {
 namespace Mdns {
 
+/**
+ * Implementation of the Avahi poll API on top of the CHIP system layer.
+ *
+ * Avahi watches are attached to the system layer as WatchableSockets, and Avahi timeouts are
+ * run as system layer timers, so that the event loop dispatches them along with its own events
+ * rather than the poller scanning all of them on every iteration.
+ */
 class Poller
 {
 public:
     Poller(void);
 
-    void GetTimeout(timeval & timeout);
-    void HandleTimeout();
-
     const AvahiPoll * GetAvahiPoll(void) const { return &mAvahiPoller; }
 
 private:
@@ -76,21 +76,22 @@ private:
     static AvahiWatchEvent WatchGetEvents(AvahiWatch * watch);
 
     static void WatchFree(AvahiWatch * watch);
-    void WatchFree(AvahiWatch & watch);
 
     static AvahiTimeout * TimeoutNew(const AvahiPoll * poller, const struct timeval * timeout, AvahiTimeoutCallback callback,
                                      void * context);
     AvahiTimeout * TimeoutNew(const struct timeval * timeout, AvahiTimeoutCallback callback, void * context);
 
     static void TimeoutUpdate(AvahiTimeout * timer, const struct timeval * timeout);
+    void TimeoutUpdate(AvahiTimeout & timer, const struct timeval * timeout);
 
     static void TimeoutFree(AvahiTimeout * timer);
     void TimeoutFree(AvahiTimeout & timer);
 
-    std::vector<std::unique_ptr<AvahiWatch>> mWatches;
-    std::vector<std::unique_ptr<AvahiTimeout>> mTimers;
+    static void HandleTimeout(System::Layer * layer, void * appState, CHIP_ERROR error);
+
     AvahiPoll mAvahiPoller;
     System::WatchableEventManager * mWatchableEvents;
+    System::Layer * mSystemLayer;
 };
 
 class MdnsAvahi
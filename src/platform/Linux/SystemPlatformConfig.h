@@ -42,8 +42,14 @@ struct ChipDeviceEvent;
 
 #define CHIP_SYSTEM_CONFIG_USE_POSIX_TIME_FUNCTS 1
 
+// Wake the event loop with an eventfd, which costs one file descriptor and no pipe buffer.
+#ifndef CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
+#define CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE 0
+#endif // CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
+
 // ========== Platform-specific Configuration Overrides =========
 
 #ifndef CHIP_SYSTEM_CONFIG_NUM_TIMERS
-#define CHIP_SYSTEM_CONFIG_NUM_TIMERS 16
+// Avahi timeouts (e.g. one per pending D-Bus call) are run as system layer timers.
+#define CHIP_SYSTEM_CONFIG_NUM_TIMERS 64
 #endif // CHIP_SYSTEM_CONFIG_NUM_TIMERS
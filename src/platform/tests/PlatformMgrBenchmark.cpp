@@ -0,0 +1,94 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the posting of events to the CHIP event loop task:
+ *      several threads post work items as fast as they can, more than the event queue can
+ *      hold at once.
+ *
+ */
+
+#include <platform/CHIPDeviceLayer.h>
+#include <support/CHIPMem.h>
+
+#include <atomic>
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::DeviceLayer;
+
+namespace {
+
+constexpr uint32_t kThreadCount     = 4;
+constexpr uint32_t kEventsPerThread = 200000;
+
+std::atomic<uint32_t> sWorkDone;
+
+void CountWork(intptr_t)
+{
+    sWorkDone++;
+}
+
+} // namespace
+
+int main()
+{
+    if (Platform::MemoryInit() != CHIP_NO_ERROR || PlatformMgr().InitChipStack() != CHIP_NO_ERROR ||
+        PlatformMgr().StartEventLoopTask() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to start the CHIP event loop task\n");
+        return EXIT_FAILURE;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> producers;
+    for (uint32_t i = 0; i < kThreadCount; i++)
+    {
+        producers.emplace_back([] {
+            for (uint32_t j = 0; j < kEventsPerThread; j++)
+            {
+                PlatformMgr().ScheduleWork(CountWork);
+            }
+        });
+    }
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+
+    while (sWorkDone < kThreadCount * kEventsPerThread)
+    {
+        std::this_thread::yield();
+    }
+
+    auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    uint64_t rate  = static_cast<uint64_t>(kThreadCount * kEventsPerThread) * 1000000 / static_cast<uint64_t>(elapsedUs + 1);
+    printf("PostEvent throughput from %u threads: %" PRIu64 " events/s\n", kThreadCount, rate);
+
+    PlatformMgr().StopEventLoopTask();
+    PlatformMgr().Shutdown();
+    Platform::MemoryShutdown();
+    return EXIT_SUCCESS;
+}
@@ -199,6 +199,48 @@ static void TestKeyValueStoreMgr_MultiReadKey(nlTestSuite * inSuite, void * inCo
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+static void TestKeyValueStoreMgr_Transaction(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err;
+    const char * kTestKey1 = "txn_key1";
+    const char * kTestKey2 = "txn_key2";
+    uint32_t kTestValue1   = 1;
+    uint32_t kTestValue2   = 2;
+    uint32_t read_value;
+
+    err = KeyValueStoreMgr().BeginTransaction();
+    if (err == CHIP_ERROR_NOT_IMPLEMENTED)
+    {
+        // The platform persists every write on its own.
+        return;
+    }
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    // Batches cannot be nested.
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().BeginTransaction() == CHIP_ERROR_INCORRECT_STATE);
+
+    // Writes made in a batch can be read back before it is committed.
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().Put(kTestKey1, kTestValue1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().Put(kTestKey2, kTestValue2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().Get(kTestKey2, &read_value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, read_value == kTestValue2);
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().CommitTransaction() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().CommitTransaction() == CHIP_ERROR_INCORRECT_STATE);
+
+    // Aborting a batch discards all of its writes.
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().BeginTransaction() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().Put(kTestKey1, kTestValue2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().Delete(kTestKey2) == CHIP_NO_ERROR);
+    KeyValueStoreMgr().AbortTransaction();
+
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().Get(kTestKey1, &read_value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, read_value == kTestValue1);
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().Get(kTestKey2, &read_value) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, read_value == kTestValue2);
+
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().Delete(kTestKey1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, KeyValueStoreMgr().Delete(kTestKey2) == CHIP_NO_ERROR);
+}
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -213,6 +255,7 @@ static const nlTest sTests[] = { NL_TEST_DEF("Test KeyValueStoreMgr_EmptyStringK
                                  // Zephyr platform does not support partial or offset reads yet.
                                  NL_TEST_DEF("Test KeyValueStoreMgr_MultiReadKey", TestKeyValueStoreMgr_MultiReadKey),
 #endif
+                                 NL_TEST_DEF("Test KeyValueStoreMgr_Transaction", TestKeyValueStoreMgr_Transaction),
                                  NL_TEST_SENTINEL() };
 
 /**
@@ -10,10 +10,75 @@
 #include "support/CHIPMem.h"
 #include "support/UnitTestRegistration.h"
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+#include <avahi-common/timeval.h>
+
+#include "platform/Linux/MdnsImpl.h"
+#endif
+
 using chip::Mdns::MdnsService;
 using chip::Mdns::MdnsServiceProtocol;
 using chip::Mdns::TextEntry;
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+
+// Idle Avahi watches and timeouts registered alongside the publish/browse/resolve flow, which must
+// still complete within the test timeout: the event loop shouldn't slow down with their number.
+constexpr size_t kNumIdleWatches  = 128;
+constexpr size_t kNumIdleTimeouts = 32;
+
+static int sIdlePipes[kNumIdleWatches][2];
+static bool sIdleEventFired    = false;
+static size_t sExpiredTimeouts = 0;
+
+static void HandleIdleWatch(AvahiWatch * watch, int fd, AvahiWatchEvent event, void * context)
+{
+    sIdleEventFired = true;
+}
+
+static void HandleIdleTimeout(AvahiTimeout * timeout, void * context)
+{
+    sIdleEventFired = true;
+}
+
+static void HandleExpiredTimeout(AvahiTimeout * timeout, void * context)
+{
+    const AvahiPoll * poll = static_cast<const AvahiPoll *>(context);
+
+    sExpiredTimeouts++;
+    poll->timeout_free(timeout);
+}
+
+static void AddIdlePollerLoad(nlTestSuite * suite)
+{
+    const AvahiPoll * poll = chip::Mdns::MdnsAvahi::GetInstance().GetPoller().GetAvahiPoll();
+    struct timeval tv;
+
+    for (auto & fds : sIdlePipes)
+    {
+        NL_TEST_ASSERT(suite, pipe(fds) == 0);
+        NL_TEST_ASSERT(suite, poll->watch_new(poll, fds[0], AVAHI_WATCH_IN, HandleIdleWatch, nullptr) != nullptr);
+    }
+
+    for (size_t i = 0; i < kNumIdleTimeouts; i++)
+    {
+        avahi_elapse(&tv, 60 * 1000, 0);
+        NL_TEST_ASSERT(suite, poll->timeout_new(poll, &tv, HandleIdleTimeout, nullptr) != nullptr);
+        NL_TEST_ASSERT(suite, poll->timeout_new(poll, nullptr, HandleIdleTimeout, nullptr) != nullptr);
+    }
+
+    avahi_elapse(&tv, 0, 0);
+    NL_TEST_ASSERT(suite, poll->timeout_new(poll, &tv, HandleExpiredTimeout, const_cast<AvahiPoll *>(poll)) != nullptr);
+}
+
+static void CheckIdlePollerLoad(nlTestSuite * suite)
+{
+    NL_TEST_ASSERT(suite, !sIdleEventFired);
+    NL_TEST_ASSERT(suite, sExpiredTimeouts == 1);
+}
+
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
 static void HandleResolve(void * context, MdnsService * result, CHIP_ERROR error)
 {
     char addrBuf[100];
@@ -27,6 +92,10 @@ static void HandleResolve(void * context, MdnsService * result, CHIP_ERROR error
     NL_TEST_ASSERT(suite, strcmp(result->mTextEntries[0].mKey, "key") == 0);
     NL_TEST_ASSERT(suite, strcmp(reinterpret_cast<const char *>(result->mTextEntries[0].mData), "val") == 0);
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    CheckIdlePollerLoad(suite);
+#endif
+
     exit(0);
 }
 
@@ -54,6 +123,10 @@ static void InitCallback(void * context, CHIP_ERROR error)
 
     NL_TEST_ASSERT(suite, error == CHIP_NO_ERROR);
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    AddIdlePollerLoad(suite);
+#endif
+
     service.mInterface = INET_NULL_INTERFACEID;
     service.mPort      = 80;
     strcpy(service.mName, "test");
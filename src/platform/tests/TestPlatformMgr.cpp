@@ -177,6 +177,47 @@ static void TestPlatformMgr_AddEventHandler(nlTestSuite * inSuite, void * inCont
 #endif
 }
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX || CHIP_DEVICE_LAYER_TARGET_DARWIN
+
+static uint32_t sNextWork;
+static bool sWorkOutOfOrder;
+
+static void CheckWorkOrder(intptr_t arg)
+{
+    sWorkOutOfOrder |= (static_cast<uint32_t>(arg) != sNextWork);
+    sNextWork++;
+}
+
+static void TestPlatformMgr_PostEventOverflow(nlTestSuite * inSuite, void * inContext)
+{
+    // Events posted before the event loop runs cannot wait for it to make room in the queue: more of them
+    // than the queue holds are still all dispatched, in order.
+    constexpr uint32_t kEventCount = 4 * CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE;
+
+    stopRan         = false;
+    sNextWork       = 0;
+    sWorkOutOfOrder = false;
+
+    CHIP_ERROR err = PlatformMgr().InitChipStack();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    for (uint32_t i = 0; i < kEventCount; i++)
+    {
+        PlatformMgr().ScheduleWork(CheckWorkOrder, static_cast<intptr_t>(i));
+    }
+    PlatformMgr().ScheduleWork(StopTheLoop);
+
+    PlatformMgr().RunEventLoop();
+    NL_TEST_ASSERT(inSuite, stopRan);
+    NL_TEST_ASSERT(inSuite, sNextWork == kEventCount);
+    NL_TEST_ASSERT(inSuite, !sWorkOutOfOrder);
+
+    err = PlatformMgr().Shutdown();
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX || CHIP_DEVICE_LAYER_TARGET_DARWIN
+
 /**
  *   Test Suite. It lists all the test functions.
  */
@@ -189,6 +230,9 @@ static const nlTest sTests[] = {
     NL_TEST_DEF("Test PlatformMgr::RunEventLoop with stop before sleep", TestPlatformMgr_RunEventLoopStopBeforeSleep),
     NL_TEST_DEF("Test PlatformMgr::TryLockChipStack", TestPlatformMgr_TryLockChipStack),
     NL_TEST_DEF("Test PlatformMgr::AddEventHandler", TestPlatformMgr_AddEventHandler),
+#if CHIP_DEVICE_LAYER_TARGET_LINUX || CHIP_DEVICE_LAYER_TARGET_DARWIN
+    NL_TEST_DEF("Test PlatformMgr::PostEvent beyond the queue capacity", TestPlatformMgr_PostEventOverflow),
+#endif
 
     NL_TEST_SENTINEL()
 };
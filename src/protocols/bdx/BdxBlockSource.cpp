@@ -0,0 +1,81 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Implementation of the BlockSource classes.
+ */
+
+#include <protocols/bdx/BdxBlockSource.h>
+
+#include <support/CodeUtils.h>
+
+namespace chip {
+namespace bdx {
+
+CHIP_ERROR BufferBlockSource::GetBlock(uint64_t offset, uint16_t maxLength, const uint8_t *& data, uint16_t & length,
+                                       bool & isEof)
+{
+    VerifyOrReturnError(offset < mLength || (offset == 0 && mLength == 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint64_t remaining = mLength - offset;
+
+    data   = mData + offset;
+    length = (remaining < maxLength) ? static_cast<uint16_t>(remaining) : maxLength;
+    isEof  = (remaining <= maxLength);
+
+    return CHIP_NO_ERROR;
+}
+
+void PacketBufferBlockSource::Rewind()
+{
+    mCurrent       = mChain.Retain();
+    mCurrentOffset = 0;
+}
+
+CHIP_ERROR PacketBufferBlockSource::GetBlock(uint64_t offset, uint16_t maxLength, const uint8_t *& data, uint16_t & length,
+                                             bool & isEof)
+{
+    VerifyOrReturnError(!mChain.IsNull(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(offset < mChain->TotalLength() || (offset == 0 && mChain->TotalLength() == 0),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (offset < mCurrentOffset)
+    {
+        Rewind();
+    }
+
+    // Skip the buffers that end before the Block. Empty buffers are skipped too, except for the last one.
+    while (offset >= mCurrentOffset + mCurrent->DataLength() && mCurrent->HasChainedBuffer())
+    {
+        mCurrentOffset += mCurrent->DataLength();
+        mCurrent = mCurrent->Next();
+    }
+
+    const uint16_t start     = static_cast<uint16_t>(offset - mCurrentOffset);
+    const uint16_t remaining = static_cast<uint16_t>(mCurrent->DataLength() - start);
+
+    data   = mCurrent->Start() + start;
+    length = (remaining < maxLength) ? remaining : maxLength;
+    isEof  = (offset + length == mChain->TotalLength());
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace bdx
+} // namespace chip
@@ -0,0 +1,99 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the BlockSource interface, which provides the data of a Bulk Data Transfer to a sending TransferSession,
+ *      and implementations of it for data held in memory (for example, a memory-mapped file) or in a PacketBuffer chain.
+ */
+
+#pragma once
+
+#include <core/CHIPError.h>
+#include <support/DLLUtil.h>
+#include <system/SystemPacketBuffer.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace bdx {
+
+/**
+ * Provides the data of a transfer to TransferSession::PrepareBlock(BlockSource &), which reads each Block in place instead of
+ * requiring the application to copy it into a staging buffer first. A Block may be read more than once when it has to be sent
+ * again.
+ */
+class DLL_EXPORT BlockSource
+{
+public:
+    virtual ~BlockSource() = default;
+
+    /**
+     * @brief
+     *   Provide the data of the Block that starts at the given offset of the transfer.
+     *
+     * @param[in]  offset    Offset of the Block, from the start of the transfer data
+     * @param[in]  maxLength Maximum length of the Block
+     * @param[out] data      Set to the data of the Block, which must stay valid until the next call to GetBlock()
+     * @param[out] length    Set to the length of the Block, which may be less than maxLength
+     * @param[out] isEof     Set to true if the Block is the last one of the transfer
+     *
+     * @return CHIP_ERROR_INVALID_ARGUMENT if the offset is past the end of the data
+     */
+    virtual CHIP_ERROR GetBlock(uint64_t offset, uint16_t maxLength, const uint8_t *& data, uint16_t & length, bool & isEof) = 0;
+};
+
+/**
+ * A BlockSource for data held in a contiguous buffer, such as a memory-mapped file.
+ */
+class DLL_EXPORT BufferBlockSource : public BlockSource
+{
+public:
+    BufferBlockSource(const uint8_t * data, uint64_t length) : mData(data), mLength(length) {}
+
+    CHIP_ERROR GetBlock(uint64_t offset, uint16_t maxLength, const uint8_t *& data, uint16_t & length, bool & isEof) override;
+
+private:
+    const uint8_t * mData;
+    uint64_t mLength;
+};
+
+/**
+ * A BlockSource for data held in a PacketBuffer chain. A Block never spans two buffers of the chain, so Blocks are shorter
+ * than the maximum Block size where a buffer ends.
+ */
+class DLL_EXPORT PacketBufferBlockSource : public BlockSource
+{
+public:
+    explicit PacketBufferBlockSource(System::PacketBufferHandle && chain) : mChain(std::move(chain)) { Rewind(); }
+
+    CHIP_ERROR GetBlock(uint64_t offset, uint16_t maxLength, const uint8_t *& data, uint16_t & length, bool & isEof) override;
+
+private:
+    void Rewind();
+
+    System::PacketBufferHandle mChain;
+
+    // The buffer of the chain in which the last Block was found, and the offset of its data. Blocks are usually read in order,
+    // so the search for the next one starts there.
+    System::PacketBufferHandle mCurrent;
+    uint64_t mCurrentOffset = 0;
+};
+
+} // namespace bdx
+} // namespace chip
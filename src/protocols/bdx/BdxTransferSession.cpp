@@ -77,6 +77,12 @@ void TransferSession::PollOutput(OutputEvent & event, uint64_t curTimeMs)
         mShouldInitTimeoutStart = false;
     }
 
+    if (mShouldRestartRetransmit)
+    {
+        mRetransmitStartTimeMs   = curTimeMs;
+        mShouldRestartRetransmit = false;
+    }
+
     if (mAwaitingResponse && ((curTimeMs - mTimeoutStartTimeMs) >= mTimeoutMs))
     {
         event             = OutputEvent(OutputEventType::kTransferTimeout);
@@ -85,6 +91,13 @@ void TransferSession::PollOutput(OutputEvent & event, uint64_t curTimeMs)
         return;
     }
 
+    // A sender using a window sends the Blocks that were not acknowledged again when none was acknowledged for a while.
+    if (IsWindowed() && mRole == TransferRole::kSender && mNextBlockNum != mNextAckNum &&
+        mPendingOutput == OutputEventType::kNone && ((curTimeMs - mRetransmitStartTimeMs) >= mRetransmitTimeoutMs))
+    {
+        GoBackToFirstUnackedBlock();
+    }
+
     switch (mPendingOutput)
     {
     case OutputEventType::kNone:
@@ -97,9 +110,14 @@ void TransferSession::PollOutput(OutputEvent & event, uint64_t curTimeMs)
         event = OutputEvent::StatusReportEvent(OutputEventType::kStatusReceived, mStatusReportData);
         break;
     case OutputEventType::kMsgToSend:
-        event               = OutputEvent(OutputEventType::kMsgToSend);
-        event.MsgData       = std::move(mPendingMsgHandle);
-        mTimeoutStartTimeMs = curTimeMs;
+        event         = OutputEvent(OutputEventType::kMsgToSend);
+        event.MsgData = std::move(mPendingMsgHandle);
+        // A sender using a window keeps sending Blocks while it waits for BlockAcks, so only the messages it receives restart
+        // its timeout.
+        if (!(IsWindowed() && mRole == TransferRole::kSender))
+        {
+            mTimeoutStartTimeMs = curTimeMs;
+        }
         break;
     case OutputEventType::kInitReceived:
         event = OutputEvent::TransferInitEvent(mTransferRequestData, std::move(mPendingMsgHandle));
@@ -272,11 +290,41 @@ CHIP_ERROR TransferSession::PrepareBlockQuery()
 
 CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
 {
-    VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    // Blocks may have to be sent again when a window is used, which needs a BlockSource.
+    VerifyOrReturnError(CanPrepareBlock() && !IsWindowed(), CHIP_ERROR_INCORRECT_STATE);
+
+    return PrepareBlockMessage(inData);
+}
+
+CHIP_ERROR TransferSession::PrepareBlock(BlockSource & source)
+{
+    VerifyOrReturnError(CanPrepareBlock(), CHIP_ERROR_INCORRECT_STATE);
+
+    BlockData blockData;
+    ReturnErrorOnFailure(
+        source.GetBlock(mNextBlockOffset, mTransferMaxBlockSize, blockData.Data, blockData.Length, blockData.IsEof));
+
+    return PrepareBlockMessage(blockData);
+}
+
+bool TransferSession::CanPrepareBlock() const
+{
+    if ((mState != TransferState::kTransferInProgress) || (mRole != TransferRole::kSender) ||
+        (mPendingOutput != OutputEventType::kNone))
+    {
+        return false;
+    }
 
+    if (IsWindowed())
+    {
+        return (mNextBlockNum - mNextAckNum) < mWindowSize;
+    }
+
+    return !mAwaitingResponse;
+}
+
+CHIP_ERROR TransferSession::PrepareBlockMessage(const BlockData & inData)
+{
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
     VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
 
@@ -297,8 +345,24 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
         mState = TransferState::kAwaitingEOFAck;
     }
 
+    // The retransmit timer runs from the time the oldest Block in flight was sent, or was last acknowledged.
+    if (IsWindowed() && mNextBlockNum == mNextAckNum)
+    {
+        mShouldRestartRetransmit = true;
+    }
+
+    mBlockOffsets[mNextBlockNum % kMaxWindowSize] = mNextBlockOffset;
+    mNextBlockOffset += inData.Length;
+
+    // When Blocks are sent again, mLastBlockNum remains the highest Block counter sent.
+    if (mNextBlockNum >= mLastBlockNum)
+    {
+        mLastBlockNum      = mNextBlockNum;
+        mSentDataEndOffset = mNextBlockOffset;
+    }
+
     mAwaitingResponse = true;
-    mLastBlockNum     = mNextBlockNum++;
+    mNextBlockNum++;
 
     return CHIP_NO_ERROR;
 }
@@ -339,6 +403,21 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR TransferSession::SetWindow(uint8_t windowSize, uint32_t retransmitTimeoutMs)
+{
+    VerifyOrReturnError((mState == TransferState::kAwaitingInitMsg) || (mState == TransferState::kAwaitingAccept) ||
+                            (mState == TransferState::kNegotiateTransferParams),
+                        CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError((windowSize > 0) && (windowSize <= kMaxWindowSize), CHIP_ERROR_INVALID_ARGUMENT);
+    // Without a retransmit timeout, a sender would go back to the first unacknowledged Block on every poll.
+    VerifyOrReturnError((windowSize == 1) || (retransmitTimeoutMs > 0), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mWindowSize          = windowSize;
+    mRetransmitTimeoutMs = retransmitTimeoutMs;
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR TransferSession::AbortTransfer(StatusCode reason)
 {
     VerifyOrReturnError((mState != TransferState::kUnitialized) && (mState != TransferState::kTransferDone) &&
@@ -373,6 +452,15 @@ void TransferSession::Reset()
     mTimeoutStartTimeMs     = 0;
     mShouldInitTimeoutStart = true;
     mAwaitingResponse       = false;
+
+    mWindowSize              = 1;
+    mRetransmitTimeoutMs     = 0;
+    mNextAckNum              = 0;
+    mNextBlockOffset         = 0;
+    mSentDataEndOffset       = 0;
+    mRetransmitStartTimeMs   = 0;
+    mShouldRestartRetransmit = false;
+    mWentBackForAck          = false;
 }
 
 CHIP_ERROR TransferSession::HandleMessageReceived(System::PacketBufferHandle msg, uint64_t curTimeMs)
@@ -591,6 +679,8 @@ void TransferSession::HandleBlockQuery(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    // A sender using a window may send Blocks again until it receives the BlockAckEOF.
+    VerifyOrReturn(!(IsWindowed() && (mState == TransferState::kReceivedEOF || mState == TransferState::kTransferDone)));
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
@@ -598,6 +688,7 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     const CHIP_ERROR err = blockMsg.Parse(msgData.Retain());
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
+    VerifyOrReturn(!(IsWindowed() && blockMsg.BlockCounter != mLastQueryNum), PrepareDuplicateBlockAck());
     VerifyOrReturn(blockMsg.BlockCounter == mLastQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
     VerifyOrReturn((blockMsg.DataLength > 0) && (blockMsg.DataLength <= mTransferMaxBlockSize),
                    PrepareStatusReport(StatusCode::kBadMessageContents));
@@ -618,12 +709,22 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
     mNumBytesProcessed += blockMsg.DataLength;
     mLastBlockNum = blockMsg.BlockCounter;
 
-    mAwaitingResponse = false;
+    if (IsWindowed())
+    {
+        // BlockAcks are cumulative, so the next Block may be received before this one is acknowledged.
+        mLastQueryNum = mLastBlockNum + 1;
+    }
+    else
+    {
+        mAwaitingResponse = false;
+    }
 }
 
 void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    // A sender using a window may send Blocks again until it receives the BlockAckEOF.
+    VerifyOrReturn(!(IsWindowed() && (mState == TransferState::kReceivedEOF || mState == TransferState::kTransferDone)));
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
@@ -631,6 +732,7 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
     const CHIP_ERROR err = blockEOFMsg.Parse(msgData.Retain());
     VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
 
+    VerifyOrReturn(!(IsWindowed() && blockEOFMsg.BlockCounter != mLastQueryNum), PrepareDuplicateBlockAck());
     VerifyOrReturn(blockEOFMsg.BlockCounter == mLastQueryNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
     VerifyOrReturn(blockEOFMsg.DataLength <= mTransferMaxBlockSize, PrepareStatusReport(StatusCode::kBadMessageContents));
 
@@ -651,6 +753,13 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    if (IsWindowed())
+    {
+        HandleWindowedBlockAck(std::move(msgData));
+        return;
+    }
+
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
@@ -666,10 +775,49 @@ void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
     mAwaitingResponse = (mControlMode == TransferControlFlags::kReceiverDrive);
 }
 
+void TransferSession::HandleWindowedBlockAck(System::PacketBufferHandle msgData)
+{
+    VerifyOrReturn((mState == TransferState::kTransferInProgress) || (mState == TransferState::kAwaitingEOFAck),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    BlockAck ackMsg;
+    const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
+    VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+    VerifyOrReturn(ackMsg.BlockCounter <= mLastBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+    if (ackMsg.BlockCounter < mNextAckNum)
+    {
+        // The receiver acknowledges the last Block it received in order again when it drops a Block that is not the next one,
+        // so the Blocks sent after it have to be sent again. Only go back once: the other Blocks in flight will be dropped too.
+        if ((ackMsg.BlockCounter + 1 == mNextAckNum) && !mWentBackForAck && (mNextBlockNum != mNextAckNum))
+        {
+            GoBackToFirstUnackedBlock();
+            mWentBackForAck = true;
+        }
+        return;
+    }
+
+    mNextAckNum              = ackMsg.BlockCounter + 1;
+    mWentBackForAck          = false;
+    mShouldRestartRetransmit = true;
+
+    // Blocks acknowledged while going back do not have to be sent again.
+    if (mNextBlockNum < mNextAckNum)
+    {
+        mNextBlockOffset = GetBlockOffset(mNextAckNum);
+        mNextBlockNum    = mNextAckNum;
+    }
+
+    mPendingOutput    = OutputEventType::kAckReceived;
+    mAwaitingResponse = (mNextBlockNum != mNextAckNum);
+}
+
 void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
-    VerifyOrReturn(mState == TransferState::kAwaitingEOFAck, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    // A sender using a window may have gone back to Blocks before the BlockEOF when the BlockAckEOF arrives.
+    VerifyOrReturn(mState == TransferState::kAwaitingEOFAck || (IsWindowed() && mState == TransferState::kTransferInProgress),
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
     BlockAckEOF ackMsg;
@@ -787,6 +935,39 @@ bool TransferSession::IsTransferLengthDefinite()
     return (mTransferLength > 0);
 }
 
+void TransferSession::PrepareDuplicateBlockAck()
+{
+    // Before the first Block is received, there is nothing to acknowledge: the sender will send it again after its retransmit
+    // timeout.
+    VerifyOrReturn(mLastQueryNum > 0);
+
+    CounterMessage ackMsg;
+    ackMsg.BlockCounter = mLastBlockNum;
+
+    // The acknowledgement is only a hint for the sender, so it is not an error if it cannot be sent.
+    VerifyOrReturn(WriteToPacketBuffer(ackMsg, mPendingMsgHandle) == CHIP_NO_ERROR);
+    VerifyOrReturn(AttachHeader(MessageType::BlockAck, mPendingMsgHandle) == CHIP_NO_ERROR);
+
+    mPendingOutput = OutputEventType::kMsgToSend;
+}
+
+uint64_t TransferSession::GetBlockOffset(uint32_t blockNum) const
+{
+    return (blockNum == mLastBlockNum + 1) ? mSentDataEndOffset : mBlockOffsets[blockNum % kMaxWindowSize];
+}
+
+void TransferSession::GoBackToFirstUnackedBlock()
+{
+    mNextBlockOffset = GetBlockOffset(mNextAckNum);
+    mNextBlockNum    = mNextAckNum;
+
+    // The BlockEOF will be sent again.
+    if (mState == TransferState::kAwaitingEOFAck)
+    {
+        mState = TransferState::kTransferInProgress;
+    }
+}
+
 TransferSession::OutputEvent TransferSession::OutputEvent::TransferInitEvent(TransferInitData data, System::PacketBufferHandle msg)
 {
     OutputEvent event(OutputEventType::kInitReceived);
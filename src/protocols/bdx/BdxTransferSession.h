@@ -8,6 +8,7 @@
 #pragma once
 
 #include <core/CHIPError.h>
+#include <protocols/bdx/BdxBlockSource.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <system/SystemPacketBuffer.h>
 #include <transport/raw/MessageHeader.h>
@@ -205,6 +206,26 @@ public:
      */
     CHIP_ERROR PrepareBlock(const BlockData & inData);
 
+    /**
+     * @brief
+     *   Prepare a Block message with the next Block of data read from a BlockSource. The Block counter and the offset of the
+     *   Block in the transfer data are tracked automatically, so that the source is read without copying the data into a staging
+     *   buffer. This is the only way to prepare Blocks when a window of more than one Block is used (see SetWindow()).
+     *
+     * @param source Provides the data of the transfer
+     *
+     * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
+     *                    is unable to handle this request.
+     */
+    CHIP_ERROR PrepareBlock(BlockSource & source);
+
+    /**
+     * @brief
+     *   Indicates whether PrepareBlock() may be called now. With a window of more than one Block, this remains true until
+     *   the window is full of Blocks that have not been acknowledged.
+     */
+    bool CanPrepareBlock() const;
+
     /**
      * @brief
      *   Prepare a BlockAck message. The Block counter will be populated automatically.
@@ -214,6 +235,26 @@ public:
      */
     CHIP_ERROR PrepareBlockAck();
 
+    /**
+     * @brief
+     *   Allow the sender to have up to windowSize Blocks in flight in Sender Drive, instead of waiting for the BlockAck of each
+     *   Block before sending the next one, so that the throughput is not bound by one round trip per Block. Must be called after
+     *   StartTransfer() or WaitForTransfer(), before the transfer is accepted, and has no effect in Receiver Drive.
+     *
+     *   A BlockAck acknowledges all the Blocks up to its Block counter, so the receiver does not have to acknowledge each Block.
+     *   A receiver that enabled a window drops the Blocks that do not arrive in order, and acknowledges the last Block received
+     *   in order again, instead of ending the transfer with a BadBlockCounter error. The sender then goes back to the first
+     *   Block that was not acknowledged (go-back-N), which it also does when no Block was acknowledged for retransmitTimeoutMs.
+     *   BDX messages have no field to negotiate the window, so both the sender and the receiver must enable it.
+     *
+     * @param windowSize          Number of Blocks the sender may have in flight, up to kMaxWindowSize
+     * @param retransmitTimeoutMs Time after which the sender sends the unacknowledged Blocks again (milliseconds)
+     *
+     * @return CHIP_ERROR_INVALID_ARGUMENT if the window size is not supported, or if it is larger than 1 without a
+     *         retransmit timeout, CHIP_ERROR_INCORRECT_STATE if the transfer is already accepted.
+     */
+    CHIP_ERROR SetWindow(uint8_t windowSize, uint32_t retransmitTimeoutMs);
+
     /**
      * @brief
      *   Prematurely end a transfer with a StatusReport. Must still call Reset() to prepare the TransferSession for another
@@ -251,6 +292,8 @@ public:
 
     TransferSession();
 
+    static constexpr uint8_t kMaxWindowSize = 16;
+
 private:
     enum class TransferState : uint8_t
     {
@@ -275,6 +318,7 @@ private:
     void HandleBlock(System::PacketBufferHandle msgData);
     void HandleBlockEOF(System::PacketBufferHandle msgData);
     void HandleBlockAck(System::PacketBufferHandle msgData);
+    void HandleWindowedBlockAck(System::PacketBufferHandle msgData);
     void HandleBlockAckEOF(System::PacketBufferHandle msgData);
 
     /**
@@ -293,6 +337,12 @@ private:
     void PrepareStatusReport(StatusCode code);
     bool IsTransferLengthDefinite();
 
+    CHIP_ERROR PrepareBlockMessage(const BlockData & inData);
+    void PrepareDuplicateBlockAck();
+    bool IsWindowed() const { return mWindowSize > 1 && mControlMode == TransferControlFlags::kSenderDrive; }
+    uint64_t GetBlockOffset(uint32_t blockNum) const;
+    void GoBackToFirstUnackedBlock();
+
     OutputEventType mPendingOutput = OutputEventType::kNone;
     TransferState mState           = TransferState::kUnitialized;
     TransferRole mRole;
@@ -325,6 +375,18 @@ private:
     uint64_t mTimeoutStartTimeMs = 0;
     bool mShouldInitTimeoutStart = true;
     bool mAwaitingResponse       = false;
+
+    // Used by a sender to send Blocks read from a BlockSource, and to send them again when a window is used. The offsets of the
+    // Blocks in flight are indexed by Block counter modulo kMaxWindowSize.
+    uint8_t mWindowSize                    = 1;
+    uint32_t mRetransmitTimeoutMs          = 0;
+    uint32_t mNextAckNum                   = 0; ///< Counter of the first Block that has not been acknowledged
+    uint64_t mNextBlockOffset              = 0;
+    uint64_t mSentDataEndOffset            = 0; ///< Offset of the end of the Block with counter mLastBlockNum
+    uint64_t mBlockOffsets[kMaxWindowSize] = {};
+    uint64_t mRetransmitStartTimeMs        = 0;
+    bool mShouldRestartRetransmit          = false;
+    bool mWentBackForAck                   = false; ///< Went back after a duplicate BlockAck for mNextAckNum - 1
 };
 
 } // namespace bdx
@@ -0,0 +1,301 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Implementation of the OTAImageStore, for POSIX systems.
+ */
+
+#include <protocols/bdx/OTAImageStore.h>
+
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/logging/CHIPLogging.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+namespace bdx {
+
+OTAImage::~OTAImage()
+{
+    if (mData != nullptr)
+    {
+        munmap(const_cast<uint8_t *>(mData), static_cast<size_t>(mSize));
+    }
+}
+
+bool OTAImage::IsBefore(uint16_t vendorId, uint16_t productId, uint32_t version) const
+{
+    if (mVendorId != vendorId)
+    {
+        return mVendorId < vendorId;
+    }
+    if (mProductId != productId)
+    {
+        return mProductId < productId;
+    }
+    return mVersion < version;
+}
+
+void OTAImageSession::Close()
+{
+    VerifyOrReturn(mImage != nullptr);
+
+    if (mPrev != nullptr)
+    {
+        mPrev->mNext = mNext;
+    }
+    else
+    {
+        mImage->mFirstSession = mNext;
+    }
+    if (mNext != nullptr)
+    {
+        mNext->mPrev = mPrev;
+    }
+
+    mImage->mSessionCount--;
+    mImage = nullptr;
+    mPrev  = nullptr;
+    mNext  = nullptr;
+}
+
+bool OTAImageSession::IsBlockAllowed(uint64_t curTimeMs)
+{
+    VerifyOrReturnError(mImage != nullptr, false);
+    VerifyOrReturnError(mMaxBytesPerSecond > 0, true);
+
+    const int64_t maxAllowedBytes = static_cast<int64_t>(mMaxBytesPerSecond) * kRateLimitBurstMs / 1000;
+
+    if (mShouldInitRefillTime)
+    {
+        mLastRefillTimeMs     = curTimeMs;
+        mAllowedBytes         = maxAllowedBytes;
+        mShouldInitRefillTime = false;
+    }
+    else if (curTimeMs > mLastRefillTimeMs)
+    {
+        // Bound the elapsed time so that the refill cannot overflow.
+        uint64_t elapsedMs = curTimeMs - mLastRefillTimeMs;
+        if (elapsedMs > kMaxRefillTimeMs)
+        {
+            elapsedMs = kMaxRefillTimeMs;
+        }
+        const int64_t refill = static_cast<int64_t>(elapsedMs * mMaxBytesPerSecond / 1000);
+
+        // Only move the refill time forward when whole bytes were added, so that they are not lost when this is called more
+        // often than a byte is allowed.
+        if (refill > 0)
+        {
+            mAllowedBytes     = std::min(maxAllowedBytes, mAllowedBytes + refill);
+            mLastRefillTimeMs = curTimeMs;
+        }
+    }
+
+    return mAllowedBytes > 0;
+}
+
+CHIP_ERROR OTAImageSession::GetBlock(uint64_t offset, uint16_t maxLength, const uint8_t *& data, uint16_t & length, bool & isEof)
+{
+    VerifyOrReturnError(mImage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    const uint64_t size = mImage->mSize - mStartOffset;
+    VerifyOrReturnError(offset < size, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const uint64_t remaining = size - offset;
+
+    data   = mImage->mData + mStartOffset + offset;
+    length = (remaining < maxLength) ? static_cast<uint16_t>(remaining) : maxLength;
+    isEof  = (remaining <= maxLength);
+
+    if (mMaxBytesPerSecond > 0)
+    {
+        mAllowedBytes -= length;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStore::AddImage(const char * path, uint16_t vendorId, uint16_t productId, uint32_t version)
+{
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    VerifyOrReturnError(FindImage(vendorId, productId, version) == nullptr, CHIP_ERROR_DUPLICATE_KEY_ID);
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        ChipLogError(BDX, "Failed to open OTA image %s: %s", path, strerror(errno));
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    struct stat fileStat;
+    void * mapping = MAP_FAILED;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    }
+
+    // The mapping remains valid once the file is closed.
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        ChipLogError(BDX, "Failed to map OTA image %s", path);
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    OTAImage * image = chip::Platform::New<OTAImage>(vendorId, productId, version);
+    if (image == nullptr)
+    {
+        munmap(mapping, static_cast<size_t>(fileStat.st_size));
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    // Transfers read the image sequentially, from their own offset: read it ahead once for all of them.
+    madvise(mapping, static_cast<size_t>(fileStat.st_size), MADV_WILLNEED);
+
+    image->mData = static_cast<const uint8_t *>(mapping);
+    image->mSize = static_cast<uint64_t>(fileStat.st_size);
+
+    mImages.insert(LowerBound(vendorId, productId, version), image);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStore::RemoveImage(uint16_t vendorId, uint16_t productId, uint32_t version)
+{
+    const OTAImage * image = FindImage(vendorId, productId, version);
+    VerifyOrReturnError(image != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+    VerifyOrReturnError(image->mSessionCount == 0, CHIP_ERROR_INCORRECT_STATE);
+
+    auto it = LowerBound(vendorId, productId, version);
+    chip::Platform::Delete(*it);
+    mImages.erase(it);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStore::Clear()
+{
+    for (const OTAImage * image : mImages)
+    {
+        VerifyOrReturnError(image->mSessionCount == 0, CHIP_ERROR_INCORRECT_STATE);
+    }
+
+    for (OTAImage * image : mImages)
+    {
+        chip::Platform::Delete(image);
+    }
+    mImages.clear();
+
+    return CHIP_NO_ERROR;
+}
+
+OTAImageStore::~OTAImageStore()
+{
+    for (OTAImage * image : mImages)
+    {
+        if (image->mSessionCount != 0)
+        {
+            ChipLogError(BDX, "OTA image %" PRIu16 ":%" PRIu16 " v%" PRIu32 " removed while it is read", image->mVendorId,
+                         image->mProductId, image->mVersion);
+        }
+
+        while (image->mFirstSession != nullptr)
+        {
+            image->mFirstSession->Close();
+        }
+    }
+
+    Clear();
+}
+
+const OTAImage * OTAImageStore::FindImage(uint16_t vendorId, uint16_t productId, uint32_t version) const
+{
+    auto it = LowerBound(vendorId, productId, version);
+    if (it == mImages.end() || !(*it)->IsSameProduct(vendorId, productId) || (*it)->mVersion != version)
+    {
+        return nullptr;
+    }
+    return *it;
+}
+
+const OTAImage * OTAImageStore::FindUpdate(uint16_t vendorId, uint16_t productId, uint32_t currentVersion) const
+{
+    // The newest image of the product is the one with the highest version, or the one before the first image that comes after
+    // all the versions of the product.
+    auto it = LowerBound(vendorId, productId, UINT32_MAX);
+    if (it == mImages.end() || !(*it)->IsSameProduct(vendorId, productId))
+    {
+        VerifyOrReturnError(it != mImages.begin(), nullptr);
+        --it;
+    }
+
+    const OTAImage * image = *it;
+    if (!image->IsSameProduct(vendorId, productId) || image->mVersion <= currentVersion)
+    {
+        return nullptr;
+    }
+    return image;
+}
+
+CHIP_ERROR OTAImageStore::OpenSession(const OTAImage & image, uint64_t startOffset, uint32_t maxBytesPerSecond,
+                                      OTAImageSession & session)
+{
+    VerifyOrReturnError(!session.IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(FindImage(image.mVendorId, image.mProductId, image.mVersion) == &image, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(startOffset < image.mSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The images are owned by the store, which only hands out const references to them.
+    OTAImage & sessionImage = const_cast<OTAImage &>(image);
+
+    session.mImage                = &sessionImage;
+    session.mPrev                 = nullptr;
+    session.mNext                 = sessionImage.mFirstSession;
+    session.mStartOffset          = startOffset;
+    session.mMaxBytesPerSecond    = maxBytesPerSecond;
+    session.mAllowedBytes         = 0;
+    session.mShouldInitRefillTime = true;
+
+    if (sessionImage.mFirstSession != nullptr)
+    {
+        sessionImage.mFirstSession->mPrev = &session;
+    }
+    sessionImage.mFirstSession = &session;
+    sessionImage.mSessionCount++;
+
+    return CHIP_NO_ERROR;
+}
+
+OTAImageStore::ImageList::const_iterator OTAImageStore::LowerBound(uint16_t vendorId, uint16_t productId, uint32_t version) const
+{
+    return std::partition_point(mImages.begin(), mImages.end(),
+                                [&](const OTAImage * image) { return image->IsBefore(vendorId, productId, version); });
+}
+
+} // namespace bdx
+} // namespace chip
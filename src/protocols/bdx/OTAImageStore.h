@@ -0,0 +1,209 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a store of OTA software images for an OTA Provider running on a POSIX system. Images are
+ *      memory-mapped once and their Blocks are read in place by any number of concurrent BDX transfers.
+ */
+
+#pragma once
+
+#include <core/CHIPError.h>
+#include <protocols/bdx/BdxBlockSource.h>
+#include <support/DLLUtil.h>
+
+#include <stdint.h>
+#include <vector>
+
+namespace chip {
+namespace bdx {
+
+class OTAImageSession;
+class OTAImageStore;
+
+/**
+ * An OTA software image held by an OTAImageStore, identified by its vendor ID, product ID and software version.
+ */
+class DLL_EXPORT OTAImage
+{
+public:
+    /// An image without data. Images are only read by sessions once they are added to an OTAImageStore.
+    OTAImage(uint16_t vendorId, uint16_t productId, uint32_t version) :
+        mVendorId(vendorId), mProductId(productId), mVersion(version)
+    {}
+    OTAImage(const OTAImage &) = delete;
+    OTAImage & operator=(const OTAImage &) = delete;
+    ~OTAImage();
+
+    uint16_t GetVendorId() const { return mVendorId; }
+    uint16_t GetProductId() const { return mProductId; }
+    uint32_t GetVersion() const { return mVersion; }
+    uint64_t GetSize() const { return mSize; }
+    const uint8_t * GetData() const { return mData; }
+
+    /// Number of OTAImageSession objects reading the image.
+    uint32_t GetSessionCount() const { return mSessionCount; }
+
+private:
+    friend class OTAImageStore;
+    friend class OTAImageSession;
+
+    bool IsBefore(uint16_t vendorId, uint16_t productId, uint32_t version) const;
+    bool IsSameProduct(uint16_t vendorId, uint16_t productId) const { return mVendorId == vendorId && mProductId == productId; }
+
+    uint16_t mVendorId;
+    uint16_t mProductId;
+    uint32_t mVersion;
+    uint64_t mSize                  = 0;
+    const uint8_t * mData           = nullptr;
+    uint32_t mSessionCount          = 0;
+    OTAImageSession * mFirstSession = nullptr; ///< List of the sessions reading the image
+};
+
+/**
+ * The BlockSource of one BDX transfer of an OTAImage. Blocks are read directly from the memory-mapped image, and the rate at
+ * which they are read may be limited so that one transfer does not take all the bandwidth of a provider serving many
+ * requestors at once.
+ *
+ * The server only prepares the next Block when IsBlockAllowed() returns true, for example:
+ *
+ *     if (transfer.CanPrepareBlock() && session.IsBlockAllowed(curTimeMs))
+ *     {
+ *         transfer.PrepareBlock(session);
+ *     }
+ */
+class DLL_EXPORT OTAImageSession : public BlockSource
+{
+public:
+    OTAImageSession() = default;
+    OTAImageSession(const OTAImageSession &) = delete;
+    OTAImageSession & operator=(const OTAImageSession &) = delete;
+    ~OTAImageSession() override { Close(); }
+
+    /**
+     * @brief
+     *   Stop reading the image, so that it may be removed from the store. The session may then be opened again.
+     */
+    void Close();
+
+    bool IsOpen() const { return mImage != nullptr; }
+    const OTAImage * GetImage() const { return mImage; }
+
+    /**
+     * @brief
+     *   Indicates whether the rate limit allows the next Block to be read at the given time. The rate limit may be exceeded by
+     *   one Block, whose length is then deducted from the bytes allowed for the following Blocks.
+     *
+     * @param curTimeMs Current time (milliseconds), from the same clock as the one given to TransferSession::PollOutput()
+     */
+    bool IsBlockAllowed(uint64_t curTimeMs);
+
+    /**
+     * @brief
+     *   Provide a Block of the image. The offset is relative to the start offset given to OTAImageStore::OpenSession().
+     */
+    CHIP_ERROR GetBlock(uint64_t offset, uint16_t maxLength, const uint8_t *& data, uint16_t & length, bool & isEof) override;
+
+private:
+    friend class OTAImageStore;
+
+    // Bytes that may be read in a burst after the session was idle, in milliseconds of the rate limit.
+    static constexpr uint32_t kRateLimitBurstMs = 100;
+    static constexpr uint64_t kMaxRefillTimeMs  = 1000 * 1000 * 1000;
+
+    OTAImage * mImage           = nullptr;
+    OTAImageSession * mPrev     = nullptr; ///< Previous session reading the same image
+    OTAImageSession * mNext     = nullptr; ///< Next session reading the same image
+    uint64_t mStartOffset       = 0;
+    uint32_t mMaxBytesPerSecond = 0; ///< 0 when the rate is not limited
+    int64_t mAllowedBytes       = 0; ///< Bytes that may be read before the rate limit is reached, may be negative
+    uint64_t mLastRefillTimeMs  = 0;
+    bool mShouldInitRefillTime  = true;
+};
+
+/**
+ * A store of OTA software images, indexed by vendor ID, product ID and software version. Each image file is memory-mapped once
+ * when it is added, and all the sessions that read it share the mapping, so that a provider can send one image to many
+ * requestors without reading the file for each transfer.
+ *
+ * The store is not thread-safe: it must be used from the thread that runs the BDX transfers.
+ */
+class DLL_EXPORT OTAImageStore
+{
+public:
+    /// The sessions still open are closed, so that they fail to read Blocks rather than read unmapped images.
+    ~OTAImageStore();
+
+    /**
+     * @brief
+     *   Add an image file to the store, and memory-map it.
+     *
+     * @return CHIP_ERROR_DUPLICATE_KEY_ID if an image with the same vendor ID, product ID and version is already in the store,
+     *         CHIP_ERROR_OPEN_FAILED if the file cannot be mapped.
+     */
+    CHIP_ERROR AddImage(const char * path, uint16_t vendorId, uint16_t productId, uint32_t version);
+
+    /**
+     * @brief
+     *   Remove an image from the store, and unmap it.
+     *
+     * @return CHIP_ERROR_KEY_NOT_FOUND if the image is not in the store, CHIP_ERROR_INCORRECT_STATE if a session still reads
+     *         the image.
+     */
+    CHIP_ERROR RemoveImage(uint16_t vendorId, uint16_t productId, uint32_t version);
+
+    /**
+     * @brief
+     *   Remove all the images from the store, and unmap them.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if a session still reads an image, in which case no image is removed.
+     */
+    CHIP_ERROR Clear();
+
+    /// Find the image with the given vendor ID, product ID and version, or return nullptr.
+    const OTAImage * FindImage(uint16_t vendorId, uint16_t productId, uint32_t version) const;
+
+    /// Find the newest image for the given product, if it is newer than currentVersion, or return nullptr.
+    const OTAImage * FindUpdate(uint16_t vendorId, uint16_t productId, uint32_t currentVersion) const;
+
+    size_t GetImageCount() const { return mImages.size(); }
+
+    /**
+     * @brief
+     *   Open a session reading an image of the store for a BDX transfer.
+     *
+     * @param image             An image of the store
+     * @param startOffset       Offset in the image of the start of the transfer (the StartOffset of the transfer)
+     * @param maxBytesPerSecond Maximum rate at which the session reads the image, 0 for no limit
+     * @param session           The session to open, which must not already be open
+     */
+    CHIP_ERROR OpenSession(const OTAImage & image, uint64_t startOffset, uint32_t maxBytesPerSecond, OTAImageSession & session);
+
+private:
+    // Sorted by vendor ID, product ID and version. The images are allocated separately (with Platform::New) so that sessions
+    // may hold pointers to them while other images are added or removed.
+    using ImageList = std::vector<OTAImage *>;
+
+    ImageList::const_iterator LowerBound(uint16_t vendorId, uint16_t productId, uint32_t version) const;
+
+    ImageList mImages;
+};
+
+} // namespace bdx
+} // namespace chip
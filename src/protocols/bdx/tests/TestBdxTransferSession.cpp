@@ -2,10 +2,14 @@
 #include <protocols/bdx/BdxMessages.h>
 #include <protocols/bdx/BdxTransferSession.h>
 
+#include <algorithm>
+#include <stdio.h>
 #include <string.h>
+#include <vector>
 
 #include <nlunit-test.h>
 
+#include <core/CHIPEncoding.h>
 #include <core/CHIPTLV.h>
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/StatusReport.h>
@@ -720,6 +724,415 @@ void TestDuplicateBlockError(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+// Helper method for reading the Block counter of a Block, BlockEOF or BlockAck message.
+uint32_t GetBlockCounter(nlTestSuite * inSuite, const System::PacketBufferHandle & msg)
+{
+    uint16_t headerSize = 0;
+    PayloadHeader payloadHeader;
+
+    CHIP_ERROR err = payloadHeader.Decode(msg->Start(), msg->DataLength(), &headerSize);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, msg->DataLength() >= headerSize + sizeof(uint32_t));
+
+    return Encoding::LittleEndian::Get32(msg->Start() + headerSize);
+}
+
+// Helper method for initializing a Sender Drive transfer between two TransferSession objects that both use the given window.
+void InitWindowedTransfer(nlTestSuite * inSuite, void * inContext, TransferSession & sender, TransferSession & receiver,
+                          uint16_t blockSize, uint8_t windowSize, uint32_t retransmitTimeoutMs)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferControlFlags driveMode = TransferControlFlags::kSenderDrive;
+    uint32_t timeoutMs             = 1000 * 60;
+
+    BitFlags<TransferControlFlags> receiverOpts;
+    receiverOpts.Set(driveMode);
+
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = driveMode;
+    initOptions.MaxBlockSize     = blockSize;
+    char testFileDes[9]          = { "test.txt" };
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+
+    SendAndVerifyTransferInit(inSuite, inContext, outEvent, timeoutMs, sender, TransferRole::kSender, initOptions, receiver,
+                              receiverOpts, blockSize);
+
+    // A window of more than one Block needs a retransmit timeout.
+    NL_TEST_ASSERT(inSuite, sender.SetWindow(2, 0) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, sender.SetWindow(1, 0) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, sender.SetWindow(windowSize, retransmitTimeoutMs) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, receiver.SetWindow(windowSize, retransmitTimeoutMs) == CHIP_NO_ERROR);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode    = receiver.GetControlMode();
+    acceptData.MaxBlockSize   = blockSize;
+    acceptData.StartOffset    = 0; // not used in SendAccept
+    acceptData.Length         = 0; // not used in SendAccept
+    acceptData.Metadata       = nullptr;
+    acceptData.MetadataLength = 0;
+
+    SendAndVerifyAcceptMsg(inSuite, inContext, outEvent, receiver, TransferRole::kReceiver, acceptData, sender, initOptions);
+}
+
+// Helper method for preparing the next Block read from a BlockSource, and returning the message to send.
+System::PacketBufferHandle PrepareNextBlock(nlTestSuite * inSuite, TransferSession & sender, BlockSource & source,
+                                            uint64_t curTimeMs)
+{
+    TransferSession::OutputEvent outEvent;
+
+    CHIP_ERROR err = sender.PrepareBlock(source);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    sender.PollOutput(outEvent, curTimeMs);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kMsgToSend);
+
+    return std::move(outEvent.MsgData);
+}
+
+// Helper method for passing a Block message to a receiver, verifying that the Block is received and appending its data to
+// received.
+void ReceiveBlock(nlTestSuite * inSuite, TransferSession & receiver, System::PacketBufferHandle && msg, uint8_t * received,
+                  size_t receivedSize, size_t & receivedLen)
+{
+    TransferSession::OutputEvent outEvent;
+
+    CHIP_ERROR err = receiver.HandleMessageReceived(std::move(msg), kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    receiver.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kBlockReceived);
+    if (outEvent.EventType == TransferSession::OutputEventType::kBlockReceived &&
+        receivedLen + outEvent.blockdata.Length <= receivedSize)
+    {
+        memcpy(received + receivedLen, outEvent.blockdata.Data, outEvent.blockdata.Length);
+        receivedLen += outEvent.blockdata.Length;
+    }
+}
+
+// Test that the BlockSource implementations provide the Blocks at the requested offsets.
+void TestBlockSources(nlTestSuite * inSuite, void * inContext)
+{
+    uint8_t data[25];
+    const uint8_t * block = nullptr;
+    uint16_t length       = 0;
+    bool isEof            = false;
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    BufferBlockSource bufferSource(data, sizeof(data));
+    NL_TEST_ASSERT(inSuite, bufferSource.GetBlock(0, 10, block, length, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, block == data && length == 10 && !isEof);
+    NL_TEST_ASSERT(inSuite, bufferSource.GetBlock(20, 10, block, length, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, block == data + 20 && length == 5 && isEof);
+    NL_TEST_ASSERT(inSuite, bufferSource.GetBlock(25, 10, block, length, isEof) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    System::PacketBufferHandle chain = System::PacketBufferHandle::NewWithData(data, 15);
+    NL_TEST_ASSERT(inSuite, !chain.IsNull());
+    if (chain.IsNull())
+    {
+        return;
+    }
+    chain->AddToEnd(System::PacketBufferHandle::NewWithData(data + 15, 10));
+    NL_TEST_ASSERT(inSuite, chain->TotalLength() == sizeof(data));
+
+    // A Block never spans two buffers of the chain
+    PacketBufferBlockSource chainSource(std::move(chain));
+    NL_TEST_ASSERT(inSuite, chainSource.GetBlock(0, 10, block, length, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, length == 10 && !isEof && !memcmp(block, data, length));
+    NL_TEST_ASSERT(inSuite, chainSource.GetBlock(10, 10, block, length, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, length == 5 && !isEof && !memcmp(block, data + 10, length));
+    NL_TEST_ASSERT(inSuite, chainSource.GetBlock(15, 10, block, length, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, length == 10 && isEof && !memcmp(block, data + 15, length));
+
+    // Blocks of the first buffer can be read again
+    NL_TEST_ASSERT(inSuite, chainSource.GetBlock(5, 10, block, length, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, length == 10 && !isEof && !memcmp(block, data + 5, length));
+    NL_TEST_ASSERT(inSuite, chainSource.GetBlock(25, 10, block, length, isEof) == CHIP_ERROR_INVALID_ARGUMENT);
+}
+
+// Test that a sender using a window keeps several Blocks in flight, and goes back to the first Block that was not acknowledged
+// after a duplicate BlockAck or its retransmit timeout.
+void TestWindowedSenderDrive(nlTestSuite * inSuite, void * inContext)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    TransferSession::OutputEvent outEvent;
+    TransferSession sender;
+    TransferSession receiver;
+
+    // Chosen arbitrarily for this test
+    uint16_t blockSize           = 10;
+    uint32_t retransmitTimeoutMs = 100;
+    uint64_t curTimeMs           = 1000;
+
+    constexpr uint8_t kWindowSize = 4;
+    System::PacketBufferHandle blocks[kWindowSize];
+
+    uint8_t data[95];
+    uint8_t received[sizeof(data)] = { 0 };
+    size_t receivedLen             = 0;
+
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 7);
+    }
+    BufferBlockSource source(data, sizeof(data));
+
+    InitWindowedTransfer(inSuite, inContext, sender, receiver, blockSize, kWindowSize, retransmitTimeoutMs);
+
+    NL_TEST_ASSERT(inSuite, sender.SetWindow(2, retransmitTimeoutMs) == CHIP_ERROR_INCORRECT_STATE);
+
+    // The sender may have a full window of Blocks in flight
+    for (uint8_t i = 0; i < kWindowSize; i++)
+    {
+        NL_TEST_ASSERT(inSuite, sender.CanPrepareBlock());
+        blocks[i] = PrepareNextBlock(inSuite, sender, source, kNoAdvanceTime);
+        NL_TEST_ASSERT(inSuite, GetBlockCounter(inSuite, blocks[i]) == i);
+    }
+    NL_TEST_ASSERT(inSuite, !sender.CanPrepareBlock());
+    NL_TEST_ASSERT(inSuite, sender.PrepareBlock(source) == CHIP_ERROR_INCORRECT_STATE);
+
+    // Blocks 0 and 1 are acknowledged with a single BlockAck
+    ReceiveBlock(inSuite, receiver, std::move(blocks[0]), received, sizeof(received), receivedLen);
+    ReceiveBlock(inSuite, receiver, std::move(blocks[1]), received, sizeof(received), receivedLen);
+    SendAndVerifyBlockAck(inSuite, inContext, sender, receiver, outEvent, false);
+    NL_TEST_ASSERT(inSuite, sender.CanPrepareBlock());
+
+    // Block 2 is lost: the receiver drops Block 3 and acknowledges Block 1 again
+    blocks[2] = nullptr;
+    err       = receiver.HandleMessageReceived(std::move(blocks[3]), kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    receiver.PollOutput(outEvent, kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kMsgToSend);
+    VerifyBdxMessageType(inSuite, inContext, outEvent.MsgData, MessageType::BlockAck);
+    NL_TEST_ASSERT(inSuite, GetBlockCounter(inSuite, outEvent.MsgData) == 1);
+    VerifyNoMoreOutput(inSuite, inContext, receiver);
+
+    // The sender goes back to Block 2 without reporting the duplicate BlockAck
+    err = sender.HandleMessageReceived(std::move(outEvent.MsgData), kNoAdvanceTime);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    VerifyNoMoreOutput(inSuite, inContext, sender);
+    for (uint32_t blockNum = 2; blockNum < 4; blockNum++)
+    {
+        System::PacketBufferHandle block = PrepareNextBlock(inSuite, sender, source, kNoAdvanceTime);
+        NL_TEST_ASSERT(inSuite, GetBlockCounter(inSuite, block) == blockNum);
+        ReceiveBlock(inSuite, receiver, std::move(block), received, sizeof(received), receivedLen);
+    }
+    SendAndVerifyBlockAck(inSuite, inContext, sender, receiver, outEvent, false);
+
+    // Block 4 is lost, and no Block is acknowledged until the retransmit timeout, after which the sender goes back to Block 4
+    blocks[0] = PrepareNextBlock(inSuite, sender, source, curTimeMs);
+    NL_TEST_ASSERT(inSuite, GetBlockCounter(inSuite, blocks[0]) == 4);
+    blocks[0] = nullptr;
+    blocks[1] = PrepareNextBlock(inSuite, sender, source, curTimeMs);
+    NL_TEST_ASSERT(inSuite, GetBlockCounter(inSuite, blocks[1]) == 5);
+    blocks[1] = nullptr;
+    sender.PollOutput(outEvent, curTimeMs + retransmitTimeoutMs);
+    NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kNone);
+    blocks[0] = PrepareNextBlock(inSuite, sender, source, curTimeMs + retransmitTimeoutMs);
+    NL_TEST_ASSERT(inSuite, GetBlockCounter(inSuite, blocks[0]) == 4);
+    ReceiveBlock(inSuite, receiver, std::move(blocks[0]), received, sizeof(received), receivedLen);
+    SendAndVerifyBlockAck(inSuite, inContext, sender, receiver, outEvent, false);
+
+    // Send the rest of the data, acknowledging each window with a single BlockAck
+    while (receivedLen < sizeof(received) && sender.CanPrepareBlock())
+    {
+        while (sender.CanPrepareBlock())
+        {
+            ReceiveBlock(inSuite, receiver, PrepareNextBlock(inSuite, sender, source, kNoAdvanceTime), received, sizeof(received),
+                         receivedLen);
+        }
+        SendAndVerifyBlockAck(inSuite, inContext, sender, receiver, outEvent, receivedLen == sizeof(received));
+    }
+
+    NL_TEST_ASSERT(inSuite, receivedLen == sizeof(data));
+    NL_TEST_ASSERT(inSuite, !memcmp(received, data, sizeof(data)));
+    VerifyNoMoreOutput(inSuite, inContext, sender);
+    VerifyNoMoreOutput(inSuite, inContext, receiver);
+}
+
+namespace {
+// Parameters of the simulated link used to measure the throughput of Sender Drive transfers. Each message arrives half a
+// round trip after it is sent, and Blocks are also serialized at the link rate. A lost message arrives after a retransmission
+// by the reliable messaging layer (see CHIP_CONFIG_MRP_DEFAULT_ACTIVE_RETRY_INTERVAL).
+constexpr uint32_t kLinkBytesPerMs        = 125; // 1 Mbit/s
+constexpr uint32_t kRetransmitIntervalMs  = 300;
+constexpr uint64_t kMaxSimulatedTimeUs    = 600 * 1000 * 1000;
+constexpr uint16_t kSimulatedBlockSize    = 512;
+constexpr size_t kSimulatedTransferLength = 32 * 1024;
+
+// Messages in flight are copied out of their PacketBuffers, so that the size of the PacketBuffer pool does not limit the window.
+class SimulatedLink
+{
+public:
+    SimulatedLink(uint32_t rttMs, uint32_t lossInterval) : mRttMs(rttMs), mLossInterval(lossInterval) {}
+
+    // Every lossInterval-th message is lost (none if lossInterval is 0).
+    void Send(System::PacketBufferHandle && msg, bool toReceiver, uint64_t nowUs)
+    {
+        uint64_t departureUs = nowUs;
+        if (toReceiver)
+        {
+            mLinkFreeUs = std::max(mLinkFreeUs, nowUs) + msg->DataLength() * 1000u / kLinkBytesPerMs;
+            departureUs = mLinkFreeUs;
+        }
+
+        uint64_t arrivalUs = departureUs + mRttMs * 500u;
+        if (mLossInterval != 0 && (++mNumSent % mLossInterval) == 0)
+        {
+            arrivalUs += kRetransmitIntervalMs * 1000u;
+        }
+
+        mInFlight.push_back(Message{ arrivalUs, toReceiver, std::vector<uint8_t>(msg->Start(), msg->Start() + msg->DataLength()) });
+    }
+
+    // Returns the index of the message arriving first, or -1 if none is in flight.
+    int NextArrival() const
+    {
+        int next = -1;
+        for (size_t i = 0; i < mInFlight.size(); i++)
+        {
+            if (next < 0 || mInFlight[i].arrivalUs < mInFlight[static_cast<size_t>(next)].arrivalUs)
+            {
+                next = static_cast<int>(i);
+            }
+        }
+        return next;
+    }
+
+    struct Message
+    {
+        uint64_t arrivalUs;
+        bool toReceiver;
+        std::vector<uint8_t> data;
+    };
+
+    std::vector<Message> mInFlight;
+
+private:
+    uint32_t mRttMs;
+    uint32_t mLossInterval;
+    uint32_t mNumSent    = 0;
+    uint64_t mLinkFreeUs = 0;
+};
+} // anonymous namespace
+
+// Helper method for running a Sender Drive transfer of data over a SimulatedLink. Returns the time the transfer took, in
+// microseconds, and verifies that the receiver got all the data.
+uint64_t SimulateTransfer(nlTestSuite * inSuite, void * inContext, const uint8_t * data, size_t dataLen, uint8_t windowSize,
+                          uint32_t rttMs, uint32_t lossInterval)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession sender;
+    TransferSession receiver;
+    BufferBlockSource source(data, dataLen);
+    SimulatedLink link(rttMs, lossInterval);
+    std::vector<uint8_t> received;
+    uint64_t nowUs = 0;
+    bool done      = false;
+
+    InitWindowedTransfer(inSuite, inContext, sender, receiver, kSimulatedBlockSize, windowSize, rttMs + kRetransmitIntervalMs);
+
+    while (!done && nowUs < kMaxSimulatedTimeUs)
+    {
+        uint64_t nowMs = nowUs / 1000;
+
+        sender.PollOutput(outEvent, nowMs);
+        NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kNone);
+        while (sender.CanPrepareBlock())
+        {
+            NL_TEST_ASSERT(inSuite, sender.PrepareBlock(source) == CHIP_NO_ERROR);
+            sender.PollOutput(outEvent, nowMs);
+            NL_TEST_ASSERT(inSuite, outEvent.EventType == TransferSession::OutputEventType::kMsgToSend);
+            link.Send(std::move(outEvent.MsgData), true, nowUs);
+        }
+
+        int next = link.NextArrival();
+        if (next < 0 || link.mInFlight[static_cast<size_t>(next)].arrivalUs > nowUs)
+        {
+            // Wait for the next message, but let the sender check its retransmit timer every millisecond.
+            nowUs = (next < 0) ? nowUs + 1000 : std::min(nowUs + 1000, link.mInFlight[static_cast<size_t>(next)].arrivalUs);
+            continue;
+        }
+
+        SimulatedLink::Message message = std::move(link.mInFlight[static_cast<size_t>(next)]);
+        link.mInFlight.erase(link.mInFlight.begin() + next);
+        TransferSession & destination = message.toReceiver ? receiver : sender;
+
+        System::PacketBufferHandle msg = System::PacketBufferHandle::NewWithData(message.data.data(), message.data.size());
+        NL_TEST_ASSERT(inSuite, !msg.IsNull());
+        NL_TEST_ASSERT(inSuite, destination.HandleMessageReceived(std::move(msg), nowMs) == CHIP_NO_ERROR);
+        for (destination.PollOutput(outEvent, nowMs); outEvent.EventType != TransferSession::OutputEventType::kNone;
+             destination.PollOutput(outEvent, nowMs))
+        {
+            switch (outEvent.EventType)
+            {
+            case TransferSession::OutputEventType::kBlockReceived:
+                received.insert(received.end(), outEvent.blockdata.Data, outEvent.blockdata.Data + outEvent.blockdata.Length);
+                NL_TEST_ASSERT(inSuite, receiver.PrepareBlockAck() == CHIP_NO_ERROR);
+                break;
+            case TransferSession::OutputEventType::kMsgToSend:
+                link.Send(std::move(outEvent.MsgData), !message.toReceiver, nowUs);
+                break;
+            case TransferSession::OutputEventType::kAckReceived:
+                break;
+            case TransferSession::OutputEventType::kAckEOFReceived:
+                done = true;
+                break;
+            default:
+                NL_TEST_ASSERT(inSuite, false);
+                return nowUs;
+            }
+        }
+    }
+
+    NL_TEST_ASSERT(inSuite, done);
+    NL_TEST_ASSERT(inSuite, received.size() == dataLen && !memcmp(received.data(), data, dataLen));
+
+    return nowUs;
+}
+
+// Compare the throughput of Sender Drive transfers with and without a window, over links with various round trip times and loss
+// rates.
+void TestWindowedThroughput(nlTestSuite * inSuite, void * inContext)
+{
+    const uint32_t rttsMs[]        = { 10, 100, 300 };
+    const uint32_t lossIntervals[] = { 0, 20 };
+    const uint8_t windowSizes[]    = { 1, 4, TransferSession::kMaxWindowSize };
+
+    std::vector<uint8_t> data(kSimulatedTransferLength);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<uint8_t>(i * 31 + (i >> 8));
+    }
+
+    for (uint32_t rttMs : rttsMs)
+    {
+        for (uint32_t lossInterval : lossIntervals)
+        {
+            uint64_t durationsUs[sizeof(windowSizes)];
+
+            printf("RTT %3u ms, loss %2u%%:", rttMs, lossInterval ? 100 / lossInterval : 0);
+            for (size_t i = 0; i < sizeof(windowSizes); i++)
+            {
+                durationsUs[i] =
+                    SimulateTransfer(inSuite, inContext, data.data(), data.size(), windowSizes[i], rttMs, lossInterval);
+                printf("  window %2u %7.1f kB/s", windowSizes[i],
+                       static_cast<double>(data.size()) * 1000 / static_cast<double>(durationsUs[i]));
+            }
+            printf("\n");
+
+            // Without a window, the transfer takes at least one round trip per Block.
+            if (rttMs >= 100)
+            {
+                NL_TEST_ASSERT(inSuite, durationsUs[sizeof(windowSizes) - 1] < durationsUs[0]);
+            }
+        }
+    }
+}
+
 // Test Suite
 
 /**
@@ -733,6 +1146,9 @@ static const nlTest sTests[] =
     NL_TEST_DEF("TestBadAcceptMessageFields", TestBadAcceptMessageFields),
     NL_TEST_DEF("TestTimeout", TestTimeout),
     NL_TEST_DEF("TestDuplicateBlockError", TestDuplicateBlockError),
+    NL_TEST_DEF("TestBlockSources", TestBlockSources),
+    NL_TEST_DEF("TestWindowedSenderDrive", TestWindowedSenderDrive),
+    NL_TEST_DEF("TestWindowedThroughput", TestWindowedThroughput),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -0,0 +1,311 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/bdx/OTAImageStore.h>
+
+#include <nlunit-test.h>
+
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+using namespace ::chip;
+using namespace ::chip::bdx;
+
+namespace {
+
+constexpr uint16_t kVendorId  = 0xFFF1;
+constexpr uint16_t kProductId = 0x8001;
+
+// An image file filled with a pattern that depends on the offset, removed when the object is destroyed.
+class TestImageFile
+{
+public:
+    TestImageFile(size_t size, uint8_t seed)
+    {
+        strcpy(mPath, "/tmp/ota_image_XXXXXX");
+        int fd = mkstemp(mPath);
+        if (fd < 0)
+        {
+            mPath[0] = '\0';
+            return;
+        }
+
+        for (size_t i = 0; i < size; i++)
+        {
+            uint8_t byte = ExpectedByte(i, seed);
+            if (write(fd, &byte, 1) != 1)
+            {
+                break;
+            }
+        }
+        close(fd);
+    }
+
+    ~TestImageFile()
+    {
+        if (mPath[0] != '\0')
+        {
+            unlink(mPath);
+        }
+    }
+
+    static uint8_t ExpectedByte(size_t offset, uint8_t seed) { return static_cast<uint8_t>(offset * 13 + (offset >> 8) + seed); }
+
+    const char * GetPath() const { return mPath; }
+
+private:
+    char mPath[32];
+};
+
+void TestAddAndFindImages(nlTestSuite * inSuite, void * inContext)
+{
+    OTAImageStore store;
+    TestImageFile file1(100, 1);
+    TestImageFile file2(200, 2);
+    TestImageFile file3(300, 3);
+
+    NL_TEST_ASSERT(inSuite, store.AddImage(file2.GetPath(), kVendorId, kProductId, 2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.AddImage(file1.GetPath(), kVendorId, kProductId, 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.AddImage(file3.GetPath(), kVendorId, kProductId + 1, 7) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.AddImage(file3.GetPath(), kVendorId, kProductId, 2) == CHIP_ERROR_DUPLICATE_KEY_ID);
+    NL_TEST_ASSERT(inSuite, store.AddImage("/nonexistent/ota_image", kVendorId, kProductId, 3) == CHIP_ERROR_OPEN_FAILED);
+    NL_TEST_ASSERT(inSuite, store.GetImageCount() == 3);
+
+    const OTAImage * image = store.FindImage(kVendorId, kProductId, 2);
+    NL_TEST_ASSERT(inSuite, image != nullptr);
+    if (image != nullptr)
+    {
+        NL_TEST_ASSERT(inSuite, image->GetVersion() == 2 && image->GetSize() == 200);
+        NL_TEST_ASSERT(inSuite, image->GetData()[199] == TestImageFile::ExpectedByte(199, 2));
+    }
+    NL_TEST_ASSERT(inSuite, store.FindImage(kVendorId, kProductId, 3) == nullptr);
+    NL_TEST_ASSERT(inSuite, store.FindImage(kVendorId + 1, kProductId, 1) == nullptr);
+
+    // The newest image of the product is found, only if it is newer than the current version
+    image = store.FindUpdate(kVendorId, kProductId, 1);
+    NL_TEST_ASSERT(inSuite, image != nullptr && image->GetVersion() == 2);
+    NL_TEST_ASSERT(inSuite, store.FindUpdate(kVendorId, kProductId, 2) == nullptr);
+    image = store.FindUpdate(kVendorId, kProductId + 1, 0);
+    NL_TEST_ASSERT(inSuite, image != nullptr && image->GetVersion() == 7);
+    NL_TEST_ASSERT(inSuite, store.FindUpdate(kVendorId, kProductId - 1, 0) == nullptr);
+    NL_TEST_ASSERT(inSuite, store.FindUpdate(kVendorId, kProductId + 2, 0) == nullptr);
+
+    NL_TEST_ASSERT(inSuite, store.RemoveImage(kVendorId, kProductId, 2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.RemoveImage(kVendorId, kProductId, 2) == CHIP_ERROR_KEY_NOT_FOUND);
+    image = store.FindUpdate(kVendorId, kProductId, 0);
+    NL_TEST_ASSERT(inSuite, image != nullptr && image->GetVersion() == 1);
+}
+
+void TestConcurrentSessions(nlTestSuite * inSuite, void * inContext)
+{
+    OTAImageStore store;
+    TestImageFile file(1000, 5);
+    OTAImageSession sessions[3];
+    const uint8_t * data = nullptr;
+    uint16_t length      = 0;
+    bool isEof           = false;
+
+    NL_TEST_ASSERT(inSuite, store.AddImage(file.GetPath(), kVendorId, kProductId, 1) == CHIP_NO_ERROR);
+    const OTAImage * image = store.FindImage(kVendorId, kProductId, 1);
+    NL_TEST_ASSERT(inSuite, image != nullptr);
+    if (image == nullptr)
+    {
+        return;
+    }
+
+    // All the sessions read the same mapping, from their own start offset
+    for (size_t i = 0; i < ArraySize(sessions); i++)
+    {
+        NL_TEST_ASSERT(inSuite, store.OpenSession(*image, i * 100, 0, sessions[i]) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, store.OpenSession(*image, 0, 0, sessions[0]) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, image->GetSessionCount() == ArraySize(sessions));
+
+    for (size_t i = 0; i < ArraySize(sessions); i++)
+    {
+        NL_TEST_ASSERT(inSuite, sessions[i].GetBlock(0, 64, data, length, isEof) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, data == image->GetData() + i * 100 && length == 64 && !isEof);
+    }
+
+    NL_TEST_ASSERT(inSuite, sessions[2].GetBlock(768, 64, data, length, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, length == 32 && isEof && *data == TestImageFile::ExpectedByte(968, 5));
+    NL_TEST_ASSERT(inSuite, sessions[2].GetBlock(800, 64, data, length, isEof) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The image cannot be removed while it is read
+    NL_TEST_ASSERT(inSuite, store.RemoveImage(kVendorId, kProductId, 1) == CHIP_ERROR_INCORRECT_STATE);
+    for (auto & session : sessions)
+    {
+        session.Close();
+    }
+    NL_TEST_ASSERT(inSuite, image->GetSessionCount() == 0);
+    NL_TEST_ASSERT(inSuite, store.RemoveImage(kVendorId, kProductId, 1) == CHIP_NO_ERROR);
+}
+
+void TestClearWithOpenSessions(nlTestSuite * inSuite, void * inContext)
+{
+    TestImageFile file(100, 6);
+    OTAImageSession sessions[3];
+    const uint8_t * data = nullptr;
+    uint16_t length      = 0;
+    bool isEof           = false;
+
+    {
+        OTAImageStore store;
+        NL_TEST_ASSERT(inSuite, store.AddImage(file.GetPath(), kVendorId, kProductId, 1) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, store.AddImage(file.GetPath(), kVendorId, kProductId, 2) == CHIP_NO_ERROR);
+        const OTAImage * image = store.FindImage(kVendorId, kProductId, 1);
+        NL_TEST_ASSERT(inSuite, image != nullptr);
+        VerifyOrReturn(image != nullptr);
+
+        for (auto & session : sessions)
+        {
+            NL_TEST_ASSERT(inSuite, store.OpenSession(*image, 0, 0, session) == CHIP_NO_ERROR);
+        }
+
+        // The images cannot be removed while they are read
+        NL_TEST_ASSERT(inSuite, store.Clear() == CHIP_ERROR_INCORRECT_STATE);
+        NL_TEST_ASSERT(inSuite, store.GetImageCount() == 2);
+
+        // Sessions may be closed in any order
+        sessions[1].Close();
+        NL_TEST_ASSERT(inSuite, image->GetSessionCount() == 2);
+        NL_TEST_ASSERT(inSuite, sessions[0].GetBlock(0, 10, data, length, isEof) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, sessions[2].GetBlock(0, 10, data, length, isEof) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, store.OpenSession(*image, 10, 0, sessions[1]) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, image->GetSessionCount() == 3);
+
+        // Destroying the store closes the sessions still open
+    }
+
+    for (auto & session : sessions)
+    {
+        NL_TEST_ASSERT(inSuite, !session.IsOpen());
+        NL_TEST_ASSERT(inSuite, session.GetBlock(0, 10, data, length, isEof) == CHIP_ERROR_INCORRECT_STATE);
+        session.Close();
+    }
+
+    OTAImageStore store;
+    NL_TEST_ASSERT(inSuite, store.AddImage(file.GetPath(), kVendorId, kProductId, 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.Clear() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, store.GetImageCount() == 0);
+}
+
+void TestSessionRateLimit(nlTestSuite * inSuite, void * inContext)
+{
+    OTAImageStore store;
+    TestImageFile file(10000, 0);
+    OTAImageSession session;
+    const uint8_t * data = nullptr;
+    uint16_t length      = 0;
+    bool isEof           = false;
+    uint64_t offset      = 0;
+
+    NL_TEST_ASSERT(inSuite, store.AddImage(file.GetPath(), kVendorId, kProductId, 1) == CHIP_NO_ERROR);
+    const OTAImage * image = store.FindImage(kVendorId, kProductId, 1);
+    NL_TEST_ASSERT(inSuite, image != nullptr);
+    if (image == nullptr)
+    {
+        return;
+    }
+
+    // 1000 bytes per second allow a burst of 100 bytes, which may be exceeded by one Block
+    NL_TEST_ASSERT(inSuite, store.OpenSession(*image, 0, 1000, session) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, session.IsBlockAllowed(1000));
+    NL_TEST_ASSERT(inSuite, session.GetBlock(offset, 64, data, length, isEof) == CHIP_NO_ERROR);
+    offset += length;
+    NL_TEST_ASSERT(inSuite, session.IsBlockAllowed(1000));
+    NL_TEST_ASSERT(inSuite, session.GetBlock(offset, 64, data, length, isEof) == CHIP_NO_ERROR);
+    offset += length;
+    NL_TEST_ASSERT(inSuite, !session.IsBlockAllowed(1000));
+
+    // 128 bytes were read, so 28 bytes are owed: the next Block is allowed after 29 ms
+    NL_TEST_ASSERT(inSuite, !session.IsBlockAllowed(1028));
+    NL_TEST_ASSERT(inSuite, session.IsBlockAllowed(1029));
+
+    // Over a long transfer, the rate is 1000 bytes per second
+    uint64_t curTimeMs = 1029;
+    while (offset < 2000 + 128)
+    {
+        if (session.IsBlockAllowed(curTimeMs))
+        {
+            NL_TEST_ASSERT(inSuite, session.GetBlock(offset, 64, data, length, isEof) == CHIP_NO_ERROR);
+            offset += length;
+        }
+        curTimeMs++;
+    }
+    NL_TEST_ASSERT(inSuite, curTimeMs >= 2900 && curTimeMs <= 3100);
+
+    // Sessions without a limit are always allowed to read
+    OTAImageSession unlimited;
+    NL_TEST_ASSERT(inSuite, !unlimited.IsBlockAllowed(0));
+    NL_TEST_ASSERT(inSuite, store.OpenSession(*image, 0, 0, unlimited) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, unlimited.GetBlock(0, 10000, data, length, isEof) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, unlimited.IsBlockAllowed(0));
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestAddAndFindImages", TestAddAndFindImages),
+    NL_TEST_DEF("TestConcurrentSessions", TestConcurrentSessions),
+    NL_TEST_DEF("TestClearWithOpenSessions", TestClearWithOpenSessions),
+    NL_TEST_DEF("TestSessionRateLimit", TestSessionRateLimit),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestSetup(void * inContext)
+{
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    if (error != CHIP_NO_ERROR)
+        return FAILURE;
+    return SUCCESS;
+}
+
+int TestTeardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestOTAImageStore()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "Test-CHIP-OTAImageStore",
+        &sTests[0],
+        TestSetup,
+        TestTeardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestOTAImageStore)
@@ -30,6 +30,7 @@
 
 #include <core/CHIPEncoding.h>
 #include <core/CHIPSafeCasts.h>
+#include <messaging/ExchangeMgr.h>
 #include <protocols/Protocols.h>
 #include <support/BufferWriter.h>
 #include <support/CHIPMem.h>
@@ -70,6 +71,53 @@ using HKDF_sha_crypto = HKDF_sha;
 // The session establishment fails if the response is not received within timeout window.
 static constexpr ExchangeContext::Timeout kSigma_Response_Timeout = 10000;
 
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+/**
+ * Verifies the signature of a SigmaR2 or SigmaR3 message on a crypto worker thread. The job owns
+ * a copy of its inputs, so that the session can be cleared while the signature is being verified.
+ */
+class CASESession::SignatureVerifyJob : public CryptoWorkerPool::Job
+{
+public:
+    SignatureVerifyJob(CASESession * session, Protocols::SecureChannel::MsgType msgType, const P256PublicKey & key,
+                       const P256ECDSASignature & signature) :
+        mSession(session),
+        mMsgType(msgType), mKey(key), mSignature(signature)
+    {}
+
+    CHIP_ERROR SetMessage(const uint8_t * msg, size_t msgLen)
+    {
+        VerifyOrReturnError(mMsg.Alloc(msgLen), CHIP_ERROR_NO_MEMORY);
+        memcpy(mMsg.Get(), msg, msgLen);
+        mMsgLen = msgLen;
+        return CHIP_NO_ERROR;
+    }
+
+    void Run() override { mResult = mKey.ECDSA_validate_msg_signature(mMsg.Get(), mMsgLen, mSignature); }
+
+    void Complete() override
+    {
+        if (mSession != nullptr)
+        {
+            mSession->OnSignatureVerified(mMsgType, mResult);
+        }
+    }
+
+    // Reset by the session when it is cleared before the job is completed.
+    CASESession * mSession;
+
+private:
+    const Protocols::SecureChannel::MsgType mMsgType;
+    const P256PublicKey mKey;
+    const P256ECDSASignature mSignature;
+    chip::Platform::ScopedMemoryBuffer<uint8_t> mMsg;
+    size_t mMsgLen     = 0;
+    CHIP_ERROR mResult = CHIP_NO_ERROR;
+};
+
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
 CASESession::CASESession()
 {
     mTrustedRootId = CertificateKeyId();
@@ -94,6 +142,14 @@ void CASESession::Clear()
     mNextExpectedMsg = Protocols::SecureChannel::MsgType::CASE_SigmaErr;
     mCommissioningHash.Clear();
     mPairingComplete = false;
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+    if (mPendingSignatureVerify != nullptr)
+    {
+        // The job is owned by the crypto worker pool, which completes it later.
+        mPendingSignatureVerify->mSession = nullptr;
+        mPendingSignatureVerify           = nullptr;
+    }
+#endif
     mConnectionState.Reset();
     if (!mTrustedRootId.empty())
     {
@@ -571,6 +627,9 @@ exit:
 CHIP_ERROR CASESession::HandleSigmaR2_and_SendSigmaR3(const System::PacketBufferHandle & msg)
 {
     ReturnErrorOnFailure(HandleSigmaR2(msg));
+
+    // SigmaR3 is sent by OnSignatureVerified() if a crypto worker is verifying the SigmaR2 signature.
+    VerifyOrReturnError(!IsSignatureVerifyPending(), CHIP_NO_ERROR);
     ReturnErrorOnFailure(SendSigmaR3());
 
     return CHIP_NO_ERROR;
@@ -686,7 +745,8 @@ CHIP_ERROR CASESession::HandleSigmaR2(const System::PacketBufferHandle & msg)
         SuccessOrExit(err);
     }
 
-    err = remoteCredential.ECDSA_validate_msg_signature(msg_R2_Signed.Get(), msg_r2_signed_len, sigmaR2SignedData);
+    err = ValidateSignature(Protocols::SecureChannel::MsgType::CASE_SigmaR2, remoteCredential, msg_R2_Signed.Get(),
+                            msg_r2_signed_len, sigmaR2SignedData);
     SuccessOrExit(err);
 
 exit:
@@ -905,12 +965,32 @@ CHIP_ERROR CASESession::HandleSigmaR3(const System::PacketBufferHandle & msg)
         err = ConstructSignedCredentials(&buf, remoteDeviceOpCert, remoteDeviceOpCertLen, msg_R3_Span, sigmaR3SignedData, sigLen);
         SuccessOrExit(err);
     }
-    err = remoteCredential.ECDSA_validate_msg_signature(msg_R3_Signed.Get(), msg_r3_signed_len, sigmaR3SignedData);
+    err = ValidateSignature(Protocols::SecureChannel::MsgType::CASE_SigmaR3, remoteCredential, msg_R3_Signed.Get(),
+                            msg_r3_signed_len, sigmaR3SignedData);
     SuccessOrExit(err);
 
-    err = mCommissioningHash.Finish(mMessageDigest);
+    // The session is established by OnSignatureVerified() if a crypto worker is verifying the signature.
+    VerifyOrExit(!IsSignatureVerifyPending(), err = CHIP_NO_ERROR);
+
+    err = CompleteSigmaR3();
     SuccessOrExit(err);
 
+exit:
+    if (err == CHIP_ERROR_INVALID_SIGNATURE)
+    {
+        SendErrorMsg(SigmaErrorType::kInvalidSignature);
+    }
+    else if (err != CHIP_NO_ERROR)
+    {
+        SendErrorMsg(SigmaErrorType::kUnexpected);
+    }
+    return err;
+}
+
+CHIP_ERROR CASESession::CompleteSigmaR3()
+{
+    ReturnErrorOnFailure(mCommissioningHash.Finish(mMessageDigest));
+
     mPairingComplete = true;
 
     // Close the exchange, as no additional messages are expected from the peer
@@ -919,7 +999,47 @@ CHIP_ERROR CASESession::HandleSigmaR3(const System::PacketBufferHandle & msg)
     // Call delegate to indicate pairing completion
     mDelegate->OnSessionEstablished();
 
-exit:
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::ValidateSignature(Protocols::SecureChannel::MsgType msgType, const P256PublicKey & key,
+                                          const uint8_t * msg, size_t msgLen, const P256ECDSASignature & signature)
+{
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+    SecureSessionMgr * sessionMgr = (mExchangeCtxt != nullptr) ? mExchangeCtxt->GetExchangeMgr()->GetSessionMgr() : nullptr;
+    CryptoWorkerPool * workers    = (sessionMgr != nullptr) ? sessionMgr->GetCryptoWorkerPool() : nullptr;
+
+    if (workers != nullptr && !workers->IsFull())
+    {
+        SignatureVerifyJob * job = chip::Platform::New<SignatureVerifyJob>(this, msgType, key, signature);
+        VerifyOrReturnError(job != nullptr, CHIP_ERROR_NO_MEMORY);
+
+        CHIP_ERROR err = job->SetMessage(msg, msgLen);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = workers->Submit(job);
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            chip::Platform::Delete(job);
+            return err;
+        }
+
+        // No other message is expected until the signature is verified.
+        mPendingSignatureVerify = job;
+        mNextExpectedMsg        = Protocols::SecureChannel::MsgType::CASE_SigmaErr;
+        return CHIP_NO_ERROR;
+    }
+#endif
+
+    return key.ECDSA_validate_msg_signature(msg, msgLen, signature);
+}
+
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+void CASESession::OnSignatureVerified(Protocols::SecureChannel::MsgType msgType, CHIP_ERROR err)
+{
+    mPendingSignatureVerify = nullptr;
+
     if (err == CHIP_ERROR_INVALID_SIGNATURE)
     {
         SendErrorMsg(SigmaErrorType::kInvalidSignature);
@@ -928,8 +1048,27 @@ exit:
     {
         SendErrorMsg(SigmaErrorType::kUnexpected);
     }
-    return err;
+    else if (msgType == Protocols::SecureChannel::MsgType::CASE_SigmaR2)
+    {
+        err = SendSigmaR3();
+    }
+    else
+    {
+        err = CompleteSigmaR3();
+        if (err != CHIP_NO_ERROR)
+        {
+            SendErrorMsg(SigmaErrorType::kUnexpected);
+        }
+    }
+
+    // Call delegate to indicate session establishment failure, as OnMessageReceived() does for synchronous failures.
+    if (err != CHIP_NO_ERROR)
+    {
+        Clear();
+        mDelegate->OnSessionEstablishmentError(err);
+    }
 }
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
 
 void CASESession::SendErrorMsg(SigmaErrorType errorCode)
 {
@@ -1019,8 +1158,11 @@ CHIP_ERROR CASESession::Validate_and_RetrieveResponderID(const uint8_t ** msgIte
     ChipCertificateData * resultCert = nullptr;
 
     ChipCertificateSet certSet;
-    // Certificate set can contain up to 3 certs (NOC, ICA cert, and Root CA cert)
-    ReturnErrorOnFailure(certSet.Init(3, kMaxCHIPCertDecodeBufLength));
+    // Certificate set can contain up to 3 certs (NOC, ICA cert, and Root CA cert). Borrow its memory from the
+    // certificate decode pool, unless all the pool is in use.
+    CertificateDecodeHandle decodeState = CertificateDecodeHandle::Acquire();
+    ReturnErrorOnFailure(decodeState.IsNull() ? certSet.Init(3, kMaxCHIPCertDecodeBufLength)
+                                              : certSet.Init(std::move(decodeState)));
 
     responderOpCertLen = chip::Encoding::LittleEndian::Read16(*msgIterator);
     *responderOpCert   = *msgIterator;
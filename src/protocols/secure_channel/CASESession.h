@@ -38,6 +38,7 @@
 #include <protocols/secure_channel/SessionEstablishmentExchangeDispatch.h>
 #include <support/Base64.h>
 #include <system/SystemPacketBuffer.h>
+#include <transport/CryptoWorkerPool.h>
 #include <transport/PairingSession.h>
 #include <transport/PeerConnectionState.h>
 #include <transport/SecureSession.h>
@@ -231,6 +232,27 @@ private:
                                           P256ECDSASignature & signature, size_t sigLen);
     CHIP_ERROR ComputeIPK(const uint16_t sessionID, uint8_t * ipk, size_t ipkLen);
 
+    // Validate the signature of a SigmaR2 or SigmaR3 message. When the session manager has a crypto worker pool, the
+    // signature is verified by a worker thread, and the handling of the message continues in OnSignatureVerified().
+    CHIP_ERROR ValidateSignature(Protocols::SecureChannel::MsgType msgType, const P256PublicKey & key, const uint8_t * msg,
+                                 size_t msgLen, const P256ECDSASignature & signature);
+    CHIP_ERROR CompleteSigmaR3();
+
+    bool IsSignatureVerifyPending() const
+    {
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+        return mPendingSignatureVerify != nullptr;
+#else
+        return false;
+#endif
+    }
+
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+    class SignatureVerifyJob;
+
+    void OnSignatureVerified(Protocols::SecureChannel::MsgType msgType, CHIP_ERROR err);
+#endif
+
     void SendErrorMsg(SigmaErrorType errorCode);
 
     // This function always returns an error. The error value corresponds to the error in the received message.
@@ -272,6 +294,10 @@ private:
     Messaging::ExchangeContext * mExchangeCtxt = nullptr;
     SessionEstablishmentExchangeDispatch mMessageDispatch;
 
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+    SignatureVerifyJob * mPendingSignatureVerify = nullptr;
+#endif
+
     struct SigmaErrorMsg
     {
         SigmaErrorType error;
@@ -137,6 +137,21 @@ public:
      */
     static CHIP_ERROR GeneratePASEVerifier(PASEVerifier & verifier, bool useRandomPIN, uint32_t & setupPIN);
 
+    /**
+     * @brief
+     *   Compute the PASE verifier of a setup PIN code, salt and PBKDF2 iteration count.
+     *
+     * @param mySetUpPINCode   Setup PIN code
+     * @param pbkdf2IterCount  PBKDF2 iteration count
+     * @param salt             PBKDF2 salt
+     * @param saltLen          Length of the salt
+     * @param verifier         The computed PASE verifier
+     *
+     * @return CHIP_ERROR      The result of PASE verifier computation
+     */
+    static CHIP_ERROR ComputePASEVerifier(uint32_t mySetUpPINCode, uint32_t pbkdf2IterCount, const uint8_t * salt, size_t saltLen,
+                                          PASEVerifier & verifier);
+
     /**
      * @brief
      *   Derive a secure session from the paired session. The API will return error
@@ -246,9 +261,6 @@ private:
     CHIP_ERROR ValidateReceivedMessage(Messaging::ExchangeContext * exchange, const PacketHeader & packetHeader,
                                        const PayloadHeader & payloadHeader, System::PacketBufferHandle && msg);
 
-    static CHIP_ERROR ComputePASEVerifier(uint32_t mySetUpPINCode, uint32_t pbkdf2IterCount, const uint8_t * salt, size_t saltLen,
-                                          PASEVerifier & verifier);
-
     CHIP_ERROR SetupSpake2p(uint32_t pbkdf2IterCount, const uint8_t * salt, size_t saltLen);
 
     CHIP_ERROR SendPBKDFParamRequest();
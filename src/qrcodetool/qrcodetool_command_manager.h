@@ -37,6 +37,13 @@ qrcodetool_command_t commands[] = { { "generate-qr-code", setup_payload_operatio
                                       "[-f file-path]\n"
                                       "    -f File path of payload.\n",
                                       "Generate manual code from payload in text file." },
+
+                                    { "generate-batch", setup_payload_operation_generate_batch,
+                                      "-n count -o output-path [-f csv|tlv] [-j threads] [-i iterations] [-s salt-length]\n"
+                                      "    [-v vendor-id] [-p product-id] [-r rendezvous-flags]\n"
+                                      "    -n Number of records to generate.\n"
+                                      "    -o Path of the CSV or TLV file to write the records to.\n",
+                                      "Generate setup PIN codes, salts, PASE verifiers, QR and manual codes for many devices." },
                                     // Last one
                                     {} };
 
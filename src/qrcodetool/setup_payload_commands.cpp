@@ -17,11 +17,18 @@
 
 #include "setup_payload_commands.h"
 
+#include <setup_payload/SetupPayloadBatchGenerator.h>
 #include <setup_payload/SetupPayloadHelper.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <support/CHIPMem.h>
+#include <support/ErrorStr.h>
 #include <support/logging/CHIPLogging.h>
 #include <unistd.h>
 
+#include <chrono>
+#include <thread>
+
 using namespace chip;
 
 enum class SetupPayloadCodeType
@@ -93,3 +100,145 @@ extern int setup_payload_operation_generate_manual_code(int argc, char * const *
 
     return 2;
 }
+
+static bool _parseUInt(const char * str, unsigned long maxValue, unsigned long & value)
+{
+    char * end;
+    value = strtoul(str, &end, 0);
+    return *str != '\0' && *end == '\0' && value <= maxValue;
+}
+
+static int _generateBatch(size_t count, const SetupPayloadBatchGenerator::Params & params, const char * outputPath, bool tlv)
+{
+    SetupPayloadBatchGenerator generator;
+    CHIP_ERROR err = generator.Init(params);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipTool, "Invalid batch parameters: %s", ErrorStr(err));
+        return 2;
+    }
+
+    FILE * file = fopen(outputPath, tlv ? "wb" : "w");
+    if (file == nullptr)
+    {
+        ChipLogError(chipTool, "Unable to open %s", outputPath);
+        return 1;
+    }
+
+    SetupPayloadCSVWriter csvWriter(file);
+    SetupPayloadTLVWriter tlvWriter(file);
+    SetupPayloadRecordSink & sink = tlv ? static_cast<SetupPayloadRecordSink &>(tlvWriter) : csvWriter;
+
+    auto start = std::chrono::steady_clock::now();
+    err        = tlv ? CHIP_NO_ERROR : csvWriter.WriteHeader();
+    if (err == CHIP_NO_ERROR)
+    {
+        err = generator.Generate(count, sink);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (fclose(file) != 0 && err == CHIP_NO_ERROR)
+    {
+        err = CHIP_ERROR_WRITE_FAILED;
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipTool, "Batch generation failed: %s", ErrorStr(err));
+        return 1;
+    }
+
+    ChipLogDetail(chipTool, "Generated %zu records with %u thread(s) in %.3f s: %.0f records/s", count, params.threadCount,
+                  elapsed.count(), static_cast<double>(count) / elapsed.count());
+    return 0;
+}
+
+extern int setup_payload_operation_generate_batch(int argc, char * const * argv)
+{
+    ChipLogDetail(chipTool, "setup_payload_operation_generate_batch\n");
+
+    SetupPayloadBatchGenerator::Params params;
+    params.payload.rendezvousInformation = RendezvousInformationFlags(RendezvousInformationFlag::kBLE);
+
+    // Use all the cores by default.
+    params.threadCount = std::thread::hardware_concurrency();
+    if (params.threadCount == 0)
+    {
+        params.threadCount = 1;
+    }
+    else if (params.threadCount > SetupPayloadBatchGenerator::kMaxThreads)
+    {
+        params.threadCount = SetupPayloadBatchGenerator::kMaxThreads;
+    }
+
+    const char * outputPath = nullptr;
+    unsigned long count     = 0;
+    unsigned long value;
+    bool tlv = false;
+    int ch;
+
+    while ((ch = getopt(argc, argv, "n:o:f:j:i:s:v:p:r:")) != -1)
+    {
+        switch (ch)
+        {
+        case 'n':
+            if (!_parseUInt(optarg, SIZE_MAX, count))
+                return 2;
+            break;
+        case 'o':
+            outputPath = optarg;
+            break;
+        case 'f':
+            if (strcmp(optarg, "csv") != 0 && strcmp(optarg, "tlv") != 0)
+                return 2;
+            tlv = (strcmp(optarg, "tlv") == 0);
+            break;
+        case 'j':
+            if (!_parseUInt(optarg, SetupPayloadBatchGenerator::kMaxThreads, value))
+                return 2;
+            params.threadCount = static_cast<unsigned>(value);
+            break;
+        case 'i':
+            if (!_parseUInt(optarg, UINT32_MAX, value))
+                return 2;
+            params.iterationCount = static_cast<uint32_t>(value);
+            break;
+        case 's':
+            if (!_parseUInt(optarg, Crypto::kMax_Salt_Length, value))
+                return 2;
+            params.saltLength = static_cast<size_t>(value);
+            break;
+        case 'v':
+            if (!_parseUInt(optarg, UINT16_MAX, value))
+                return 2;
+            params.payload.vendorID = static_cast<uint16_t>(value);
+            break;
+        case 'p':
+            if (!_parseUInt(optarg, UINT16_MAX, value))
+                return 2;
+            params.payload.productID = static_cast<uint16_t>(value);
+            break;
+        case 'r':
+            if (!_parseUInt(optarg, UINT8_MAX, value))
+                return 2;
+            params.payload.rendezvousInformation.SetRaw(static_cast<uint8_t>(value));
+            break;
+        case '?':
+        default:
+            return 2;
+        }
+    }
+
+    if (count == 0 || outputPath == nullptr)
+    {
+        return 2;
+    }
+
+    if (Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        return 1;
+    }
+
+    int result = _generateBatch(count, params, outputPath, tlv);
+    Platform::MemoryShutdown();
+    return result;
+}
@@ -20,5 +20,6 @@
 
 extern int setup_payload_operation_generate_qr_code(int argc, char * const * argv);
 extern int setup_payload_operation_generate_manual_code(int argc, char * const * argv);
+extern int setup_payload_operation_generate_batch(int argc, char * const * argv);
 
 #endif
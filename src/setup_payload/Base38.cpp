@@ -31,6 +31,8 @@
 
 #include "Base38.h"
 
+#include <support/CodeUtils.h>
+
 #include <climits>
 
 namespace {
@@ -41,128 +43,146 @@ static const uint8_t kBase38CharactersNeededInNBytesChunk[] = { 2, 4, 5 };
 static const uint8_t kMaxBytesSingleChunkLen                = 3;
 static const uint8_t kRadix                                 = sizeof(kCodes) / sizeof(kCodes[0]);
 
-static inline CHIP_ERROR decodeChar(char c, uint8_t & value)
+static const uint8_t kBogus = 255;
+// map of base38 charater to numeric value
+// subtract 45 from the charater, then index into this array, if possible
+static const uint8_t kDecodes[] = {
+    36,     // '-', =45
+    37,     // '.', =46
+    kBogus, // '/', =47
+    0,      // '0', =48
+    1,      // '1', =49
+    2,      // '2', =50
+    3,      // '3', =51
+    4,      // '4', =52
+    5,      // '5', =53
+    6,      // '6', =54
+    7,      // '7', =55
+    8,      // '8', =56
+    9,      // '9', =57
+    kBogus, // ':', =58
+    kBogus, // ';', =59
+    kBogus, // '<', =50
+    kBogus, // '=', =61
+    kBogus, // '>', =62
+    kBogus, // '?', =63
+    kBogus, // '@', =64
+    10,     // 'A', =65
+    11,     // 'B', =66
+    12,     // 'C', =67
+    13,     // 'D', =68
+    14,     // 'E', =69
+    15,     // 'F', =70
+    16,     // 'G', =71
+    17,     // 'H', =72
+    18,     // 'I', =73
+    19,     // 'J', =74
+    20,     // 'K', =75
+    21,     // 'L', =76
+    22,     // 'M', =77
+    23,     // 'N', =78
+    24,     // 'O', =79
+    25,     // 'P', =80
+    26,     // 'Q', =81
+    27,     // 'R', =82
+    28,     // 'S', =83
+    29,     // 'T', =84
+    30,     // 'U', =85
+    31,     // 'V', =86
+    32,     // 'W', =87
+    33,     // 'X', =88
+    34,     // 'Y', =89
+    35,     // 'Z', =90
+};
+
+// Chunk values are below 2^24: over that range, multiplying by 2^37 / kRadix rounded up, then shifting
+// the result right by 37 bits, gives the exact quotient of the division by kRadix. This is cheaper than
+// a division, and maps onto a 32 x 32 -> 64 bits multiplication where vector units have one.
+static const uint64_t kRadixReciprocal      = 0xD79435E6;
+static const unsigned kRadixReciprocalShift = 37;
+
+static inline uint32_t divideByRadix(uint32_t value)
 {
-    static const int kBogus = 255;
-    // map of base38 charater to numeric value
-    // subtract 45 from the charater, then index into this array, if possible
-    const uint8_t decodes[] = {
-        36,     // '-', =45
-        37,     // '.', =46
-        kBogus, // '/', =47
-        0,      // '0', =48
-        1,      // '1', =49
-        2,      // '2', =50
-        3,      // '3', =51
-        4,      // '4', =52
-        5,      // '5', =53
-        6,      // '6', =54
-        7,      // '7', =55
-        8,      // '8', =56
-        9,      // '9', =57
-        kBogus, // ':', =58
-        kBogus, // ';', =59
-        kBogus, // '<', =50
-        kBogus, // '=', =61
-        kBogus, // '>', =62
-        kBogus, // '?', =63
-        kBogus, // '@', =64
-        10,     // 'A', =65
-        11,     // 'B', =66
-        12,     // 'C', =67
-        13,     // 'D', =68
-        14,     // 'E', =69
-        15,     // 'F', =70
-        16,     // 'G', =71
-        17,     // 'H', =72
-        18,     // 'I', =73
-        19,     // 'J', =74
-        20,     // 'K', =75
-        21,     // 'L', =76
-        22,     // 'M', =77
-        23,     // 'N', =78
-        24,     // 'O', =79
-        25,     // 'P', =80
-        26,     // 'Q', =81
-        27,     // 'R', =82
-        28,     // 'S', =83
-        29,     // 'T', =84
-        30,     // 'U', =85
-        31,     // 'V', =86
-        32,     // 'W', =87
-        33,     // 'X', =88
-        34,     // 'Y', =89
-        35,     // 'Z', =90
-    };
-    if (c < '-' || c > 'Z')
-    {
-        return CHIP_ERROR_INVALID_INTEGER_VALUE;
-    }
-    uint8_t v = decodes[c - '-'];
-    if (v == kBogus)
+    return static_cast<uint32_t>((value * kRadixReciprocal) >> kRadixReciprocalShift);
+}
+
+static inline void encodeChunk(uint32_t value, uint8_t characters, char * out)
+{
+    for (uint8_t character = 0; character < characters; character++)
     {
-        return CHIP_ERROR_INVALID_INTEGER_VALUE;
+        const uint32_t quotient = divideByRadix(value);
+        out[character]          = kCodes[value - quotient * kRadix];
+        value                   = quotient;
     }
-    value = v;
-    return 0;
 }
 
-} // unnamed namespace
-
-namespace chip {
-
-std::string base38Encode(const uint8_t * buf, size_t buf_len)
+// Encodes buf_len bytes into base38EncodedLength(buf_len) characters, without NUL terminator.
+static void encodeItem(const uint8_t * buf, size_t buf_len, char * out)
 {
-    std::string result;
+    static_assert(sizeof(uint32_t) * CHAR_BIT >= kMaxBytesSingleChunkLen * 8, "value might overflow");
 
-    while (buf_len > 0)
+    // Full chunks always take the same number of characters: encode them without branches on the length.
+    for (; buf_len >= kMaxBytesSingleChunkLen; buf_len -= kMaxBytesSingleChunkLen, buf += kMaxBytesSingleChunkLen)
     {
-        uint32_t value = 0;
-        static_assert(sizeof(value) * CHAR_BIT >= kMaxBytesSingleChunkLen * 8, "value might overflow");
-
-        size_t bytesInChunk = (buf_len >= kMaxBytesSingleChunkLen) ? kMaxBytesSingleChunkLen : buf_len;
+        encodeChunk(static_cast<uint32_t>(buf[0] | (buf[1] << 8) | (buf[2] << 16)),
+                    kBase38CharactersNeededInNBytesChunk[kMaxBytesSingleChunkLen - 1], out);
+        out += kBase38CharactersNeededInNBytesChunk[kMaxBytesSingleChunkLen - 1];
+    }
 
-        for (uint8_t byte = 0; byte < bytesInChunk; byte++)
+    if (buf_len > 0)
+    {
+        uint32_t value = 0;
+        for (uint8_t byte = 0; byte < buf_len; byte++)
         {
             value += static_cast<uint32_t>(buf[byte] << (8 * byte));
         }
-        buf_len -= bytesInChunk;
-        buf += bytesInChunk;
 
         // Without code length optimization there is constant characters number needed for specific chunk size.
-        const int base38CharactersNeeded = kBase38CharactersNeededInNBytesChunk[bytesInChunk - 1];
-
-        for (uint8_t character = 0; character < base38CharactersNeeded; character++)
-        {
-            result += kCodes[value % kRadix];
-            value /= kRadix;
-        }
+        encodeChunk(value, kBase38CharactersNeededInNBytesChunk[buf_len - 1], out);
     }
-    return result;
 }
 
-CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
+// Decodes the characters of a chunk, most significant first. Invalid characters are flagged
+// in a mask rather than returned from, so that the loop has no branch.
+static inline uint32_t decodeChunk(const char * chunk, uint8_t characters, bool & invalidCharacter)
 {
-    result.clear();
+    uint32_t value = 0;
+    uint8_t bogus  = 0;
+
+    for (int i = characters - 1; i >= 0; i--)
+    {
+        const uint8_t index = static_cast<uint8_t>(chunk[i] - '-');
+        const uint8_t v     = (index < sizeof(kDecodes)) ? kDecodes[index] : kBogus;
+
+        bogus |= static_cast<uint8_t>(v == kBogus);
+        value = value * kRadix + (v & 0x3F);
+    }
+
+    invalidCharacter = (bogus != 0);
+    return value;
+}
 
-    int base38CharactersNumber  = static_cast<int>(base38.length());
-    int decodedBase38Characters = 0;
-    while (base38CharactersNumber > 0)
+// Decodes str_len characters into base38DecodedLength(str_len) bytes, chunk by chunk: the error
+// returned is the one of the first invalid chunk, or of an invalid length once all the chunks
+// before it decoded.
+static CHIP_ERROR decodeItem(const char * str, size_t str_len, uint8_t * out)
+{
+    while (str_len > 0)
     {
         uint8_t base38CharactersInChunk;
         uint8_t bytesInDecodedChunk;
 
-        if (base38CharactersNumber >= kBase38CharactersNeededInNBytesChunk[2])
+        if (str_len >= kBase38CharactersNeededInNBytesChunk[2])
         {
             base38CharactersInChunk = kBase38CharactersNeededInNBytesChunk[2];
             bytesInDecodedChunk     = 3;
         }
-        else if (base38CharactersNumber == kBase38CharactersNeededInNBytesChunk[1])
+        else if (str_len == kBase38CharactersNeededInNBytesChunk[1])
         {
             base38CharactersInChunk = kBase38CharactersNeededInNBytesChunk[1];
             bytesInDecodedChunk     = 2;
         }
-        else if (base38CharactersNumber == kBase38CharactersNeededInNBytesChunk[0])
+        else if (str_len == kBase38CharactersNeededInNBytesChunk[0])
         {
             base38CharactersInChunk = kBase38CharactersNeededInNBytesChunk[0];
             bytesInDecodedChunk     = 1;
@@ -172,36 +192,90 @@ CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
             return CHIP_ERROR_INVALID_STRING_LENGTH;
         }
 
-        uint32_t value = 0;
+        bool invalidCharacter;
+        uint32_t value = decodeChunk(str, base38CharactersInChunk, invalidCharacter);
+        VerifyOrReturnError(!invalidCharacter, CHIP_ERROR_INVALID_INTEGER_VALUE);
 
-        for (int i = (base38CharactersInChunk - 1); i >= 0; i--)
+        // encoded value is too big to represent a correct chunk of size 1, 2 or 3 bytes
+        VerifyOrReturnError((value >> (8 * bytesInDecodedChunk)) == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+        for (uint8_t i = 0; i < bytesInDecodedChunk; i++)
         {
-            uint8_t v;
-            CHIP_ERROR err = decodeChar(base38[static_cast<uint8_t>(decodedBase38Characters + i)], v);
+            *out++ = static_cast<uint8_t>(value);
+            value >>= 8;
+        }
 
-            if (err != CHIP_NO_ERROR)
-            {
-                return err;
-            }
+        str += base38CharactersInChunk;
+        str_len -= base38CharactersInChunk;
+    }
 
-            value = value * kRadix + v;
-        }
-        decodedBase38Characters += base38CharactersInChunk;
-        base38CharactersNumber -= base38CharactersInChunk;
+    return CHIP_NO_ERROR;
+}
+
+} // unnamed namespace
+
+namespace chip {
+
+std::string base38Encode(const uint8_t * buf, size_t buf_len)
+{
+    std::string result(base38EncodedLength(buf_len), '\0');
+
+    encodeItem(buf, buf_len, &result[0]);
+    return result;
+}
+
+CHIP_ERROR base38Encode(const uint8_t * buf, size_t buf_len, char * out, size_t out_size)
+{
+    return base38EncodeBatch(buf, buf_len, buf_len, 1, out, out_size);
+}
+
+CHIP_ERROR base38EncodeBatch(const uint8_t * in, size_t in_stride, size_t buf_len, size_t count, char * out, size_t out_stride)
+{
+    const size_t encodedLength = base38EncodedLength(buf_len);
+    VerifyOrReturnError(out_stride > encodedLength, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    for (size_t item = 0; item < count; item++, in += in_stride, out += out_stride)
+    {
+        encodeItem(in, buf_len, out);
+        out[encodedLength] = '\0';
+    }
 
-        for (int i = 0; i < bytesInDecodedChunk; i++)
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & result)
+{
+    result.resize(base38DecodedLength(base38.length()));
+
+    CHIP_ERROR err = decodeItem(base38.data(), base38.length(), result.data());
+    if (err != CHIP_NO_ERROR)
+    {
+        result.clear();
+    }
+    return err;
+}
+
+CHIP_ERROR base38DecodeBatch(const char * in, size_t in_stride, size_t str_len, size_t count, uint8_t * out, size_t out_stride,
+                             CHIP_ERROR * statuses)
+{
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+
+    VerifyOrReturnError(out_stride >= base38DecodedLength(str_len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    for (size_t item = 0; item < count; item++, in += in_stride, out += out_stride)
+    {
+        CHIP_ERROR err = decodeItem(in, str_len, out);
+        if (statuses != nullptr)
         {
-            result.push_back(static_cast<uint8_t>(value));
-            value >>= 8;
+            statuses[item] = err;
         }
-
-        if (value > 0)
+        if (firstError == CHIP_NO_ERROR)
         {
-            // encoded value is too big to represent a correct chunk of size 1, 2 or 3 bytes
-            return CHIP_ERROR_INVALID_ARGUMENT;
+            firstError = err;
         }
     }
-    return CHIP_NO_ERROR;
+
+    return firstError;
 }
 
 } // namespace chip
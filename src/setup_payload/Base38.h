@@ -33,4 +33,33 @@ namespace chip {
 CHIP_ERROR base38Decode(std::string base38, std::vector<uint8_t> & out);
 std::string base38Encode(const uint8_t * buf, size_t buf_len);
 
+// returns the number of base38 characters needed to encode buf_len bytes
+constexpr size_t base38EncodedLength(size_t buf_len)
+{
+    return (buf_len / 3) * 5 + (buf_len % 3) * 2;
+}
+
+// encodes buf_len bytes into out, followed by a NUL terminator, without any allocation;
+// returns CHIP_ERROR_BUFFER_TOO_SMALL if out_size is less than base38EncodedLength(buf_len) + 1
+CHIP_ERROR base38Encode(const uint8_t * buf, size_t buf_len, char * out, size_t out_size);
+
+// returns the number of bytes decoded from str_len base38 characters, for the lengths an encoding can have
+constexpr size_t base38DecodedLength(size_t str_len)
+{
+    return (str_len / 5) * 3 + (str_len % 5) / 2;
+}
+
+// Batched kernels, which process many items of the same length in one call, e.g. the payloads of a
+// production batch or of a stack of scanned QR codes. Item i is read at in + i * in_stride and written
+// at out + i * out_stride. Results are identical to the ones of the single item functions.
+
+// encodes count items of buf_len bytes, each followed by a NUL terminator;
+// returns CHIP_ERROR_BUFFER_TOO_SMALL if out_stride is less than base38EncodedLength(buf_len) + 1
+CHIP_ERROR base38EncodeBatch(const uint8_t * in, size_t in_stride, size_t buf_len, size_t count, char * out, size_t out_stride);
+
+// decodes count items of str_len characters into base38DecodedLength(str_len) bytes each;
+// stores the status of each item into statuses, if not null, and returns the first error
+CHIP_ERROR base38DecodeBatch(const char * in, size_t in_stride, size_t str_len, size_t count, uint8_t * out, size_t out_stride,
+                             CHIP_ERROR * statuses = nullptr);
+
 } // namespace chip
@@ -25,7 +25,9 @@
 
 #include <inttypes.h>
 #include <limits>
+#include <stdio.h>
 
+#include <support/CodeUtils.h>
 #include <support/logging/CHIPLogging.h>
 #include <support/verhoeff/Verhoeff.h>
 
@@ -87,24 +89,29 @@ static uint32_t chunk3PayloadRepresentation(const SetupPayload & payload)
     return result;
 }
 
-// TODO: issue #3663 - Unbounded stack in src/setup_payload
-#if !defined(__clang__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstack-usage="
-#endif
-
-static std::string decimalStringWithPadding(uint32_t number, int minLength)
+// Writes number with leading zeros over exactly length characters of buf, if it fits.
+static CHIP_ERROR appendDecimalWithPadding(char * buf, size_t bufSize, size_t & offset, uint32_t number, int length)
 {
-    char buf[minLength + 1];
-    snprintf(buf, sizeof(buf), "%0*" PRIu32, minLength, number);
-    return std::string(buf);
-}
+    VerifyOrReturnError(offset + static_cast<size_t>(length) < bufSize, CHIP_ERROR_BUFFER_TOO_SMALL);
 
-#if !defined(__clang__)
-#pragma GCC diagnostic pop
-#endif
+    int written = snprintf(buf + offset, bufSize - offset, "%0*" PRIu32, length, number);
+    VerifyOrReturnError(written == length, CHIP_ERROR_INVALID_INTEGER_VALUE);
+
+    offset += static_cast<size_t>(written);
+    return CHIP_NO_ERROR;
+}
 
 CHIP_ERROR ManualSetupPayloadGenerator::payloadDecimalStringRepresentation(std::string & outDecimalString)
+{
+    char decimalString[kManualSetupCodeBufferSize];
+
+    ReturnErrorOnFailure(payloadDecimalStringRepresentation(decimalString, sizeof(decimalString)));
+
+    outDecimalString = decimalString;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ManualSetupPayloadGenerator::payloadDecimalStringRepresentation(char * outDecimalString, size_t outDecimalStringSize)
 {
     if (!mSetupPayload.isValidManualCode())
     {
@@ -125,18 +132,25 @@ CHIP_ERROR ManualSetupPayloadGenerator::payloadDecimalStringRepresentation(std::
     uint32_t chunk2 = chunk2PayloadRepresentation(mSetupPayload);
     uint32_t chunk3 = chunk3PayloadRepresentation(mSetupPayload);
 
-    std::string decimalString = decimalStringWithPadding(chunk1, kManualSetupCodeChunk1CharLength);
-    decimalString += decimalStringWithPadding(chunk2, kManualSetupCodeChunk2CharLength);
-    decimalString += decimalStringWithPadding(chunk3, kManualSetupCodeChunk3CharLength);
+    size_t offset = 0;
+    ReturnErrorOnFailure(appendDecimalWithPadding(outDecimalString, outDecimalStringSize, offset, chunk1,
+                                                  kManualSetupCodeChunk1CharLength));
+    ReturnErrorOnFailure(appendDecimalWithPadding(outDecimalString, outDecimalStringSize, offset, chunk2,
+                                                  kManualSetupCodeChunk2CharLength));
+    ReturnErrorOnFailure(appendDecimalWithPadding(outDecimalString, outDecimalStringSize, offset, chunk3,
+                                                  kManualSetupCodeChunk3CharLength));
 
     if (mSetupPayload.commissioningFlow == CommissioningFlow::kCustom)
     {
-        decimalString += decimalStringWithPadding(mSetupPayload.vendorID, kManualSetupVendorIdCharLength);
-        decimalString += decimalStringWithPadding(mSetupPayload.productID, kManualSetupProductIdCharLength);
+        ReturnErrorOnFailure(appendDecimalWithPadding(outDecimalString, outDecimalStringSize, offset, mSetupPayload.vendorID,
+                                                      kManualSetupVendorIdCharLength));
+        ReturnErrorOnFailure(appendDecimalWithPadding(outDecimalString, outDecimalStringSize, offset, mSetupPayload.productID,
+                                                      kManualSetupProductIdCharLength));
     }
-    decimalString += Verhoeff10::ComputeCheckChar(decimalString.c_str());
 
-    outDecimalString = decimalString;
+    VerifyOrReturnError(offset + 1 < outDecimalStringSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+    outDecimalString[offset]     = Verhoeff10::ComputeCheckChar(outDecimalString, offset);
+    outDecimalString[offset + 1] = '\0';
     return CHIP_NO_ERROR;
 }
 
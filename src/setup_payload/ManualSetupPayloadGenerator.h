@@ -45,6 +45,9 @@
 
 namespace chip {
 
+// Size of a buffer holding any manual setup code: the digits of a long code, its check digit and a NUL terminator
+constexpr size_t kManualSetupCodeBufferSize = kManualSetupLongCodeCharLength + 2;
+
 class ManualSetupPayloadGenerator
 {
 private:
@@ -55,6 +58,10 @@ public:
 
     // Populates decimal string representation of the payload into outDecimalString
     CHIP_ERROR payloadDecimalStringRepresentation(std::string & outDecimalString);
+
+    // Populates the NUL-terminated decimal string representation of the payload into a buffer of
+    // outDecimalStringSize characters, which must be at least kManualSetupCodeBufferSize
+    CHIP_ERROR payloadDecimalStringRepresentation(char * outDecimalString, size_t outDecimalStringSize);
 };
 
 } // namespace chip
@@ -177,18 +177,19 @@ static CHIP_ERROR generateBitSet(SetupPayload & payload, uint8_t * bits, uint8_t
 #pragma GCC diagnostic ignored "-Wstack-usage="
 #endif
 
-static CHIP_ERROR payloadBase38RepresentationWithTLV(SetupPayload & setupPayload, std::string & base38Representation,
-                                                     size_t bitsetSize, uint8_t * tlvDataStart, size_t tlvDataLengthInBytes)
+static CHIP_ERROR payloadBase38RepresentationWithTLV(SetupPayload & setupPayload, char * base38Representation,
+                                                     size_t base38RepresentationSize, size_t bitsetSize, uint8_t * tlvDataStart,
+                                                     size_t tlvDataLengthInBytes)
 {
     uint8_t bits[bitsetSize];
     memset(bits, 0, bitsetSize);
-    std::string encodedPayload;
     ReturnErrorOnFailure(generateBitSet(setupPayload, bits, tlvDataStart, tlvDataLengthInBytes));
 
-    encodedPayload = base38Encode(bits, ArraySize(bits));
-    encodedPayload.insert(0, kQRCodePrefix);
-    base38Representation = encodedPayload;
-    return CHIP_NO_ERROR;
+    const size_t prefixLength = strlen(kQRCodePrefix);
+    VerifyOrReturnError(base38RepresentationSize > prefixLength, CHIP_ERROR_BUFFER_TOO_SMALL);
+    memcpy(base38Representation, kQRCodePrefix, prefixLength);
+
+    return base38Encode(bits, ArraySize(bits), base38Representation + prefixLength, base38RepresentationSize - prefixLength);
 }
 
 CHIP_ERROR QRCodeSetupPayloadGenerator::payloadBase38Representation(std::string & base38Representation)
@@ -206,8 +207,24 @@ CHIP_ERROR QRCodeSetupPayloadGenerator::payloadBase38Representation(std::string
     VerifyOrReturnError(mPayload.isValidQRCodePayload(), CHIP_ERROR_INVALID_ARGUMENT);
     ReturnErrorOnFailure(generateTLVFromOptionalData(mPayload, tlvDataStart, tlvDataStartSize, tlvDataLengthInBytes));
 
-    return payloadBase38RepresentationWithTLV(mPayload, base38Representation, kTotalPayloadDataSizeInBytes + tlvDataLengthInBytes,
-                                              tlvDataStart, tlvDataLengthInBytes);
+    const size_t bitsetSize = kTotalPayloadDataSizeInBytes + tlvDataLengthInBytes;
+    std::string encodedPayload(strlen(kQRCodePrefix) + base38EncodedLength(bitsetSize) + 1, '\0');
+    ReturnErrorOnFailure(payloadBase38RepresentationWithTLV(mPayload, &encodedPayload[0], encodedPayload.size(), bitsetSize,
+                                                            tlvDataStart, tlvDataLengthInBytes));
+
+    encodedPayload.pop_back();
+    base38Representation = encodedPayload;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR QRCodeSetupPayloadGenerator::payloadBase38Representation(char * base38Representation, size_t base38RepresentationSize)
+{
+    VerifyOrReturnError(mPayload.isValidQRCodePayload(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mPayload.getAllOptionalVendorData().empty() && mPayload.getAllOptionalExtensionData().empty(),
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    return payloadBase38RepresentationWithTLV(mPayload, base38Representation, base38RepresentationSize,
+                                              kTotalPayloadDataSizeInBytes, nullptr, 0);
 }
 
 #if !defined(__clang__)
@@ -27,6 +27,7 @@
  *        single byte is encoded to 2 characters of the Base-38 alphabet.
  */
 
+#include "Base38.h"
 #include "SetupPayload.h"
 
 #include <string>
@@ -35,6 +36,9 @@
 
 namespace chip {
 
+// Size of a buffer holding the NUL-terminated QR code of a payload without optional data
+constexpr size_t kQRCodeBufferSizeWithoutTLV = sizeof("MT:") - 1 + base38EncodedLength(kTotalPayloadDataSizeInBytes) + 1;
+
 class QRCodeSetupPayloadGenerator
 {
 private:
@@ -82,6 +86,23 @@ public:
      */
     CHIP_ERROR payloadBase38Representation(std::string & base38Representation, uint8_t * tlvDataStart, uint32_t tlvDataStartSize);
 
+    /**
+     * This function is called to encode the binary data of a payload without
+     * optional data to a NUL-terminated base38 string, without any allocation.
+     *
+     * @param[out] base38Representation
+     *                  The buffer to write the base38 to.
+     * @param[in]  base38RepresentationSize
+     *                  The size of the buffer, which should be at least
+     *                  chip::kQRCodeBufferSizeWithoutTLV.
+     *
+     * @retval #CHIP_NO_ERROR if the method succeeded.
+     * @retval #CHIP_ERROR_INVALID_ARGUMENT if the payload is invalid or has
+     *         optional data.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL if the buffer is too small.
+     */
+    CHIP_ERROR payloadBase38Representation(char * base38Representation, size_t base38RepresentationSize);
+
 private:
     CHIP_ERROR generateTLVFromOptionalData(SetupPayload & outPayload, uint8_t * tlvDataStart, uint32_t maxLen,
                                            size_t & tlvDataLengthInBytes);
@@ -0,0 +1,372 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a generator of the onboarding data of many
+ *      devices at once, for factory provisioning.
+ *
+ */
+
+#include "SetupPayloadBatchGenerator.h"
+
+#include <core/CHIPEncoding.h>
+#include <core/CHIPTLV.h>
+#include <support/Base64.h>
+#include <support/CodeUtils.h>
+#include <support/ScopedBuffer.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+#include <inttypes.h>
+#include <string.h>
+
+namespace chip {
+
+namespace {
+
+// Largest setup PIN code allowed for a device; larger values would not fit the 8 digits of the manual setup code.
+constexpr uint32_t kSetupPINCodeMaximumValue = 99999998;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+/**
+ * Runs the generation of the chunks of records on worker threads, each chunk into one of
+ * kSlotsPerThread * threadCount slots, and hands the chunks over to the sink in order on the
+ * calling thread. A slot is only reused once the sink received the chunk it holds.
+ *
+ * The random values of a chunk are drawn on the calling thread before the chunk is handed to a
+ * worker, as the DRBG of some crypto PALs (e.g. mbedTLS) must not be used from several threads.
+ */
+class ParallelGeneration
+{
+public:
+    static constexpr size_t kSlotsPerThread = 2;
+
+    using ChunkFunction = CHIP_ERROR (*)(const void * context, SetupPayloadRecord * records, size_t count);
+
+    ParallelGeneration(size_t count, size_t chunkSize, unsigned threadCount) :
+        mCount(count), mChunkSize(chunkSize), mChunkCount((count + chunkSize - 1) / chunkSize), mThreadCount(threadCount),
+        mSlotCount(kSlotsPerThread * threadCount)
+    {}
+
+    /**
+     * Run drawChunk on the calling thread and then generateChunk on a worker thread for each chunk.
+     */
+    CHIP_ERROR Run(ChunkFunction drawChunk, ChunkFunction generateChunk, const void * context, SetupPayloadRecordSink & sink)
+    {
+        ReturnErrorCodeIf(!mRecords.Calloc(mSlotCount * mChunkSize), CHIP_ERROR_NO_MEMORY);
+        ReturnErrorCodeIf(!mSlots.Calloc(mSlotCount), CHIP_ERROR_NO_MEMORY);
+
+        for (; mDrawnChunks < mSlotCount && mDrawnChunks < mChunkCount; mDrawnChunks++)
+        {
+            ReturnErrorOnFailure(drawChunk(context, RecordsOf(mDrawnChunks), ChunkLength(mDrawnChunks)));
+        }
+
+        std::thread threads[SetupPayloadBatchGenerator::kMaxThreads];
+        for (unsigned i = 0; i < mThreadCount; i++)
+        {
+            threads[i] = std::thread([this, generateChunk, context]() { WorkerMain(generateChunk, context); });
+        }
+
+        CHIP_ERROR err = CHIP_NO_ERROR;
+        for (size_t chunk = 0; chunk < mChunkCount && err == CHIP_NO_ERROR; chunk++)
+        {
+            Slot & slot = mSlots[chunk % mSlotCount];
+            {
+                std::unique_lock<std::mutex> lock(mMutex);
+                mChanged.wait(lock, [&slot]() { return slot.mReady; });
+            }
+
+            err = slot.mStatus;
+            if (err == CHIP_NO_ERROR)
+            {
+                err = sink.OnRecords(RecordsOf(chunk), ChunkLength(chunk));
+            }
+
+            // The slot is free again: draw the chunk it holds next.
+            const bool drawNext = (err == CHIP_NO_ERROR && mDrawnChunks < mChunkCount);
+            if (drawNext)
+            {
+                err = drawChunk(context, RecordsOf(mDrawnChunks), ChunkLength(mDrawnChunks));
+            }
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            slot.mReady = false;
+            if (drawNext && err == CHIP_NO_ERROR)
+            {
+                mDrawnChunks++;
+            }
+            mAborted = (err != CHIP_NO_ERROR);
+            mChanged.notify_all();
+        }
+
+        for (unsigned i = 0; i < mThreadCount; i++)
+        {
+            threads[i].join();
+        }
+
+        return err;
+    }
+
+private:
+    struct Slot
+    {
+        bool mReady;
+        CHIP_ERROR mStatus;
+    };
+
+    void WorkerMain(ChunkFunction generateChunk, const void * context)
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (!mAborted && mNextChunk < mChunkCount)
+        {
+            const size_t chunk = mNextChunk++;
+            mChanged.wait(lock, [this, chunk]() { return mAborted || chunk < mDrawnChunks; });
+            VerifyOrReturn(!mAborted);
+
+            lock.unlock();
+            CHIP_ERROR status = generateChunk(context, RecordsOf(chunk), ChunkLength(chunk));
+            lock.lock();
+
+            Slot & slot  = mSlots[chunk % mSlotCount];
+            slot.mStatus = status;
+            slot.mReady  = true;
+            mChanged.notify_all();
+        }
+    }
+
+    SetupPayloadRecord * RecordsOf(size_t chunk) { return &mRecords[(chunk % mSlotCount) * mChunkSize]; }
+    size_t ChunkLength(size_t chunk) const { return (chunk + 1 < mChunkCount) ? mChunkSize : mCount - chunk * mChunkSize; }
+
+    const size_t mCount;
+    const size_t mChunkSize;
+    const size_t mChunkCount;
+    const unsigned mThreadCount;
+    const size_t mSlotCount;
+
+    Platform::ScopedMemoryBuffer<SetupPayloadRecord> mRecords;
+    Platform::ScopedMemoryBuffer<Slot> mSlots;
+
+    std::mutex mMutex;
+    std::condition_variable mChanged;
+    size_t mNextChunk   = 0; /**< Next chunk for a worker to generate. */
+    size_t mDrawnChunks = 0; /**< Number of chunks whose random values are drawn. */
+    bool mAborted       = false;
+};
+
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+} // namespace
+
+bool SetupPayloadBatchGenerator::IsValidSetupPINCode(uint32_t setUpPINCode)
+{
+    // 00000000, 11111111, ..., 99999999, 12345678 and 87654321 are not allowed.
+    return setUpPINCode <= kSetupPINCodeMaximumValue && setUpPINCode % 11111111 != 0 && setUpPINCode != 12345678 &&
+        setUpPINCode != 87654321;
+}
+
+CHIP_ERROR SetupPayloadBatchGenerator::Init(const Params & params)
+{
+    VerifyOrReturnError(params.iterationCount > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(params.saltLength >= Crypto::kMin_Salt_Length && params.saltLength <= Crypto::kMax_Salt_Length,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(params.threadCount > 0 && params.threadCount <= kMaxThreads, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(params.recordsPerChunk > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The template must be valid with any setup PIN code and discriminator, and without optional data.
+    SetupPayload payload  = params.payload;
+    payload.setUpPINCode  = 1;
+    payload.discriminator = 0;
+    char qrCode[kQRCodeBufferSizeWithoutTLV];
+    VerifyOrReturnError(payload.isValidManualCode(), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(QRCodeSetupPayloadGenerator(payload).payloadBase38Representation(qrCode, sizeof(qrCode)) == CHIP_NO_ERROR,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    mParams      = params;
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SetupPayloadBatchGenerator::GenerateRecord(SetupPayloadRecord & record) const
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(DrawRandomValues(&record, 1));
+    return ComputeRecord(record);
+}
+
+CHIP_ERROR SetupPayloadBatchGenerator::GenerateRecord(uint32_t setUpPINCode, uint16_t discriminator, const uint8_t * salt,
+                                                      size_t saltLength, SetupPayloadRecord & record) const
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(IsValidSetupPINCode(setUpPINCode), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(discriminator <= kMaxDiscriminatorValue, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(salt != nullptr && saltLength >= Crypto::kMin_Salt_Length && saltLength <= Crypto::kMax_Salt_Length,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+
+    record.setUpPINCode  = setUpPINCode;
+    record.discriminator = discriminator;
+    record.saltLength    = static_cast<uint8_t>(saltLength);
+    memcpy(record.salt, salt, saltLength);
+
+    return ComputeRecord(record);
+}
+
+CHIP_ERROR SetupPayloadBatchGenerator::DrawRandomValues(SetupPayloadRecord * records, size_t count) const
+{
+    uint8_t random[sizeof(uint32_t) + sizeof(uint16_t) + Crypto::kMax_Salt_Length];
+
+    for (size_t i = 0; i < count; i++)
+    {
+        SetupPayloadRecord & record = records[i];
+
+        // Draw the setup PIN code among the valid ones with no bias.
+        do
+        {
+            ReturnErrorOnFailure(Crypto::DRBG_get_bytes(random, sizeof(random)));
+            record.setUpPINCode = Encoding::LittleEndian::Get32(random) & ((1u << kSetupPINCodeFieldLengthInBits) - 1);
+        } while (!IsValidSetupPINCode(record.setUpPINCode));
+
+        record.discriminator =
+            static_cast<uint16_t>(Encoding::LittleEndian::Get16(&random[sizeof(uint32_t)]) & kMaxDiscriminatorValue);
+        record.saltLength = static_cast<uint8_t>(mParams.saltLength);
+        memcpy(record.salt, &random[sizeof(uint32_t) + sizeof(uint16_t)], mParams.saltLength);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SetupPayloadBatchGenerator::ComputeRecord(SetupPayloadRecord & record) const
+{
+    record.iterationCount = mParams.iterationCount;
+
+    ReturnErrorOnFailure(PASESession::ComputePASEVerifier(record.setUpPINCode, mParams.iterationCount, record.salt,
+                                                          record.saltLength, record.verifier));
+
+    SetupPayload payload  = mParams.payload;
+    payload.setUpPINCode  = record.setUpPINCode;
+    payload.discriminator = record.discriminator;
+
+    ReturnErrorOnFailure(QRCodeSetupPayloadGenerator(payload).payloadBase38Representation(record.qrCode, sizeof(record.qrCode)));
+    return ManualSetupPayloadGenerator(payload).payloadDecimalStringRepresentation(record.manualCode, sizeof(record.manualCode));
+}
+
+CHIP_ERROR SetupPayloadBatchGenerator::ComputeRecords(SetupPayloadRecord * records, size_t count) const
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        ReturnErrorOnFailure(ComputeRecord(records[i]));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SetupPayloadBatchGenerator::Generate(size_t count, SetupPayloadRecordSink & sink) const
+{
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(count > 0, CHIP_NO_ERROR);
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (mParams.threadCount > 1 && count > mParams.recordsPerChunk)
+    {
+        ParallelGeneration generation(count, mParams.recordsPerChunk, mParams.threadCount);
+        return generation.Run(
+            [](const void * context, SetupPayloadRecord * records, size_t recordCount) {
+                return static_cast<const SetupPayloadBatchGenerator *>(context)->DrawRandomValues(records, recordCount);
+            },
+            [](const void * context, SetupPayloadRecord * records, size_t recordCount) {
+                return static_cast<const SetupPayloadBatchGenerator *>(context)->ComputeRecords(records, recordCount);
+            },
+            this, sink);
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    const size_t chunkSize = (count < mParams.recordsPerChunk) ? count : mParams.recordsPerChunk;
+    Platform::ScopedMemoryBuffer<SetupPayloadRecord> records;
+    ReturnErrorCodeIf(!records.Calloc(chunkSize), CHIP_ERROR_NO_MEMORY);
+
+    for (size_t done = 0; done < count; done += chunkSize)
+    {
+        const size_t chunkLength = (count - done < chunkSize) ? count - done : chunkSize;
+        ReturnErrorOnFailure(DrawRandomValues(records.Get(), chunkLength));
+        ReturnErrorOnFailure(ComputeRecords(records.Get(), chunkLength));
+        ReturnErrorOnFailure(sink.OnRecords(records.Get(), chunkLength));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SetupPayloadCSVWriter::WriteHeader()
+{
+    VerifyOrReturnError(fputs("setup-pin-code,discriminator,iteration-count,salt,verifier,qr-code,manual-code\n", mFile) >= 0,
+                        CHIP_ERROR_WRITE_FAILED);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SetupPayloadCSVWriter::OnRecords(const SetupPayloadRecord * records, size_t count)
+{
+    char salt[BASE64_ENCODED_LEN(Crypto::kMax_Salt_Length) + 1];
+    char verifier[BASE64_ENCODED_LEN(sizeof(PASEVerifier)) + 1];
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const SetupPayloadRecord & record = records[i];
+
+        salt[Base64Encode(record.salt, record.saltLength, salt)] = '\0';
+        verifier[Base64Encode(&record.verifier[0][0], sizeof(record.verifier), verifier)] = '\0';
+
+        VerifyOrReturnError(fprintf(mFile, "%" PRIu32 ",%u,%" PRIu32 ",%s,%s,%s,%s\n", record.setUpPINCode, record.discriminator,
+                                    record.iterationCount, salt, verifier, record.qrCode, record.manualCode) > 0,
+                            CHIP_ERROR_WRITE_FAILED);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SetupPayloadTLVWriter::OnRecords(const SetupPayloadRecord * records, size_t count)
+{
+    uint8_t buf[sizeof(SetupPayloadRecord) + 32];
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const SetupPayloadRecord & record = records[i];
+        TLV::TLVWriter writer;
+        TLV::TLVType outerContainer;
+
+        writer.Init(buf, sizeof(buf));
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag, TLV::kTLVType_Structure, outerContainer));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(kTag_SetUpPINCode), record.setUpPINCode));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(kTag_Discriminator), record.discriminator));
+        ReturnErrorOnFailure(writer.Put(TLV::ContextTag(kTag_IterationCount), record.iterationCount));
+        ReturnErrorOnFailure(writer.PutBytes(TLV::ContextTag(kTag_Salt), record.salt, record.saltLength));
+        ReturnErrorOnFailure(writer.PutBytes(TLV::ContextTag(kTag_Verifier), &record.verifier[0][0], sizeof(record.verifier)));
+        ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(kTag_QRCode), record.qrCode));
+        ReturnErrorOnFailure(writer.PutString(TLV::ContextTag(kTag_ManualCode), record.manualCode));
+        ReturnErrorOnFailure(writer.EndContainer(outerContainer));
+        ReturnErrorOnFailure(writer.Finalize());
+
+        VerifyOrReturnError(fwrite(buf, 1, writer.GetLengthWritten(), mFile) == writer.GetLengthWritten(), CHIP_ERROR_WRITE_FAILED);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace chip
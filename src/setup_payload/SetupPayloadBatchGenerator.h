@@ -0,0 +1,167 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file describes a generator of the onboarding data of many
+ *      devices at once, for factory provisioning: for each device, a
+ *      random setup PIN code, discriminator and salt, the matching PASE
+ *      verifier, QR code and manual setup code.
+ *
+ *      Records are generated in chunks by worker threads, and handed over
+ *      in order to a record sink on the thread running the generation, so
+ *      that writing them out overlaps with the generation of the next ones.
+ */
+
+#pragma once
+
+#include "ManualSetupPayloadGenerator.h"
+#include "QRCodeSetupPayloadGenerator.h"
+#include "SetupPayload.h"
+
+#include <core/CHIPError.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <protocols/secure_channel/PASESession.h>
+#include <system/SystemConfig.h>
+
+#include <stdio.h>
+
+namespace chip {
+
+struct SetupPayloadRecord
+{
+    uint32_t setUpPINCode;
+    uint16_t discriminator;
+    uint32_t iterationCount;
+    uint8_t salt[Crypto::kMax_Salt_Length];
+    uint8_t saltLength;
+    PASEVerifier verifier;
+    char qrCode[kQRCodeBufferSizeWithoutTLV];
+    char manualCode[kManualSetupCodeBufferSize];
+};
+
+/**
+ * Receives the generated records, in generation order, on the thread running
+ * SetupPayloadBatchGenerator::Generate. An error stops the generation.
+ */
+class SetupPayloadRecordSink
+{
+public:
+    virtual ~SetupPayloadRecordSink() {}
+    virtual CHIP_ERROR OnRecords(const SetupPayloadRecord * records, size_t count) = 0;
+};
+
+class SetupPayloadBatchGenerator
+{
+public:
+    static constexpr unsigned kMaxThreads = 64;
+
+    struct Params
+    {
+        /**
+         * Template of the payload of all the records: version, vendor and product IDs, commissioning
+         * flow and rendezvous information. The setup PIN code and discriminator are generated.
+         */
+        SetupPayload payload;
+        uint32_t iterationCount = 100;
+        size_t saltLength       = Crypto::kMax_Salt_Length;
+        /**
+         * Number of threads generating records. With more than one, records are generated by as many
+         * worker threads while the thread running Generate hands them over to the sink.
+         */
+        unsigned threadCount   = 1;
+        size_t recordsPerChunk = 64;
+    };
+
+    CHIP_ERROR Init(const Params & params);
+
+    /**
+     * Generate a record with a random setup PIN code, discriminator and salt.
+     */
+    CHIP_ERROR GenerateRecord(SetupPayloadRecord & record) const;
+
+    /**
+     * Generate the record of a given setup PIN code, discriminator and salt.
+     */
+    CHIP_ERROR GenerateRecord(uint32_t setUpPINCode, uint16_t discriminator, const uint8_t * salt, size_t saltLength,
+                              SetupPayloadRecord & record) const;
+
+    /**
+     * Generate count random records and hand them over to the sink, in chunks of at most
+     * recordsPerChunk records. Without POSIX threads, records are generated on the calling thread.
+     */
+    CHIP_ERROR Generate(size_t count, SetupPayloadRecordSink & sink) const;
+
+    /**
+     * Whether a setup PIN code can be used by a device: it fits the payload and is not trivially guessable.
+     */
+    static bool IsValidSetupPINCode(uint32_t setUpPINCode);
+
+private:
+    // Draw the setup PIN code, discriminator and salt of the records. Generate calls it on the thread running it only.
+    CHIP_ERROR DrawRandomValues(SetupPayloadRecord * records, size_t count) const;
+    // Compute the verifier, QR code and manual setup code of a record from its setup PIN code, discriminator and salt.
+    CHIP_ERROR ComputeRecord(SetupPayloadRecord & record) const;
+    CHIP_ERROR ComputeRecords(SetupPayloadRecord * records, size_t count) const;
+
+    Params mParams;
+    bool mInitialized = false;
+};
+
+/**
+ * Writes records to a CSV file, one line per record: setup PIN code, discriminator, iteration count,
+ * base64 salt, base64 verifier, QR code and manual setup code.
+ */
+class SetupPayloadCSVWriter : public SetupPayloadRecordSink
+{
+public:
+    explicit SetupPayloadCSVWriter(FILE * file) : mFile(file) {}
+
+    CHIP_ERROR WriteHeader();
+    CHIP_ERROR OnRecords(const SetupPayloadRecord * records, size_t count) override;
+
+private:
+    FILE * mFile;
+};
+
+/**
+ * Writes records to a file as a sequence of anonymous TLV structures, using the context tags of
+ * SetupPayloadTLVWriter::Tags.
+ */
+class SetupPayloadTLVWriter : public SetupPayloadRecordSink
+{
+public:
+    enum Tags : uint8_t
+    {
+        kTag_SetUpPINCode   = 1,
+        kTag_Discriminator  = 2,
+        kTag_IterationCount = 3,
+        kTag_Salt           = 4,
+        kTag_Verifier       = 5,
+        kTag_QRCode         = 6,
+        kTag_ManualCode     = 7,
+    };
+
+    explicit SetupPayloadTLVWriter(FILE * file) : mFile(file) {}
+
+    CHIP_ERROR OnRecords(const SetupPayloadRecord * records, size_t count) override;
+
+private:
+    FILE * mFile;
+};
+
+} // namespace chip
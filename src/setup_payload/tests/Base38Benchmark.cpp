@@ -0,0 +1,102 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the Base38 encoding and decoding of QR code
+ *      payloads, one at a time and batched.
+ *
+ */
+
+#include <setup_payload/Base38.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace chip;
+
+namespace {
+
+// The size of the payload of a QR code without optional data.
+constexpr size_t kLength      = 11;
+constexpr size_t kEncodedSize = base38EncodedLength(kLength);
+constexpr size_t kStride      = 32;
+constexpr size_t kCount       = 1000;
+constexpr int kRounds         = 100;
+
+uint8_t sBytes[kCount * kStride];
+uint8_t sDecoded[kCount * kStride];
+char sChars[kCount * kStride];
+
+double Rate(std::chrono::steady_clock::duration duration)
+{
+    const double seconds = std::chrono::duration<double>(duration).count();
+    return static_cast<double>(kRounds * kCount) / (seconds > 0 ? seconds : 1e-9);
+}
+
+} // namespace
+
+int main()
+{
+    for (size_t i = 0; i < kCount * kStride; i++)
+    {
+        sBytes[i] = static_cast<uint8_t>(rand());
+    }
+
+    bool succeeded = true;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        for (size_t i = 0; i < kCount; i++)
+        {
+            succeeded = succeeded && base38Encode(&sBytes[i * kStride], kLength, &sChars[i * kStride], kStride) == CHIP_NO_ERROR;
+        }
+    }
+    auto single = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        succeeded = succeeded && base38EncodeBatch(sBytes, kStride, kLength, kCount, sChars, kStride) == CHIP_NO_ERROR;
+    }
+    auto encode = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++)
+    {
+        succeeded = succeeded && base38DecodeBatch(sChars, kStride, kEncodedSize, kCount, sDecoded, kStride) == CHIP_NO_ERROR;
+    }
+    auto decode = std::chrono::steady_clock::now() - start;
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        succeeded = succeeded && memcmp(&sBytes[i * kStride], &sDecoded[i * kStride], kLength) == 0;
+    }
+    if (!succeeded)
+    {
+        fprintf(stderr, "Base38 round trip failed\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Base38 payloads of %zu bytes: %.0f/s single encoding, %.0f/s batch encoding, %.0f/s batch decoding\n", kLength,
+           Rate(single), Rate(encode), Rate(decode));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the bulk generation of onboarding data,
+ *      with the default iteration count and 1 to 4 threads.
+ *
+ */
+
+#include <setup_payload/SetupPayloadBatchGenerator.h>
+
+#include <support/CHIPMem.h>
+#include <support/ErrorStr.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace chip;
+
+namespace {
+
+constexpr size_t kRecordCount  = 2000;
+constexpr unsigned kMaxThreads = 4;
+
+class NullSink : public SetupPayloadRecordSink
+{
+public:
+    CHIP_ERROR OnRecords(const SetupPayloadRecord * records, size_t count) override { return CHIP_NO_ERROR; }
+};
+
+SetupPayloadBatchGenerator::Params GetParams(unsigned threadCount)
+{
+    SetupPayloadBatchGenerator::Params params;
+
+    params.payload.version               = 0;
+    params.payload.vendorID              = 0xFFF1;
+    params.payload.productID             = 0x8001;
+    params.payload.commissioningFlow     = CommissioningFlow::kStandard;
+    params.payload.rendezvousInformation = RendezvousInformationFlags(RendezvousInformationFlag::kBLE);
+    params.threadCount                   = threadCount;
+
+    return params;
+}
+
+} // namespace
+
+int main()
+{
+    NullSink sink;
+
+    if (Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to initialize the memory\n");
+        return EXIT_FAILURE;
+    }
+
+    for (unsigned threadCount = 1; threadCount <= kMaxThreads; threadCount++)
+    {
+        SetupPayloadBatchGenerator generator;
+
+        auto start     = std::chrono::steady_clock::now();
+        CHIP_ERROR err = generator.Init(GetParams(threadCount));
+        if (err == CHIP_NO_ERROR)
+        {
+            err = generator.Generate(kRecordCount, sink);
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        if (err != CHIP_NO_ERROR)
+        {
+            fprintf(stderr, "Failed to generate the records with %u thread(s): %s\n", threadCount, ErrorStr(err));
+            Platform::MemoryShutdown();
+            return EXIT_FAILURE;
+        }
+
+        printf("Setup payload records, %u thread(s): %.0f/s\n", threadCount, static_cast<double>(kRecordCount) / elapsed.count());
+    }
+
+    Platform::MemoryShutdown();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,289 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests checking the batched Base38 encoding and
+ *      decoding against a straightforward implementation of the encoding.
+ */
+
+#include <setup_payload/Base38.h>
+
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+using namespace chip;
+
+namespace {
+
+const char kReferenceCodes[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ-.";
+const uint32_t kReferenceRadix = sizeof(kReferenceCodes) - 1;
+
+// Characters a decoded string is drawn from: the whole alphabet, and characters around it.
+const char kDecodeCharacters[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ-./:@[az ";
+
+constexpr size_t kMaxLength = 40;
+constexpr size_t kStride    = 80;
+constexpr size_t kMaxCount  = 1000;
+
+uint8_t sBytes[kMaxCount * kStride];
+char sChars[kMaxCount * kStride];
+
+std::string ReferenceEncode(const uint8_t * buf, size_t buf_len)
+{
+    std::string result;
+
+    for (size_t offset = 0; offset < buf_len; offset += 3)
+    {
+        const size_t bytes = (buf_len - offset < 3) ? buf_len - offset : 3;
+        uint32_t value     = 0;
+
+        for (size_t byte = 0; byte < bytes; byte++)
+        {
+            value |= static_cast<uint32_t>(buf[offset + byte]) << (8 * byte);
+        }
+        for (size_t character = 0; character < bytes * 2 - (bytes == 3 ? 1 : 0); character++)
+        {
+            result += kReferenceCodes[value % kReferenceRadix];
+            value /= kReferenceRadix;
+        }
+    }
+
+    return result;
+}
+
+CHIP_ERROR ReferenceDecode(const char * str, size_t str_len, std::vector<uint8_t> & result)
+{
+    result.clear();
+
+    for (size_t offset = 0; offset < str_len;)
+    {
+        const size_t remaining = str_len - offset;
+        size_t characters;
+        size_t bytes;
+
+        if (remaining >= 5)
+        {
+            characters = 5;
+            bytes      = 3;
+        }
+        else if (remaining == 4 || remaining == 2)
+        {
+            characters = remaining;
+            bytes      = remaining / 2;
+        }
+        else
+        {
+            return CHIP_ERROR_INVALID_STRING_LENGTH;
+        }
+
+        uint32_t value = 0;
+        for (size_t i = characters; i > 0; i--)
+        {
+            const char * code = strchr(kReferenceCodes, str[offset + i - 1]);
+            if (str[offset + i - 1] == '\0' || code == nullptr)
+            {
+                return CHIP_ERROR_INVALID_INTEGER_VALUE;
+            }
+            value = value * kReferenceRadix + static_cast<uint32_t>(code - kReferenceCodes);
+        }
+        if ((value >> (8 * bytes)) != 0)
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+
+        for (size_t byte = 0; byte < bytes; byte++)
+        {
+            result.push_back(static_cast<uint8_t>(value >> (8 * byte)));
+        }
+        offset += characters;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void FillRandomBytes(size_t count, size_t length)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        for (size_t byte = 0; byte < length; byte++)
+        {
+            // Extreme byte values in a third of the items, to hit the largest chunk values.
+            const int r                = rand();
+            sBytes[i * kStride + byte] = (i % 3 == 0) ? ((r & 1) ? 0xFF : 0x00) : static_cast<uint8_t>(r);
+        }
+    }
+}
+
+void TestBase38EncodeMatchesReference(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr size_t kCount = 100;
+
+    for (size_t length = 0; length <= kMaxLength; length++)
+    {
+        FillRandomBytes(kCount, length);
+
+        NL_TEST_ASSERT(inSuite, base38EncodeBatch(sBytes, kStride, length, kCount, sChars, kStride) == CHIP_NO_ERROR);
+
+        for (size_t i = 0; i < kCount; i++)
+        {
+            const std::string expected = ReferenceEncode(&sBytes[i * kStride], length);
+
+            NL_TEST_ASSERT(inSuite, expected.length() == base38EncodedLength(length));
+            NL_TEST_ASSERT(inSuite, base38Encode(&sBytes[i * kStride], length) == expected);
+            NL_TEST_ASSERT(inSuite, strcmp(&sChars[i * kStride], expected.c_str()) == 0);
+        }
+    }
+
+    // The output stride must leave room for the NUL terminator.
+    NL_TEST_ASSERT(inSuite, base38EncodeBatch(sBytes, kStride, 3, 2, sChars, 5) == CHIP_ERROR_BUFFER_TOO_SMALL);
+    NL_TEST_ASSERT(inSuite, base38EncodeBatch(sBytes, kStride, 3, 2, sChars, 6) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, base38EncodeBatch(sBytes, kStride, 3, 0, sChars, kStride) == CHIP_NO_ERROR);
+}
+
+void TestBase38DecodeMatchesReference(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr size_t kCount = 200;
+    static CHIP_ERROR statuses[kCount];
+
+    for (size_t length = 0; length <= kMaxLength; length++)
+    {
+        for (size_t i = 0; i < kCount; i++)
+        {
+            char * str = &sChars[i * kStride];
+
+            if (i % 2 == 0)
+            {
+                // Valid encoding of random bytes, when the length is one.
+                FillRandomBytes(1, length * 3 / 5);
+                std::string encoded = ReferenceEncode(sBytes, length * 3 / 5);
+                memset(str, '0', length);
+                memcpy(str, encoded.data(), encoded.length() < length ? encoded.length() : length);
+            }
+            else
+            {
+                for (size_t c = 0; c < length; c++)
+                {
+                    // Mostly characters of the alphabet, so that some chunks decode before an invalid one.
+                    const size_t choices = (rand() % 8 == 0) ? sizeof(kDecodeCharacters) - 1 : kReferenceRadix;
+                    str[c]               = kDecodeCharacters[static_cast<size_t>(rand()) % choices];
+                }
+            }
+        }
+
+        memset(sBytes, 0xAA, sizeof(sBytes));
+        CHIP_ERROR firstError = base38DecodeBatch(sChars, kStride, length, kCount, sBytes, kStride, statuses);
+        CHIP_ERROR expectedFirstError = CHIP_NO_ERROR;
+
+        for (size_t i = 0; i < kCount; i++)
+        {
+            std::vector<uint8_t> expected;
+            std::vector<uint8_t> decoded;
+            const CHIP_ERROR expectedErr = ReferenceDecode(&sChars[i * kStride], length, expected);
+
+            NL_TEST_ASSERT(inSuite, base38Decode(std::string(&sChars[i * kStride], length), decoded) == expectedErr);
+            NL_TEST_ASSERT(inSuite, statuses[i] == expectedErr);
+            if (expectedErr == CHIP_NO_ERROR)
+            {
+                NL_TEST_ASSERT(inSuite, expected.size() == base38DecodedLength(length));
+                NL_TEST_ASSERT(inSuite, decoded == expected);
+                NL_TEST_ASSERT(inSuite, memcmp(&sBytes[i * kStride], expected.data(), expected.size()) == 0);
+            }
+            else if (expectedFirstError == CHIP_NO_ERROR)
+            {
+                expectedFirstError = expectedErr;
+            }
+        }
+
+        NL_TEST_ASSERT(inSuite, firstError == expectedFirstError);
+        NL_TEST_ASSERT(inSuite, base38DecodeBatch(sChars, kStride, length, kCount, sBytes, kStride) == expectedFirstError);
+    }
+
+    // The output stride must fit the decoded bytes.
+    NL_TEST_ASSERT(inSuite, base38DecodeBatch(sChars, kStride, 5, 2, sBytes, 2) == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+void TestBase38AllChunkValues(nlTestSuite * inSuite, void * inContext)
+{
+    // Every 3 bytes chunk, so every value divided by the radix, round trips through the batch functions.
+    constexpr uint32_t kChunksPerBatch = 1 << 12;
+    bool allMatch                      = true;
+
+    for (uint32_t base = 0; base < (1u << 24); base += kChunksPerBatch)
+    {
+        for (uint32_t i = 0; i < kChunksPerBatch; i++)
+        {
+            const uint32_t value = base + i;
+            uint8_t * bytes      = &sBytes[(i % kMaxCount) * 3];
+            bytes[0]             = static_cast<uint8_t>(value);
+            bytes[1]             = static_cast<uint8_t>(value >> 8);
+            bytes[2]             = static_cast<uint8_t>(value >> 16);
+
+            char encoded[6];
+            uint8_t decoded[3];
+            allMatch = allMatch && base38EncodeBatch(bytes, 3, 3, 1, encoded, sizeof(encoded)) == CHIP_NO_ERROR;
+            allMatch = allMatch && base38DecodeBatch(encoded, 5, 5, 1, decoded, sizeof(decoded)) == CHIP_NO_ERROR;
+            allMatch = allMatch && memcmp(decoded, bytes, sizeof(decoded)) == 0;
+
+            if (value % 4099 == 0)
+            {
+                allMatch = allMatch && ReferenceEncode(bytes, 3) == encoded;
+            }
+        }
+    }
+
+    NL_TEST_ASSERT(inSuite, allMatch);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Test Base38 encoding against reference",   TestBase38EncodeMatchesReference),
+    NL_TEST_DEF("Test Base38 decoding against reference",   TestBase38DecodeMatchesReference),
+    NL_TEST_DEF("Test Base38 round trip of all chunks",     TestBase38AllChunkValues),
+
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestBase38()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "chip-base38-tests",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    // Generate machine-readable, comma-separated value (CSV) output.
+    nl_test_set_output_style(OUTPUT_CSV);
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBase38);
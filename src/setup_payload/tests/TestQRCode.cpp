@@ -113,6 +113,11 @@ void TestPayloadBase38Rep(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, didSucceed == true);
 
     NL_TEST_ASSERT(inSuite, result == kDefaultPayloadQRCode);
+
+    char buffer[kQRCodeBufferSizeWithoutTLV];
+    NL_TEST_ASSERT(inSuite, generator.payloadBase38Representation(buffer, sizeof(buffer)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, result == buffer);
+    NL_TEST_ASSERT(inSuite, generator.payloadBase38Representation(buffer, sizeof(buffer) - 1) == CHIP_ERROR_BUFFER_TOO_SMALL);
 }
 
 void TestBase38(nlTestSuite * inSuite, void * inContext)
@@ -166,6 +171,15 @@ void TestBase38(nlTestSuite * inSuite, void * inContext)
     // fun with strings
     NL_TEST_ASSERT(inSuite, base38Encode((uint8_t *) "Hello World!", sizeof("Hello World!") - 1) == "KKHF3W2S013OPM3EJX11");
 
+    // encoding into a buffer gives the same characters, NUL terminated
+    char encoded[base38EncodedLength(sizeof("Hello World!") - 1) + 1];
+    NL_TEST_ASSERT(inSuite,
+                   base38Encode((uint8_t *) "Hello World!", sizeof("Hello World!") - 1, encoded, sizeof(encoded)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, strcmp(encoded, "KKHF3W2S013OPM3EJX11") == 0);
+    NL_TEST_ASSERT(inSuite, base38Encode(input, 2, encoded, 5) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, strcmp(encoded, "NE71") == 0);
+    NL_TEST_ASSERT(inSuite, base38Encode(input, 2, encoded, 4) == CHIP_ERROR_BUFFER_TOO_SMALL);
+
     vector<uint8_t> decoded = vector<uint8_t>();
     NL_TEST_ASSERT(inSuite, base38Decode("KKHF3W2S013OPM3EJX11", decoded) == CHIP_NO_ERROR);
 
@@ -0,0 +1,336 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the bulk generation of
+ *      onboarding data.
+ *
+ */
+
+#include <setup_payload/ManualSetupPayloadParser.h>
+#include <setup_payload/QRCodeSetupPayloadParser.h>
+#include <setup_payload/SetupPayloadBatchGenerator.h>
+
+#include <core/CHIPTLV.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+using namespace chip;
+
+namespace {
+
+const uint8_t kSalt[] = { 0x53, 0x50, 0x41, 0x4B, 0x45, 0x32, 0x50, 0x20, 0x4B, 0x65, 0x79, 0x20, 0x53, 0x61, 0x6C, 0x74 };
+
+SetupPayloadBatchGenerator::Params GetDefaultParams()
+{
+    SetupPayloadBatchGenerator::Params params;
+
+    params.payload.version               = 0;
+    params.payload.vendorID              = 0xFFF1;
+    params.payload.productID             = 0x8001;
+    params.payload.commissioningFlow     = CommissioningFlow::kStandard;
+    params.payload.rendezvousInformation = RendezvousInformationFlags(RendezvousInformationFlag::kBLE);
+    params.iterationCount                = 100;
+
+    return params;
+}
+
+// Check that a record holds the verifier, QR code and manual code of its setup PIN code and discriminator.
+bool CheckRecord(const SetupPayloadRecord & record)
+{
+    PASEVerifier verifier;
+    VerifyOrReturnError(PASESession::ComputePASEVerifier(record.setUpPINCode, record.iterationCount, record.salt, record.saltLength,
+                                                         verifier) == CHIP_NO_ERROR,
+                        false);
+    VerifyOrReturnError(memcmp(verifier, record.verifier, sizeof(verifier)) == 0, false);
+
+    SetupPayload qrPayload;
+    VerifyOrReturnError(QRCodeSetupPayloadParser(record.qrCode).populatePayload(qrPayload) == CHIP_NO_ERROR, false);
+    VerifyOrReturnError(qrPayload.setUpPINCode == record.setUpPINCode, false);
+    VerifyOrReturnError(qrPayload.discriminator == record.discriminator, false);
+    VerifyOrReturnError(qrPayload.vendorID == 0xFFF1 && qrPayload.productID == 0x8001, false);
+
+    SetupPayload manualPayload;
+    VerifyOrReturnError(ManualSetupPayloadParser(record.manualCode).populatePayload(manualPayload) == CHIP_NO_ERROR, false);
+    VerifyOrReturnError(manualPayload.setUpPINCode == record.setUpPINCode, false);
+    VerifyOrReturnError(manualPayload.discriminator == (record.discriminator & 0xF00), false);
+
+    return SetupPayloadBatchGenerator::IsValidSetupPINCode(record.setUpPINCode);
+}
+
+CHIP_ERROR NextWithTag(TLV::TLVReader & reader, uint8_t tag)
+{
+    ReturnErrorOnFailure(reader.Next());
+    VerifyOrReturnError(reader.GetTag() == TLV::ContextTag(tag), CHIP_ERROR_UNEXPECTED_TLV_ELEMENT);
+    return CHIP_NO_ERROR;
+}
+
+class RecordCollector : public SetupPayloadRecordSink
+{
+public:
+    CHIP_ERROR OnRecords(const SetupPayloadRecord * records, size_t count) override
+    {
+        VerifyOrReturnError(count > 0 && count <= mMaxChunk, CHIP_ERROR_INVALID_ARGUMENT);
+        VerifyOrReturnError(mRecords.size() < mFailAfter, CHIP_ERROR_INTERNAL);
+
+        mRecords.insert(mRecords.end(), records, records + count);
+        mChunks++;
+        return CHIP_NO_ERROR;
+    }
+
+    std::vector<SetupPayloadRecord> mRecords;
+    size_t mChunks    = 0;
+    size_t mMaxChunk  = SIZE_MAX;
+    size_t mFailAfter = SIZE_MAX;
+};
+
+void TestSetupPINCodeValidity(nlTestSuite * inSuite, void * inContext)
+{
+    NL_TEST_ASSERT(inSuite, SetupPayloadBatchGenerator::IsValidSetupPINCode(20202021));
+    NL_TEST_ASSERT(inSuite, SetupPayloadBatchGenerator::IsValidSetupPINCode(1));
+    NL_TEST_ASSERT(inSuite, SetupPayloadBatchGenerator::IsValidSetupPINCode(99999998));
+
+    NL_TEST_ASSERT(inSuite, !SetupPayloadBatchGenerator::IsValidSetupPINCode(0));
+    NL_TEST_ASSERT(inSuite, !SetupPayloadBatchGenerator::IsValidSetupPINCode(11111111));
+    NL_TEST_ASSERT(inSuite, !SetupPayloadBatchGenerator::IsValidSetupPINCode(55555555));
+    NL_TEST_ASSERT(inSuite, !SetupPayloadBatchGenerator::IsValidSetupPINCode(99999999));
+    NL_TEST_ASSERT(inSuite, !SetupPayloadBatchGenerator::IsValidSetupPINCode(12345678));
+    NL_TEST_ASSERT(inSuite, !SetupPayloadBatchGenerator::IsValidSetupPINCode(87654321));
+    NL_TEST_ASSERT(inSuite, !SetupPayloadBatchGenerator::IsValidSetupPINCode(100000000));
+}
+
+void TestInit(nlTestSuite * inSuite, void * inContext)
+{
+    SetupPayloadBatchGenerator generator;
+    SetupPayloadRecord record;
+    RecordCollector collector;
+
+    NL_TEST_ASSERT(inSuite, generator.GenerateRecord(record) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, generator.Generate(1, collector) == CHIP_ERROR_INCORRECT_STATE);
+
+    SetupPayloadBatchGenerator::Params params = GetDefaultParams();
+    params.saltLength                         = Crypto::kMin_Salt_Length - 1;
+    NL_TEST_ASSERT(inSuite, generator.Init(params) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    params             = GetDefaultParams();
+    params.threadCount = 0;
+    NL_TEST_ASSERT(inSuite, generator.Init(params) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    params                 = GetDefaultParams();
+    params.payload.version = 1 << kVersionFieldLengthInBits;
+    NL_TEST_ASSERT(inSuite, generator.Init(params) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    params = GetDefaultParams();
+    NL_TEST_ASSERT(inSuite, params.payload.addSerialNumber("123456789") == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, generator.Init(params) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    NL_TEST_ASSERT(inSuite, generator.Init(GetDefaultParams()) == CHIP_NO_ERROR);
+}
+
+// A record matches the single payload generators and the PASE verifier of the secure channel.
+void TestGenerateRecord(nlTestSuite * inSuite, void * inContext)
+{
+    SetupPayloadBatchGenerator generator;
+    SetupPayloadRecord record;
+
+    NL_TEST_ASSERT(inSuite, generator.Init(GetDefaultParams()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, generator.GenerateRecord(20202021, 3840, kSalt, sizeof(kSalt), record) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, CheckRecord(record));
+    NL_TEST_ASSERT(inSuite, record.saltLength == sizeof(kSalt) && memcmp(record.salt, kSalt, sizeof(kSalt)) == 0);
+
+    SetupPayload payload  = GetDefaultParams().payload;
+    payload.setUpPINCode  = 20202021;
+    payload.discriminator = 3840;
+
+    std::string qrCode;
+    std::string manualCode;
+    NL_TEST_ASSERT(inSuite, QRCodeSetupPayloadGenerator(payload).payloadBase38Representation(qrCode) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, ManualSetupPayloadGenerator(payload).payloadDecimalStringRepresentation(manualCode) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, qrCode == record.qrCode);
+    NL_TEST_ASSERT(inSuite, manualCode == record.manualCode);
+
+    NL_TEST_ASSERT(inSuite, generator.GenerateRecord(12345678, 3840, kSalt, sizeof(kSalt), record) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, generator.GenerateRecord(20202021, 4096, kSalt, sizeof(kSalt), record) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, generator.GenerateRecord(20202021, 3840, kSalt, 4, record) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    NL_TEST_ASSERT(inSuite, generator.GenerateRecord(record) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, CheckRecord(record));
+    NL_TEST_ASSERT(inSuite, record.saltLength == Crypto::kMax_Salt_Length);
+}
+
+// Records reach the sink in chunks, all of them exactly once, whatever the number of threads.
+void TestGenerate(nlTestSuite * inSuite, void * inContext)
+{
+    for (unsigned threadCount : { 1, 3 })
+    {
+        SetupPayloadBatchGenerator generator;
+        SetupPayloadBatchGenerator::Params params = GetDefaultParams();
+        RecordCollector collector;
+
+        params.threadCount     = threadCount;
+        params.recordsPerChunk = 16;
+        collector.mMaxChunk    = 16;
+
+        NL_TEST_ASSERT(inSuite, generator.Init(params) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, generator.Generate(250, collector) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, collector.mRecords.size() == 250);
+        NL_TEST_ASSERT(inSuite, collector.mChunks == 16);
+
+        size_t invalid = 0;
+        for (const SetupPayloadRecord & record : collector.mRecords)
+        {
+            invalid += CheckRecord(record) ? 0 : 1;
+        }
+        NL_TEST_ASSERT(inSuite, invalid == 0);
+
+        // Random records are unlikely to collide.
+        NL_TEST_ASSERT(inSuite, memcmp(collector.mRecords[0].salt, collector.mRecords[249].salt, Crypto::kMax_Salt_Length) != 0);
+
+        // An error of the sink stops the generation.
+        RecordCollector failing;
+        failing.mFailAfter = 32;
+        NL_TEST_ASSERT(inSuite, generator.Generate(250, failing) == CHIP_ERROR_INTERNAL);
+        NL_TEST_ASSERT(inSuite, failing.mRecords.size() == 32);
+    }
+}
+
+void TestWriters(nlTestSuite * inSuite, void * inContext)
+{
+    SetupPayloadBatchGenerator generator;
+    SetupPayloadRecord records[2];
+    char line[512];
+
+    NL_TEST_ASSERT(inSuite, generator.Init(GetDefaultParams()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, generator.GenerateRecord(20202021, 3840, kSalt, sizeof(kSalt), records[0]) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, generator.GenerateRecord(34567890, 0, kSalt, Crypto::kMin_Salt_Length, records[1]) == CHIP_NO_ERROR);
+
+    FILE * file = tmpfile();
+    NL_TEST_ASSERT(inSuite, file != nullptr);
+    VerifyOrReturn(file != nullptr);
+
+    SetupPayloadCSVWriter csvWriter(file);
+    NL_TEST_ASSERT(inSuite, csvWriter.WriteHeader() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, csvWriter.OnRecords(records, 2) == CHIP_NO_ERROR);
+
+    rewind(file);
+    NL_TEST_ASSERT(inSuite, fgets(line, sizeof(line), file) != nullptr);
+    NL_TEST_ASSERT(inSuite, strcmp(line, "setup-pin-code,discriminator,iteration-count,salt,verifier,qr-code,manual-code\n") == 0);
+    NL_TEST_ASSERT(inSuite, fgets(line, sizeof(line), file) != nullptr);
+    NL_TEST_ASSERT(inSuite, strncmp(line, "20202021,3840,100,U1BBS0UyUCBLZXkgU2FsdA==,", 43) == 0);
+    NL_TEST_ASSERT(inSuite, strstr(line, records[0].qrCode) != nullptr && strstr(line, records[0].manualCode) != nullptr);
+    NL_TEST_ASSERT(inSuite, fgets(line, sizeof(line), file) != nullptr);
+    NL_TEST_ASSERT(inSuite, strncmp(line, "34567890,0,100,U1BBS0UyUCA=,", 28) == 0);
+    NL_TEST_ASSERT(inSuite, fgets(line, sizeof(line), file) == nullptr);
+    fclose(file);
+
+    file = tmpfile();
+    NL_TEST_ASSERT(inSuite, file != nullptr);
+    VerifyOrReturn(file != nullptr);
+
+    SetupPayloadTLVWriter tlvWriter(file);
+    NL_TEST_ASSERT(inSuite, tlvWriter.OnRecords(records, 2) == CHIP_NO_ERROR);
+
+    uint8_t buf[2 * sizeof(SetupPayloadRecord)];
+    rewind(file);
+    const size_t length = fread(buf, 1, sizeof(buf), file);
+    fclose(file);
+
+    TLV::TLVReader reader;
+    reader.Init(buf, static_cast<uint32_t>(length));
+    for (const SetupPayloadRecord & record : records)
+    {
+        TLV::TLVType outerContainer;
+        uint32_t setUpPINCode;
+        uint16_t discriminator;
+        uint8_t verifier[sizeof(PASEVerifier)];
+        char manualCode[kManualSetupCodeBufferSize];
+
+        NL_TEST_ASSERT(inSuite, reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.EnterContainer(outerContainer) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, NextWithTag(reader, SetupPayloadTLVWriter::kTag_SetUpPINCode) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.Get(setUpPINCode) == CHIP_NO_ERROR && setUpPINCode == record.setUpPINCode);
+        NL_TEST_ASSERT(inSuite, NextWithTag(reader, SetupPayloadTLVWriter::kTag_Discriminator) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.Get(discriminator) == CHIP_NO_ERROR && discriminator == record.discriminator);
+        NL_TEST_ASSERT(inSuite, NextWithTag(reader, SetupPayloadTLVWriter::kTag_IterationCount) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, NextWithTag(reader, SetupPayloadTLVWriter::kTag_Salt) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.GetLength() == record.saltLength);
+        NL_TEST_ASSERT(inSuite, NextWithTag(reader, SetupPayloadTLVWriter::kTag_Verifier) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.GetBytes(verifier, sizeof(verifier)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, memcmp(verifier, record.verifier, sizeof(verifier)) == 0);
+        NL_TEST_ASSERT(inSuite, NextWithTag(reader, SetupPayloadTLVWriter::kTag_QRCode) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, NextWithTag(reader, SetupPayloadTLVWriter::kTag_ManualCode) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, reader.GetString(manualCode, sizeof(manualCode)) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, strcmp(manualCode, record.manualCode) == 0);
+        NL_TEST_ASSERT(inSuite, reader.ExitContainer(outerContainer) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, reader.Next() == CHIP_END_OF_TLV);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Test Setup PIN Code Validity", TestSetupPINCodeValidity),
+    NL_TEST_DEF("Test Init",                    TestInit),
+    NL_TEST_DEF("Test Generate Record",         TestGenerateRecord),
+    NL_TEST_DEF("Test Generate",                TestGenerate),
+    NL_TEST_DEF("Test Writers",                 TestWriters),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestSetupPayloadBatchGenerator_Setup(void * inContext)
+{
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    if (error != CHIP_NO_ERROR)
+        return FAILURE;
+    return SUCCESS;
+}
+
+int TestSetupPayloadBatchGenerator_Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestSetupPayloadBatchGenerator()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "chip-setup-payload-batch-generator",
+        &sTests[0],
+        TestSetupPayloadBatchGenerator_Setup,
+        TestSetupPayloadBatchGenerator_Teardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSetupPayloadBatchGenerator);
@@ -387,6 +387,22 @@ CHIP_ERROR PacketBuffer::Read(uint8_t * aDestination, size_t aReadLength) const
     return CHIP_NO_ERROR;
 }
 
+size_t PacketBuffer::GetSegments(PacketBufferSegment * aSegments, size_t aMaxSegments) const
+{
+    size_t lCount = 0;
+
+    for (const PacketBuffer * lPacket = this; lPacket != nullptr; lPacket = lPacket->ChainedBuffer())
+    {
+        if (lCount < aMaxSegments)
+        {
+            aSegments[lCount].data   = lPacket->Start();
+            aSegments[lCount].length = lPacket->DataLength();
+        }
+        lCount++;
+    }
+    return lCount;
+}
+
 bool PacketBuffer::EnsureReservedSize(uint16_t aReservedSize)
 {
     const uint16_t kCurrentReservedSize = this->ReservedSize();
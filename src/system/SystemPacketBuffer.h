@@ -102,6 +102,15 @@ struct pbuf
 };
 #endif // !CHIP_SYSTEM_CONFIG_USE_LWIP
 
+/**
+ * The data of one buffer of a PacketBuffer chain, as handed to scatter/gather I/O.
+ */
+struct PacketBufferSegment
+{
+    uint8_t * data;
+    uint16_t length;
+};
+
 /**    @class PacketBuffer
  *
  *     @brief
@@ -355,6 +364,17 @@ public:
         return Read(buf, N);
     }
 
+    /**
+     * Describe the data of each buffer of the chain starting at this buffer, for scatter/gather I/O such as sendmsg().
+     *
+     * @param[out] aSegments    Segments to fill, one per buffer of the chain.
+     * @param[in]  aMaxSegments Number of segments in @a aSegments.
+     *
+     * @return The number of buffers in the chain. When it is greater than @a aMaxSegments, only the first @a aMaxSegments
+     *         segments are filled.
+     */
+    size_t GetSegments(PacketBufferSegment * aSegments, size_t aMaxSegments) const;
+
     /**
      * Perform an implementation-defined check on the validity of a PacketBuffer pointer.
      *
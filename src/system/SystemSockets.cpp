@@ -40,6 +40,16 @@
 namespace chip {
 namespace System {
 
+void WakeEvent::Confirm(WatchableSocket & socket)
+{
+    WakeEvent * event = reinterpret_cast<WakeEvent *>(socket.GetCallbackData());
+    event->Confirm();
+    if (event->mHandler != nullptr)
+    {
+        event->mHandler(event->mHandlerData);
+    }
+}
+
 #if CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
 
 namespace {
@@ -128,7 +138,7 @@ CHIP_ERROR WakeEvent::Open(WatchableEventManager & watchState)
 {
     mFD.Init(watchState);
 
-    const int fd = ::eventfd(0, 0);
+    const int fd = ::eventfd(0, EFD_NONBLOCK);
     if (fd == -1)
     {
         return chip::System::MapErrorPOSIX(errno);
@@ -325,13 +325,27 @@ public:
 
     CHIP_ERROR Notify(); /**< Set the event. */
     void Confirm();      /**< Clear the event. */
-    static void Confirm(WatchableSocket & socket) { reinterpret_cast<WakeEvent *>(socket.GetCallbackData())->Confirm(); }
+    static void Confirm(WatchableSocket & socket);
+
+    using Handler = void (*)(intptr_t data);
+
+    /**
+     * Set a function that the event loop thread calls each time it clears the event, after it
+     * was set by Notify(). This allows other threads to hand work over to the event loop thread.
+     */
+    void SetHandler(Handler handler, intptr_t data)
+    {
+        mHandler     = handler;
+        mHandlerData = data;
+    }
 
 private:
 #if CHIP_SYSTEM_CONFIG_USE_POSIX_PIPE
     int mWriteFD;
 #endif
     WatchableSocket mFD;
+    Handler mHandler      = nullptr;
+    intptr_t mHandlerData = 0;
 };
 
 } // namespace System
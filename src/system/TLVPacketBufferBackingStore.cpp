@@ -23,6 +23,8 @@
 
 #include <system/TLVPacketBufferBackingStore.h>
 
+#include <algorithm>
+
 #include <support/SafeInt.h>
 
 namespace chip {
@@ -60,10 +62,23 @@ CHIP_ERROR TLVPacketBufferBackingStore::GetNextBuffer(chip::TLV::TLVReader & rea
     return CHIP_NO_ERROR;
 }
 
+void TLVPacketBufferBackingStore::SetGrowthPolicy(uint16_t nextBufferSize, uint32_t maxLength)
+{
+    mUseChainedBuffers = true;
+    mNextBufferSize    = nextBufferSize;
+    mMaxLength         = maxLength;
+
+    if (mNextBufferSize > PacketBuffer::kMaxSizeWithoutReserve)
+    {
+        mNextBufferSize = PacketBuffer::kMaxSizeWithoutReserve;
+    }
+}
+
 CHIP_ERROR TLVPacketBufferBackingStore::OnInit(chip::TLV::TLVWriter & writer, uint8_t *& bufStart, uint32_t & bufLen)
 {
-    bufStart = mHeadBuffer->Start() + mHeadBuffer->DataLength();
-    bufLen   = mHeadBuffer->AvailableDataLength();
+    bufStart         = mHeadBuffer->Start() + mHeadBuffer->DataLength();
+    bufLen           = mHeadBuffer->AvailableDataLength();
+    mAllocatedLength = bufLen;
     return CHIP_NO_ERROR;
 }
 
@@ -71,12 +86,30 @@ CHIP_ERROR TLVPacketBufferBackingStore::FinalizeBuffer(chip::TLV::TLVWriter & wr
 {
     uint8_t * endPtr = bufStart + dataLen;
 
+    if (bufStart < mCurrentBuffer->Start() || bufStart > mCurrentBuffer->Start() + mCurrentBuffer->MaxDataLength())
+    {
+        // The writer was rolled back to a checkpoint taken in an earlier buffer of the chain: resume from that buffer, and
+        // drop what was written to the buffers after it.
+        mCurrentBuffer = mHeadBuffer.Retain();
+        while (!mCurrentBuffer.IsNull() &&
+               (bufStart < mCurrentBuffer->Start() || bufStart > mCurrentBuffer->Start() + mCurrentBuffer->MaxDataLength()))
+        {
+            mCurrentBuffer.Advance();
+        }
+        VerifyOrReturnError(!mCurrentBuffer.IsNull(), CHIP_ERROR_INCORRECT_STATE);
+
+        for (PacketBufferHandle next = mCurrentBuffer->Next(); !next.IsNull(); next.Advance())
+        {
+            next->SetDataLength(0, mHeadBuffer);
+        }
+    }
+
     intptr_t length = endPtr - mCurrentBuffer->Start();
     if (!CanCastTo<uint16_t>(length))
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-    mCurrentBuffer->SetDataLength(static_cast<uint16_t>(length));
+    mCurrentBuffer->SetDataLength(static_cast<uint16_t>(length), mHeadBuffer);
 
     return CHIP_NO_ERROR;
 }
@@ -91,12 +124,25 @@ CHIP_ERROR TLVPacketBufferBackingStore::GetNewBuffer(chip::TLV::TLVWriter & writ
     mCurrentBuffer.Advance();
     if (mCurrentBuffer.IsNull())
     {
-        mCurrentBuffer = PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+        uint32_t size = mNextBufferSize;
+
+        VerifyOrReturnError(mAllocatedLength < mMaxLength, CHIP_ERROR_BUFFER_TOO_SMALL);
+        if (size > mMaxLength - mAllocatedLength)
+        {
+            size = mMaxLength - mAllocatedLength;
+        }
+
+        mCurrentBuffer = PacketBufferHandle::New(size, 0);
         if (mCurrentBuffer.IsNull())
         {
             return CHIP_ERROR_NO_MEMORY;
         }
         mHeadBuffer->AddToEnd(mCurrentBuffer.Retain());
+
+        mAllocatedLength += mCurrentBuffer->MaxDataLength();
+        mNextBufferSize = static_cast<uint16_t>(((2u * mNextBufferSize) < PacketBuffer::kMaxSizeWithoutReserve)
+                                                    ? (2u * mNextBufferSize)
+                                                    : PacketBuffer::kMaxSizeWithoutReserve);
     }
 
     if (mCurrentBuffer.IsNull())
@@ -113,5 +159,53 @@ CHIP_ERROR TLVPacketBufferBackingStore::GetNewBuffer(chip::TLV::TLVWriter & writ
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR PacketBufferTLVWriter::InitGrowable(uint32_t maxLength, uint16_t initialSize, uint16_t reservedSize)
+{
+    VerifyOrReturnError(maxLength != 0 && maxLength <= UINT16_MAX && initialSize != 0, CHIP_ERROR_INVALID_ARGUMENT);
+    if (initialSize > maxLength)
+    {
+        initialSize = static_cast<uint16_t>(maxLength);
+    }
+
+    PacketBufferHandle buffer = PacketBufferHandle::New(initialSize, reservedSize);
+    VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    mBackingStore.Init(std::move(buffer));
+    // Doubling the initial size must not wrap: no buffer is larger than kMaxSizeWithoutReserve anyway.
+    const uint32_t nextBufferSize = std::min<uint32_t>(2u * initialSize, PacketBuffer::kMaxSizeWithoutReserve);
+    mBackingStore.SetGrowthPolicy(static_cast<uint16_t>(nextBufferSize), maxLength);
+    return chip::TLV::TLVWriter::Init(mBackingStore, maxLength);
+}
+
+CHIP_ERROR PacketBufferTLVWriter::FinalizeContiguous(PacketBufferHandle * outBuffer, uint16_t reservedSize, uint16_t tailroomSize)
+{
+    PacketBufferHandle chain;
+
+    ReturnErrorOnFailure(Finalize(&chain));
+    if (!chain->HasChainedBuffer() && chain->ReservedSize() >= reservedSize && chain->AvailableDataLength() >= tailroomSize)
+    {
+        *outBuffer = std::move(chain);
+        return CHIP_NO_ERROR;
+    }
+
+    const uint16_t length = chain->TotalLength();
+    *outBuffer            = PacketBufferHandle::New(static_cast<size_t>(length) + tailroomSize, reservedSize);
+    VerifyOrReturnError(!outBuffer->IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    ReturnErrorOnFailure(chain->Read((*outBuffer)->Start(), length));
+    (*outBuffer)->SetDataLength(length);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR PacketBufferTLVWriter::Finalize(PacketBufferHandle * outBuffer, PacketBufferSegment * segments, size_t & segmentCount)
+{
+    ReturnErrorOnFailure(Finalize(outBuffer));
+
+    const size_t count = (*outBuffer)->GetSegments(segments, segmentCount);
+    VerifyOrReturnError(count <= segmentCount, CHIP_ERROR_BUFFER_TOO_SMALL);
+    segmentCount = count;
+    return CHIP_NO_ERROR;
+}
+
 } // namespace System
 } // namespace chip
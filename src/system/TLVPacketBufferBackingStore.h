@@ -60,9 +60,24 @@ public:
         mHeadBuffer        = std::move(buffer);
         mCurrentBuffer     = mHeadBuffer.Retain();
         mUseChainedBuffers = useChainedBuffers;
+        mNextBufferSize    = PacketBuffer::kMaxSizeWithoutReserve;
+        mMaxLength         = UINT32_MAX;
+        mAllocatedLength   = 0;
     }
     void Adopt(chip::System::PacketBufferHandle && buffer) { Init(std::move(buffer), mUseChainedBuffers); }
 
+    /**
+     * Grow the chain on demand with buffers of increasing sizes.
+     *
+     * When a write runs out of space at the end of the chain, the buffer appended is twice as large as the previous one
+     * appended, starting from @a nextBufferSize, up to PacketBuffer::kMaxSizeWithoutReserve. The buffers allocated by a
+     * write, including the space left in the first one, add up to no more than @a maxLength bytes. Without a growth policy,
+     * the buffers appended are of PacketBuffer::kMaxSizeWithoutReserve bytes.
+     *
+     * @note This must take place after Init(), and implies useChainedBuffers. @a nextBufferSize must not be 0.
+     */
+    void SetGrowthPolicy(uint16_t nextBufferSize, uint32_t maxLength);
+
     /**
      * Release ownership of the backing packet buffer.
      *
@@ -85,6 +100,9 @@ protected:
     chip::System::PacketBufferHandle mHeadBuffer;
     chip::System::PacketBufferHandle mCurrentBuffer;
     bool mUseChainedBuffers;
+    uint16_t mNextBufferSize  = PacketBuffer::kMaxSizeWithoutReserve;
+    uint32_t mMaxLength       = UINT32_MAX;
+    uint32_t mAllocatedLength = 0;
 };
 
 class DLL_EXPORT PacketBufferTLVReader : public chip::TLV::TLVReader
@@ -100,8 +118,19 @@ public:
      */
     void Init(chip::System::PacketBufferHandle && buffer, bool useChainedBuffers = false)
     {
-        mBackingStore.Init(std::move(buffer), useChainedBuffers);
-        chip::TLV::TLVReader::Init(mBackingStore);
+        if (useChainedBuffers && buffer->HasChainedBuffer())
+        {
+            mBackingStore.Init(std::move(buffer), useChainedBuffers);
+            chip::TLV::TLVReader::Init(mBackingStore);
+            return;
+        }
+
+        // The data is in a single buffer, which the backing store only keeps: the reader reads it directly.
+        const uint8_t * data = buffer->Start();
+        uint16_t dataLen     = buffer->DataLength();
+        mBackingStore.Init(std::move(buffer), false);
+        chip::TLV::TLVReader::Init(data, dataLen);
+        AppData = nullptr;
     }
 
 private:
@@ -125,6 +154,21 @@ public:
         mBackingStore.Init(std::move(buffer), useChainedBuffers);
         chip::TLV::TLVWriter::Init(mBackingStore);
     }
+    /**
+     * Initializes a TLVWriter object to write to a chain of PacketBuffers that grows on demand, so that a short encoding
+     * does not take up a maximum size buffer, and a long one is not limited to the size of a buffer.
+     *
+     * @param[in]    maxLength      The maximum length of the encoding, at most UINT16_MAX.
+     * @param[in]    initialSize    The space for the encoding in the first buffer of the chain. Each buffer appended to the
+     *                              chain is twice as large as the previous one, up to PacketBuffer::kMaxSizeWithoutReserve.
+     * @param[in]    reservedSize   The space reserved for protocol headers in the first buffer, before the encoding.
+     *
+     * @retval #CHIP_NO_ERROR       If the writer was initialized successfully.
+     * @retval #CHIP_ERROR_NO_MEMORY
+     *                              If the first buffer could not be allocated.
+     */
+    CHIP_ERROR InitGrowable(uint32_t maxLength, uint16_t initialSize = kDefaultInitialSize,
+                            uint16_t reservedSize = PacketBuffer::kDefaultHeaderReserve);
     /**
      * Finish the writing of a TLV encoding and release ownership of the underlying PacketBuffer.
      *
@@ -145,6 +189,44 @@ public:
         *outBuffer     = mBackingStore.Release();
         return err;
     }
+    /**
+     * Finish the writing of a TLV encoding and release it in a single PacketBuffer, for the transports that need contiguous
+     * messages. The encoding is copied to a new buffer if it spans several buffers, or if there is not enough room around it.
+     *
+     * @param[in,out] outBuffer     The packet buffer holding the encoding.
+     * @param[in]     reservedSize  The space needed for protocol headers before the encoding.
+     * @param[in]     tailroomSize  The space needed after the encoding, e.g. for a message authentication tag.
+     *
+     * @retval #CHIP_NO_ERROR       If the encoding was finalized successfully.
+     * @retval #CHIP_ERROR_TLV_CONTAINER_OPEN
+     *                              If a container writer has been opened on the current writer and not
+     *                              yet closed.
+     * @retval #CHIP_ERROR_NO_MEMORY
+     *                              If the encoding needs to be copied and does not fit in one buffer.
+     *
+     * @note No further TLV operations may be performed, unless or until this PacketBufferTLVWriter is re-initialized.
+     */
+    CHIP_ERROR FinalizeContiguous(chip::System::PacketBufferHandle * outBuffer,
+                                  uint16_t reservedSize = PacketBuffer::kDefaultHeaderReserve, uint16_t tailroomSize = 0);
+    /**
+     * Finish the writing of a TLV encoding, release ownership of the underlying chain of PacketBuffers, and describe the
+     * data of each of its buffers, for the transports that can send it with scatter/gather I/O rather than copying it.
+     *
+     * @param[in,out] outBuffer     The backing packet buffer chain, which must outlive the use of the segments.
+     * @param[out]    segments      The segments to fill, one per buffer of the chain.
+     * @param[in,out] segmentCount  On input, the number of segments in @a segments. On output, the number of buffers in
+     *                              the chain.
+     *
+     * @retval #CHIP_NO_ERROR       If the encoding was finalized successfully.
+     * @retval #CHIP_ERROR_TLV_CONTAINER_OPEN
+     *                              If a container writer has been opened on the current writer and not
+     *                              yet closed.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL
+     *                              If the chain has more buffers than @a segments.
+     *
+     * @note No further TLV operations may be performed, unless or until this PacketBufferTLVWriter is re-initialized.
+     */
+    CHIP_ERROR Finalize(chip::System::PacketBufferHandle * outBuffer, PacketBufferSegment * segments, size_t & segmentCount);
     /**
      * Free the underlying PacketBuffer.
      *
@@ -152,6 +234,8 @@ public:
      */
     void Reset() { static_cast<void>(mBackingStore.Release()); }
 
+    static constexpr uint16_t kDefaultInitialSize = 128;
+
 private:
     CHIP_ERROR Finalize() { return chip::TLV::TLVWriter::Finalize(); }
     TLVPacketBufferBackingStore mBackingStore;
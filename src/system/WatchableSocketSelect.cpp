@@ -30,17 +30,6 @@
 
 #define DEFAULT_MIN_SLEEP_PERIOD (60 * 60 * 24 * 30) // Month [sec]
 
-#if CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__
-
-namespace chip {
-namespace Mdns {
-void GetMdnsTimeout(timeval & timeout);
-void HandleMdnsTimeout();
-} // namespace Mdns
-} // namespace chip
-
-#endif // CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__
-
 namespace chip {
 namespace System {
 
@@ -161,10 +150,7 @@ void WatchableEventManager::PrepareEventsWithTimeout(struct timeval & nextTimeou
 {
     // TODO(#5556): Integrate timer platform details with WatchableEventManager.
     mSystemLayer->GetTimeout(nextTimeout);
-
-#if CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__ && !__MBED__
-    chip::Mdns::GetMdnsTimeout(nextTimeout);
-#endif // CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__
+    mNextTimeout = nextTimeout;
 
     mSelected = mRequest;
 }
@@ -199,10 +185,6 @@ void WatchableEventManager::HandleEvents()
             watchable->InvokeCallback();
         }
     }
-
-#if CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__ && !__MBED__
-    chip::Mdns::HandleMdnsTimeout();
-#endif // CHIP_DEVICE_CONFIG_ENABLE_MDNS && !__ZEPHYR__
 }
 
 void WatchableSocket::OnAttach()
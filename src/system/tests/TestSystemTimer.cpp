@@ -153,6 +153,31 @@ static void CheckOverflow(nlTestSuite * inSuite, void * aContext)
     lSys.CancelTimer(HandleTimer10Success, aContext);
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+static void CheckSleepTime(nlTestSuite * inSuite, void * aContext)
+{
+    TestContext & lContext = *static_cast<TestContext *>(aContext);
+    Layer & lSys           = *lContext.mLayer;
+
+    // Without any timer, the event loop sleeps for the time it is given, whatever it slept for the previous time.
+    const uint32_t kSleepTimesMs[] = { 1, 100, 1, 100 };
+    for (uint32_t sleepTimeMs : kSleepTimesMs)
+    {
+        struct timeval sleepTime;
+        sleepTime.tv_sec  = 0;
+        sleepTime.tv_usec = static_cast<suseconds_t>(sleepTimeMs * 1000);
+
+        const uint64_t startMs = Layer::GetClock_MonotonicMS();
+        lSys.WatchableEvents().PrepareEventsWithTimeout(sleepTime);
+        lSys.WatchableEvents().WaitForEvents();
+        const uint64_t elapsedMs = Layer::GetClock_MonotonicMS() - startMs;
+        lSys.WatchableEvents().HandleEvents();
+
+        NL_TEST_ASSERT(inSuite, elapsedMs >= sleepTimeMs - 1);
+    }
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 void HandleGreedyTimer(Layer * aLayer, void * aState, CHIP_ERROR aError)
 {
     static uint32_t sNumTimersHandled = 0;
@@ -190,6 +215,9 @@ static void CheckStarvation(nlTestSuite * inSuite, void * aContext)
 // clang-format off
 static const nlTest sTests[] =
 {
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+    NL_TEST_DEF("Timer::TestSleepTime",            CheckSleepTime),
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
     NL_TEST_DEF("Timer::TestOverflow",             CheckOverflow),
     NL_TEST_DEF("Timer::TestTimerStarvation",      CheckStarvation),
     NL_TEST_SENTINEL()
@@ -23,6 +23,8 @@
 #include <support/CHIPMem.h>
 #include <support/SafeInt.h>
 #include <transport/AdminPairingTable.h>
+
+#include <new>
 #if CHIP_CRYPTO_HSM
 #include <crypto/hsm/CHIPCryptoPALHsm.h>
 #endif
@@ -43,6 +45,30 @@ CHIP_ERROR AdminPairingInfo::SetFabricLabel(const uint8_t * fabricLabel)
     return CHIP_NO_ERROR;
 }
 
+void AdminPairingInfo::SetFabricId(FabricId fabricId)
+{
+    const FabricId oldFabricId = mFabricId;
+
+    mFabricId = fabricId;
+    OnKeysChanged(mAdmin, oldFabricId);
+}
+
+void AdminPairingInfo::SetAdminId(AdminId adminId)
+{
+    const AdminId oldAdminId = mAdmin;
+
+    mAdmin = adminId;
+    OnKeysChanged(oldAdminId, mFabricId);
+}
+
+void AdminPairingInfo::OnKeysChanged(AdminId oldAdminId, FabricId oldFabricId)
+{
+    if (mTable != nullptr)
+    {
+        mTable->OnKeysChanged(*this, oldAdminId, oldFabricId);
+    }
+}
+
 CHIP_ERROR AdminPairingInfo::StoreIntoKVS(PersistentStorageDelegate * kvs)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -129,6 +155,7 @@ CHIP_ERROR AdminPairingInfo::FetchFromKVS(PersistentStorageDelegate * kvs)
     uint16_t infoSize = sizeof(StorableAdminPairingInfo);
 
     AdminId id;
+    FabricId fabricId;
     uint16_t rootCertLen, icaCertLen, nocCertLen;
     size_t stringLength;
 
@@ -136,7 +163,7 @@ CHIP_ERROR AdminPairingInfo::FetchFromKVS(PersistentStorageDelegate * kvs)
 
     mNodeId     = Encoding::LittleEndian::HostSwap64(info->mNodeId);
     id          = Encoding::LittleEndian::HostSwap16(info->mAdmin);
-    mFabricId   = Encoding::LittleEndian::HostSwap64(info->mFabricId);
+    fabricId    = Encoding::LittleEndian::HostSwap64(info->mFabricId);
     mVendorId   = Encoding::LittleEndian::HostSwap16(info->mVendorId);
     rootCertLen = Encoding::LittleEndian::HostSwap16(info->mRootCertLen);
     icaCertLen  = Encoding::LittleEndian::HostSwap16(info->mICACertLen);
@@ -147,6 +174,7 @@ CHIP_ERROR AdminPairingInfo::FetchFromKVS(PersistentStorageDelegate * kvs)
     mFabricLabel[stringLength] = '\0'; // Set null terminator
 
     VerifyOrExit(mAdmin == id, err = CHIP_ERROR_INCORRECT_STATE);
+    SetFabricId(fabricId);
 
     if (mOperationalKey == nullptr)
     {
@@ -228,6 +256,10 @@ void AdminPairingInfo::ReleaseRootCert()
     mRootCertAllocatedLen = 0;
     mRootCertLen          = 0;
     mRootCert             = nullptr;
+    if (mDecodedCerts != nullptr)
+    {
+        mDecodedCerts->mHasRootCert = false;
+    }
 }
 
 CHIP_ERROR AdminPairingInfo::SetRootCert(const ByteSpan & cert)
@@ -253,6 +285,10 @@ CHIP_ERROR AdminPairingInfo::SetRootCert(const ByteSpan & cert)
     mRootCertLen          = static_cast<uint16_t>(cert.size());
     mRootCertAllocatedLen = (mRootCertLen > mRootCertAllocatedLen) ? mRootCertLen : mRootCertAllocatedLen;
     memcpy(mRootCert, cert.data(), mRootCertLen);
+    if (mDecodedCerts != nullptr)
+    {
+        mDecodedCerts->mHasRootCert = false;
+    }
 
     return CHIP_NO_ERROR;
 }
@@ -265,6 +301,10 @@ void AdminPairingInfo::ReleaseICACert()
     }
     mICACertLen = 0;
     mICACert    = nullptr;
+    if (mDecodedCerts != nullptr)
+    {
+        mDecodedCerts->mHasICACert = false;
+    }
 }
 
 CHIP_ERROR AdminPairingInfo::SetICACert(const ByteSpan & cert)
@@ -301,6 +341,10 @@ void AdminPairingInfo::ReleaseNOCCert()
     }
     mNOCCertLen = 0;
     mNOCCert    = nullptr;
+    if (mDecodedCerts != nullptr)
+    {
+        mDecodedCerts->mHasNOCCert = false;
+    }
 }
 
 CHIP_ERROR AdminPairingInfo::SetNOCCert(const ByteSpan & cert)
@@ -357,19 +401,27 @@ CHIP_ERROR AdminPairingInfo::SetOperationalCertsFromCertArray(const ByteSpan & c
 }
 
 CHIP_ERROR AdminPairingInfo::GetCredentials(OperationalCredentialSet & credentials, ChipCertificateSet & certificates,
-                                            CertificateKeyId & rootKeyId)
+                                            CertificateKeyId & rootKeyId, bool borrowDecodeState)
 {
     constexpr uint8_t kMaxNumCertsInOpCreds = 3;
-    ReturnErrorOnFailure(certificates.Init(kMaxNumCertsInOpCreds, kMaxCHIPCertLength * kMaxNumCertsInOpCreds));
 
-    ReturnErrorOnFailure(
-        certificates.LoadCert(mRootCert, mRootCertLen,
-                              BitFlags<CertDecodeFlags>(CertDecodeFlags::kIsTrustAnchor).Set(CertDecodeFlags::kGenerateTBSHash)));
+    const ChipCertificateData * rootCert = nullptr;
+    const ChipCertificateData * icaCert  = nullptr;
+    ReturnErrorOnFailure(GetRootCertData(rootCert));
+    ReturnErrorOnFailure(GetICACertData(icaCert));
+
+    // The credentials are usually set up for each CASE handshake: borrow the memory of the certificate set from the
+    // certificate decode pool, unless all the pool is in use.
+    static_assert(kMaxNumCertsInOpCreds <= CertificateDecodeHandle::kMaxCerts, "Certificate decode state is too small");
+    CertificateDecodeHandle decodeState = borrowDecodeState ? CertificateDecodeHandle::Acquire() : CertificateDecodeHandle();
+    ReturnErrorOnFailure(decodeState.IsNull()
+                             ? certificates.Init(kMaxNumCertsInOpCreds, kMaxCHIPCertLength * kMaxNumCertsInOpCreds)
+                             : certificates.Init(std::move(decodeState)));
 
-    if (mICACert != nullptr && mICACertLen > 0)
+    ReturnErrorOnFailure(certificates.LoadCert(*rootCert));
+    if (icaCert != nullptr)
     {
-        ReturnErrorOnFailure(
-            certificates.LoadCert(mICACert, mICACertLen, BitFlags<CertDecodeFlags>(CertDecodeFlags::kGenerateTBSHash)));
+        ReturnErrorOnFailure(certificates.LoadCert(*icaCert));
     }
 
     credentials.Release();
@@ -383,9 +435,81 @@ CHIP_ERROR AdminPairingInfo::GetCredentials(OperationalCredentialSet & credentia
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR AdminPairingInfo::GetCertData(const uint8_t * cert, uint16_t certLen, BitFlags<CertDecodeFlags> decodeFlags,
+                                         ChipCertificateData & cachedCert, bool & isCached, const ChipCertificateData *& certData)
+{
+    if (!isCached)
+    {
+        ChipCertificateSet certificates;
+        CertificateDecodeHandle decodeState = CertificateDecodeHandle::Acquire();
+        ReturnErrorOnFailure(decodeState.IsNull() ? certificates.Init(1, kMaxCHIPCertDecodeBufLength)
+                                                  : certificates.Init(std::move(decodeState)));
+        ReturnErrorOnFailure(certificates.LoadCert(cert, certLen, decodeFlags));
+
+        cachedCert = *certificates.GetLastCert();
+        isCached   = true;
+    }
+
+    certData = &cachedCert;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR AdminPairingInfo::GetRootCertData(const ChipCertificateData *& certData)
+{
+    VerifyOrReturnError(mRootCert != nullptr && mRootCertLen != 0, CHIP_ERROR_INCORRECT_STATE);
+    if (mDecodedCerts == nullptr)
+    {
+        mDecodedCerts = chip::Platform::New<DecodedCertificates>();
+        VerifyOrReturnError(mDecodedCerts != nullptr, CHIP_ERROR_NO_MEMORY);
+    }
+
+    return GetCertData(mRootCert, mRootCertLen,
+                       BitFlags<CertDecodeFlags>(CertDecodeFlags::kIsTrustAnchor).Set(CertDecodeFlags::kGenerateTBSHash),
+                       mDecodedCerts->mRootCert, mDecodedCerts->mHasRootCert, certData);
+}
+
+CHIP_ERROR AdminPairingInfo::GetICACertData(const ChipCertificateData *& certData)
+{
+    certData = nullptr;
+    VerifyOrReturnError(mICACert != nullptr && mICACertLen != 0, CHIP_NO_ERROR);
+    if (mDecodedCerts == nullptr)
+    {
+        mDecodedCerts = chip::Platform::New<DecodedCertificates>();
+        VerifyOrReturnError(mDecodedCerts != nullptr, CHIP_ERROR_NO_MEMORY);
+    }
+
+    return GetCertData(mICACert, mICACertLen, BitFlags<CertDecodeFlags>(CertDecodeFlags::kGenerateTBSHash), mDecodedCerts->mICACert,
+                       mDecodedCerts->mHasICACert, certData);
+}
+
+CHIP_ERROR AdminPairingInfo::GetNOCCertData(const ChipCertificateData *& certData)
+{
+    VerifyOrReturnError(mNOCCert != nullptr && mNOCCertLen != 0, CHIP_ERROR_INCORRECT_STATE);
+    if (mDecodedCerts == nullptr)
+    {
+        mDecodedCerts = chip::Platform::New<DecodedCertificates>();
+        VerifyOrReturnError(mDecodedCerts != nullptr, CHIP_ERROR_NO_MEMORY);
+    }
+
+    return GetCertData(mNOCCert, mNOCCertLen, BitFlags<CertDecodeFlags>(CertDecodeFlags::kGenerateTBSHash), mDecodedCerts->mNOCCert,
+                       mDecodedCerts->mHasNOCCert, certData);
+}
+
+CHIP_ERROR AdminPairingInfo::GetRootPubkey(P256PublicKeySpan & pubkey)
+{
+    const ChipCertificateData * rootCert = nullptr;
+    ReturnErrorOnFailure(GetRootCertData(rootCert));
+
+    pubkey = rootCert->mPublicKey;
+    return CHIP_NO_ERROR;
+}
+
 AdminPairingInfo * AdminPairingTable::AssignAdminId(AdminId adminId)
 {
-    for (size_t i = 0; i < CHIP_CONFIG_MAX_DEVICE_ADMINS; i++)
+    VerifyOrReturnError(adminId != kUndefinedAdminId, nullptr);
+    VerifyOrReturnError(AllocateStates() == CHIP_NO_ERROR, nullptr);
+
+    for (size_t i = 0; i < mMaxAdmins; i++)
     {
         if (!mStates[i].IsInitialized())
         {
@@ -421,11 +545,13 @@ void AdminPairingTable::ReleaseAdminId(AdminId adminId)
 
 AdminPairingInfo * AdminPairingTable::FindAdminWithId(AdminId adminId)
 {
-    for (auto & state : mStates)
+    VerifyOrReturnError(mStates != nullptr && adminId != kUndefinedAdminId, nullptr);
+
+    for (uint16_t link = mAdminBuckets[AdminIdBucket(adminId)]; link != kEndOfChain; link = mAdminNext[link - 1])
     {
-        if (state.IsInitialized() && state.GetAdminId() == adminId)
+        if (mStates[link - 1].GetAdminId() == adminId)
         {
-            return &state;
+            return &mStates[link - 1];
         }
     }
 
@@ -434,39 +560,139 @@ AdminPairingInfo * AdminPairingTable::FindAdminWithId(AdminId adminId)
 
 AdminPairingInfo * AdminPairingTable::FindAdminForNode(FabricId fabricId, NodeId nodeId, uint16_t vendorId)
 {
-    uint32_t index = 0;
-    for (auto & state : mStates)
+    VerifyOrReturnError(mStates != nullptr, nullptr);
+
+    // Several admins may match if the node ID or the vendor ID is not specified, return the first one
+    // in the table so that the result doesn't depend on the order of the index chain.
+    AdminPairingInfo * match = nullptr;
+    for (uint16_t link = mFabricBuckets[FabricIdBucket(fabricId)]; link != kEndOfChain; link = mFabricNext[link - 1])
     {
-        if (state.IsInitialized())
-        {
-            ChipLogProgress(Discovery,
-                            "Checking ind:%" PRIu32 " [fabricId 0x" ChipLogFormatX64 " nodeId 0x" ChipLogFormatX64
-                            " vendorId %" PRIu16 "] vs"
-                            " [fabricId 0x" ChipLogFormatX64 " nodeId 0x" ChipLogFormatX64 " vendorId %d]",
-                            index, ChipLogValueX64(state.GetFabricId()), ChipLogValueX64(state.GetNodeId()), state.GetVendorId(),
-                            ChipLogValueX64(fabricId), ChipLogValueX64(nodeId), vendorId);
-        }
-        if (state.IsInitialized() && state.GetFabricId() == fabricId &&
-            (nodeId == kUndefinedNodeId || state.GetNodeId() == nodeId) &&
-            (vendorId == kUndefinedVendorId || state.GetVendorId() == vendorId))
+        AdminPairingInfo & state = mStates[link - 1];
+        if (state.GetFabricId() == fabricId && (nodeId == kUndefinedNodeId || state.GetNodeId() == nodeId) &&
+            (vendorId == kUndefinedVendorId || state.GetVendorId() == vendorId) && (match == nullptr || &state < match))
         {
-            ChipLogProgress(Discovery, "Found a match!");
-            return &state;
+            match = &state;
         }
-        index++;
     }
 
-    return nullptr;
+    if (match != nullptr)
+    {
+        ChipLogProgress(Discovery, "Found admin %" PRIu16 " for [fabricId 0x" ChipLogFormatX64 " nodeId 0x" ChipLogFormatX64 "]",
+                        match->GetAdminId(), ChipLogValueX64(fabricId), ChipLogValueX64(nodeId));
+    }
+
+    return match;
 }
 
 void AdminPairingTable::Reset()
 {
-    for (size_t i = 0; i < CHIP_CONFIG_MAX_DEVICE_ADMINS; i++)
+    for (size_t i = 0; i < GetAllocatedCount(); i++)
     {
         mStates[i].Reset();
     }
 }
 
+CHIP_ERROR AdminPairingTable::AllocateStates()
+{
+    VerifyOrReturnError(mStates == nullptr, CHIP_NO_ERROR);
+
+    uint16_t bucketCount = 1;
+    while (bucketCount < mMaxAdmins)
+    {
+        bucketCount = static_cast<uint16_t>(bucketCount << 1);
+    }
+
+    mStates  = static_cast<AdminPairingInfo *>(chip::Platform::MemoryAlloc(sizeof(AdminPairingInfo) * mMaxAdmins));
+    mIndexes = static_cast<uint16_t *>(chip::Platform::MemoryCalloc(2 * (bucketCount + mMaxAdmins), sizeof(uint16_t)));
+    if (mStates == nullptr || mIndexes == nullptr)
+    {
+        chip::Platform::MemoryFree(mStates);
+        chip::Platform::MemoryFree(mIndexes);
+        mStates  = nullptr;
+        mIndexes = nullptr;
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    mBucketCount   = bucketCount;
+    mAdminBuckets  = mIndexes;
+    mFabricBuckets = mAdminBuckets + bucketCount;
+    mAdminNext     = mFabricBuckets + bucketCount;
+    mFabricNext    = mAdminNext + mMaxAdmins;
+
+    for (size_t i = 0; i < mMaxAdmins; i++)
+    {
+        new (&mStates[i]) AdminPairingInfo();
+        mStates[i].mTable = this;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void AdminPairingTable::ReleaseStates()
+{
+    VerifyOrReturn(mStates != nullptr);
+
+    for (size_t i = 0; i < mMaxAdmins; i++)
+    {
+        mStates[i].mTable = nullptr;
+        mStates[i].~AdminPairingInfo();
+    }
+
+    chip::Platform::MemoryFree(mStates);
+    chip::Platform::MemoryFree(mIndexes);
+    mStates        = nullptr;
+    mIndexes       = nullptr;
+    mAdminBuckets  = nullptr;
+    mFabricBuckets = nullptr;
+    mAdminNext     = nullptr;
+    mFabricNext    = nullptr;
+    mBucketCount   = 0;
+}
+
+uint16_t AdminPairingTable::FabricIdBucket(FabricId fabricId) const
+{
+    const uint64_t folded = fabricId ^ (fabricId >> 16) ^ (fabricId >> 32) ^ (fabricId >> 48);
+    return static_cast<uint16_t>(folded & (mBucketCount - 1));
+}
+
+void AdminPairingTable::OnKeysChanged(AdminPairingInfo & admin, AdminId oldAdminId, FabricId oldFabricId)
+{
+    // Only initialized admins are indexed.
+    const uint16_t link = static_cast<uint16_t>(&admin - mStates + 1);
+
+    if (oldAdminId != kUndefinedAdminId)
+    {
+        Unlink(mAdminBuckets, mAdminNext, AdminIdBucket(oldAdminId), link);
+        Unlink(mFabricBuckets, mFabricNext, FabricIdBucket(oldFabricId), link);
+    }
+
+    if (admin.IsInitialized())
+    {
+        uint16_t & adminBucket = mAdminBuckets[AdminIdBucket(admin.GetAdminId())];
+        mAdminNext[link - 1]   = adminBucket;
+        adminBucket            = link;
+
+        uint16_t & fabricBucket = mFabricBuckets[FabricIdBucket(admin.GetFabricId())];
+        mFabricNext[link - 1]   = fabricBucket;
+        fabricBucket            = link;
+    }
+}
+
+void AdminPairingTable::Unlink(uint16_t * buckets, uint16_t * next, uint16_t bucket, uint16_t link)
+{
+    uint16_t * current = &buckets[bucket];
+    while (*current != kEndOfChain && *current != link)
+    {
+        current = &next[*current - 1];
+    }
+
+    if (*current == link)
+    {
+        *current       = next[link - 1];
+        next[link - 1] = kEndOfChain;
+    }
+}
+
 CHIP_ERROR AdminPairingTable::Store(AdminId id)
 {
     CHIP_ERROR err           = CHIP_NO_ERROR;
@@ -540,9 +766,18 @@ exit:
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR AdminPairingTable::Init(PersistentStorageDelegate * storage)
+CHIP_ERROR AdminPairingTable::Init(PersistentStorageDelegate * storage, uint16_t maxAdmins)
 {
     VerifyOrReturnError(storage != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(maxAdmins > 0 && maxAdmins < UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+
+    if (maxAdmins != mMaxAdmins)
+    {
+        VerifyOrReturnError(cbegin() == cend(), CHIP_ERROR_INCORRECT_STATE);
+        ReleaseStates();
+        mMaxAdmins = maxAdmins;
+    }
+
     mStorage = storage;
     ChipLogDetail(Discovery, "Init admin pairing table with server storage");
     return CHIP_NO_ERROR;
@@ -50,6 +50,8 @@ static constexpr uint8_t kFabricLabelMaxLengthInBytes = 32;
 constexpr char kAdminTableKeyPrefix[] = "CHIPAdmin";
 constexpr char kAdminTableCountKey[]  = "CHIPAdminNextId";
 
+class AdminPairingTable;
+
 struct AccessControlList
 {
     uint32_t placeholder;
@@ -88,16 +90,20 @@ public:
         ReleaseRootCert();
         ReleaseICACert();
         ReleaseNOCCert();
+        if (mDecodedCerts != nullptr)
+        {
+            chip::Platform::Delete(mDecodedCerts);
+        }
     }
 
     NodeId GetNodeId() const { return mNodeId; }
     void SetNodeId(NodeId nodeId) { mNodeId = nodeId; }
 
     FabricId GetFabricId() const { return mFabricId; }
-    void SetFabricId(FabricId fabricId) { mFabricId = fabricId; }
+    void SetFabricId(FabricId fabricId);
 
     AdminId GetAdminId() const { return mAdmin; }
-    void SetAdminId(AdminId adminId) { mAdmin = adminId; }
+    void SetAdminId(AdminId adminId);
 
     uint16_t GetVendorId() const { return mVendorId; }
     void SetVendorId(uint16_t vendorId) { mVendorId = vendorId; }
@@ -123,8 +129,20 @@ public:
         return (mRootCert != nullptr && mNOCCert != nullptr && mRootCertLen != 0 && mNOCCertLen != 0);
     }
 
+    /**
+     * @brief Set up the operational credentials of the admin.
+     *
+     * @param[out] credentials        The operational credentials.
+     * @param[out] certSet            The certificate set the credentials use, which must outlive them.
+     * @param[out] rootKeyId          The key ID of the trusted root.
+     * @param[in]  borrowDecodeState  Whether the certificate set may borrow its memory from the certificate decode pool,
+     *                                rather than the heap. Credentials kept for a lifetime should not, so that they do
+     *                                not hold a state of the pool meant for CASE handshakes.
+     *
+     * @return Returns a CHIP_ERROR on error, CHIP_NO_ERROR otherwise
+     **/
     CHIP_ERROR GetCredentials(Credentials::OperationalCredentialSet & credentials, Credentials::ChipCertificateSet & certSet,
-                              Credentials::CertificateKeyId & rootKeyId);
+                              Credentials::CertificateKeyId & rootKeyId, bool borrowDecodeState = true);
 
     const uint8_t * GetTrustedRoot(uint16_t & size)
     {
@@ -132,6 +150,18 @@ public:
         return mRootCert;
     }
 
+    /**
+     * Get the decoded root, ICA and NOC certificates. Each certificate is decoded the first time it is
+     * requested, and the decoded data is kept until the certificate is replaced or released.
+     *
+     * GetICACertData() returns a null `certData` if the admin has no ICA certificate.
+     */
+    CHIP_ERROR GetRootCertData(const Credentials::ChipCertificateData *& certData);
+    CHIP_ERROR GetICACertData(const Credentials::ChipCertificateData *& certData);
+    CHIP_ERROR GetNOCCertData(const Credentials::ChipCertificateData *& certData);
+
+    CHIP_ERROR GetRootPubkey(Credentials::P256PublicKeySpan & pubkey);
+
     // TODO - Update these APIs to take ownership of the buffer, instead of copying
     //        internally.
     CHIP_ERROR SetOperationalCertsFromCertArray(const chip::ByteSpan & certArray);
@@ -150,11 +180,15 @@ public:
      */
     void Reset()
     {
+        const AdminId oldAdminId   = mAdmin;
+        const FabricId oldFabricId = mFabricId;
+
         mNodeId         = kUndefinedNodeId;
         mAdmin          = kUndefinedAdminId;
         mFabricId       = kUndefinedFabricId;
         mVendorId       = kUndefinedVendorId;
         mFabricLabel[0] = '\0';
+        OnKeysChanged(oldAdminId, oldFabricId);
 
         if (mOperationalKey != nullptr)
         {
@@ -190,6 +224,21 @@ private:
     uint8_t * mNOCCert             = nullptr;
     uint16_t mNOCCertLen           = 0;
 
+    struct DecodedCertificates
+    {
+        Credentials::ChipCertificateData mRootCert;
+        Credentials::ChipCertificateData mICACert;
+        Credentials::ChipCertificateData mNOCCert;
+        bool mHasRootCert = false;
+        bool mHasICACert  = false;
+        bool mHasNOCCert  = false;
+    };
+
+    DecodedCertificates * mDecodedCerts = nullptr;
+
+    // The table holding this admin, which indexes it by admin and fabric ID.
+    AdminPairingTable * mTable = nullptr;
+
     static constexpr size_t KeySize();
 
     static CHIP_ERROR GenerateKey(AdminId id, char * key, size_t len);
@@ -202,6 +251,12 @@ private:
     void ReleaseICACert();
     void ReleaseRootCert();
 
+    void OnKeysChanged(AdminId oldAdminId, FabricId oldFabricId);
+
+    static CHIP_ERROR GetCertData(const uint8_t * cert, uint16_t certLen, BitFlags<Credentials::CertDecodeFlags> decodeFlags,
+                                  Credentials::ChipCertificateData & cachedCert, bool & isCached,
+                                  const Credentials::ChipCertificateData *& certData);
+
     struct StorableAdminPairingInfo
     {
         uint16_t mAdmin;    /* This field is serialized in LittleEndian byte order */
@@ -312,9 +367,22 @@ private:
     }
 };
 
+/**
+ * Table of the admins that have provisioned the device.
+ *
+ * Admins are indexed by admin ID and by fabric ID, so that the lookups done for every message and
+ * every session establishment don't scan the table. The capacity of the table is set at runtime,
+ * and its storage is allocated when the first admin ID is assigned.
+ */
 class DLL_EXPORT AdminPairingTable
 {
 public:
+    AdminPairingTable() = default;
+    ~AdminPairingTable() { ReleaseStates(); }
+
+    AdminPairingTable(const AdminPairingTable &) = delete;
+    AdminPairingTable & operator=(const AdminPairingTable &) = delete;
+
     CHIP_ERROR Store(AdminId id);
     CHIP_ERROR LoadFromStorage(AdminId id);
     CHIP_ERROR Delete(AdminId id);
@@ -332,19 +400,50 @@ public:
 
     void Reset();
 
-    CHIP_ERROR Init(PersistentStorageDelegate * storage);
+    /**
+     * Initialize the table.
+     *
+     * @param[in] storage    Storage for the admins.
+     * @param[in] maxAdmins  Maximum number of admins held by the table. It can only be changed while
+     *                       the table holds no admin.
+     */
+    CHIP_ERROR Init(PersistentStorageDelegate * storage, uint16_t maxAdmins = CHIP_CONFIG_MAX_DEVICE_ADMINS);
     CHIP_ERROR SetAdminPairingDelegate(AdminPairingTableDelegate * delegate);
 
-    ConstAdminIterator cbegin() const { return ConstAdminIterator(mStates, 0, CHIP_CONFIG_MAX_DEVICE_ADMINS); }
-    ConstAdminIterator cend() const
-    {
-        return ConstAdminIterator(mStates, CHIP_CONFIG_MAX_DEVICE_ADMINS, CHIP_CONFIG_MAX_DEVICE_ADMINS);
-    }
+    uint16_t GetMaxAdmins() const { return mMaxAdmins; }
+
+    ConstAdminIterator cbegin() const { return ConstAdminIterator(mStates, 0, GetAllocatedCount()); }
+    ConstAdminIterator cend() const { return ConstAdminIterator(mStates, GetAllocatedCount(), GetAllocatedCount()); }
     ConstAdminIterator begin() const { return cbegin(); }
     ConstAdminIterator end() const { return cend(); }
 
 private:
-    AdminPairingInfo mStates[CHIP_CONFIG_MAX_DEVICE_ADMINS];
+    friend class AdminPairingInfo;
+
+    // Links of the index chains hold the slot index plus one, so that zero terminates a chain.
+    static constexpr uint16_t kEndOfChain = 0;
+
+    CHIP_ERROR AllocateStates();
+    void ReleaseStates();
+    size_t GetAllocatedCount() const { return (mStates != nullptr) ? mMaxAdmins : 0; }
+
+    uint16_t AdminIdBucket(AdminId adminId) const { return static_cast<uint16_t>(adminId & (mBucketCount - 1)); }
+    uint16_t FabricIdBucket(FabricId fabricId) const;
+
+    void OnKeysChanged(AdminPairingInfo & admin, AdminId oldAdminId, FabricId oldFabricId);
+    static void Unlink(uint16_t * buckets, uint16_t * next, uint16_t bucket, uint16_t link);
+
+    AdminPairingInfo * mStates = nullptr;
+    uint16_t mMaxAdmins        = CHIP_CONFIG_MAX_DEVICE_ADMINS;
+
+    // Chained hash indexes by admin ID and by fabric ID, all allocated with a single allocation.
+    uint16_t * mIndexes       = nullptr;
+    uint16_t * mAdminBuckets  = nullptr;
+    uint16_t * mFabricBuckets = nullptr;
+    uint16_t * mAdminNext     = nullptr;
+    uint16_t * mFabricNext    = nullptr;
+    uint16_t mBucketCount     = 0;
+
     PersistentStorageDelegate * mStorage = nullptr;
 
     // TODO: Admin Pairing table should be backed by a single backing store (attribute store), remove delegate callbacks #6419
@@ -0,0 +1,231 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Implementation of CryptoWorkerPool, a set of worker threads that run
+ *      cryptographic operations off the CHIP event loop thread.
+ *
+ */
+
+#include <transport/CryptoWorkerPool.h>
+
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/logging/CHIPLogging.h>
+
+namespace chip {
+
+CHIP_ERROR CryptoWorkerPool::Init(System::Layer & systemLayer, unsigned threadCount, size_t maxJobs)
+{
+    VerifyOrReturnError(!IsRunning(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(threadCount > 0 && threadCount <= kMaxThreads && maxJobs > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mBlocked = static_cast<const void **>(chip::Platform::MemoryCalloc(maxJobs, sizeof(const void *)));
+    VerifyOrReturnError(mBlocked != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    CHIP_ERROR err = mCompletionEvent.Open(systemLayer.WatchableEvents());
+    if (err != CHIP_NO_ERROR)
+    {
+        chip::Platform::MemoryFree(mBlocked);
+        mBlocked = nullptr;
+        return err;
+    }
+    mCompletionEvent.SetHandler(HandleCompletions, reinterpret_cast<intptr_t>(this));
+
+    // A worker may have flagged a completion after the last jobs were completed: the new event has no pending notification.
+    mCompletionPending.store(false);
+
+    mMaxJobs       = maxJobs;
+    mStopRequested = false;
+    for (mThreadCount = 0; mThreadCount < threadCount; mThreadCount++)
+    {
+        mThreads[mThreadCount] = std::thread(&CryptoWorkerPool::WorkerMain, this);
+    }
+
+    ChipLogProgress(Inet, "Started %u crypto worker threads", mThreadCount);
+    return CHIP_NO_ERROR;
+}
+
+void CryptoWorkerPool::Shutdown()
+{
+    VerifyOrReturn(IsRunning());
+
+    Flush();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopRequested = true;
+    }
+    mWorkAvailable.notify_all();
+
+    for (unsigned i = 0; i < mThreadCount; i++)
+    {
+        mThreads[i].join();
+    }
+    mThreadCount = 0;
+
+    mCompletionEvent.Close();
+    chip::Platform::MemoryFree(mBlocked);
+    mBlocked = nullptr;
+    mMaxJobs = 0;
+}
+
+CHIP_ERROR CryptoWorkerPool::Submit(Job * job, const void * lane)
+{
+    VerifyOrReturnError(job != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(IsRunning(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!IsFull(), CHIP_ERROR_NO_MEMORY);
+
+    job->mLane         = lane;
+    job->mNextPending  = nullptr;
+    job->mNextInFlight = nullptr;
+    job->mDone.store(false, std::memory_order_relaxed);
+
+    *mInFlightTail = job;
+    mInFlightTail  = &job->mNextInFlight;
+    mInFlightCount++;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mPendingTail == nullptr)
+        {
+            mPendingHead = job;
+        }
+        else
+        {
+            mPendingTail->mNextPending = job;
+        }
+        mPendingTail = job;
+        mUnfinished++;
+    }
+    mWorkAvailable.notify_one();
+
+    return CHIP_NO_ERROR;
+}
+
+void CryptoWorkerPool::Flush()
+{
+    // Jobs cannot be completed from the completion of another job.
+    VerifyOrReturn(!mProcessing);
+
+    // Completing a job may submit others, so wait until the pool is drained.
+    while (mInFlightHead != nullptr)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWorkDone.wait(lock, [this] { return mUnfinished == 0; });
+        }
+        ProcessCompletions();
+    }
+}
+
+void CryptoWorkerPool::WorkerMain()
+{
+    while (true)
+    {
+        Job * job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mWorkAvailable.wait(lock, [this] { return mPendingHead != nullptr || mStopRequested; });
+            if (mPendingHead == nullptr)
+            {
+                return;
+            }
+
+            job          = mPendingHead;
+            mPendingHead = job->mNextPending;
+            if (mPendingHead == nullptr)
+            {
+                mPendingTail = nullptr;
+            }
+        }
+
+        job->Run();
+        job->mDone.store(true);
+
+        // The event loop clears mCompletionPending before it looks for done jobs, so a single
+        // notification is enough for any number of jobs that are done meanwhile.
+        if (!mCompletionPending.exchange(true))
+        {
+            mCompletionEvent.Notify();
+        }
+
+        bool drained;
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            drained = (--mUnfinished == 0);
+        }
+        if (drained)
+        {
+            mWorkDone.notify_all();
+        }
+    }
+}
+
+void CryptoWorkerPool::ProcessCompletions()
+{
+    // Completing a job may submit another one, which is then appended to the list that is being
+    // walked, but must not complete jobs recursively.
+    VerifyOrReturn(!mProcessing);
+    mProcessing = true;
+
+    mCompletionPending.store(false);
+
+    size_t blockedCount = 0;
+    Job ** link         = &mInFlightHead;
+    while (*link != nullptr)
+    {
+        Job * job = *link;
+
+        bool blocked = !job->mDone.load();
+        for (size_t i = 0; !blocked && job->mLane != nullptr && i < blockedCount; i++)
+        {
+            blocked = (mBlocked[i] == job->mLane);
+        }
+
+        if (blocked)
+        {
+            // Later jobs of the same lane must wait for this one.
+            if (job->mLane != nullptr && blockedCount < mMaxJobs)
+            {
+                mBlocked[blockedCount++] = job->mLane;
+            }
+            link = &job->mNextInFlight;
+            continue;
+        }
+
+        *link = job->mNextInFlight;
+        if (*link == nullptr)
+        {
+            mInFlightTail = link;
+        }
+        mInFlightCount--;
+
+        job->Complete();
+        chip::Platform::Delete(job);
+    }
+
+    mProcessing = false;
+}
+
+} // namespace chip
+
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
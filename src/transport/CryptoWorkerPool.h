@@ -0,0 +1,172 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Declaration of CryptoWorkerPool, a set of worker threads that run
+ *      cryptographic operations off the CHIP event loop thread.
+ *
+ */
+
+#pragma once
+
+#include <core/CHIPCore.h>
+#include <system/SystemLayer.h>
+
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#define CHIP_CRYPTO_WORKER_POOL_SUPPORTED 1
+#else
+#define CHIP_CRYPTO_WORKER_POOL_SUPPORTED 0
+#endif
+
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace chip {
+
+/**
+ * @brief
+ *   A pool of worker threads that run cryptographic jobs, and that hand the results back to the
+ *   CHIP event loop thread.
+ *
+ *   Jobs are submitted from the event loop thread, run in parallel on the worker threads, and are
+ *   then completed on the event loop thread. Jobs submitted with the same lane are completed in
+ *   the order in which they were submitted, whatever the order in which they ran, so that e.g. the
+ *   messages of a session are dispatched in the order in which they were received.
+ *
+ *   All the methods of the pool must be called on the event loop thread (i.e. with the CHIP stack
+ *   lock held).
+ */
+class DLL_EXPORT CryptoWorkerPool
+{
+public:
+    class Job
+    {
+    public:
+        virtual ~Job() = default;
+
+        /**
+         * Called on a worker thread. This must only access the state owned by the job, as the
+         * rest of the stack is concurrently used by the event loop thread.
+         */
+        virtual void Run() = 0;
+
+        /**
+         * Called on the event loop thread after Run() returned.
+         */
+        virtual void Complete() = 0;
+
+    private:
+        friend class CryptoWorkerPool;
+
+        Job * mNextPending      = nullptr;
+        Job * mNextInFlight     = nullptr;
+        const void * mLane      = nullptr;
+        std::atomic<bool> mDone = { false };
+    };
+
+    static constexpr unsigned kMaxThreads = 16;
+
+    CryptoWorkerPool() = default;
+    ~CryptoWorkerPool() { Shutdown(); }
+
+    CryptoWorkerPool(const CryptoWorkerPool &) = delete;
+    CryptoWorkerPool & operator=(const CryptoWorkerPool &) = delete;
+
+    /**
+     * @brief
+     *   Start the worker threads.
+     *
+     * @param[in] systemLayer  The system layer of the event loop on which jobs are completed.
+     * @param[in] threadCount  The number of worker threads, at most kMaxThreads.
+     * @param[in] maxJobs      The maximum number of jobs that may be submitted and not yet completed.
+     */
+    CHIP_ERROR Init(System::Layer & systemLayer, unsigned threadCount, size_t maxJobs);
+
+    /**
+     * @brief
+     *   Complete all the submitted jobs, and stop the worker threads.
+     */
+    void Shutdown();
+
+    bool IsRunning() const { return mThreadCount != 0; }
+
+    /**
+     * @brief
+     *   Return whether no more jobs can be submitted until some of the submitted ones are completed.
+     */
+    bool IsFull() const { return mInFlightCount >= mMaxJobs; }
+
+    /**
+     * @brief
+     *   Submit a job. On success, the pool owns the job, and deletes it with chip::Platform::Delete()
+     *   once it is completed.
+     *
+     * @param[in] job   The job, allocated with chip::Platform::New().
+     * @param[in] lane  The jobs submitted with the same non-null lane are completed in submission order.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE  if the pool is not running.
+     * @retval CHIP_ERROR_NO_MEMORY        if the pool is full. The caller still owns the job.
+     */
+    CHIP_ERROR Submit(Job * job, const void * lane = nullptr);
+
+    /**
+     * @brief
+     *   Wait for all the submitted jobs to run, and complete them. This does nothing when called
+     *   from the completion of a job.
+     */
+    void Flush();
+
+private:
+    static void HandleCompletions(intptr_t data) { reinterpret_cast<CryptoWorkerPool *>(data)->ProcessCompletions(); }
+
+    void WorkerMain();
+    void ProcessCompletions();
+
+    System::WakeEvent mCompletionEvent;
+    std::atomic<bool> mCompletionPending = { false };
+
+    std::thread mThreads[kMaxThreads];
+    unsigned mThreadCount = 0;
+
+    // Jobs that have not been picked up by a worker yet, protected by mMutex.
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailable;
+    std::condition_variable mWorkDone;
+    Job * mPendingHead  = nullptr;
+    Job * mPendingTail  = nullptr;
+    size_t mUnfinished  = 0;
+    bool mStopRequested = false;
+
+    // All the submitted jobs that are not completed yet, in submission order. Only accessed by
+    // the event loop thread.
+    Job * mInFlightHead    = nullptr;
+    Job ** mInFlightTail   = &mInFlightHead;
+    size_t mInFlightCount  = 0;
+    size_t mMaxJobs        = 0;
+    const void ** mBlocked = nullptr;
+    bool mProcessing       = false;
+};
+
+} // namespace chip
+
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
@@ -23,15 +23,159 @@
 #include <transport/MessageCounter.h>
 
 #include <platform/CHIPDeviceLayer.h>
+#include <support/ErrorStr.h>
 #include <support/RandUtils.h>
+#include <support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
 
 namespace chip {
 
 GlobalUnencryptedMessageCounter::GlobalUnencryptedMessageCounter() : value(GetRandU32()) {}
 
+#if CONFIG_DEVICE_LAYER
+
+GlobalEncryptedMessageCounter::~GlobalEncryptedMessageCounter()
+{
+    Shutdown();
+}
+
 CHIP_ERROR GlobalEncryptedMessageCounter::Init()
 {
-    return persisted.Init(CHIP_CONFIG_PERSISTED_STORAGE_KEY_GLOBAL_MESSAGE_COUNTER, 1000);
+    ReturnErrorOnFailure(persisted.Init(CHIP_CONFIG_PERSISTED_STORAGE_KEY_GLOBAL_MESSAGE_COUNTER,
+                                        CHIP_CONFIG_GLOBAL_MESSAGE_COUNTER_MIN_EPOCH, CHIP_CONFIG_GLOBAL_MESSAGE_COUNTER_MAX_EPOCH,
+                                        this));
+
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    std::lock_guard<std::mutex> lock(mFlushMutex);
+    if (!mFlushThread.joinable())
+    {
+        mFlushRequested  = false;
+        mFlushThreadStop = false;
+        mFlushThread     = std::thread(&GlobalEncryptedMessageCounter::FlushThreadMain, this);
+    }
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
+    return CHIP_NO_ERROR;
+}
+
+void GlobalEncryptedMessageCounter::Shutdown()
+{
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    if (mFlushThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(mFlushMutex);
+            mFlushThreadStop = true;
+        }
+        mFlushCondition.notify_all();
+        mFlushThread.join();
+    }
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
 }
 
+CHIP_ERROR GlobalEncryptedMessageCounter::ScheduleFlush(PersistedCounter & counter)
+{
+    // Half of the previous reservation was used since the last call, adapt the size of the next ones to that rate.
+    uint64_t now = System::Platform::Layer::GetClock_MonotonicMS();
+    if (mLastReservationMs != 0)
+    {
+        uint64_t elapsed = now - mLastReservationMs;
+        if (elapsed < kReservationIntervalMs / 2)
+        {
+            counter.SetEpoch(counter.GetEpoch() * 2);
+        }
+        else if (elapsed > kReservationIntervalMs * 2)
+        {
+            counter.SetEpoch(counter.GetEpoch() / 2);
+        }
+    }
+    mLastReservationMs = now;
+
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    std::lock_guard<std::mutex> lock(mFlushMutex);
+    VerifyOrReturnError(mFlushThread.joinable() && !mFlushThreadStop, CHIP_ERROR_INCORRECT_STATE);
+    mFlushRequested = true;
+    mFlushCondition.notify_all();
+#else
+    DeviceLayer::PlatformMgr().ScheduleWork(FlushWork, reinterpret_cast<intptr_t>(this));
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
+    return CHIP_NO_ERROR;
+}
+
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+
+void GlobalEncryptedMessageCounter::FlushThreadMain()
+{
+    std::unique_lock<std::mutex> lock(mFlushMutex);
+    while (true)
+    {
+        mFlushCondition.wait(lock, [this] { return mFlushRequested || mFlushThreadStop; });
+        if (mFlushThreadStop)
+        {
+            break;
+        }
+
+        mFlushRequested = false;
+        mFlushing       = true;
+        lock.unlock();
+
+        CHIP_ERROR err = persisted.Flush();
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Failed to persist the global message counter: %s", ErrorStr(err));
+        }
+
+        lock.lock();
+        mFlushing = false;
+        mFlushCondition.notify_all();
+    }
+}
+
+void GlobalEncryptedMessageCounter::WaitForFlush(PersistedCounter & counter)
+{
+    std::unique_lock<std::mutex> lock(mFlushMutex);
+    mFlushCondition.wait(lock, [this] { return !mFlushing; });
+}
+
+#else
+
+void GlobalEncryptedMessageCounter::WaitForFlush(PersistedCounter & counter)
+{
+    // Reservations are written from the CHIP thread, which is the one that waits for them.
+}
+
+void GlobalEncryptedMessageCounter::FlushWork(intptr_t arg)
+{
+    GlobalEncryptedMessageCounter * self = reinterpret_cast<GlobalEncryptedMessageCounter *>(arg);
+
+    CHIP_ERROR err = self->persisted.Flush();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to persist the global message counter: %s", ErrorStr(err));
+    }
+}
+
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
+#else
+
+GlobalEncryptedMessageCounter::~GlobalEncryptedMessageCounter() {}
+
+CHIP_ERROR GlobalEncryptedMessageCounter::Init()
+{
+    return persisted.Init(CHIP_CONFIG_PERSISTED_STORAGE_KEY_GLOBAL_MESSAGE_COUNTER, CHIP_CONFIG_GLOBAL_MESSAGE_COUNTER_MIN_EPOCH);
+}
+
+void GlobalEncryptedMessageCounter::Shutdown() {}
+
+CHIP_ERROR GlobalEncryptedMessageCounter::ScheduleFlush(PersistedCounter & counter)
+{
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+}
+
+void GlobalEncryptedMessageCounter::WaitForFlush(PersistedCounter & counter) {}
+
+#endif // CONFIG_DEVICE_LAYER
+
 } // namespace chip
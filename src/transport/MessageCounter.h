@@ -23,6 +23,12 @@
 
 #include <support/PersistedCounter.h>
 
+#if CONFIG_DEVICE_LAYER && CHIP_DEVICE_LAYER_TARGET_LINUX
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
 namespace chip {
 
 /**
@@ -83,13 +89,14 @@ private:
     uint32_t value;
 };
 
-class GlobalEncryptedMessageCounter : public MessageCounter
+class GlobalEncryptedMessageCounter : public MessageCounter, private PersistedCounterFlusher
 {
 public:
     GlobalEncryptedMessageCounter() {}
-    ~GlobalEncryptedMessageCounter() override {}
+    ~GlobalEncryptedMessageCounter() override;
 
     CHIP_ERROR Init();
+    void Shutdown();
     Type GetType() override { return GlobalEncrypted; }
     void Reset() override
     { /* null op */
@@ -99,8 +106,33 @@ public:
     CHIP_ERROR SetCounter(uint32_t count) override { return CHIP_ERROR_NOT_IMPLEMENTED; }
 
 private:
+    CHIP_ERROR ScheduleFlush(PersistedCounter & counter) override;
+    void WaitForFlush(PersistedCounter & counter) override;
+
 #if CONFIG_DEVICE_LAYER
+    /**
+     * Reservations are sized so that half of one lasts about this long at the observed message rate:
+     * a busy node rarely writes the counter, and an idle one skips few values on reboot.
+     */
+    static constexpr uint64_t kReservationIntervalMs = 10000;
+
     PersistedCounter persisted;
+    uint64_t mLastReservationMs = 0;
+
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    // Writing the storage rewrites the whole configuration file on Linux, so reservations are
+    // written by a dedicated thread, running from Init() to Shutdown().
+    void FlushThreadMain();
+
+    std::thread mFlushThread;
+    std::mutex mFlushMutex;
+    std::condition_variable mFlushCondition;
+    bool mFlushRequested  = false;
+    bool mFlushing        = false;
+    bool mFlushThreadStop = false;
+#else
+    static void FlushWork(intptr_t arg);
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
 #else
     struct FakePersistedCounter
     {
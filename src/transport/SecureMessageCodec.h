@@ -69,6 +69,25 @@ CHIP_ERROR Encode(NodeId localNodeId, Transport::PeerConnectionState * state, Pa
  */
 CHIP_ERROR Decode(Transport::PeerConnectionState * state, PayloadHeader & payloadHeader, const PacketHeader & packetHeader,
                   System::PacketBufferHandle & msgBuf);
+
+/**
+ * @brief
+ *  Decrypt the message with the given session keys, perform message integrity check, and
+ *  decode the payload header. This does not access the connection state, so it can be
+ *  used off the CHIP event loop thread with a copy of the session keys.
+ *
+ * @param session       The session keys
+ * @param payloadHeader Reference to the payload header that should be inserted in
+ *                      the message
+ * @param packetHeader  Reference to the packet header that contains unencrypted
+ *                      portion of the message header
+ * @param msgBuf        The message buffer that contains the encrypted message. If
+ *                      the operation is successuful, this buffer will contain the
+ *                      unencrypted message.
+ * @ return CHIP_ERROR  The result of the decode operation
+ */
+CHIP_ERROR Decode(const SecureSession & session, PayloadHeader & payloadHeader, const PacketHeader & packetHeader,
+                  System::PacketBufferHandle & msgBuf);
 } // namespace SecureMessageCodec
 
 } // namespace chip
@@ -87,6 +87,12 @@ CHIP_ERROR SecureSessionMgr::Init(NodeId localNodeId, System::Layer * systemLaye
 
     mGlobalEncryptedMessageCounter.Init();
 
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED && CHIP_CONFIG_CRYPTO_WORKER_THREADS > 0
+    ReturnErrorOnFailure(
+        mDefaultCryptoWorkers.Init(*systemLayer, CHIP_CONFIG_CRYPTO_WORKER_THREADS, CHIP_CONFIG_CRYPTO_WORKER_QUEUE_SIZE));
+    mCryptoWorkers = &mDefaultCryptoWorkers;
+#endif
+
     ChipLogProgress(Inet, "local node id is 0x" ChipLogFormatX64, ChipLogValueX64(mLocalNodeId));
 
     ScheduleExpiryTimer();
@@ -102,7 +108,22 @@ void SecureSessionMgr::Shutdown()
 
     mMessageCounterManager = nullptr;
 
-    mState        = State::kNotReady;
+    mState = State::kNotReady;
+
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+    // The messages that are still being decrypted are dropped, as the manager is not ready anymore.
+    if (mCryptoWorkers != nullptr)
+    {
+        mCryptoWorkers->Flush();
+        mCryptoWorkers = nullptr;
+    }
+#if CHIP_CONFIG_CRYPTO_WORKER_THREADS > 0
+    mDefaultCryptoWorkers.Shutdown();
+#endif
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+    mGlobalEncryptedMessageCounter.Shutdown();
+
     mLocalNodeId  = kUndefinedNodeId;
     mSystemLayer  = nullptr;
     mTransportMgr = nullptr;
@@ -342,16 +363,21 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+    if (mCryptoWorkers != nullptr && mCryptoWorkers->IsFull())
+    {
+        // Wait for the messages that are being decrypted rather than decrypting this one right away, so
+        // that it is not dispatched before the messages that were received earlier on the same session.
+        mCryptoWorkers->Flush();
+    }
+#endif
+
     PeerConnectionState * state = mPeerConnections.FindPeerConnectionState(packetHeader.GetEncryptionKeyID(), nullptr);
 
     PayloadHeader payloadHeader;
 
     Transport::AdminPairingInfo * admin = nullptr;
 
-    bool modifiedAdmin = false;
-    NodeId localNodeId;
-    FabricId fabricId;
-
     SecureSessionMgrDelegate::DuplicateMessage isDuplicate = SecureSessionMgrDelegate::DuplicateMessage::No;
 
     VerifyOrExit(!msg.IsNull(), ChipLogError(Inet, "Secure transport received NULL packet, discarding"));
@@ -433,15 +459,41 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
 
     mPeerConnections.MarkConnectionActive(state);
 
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+    if (DecryptOnWorker(packetHeader, peerAddress, state, msg))
+    {
+        return;
+    }
+#endif
+
     // Decode the message
     VerifyOrExit(CHIP_NO_ERROR == SecureMessageCodec::Decode(state, payloadHeader, packetHeader, msg),
                  ChipLogError(Inet, "Secure transport received message, but failed to decode it, discarding"));
 
+    DecodedMessageDispatch(packetHeader, payloadHeader, state, admin, peerAddress, isDuplicate, std::move(msg));
+
+exit:
+    if (err != CHIP_NO_ERROR && mCB != nullptr)
+    {
+        mCB->OnReceiveError(err, peerAddress);
+    }
+}
+
+void SecureSessionMgr::DecodedMessageDispatch(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                              PeerConnectionState * state, Transport::AdminPairingInfo * admin,
+                                              const Transport::PeerAddress & peerAddress,
+                                              SecureSessionMgrDelegate::DuplicateMessage isDuplicate,
+                                              System::PacketBufferHandle && msg)
+{
+    bool modifiedAdmin = false;
+    NodeId localNodeId;
+    FabricId fabricId;
+
     if (isDuplicate == SecureSessionMgrDelegate::DuplicateMessage::Yes && !payloadHeader.NeedsAck())
     {
         // If it's a duplicate message, but doesn't require an ack, let's drop it right here to save CPU
         // cycles on further message processing.
-        ExitNow(err = CHIP_NO_ERROR);
+        return;
     }
 
     if (packetHeader.GetFlags().Has(Header::FlagValues::kSecureSessionControlMessage))
@@ -509,14 +561,109 @@ void SecureSessionMgr::SecureMessageDispatch(const PacketHeader & packetHeader,
         SecureSessionHandle session(state->GetPeerNodeId(), state->GetPeerKeyID(), state->GetAdminId());
         mCB->OnMessageReceived(packetHeader, payloadHeader, session, peerAddress, isDuplicate, std::move(msg));
     }
+}
 
-exit:
-    if (err != CHIP_NO_ERROR && mCB != nullptr)
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+/**
+ * Decrypts a received message on a crypto worker thread, with a copy of the session keys, so that
+ * the connection state can be updated or released meanwhile.
+ */
+class SecureSessionMgr::DecryptJob : public CryptoWorkerPool::Job
+{
+public:
+    DecryptJob(SecureSessionMgr & mgr, const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
+               PeerConnectionState * state, System::PacketBufferHandle && msg) :
+        mMgr(mgr),
+        mPacketHeader(packetHeader), mPeerAddress(peerAddress), mState(state), mPeerNodeId(state->GetPeerNodeId()),
+        mSession(state->GetSecureSession()), mMsg(std::move(msg))
+    {}
+
+    void Run() override
+    {
+        mResult = SecureMessageCodec::Decode(mSession, mPayloadHeader, mPacketHeader, mMsg);
+        mSession.Reset();
+    }
+
+    void Complete() override { mMgr.OnMessageDecrypted(*this); }
+
+    SecureSessionMgr & mMgr;
+    const PacketHeader mPacketHeader;
+    const Transport::PeerAddress mPeerAddress;
+    PeerConnectionState * const mState;
+    const NodeId mPeerNodeId;
+    SecureSession mSession;
+    System::PacketBufferHandle mMsg;
+    PayloadHeader mPayloadHeader;
+    CHIP_ERROR mResult = CHIP_NO_ERROR;
+};
+
+bool SecureSessionMgr::DecryptOnWorker(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
+                                       PeerConnectionState * state, System::PacketBufferHandle & msg)
+{
+    VerifyOrReturnError(mCryptoWorkers != nullptr && !mCryptoWorkers->IsFull(), false);
+
+    DecryptJob * job = chip::Platform::New<DecryptJob>(*this, packetHeader, peerAddress, state, std::move(msg));
+    VerifyOrReturnError(job != nullptr, false);
+
+    // The messages of a session are dispatched in the order in which they were received.
+    if (mCryptoWorkers->Submit(job, state) != CHIP_NO_ERROR)
     {
-        mCB->OnReceiveError(err, peerAddress);
+        msg = std::move(job->mMsg);
+        chip::Platform::Delete(job);
+        return false;
+    }
+
+    return true;
+}
+
+void SecureSessionMgr::OnMessageDecrypted(DecryptJob & job)
+{
+    const PacketHeader & packetHeader = job.mPacketHeader;
+
+    SecureSessionMgrDelegate::DuplicateMessage isDuplicate = SecureSessionMgrDelegate::DuplicateMessage::No;
+
+    VerifyOrReturn(mState == State::kInitialized);
+
+    // The connection state may have been released, or reused for another session, while the message was being decrypted.
+    PeerConnectionState * state = mPeerConnections.FindPeerConnectionState(packetHeader.GetEncryptionKeyID(), nullptr);
+    VerifyOrReturn(state == job.mState && state->GetPeerNodeId() == job.mPeerNodeId,
+                   ChipLogError(Inet, "Secure transport decrypted message for an expired session, discarding"));
+
+    VerifyOrReturn(job.mResult == CHIP_NO_ERROR,
+                   ChipLogError(Inet, "Secure transport received message, but failed to decode it, discarding"));
+
+    // The counter was verified when the message was received, but other messages of the session
+    // may have been committed since then.
+    if (!packetHeader.GetFlags().Has(Header::FlagValues::kSecureSessionControlMessage))
+    {
+        CHIP_ERROR err = state->GetSessionMessageCounter().GetPeerMessageCounter().Verify(packetHeader.GetMessageId());
+        if (err == CHIP_ERROR_DUPLICATE_MESSAGE_RECEIVED)
+        {
+            ChipLogDetail(Inet, "Received a duplicate message");
+            isDuplicate = SecureSessionMgrDelegate::DuplicateMessage::Yes;
+        }
+        else if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Inet, "Message counter verify failed, err = %" CHIP_ERROR_FORMAT, err);
+            if (mCB != nullptr)
+            {
+                mCB->OnReceiveError(err, job.mPeerAddress);
+            }
+            return;
+        }
     }
+
+    Transport::AdminPairingInfo * admin = mAdmins->FindAdminWithId(state->GetAdminId());
+    VerifyOrReturn(admin != nullptr,
+                   ChipLogError(Inet, "Secure transport received packet for unknown admin (%p, %d) pairing, discarding", state,
+                                state->GetAdminId()));
+
+    DecodedMessageDispatch(packetHeader, job.mPayloadHeader, state, admin, job.mPeerAddress, isDuplicate, std::move(job.mMsg));
 }
 
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
 void SecureSessionMgr::HandleConnectionExpired(const Transport::PeerConnectionState & state)
 {
     ChipLogDetail(Inet, "Marking old secure session for device 0x" ChipLogFormatX64 " as expired",
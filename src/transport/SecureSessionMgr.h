@@ -34,6 +34,7 @@
 #include <support/CodeUtils.h>
 #include <support/DLLUtil.h>
 #include <transport/AdminPairingTable.h>
+#include <transport/CryptoWorkerPool.h>
 #include <transport/MessageCounterManagerInterface.h>
 #include <transport/PairingSession.h>
 #include <transport/PeerConnections.h>
@@ -272,6 +273,21 @@ public:
 
     TransportMgrBase * GetTransportManager() const { return mTransportMgr; }
 
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+    /**
+     * @brief
+     *   Set the worker pool on which received messages are decrypted, and on which the secure
+     *   sessions established through this manager verify signatures. Messages are decrypted
+     *   synchronously when the pool is null.
+     *
+     *   The pool must be running for as long as it is set. When CHIP_CONFIG_CRYPTO_WORKER_THREADS
+     *   is non-zero, the manager sets up its own pool in Init().
+     */
+    void SetCryptoWorkerPool(CryptoWorkerPool * pool) { mCryptoWorkers = pool; }
+
+    CryptoWorkerPool * GetCryptoWorkerPool() const { return mCryptoWorkers; }
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
     /**
      * @brief
      *   Handle received secure message. Implements TransportMgrDelegate
@@ -310,6 +326,25 @@ private:
     GlobalUnencryptedMessageCounter mGlobalUnencryptedMessageCounter;
     GlobalEncryptedMessageCounter mGlobalEncryptedMessageCounter;
 
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+    class DecryptJob;
+
+    CryptoWorkerPool * mCryptoWorkers = nullptr;
+#if CHIP_CONFIG_CRYPTO_WORKER_THREADS > 0
+    CryptoWorkerPool mDefaultCryptoWorkers;
+#endif
+
+    /**
+     * Submit the decryption of a received message to the crypto worker pool.
+     *
+     * @return true if the message is being decrypted, in which case it is dispatched by
+     *         OnMessageDecrypted(). On false, msg is not modified.
+     */
+    bool DecryptOnWorker(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
+                         Transport::PeerConnectionState * state, System::PacketBufferHandle & msg);
+    void OnMessageDecrypted(DecryptJob & job);
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
     /** Schedules a new oneshot timer for checking connection expiry. */
     void ScheduleExpiryTimer();
 
@@ -328,6 +363,10 @@ private:
 
     void SecureMessageDispatch(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
                                System::PacketBufferHandle && msg);
+    void DecodedMessageDispatch(const PacketHeader & packetHeader, const PayloadHeader & payloadHeader,
+                                Transport::PeerConnectionState * state, Transport::AdminPairingInfo * admin,
+                                const Transport::PeerAddress & peerAddress, SecureSessionMgrDelegate::DuplicateMessage isDuplicate,
+                                System::PacketBufferHandle && msg);
     void MessageDispatch(const PacketHeader & packetHeader, const Transport::PeerAddress & peerAddress,
                          System::PacketBufferHandle && msg);
 
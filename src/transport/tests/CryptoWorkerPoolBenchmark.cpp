@@ -0,0 +1,202 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the decryption of messages received on several
+ *      sessions, on the event loop thread and on a crypto worker pool.
+ *
+ */
+
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <transport/CryptoWorkerPool.h>
+#include <transport/SecureMessageCodec.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <chrono>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+namespace {
+
+using namespace chip;
+
+constexpr size_t kSessionCount    = 16;
+constexpr size_t kMessageCount    = 4096;
+constexpr uint16_t kPayloadSize   = 1024;
+constexpr unsigned kWorkerThreads = 4;
+
+// Decrypts a message with a copy of the session keys, as SecureSessionMgr does.
+class DecryptJob : public CryptoWorkerPool::Job
+{
+public:
+    DecryptJob(const SecureSession & session, const PacketHeader & packetHeader, System::PacketBufferHandle && msg,
+               uint32_t & decrypted) :
+        mSession(session),
+        mPacketHeader(packetHeader), mMsg(std::move(msg)), mDecrypted(decrypted)
+    {}
+
+    void Run() override { mResult = SecureMessageCodec::Decode(mSession, mPayloadHeader, mPacketHeader, mMsg); }
+
+    void Complete() override
+    {
+        if (mResult == CHIP_NO_ERROR)
+        {
+            mDecrypted++;
+        }
+    }
+
+private:
+    SecureSession mSession;
+    const PacketHeader mPacketHeader;
+    System::PacketBufferHandle mMsg;
+    PayloadHeader mPayloadHeader;
+    uint32_t & mDecrypted;
+    CHIP_ERROR mResult = CHIP_NO_ERROR;
+};
+
+struct EncryptedMessage
+{
+    size_t mSession;
+    PacketHeader mPacketHeader;
+    System::PacketBufferHandle mMsg;
+};
+
+uint64_t Rate(size_t count, int64_t elapsedUs)
+{
+    return static_cast<uint64_t>(count) * 1000000 / static_cast<uint64_t>(elapsedUs + 1);
+}
+
+// Decrypts 1 KB messages received on several sessions, interleaved, on the event loop thread and
+// then on a crypto worker pool, the way SecureSessionMgr does it.
+bool BenchmarkMultiSessionDecrypt(chip::Test::IOContext & ctx)
+{
+    const uint8_t salt[] = "benchmark salt";
+
+    Transport::PeerConnectionState senders[kSessionCount];
+    SecureSession receivers[kSessionCount];
+    for (size_t i = 0; i < kSessionCount; i++)
+    {
+        uint8_t secret[32];
+        memset(secret, static_cast<int>(i + 1), sizeof(secret));
+        VerifyOrReturnError(senders[i].GetSecureSession().InitFromSecret(ByteSpan(secret), ByteSpan(salt),
+                                                                         SecureSession::SessionInfoType::kSessionEstablishment,
+                                                                         SecureSession::SessionRole::kInitiator) == CHIP_NO_ERROR,
+                            false);
+        VerifyOrReturnError(receivers[i].InitFromSecret(ByteSpan(secret), ByteSpan(salt),
+                                                        SecureSession::SessionInfoType::kSessionEstablishment,
+                                                        SecureSession::SessionRole::kResponder) == CHIP_NO_ERROR,
+                            false);
+    }
+
+    std::vector<EncryptedMessage> messages(kMessageCount);
+    for (size_t i = 0; i < kMessageCount; i++)
+    {
+        EncryptedMessage & message              = messages[i];
+        Transport::PeerConnectionState & sender = senders[i % kSessionCount];
+        PayloadHeader payloadHeader;
+
+        message.mSession = i % kSessionCount;
+        message.mMsg     = System::PacketBufferHandle::New(kPayloadSize + 64);
+        VerifyOrReturnError(!message.mMsg.IsNull(), false);
+        memset(message.mMsg->Start(), 0x5a, kPayloadSize);
+        message.mMsg->SetDataLength(kPayloadSize);
+        VerifyOrReturnError(SecureMessageCodec::Encode(1, &sender, payloadHeader, message.mPacketHeader, message.mMsg,
+                                                       sender.GetSessionMessageCounter().GetLocalMessageCounter()) == CHIP_NO_ERROR,
+                            false);
+    }
+
+    auto start         = std::chrono::steady_clock::now();
+    uint32_t syncCount = 0;
+    for (EncryptedMessage & message : messages)
+    {
+        PayloadHeader payloadHeader;
+        System::PacketBufferHandle msg = message.mMsg.CloneData();
+        if (SecureMessageCodec::Decode(receivers[message.mSession], payloadHeader, message.mPacketHeader, msg) == CHIP_NO_ERROR)
+        {
+            syncCount++;
+        }
+    }
+    auto syncUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    CryptoWorkerPool pool;
+    VerifyOrReturnError(pool.Init(ctx.GetSystemLayer(), kWorkerThreads, CHIP_CONFIG_CRYPTO_WORKER_QUEUE_SIZE) == CHIP_NO_ERROR,
+                        false);
+
+    start              = std::chrono::steady_clock::now();
+    uint32_t poolCount = 0;
+    for (EncryptedMessage & message : messages)
+    {
+        if (pool.IsFull())
+        {
+            pool.Flush();
+        }
+        DecryptJob * job = chip::Platform::New<DecryptJob>(receivers[message.mSession], message.mPacketHeader,
+                                                           message.mMsg.CloneData(), poolCount);
+        VerifyOrReturnError(pool.Submit(job, &receivers[message.mSession]) == CHIP_NO_ERROR, false);
+    }
+    pool.Flush();
+    auto poolUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    pool.Shutdown();
+
+    if (syncCount != kMessageCount || poolCount != kMessageCount)
+    {
+        fprintf(stderr, "Decrypted %" PRIu32 " messages on the event loop thread and %" PRIu32 " on the pool, out of %zu\n",
+                syncCount, poolCount, kMessageCount);
+        return false;
+    }
+
+    printf("Decrypted %zu messages on %zu sessions\n", kMessageCount, kSessionCount);
+    printf("Event loop thread: %" PRIu64 " messages/s\n", Rate(kMessageCount, syncUs));
+    printf("%u crypto workers: %" PRIu64 " messages/s\n", kWorkerThreads, Rate(kMessageCount, poolUs));
+    return true;
+}
+
+} // namespace
+
+int main()
+{
+    chip::Test::IOContext ctx;
+
+    if (ctx.Init(nullptr) != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to initialize the system layer\n");
+        return EXIT_FAILURE;
+    }
+
+    bool succeeded = BenchmarkMultiSessionDecrypt(ctx);
+
+    ctx.Shutdown();
+    return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+int main()
+{
+    printf("The crypto worker pool is not supported on this platform\n");
+    return EXIT_SUCCESS;
+}
+
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
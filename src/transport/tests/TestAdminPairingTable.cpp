@@ -0,0 +1,262 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the AdminPairingTable class
+ *      within the transport layer
+ *
+ */
+
+#include <credentials/CHIPCert.h>
+#include <credentials/tests/CHIPCert_test_vectors.h>
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+#include <transport/AdminPairingTable.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Credentials;
+using namespace chip::Transport;
+
+class TestPersistentStorageDelegate : public PersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override { return CHIP_ERROR_KEY_NOT_FOUND; }
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override { return CHIP_NO_ERROR; }
+    CHIP_ERROR SyncDeleteKeyValue(const char * key) override { return CHIP_NO_ERROR; }
+};
+
+void TestFindAdminWithId(nlTestSuite * inSuite, void * inContext)
+{
+    AdminPairingTable admins;
+
+    NL_TEST_ASSERT(inSuite, admins.FindAdminWithId(0) == nullptr);
+    NL_TEST_ASSERT(inSuite, admins.cbegin() == admins.cend());
+
+    for (AdminId id = 0; id < CHIP_CONFIG_MAX_DEVICE_ADMINS; id++)
+    {
+        AdminPairingInfo * admin = admins.AssignAdminId(static_cast<AdminId>(id * 7), id);
+        NL_TEST_ASSERT(inSuite, admin != nullptr);
+    }
+    NL_TEST_ASSERT(inSuite, admins.AssignAdminId(1000) == nullptr);
+
+    for (AdminId id = 0; id < CHIP_CONFIG_MAX_DEVICE_ADMINS; id++)
+    {
+        AdminPairingInfo * admin = admins.FindAdminWithId(static_cast<AdminId>(id * 7));
+        NL_TEST_ASSERT(inSuite, admin != nullptr && admin->GetNodeId() == id);
+    }
+    NL_TEST_ASSERT(inSuite, admins.FindAdminWithId(1) == nullptr);
+
+    admins.ReleaseAdminId(14);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminWithId(14) == nullptr);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminWithId(7) != nullptr);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminWithId(21) != nullptr);
+
+    // The released slot can be reused.
+    NL_TEST_ASSERT(inSuite, admins.AssignAdminId(1000) != nullptr);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminWithId(1000) != nullptr);
+
+    admins.Reset();
+    NL_TEST_ASSERT(inSuite, admins.FindAdminWithId(0) == nullptr);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminWithId(1000) == nullptr);
+    NL_TEST_ASSERT(inSuite, admins.cbegin() == admins.cend());
+}
+
+void TestFindAdminForNode(nlTestSuite * inSuite, void * inContext)
+{
+    AdminPairingTable admins;
+
+    AdminPairingInfo * admin1 = admins.AssignAdminId(1, 100);
+    AdminPairingInfo * admin2 = admins.AssignAdminId(2, 200);
+    AdminPairingInfo * admin3 = admins.AssignAdminId(3, 300);
+    NL_TEST_ASSERT(inSuite, admin1 != nullptr && admin2 != nullptr && admin3 != nullptr);
+
+    admin1->SetFabricId(0xFAB1);
+    admin2->SetFabricId(0xFAB1);
+    admin3->SetFabricId(0xFAB3);
+    admin3->SetVendorId(0xFFF1);
+
+    NL_TEST_ASSERT(inSuite, admins.FindAdminForNode(0xFAB1) == admin1);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminForNode(0xFAB1, 200) == admin2);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminForNode(0xFAB1, 300) == nullptr);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminForNode(0xFAB3, kUndefinedNodeId, 0xFFF1) == admin3);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminForNode(0xFAB3, kUndefinedNodeId, 0xFFF2) == nullptr);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminForNode(0xFAB2) == nullptr);
+
+    // Changing the fabric ID moves the admin in the index.
+    admin1->SetFabricId(0xFAB2);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminForNode(0xFAB1) == admin2);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminForNode(0xFAB2) == admin1);
+
+    admins.ReleaseAdminId(2);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminForNode(0xFAB1) == nullptr);
+    NL_TEST_ASSERT(inSuite, admins.FindAdminForNode(0xFAB2, 100) == admin1);
+}
+
+void TestMaxAdmins(nlTestSuite * inSuite, void * inContext)
+{
+    AdminPairingTable admins;
+    TestPersistentStorageDelegate storage;
+
+    NL_TEST_ASSERT(inSuite, admins.Init(&storage, 0) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, admins.Init(&storage, 40) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, admins.GetMaxAdmins() == 40);
+
+    for (AdminId id = 0; id < 40; id++)
+    {
+        NL_TEST_ASSERT(inSuite, admins.AssignAdminId(id) != nullptr);
+    }
+    NL_TEST_ASSERT(inSuite, admins.AssignAdminId(40) == nullptr);
+
+    size_t count = 0;
+    for (auto & admin : admins)
+    {
+        NL_TEST_ASSERT(inSuite, admin.IsInitialized());
+        count++;
+    }
+    NL_TEST_ASSERT(inSuite, count == 40);
+
+    // The capacity cannot change while admins are held.
+    NL_TEST_ASSERT(inSuite, admins.Init(&storage, 2) == CHIP_ERROR_INCORRECT_STATE);
+    admins.Reset();
+    NL_TEST_ASSERT(inSuite, admins.Init(&storage, 2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, admins.AssignAdminId(0) != nullptr);
+    NL_TEST_ASSERT(inSuite, admins.AssignAdminId(1) != nullptr);
+    NL_TEST_ASSERT(inSuite, admins.AssignAdminId(2) == nullptr);
+}
+
+void TestDecodedCertificates(nlTestSuite * inSuite, void * inContext)
+{
+    using namespace chip::TestCerts;
+
+    AdminPairingTable admins;
+    AdminPairingInfo * admin = admins.AssignAdminId(0);
+    NL_TEST_ASSERT(inSuite, admin != nullptr);
+
+    const ChipCertificateData * certData = nullptr;
+    NL_TEST_ASSERT(inSuite, admin->GetRootCertData(certData) == CHIP_ERROR_INCORRECT_STATE);
+
+    NL_TEST_ASSERT(inSuite, admin->SetRootCert(ByteSpan(sTestCert_Root01_Chip, sTestCert_Root01_Chip_Len)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, admin->SetICACert(ByteSpan(sTestCert_ICA01_Chip, sTestCert_ICA01_Chip_Len)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, admin->SetNOCCert(ByteSpan(sTestCert_Node01_01_Chip, sTestCert_Node01_01_Chip_Len)) == CHIP_NO_ERROR);
+
+    const ChipCertificateData * rootCert = nullptr;
+    NL_TEST_ASSERT(inSuite, admin->GetRootCertData(rootCert) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, rootCert != nullptr && rootCert->mCertFlags.Has(CertFlags::kIsTrustAnchor));
+
+    // The decoded certificate is cached.
+    NL_TEST_ASSERT(inSuite, admin->GetRootCertData(certData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, certData == rootCert);
+
+    P256PublicKeySpan pubkey;
+    NL_TEST_ASSERT(inSuite, admin->GetRootPubkey(pubkey) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, memcmp(pubkey.data(), sTestCert_Root01_PublicKey, sTestCert_Root01_PublicKey_Len) == 0);
+
+    NL_TEST_ASSERT(inSuite, admin->GetICACertData(certData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, certData != nullptr && certData->mCertFlags.Has(CertFlags::kTBSHashPresent));
+
+    NL_TEST_ASSERT(inSuite, admin->GetNOCCertData(certData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite,
+                   certData != nullptr &&
+                       certData->mCertificate.data_equal(ByteSpan(sTestCert_Node01_01_Chip, sTestCert_Node01_01_Chip_Len)));
+
+    // Replacing a certificate drops its decoded form.
+    NL_TEST_ASSERT(inSuite, admin->SetICACert(ByteSpan()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, admin->GetICACertData(certData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, certData == nullptr);
+
+    admins.ReleaseAdminId(0);
+    NL_TEST_ASSERT(inSuite, admin->GetRootCertData(certData) == CHIP_ERROR_INCORRECT_STATE);
+}
+
+void TestCredentialsDecodeState(nlTestSuite * inSuite, void * inContext)
+{
+    using namespace chip::TestCerts;
+
+    AdminPairingTable admins;
+    AdminPairingInfo * admin = admins.AssignAdminId(0);
+    NL_TEST_ASSERT(inSuite, admin != nullptr);
+    NL_TEST_ASSERT(inSuite, admin->SetRootCert(ByteSpan(sTestCert_Root01_Chip, sTestCert_Root01_Chip_Len)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, admin->SetICACert(ByteSpan(sTestCert_ICA01_Chip, sTestCert_ICA01_Chip_Len)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, admin->SetNOCCert(ByteSpan(sTestCert_Node01_01_Chip, sTestCert_Node01_01_Chip_Len)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, admin->GetOperationalKey() != nullptr);
+
+    for (bool borrowDecodeState : { true, false })
+    {
+        ChipCertificateSet certificates;
+        OperationalCredentialSet credentials;
+        CertificateKeyId rootKeyId;
+        NL_TEST_ASSERT(inSuite, admin->GetCredentials(credentials, certificates, rootKeyId, borrowDecodeState) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, certificates.GetCertCount() == 2);
+
+#if CHIP_CONFIG_CERT_DECODE_POOL_SIZE > 0
+        // Credentials kept for a lifetime leave all the pool to the CASE handshakes.
+        CertificateDecodeHandle handles[CHIP_CONFIG_CERT_DECODE_POOL_SIZE];
+        for (size_t i = 0; i < CHIP_CONFIG_CERT_DECODE_POOL_SIZE; i++)
+        {
+            handles[i] = CertificateDecodeHandle::Acquire();
+            NL_TEST_ASSERT(inSuite, handles[i].IsNull() == (borrowDecodeState && i == CHIP_CONFIG_CERT_DECODE_POOL_SIZE - 1));
+        }
+#endif // CHIP_CONFIG_CERT_DECODE_POOL_SIZE > 0
+
+        credentials.Release();
+        certificates.Release();
+    }
+}
+
+int Setup(void * inContext)
+{
+    CHIP_ERROR error = chip::Platform::MemoryInit();
+    if (error != CHIP_NO_ERROR)
+        return FAILURE;
+    return SUCCESS;
+}
+
+int Teardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+// clang-format off
+static const nlTest sTests[] =
+{
+    NL_TEST_DEF("FindAdminWithId", TestFindAdminWithId),
+    NL_TEST_DEF("FindAdminForNode", TestFindAdminForNode),
+    NL_TEST_DEF("MaxAdmins", TestMaxAdmins),
+    NL_TEST_DEF("DecodedCertificates", TestDecodedCertificates),
+    NL_TEST_DEF("CredentialsDecodeState", TestCredentialsDecodeState),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestAdminPairingTable(void)
+{
+    nlTestSuite theSuite = { "Transport-AdminPairingTable", &sTests[0], Setup, Teardown };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestAdminPairingTable)
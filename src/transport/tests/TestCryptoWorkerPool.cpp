@@ -0,0 +1,231 @@
+/*
+ *
+ *    Copyright (c) 2021 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the CryptoWorkerPool class
+ *      within the transport layer
+ *
+ */
+
+#include <support/CHIPMem.h>
+#include <support/CodeUtils.h>
+#include <support/UnitTestRegistration.h>
+#include <transport/CryptoWorkerPool.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <nlunit-test.h>
+
+#if CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+#include <chrono>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+
+using TestContext = chip::Test::IOContext;
+
+TestContext sContext;
+
+class RecordingJob : public CryptoWorkerPool::Job
+{
+public:
+    RecordingJob(std::vector<int> & completed, int id, unsigned delayUs) : mCompleted(completed), mId(id), mDelayUs(delayUs) {}
+
+    void Run() override
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(mDelayUs));
+        mWorkerThread = std::this_thread::get_id();
+    }
+
+    void Complete() override
+    {
+        // Jobs run on a worker thread, and are completed on the event loop thread.
+        mRanOnWorker = (mWorkerThread != std::this_thread::get_id());
+        mCompleted.push_back(mRanOnWorker ? mId : -1);
+    }
+
+private:
+    std::vector<int> & mCompleted;
+    const int mId;
+    const unsigned mDelayUs;
+    std::thread::id mWorkerThread;
+    bool mRanOnWorker = false;
+};
+
+void CheckLaneOrder(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    CryptoWorkerPool pool;
+    std::vector<int> completed;
+    int laneA, laneB;
+
+    NL_TEST_ASSERT(inSuite, pool.Init(ctx.GetSystemLayer(), 4, 32) == CHIP_NO_ERROR);
+
+    // Earlier jobs of each lane take longer, so that they are done after the later ones.
+    for (int i = 0; i < 8; i++)
+    {
+        unsigned delayUs = static_cast<unsigned>(8 - i) * 2000;
+        NL_TEST_ASSERT(inSuite,
+                       pool.Submit(chip::Platform::New<RecordingJob>(completed, i, delayUs), (i % 2) ? &laneB : &laneA) ==
+                           CHIP_NO_ERROR);
+    }
+
+    ctx.DriveIOUntil(5000, [&completed] { return completed.size() == 8; });
+    NL_TEST_ASSERT(inSuite, completed.size() == 8);
+
+    int lastA = -2, lastB = -1;
+    for (int id : completed)
+    {
+        NL_TEST_ASSERT(inSuite, id >= 0);
+        int & last = (id % 2) ? lastB : lastA;
+        NL_TEST_ASSERT(inSuite, id == last + 2);
+        last = id;
+    }
+
+    pool.Shutdown();
+    NL_TEST_ASSERT(inSuite, !pool.IsRunning());
+}
+
+void CheckFlush(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    CryptoWorkerPool pool;
+    std::vector<int> completed;
+
+    NL_TEST_ASSERT(inSuite, pool.Submit(chip::Platform::New<RecordingJob>(completed, 0, 0)) == CHIP_ERROR_INCORRECT_STATE);
+    NL_TEST_ASSERT(inSuite, pool.Init(ctx.GetSystemLayer(), 2, 2) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, pool.Submit(chip::Platform::New<RecordingJob>(completed, 0, 1000)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pool.Submit(chip::Platform::New<RecordingJob>(completed, 1, 0)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pool.IsFull());
+
+    RecordingJob * rejected = chip::Platform::New<RecordingJob>(completed, 2, 0);
+    NL_TEST_ASSERT(inSuite, pool.Submit(rejected) == CHIP_ERROR_NO_MEMORY);
+    chip::Platform::Delete(rejected);
+
+    // Flush completes the jobs without running the event loop.
+    pool.Flush();
+    NL_TEST_ASSERT(inSuite, completed.size() == 2);
+    NL_TEST_ASSERT(inSuite, !pool.IsFull());
+
+    // Jobs that are still pending are completed on shutdown.
+    NL_TEST_ASSERT(inSuite, pool.Submit(chip::Platform::New<RecordingJob>(completed, 3, 1000)) == CHIP_NO_ERROR);
+    pool.Shutdown();
+    NL_TEST_ASSERT(inSuite, completed.size() == 3 && completed.back() == 3);
+}
+
+// Sleeps in its completion, so that the jobs which are done meanwhile are completed in the same pass.
+class SlowCompletionJob : public CryptoWorkerPool::Job
+{
+public:
+    SlowCompletionJob(std::vector<int> & completed, int id, unsigned runDelayUs, unsigned completeDelayUs) :
+        mCompleted(completed), mId(id), mRunDelayUs(runDelayUs), mCompleteDelayUs(completeDelayUs)
+    {}
+
+    void Run() override { std::this_thread::sleep_for(std::chrono::microseconds(mRunDelayUs)); }
+
+    void Complete() override
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(mCompleteDelayUs));
+        mCompleted.push_back(mId);
+    }
+
+private:
+    std::vector<int> & mCompleted;
+    const int mId;
+    const unsigned mRunDelayUs;
+    const unsigned mCompleteDelayUs;
+};
+
+void CheckRestart(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    CryptoWorkerPool pool;
+    std::vector<int> completed;
+
+    // The second job is done while the first one is being completed, so both are completed by the same pass, which
+    // leaves the notification of the second one pending when the pool is shut down.
+    NL_TEST_ASSERT(inSuite, pool.Init(ctx.GetSystemLayer(), 2, 4) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pool.Submit(chip::Platform::New<SlowCompletionJob>(completed, 0, 0, 50000)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pool.Submit(chip::Platform::New<SlowCompletionJob>(completed, 1, 10000, 0)) == CHIP_NO_ERROR);
+    ctx.DriveIOUntil(5000, [&completed] { return completed.size() == 2; });
+    NL_TEST_ASSERT(inSuite, completed.size() == 2);
+    pool.Shutdown();
+
+    // The restarted pool still wakes the event loop up to complete its jobs.
+    NL_TEST_ASSERT(inSuite, pool.Init(ctx.GetSystemLayer(), 2, 4) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, pool.Submit(chip::Platform::New<SlowCompletionJob>(completed, 2, 0, 0)) == CHIP_NO_ERROR);
+    ctx.DriveIOUntil(1000, [&completed] { return completed.size() == 3; });
+    NL_TEST_ASSERT(inSuite, completed.size() == 3);
+    pool.Shutdown();
+}
+
+int Initialize(void * aContext);
+int Finalize(void * aContext);
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("LaneOrder", CheckLaneOrder),
+    NL_TEST_DEF("Flush", CheckFlush),
+    NL_TEST_DEF("Restart", CheckRestart),
+    NL_TEST_SENTINEL()
+};
+
+nlTestSuite sSuite =
+{
+    "Transport-CryptoWorkerPool",
+    &sTests[0],
+    Initialize,
+    Finalize
+};
+// clang-format on
+
+int Initialize(void * aContext)
+{
+    CHIP_ERROR err = reinterpret_cast<TestContext *>(aContext)->Init(&sSuite);
+    return (err == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int Finalize(void * aContext)
+{
+    CHIP_ERROR err = reinterpret_cast<TestContext *>(aContext)->Shutdown();
+    return (err == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+} // namespace
+
+int TestCryptoWorkerPool()
+{
+    nlTestRunner(&sSuite, &sContext);
+    return nlTestRunnerStats(&sSuite);
+}
+
+#else // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+int TestCryptoWorkerPool()
+{
+    return SUCCESS;
+}
+
+#endif // CHIP_CRYPTO_WORKER_POOL_SUPPORTED
+
+CHIP_REGISTER_TEST_SUITE(TestCryptoWorkerPool)